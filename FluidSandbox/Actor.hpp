@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 
@@ -46,6 +48,8 @@ struct Actor {
 	ActorTransform transform;
 	glm::vec4 color;
 	glm::vec3 velocity;
+	// Stable id of actors created from a scenario, used to match them on reload. Zero for actors created at runtime
+	uint64_t id;
 	void *physicsData;
 	float timeElapsed;
 	float density;
@@ -61,6 +65,7 @@ struct Actor {
 		transform(ActorTransform()),
 		color(glm::vec4(1.0f)),
 		velocity(glm::vec3(0.0f)),
+		id(0),
 		physicsData(nullptr),
 		timeElapsed(0.0f),
 		density(1.0f),
@@ -78,6 +83,7 @@ struct Actor {
 		transform = source->transform;
 		color = source->color;
 		velocity = source->velocity;
+		id = source->id;
 		physicsData = nullptr;
 		timeElapsed = source->timeElapsed;
 		density = source->density;
@@ -57,6 +57,7 @@ protected:
 	void updateUniformLocations() {
 		ulocFontTex = getUniformLocation("fontTex");
 		ulocMVP = getUniformLocation("mvp");
+		ulocIsSDF = getUniformLocation("isSDF");
 	}
 
 public:
@@ -64,11 +65,13 @@ public:
 
 	GLuint ulocFontTex;
 	GLuint ulocMVP;
+	GLuint ulocIsSDF;
 
 	CFontShader():
 		CGLSL(),
 		ulocFontTex(0),
-		ulocMVP(0) {
+		ulocMVP(0),
+		ulocIsSDF(0) {
 	}
 
 };
@@ -93,6 +96,51 @@ public:
 
 };
 
+class CLightingInstancedShader: public CGLSL {
+protected:
+
+	void updateUniformLocations() {
+		ulocViewProj = getUniformLocation("viewProj");
+		alocInstanceModel = getAttribLocation("instanceModel");
+		alocInstanceColor = getAttribLocation("instanceColor");
+	}
+
+public:
+	static constexpr char *ShaderName = "LightingInstanced";
+
+	GLuint ulocViewProj;
+	// NOTE(final): Matrix attributes occupy four consecutive locations, one for each column
+	GLint alocInstanceModel;
+	GLint alocInstanceColor;
+
+	CLightingInstancedShader():
+		CGLSL(),
+		ulocViewProj(0),
+		alocInstanceModel(-1),
+		alocInstanceColor(-1) {
+	}
+
+};
+
+class CDebugLineShader: public CGLSL {
+protected:
+
+	void updateUniformLocations() {
+		ulocMVP = getUniformLocation("mvp");
+	}
+
+public:
+	static constexpr char *ShaderName = "DebugLine";
+
+	GLuint ulocMVP;
+
+	CDebugLineShader():
+		CGLSL(),
+		ulocMVP(0) {
+	}
+
+};
+
 class CSkyboxShader: public CGLSL {
 protected:
 
@@ -0,0 +1,374 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - AssetPack.cpp
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#include "AssetPack.h"
+
+#include <assert.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <final_platform_layer.h>
+
+constexpr uint32_t AssetPackFileMagic = 0x50415346; // FSAP
+constexpr uint32_t AssetPackFileVersion = 1;
+constexpr uint64_t AssetPackDataAlignment = 16;
+
+struct CAssetPack::Header {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t entryCount;
+	uint32_t slotCount;
+	uint64_t slotsOffset;
+	uint64_t namesOffset;
+	uint64_t namesSize;
+};
+
+// Open addressing hash table with linear probing, a hash of zero marks a empty slot
+struct CAssetPack::Slot {
+	uint64_t hash;
+	uint64_t dataOffset;
+	uint64_t dataSize;
+	uint64_t modifyTime;
+	uint32_t nameOffset;
+	uint32_t nameLength;
+};
+
+static const CAssetPack *gActiveAssetPack = nullptr;
+
+static uint64_t HashEntryName(const char *name, const size_t len) {
+	// FNV-1a over the lower case name
+	uint64_t result = 0xCBF29CE484222325ULL;
+	for(size_t i = 0; i < len; ++i) {
+		result ^= (uint8_t)tolower((unsigned char)name[i]);
+		result *= 0x100000001B3ULL;
+	}
+	if(result == 0)
+		result = 1;
+	return(result);
+}
+
+static bool EqualsIgnoreCase(const char *a, const char *b, const size_t len) {
+	for(size_t i = 0; i < len; ++i) {
+		if(tolower((unsigned char)a[i]) != tolower((unsigned char)b[i]))
+			return(false);
+	}
+	return(true);
+}
+
+static std::string ToForwardSlashes(const std::string &path) {
+	std::string result = path;
+	for(size_t i = 0; i < result.size(); ++i) {
+		if(result[i] == '\\')
+			result[i] = '/';
+	}
+	return(result);
+}
+
+static bool MatchesFilter(const char *name, const size_t len, const std::string &filter) {
+	if(filter.empty() || filter == "*" || filter == "*.*")
+		return(true);
+	if(filter.size() < 2 || filter[0] != '*')
+		return(filter.size() == len && EqualsIgnoreCase(name, filter.c_str(), len));
+	size_t suffixLen = filter.size() - 1;
+	return(len >= suffixLen && EqualsIgnoreCase(name + len - suffixLen, filter.c_str() + 1, suffixLen));
+}
+
+void AssetData::Release() {
+	if(ownedData != nullptr)
+		delete[] ownedData;
+	*this = {};
+}
+
+CAssetPack::CAssetPack():
+	mapping({}),
+	header(nullptr),
+	slots(nullptr),
+	names(nullptr) {
+}
+
+CAssetPack::~CAssetPack() {
+	Close();
+}
+
+bool CAssetPack::Open(const std::string &filePath, const std::string &rootPath) {
+	Close();
+	if(!COSLowLevel::mapFile(filePath.c_str(), &mapping))
+		return(false);
+
+	// NOTE(final): Everything is validated against the file size, so a truncated or foreign file is just ignored
+	const Header *fileHeader = (const Header *)mapping.data;
+	bool isValid = mapping.size >= sizeof(Header) &&
+		fileHeader->magic == AssetPackFileMagic &&
+		fileHeader->version == AssetPackFileVersion &&
+		fileHeader->slotCount > 0 && (fileHeader->slotCount & (fileHeader->slotCount - 1)) == 0 &&
+		fileHeader->entryCount < fileHeader->slotCount &&
+		fileHeader->slotsOffset + (uint64_t)fileHeader->slotCount * sizeof(Slot) <= mapping.size &&
+		fileHeader->namesOffset + fileHeader->namesSize <= mapping.size;
+	if(!isValid) {
+		printf("Warning: Asset pack '%s' is invalid, ignore it!\n", filePath.c_str());
+		COSLowLevel::unmapFile(&mapping);
+		return(false);
+	}
+
+	header = fileHeader;
+	slots = (const Slot *)(mapping.data + header->slotsOffset);
+	names = (const char *)(mapping.data + header->namesOffset);
+	this->rootPath = ToForwardSlashes(rootPath);
+	if(!this->rootPath.empty() && this->rootPath.back() != '/')
+		this->rootPath += '/';
+	return(true);
+}
+
+void CAssetPack::Close() {
+	COSLowLevel::unmapFile(&mapping);
+	header = nullptr;
+	slots = nullptr;
+	names = nullptr;
+}
+
+std::string CAssetPack::GetEntryName(const char *path) const {
+	std::string result = ToForwardSlashes(path);
+	if(!rootPath.empty() && result.size() >= rootPath.size() && EqualsIgnoreCase(result.c_str(), rootPath.c_str(), rootPath.size()))
+		result.erase(0, rootPath.size());
+	while(result.size() >= 2 && result[0] == '.' && result[1] == '/')
+		result.erase(0, 2);
+	return(result);
+}
+
+const CAssetPack::Slot *CAssetPack::FindSlot(const std::string &name) const {
+	if(header == nullptr)
+		return(nullptr);
+	uint64_t hash = HashEntryName(name.c_str(), name.size());
+	uint32_t mask = header->slotCount - 1;
+	for(uint32_t probe = 0; probe < header->slotCount; ++probe) {
+		const Slot *slot = slots + ((hash + probe) & mask);
+		if(slot->hash == 0)
+			break;
+		if(slot->hash == hash &&
+			slot->nameLength == name.size() &&
+			(uint64_t)slot->nameOffset + slot->nameLength <= header->namesSize &&
+			EqualsIgnoreCase(names + slot->nameOffset, name.c_str(), name.size())) {
+			return(slot);
+		}
+	}
+	return(nullptr);
+}
+
+bool CAssetPack::Find(const char *path, AssetData *outAsset) const {
+	const Slot *slot = FindSlot(GetEntryName(path));
+	if(slot == nullptr || slot->dataOffset + slot->dataSize + 1 > mapping.size)
+		return(false);
+	AssetData &asset = *outAsset;
+	asset = {};
+	asset.data = (const char *)(mapping.data + slot->dataOffset);
+	asset.size = (size_t)slot->dataSize;
+	asset.modifyTime = slot->modifyTime;
+	return(true);
+}
+
+void CAssetPack::GetFilesInDirectory(const std::string &folderPath, const std::string &filter, std::vector<std::string> &outNames) const {
+	if(header == nullptr)
+		return;
+	std::string folder = GetEntryName(folderPath.c_str());
+	if(!folder.empty() && folder.back() != '/')
+		folder += '/';
+	for(uint32_t slotIndex = 0; slotIndex < header->slotCount; ++slotIndex) {
+		const Slot &slot = slots[slotIndex];
+		if(slot.hash == 0 || (uint64_t)slot.nameOffset + slot.nameLength > header->namesSize)
+			continue;
+		const char *name = names + slot.nameOffset;
+		if(slot.nameLength <= folder.size() || !EqualsIgnoreCase(name, folder.c_str(), folder.size()))
+			continue;
+		const char *fileName = name + folder.size();
+		size_t fileNameLen = slot.nameLength - folder.size();
+		if(memchr(fileName, '/', fileNameLen) != nullptr || !MatchesFilter(fileName, fileNameLen, filter))
+			continue;
+		outNames.push_back(std::string(fileName, fileNameLen));
+	}
+}
+
+static bool ReadLooseFile(const char *filePath, AssetData *outAsset) {
+	fplFileHandle file;
+	if(!fplFileOpenBinary(filePath, &file))
+		return(false);
+	uint64_t size = fplFileGetSizeFromHandle64(&file);
+	char *data = new char[(size_t)size + 1];
+	size_t read = fplFileReadBlock(&file, (size_t)size, data, (size_t)size);
+	fplFileClose(&file);
+	if(read != (size_t)size) {
+		delete[] data;
+		return(false);
+	}
+	data[size] = 0;
+
+	fplFileTimeStamps stamps = {};
+	fplFileGetTimestampsFromPath(filePath, &stamps);
+
+	AssetData &asset = *outAsset;
+	asset = {};
+	asset.data = data;
+	asset.size = (size_t)size;
+	asset.modifyTime = stamps.lastModifyTime;
+	asset.ownedData = data;
+	asset.isLoose = true;
+	return(true);
+}
+
+struct AssetPackWriteEntry {
+	std::string name;
+	AssetData asset;
+	uint64_t hash;
+	uint64_t dataOffset;
+	uint32_t nameOffset;
+};
+
+bool CAssetPack::Write(const std::string &filePath, const std::string &rootPath, const std::vector<std::string> &files) {
+	std::vector<AssetPackWriteEntry> entries;
+	entries.reserve(files.size());
+	bool result = true;
+	for(size_t i = 0; i < files.size(); ++i) {
+		AssetPackWriteEntry entry = {};
+		entry.name = ToForwardSlashes(files[i]);
+		entry.hash = HashEntryName(entry.name.c_str(), entry.name.size());
+		bool isDuplicate = false;
+		for(size_t j = 0; j < entries.size() && !isDuplicate; ++j)
+			isDuplicate = entries[j].hash == entry.hash && entries[j].name.size() == entry.name.size() && EqualsIgnoreCase(entries[j].name.c_str(), entry.name.c_str(), entry.name.size());
+		if(isDuplicate)
+			continue;
+		std::string sourcePath = COSLowLevel::pathCombine(rootPath, files[i]);
+		if(!ReadLooseFile(sourcePath.c_str(), &entry.asset)) {
+			fplConsoleFormatError("Failed reading asset file '%s'!\n", sourcePath.c_str());
+			result = false;
+			break;
+		}
+		entries.push_back(entry);
+	}
+
+	if(result) {
+		uint32_t slotCount = 16;
+		while(slotCount < entries.size() * 2)
+			slotCount *= 2;
+
+		// Layout: Header, slots, names and the 16 byte aligned data, every data block is followed by a zero terminator
+		Header fileHeader = {};
+		fileHeader.magic = AssetPackFileMagic;
+		fileHeader.version = AssetPackFileVersion;
+		fileHeader.entryCount = (uint32_t)entries.size();
+		fileHeader.slotCount = slotCount;
+		fileHeader.slotsOffset = sizeof(Header);
+		fileHeader.namesOffset = fileHeader.slotsOffset + sizeof(Slot) * slotCount;
+		std::string allNames;
+		for(size_t i = 0; i < entries.size(); ++i) {
+			entries[i].nameOffset = (uint32_t)allNames.size();
+			allNames += entries[i].name;
+		}
+		fileHeader.namesSize = allNames.size();
+		uint64_t offset = fileHeader.namesOffset + fileHeader.namesSize;
+		for(size_t i = 0; i < entries.size(); ++i) {
+			offset = (offset + AssetPackDataAlignment - 1) & ~(AssetPackDataAlignment - 1);
+			entries[i].dataOffset = offset;
+			offset += entries[i].asset.size + 1;
+		}
+
+		std::vector<Slot> fileSlots(slotCount);
+		memset(&fileSlots[0], 0, sizeof(Slot) * slotCount);
+		for(size_t i = 0; i < entries.size(); ++i) {
+			const AssetPackWriteEntry &entry = entries[i];
+			uint32_t slotIndex = (uint32_t)(entry.hash & (slotCount - 1));
+			while(fileSlots[slotIndex].hash != 0)
+				slotIndex = (slotIndex + 1) & (slotCount - 1);
+			Slot &slot = fileSlots[slotIndex];
+			slot.hash = entry.hash;
+			slot.dataOffset = entry.dataOffset;
+			slot.dataSize = entry.asset.size;
+			slot.modifyTime = entry.asset.modifyTime;
+			slot.nameOffset = entry.nameOffset;
+			slot.nameLength = (uint32_t)entry.name.size();
+		}
+
+		fplFileHandle file;
+		if(fplFileCreateBinary(filePath.c_str(), &file)) {
+			const uint8_t zeros[AssetPackDataAlignment] = {};
+			fplFileWriteBlock(&file, &fileHeader, sizeof(fileHeader));
+			fplFileWriteBlock(&file, &fileSlots[0], sizeof(Slot) * slotCount);
+			if(!allNames.empty())
+				fplFileWriteBlock(&file, allNames.c_str(), allNames.size());
+			uint64_t written = fileHeader.namesOffset + fileHeader.namesSize;
+			for(size_t i = 0; i < entries.size(); ++i) {
+				const AssetPackWriteEntry &entry = entries[i];
+				if(entry.dataOffset > written)
+					fplFileWriteBlock(&file, zeros, (size_t)(entry.dataOffset - written));
+				fplFileWriteBlock(&file, entry.asset.data, entry.asset.size + 1);
+				written = entry.dataOffset + entry.asset.size + 1;
+			}
+			fplFileClose(&file);
+		} else {
+			fplConsoleFormatError("Failed creating asset pack '%s'!\n", filePath.c_str());
+			result = false;
+		}
+	}
+
+	for(size_t i = 0; i < entries.size(); ++i)
+		entries[i].asset.Release();
+	return(result);
+}
+
+namespace Assets {
+	void SetPack(const CAssetPack *pack) {
+		gActiveAssetPack = pack;
+	}
+
+	bool Exists(const char *path) {
+		if(fplFileExists(path))
+			return(true);
+		AssetData asset;
+		return(gActiveAssetPack != nullptr && gActiveAssetPack->Find(path, &asset));
+	}
+
+	bool Load(const char *path, AssetData *outAsset) {
+		if(fplFileExists(path))
+			return ReadLooseFile(path, outAsset);
+		if(gActiveAssetPack != nullptr)
+			return gActiveAssetPack->Find(path, outAsset);
+		return(false);
+	}
+
+	bool GetInfo(const char *path, uint64_t *outSize, uint64_t *outModifyTime) {
+		fplFileTimeStamps stamps = {};
+		if(fplFileGetTimestampsFromPath(path, &stamps) && fplFileTryGetSizeFromPath(path, outSize)) {
+			*outModifyTime = stamps.lastModifyTime;
+			return(true);
+		}
+		AssetData asset;
+		if(gActiveAssetPack != nullptr && gActiveAssetPack->Find(path, &asset)) {
+			*outSize = asset.size;
+			*outModifyTime = asset.modifyTime;
+			return(true);
+		}
+		return(false);
+	}
+
+	std::vector<std::string> GetFilesInDirectory(const std::string &folderPath, const std::string &filter) {
+		std::vector<std::string> result = COSLowLevel::getFilesInDirectory(folderPath, filter);
+		if(gActiveAssetPack != nullptr) {
+			std::vector<std::string> packNames;
+			gActiveAssetPack->GetFilesInDirectory(folderPath, filter, packNames);
+			for(size_t i = 0; i < packNames.size(); ++i) {
+				const std::string &name = packNames[i];
+				bool isLoose = false;
+				for(size_t j = 0; j < result.size() && !isLoose; ++j)
+					isLoose = result[j].size() == name.size() && EqualsIgnoreCase(result[j].c_str(), name.c_str(), name.size());
+				if(!isLoose)
+					result.push_back(name);
+			}
+		}
+		return(result);
+	}
+};
@@ -0,0 +1,70 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - AssetPack.h
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "OSLowLevel.h"
+
+// Read-only view of a asset, the data is always zero terminated (not included in the size), so text assets can be used as c-string directly.
+// Pack entries points directly into the mapped pack, only loose files are read into memory.
+struct AssetData {
+	const char *data;
+	size_t size;
+	uint64_t modifyTime;
+	char *ownedData;
+	bool isLoose;
+
+	void Release();
+};
+
+// Single file which contains all assets (shaders, textures, scenarios, scene) with a hashed index, mapped into memory as a whole.
+// Entry names are relative to the root path with forward slashes and are looked up case-insensitive.
+class CAssetPack {
+private:
+	struct Header;
+	struct Slot;
+
+	COSLowLevel::MappedFile mapping;
+	std::string rootPath;
+	const Header *header;
+	const Slot *slots;
+	const char *names;
+
+	std::string GetEntryName(const char *path) const;
+	const Slot *FindSlot(const std::string &name) const;
+public:
+	CAssetPack();
+	~CAssetPack();
+
+	// Paths inside the root path are stored relative to it, so absolute and relative paths finds the same entry
+	bool Open(const std::string &filePath, const std::string &rootPath);
+	void Close();
+	inline bool IsOpen() const { return header != nullptr; }
+
+	bool Find(const char *path, AssetData *outAsset) const;
+	// Appends the names of all entries directly in the folder, the filter is either "*" or "*.<extension>"
+	void GetFilesInDirectory(const std::string &folderPath, const std::string &filter, std::vector<std::string> &outNames) const;
+
+	// Writes all files into a new pack, the files are given relative to the root path
+	static bool Write(const std::string &filePath, const std::string &rootPath, const std::vector<std::string> &files);
+};
+
+// Global asset loading API, can be called from any thread and does not require a pack.
+// Loose files always wins over pack entries, so edited files on disk are picked up during development.
+namespace Assets {
+	void SetPack(const CAssetPack *pack);
+	bool Exists(const char *path);
+	bool Load(const char *path, AssetData *outAsset);
+	bool GetInfo(const char *path, uint64_t *outSize, uint64_t *outModifyTime);
+	std::vector<std::string> GetFilesInDirectory(const std::string &folderPath, const std::string &filter);
+};
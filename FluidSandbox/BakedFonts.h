@@ -0,0 +1,3352 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - BakedFonts.h
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+// NOTE(final): Generated by "FluidSandbox -bake-fonts <path to BakedFonts.h>". Do not modify by hand!
+
+#pragma once
+
+#include "FontAtlas.h"
+
+static const float bakedFontGlyphs0[] = {
+	0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.416666687f,
+	0.421875f,0.271484375f,0.400390625f,0.271484375f,0.400390625f,0.32421875f,0.421875f,0.32421875f,0.25f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.25f,0.15625f,0.157499999f,
+	0.66015625f,0.48828125f,0.6328125f,0.48828125f,0.6328125f,0.515625f,0.66015625f,0.515625f,0.34375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,-0.25f,0.34375f,-0.25f,0.221666679f,
+	0.68359375f,0.328125f,0.630859375f,0.328125f,0.630859375f,0.37890625f,0.68359375f,0.37890625f,0.75f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.75f,0.125f,0.637499988f,
+	0.08203125f,0.2109375f,0.041015625f,0.2109375f,0.041015625f,0.26953125f,0.08203125f,0.26953125f,0.5625f,-0.75f,-0.09375f,-0.75f,-0.09375f,0.1875f,0.5625f,0.1875f,0.458333343f,
+	0.107421875f,0.328125f,0.0546875f,0.328125f,0.0546875f,0.380859375f,0.107421875f,0.380859375f,0.75f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.75f,0.15625f,0.636666656f,
+	0.732421875f,0.271484375f,0.69140625f,0.271484375f,0.69140625f,0.32421875f,0.732421875f,0.32421875f,0.5625f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.5625f,0.15625f,0.458333343f,
+	0.681640625f,0.48828125f,0.662109375f,0.48828125f,0.662109375f,0.515625f,0.681640625f,0.515625f,0.21875f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,-0.25f,0.21875f,-0.25f,0.124166667f,
+	0.162109375f,0.2109375f,0.138671875f,0.2109375f,0.138671875f,0.26953125f,0.162109375f,0.26953125f,0.28125f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.25f,0.28125f,0.25f,0.157499999f,
+	0.13671875f,0.2109375f,0.11328125f,0.2109375f,0.11328125f,0.26953125f,0.13671875f,0.26953125f,0.28125f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.25f,0.28125f,0.25f,0.157499999f,
+	0.447265625f,0.48828125f,0.412109375f,0.48828125f,0.412109375f,0.5234375f,0.447265625f,0.5234375f,0.46875f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,-0.125f,0.46875f,-0.125f,0.36833334f,
+	0.1328125f,0.48828125f,0.091796875f,0.48828125f,0.091796875f,0.529296875f,0.1328125f,0.529296875f,0.5625f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.09375f,0.5625f,0.09375f,0.458333343f,
+	0.70703125f,0.48828125f,0.68359375f,0.48828125f,0.68359375f,0.515625f,0.70703125f,0.515625f,0.28125f,-0.21875f,-0.09375f,-0.21875f,-0.09375f,0.21875f,0.28125f,0.21875f,0.18416667f,
+	0.86328125f,0.48828125f,0.828125f,0.48828125f,0.828125f,0.509765625f,0.86328125f,0.509765625f,0.46875f,-0.40625f,-0.09375f,-0.40625f,-0.09375f,-0.0625f,0.46875f,-0.0625f,0.360000014f,
+	0.826171875f,0.48828125f,0.8046875f,0.48828125f,0.8046875f,0.51171875f,0.826171875f,0.51171875f,0.21875f,-0.21875f,-0.125f,-0.21875f,-0.125f,0.15625f,0.21875f,0.15625f,0.132500008f,
+	0.5390625f,0.328125f,0.5f,0.328125f,0.5f,0.37890625f,0.5390625f,0.37890625f,0.53125f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.53125f,0.125f,0.429166675f,
+	0.1640625f,0.271484375f,0.125f,0.271484375f,0.125f,0.32421875f,0.1640625f,0.32421875f,0.53125f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.53125f,0.15625f,0.420000017f,
+	0.876953125f,0.328125f,0.849609375f,0.328125f,0.849609375f,0.37890625f,0.876953125f,0.37890625f,0.34375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.34375f,0.125f,0.254166663f,
+	0.802734375f,0.328125f,0.765625f,0.328125f,0.765625f,0.37890625f,0.802734375f,0.37890625f,0.46875f,-0.6875f,-0.125f,-0.6875f,-0.125f,0.125f,0.46875f,0.125f,0.372500002f,
+	0.763671875f,0.328125f,0.73046875f,0.328125f,0.73046875f,0.37890625f,0.763671875f,0.37890625f,0.4375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.4375f,0.125f,0.344166666f,
+	0.2578125f,0.271484375f,0.21875f,0.271484375f,0.21875f,0.32421875f,0.2578125f,0.32421875f,0.53125f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.53125f,0.15625f,0.420000017f,
+	0.498046875f,0.328125f,0.4609375f,0.328125f,0.4609375f,0.37890625f,0.498046875f,0.37890625f,0.5f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.5f,0.125f,0.387500018f,
+	0.552734375f,0.271484375f,0.515625f,0.271484375f,0.515625f,0.32421875f,0.552734375f,0.32421875f,0.5f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.5f,0.15625f,0.403333336f,
+	0.369140625f,0.328125f,0.333984375f,0.328125f,0.333984375f,0.37890625f,0.369140625f,0.37890625f,0.46875f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.46875f,0.125f,0.356666684f,
+	0.6484375f,0.271484375f,0.607421875f,0.271484375f,0.607421875f,0.32421875f,0.6484375f,0.32421875f,0.53125f,-0.6875f,-0.125f,-0.6875f,-0.125f,0.15625f,0.53125f,0.15625f,0.399166673f,
+	0.29296875f,0.328125f,0.255859375f,0.328125f,0.255859375f,0.37890625f,0.29296875f,0.37890625f,0.5f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.5f,0.125f,0.403333336f,
+	0.19921875f,0.48828125f,0.177734375f,0.48828125f,0.177734375f,0.529296875f,0.19921875f,0.529296875f,0.21875f,-0.5f,-0.125f,-0.5f,-0.125f,0.15625f,0.21875f,0.15625f,0.157499999f,
+	0.537109375f,0.435546875f,0.51171875f,0.435546875f,0.51171875f,0.48046875f,0.537109375f,0.48046875f,0.28125f,-0.5f,-0.125f,-0.5f,-0.125f,0.21875f,0.28125f,0.21875f,0.18416667f,
+	0.509765625f,0.435546875f,0.462890625f,0.435546875f,0.462890625f,0.48046875f,0.509765625f,0.48046875f,0.65625f,-0.59375f,-0.09375f,-0.59375f,-0.09375f,0.125f,0.65625f,0.125f,0.556666672f,
+	0.603515625f,0.48828125f,0.5625f,0.48828125f,0.5625f,0.517578125f,0.603515625f,0.517578125f,0.5625f,-0.46875f,-0.09375f,-0.46875f,-0.09375f,0.0f,0.5625f,0.0f,0.458333343f,
+	0.3828125f,0.435546875f,0.3359375f,0.435546875f,0.3359375f,0.48046875f,0.3828125f,0.48046875f,0.65625f,-0.59375f,-0.09375f,-0.59375f,-0.09375f,0.125f,0.65625f,0.125f,0.556666672f,
+	0.689453125f,0.271484375f,0.650390625f,0.271484375f,0.650390625f,0.32421875f,0.689453125f,0.32421875f,0.53125f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,0.125f,0.53125f,0.125f,0.424166679f,
+	0.60546875f,0.271484375f,0.5546875f,0.271484375f,0.5546875f,0.32421875f,0.60546875f,0.32421875f,0.71875f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.71875f,0.15625f,0.625f,
+	0.947265625f,0.3828125f,0.90234375f,0.3828125f,0.90234375f,0.43359375f,0.947265625f,0.43359375f,0.625f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.625f,0.125f,0.526666701f,
+	0.185546875f,0.435546875f,0.146484375f,0.435546875f,0.146484375f,0.486328125f,0.185546875f,0.486328125f,0.53125f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.53125f,0.125f,0.410833329f,
+	0.306640625f,0.271484375f,0.259765625f,0.271484375f,0.259765625f,0.32421875f,0.306640625f,0.32421875f,0.65625f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.65625f,0.15625f,0.55916667f,
+	0.08984375f,0.3828125f,0.046875f,0.3828125f,0.046875f,0.43359375f,0.08984375f,0.43359375f,0.59375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.59375f,0.125f,0.492500007f,
+	0.12890625f,0.3828125f,0.091796875f,0.3828125f,0.091796875f,0.43359375f,0.12890625f,0.43359375f,0.5f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.5f,0.125f,0.386666685f,
+	0.44921875f,0.3828125f,0.412109375f,0.3828125f,0.412109375f,0.43359375f,0.44921875f,0.43359375f,0.5f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.5f,0.125f,0.37833333f,
+	0.5546875f,0.2109375f,0.50390625f,0.2109375f,0.50390625f,0.265625f,0.5546875f,0.265625f,0.6875f,-0.6875f,-0.125f,-0.6875f,-0.125f,0.1875f,0.6875f,0.1875f,0.577499986f,
+	0.171875f,0.3828125f,0.130859375f,0.3828125f,0.130859375f,0.43359375f,0.171875f,0.43359375f,0.5625f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.5625f,0.125f,0.454166681f,
+	0.255859375f,0.3828125f,0.234375f,0.3828125f,0.234375f,0.43359375f,0.255859375f,0.43359375f,0.25f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.25f,0.125f,0.140000001f,
+	0.283203125f,0.3828125f,0.2578125f,0.3828125f,0.2578125f,0.43359375f,0.283203125f,0.43359375f,0.3125f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.3125f,0.125f,0.227500007f,
+	0.32421875f,0.3828125f,0.28515625f,0.3828125f,0.28515625f,0.43359375f,0.32421875f,0.43359375f,0.53125f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.53125f,0.125f,0.410833329f,
+	0.357421875f,0.3828125f,0.326171875f,0.3828125f,0.326171875f,0.43359375f,0.357421875f,0.43359375f,0.40625f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.40625f,0.125f,0.313333333f,
+	0.41015625f,0.3828125f,0.359375f,0.3828125f,0.359375f,0.43359375f,0.41015625f,0.43359375f,0.71875f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.71875f,0.125f,0.619166672f,
+	0.044921875f,0.3828125f,0.001953125f,0.3828125f,0.001953125f,0.43359375f,0.044921875f,0.43359375f,0.59375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.59375f,0.125f,0.487500012f,
+	0.052734375f,0.328125f,0.001953125f,0.328125f,0.001953125f,0.380859375f,0.052734375f,0.380859375f,0.71875f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.71875f,0.15625f,0.622500002f,
+	0.48828125f,0.3828125f,0.451171875f,0.3828125f,0.451171875f,0.43359375f,0.48828125f,0.43359375f,0.5f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.5f,0.125f,0.408333331f,
+	0.541015625f,0.3828125f,0.490234375f,0.3828125f,0.490234375f,0.43359375f,0.541015625f,0.43359375f,0.71875f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.71875f,0.125f,0.622500002f,
+	0.580078125f,0.3828125f,0.54296875f,0.3828125f,0.54296875f,0.43359375f,0.580078125f,0.43359375f,0.5f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.5f,0.125f,0.393333346f,
+	0.150390625f,0.328125f,0.109375f,0.328125f,0.109375f,0.380859375f,0.150390625f,0.380859375f,0.5625f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.5625f,0.15625f,0.446666688f,
+	0.619140625f,0.3828125f,0.58203125f,0.3828125f,0.58203125f,0.43359375f,0.619140625f,0.43359375f,0.5f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.5f,0.125f,0.408333331f,
+	0.98046875f,0.271484375f,0.939453125f,0.271484375f,0.939453125f,0.32421875f,0.98046875f,0.32421875f,0.5625f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.5625f,0.15625f,0.469999999f,
+	0.666015625f,0.3828125f,0.62109375f,0.3828125f,0.62109375f,0.43359375f,0.666015625f,0.43359375f,0.625f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.625f,0.125f,0.525833368f,
+	0.728515625f,0.3828125f,0.66796875f,0.3828125f,0.66796875f,0.43359375f,0.728515625f,0.43359375f,0.875f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.875f,0.125f,0.771666706f,
+	0.7734375f,0.3828125f,0.73046875f,0.3828125f,0.73046875f,0.43359375f,0.7734375f,0.43359375f,0.59375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.59375f,0.125f,0.475000024f,
+	0.81640625f,0.3828125f,0.775390625f,0.3828125f,0.775390625f,0.43359375f,0.81640625f,0.43359375f,0.5625f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.5625f,0.125f,0.466666669f,
+	0.859375f,0.3828125f,0.818359375f,0.3828125f,0.818359375f,0.43359375f,0.859375f,0.43359375f,0.5625f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.5625f,0.125f,0.443333358f,
+	0.19140625f,0.2109375f,0.1640625f,0.2109375f,0.1640625f,0.26953125f,0.19140625f,0.26953125f,0.34375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.25f,0.34375f,0.25f,0.240833342f,
+	0.900390625f,0.3828125f,0.861328125f,0.3828125f,0.861328125f,0.43359375f,0.900390625f,0.43359375f,0.53125f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.53125f,0.125f,0.429166675f,
+	0.111328125f,0.2109375f,0.083984375f,0.2109375f,0.083984375f,0.26953125f,0.111328125f,0.26953125f,0.34375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.25f,0.34375f,0.25f,0.240833342f,
+	0.482421875f,0.48828125f,0.44921875f,0.48828125f,0.44921875f,0.521484375f,0.482421875f,0.521484375f,0.4375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,-0.15625f,0.4375f,-0.15625f,0.324166685f,
+	0.9609375f,0.48828125f,0.921875f,0.48828125f,0.921875f,0.5078125f,0.9609375f,0.5078125f,0.53125f,-0.09375f,-0.09375f,-0.09375f,-0.09375f,0.21875f,0.53125f,0.21875f,0.430000007f,
+	0.77734375f,0.48828125f,0.75390625f,0.48828125f,0.75390625f,0.513671875f,0.77734375f,0.513671875f,0.25f,-0.71875f,-0.125f,-0.71875f,-0.125f,-0.3125f,0.25f,-0.3125f,0.5f,
+	0.650390625f,0.435546875f,0.607421875f,0.435546875f,0.607421875f,0.48046875f,0.650390625f,0.48046875f,0.59375f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.15625f,0.59375f,0.15625f,0.495833337f,
+	0.9375f,0.271484375f,0.89453125f,0.271484375f,0.89453125f,0.32421875f,0.9375f,0.32421875f,0.59375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.59375f,0.15625f,0.497500002f,
+	0.69140625f,0.435546875f,0.65234375f,0.435546875f,0.65234375f,0.48046875f,0.69140625f,0.48046875f,0.53125f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.15625f,0.53125f,0.15625f,0.436666667f,
+	0.77734375f,0.271484375f,0.734375f,0.271484375f,0.734375f,0.32421875f,0.77734375f,0.32421875f,0.59375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.59375f,0.15625f,0.497500002f,
+	0.333984375f,0.435546875f,0.291015625f,0.435546875f,0.291015625f,0.48046875f,0.333984375f,0.48046875f,0.59375f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.15625f,0.59375f,0.15625f,0.486666679f,
+	0.21484375f,0.328125f,0.185546875f,0.328125f,0.185546875f,0.37890625f,0.21484375f,0.37890625f,0.375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.375f,0.125f,0.262500018f,
+	0.123046875f,0.271484375f,0.080078125f,0.271484375f,0.080078125f,0.326171875f,0.123046875f,0.326171875f,0.59375f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.3125f,0.59375f,0.3125f,0.495000005f,
+	0.986328125f,0.3828125f,0.94921875f,0.3828125f,0.94921875f,0.43359375f,0.986328125f,0.43359375f,0.5f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.5f,0.125f,0.414166689f,
+	0.078125f,0.435546875f,0.056640625f,0.435546875f,0.056640625f,0.486328125f,0.078125f,0.486328125f,0.25f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.25f,0.125f,0.174166664f,
+	0.9296875f,0.07421875f,0.90234375f,0.07421875f,0.90234375f,0.13671875f,0.9296875f,0.13671875f,0.3125f,-0.6875f,-0.125f,-0.6875f,-0.125f,0.3125f,0.3125f,0.3125f,0.203333333f,
+	0.208984375f,0.3828125f,0.173828125f,0.3828125f,0.173828125f,0.43359375f,0.208984375f,0.43359375f,0.46875f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.46875f,0.125f,0.360000014f,
+	0.232421875f,0.3828125f,0.2109375f,0.3828125f,0.2109375f,0.43359375f,0.232421875f,0.43359375f,0.25f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.25f,0.125f,0.140000001f,
+	0.08984375f,0.48828125f,0.037109375f,0.48828125f,0.037109375f,0.53125f,0.08984375f,0.53125f,0.75f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.125f,0.75f,0.125f,0.637499988f,
+	0.919921875f,0.435546875f,0.8828125f,0.435546875f,0.8828125f,0.478515625f,0.919921875f,0.478515625f,0.5f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.125f,0.5f,0.125f,0.405833334f,
+	0.736328125f,0.435546875f,0.693359375f,0.435546875f,0.693359375f,0.48046875f,0.736328125f,0.48046875f,0.59375f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.15625f,0.59375f,0.15625f,0.49000001f,
+	0.916015625f,0.2109375f,0.873046875f,0.2109375f,0.873046875f,0.265625f,0.916015625f,0.265625f,0.59375f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.3125f,0.59375f,0.3125f,0.495833337f,
+	0.87109375f,0.2109375f,0.828125f,0.2109375f,0.828125f,0.265625f,0.87109375f,0.265625f,0.59375f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.3125f,0.59375f,0.3125f,0.495833337f,
+	0.03515625f,0.48828125f,0.001953125f,0.48828125f,0.001953125f,0.53125f,0.03515625f,0.53125f,0.4375f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.125f,0.4375f,0.125f,0.32250002f,
+	0.421875f,0.435546875f,0.384765625f,0.435546875f,0.384765625f,0.48046875f,0.421875f,0.48046875f,0.46875f,-0.5625f,-0.125f,-0.5625f,-0.125f,0.15625f,0.46875f,0.15625f,0.359166682f,
+	0.03125f,0.435546875f,0.001953125f,0.435546875f,0.001953125f,0.486328125f,0.03125f,0.486328125f,0.375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.375f,0.125f,0.262500018f,
+	0.4609375f,0.435546875f,0.423828125f,0.435546875f,0.423828125f,0.48046875f,0.4609375f,0.48046875f,0.5f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.15625f,0.5f,0.15625f,0.414166689f,
+	0.880859375f,0.435546875f,0.83984375f,0.435546875f,0.83984375f,0.478515625f,0.880859375f,0.478515625f,0.5625f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.125f,0.5625f,0.125f,0.455833346f,
+	0.837890625f,0.435546875f,0.783203125f,0.435546875f,0.783203125f,0.478515625f,0.837890625f,0.478515625f,0.78125f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.125f,0.78125f,0.125f,0.688333333f,
+	0.958984375f,0.435546875f,0.921875f,0.435546875f,0.921875f,0.478515625f,0.958984375f,0.478515625f,0.5f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.125f,0.5f,0.125f,0.391666681f,
+	0.666015625f,0.2109375f,0.626953125f,0.2109375f,0.626953125f,0.265625f,0.666015625f,0.265625f,0.53125f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.3125f,0.53125f,0.3125f,0.436666667f,
+	0.998046875f,0.435546875f,0.9609375f,0.435546875f,0.9609375f,0.478515625f,0.998046875f,0.478515625f,0.5f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.125f,0.5f,0.125f,0.404166669f,
+	0.837890625f,0.146484375f,0.80859375f,0.146484375f,0.80859375f,0.205078125f,0.837890625f,0.205078125f,0.375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.25f,0.375f,0.25f,0.272500008f,
+	0.0546875f,0.435546875f,0.033203125f,0.435546875f,0.033203125f,0.486328125f,0.0546875f,0.486328125f,0.25f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.25f,0.125f,0.143333331f,
+	0.99609375f,0.146484375f,0.966796875f,0.146484375f,0.966796875f,0.205078125f,0.99609375f,0.205078125f,0.375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.25f,0.375f,0.25f,0.272500008f,
+	0.751953125f,0.48828125f,0.708984375f,0.48828125f,0.708984375f,0.513671875f,0.751953125f,0.513671875f,0.59375f,-0.5f,-0.09375f,-0.5f,-0.09375f,-0.09375f,0.59375f,-0.09375f,0.490833342f,
+	0.037109375f,0.07421875f,0.001953125f,0.07421875f,0.001953125f,0.14453125f,0.037109375f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.07421875f,0.07421875f,0.0390625f,0.07421875f,0.0390625f,0.14453125f,0.07421875f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.111328125f,0.07421875f,0.076171875f,0.07421875f,0.076171875f,0.14453125f,0.111328125f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.1484375f,0.07421875f,0.11328125f,0.07421875f,0.11328125f,0.14453125f,0.1484375f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.185546875f,0.07421875f,0.150390625f,0.07421875f,0.150390625f,0.14453125f,0.185546875f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.22265625f,0.07421875f,0.1875f,0.07421875f,0.1875f,0.14453125f,0.22265625f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.259765625f,0.07421875f,0.224609375f,0.07421875f,0.224609375f,0.14453125f,0.259765625f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.96484375f,0.001953125f,0.9296875f,0.001953125f,0.9296875f,0.072265625f,0.96484375f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.296875f,0.07421875f,0.26171875f,0.07421875f,0.26171875f,0.14453125f,0.296875f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.333984375f,0.07421875f,0.298828125f,0.07421875f,0.298828125f,0.14453125f,0.333984375f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.37109375f,0.07421875f,0.3359375f,0.07421875f,0.3359375f,0.14453125f,0.37109375f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.408203125f,0.07421875f,0.373046875f,0.07421875f,0.373046875f,0.14453125f,0.408203125f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.4453125f,0.07421875f,0.41015625f,0.07421875f,0.41015625f,0.14453125f,0.4453125f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.482421875f,0.07421875f,0.447265625f,0.07421875f,0.447265625f,0.14453125f,0.482421875f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.51953125f,0.07421875f,0.484375f,0.07421875f,0.484375f,0.14453125f,0.51953125f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.556640625f,0.07421875f,0.521484375f,0.07421875f,0.521484375f,0.14453125f,0.556640625f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.59375f,0.07421875f,0.55859375f,0.07421875f,0.55859375f,0.14453125f,0.59375f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.630859375f,0.07421875f,0.595703125f,0.07421875f,0.595703125f,0.14453125f,0.630859375f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.927734375f,0.001953125f,0.892578125f,0.001953125f,0.892578125f,0.072265625f,0.927734375f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.890625f,0.001953125f,0.85546875f,0.001953125f,0.85546875f,0.072265625f,0.890625f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.853515625f,0.001953125f,0.818359375f,0.001953125f,0.818359375f,0.072265625f,0.853515625f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.81640625f,0.001953125f,0.78125f,0.001953125f,0.78125f,0.072265625f,0.81640625f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.779296875f,0.001953125f,0.744140625f,0.001953125f,0.744140625f,0.072265625f,0.779296875f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.7421875f,0.001953125f,0.70703125f,0.001953125f,0.70703125f,0.072265625f,0.7421875f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.705078125f,0.001953125f,0.669921875f,0.001953125f,0.669921875f,0.072265625f,0.705078125f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.66796875f,0.001953125f,0.6328125f,0.001953125f,0.6328125f,0.072265625f,0.66796875f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.630859375f,0.001953125f,0.595703125f,0.001953125f,0.595703125f,0.072265625f,0.630859375f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.59375f,0.001953125f,0.55859375f,0.001953125f,0.55859375f,0.072265625f,0.59375f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.556640625f,0.001953125f,0.521484375f,0.001953125f,0.521484375f,0.072265625f,0.556640625f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.037109375f,0.001953125f,0.001953125f,0.001953125f,0.001953125f,0.072265625f,0.037109375f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.482421875f,0.001953125f,0.447265625f,0.001953125f,0.447265625f,0.072265625f,0.482421875f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.4453125f,0.001953125f,0.41015625f,0.001953125f,0.41015625f,0.072265625f,0.4453125f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.408203125f,0.001953125f,0.373046875f,0.001953125f,0.373046875f,0.072265625f,0.408203125f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.37109375f,0.001953125f,0.3359375f,0.001953125f,0.3359375f,0.072265625f,0.37109375f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.208984375f,0.435546875f,0.1875f,0.435546875f,0.1875f,0.486328125f,0.208984375f,0.486328125f,0.25f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.25f,0.125f,0.157499999f,
+	0.25f,0.435546875f,0.2109375f,0.435546875f,0.2109375f,0.484375f,0.25f,0.484375f,0.53125f,-0.65625f,-0.09375f,-0.65625f,-0.09375f,0.125f,0.53125f,0.125f,0.4375f,
+	0.3984375f,0.271484375f,0.365234375f,0.271484375f,0.365234375f,0.32421875f,0.3984375f,0.32421875f,0.4375f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,0.125f,0.4375f,0.125f,0.331666678f,
+	0.78125f,0.435546875f,0.73828125f,0.435546875f,0.73828125f,0.48046875f,0.78125f,0.48046875f,0.59375f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.15625f,0.59375f,0.15625f,0.488333344f,
+	0.14453125f,0.435546875f,0.103515625f,0.435546875f,0.103515625f,0.486328125f,0.14453125f,0.486328125f,0.5625f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.5625f,0.125f,0.469166666f,
+	0.1015625f,0.435546875f,0.080078125f,0.435546875f,0.080078125f,0.486328125f,0.1015625f,0.486328125f,0.25f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.25f,0.125f,0.143333331f,
+	0.4609375f,0.271484375f,0.423828125f,0.271484375f,0.423828125f,0.32421875f,0.4609375f,0.32421875f,0.46875f,-0.6875f,-0.125f,-0.6875f,-0.125f,0.15625f,0.46875f,0.15625f,0.358333349f,
+	0.896484375f,0.48828125f,0.865234375f,0.48828125f,0.865234375f,0.509765625f,0.896484375f,0.509765625f,0.375f,-0.65625f,-0.125f,-0.65625f,-0.125f,-0.3125f,0.375f,-0.3125f,0.5f,
+	0.513671875f,0.271484375f,0.462890625f,0.271484375f,0.462890625f,0.32421875f,0.513671875f,0.32421875f,0.71875f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.71875f,0.15625f,0.625f,
+	0.333984375f,0.001953125f,0.298828125f,0.001953125f,0.298828125f,0.072265625f,0.333984375f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.3671875f,0.48828125f,0.326171875f,0.48828125f,0.326171875f,0.525390625f,0.3671875f,0.525390625f,0.5625f,-0.53125f,-0.09375f,-0.53125f,-0.09375f,0.0625f,0.5625f,0.0625f,0.469999999f,
+	0.560546875f,0.48828125f,0.517578125f,0.48828125f,0.517578125f,0.517578125f,0.560546875f,0.517578125f,0.59375f,-0.40625f,-0.09375f,-0.40625f,-0.09375f,0.0625f,0.59375f,0.0625f,0.484166682f,
+	0.296875f,0.001953125f,0.26171875f,0.001953125f,0.26171875f,0.072265625f,0.296875f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.17578125f,0.48828125f,0.134765625f,0.48828125f,0.134765625f,0.529296875f,0.17578125f,0.529296875f,0.5625f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,-0.03125f,0.5625f,-0.03125f,0.448333353f,
+	0.99609375f,0.48828125f,0.962890625f,0.48828125f,0.962890625f,0.5078125f,0.99609375f,0.5078125f,0.40625f,-0.65625f,-0.125f,-0.65625f,-0.125f,-0.34375f,0.40625f,-0.34375f,0.5f,
+	0.515625f,0.48828125f,0.484375f,0.48828125f,0.484375f,0.51953125f,0.515625f,0.51953125f,0.40625f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,-0.21875f,0.40625f,-0.21875f,0.295833349f,
+	0.2421875f,0.48828125f,0.201171875f,0.48828125f,0.201171875f,0.52734375f,0.2421875f,0.52734375f,0.5625f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.0625f,0.5625f,0.0625f,0.458333343f,
+	0.259765625f,0.001953125f,0.224609375f,0.001953125f,0.224609375f,0.072265625f,0.259765625f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.22265625f,0.001953125f,0.1875f,0.001953125f,0.1875f,0.072265625f,0.22265625f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.802734375f,0.48828125f,0.779296875f,0.48828125f,0.779296875f,0.513671875f,0.802734375f,0.513671875f,0.3125f,-0.71875f,-0.0625f,-0.71875f,-0.0625f,-0.3125f,0.3125f,-0.3125f,0.5f,
+	0.185546875f,0.001953125f,0.150390625f,0.001953125f,0.150390625f,0.072265625f,0.185546875f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.25390625f,0.328125f,0.216796875f,0.328125f,0.216796875f,0.37890625f,0.25390625f,0.37890625f,0.5f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.5f,0.125f,0.410833329f,
+	0.919921875f,0.48828125f,0.8984375f,0.48828125f,0.8984375f,0.509765625f,0.919921875f,0.509765625f,0.21875f,-0.4375f,-0.125f,-0.4375f,-0.125f,-0.09375f,0.21875f,-0.09375f,0.157499999f,
+	0.630859375f,0.48828125f,0.60546875f,0.48828125f,0.60546875f,0.517578125f,0.630859375f,0.517578125f,0.3125f,-0.15625f,-0.09375f,-0.15625f,-0.09375f,0.3125f,0.3125f,0.3125f,0.5f,
+	0.1484375f,0.001953125f,0.11328125f,0.001953125f,0.11328125f,0.072265625f,0.1484375f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.111328125f,0.001953125f,0.076171875f,0.001953125f,0.076171875f,0.072265625f,0.111328125f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.41015625f,0.48828125f,0.369140625f,0.48828125f,0.369140625f,0.525390625f,0.41015625f,0.525390625f,0.5625f,-0.53125f,-0.09375f,-0.53125f,-0.09375f,0.0625f,0.5625f,0.0625f,0.469999999f,
+	0.07421875f,0.001953125f,0.0390625f,0.001953125f,0.0390625f,0.072265625f,0.07421875f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.51953125f,0.001953125f,0.484375f,0.001953125f,0.484375f,0.072265625f,0.51953125f,0.072265625f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.66796875f,0.07421875f,0.6328125f,0.07421875f,0.6328125f,0.14453125f,0.66796875f,0.14453125f,0.5f,-0.8125f,-0.0625f,-0.8125f,-0.0625f,0.3125f,0.5f,0.3125f,0.422500014f,
+	0.95703125f,0.2109375f,0.91796875f,0.2109375f,0.91796875f,0.265625f,0.95703125f,0.265625f,0.53125f,-0.59375f,-0.09375f,-0.59375f,-0.09375f,0.28125f,0.53125f,0.28125f,0.424166679f,
+	0.41015625f,0.146484375f,0.365234375f,0.146484375f,0.365234375f,0.208984375f,0.41015625f,0.208984375f,0.625f,-0.875f,-0.09375f,-0.875f,-0.09375f,0.125f,0.625f,0.125f,0.526666701f,
+	0.9765625f,0.07421875f,0.931640625f,0.07421875f,0.931640625f,0.13671875f,0.9765625f,0.13671875f,0.625f,-0.875f,-0.09375f,-0.875f,-0.09375f,0.125f,0.625f,0.125f,0.526666701f,
+	0.6328125f,0.146484375f,0.587890625f,0.146484375f,0.587890625f,0.20703125f,0.6328125f,0.20703125f,0.625f,-0.84375f,-0.09375f,-0.84375f,-0.09375f,0.125f,0.625f,0.125f,0.526666701f,
+	0.931640625f,0.146484375f,0.88671875f,0.146484375f,0.88671875f,0.205078125f,0.931640625f,0.205078125f,0.625f,-0.8125f,-0.09375f,-0.8125f,-0.09375f,0.125f,0.625f,0.125f,0.526666701f,
+	0.884765625f,0.146484375f,0.83984375f,0.146484375f,0.83984375f,0.205078125f,0.884765625f,0.205078125f,0.625f,-0.8125f,-0.09375f,-0.8125f,-0.09375f,0.125f,0.625f,0.125f,0.526666701f,
+	0.36328125f,0.146484375f,0.318359375f,0.146484375f,0.318359375f,0.208984375f,0.36328125f,0.208984375f,0.625f,-0.875f,-0.09375f,-0.875f,-0.09375f,0.125f,0.625f,0.125f,0.526666701f,
+	0.36328125f,0.271484375f,0.30859375f,0.271484375f,0.30859375f,0.32421875f,0.36328125f,0.32421875f,0.78125f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.78125f,0.15625f,0.661666691f,
+	0.31640625f,0.146484375f,0.26953125f,0.146484375f,0.26953125f,0.208984375f,0.31640625f,0.208984375f,0.65625f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.3125f,0.65625f,0.3125f,0.55916667f,
+	0.267578125f,0.146484375f,0.23046875f,0.146484375f,0.23046875f,0.208984375f,0.267578125f,0.208984375f,0.5f,-0.875f,-0.09375f,-0.875f,-0.09375f,0.125f,0.5f,0.125f,0.386666685f,
+	0.228515625f,0.146484375f,0.19140625f,0.146484375f,0.19140625f,0.208984375f,0.228515625f,0.208984375f,0.5f,-0.875f,-0.09375f,-0.875f,-0.09375f,0.125f,0.5f,0.125f,0.386666685f,
+	0.44921875f,0.146484375f,0.412109375f,0.146484375f,0.412109375f,0.20703125f,0.44921875f,0.20703125f,0.5f,-0.84375f,-0.09375f,-0.84375f,-0.09375f,0.125f,0.5f,0.125f,0.386666685f,
+	0.0390625f,0.2109375f,0.001953125f,0.2109375f,0.001953125f,0.26953125f,0.0390625f,0.26953125f,0.5f,-0.8125f,-0.09375f,-0.8125f,-0.09375f,0.125f,0.5f,0.125f,0.386666685f,
+	0.189453125f,0.146484375f,0.166015625f,0.146484375f,0.166015625f,0.208984375f,0.189453125f,0.208984375f,0.28125f,-0.875f,-0.09375f,-0.875f,-0.09375f,0.125f,0.28125f,0.125f,0.174999997f,
+	0.1640625f,0.146484375f,0.140625f,0.146484375f,0.140625f,0.208984375f,0.1640625f,0.208984375f,0.28125f,-0.875f,-0.09375f,-0.875f,-0.09375f,0.125f,0.28125f,0.125f,0.175833344f,
+	0.48046875f,0.146484375f,0.451171875f,0.146484375f,0.451171875f,0.20703125f,0.48046875f,0.20703125f,0.375f,-0.84375f,-0.09375f,-0.84375f,-0.09375f,0.125f,0.375f,0.125f,0.283333331f,
+	0.96484375f,0.146484375f,0.93359375f,0.146484375f,0.93359375f,0.205078125f,0.96484375f,0.205078125f,0.40625f,-0.8125f,-0.09375f,-0.8125f,-0.09375f,0.125f,0.40625f,0.125f,0.289166659f,
+	0.583984375f,0.328125f,0.541015625f,0.328125f,0.541015625f,0.37890625f,0.583984375f,0.37890625f,0.59375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.59375f,0.125f,0.525833368f,
+	0.806640625f,0.146484375f,0.763671875f,0.146484375f,0.763671875f,0.205078125f,0.806640625f,0.205078125f,0.59375f,-0.8125f,-0.09375f,-0.8125f,-0.09375f,0.125f,0.59375f,0.125f,0.487500012f,
+	0.720703125f,0.07421875f,0.669921875f,0.07421875f,0.669921875f,0.138671875f,0.720703125f,0.138671875f,0.71875f,-0.875f,-0.09375f,-0.875f,-0.09375f,0.15625f,0.71875f,0.15625f,0.622500002f,
+	0.7734375f,0.07421875f,0.72265625f,0.07421875f,0.72265625f,0.138671875f,0.7734375f,0.138671875f,0.71875f,-0.875f,-0.09375f,-0.875f,-0.09375f,0.15625f,0.71875f,0.15625f,0.622500002f,
+	0.138671875f,0.146484375f,0.087890625f,0.146484375f,0.087890625f,0.208984375f,0.138671875f,0.208984375f,0.71875f,-0.84375f,-0.09375f,-0.84375f,-0.09375f,0.15625f,0.71875f,0.15625f,0.622500002f,
+	0.533203125f,0.146484375f,0.482421875f,0.146484375f,0.482421875f,0.20703125f,0.533203125f,0.20703125f,0.71875f,-0.8125f,-0.09375f,-0.8125f,-0.09375f,0.15625f,0.71875f,0.15625f,0.622500002f,
+	0.5859375f,0.146484375f,0.53515625f,0.146484375f,0.53515625f,0.20703125f,0.5859375f,0.20703125f,0.71875f,-0.8125f,-0.09375f,-0.8125f,-0.09375f,0.15625f,0.71875f,0.15625f,0.622500002f,
+	0.32421875f,0.48828125f,0.287109375f,0.48828125f,0.287109375f,0.525390625f,0.32421875f,0.525390625f,0.5f,-0.53125f,-0.09375f,-0.53125f,-0.09375f,0.0625f,0.5f,0.0625f,0.384166688f,
+	0.216796875f,0.271484375f,0.166015625f,0.271484375f,0.166015625f,0.32421875f,0.216796875f,0.32421875f,0.71875f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.71875f,0.15625f,0.622500002f,
+	0.81640625f,0.07421875f,0.775390625f,0.07421875f,0.775390625f,0.138671875f,0.81640625f,0.138671875f,0.5625f,-0.875f,-0.09375f,-0.875f,-0.09375f,0.15625f,0.5625f,0.15625f,0.469999999f,
+	0.859375f,0.07421875f,0.818359375f,0.07421875f,0.818359375f,0.138671875f,0.859375f,0.138671875f,0.5625f,-0.875f,-0.09375f,-0.875f,-0.09375f,0.15625f,0.5625f,0.15625f,0.469999999f,
+	0.0859375f,0.146484375f,0.044921875f,0.146484375f,0.044921875f,0.208984375f,0.0859375f,0.208984375f,0.5625f,-0.84375f,-0.09375f,-0.84375f,-0.09375f,0.15625f,0.5625f,0.15625f,0.469999999f,
+	0.67578125f,0.146484375f,0.634765625f,0.146484375f,0.634765625f,0.20703125f,0.67578125f,0.20703125f,0.5625f,-0.8125f,-0.09375f,-0.8125f,-0.09375f,0.15625f,0.5625f,0.15625f,0.469999999f,
+	0.04296875f,0.146484375f,0.001953125f,0.146484375f,0.001953125f,0.208984375f,0.04296875f,0.208984375f,0.5625f,-0.875f,-0.09375f,-0.875f,-0.09375f,0.125f,0.5625f,0.125f,0.466666669f,
+	0.95703125f,0.328125f,0.919921875f,0.328125f,0.919921875f,0.37890625f,0.95703125f,0.37890625f,0.5f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.5f,0.125f,0.408333331f,
+	0.91796875f,0.328125f,0.87890625f,0.328125f,0.87890625f,0.37890625f,0.91796875f,0.37890625f,0.53125f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.53125f,0.125f,0.410833329f,
+	0.501953125f,0.2109375f,0.458984375f,0.2109375f,0.458984375f,0.265625f,0.501953125f,0.265625f,0.59375f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,0.15625f,0.59375f,0.15625f,0.495833337f,
+	0.322265625f,0.2109375f,0.279296875f,0.2109375f,0.279296875f,0.265625f,0.322265625f,0.265625f,0.59375f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,0.15625f,0.59375f,0.15625f,0.495833337f,
+	0.599609375f,0.2109375f,0.556640625f,0.2109375f,0.556640625f,0.265625f,0.599609375f,0.265625f,0.59375f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,0.15625f,0.59375f,0.15625f,0.495833337f,
+	0.84765625f,0.328125f,0.8046875f,0.328125f,0.8046875f,0.37890625f,0.84765625f,0.37890625f,0.59375f,-0.65625f,-0.09375f,-0.65625f,-0.09375f,0.15625f,0.59375f,0.15625f,0.495833337f,
+	0.728515625f,0.328125f,0.685546875f,0.328125f,0.685546875f,0.37890625f,0.728515625f,0.37890625f,0.59375f,-0.65625f,-0.09375f,-0.65625f,-0.09375f,0.15625f,0.59375f,0.15625f,0.495833337f,
+	0.236328125f,0.2109375f,0.193359375f,0.2109375f,0.193359375f,0.267578125f,0.236328125f,0.267578125f,0.59375f,-0.75f,-0.09375f,-0.75f,-0.09375f,0.15625f,0.59375f,0.15625f,0.495833337f,
+	0.60546875f,0.435546875f,0.5390625f,0.435546875f,0.5390625f,0.48046875f,0.60546875f,0.48046875f,0.96875f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.15625f,0.96875f,0.15625f,0.850000024f,
+	0.27734375f,0.2109375f,0.23828125f,0.2109375f,0.23828125f,0.265625f,0.27734375f,0.265625f,0.53125f,-0.5625f,-0.09375f,-0.5625f,-0.09375f,0.3125f,0.53125f,0.3125f,0.436666667f,
+	0.3671875f,0.2109375f,0.32421875f,0.2109375f,0.32421875f,0.265625f,0.3671875f,0.265625f,0.59375f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,0.15625f,0.59375f,0.15625f,0.486666679f,
+	0.412109375f,0.2109375f,0.369140625f,0.2109375f,0.369140625f,0.265625f,0.412109375f,0.265625f,0.59375f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,0.15625f,0.59375f,0.15625f,0.486666679f,
+	0.45703125f,0.2109375f,0.4140625f,0.2109375f,0.4140625f,0.265625f,0.45703125f,0.265625f,0.59375f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,0.15625f,0.59375f,0.15625f,0.486666679f,
+	0.62890625f,0.328125f,0.5859375f,0.328125f,0.5859375f,0.37890625f,0.62890625f,0.37890625f,0.59375f,-0.65625f,-0.09375f,-0.65625f,-0.09375f,0.15625f,0.59375f,0.15625f,0.486666679f,
+	0.625f,0.2109375f,0.6015625f,0.2109375f,0.6015625f,0.265625f,0.625f,0.265625f,0.28125f,-0.75f,-0.09375f,-0.75f,-0.09375f,0.125f,0.28125f,0.125f,0.167500004f,
+	0.69140625f,0.2109375f,0.66796875f,0.2109375f,0.66796875f,0.265625f,0.69140625f,0.265625f,0.28125f,-0.75f,-0.09375f,-0.75f,-0.09375f,0.125f,0.28125f,0.125f,0.171666667f,
+	0.892578125f,0.271484375f,0.86328125f,0.271484375f,0.86328125f,0.32421875f,0.892578125f,0.32421875f,0.375f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,0.125f,0.375f,0.125f,0.283333331f,
+	0.18359375f,0.328125f,0.15234375f,0.328125f,0.15234375f,0.37890625f,0.18359375f,0.37890625f,0.40625f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.125f,0.40625f,0.125f,0.289166659f,
+	0.861328125f,0.271484375f,0.82421875f,0.271484375f,0.82421875f,0.32421875f,0.861328125f,0.32421875f,0.5f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.15625f,0.5f,0.15625f,0.403333336f,
+	0.2890625f,0.435546875f,0.251953125f,0.435546875f,0.251953125f,0.484375f,0.2890625f,0.484375f,0.5f,-0.65625f,-0.09375f,-0.65625f,-0.09375f,0.125f,0.5f,0.125f,0.405833334f,
+	0.736328125f,0.2109375f,0.693359375f,0.2109375f,0.693359375f,0.265625f,0.736328125f,0.265625f,0.59375f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,0.15625f,0.59375f,0.15625f,0.49000001f,
+	0.78125f,0.2109375f,0.73828125f,0.2109375f,0.73828125f,0.265625f,0.78125f,0.265625f,0.59375f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,0.15625f,0.59375f,0.15625f,0.49000001f,
+	0.826171875f,0.2109375f,0.783203125f,0.2109375f,0.783203125f,0.265625f,0.826171875f,0.265625f,0.59375f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,0.15625f,0.59375f,0.15625f,0.49000001f,
+	0.458984375f,0.328125f,0.416015625f,0.328125f,0.416015625f,0.37890625f,0.458984375f,0.37890625f,0.59375f,-0.65625f,-0.09375f,-0.65625f,-0.09375f,0.15625f,0.59375f,0.15625f,0.49000001f,
+	0.4140625f,0.328125f,0.37109375f,0.328125f,0.37109375f,0.37890625f,0.4140625f,0.37890625f,0.59375f,-0.65625f,-0.09375f,-0.65625f,-0.09375f,0.15625f,0.59375f,0.15625f,0.49000001f,
+	0.28515625f,0.48828125f,0.244140625f,0.48828125f,0.244140625f,0.525390625f,0.28515625f,0.525390625f,0.5625f,-0.53125f,-0.09375f,-0.53125f,-0.09375f,0.0625f,0.5625f,0.0625f,0.457500011f,
+	0.822265625f,0.271484375f,0.779296875f,0.271484375f,0.779296875f,0.32421875f,0.822265625f,0.32421875f,0.59375f,-0.625f,-0.09375f,-0.625f,-0.09375f,0.21875f,0.59375f,0.21875f,0.49000001f,
+	0.99609375f,0.2109375f,0.958984375f,0.2109375f,0.958984375f,0.265625f,0.99609375f,0.265625f,0.5f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,0.15625f,0.5f,0.15625f,0.414166689f,
+	0.0390625f,0.271484375f,0.001953125f,0.271484375f,0.001953125f,0.326171875f,0.0390625f,0.326171875f,0.5f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,0.15625f,0.5f,0.15625f,0.414166689f,
+	0.078125f,0.271484375f,0.041015625f,0.271484375f,0.041015625f,0.326171875f,0.078125f,0.326171875f,0.5f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,0.15625f,0.5f,0.15625f,0.414166689f,
+	0.33203125f,0.328125f,0.294921875f,0.328125f,0.294921875f,0.37890625f,0.33203125f,0.37890625f,0.5f,-0.65625f,-0.09375f,-0.65625f,-0.09375f,0.15625f,0.5f,0.15625f,0.414166689f,
+	0.900390625f,0.07421875f,0.861328125f,0.07421875f,0.861328125f,0.138671875f,0.900390625f,0.138671875f,0.53125f,-0.71875f,-0.09375f,-0.71875f,-0.09375f,0.3125f,0.53125f,0.3125f,0.436666667f,
+	0.720703125f,0.146484375f,0.677734375f,0.146484375f,0.677734375f,0.20703125f,0.720703125f,0.20703125f,0.59375f,-0.6875f,-0.09375f,-0.6875f,-0.09375f,0.28125f,0.59375f,0.28125f,0.495833337f,
+	0.76171875f,0.146484375f,0.72265625f,0.146484375f,0.72265625f,0.20703125f,0.76171875f,0.20703125f,0.53125f,-0.65625f,-0.09375f,-0.65625f,-0.09375f,0.3125f,0.53125f,0.3125f,0.436666667f,
+};
+
+static const uint8_t bakedFontBitmap0[] = {
+	0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x07,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,
+	0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+	0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+	0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,
+	0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,
+	0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,
+	0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,
+	0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,
+	0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+	0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+	0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,
+	0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,
+	0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x17,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,
+	0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,
+	0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,
+	0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,
+	0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,
+	0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,
+	0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,
+	0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,
+	0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,
+	0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,
+	0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,
+	0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,
+	0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,
+	0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,
+	0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x16,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,
+	0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,
+	0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,
+	0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,
+	0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,
+	0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,
+	0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,
+	0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,
+	0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,
+	0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,
+	0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,
+	0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,
+	0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,
+	0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,
+	0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x15,0x1f,0x3f,
+	0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,
+	0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,
+	0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,
+	0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,
+	0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,
+	0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,
+	0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,
+	0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,
+	0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,
+	0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,
+	0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,
+	0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,
+	0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,
+	0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,
+	0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,
+	0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,
+	0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,
+	0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,
+	0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,
+	0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,
+	0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,
+	0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,
+	0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,
+	0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,
+	0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,
+	0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,
+	0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,
+	0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,
+	0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,
+	0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,
+	0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,
+	0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,
+	0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,
+	0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,
+	0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,
+	0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,
+	0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,
+	0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,
+	0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,
+	0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,
+	0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,
+	0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,
+	0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,
+	0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,
+	0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,
+	0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,
+	0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,
+	0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,
+	0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,
+	0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,
+	0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,
+	0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,
+	0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,
+	0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,
+	0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,
+	0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,
+	0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,
+	0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,
+	0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,
+	0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,
+	0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,
+	0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,
+	0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,
+	0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,
+	0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,
+	0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,
+	0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,
+	0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,
+	0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,
+	0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,
+	0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,
+	0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,
+	0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,
+	0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,
+	0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,
+	0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,
+	0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,
+	0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,
+	0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,
+	0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,
+	0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,
+	0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,
+	0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x15,0x1f,0x3f,0x5f,0x7f,0x85,0x85,
+	0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,
+	0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,
+	0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,
+	0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,
+	0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x15,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,
+	0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,
+	0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,
+	0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,
+	0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,
+	0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,
+	0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,
+	0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,
+	0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,
+	0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,
+	0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,
+	0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,
+	0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,
+	0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,
+	0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,
+	0x00,0x15,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,
+	0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,
+	0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,
+	0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,
+	0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,
+	0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,
+	0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,
+	0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,
+	0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,
+	0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,
+	0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,
+	0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,
+	0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,
+	0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,
+	0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x16,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x18,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,
+	0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,
+	0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,
+	0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,
+	0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,
+	0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,
+	0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,
+	0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,
+	0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,
+	0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,
+	0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,
+	0x05,0x05,0x05,0x05,0x05,0x04,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xdb,0x09,0x0f,0x0f,0x0f,0x0b,0x00,0x3c,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+	0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,
+	0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,
+	0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,
+	0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,
+	0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,
+	0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+	0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+	0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,0x10,0x00,0x06,0x08,0x15,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x19,
+	0x10,0x00,0x0c,0x08,0x16,0x1c,0x1c,0x1c,0x16,0x08,0x00,0x17,0x06,0x15,0x1c,0x1c,0x1c,0x17,0x0a,0x00,0x0f,0x10,0x1a,0x1c,0x1c,0x1a,0x10,0x00,0x13,0x0d,0x19,0x1c,
+	0x1c,0x1b,0x12,0x02,0x00,0x0e,0x14,0x26,0x2f,0x2f,0x2f,0x2a,0x1a,0x04,0x00,0x0b,0x07,0x10,0x10,0x06,0x00,0x0f,0x0f,0x1a,0x1c,0x1c,0x1b,0x11,0x00,0x15,0x09,0x21,
+	0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,
+	0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,
+	0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,
+	0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,
+	0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,
+	0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,
+	0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,
+	0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,
+	0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x04,0x09,
+	0x21,0x33,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x3a,0x39,0x2c,0x17,0x00,0x0a,0x09,0x21,0x34,0x3c,0x3c,0x3c,0x33,0x20,0x08,0x00,0x15,0x05,0x1e,0x32,0x3c,0x3c,
+	0x3c,0x35,0x24,0x0c,0x00,0x0d,0x14,0x2b,0x39,0x3c,0x3c,0x3a,0x2c,0x16,0x00,0x11,0x11,0x28,0x38,0x3c,0x3c,0x3b,0x2e,0x19,0x00,0x0d,0x0e,0x2a,0x42,0x4f,0x4f,0x4f,
+	0x47,0x31,0x16,0x00,0x0a,0x10,0x24,0x2f,0x2f,0x23,0x0f,0x00,0x0d,0x13,0x2a,0x39,0x3c,0x3c,0x3a,0x2d,0x17,0x00,0x14,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,
+	0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,
+	0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,
+	0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,
+	0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,
+	0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,
+	0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,
+	0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,
+	0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,
+	0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,
+	0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x03,0x18,0x35,0x4e,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x58,0x44,0x29,0x0b,0x00,0x09,0x18,0x35,0x4f,0x5c,0x5c,
+	0x5c,0x4e,0x34,0x16,0x00,0x15,0x13,0x31,0x4b,0x5b,0x5c,0x5c,0x51,0x38,0x1b,0x00,0x0c,0x07,0x25,0x41,0x57,0x5c,0x5c,0x58,0x43,0x27,0x09,0x00,0x0f,0x03,0x21,0x3d,
+	0x55,0x5c,0x5c,0x5a,0x46,0x2b,0x0d,0x00,0x0c,0x18,0x37,0x56,0x6e,0x6f,0x6f,0x5e,0x40,0x20,0x01,0x00,0x08,0x10,0x24,0x3d,0x4e,0x4e,0x3c,0x22,0x0f,0x00,0x0b,0x05,
+	0x24,0x40,0x56,0x5c,0x5c,0x59,0x44,0x28,0x0a,0x00,0x13,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,
+	0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,
+	0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,
+	0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,
+	0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,
+	0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,
+	0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,
+	0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,
+	0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,
+	0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x03,0x1f,0x3f,0x5f,
+	0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x51,0x31,0x12,0x00,0x09,0x1e,0x3e,0x5e,0x7c,0x7c,0x7b,0x5d,0x3e,0x1f,0x01,0x00,0x14,0x1c,0x3b,0x5a,0x78,0x7c,
+	0x7c,0x61,0x41,0x21,0x01,0x00,0x0b,0x0c,0x2c,0x4c,0x6c,0x7c,0x7c,0x6e,0x4f,0x30,0x11,0x00,0x0f,0x0b,0x2a,0x49,0x68,0x7c,0x7c,0x72,0x53,0x33,0x13,0x00,0x0b,0x02,
+	0x21,0x40,0x5f,0x7d,0x8f,0x7d,0x5e,0x40,0x21,0x01,0x00,0x07,0x0a,0x25,0x3d,0x4e,0x6a,0x69,0x4c,0x3c,0x25,0x09,0x00,0x0a,0x0e,0x2d,0x4c,0x6b,0x7c,0x7c,0x70,0x50,
+	0x30,0x10,0x00,0x13,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,
+	0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,
+	0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,
+	0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,
+	0x9a,0x92,0x72,0x52,0x32,0x12,0x00,0x09,0x1a,0x38,0x57,0x75,0x94,0x85,0x66,0x47,0x28,0x09,0x00,0x13,0x06,0x25,0x44,0x62,0x81,0x97,0x78,0x5a,0x3c,0x1d,0x00,0x0c,
+	0x09,0x28,0x46,0x65,0x83,0x95,0x77,0x58,0x39,0x1a,0x00,0x0f,0x14,0x33,0x52,0x70,0x8f,0x89,0x6b,0x4c,0x2e,0x0f,0x00,0x0b,0x0b,0x2a,0x48,0x67,0x86,0x91,0x73,0x54,
+	0x36,0x18,0x00,0x08,0x14,0x33,0x51,0x69,0x69,0x67,0x69,0x50,0x32,0x13,0x00,0x0a,0x17,0x36,0x54,0x73,0x92,0x86,0x68,0x49,0x2b,0x0c,0x00,0x13,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,
+	0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,
+	0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x09,
+	0x10,0x2e,0x4d,0x6b,0x89,0x8d,0x6e,0x50,0x31,0x12,0x00,0x13,0x0f,0x2e,0x4c,0x6b,0x8a,0x8d,0x6e,0x50,0x32,0x13,0x00,0x0b,0x04,0x07,0x1e,0x3c,0x5a,0x79,0x97,0x7f,
+	0x60,0x42,0x23,0x06,0x07,0x07,0x04,0x00,0x07,0x04,0x07,0x07,0x06,0x1d,0x3c,0x5a,0x79,0x98,0x7f,0x61,0x42,0x24,0x07,0x04,0x00,0x06,0x0e,0x19,0x1a,0x1a,0x18,0x32,
+	0x51,0x70,0x8f,0x87,0x69,0x4a,0x2c,0x1a,0x16,0x0a,0x00,0x06,0x15,0x35,0x54,0x70,0x66,0x67,0x70,0x53,0x34,0x14,0x00,0x09,0x01,0x20,0x3e,0x5d,0x7c,0x9a,0x7c,0x5e,
+	0x3f,0x21,0x03,0x00,0x13,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,
+	0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,
+	0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,
+	0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,
+	0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,
+	0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,
+	0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,
+	0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,
+	0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,
+	0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x84,0x84,0x79,0x84,
+	0x84,0x91,0x92,0x72,0x52,0x32,0x12,0x00,0x09,0x06,0x24,0x43,0x61,0x7f,0x96,0x77,0x58,0x3a,0x1b,0x00,0x13,0x17,0x36,0x55,0x74,0x93,0x83,0x64,0x46,0x28,0x09,0x00,
+	0x09,0x01,0x15,0x23,0x27,0x27,0x32,0x50,0x6f,0x8d,0x88,0x69,0x4a,0x2c,0x26,0x27,0x27,0x23,0x16,0x02,0x00,0x03,0x01,0x15,0x23,0x27,0x27,0x26,0x25,0x44,0x63,0x82,
+	0x93,0x75,0x57,0x38,0x27,0x27,0x23,0x16,0x02,0x00,0x03,0x14,0x2a,0x38,0x3a,0x3a,0x37,0x3b,0x5a,0x79,0x97,0x7d,0x5f,0x40,0x3a,0x3a,0x35,0x24,0x0d,0x00,0x05,0x0d,
+	0x2a,0x43,0x56,0x6f,0x6e,0x56,0x43,0x29,0x0c,0x00,0x09,0x09,0x28,0x47,0x66,0x85,0x90,0x72,0x54,0x35,0x17,0x00,0x14,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,
+	0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,
+	0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,
+	0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,
+	0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,
+	0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,
+	0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,
+	0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,
+	0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,
+	0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,
+	0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x78,0x7b,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x0a,0x1a,0x39,0x57,0x75,0x8e,
+	0x80,0x61,0x42,0x23,0x03,0x00,0x12,0x1f,0x3f,0x5e,0x7d,0x8e,0x79,0x5a,0x3c,0x1d,0x00,0x0a,0x15,0x2e,0x41,0x47,0x47,0x46,0x46,0x65,0x83,0x8e,0x72,0x53,0x36,0x45,
+	0x47,0x47,0x42,0x2f,0x16,0x00,0x03,0x15,0x2e,0x41,0x47,0x47,0x46,0x38,0x4d,0x6c,0x8a,0x89,0x6b,0x4c,0x45,0x47,0x47,0x42,0x2f,0x16,0x00,0x02,0x07,0x25,0x41,0x56,
+	0x5a,0x5a,0x55,0x40,0x60,0x7b,0x7b,0x73,0x55,0x59,0x5a,0x5a,0x51,0x39,0x1d,0x00,0x05,0x0d,0x2d,0x4d,0x6d,0x7a,0x7a,0x6c,0x4c,0x2c,0x0c,0x00,0x09,0x16,0x31,0x50,
+	0x6f,0x8d,0x86,0x68,0x4a,0x2b,0x0d,0x00,0x14,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,
+	0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,
+	0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,
+	0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,
+	0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,
+	0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,
+	0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,
+	0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,
+	0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,
+	0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,
+	0x87,0x87,0x87,0x87,0x87,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x0a,0x10,0x2f,0x4d,0x68,0x6e,0x6e,0x5f,0x42,0x22,0x03,0x00,0x12,0x1f,0x3e,0x5c,0x6e,0x6e,0x6a,0x50,
+	0x32,0x13,0x00,0x09,0x02,0x22,0x40,0x5b,0x67,0x67,0x64,0x4d,0x5a,0x6e,0x6e,0x6c,0x52,0x4b,0x63,0x67,0x67,0x5c,0x41,0x23,0x04,0x00,0x01,0x02,0x22,0x40,0x5b,0x67,
+	0x67,0x64,0x4d,0x4c,0x68,0x6e,0x6e,0x60,0x4b,0x63,0x67,0x67,0x5c,0x41,0x23,0x04,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x7a,0x7a,0x6b,0x4b,0x4f,0x5b,0x5b,0x59,0x55,0x74,
+	0x7a,0x7a,0x63,0x44,0x24,0x04,0x00,0x04,0x0d,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x08,0x05,0x23,0x41,0x5c,0x6a,0x6e,0x6e,0x5d,0x40,0x21,0x03,0x00,
+	0x14,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,
+	0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,
+	0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,
+	0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,
+	0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,
+	0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,
+	0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,
+	0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,
+	0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,
+	0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x73,0x72,0x89,0xa7,0xab,0x92,0x72,
+	0x52,0x32,0x12,0x00,0x0a,0x06,0x22,0x3b,0x51,0x70,0x6d,0x4e,0x32,0x18,0x00,0x13,0x15,0x31,0x51,0x70,0x6d,0x4e,0x3d,0x25,0x09,0x00,0x09,0x05,0x25,0x45,0x65,0x85,
+	0x87,0x73,0x53,0x44,0x4e,0x4e,0x4d,0x3f,0x51,0x71,0x87,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x87,0x73,0x53,0x3a,0x4c,0x4e,0x4e,0x47,0x51,
+	0x71,0x87,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x34,0x3b,0x3b,0x3a,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x04,0x0d,
+	0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x08,0x10,0x2e,0x4c,0x6a,0x86,0x86,0x84,0x66,0x48,0x29,0x0b,0x00,0x14,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,
+	0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,
+	0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,
+	0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x89,0x8a,0x93,0x92,0x72,0x52,0x32,0x12,0x00,0x0b,0x0f,0x2e,0x4c,0x65,
+	0x63,0x49,0x2b,0x0c,0x00,0x13,0x0f,0x2e,0x4c,0x65,0x63,0x49,0x2b,0x10,0x00,0x0a,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x2e,0x2e,0x2e,0x31,0x51,0x71,0x91,
+	0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x2d,0x2e,0x2e,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x0d,0x2d,
+	0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x1b,0x1b,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x04,0x0d,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x08,
+	0x1a,0x38,0x57,0x75,0x93,0xa0,0x8e,0x70,0x52,0x34,0x16,0x00,0x14,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,
+	0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,
+	0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,
+	0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,
+	0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,
+	0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,
+	0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,
+	0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,
+	0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,
+	0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,
+	0x3f,0x5f,0x7f,0x9f,0x80,0x77,0x77,0x77,0x77,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x0b,0x11,0x31,0x50,0x6e,0x6b,0x4d,0x2d,0x0d,0x00,0x13,0x11,0x31,0x50,0x6e,0x6b,
+	0x4d,0x2d,0x0d,0x00,0x0a,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x0e,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,
+	0x85,0x93,0x73,0x53,0x33,0x13,0x0e,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x15,0x35,0x55,
+	0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x04,0x0d,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x07,0x07,0x25,0x43,0x61,0x7f,0x9c,0x82,0x99,0x7b,0x5d,0x3f,
+	0x20,0x02,0x00,0x13,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,
+	0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7f,0x7f,0x7f,0x7f,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x0b,0x09,0x27,0x41,0x53,0x52,0x3e,0x24,0x06,0x00,0x13,0x09,0x27,0x41,0x53,0x52,0x3e,0x24,0x06,0x00,0x0a,0x05,0x25,0x45,0x65,
+	0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,
+	0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,
+	0x00,0x04,0x0d,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x07,0x11,0x2f,0x4e,0x6c,0x8a,0x91,0x77,0x95,0x85,0x67,0x49,0x2b,0x0d,0x00,0x13,0x1f,0x3f,0x5f,
+	0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,
+	0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,
+	0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,
+	0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,
+	0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,
+	0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,
+	0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,
+	0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,
+	0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,
+	0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x83,0x83,0x79,0x83,0x83,0x90,0x92,0x72,0x52,0x32,0x12,0x00,
+	0x0c,0x14,0x28,0x34,0x33,0x26,0x11,0x00,0x15,0x14,0x28,0x34,0x33,0x26,0x11,0x00,0x0b,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,
+	0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,
+	0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x04,0x0d,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,
+	0x0d,0x00,0x07,0x1c,0x3a,0x58,0x76,0x95,0x86,0x6d,0x8b,0x90,0x72,0x54,0x36,0x17,0x00,0x13,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,
+	0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7c,0x78,0x89,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x05,0x06,0x07,0x07,0x06,0x00,0x04,0x0c,0x15,0x14,0x0a,
+	0x00,0x04,0x06,0x06,0x07,0x06,0x00,0x07,0x06,0x07,0x07,0x06,0x00,0x04,0x0c,0x15,0x14,0x0a,0x00,0x04,0x06,0x06,0x07,0x06,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x93,
+	0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,
+	0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x04,
+	0x0d,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x06,0x08,0x26,0x45,0x63,0x81,0x9a,0x7c,0x62,0x80,0x9b,0x7c,0x5e,0x40,0x22,0x04,0x00,0x12,0x1f,0x3f,0x5f,
+	0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,
+	0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,
+	0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,
+	0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,
+	0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,
+	0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,
+	0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,
+	0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,
+	0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,
+	0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x86,0x86,0x86,0x8b,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,
+	0x03,0x07,0x1a,0x26,0x26,0x27,0x25,0x19,0x06,0x00,0x08,0x08,0x1b,0x26,0x26,0x27,0x25,0x19,0x05,0x00,0x03,0x07,0x1a,0x26,0x26,0x27,0x25,0x19,0x06,0x00,0x08,0x08,
+	0x1b,0x26,0x26,0x27,0x25,0x19,0x05,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,
+	0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,
+	0x4c,0x2c,0x0c,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x04,0x0d,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x06,0x13,0x31,0x4f,0x6d,0x8c,
+	0x90,0x71,0x58,0x76,0x94,0x87,0x69,0x4b,0x2d,0x0e,0x00,0x12,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,
+	0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1c,0x34,0x45,0x46,0x46,0x44,0x33,0x1b,0x00,0x07,0x02,0x1d,0x35,0x45,0x45,0x46,
+	0x44,0x33,0x1a,0x00,0x03,0x1c,0x34,0x45,0x46,0x46,0x44,0x33,0x1b,0x00,0x07,0x02,0x1d,0x35,0x45,0x45,0x46,0x44,0x33,0x1a,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,
+	0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,
+	0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x71,0x71,0x6a,0x4b,0x2b,0x0b,0x15,0x35,0x54,0x73,0x69,0x7b,0x9b,0xbb,0xdb,0xfb,0x00,0x04,
+	0x0d,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x06,0x1d,0x3c,0x5a,0x78,0x96,0x85,0x67,0x4d,0x6b,0x89,0x92,0x73,0x55,0x37,0x19,0x00,0x12,0x1f,0x3f,0x5f,
+	0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,
+	0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,
+	0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,
+	0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,
+	0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,
+	0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,
+	0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,
+	0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,
+	0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,
+	0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x7d,0x7d,0x7d,0x90,0x92,0x72,0x52,0x32,0x12,0x00,
+	0x02,0x0b,0x2a,0x48,0x61,0x64,0x65,0x60,0x46,0x28,0x09,0x00,0x06,0x0d,0x2c,0x49,0x62,0x63,0x65,0x60,0x46,0x27,0x08,0x00,0x01,0x0b,0x2a,0x48,0x61,0x64,0x65,0x60,
+	0x46,0x28,0x09,0x00,0x06,0x0d,0x2c,0x49,0x62,0x63,0x65,0x60,0x46,0x27,0x08,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,
+	0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,
+	0x01,0x08,0x26,0x43,0x59,0x5a,0x56,0x53,0x3e,0x23,0x27,0x25,0x2b,0x46,0x57,0x5b,0x7b,0x9b,0xbb,0xdb,0xfb,0x00,0x04,0x0d,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,
+	0x0d,0x00,0x05,0x0a,0x28,0x46,0x64,0x83,0x99,0x7a,0x5c,0x57,0x61,0x7f,0x9c,0x7e,0x60,0x42,0x23,0x05,0x00,0x11,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,
+	0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x79,0x86,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x02,0x0d,0x2d,0x4d,0x6c,0x70,0x71,
+	0x6a,0x4b,0x2b,0x0b,0x00,0x06,0x0f,0x2f,0x4e,0x6d,0x6e,0x72,0x69,0x4a,0x2a,0x0b,0x00,0x01,0x0d,0x2d,0x4d,0x6c,0x70,0x71,0x6a,0x4b,0x2b,0x0b,0x00,0x06,0x0f,0x2f,
+	0x4e,0x6d,0x6e,0x72,0x69,0x4a,0x2a,0x0b,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,
+	0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x02,0x16,0x2c,0x3b,0x3c,0x37,0x35,
+	0x27,0x39,0x47,0x44,0x33,0x33,0x3f,0x5b,0x7b,0x9b,0xbb,0xdb,0xfb,0x00,0x04,0x0d,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x05,0x14,0x33,0x51,0x6f,0x8d,
+	0x8e,0x77,0x77,0x77,0x77,0x77,0x93,0x89,0x6a,0x4c,0x2e,0x10,0x00,0x11,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,
+	0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x82,0x82,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x02,0x07,0x24,0x3f,0x54,0x55,0x56,0x53,0x3e,0x23,0x05,0x00,0x06,0x08,0x26,
+	0x41,0x54,0x55,0x56,0x53,0x3d,0x22,0x04,0x00,0x01,0x07,0x24,0x3f,0x54,0x55,0x56,0x53,0x3e,0x23,0x05,0x00,0x06,0x08,0x26,0x41,0x54,0x55,0x56,0x53,0x3d,0x22,0x04,
+	0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,
+	0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x03,0x11,0x1b,0x1c,0x17,0x16,0x31,0x4e,0x65,0x60,0x46,0x4b,0x5e,0x5b,0x7b,
+	0x9b,0xbb,0xdb,0xfb,0x00,0x04,0x0d,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x04,0x01,0x1f,0x3d,0x5b,0x7a,0x98,0x9a,0x97,0x97,0x97,0x97,0x97,0x9d,0x93,
+	0x75,0x57,0x39,0x1a,0x00,0x11,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,
+	0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,
+	0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x81,0x81,0x81,
+	0x81,0x81,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x12,0x28,0x35,0x36,0x37,0x35,0x27,0x11,0x00,0x08,0x14,0x29,0x36,0x36,0x37,0x35,0x26,0x10,0x00,0x03,0x12,0x28,
+	0x35,0x36,0x37,0x35,0x27,0x11,0x00,0x08,0x14,0x29,0x36,0x36,0x37,0x35,0x26,0x10,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,
+	0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,
+	0x00,0x06,0x07,0x14,0x34,0x53,0x71,0x69,0x4a,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x04,0x0d,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x04,0x0b,
+	0x2a,0x48,0x66,0x84,0x98,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x9c,0x80,0x61,0x43,0x25,0x07,0x00,0x10,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,
+	0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,
+	0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,
+	0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x92,0x92,0x92,0x92,0x92,0x99,0x92,0x72,0x52,0x32,0x12,0x00,0x04,0x0c,0x16,0x17,0x17,0x16,0x0b,0x00,0x04,
+	0x04,0x04,0x00,0x04,0x0d,0x16,0x16,0x17,0x16,0x0b,0x00,0x05,0x0c,0x16,0x17,0x17,0x16,0x0b,0x00,0x04,0x04,0x04,0x00,0x04,0x0d,0x16,0x16,0x17,0x16,0x0b,0x00,0x03,
+	0x04,0x23,0x43,0x60,0x6f,0x66,0x6b,0x51,0x32,0x12,0x04,0x10,0x30,0x4f,0x6a,0x68,0x6e,0x61,0x44,0x25,0x05,0x00,0x01,0x04,0x23,0x43,0x60,0x6f,0x66,0x6b,0x51,0x32,
+	0x12,0x04,0x10,0x30,0x4f,0x6a,0x68,0x6e,0x61,0x44,0x25,0x05,0x00,0x04,0x06,0x16,0x25,0x2c,0x32,0x51,0x6a,0x64,0x48,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,
+	0x03,0x0a,0x13,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x04,0x16,0x34,0x52,0x71,0x8f,0x8d,0x6f,0x5e,0x5e,0x5e,0x5e,0x5e,0x73,0x91,0x8a,0x6c,0x4e,0x30,
+	0x11,0x00,0x10,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,
+	0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,
+	0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,
+	0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,
+	0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,
+	0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,
+	0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,
+	0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,
+	0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,
+	0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x72,0x72,0x72,0x72,0x90,
+	0x92,0x72,0x52,0x32,0x12,0x00,0x0c,0x08,0x1a,0x24,0x24,0x18,0x06,0x00,0x15,0x08,0x1a,0x24,0x24,0x18,0x06,0x00,0x0c,0x19,0x34,0x49,0x4f,0x4c,0x4e,0x3e,0x25,0x1f,
+	0x24,0x1f,0x24,0x3d,0x4d,0x4c,0x4f,0x49,0x35,0x1a,0x00,0x03,0x19,0x34,0x49,0x4f,0x4c,0x4e,0x3e,0x25,0x1f,0x24,0x1f,0x24,0x3d,0x4d,0x4c,0x4f,0x49,0x35,0x1a,0x00,
+	0x04,0x0f,0x22,0x32,0x42,0x4c,0x44,0x52,0x6d,0x66,0x49,0x51,0x69,0x62,0x6c,0x5e,0x41,0x22,0x02,0x00,0x02,0x11,0x26,0x32,0x32,0x49,0x63,0x65,0x66,0x62,0x48,0x2a,
+	0x0a,0x00,0x03,0x02,0x21,0x3f,0x5d,0x7b,0x99,0x82,0x64,0x46,0x3e,0x3e,0x3e,0x4a,0x69,0x87,0x95,0x77,0x58,0x3a,0x1c,0x00,0x10,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,
+	0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,
+	0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,
+	0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,
+	0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,
+	0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,
+	0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,
+	0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,
+	0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,
+	0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,
+	0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x82,0x90,0x90,0x73,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x0b,0x03,0x1e,0x35,
+	0x44,0x43,0x33,0x1b,0x00,0x14,0x03,0x1e,0x35,0x44,0x43,0x33,0x1b,0x00,0x0c,0x07,0x1c,0x2b,0x2f,0x2d,0x2f,0x24,0x28,0x3c,0x44,0x3d,0x29,0x23,0x2e,0x2e,0x2f,0x2c,
+	0x1d,0x08,0x00,0x03,0x07,0x1c,0x2b,0x2f,0x2d,0x2f,0x24,0x28,0x3c,0x44,0x3d,0x29,0x23,0x2e,0x2e,0x2f,0x2c,0x1d,0x08,0x00,0x03,0x06,0x23,0x3c,0x4e,0x5e,0x6c,0x5c,
+	0x40,0x50,0x4d,0x39,0x3d,0x4b,0x48,0x4c,0x45,0x31,0x17,0x00,0x02,0x07,0x24,0x3f,0x51,0x51,0x3f,0x46,0x47,0x48,0x46,0x35,0x1c,0x00,0x04,0x0d,0x2b,0x49,0x68,0x86,
+	0x96,0x78,0x5a,0x3b,0x1e,0x1e,0x22,0x40,0x5e,0x7c,0x9a,0x81,0x63,0x45,0x27,0x08,0x00,0x0f,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,
+	0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x78,0x78,0x78,0x71,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x0b,0x0e,0x2d,0x4a,0x62,0x60,0x47,0x2a,0x0b,0x00,0x13,
+	0x0e,0x2d,0x4a,0x62,0x60,0x47,0x2a,0x0b,0x00,0x0c,0x01,0x0c,0x0f,0x0e,0x0f,0x1b,0x39,0x55,0x64,0x56,0x3b,0x1c,0x0f,0x0e,0x0f,0x0d,0x02,0x00,0x05,0x01,0x0c,0x0f,
+	0x0e,0x0f,0x1b,0x39,0x55,0x64,0x56,0x3b,0x1c,0x0f,0x0e,0x0f,0x0d,0x02,0x00,0x04,0x0f,0x2f,0x4e,0x69,0x7a,0x89,0xa0,0xbd,0xad,0xb0,0xc4,0xdd,0xd4,0xd6,0xd3,0xd7,
+	0xe6,0xfb,0xff,0x00,0x01,0x0f,0x2f,0x4e,0x6c,0x6c,0x4e,0x2f,0x28,0x28,0x27,0x1b,0x08,0x00,0x04,0x18,0x36,0x54,0x72,0x90,0x8b,0x6d,0x4f,0x31,0x13,0x00,0x01,0x17,
+	0x35,0x53,0x72,0x90,0x8c,0x6e,0x4f,0x31,0x13,0x00,0x0f,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,
+	0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,
+	0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,
+	0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,
+	0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,
+	0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,
+	0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,
+	0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,
+	0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,
+	0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,
+	0x7f,0x9f,0x88,0x88,0x88,0x88,0x88,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x0b,0x11,0x31,0x51,0x70,0x6d,0x4d,0x2e,0x0e,0x00,0x13,0x11,0x31,0x51,0x70,0x6d,0x4d,0x2e,
+	0x0e,0x00,0x11,0x1f,0x3f,0x5e,0x7b,0x60,0x40,0x20,0x00,0x0f,0x1f,0x3f,0x5e,0x7b,0x60,0x40,0x20,0x00,0x09,0x0f,0x2f,0x4e,0x6a,0x6a,0x5a,0x4a,0x53,0x6f,0x68,0x4a,
+	0x2a,0x0c,0x0a,0x0c,0x09,0x00,0x04,0x10,0x30,0x50,0x70,0x90,0xb0,0xd0,0xf0,0xf7,0xf7,0xff,0xff,0xff,0xff,0x00,0x01,0x04,0x22,0x40,0x5e,0x7d,0x9b,0x81,0x63,0x44,
+	0x26,0x08,0x00,0x01,0x0c,0x2b,0x49,0x67,0x85,0x96,0x78,0x5a,0x3c,0x1e,0x00,0x0f,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,
+	0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x7b,0x7a,0x70,0x7b,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x0b,0x0f,0x2f,0x4d,0x67,0x65,0x4a,0x2b,0x0c,0x00,0x13,0x0f,0x2f,
+	0x4d,0x67,0x65,0x4a,0x2b,0x0c,0x00,0x11,0x1c,0x3b,0x58,0x6a,0x59,0x3c,0x1e,0x00,0x0f,0x1c,0x3b,0x58,0x6a,0x59,0x3c,0x1e,0x00,0x09,0x07,0x23,0x3d,0x4e,0x4d,0x3e,
+	0x32,0x50,0x68,0x63,0x47,0x28,0x09,0x00,0x07,0x10,0x30,0x50,0x70,0x90,0xb0,0xd0,0xf0,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x0c,0x2c,0x4b,0x69,0x87,0x90,0x76,
+	0x58,0x3a,0x1c,0x00,0x02,0x02,0x20,0x3e,0x5c,0x7b,0x90,0x83,0x65,0x46,0x27,0x08,0x00,0x0e,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,
+	0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,
+	0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,
+	0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x8b,0x79,0x79,0x8b,0x8d,0x95,0x92,0x72,0x52,0x32,0x12,0x00,0x0b,0x11,0x30,0x50,0x6d,0x6a,0x4c,0x2d,0x0d,0x00,0x13,
+	0x11,0x30,0x50,0x6d,0x6a,0x4c,0x2d,0x0d,0x00,0x11,0x1e,0x3e,0x5d,0x75,0x5f,0x3f,0x20,0x00,0x0f,0x1e,0x3e,0x5d,0x75,0x5f,0x3f,0x20,0x00,0x0a,0x0f,0x23,0x2e,0x2e,
+	0x22,0x34,0x54,0x73,0x6a,0x4a,0x2b,0x0b,0x00,0x07,0x0c,0x2b,0x49,0x61,0x61,0x49,0x2b,0x0c,0x00,0x07,0x0c,0x2c,0x4b,0x67,0x70,0x70,0x69,0x4d,0x2f,0x11,0x00,0x03,
+	0x15,0x34,0x52,0x6c,0x70,0x70,0x64,0x46,0x27,0x08,0x00,0x0e,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,
+	0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,
+	0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,
+	0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x80,0x75,0x75,0x75,0x75,0x90,0x92,0x72,0x52,0x32,0x12,0x00,0x0b,0x09,0x26,0x40,0x51,0x50,0x3d,0x23,0x06,0x00,0x13,0x09,0x26,0x40,0x51,0x50,0x3d,
+	0x23,0x06,0x00,0x11,0x16,0x32,0x4a,0x55,0x4b,0x33,0x17,0x00,0x0f,0x16,0x32,0x4a,0x55,0x4b,0x33,0x17,0x00,0x0b,0x06,0x0f,0x0f,0x11,0x30,0x4d,0x63,0x5e,0x45,0x27,
+	0x08,0x00,0x07,0x01,0x1d,0x34,0x43,0x43,0x34,0x1d,0x01,0x00,0x07,0x04,0x20,0x3a,0x4c,0x50,0x50,0x4d,0x3c,0x23,0x06,0x00,0x03,0x0a,0x27,0x3f,0x4e,0x50,0x50,0x4a,
+	0x37,0x1c,0x00,0x0f,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,
+	0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,
+	0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,
+	0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,
+	0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,
+	0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,
+	0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,
+	0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,
+	0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,
+	0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x9f,0x95,0x95,0x95,0x95,0x95,
+	0x9b,0x92,0x72,0x52,0x32,0x12,0x00,0x0c,0x13,0x27,0x32,0x32,0x25,0x10,0x00,0x15,0x13,0x27,0x32,0x32,0x25,0x10,0x00,0x12,0x06,0x1d,0x2f,0x35,0x2f,0x1e,0x07,0x00,
+	0x0f,0x06,0x1d,0x2f,0x35,0x2f,0x1e,0x07,0x00,0x0e,0x05,0x20,0x37,0x44,0x42,0x31,0x19,0x00,0x09,0x07,0x19,0x24,0x24,0x19,0x07,0x00,0x09,0x0d,0x21,0x2d,0x30,0x30,
+	0x2e,0x22,0x0f,0x00,0x05,0x12,0x25,0x2f,0x30,0x30,0x2c,0x1f,0x09,0x00,0x0f,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,
+	0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,
+	0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,
+	0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,
+	0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,
+	0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,
+	0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,
+	0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,
+	0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,
+	0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,
+	0x03,0x1f,0x3f,0x5f,0x7f,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x72,0x52,0x32,0x12,0x00,0x0d,0x0a,0x13,0x12,0x09,0x00,0x17,0x0a,0x13,0x12,0x09,0x00,0x14,0x03,
+	0x11,0x15,0x11,0x04,0x00,0x11,0x03,0x11,0x15,0x11,0x04,0x00,0x10,0x0a,0x1b,0x25,0x23,0x17,0x04,0x00,0x0b,0x04,0x04,0x00,0x0c,0x05,0x0e,0x10,0x10,0x0e,0x06,0x00,
+	0x07,0x08,0x0f,0x0f,0x0f,0x0d,0x03,0x00,0x10,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,
+	0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,
+	0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,
+	0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,
+	0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,
+	0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,
+	0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,
+	0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,
+	0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,
+	0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x03,0x1c,0x3a,0x56,0x65,0x65,
+	0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x62,0x4b,0x2d,0x0f,0x00,0x6d,0x05,0x04,0x00,0x3e,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,
+	0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,
+	0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,
+	0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,
+	0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,
+	0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,
+	0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,
+	0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,
+	0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,
+	0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,
+	0x03,0x00,0x03,0x0f,0x29,0x3d,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x44,0x35,0x1e,0x03,0x00,0xae,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
+	0x24,0x1a,0x08,0x00,0x05,0x11,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x1a,0x08,0x00,0xb0,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,
+	0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,
+	0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,
+	0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,
+	0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,
+	0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,
+	0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,
+	0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0x08,0x01,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x04,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0x47,0x08,0x09,0x00,0xc6,0x04,0x07,0x07,0x06,0x00,0x15,0x05,0x0b,0x09,0x00,0x02,0x07,0x0c,0x08,0x00,0x26,0x03,0x07,0x07,0x07,0x06,0x00,0x48,
+	0x04,0x07,0x07,0x07,0x05,0x00,0x13,0x0e,0x19,0x1c,0x1c,0x1b,0x12,0x01,0x00,0x0e,0x08,0x17,0x1d,0x19,0x0c,0x00,0x14,0x11,0x1c,0x1c,0x13,0x02,0x00,0x0e,0x06,0x15,
+	0x1c,0x1c,0x1c,0x17,0x0a,0x00,0x05,0x10,0x1a,0x1c,0x1c,0x1a,0x10,0x00,0x0c,0x04,0x14,0x1b,0x1c,0x1c,0x18,0x0b,0x00,0x0a,0x07,0x16,0x1c,0x1c,0x1c,0x17,0x09,0x00,
+	0x13,0x09,0x1d,0x28,0x28,0x1d,0x0b,0x00,0x11,0x08,0x12,0x13,0x0a,0x00,0x13,0x11,0x1b,0x1c,0x1c,0x1a,0x0f,0x00,0x12,0x10,0x1b,0x1c,0x14,0x03,0x00,0x0d,0x08,0x17,
+	0x1d,0x19,0x0c,0x00,0x0f,0x08,0x14,0x16,0x10,0x01,0x12,0x1a,0x19,0x0e,0x00,0x10,0x01,0x11,0x18,0x16,0x0b,0x06,0x13,0x18,0x14,0x07,0x00,0x13,0x0a,0x18,0x1d,0x18,
+	0x0a,0x00,0x0f,0x09,0x15,0x18,0x12,0x03,0x0d,0x17,0x18,0x0f,0x00,0x09,0x01,0x15,0x23,0x27,0x27,0x26,0x1d,0x0b,0x00,0x12,0x10,0x22,0x2b,0x29,0x1b,0x15,0x25,0x2c,
+	0x26,0x17,0x01,0x00,0x0d,0x0b,0x15,0x16,0x0e,0x04,0x14,0x1b,0x18,0x0c,0x00,0x0d,0x12,0x21,0x27,0x27,0x27,0x25,0x1a,0x06,0x00,0x08,0x0b,0x16,0x18,0x11,0x01,0x0e,
+	0x17,0x17,0x0d,0x00,0x10,0x01,0x10,0x17,0x14,0x08,0x0b,0x18,0x1b,0x14,0x05,0x00,0x0a,0x0a,0x16,0x18,0x11,0x02,0x0e,0x17,0x17,0x0e,0x00,0x06,0x01,0x15,0x23,0x27,
+	0x27,0x27,0x24,0x17,0x03,0x00,0x10,0x12,0x29,0x38,0x3c,0x3c,0x3a,0x2e,0x18,0x00,0x0d,0x0b,0x21,0x34,0x3d,0x37,0x26,0x0f,0x00,0x12,0x17,0x2d,0x3b,0x3c,0x2f,0x19,
+	0x02,0x00,0x0c,0x05,0x1e,0x32,0x3c,0x3c,0x3c,0x35,0x24,0x0c,0x00,0x03,0x15,0x2b,0x39,0x3c,0x3c,0x39,0x2b,0x15,0x00,0x0a,0x03,0x1c,0x31,0x3b,0x3c,0x3c,0x36,0x25,
+	0x0e,0x00,0x08,0x07,0x20,0x33,0x3c,0x3c,0x3c,0x35,0x22,0x0a,0x00,0x11,0x02,0x1e,0x37,0x47,0x47,0x38,0x20,0x04,0x00,0x0f,0x0f,0x24,0x31,0x32,0x27,0x1a,0x1e,0x18,
+	0x0a,0x00,0x0e,0x17,0x2d,0x3a,0x3c,0x3c,0x39,0x2a,0x13,0x00,0x10,0x15,0x2b,0x3a,0x3c,0x30,0x1b,0x04,0x00,0x0b,0x0a,0x21,0x34,0x3d,0x37,0x26,0x0f,0x00,0x0c,0x0b,
+	0x1a,0x23,0x33,0x36,0x2d,0x21,0x2e,0x3a,0x38,0x2a,0x16,0x02,0x00,0x0d,0x01,0x1a,0x2e,0x38,0x35,0x26,0x1f,0x31,0x38,0x32,0x20,0x09,0x00,0x11,0x0d,0x23,0x36,0x3d,
+	0x36,0x23,0x0d,0x00,0x0d,0x0d,0x24,0x34,0x38,0x2f,0x1c,0x29,0x36,0x37,0x2b,0x16,0x00,0x08,0x15,0x2e,0x41,0x47,0x47,0x46,0x38,0x21,0x06,0x00,0x10,0x0f,0x26,0x3d,
+	0x4b,0x47,0x34,0x2c,0x42,0x4c,0x43,0x2e,0x16,0x02,0x00,0x0a,0x0e,0x1b,0x26,0x34,0x36,0x2a,0x21,0x31,0x3b,0x37,0x26,0x13,0x00,0x0b,0x10,0x2a,0x3f,0x47,0x47,0x47,
+	0x44,0x34,0x1b,0x00,0x07,0x0f,0x26,0x35,0x38,0x2e,0x1a,0x2a,0x37,0x36,0x29,0x14,0x00,0x0d,0x02,0x14,0x1e,0x2d,0x36,0x33,0x23,0x25,0x36,0x3b,0x32,0x1f,0x0b,0x00,
+	0x08,0x0f,0x25,0x35,0x38,0x2e,0x1a,0x2a,0x37,0x37,0x2a,0x14,0x00,0x05,0x15,0x2e,0x41,0x47,0x47,0x47,0x42,0x30,0x17,0x00,0x0f,0x04,0x22,0x3f,0x56,0x5c,0x5c,0x59,
+	0x45,0x29,0x0c,0x00,0x0b,0x0b,0x21,0x38,0x4e,0x5d,0x53,0x3c,0x25,0x0e,0x00,0x0f,0x01,0x17,0x2e,0x44,0x59,0x5a,0x46,0x2f,0x18,0x01,0x00,0x0b,0x13,0x31,0x4b,0x5b,
+	0x5c,0x5c,0x51,0x38,0x1b,0x00,0x02,0x08,0x26,0x42,0x58,0x5c,0x5c,0x58,0x42,0x26,0x08,0x00,0x09,0x11,0x2e,0x49,0x5b,0x5c,0x5c,0x52,0x3a,0x1d,0x00,0x08,0x15,0x33,
+	0x4d,0x5c,0x5c,0x5c,0x4f,0x36,0x19,0x00,0x11,0x0d,0x2c,0x4a,0x64,0x65,0x4b,0x2d,0x0e,0x00,0x02,0x04,0x03,0x00,0x0a,0x04,0x21,0x3c,0x4f,0x51,0x40,0x38,0x3e,0x36,
+	0x22,0x09,0x00,0x0c,0x0a,0x28,0x44,0x58,0x5c,0x5c,0x57,0x40,0x24,0x06,0x00,0x0e,0x15,0x2c,0x42,0x58,0x5b,0x48,0x31,0x1a,0x03,0x00,0x09,0x0b,0x21,0x38,0x4e,0x5d,
+	0x53,0x3c,0x25,0x0e,0x00,0x0a,0x0a,0x23,0x37,0x40,0x50,0x56,0x47,0x41,0x46,0x59,0x56,0x43,0x2f,0x1a,0x00,0x0c,0x02,0x1a,0x2d,0x47,0x57,0x52,0x3c,0x34,0x4d,0x58,
+	0x4d,0x35,0x20,0x0a,0x00,0x0f,0x0d,0x24,0x3a,0x50,0x5d,0x51,0x3a,0x23,0x0c,0x00,0x0b,0x0d,0x23,0x39,0x50,0x58,0x49,0x30,0x40,0x54,0x56,0x43,0x29,0x17,0x00,0x06,
+	0x02,0x22,0x40,0x5b,0x67,0x67,0x64,0x4e,0x30,0x11,0x00,0x0f,0x0d,0x27,0x3c,0x52,0x6a,0x61,0x45,0x40,0x59,0x6c,0x5b,0x41,0x2f,0x16,0x00,0x09,0x0e,0x27,0x39,0x40,
+	0x52,0x55,0x43,0x41,0x4a,0x5a,0x53,0x40,0x2c,0x16,0x00,0x09,0x0a,0x1d,0x3b,0x57,0x67,0x67,0x67,0x61,0x47,0x29,0x0a,0x00,0x05,0x10,0x24,0x3c,0x52,0x57,0x47,0x2d,
+	0x42,0x56,0x55,0x41,0x28,0x15,0x00,0x0c,0x18,0x2f,0x3d,0x47,0x56,0x50,0x41,0x3e,0x52,0x5b,0x4c,0x38,0x24,0x0c,0x00,0x06,0x0f,0x24,0x3b,0x52,0x58,0x47,0x2d,0x42,
+	0x55,0x55,0x41,0x28,0x15,0x00,0x03,0x02,0x22,0x40,0x5b,0x67,0x67,0x67,0x5d,0x43,0x24,0x0c,0x00,0x0e,0x0d,0x2c,0x4b,0x69,0x7c,0x7c,0x71,0x51,0x31,0x11,0x00,0x0a,
+	0x0b,0x22,0x38,0x4f,0x65,0x7c,0x69,0x52,0x3b,0x24,0x0d,0x00,0x0d,0x01,0x18,0x2e,0x44,0x5b,0x71,0x74,0x5d,0x46,0x2f,0x18,0x01,0x00,0x0a,0x1c,0x3b,0x5a,0x78,0x7c,
+	0x7c,0x61,0x41,0x21,0x01,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x7c,0x7c,0x6d,0x4e,0x2f,0x11,0x00,0x09,0x1a,0x39,0x57,0x76,0x7c,0x7c,0x64,0x44,0x24,0x04,0x00,0x07,0x1b,
+	0x3b,0x5b,0x7a,0x7c,0x7c,0x60,0x41,0x22,0x03,0x00,0x10,0x0e,0x2e,0x4e,0x6c,0x6d,0x4f,0x30,0x10,0x0a,0x1b,0x24,0x22,0x16,0x03,0x00,0x08,0x1a,0x31,0x4b,0x69,0x6e,
+	0x5d,0x53,0x5e,0x50,0x35,0x18,0x00,0x0c,0x0f,0x2f,0x4f,0x6f,0x7c,0x7c,0x6b,0x4c,0x2d,0x0f,0x00,0x0d,0x16,0x2c,0x43,0x59,0x70,0x75,0x5e,0x47,0x31,0x1a,0x03,0x00,
+	0x07,0x0b,0x21,0x38,0x4e,0x65,0x7b,0x69,0x53,0x3c,0x25,0x0e,0x00,0x08,0x03,0x1e,0x36,0x50,0x60,0x65,0x74,0x57,0x61,0x53,0x73,0x70,0x5c,0x47,0x2b,0x0d,0x00,0x0b,
+	0x13,0x2f,0x47,0x56,0x74,0x67,0x50,0x4b,0x5e,0x78,0x5f,0x4c,0x37,0x1c,0x00,0x0e,0x0d,0x24,0x3a,0x51,0x67,0x7d,0x67,0x50,0x39,0x22,0x0b,0x00,0x09,0x03,0x20,0x3a,
+	0x4e,0x64,0x76,0x59,0x49,0x51,0x6c,0x70,0x52,0x44,0x2b,0x0f,0x04,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x87,0x74,0x54,0x34,0x14,0x00,0x0f,0x19,0x37,0x54,0x66,0x70,
+	0x66,0x61,0x5a,0x66,0x73,0x65,0x5c,0x42,0x23,0x16,0x0a,0x00,0x06,0x08,0x22,0x3a,0x54,0x60,0x6a,0x70,0x5a,0x60,0x58,0x77,0x6d,0x59,0x42,0x26,0x08,0x00,0x07,0x14,
+	0x27,0x31,0x3f,0x5f,0x78,0x78,0x78,0x92,0xb2,0xd2,0xf2,0x00,0x04,0x05,0x22,0x3d,0x50,0x67,0x74,0x56,0x47,0x52,0x6f,0x6d,0x52,0x42,0x29,0x0c,0x00,0x0a,0x12,0x2b,
+	0x45,0x5b,0x5c,0x74,0x65,0x60,0x5a,0x64,0x79,0x65,0x51,0x38,0x1b,0x00,0x05,0x05,0x22,0x3c,0x4f,0x67,0x75,0x57,0x47,0x52,0x6e,0x6e,0x52,0x42,0x29,0x0c,0x00,0x02,
+	0x05,0x25,0x45,0x65,0x85,0x87,0x87,0x98,0xb8,0xcd,0xd5,0xe6,0xfd,0xff,0xff,0x00,0x0a,0x16,0x34,0x53,0x72,0x91,0x87,0x69,0x4b,0x2c,0x0e,0x00,0x08,0x04,0x0c,0x22,
+	0x39,0x4f,0x65,0x7c,0x92,0x7f,0x68,0x52,0x3b,0x24,0x0d,0x04,0x00,0x0a,0x01,0x18,0x2e,0x45,0x5b,0x72,0x88,0x8a,0x73,0x5c,0x45,0x2e,0x17,0x00,0x09,0x06,0x25,0x44,
+	0x62,0x81,0x97,0x78,0x5a,0x3c,0x1d,0x00,0x02,0x0a,0x29,0x47,0x65,0x84,0x95,0x76,0x57,0x38,0x19,0x00,0x08,0x04,0x22,0x41,0x60,0x7f,0x99,0x7b,0x5c,0x3e,0x20,0x01,
+	0x00,0x07,0x18,0x36,0x54,0x73,0x91,0x87,0x68,0x49,0x2b,0x0c,0x00,0x10,0x0d,0x2d,0x4c,0x68,0x69,0x4d,0x2f,0x0f,0x23,0x37,0x44,0x41,0x30,0x18,0x00,0x07,0x0a,0x29,
+	0x46,0x5e,0x64,0x75,0x7c,0x6a,0x7d,0x5d,0x3d,0x1d,0x00,0x0c,0x0c,0x2b,0x49,0x67,0x86,0x92,0x74,0x55,0x36,0x17,0x00,0x0c,0x16,0x2d,0x43,0x59,0x70,0x86,0x8c,0x75,
+	0x5e,0x47,0x30,0x19,0x02,0x00,0x05,0x0b,0x22,0x38,0x4f,0x65,0x7c,0x92,0x80,0x69,0x52,0x3b,0x24,0x0d,0x00,0x07,0x10,0x2e,0x4b,0x60,0x7d,0x62,0x67,0x64,0x7a,0x73,
+	0x62,0x76,0x8d,0xad,0xcd,0xed,0xff,0xff,0xff,0xff,0xff,0x00,0x06,0x1c,0x3b,0x5a,0x73,0x65,0x6c,0x6a,0x62,0x72,0x67,0x71,0x64,0x45,0x26,0x06,0x00,0x0c,0x0e,0x24,
+	0x3b,0x51,0x68,0x7e,0x94,0x7d,0x66,0x4f,0x38,0x21,0x0a,0x00,0x07,0x01,0x15,0x2a,0x49,0x67,0x6f,0x66,0x73,0x5e,0x6e,0x68,0x64,0x71,0x56,0x37,0x27,0x23,0x16,0x02,
+	0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x1a,0x1b,0x12,0x01,0x00,0x0a,0x14,0x2a,0x3c,0x5b,0x78,0x62,0x6f,0x6e,0x63,0x78,0x61,0x76,0x66,0x47,
+	0x3a,0x35,0x24,0x0d,0x00,0x03,0x01,0x15,0x23,0x33,0x4f,0x62,0x7d,0x61,0x65,0x69,0x75,0x74,0x65,0x79,0x92,0xb2,0xd2,0xe0,0xf1,0xff,0xff,0x00,0x03,0x0c,0x28,0x41,
+	0x50,0x4d,0x5b,0x6d,0x6d,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x04,0x0d,0x2d,0x4c,0x6a,0x6c,0x65,0x73,0x5b,0x70,0x66,0x67,0x6f,0x53,0x34,0x14,0x00,0x09,0x02,0x21,0x3e,
+	0x58,0x6e,0x71,0x67,0x5d,0x76,0x69,0x6e,0x6d,0x81,0x9f,0xbe,0xde,0xfe,0xff,0xff,0xff,0x00,0x01,0x0d,0x2c,0x4c,0x69,0x6d,0x65,0x73,0x5b,0x6f,0x66,0x66,0x6f,0x54,
+	0x34,0x15,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x92,0x92,0x9e,0xb5,0xad,0xb9,0xd0,0xec,0xff,0xff,0x00,0x06,0x06,0x07,0x07,0x06,0x1e,0x3d,0x5c,0x7b,0x9a,0x7d,0x5f,
+	0x41,0x22,0x07,0x05,0x00,0x05,0x01,0x15,0x23,0x27,0x39,0x4f,0x66,0x7c,0x93,0x85,0x96,0x7f,0x68,0x51,0x3a,0x27,0x23,0x16,0x02,0x00,0x08,0x13,0x2e,0x45,0x5c,0x72,
+	0x89,0x8f,0x8e,0x89,0x72,0x5b,0x44,0x2d,0x11,0x00,0x08,0x0f,0x2e,0x4c,0x6b,0x8a,0x8d,0x6e,0x50,0x32,0x13,0x00,0x03,0x1f,0x3d,0x5b,0x7a,0x98,0x7e,0x60,0x41,0x22,
+	0x03,0x00,0x05,0x04,0x07,0x0c,0x2b,0x4a,0x69,0x87,0x8f,0x71,0x52,0x34,0x16,0x00,0x08,0x0e,0x2c,0x4a,0x69,0x87,0x90,0x71,0x52,0x33,0x15,0x07,0x06,0x00,0x0e,0x0e,
+	0x2d,0x4c,0x69,0x6a,0x4e,0x2f,0x26,0x3b,0x50,0x63,0x5d,0x44,0x26,0x07,0x00,0x06,0x0e,0x2e,0x4e,0x6e,0x71,0x73,0x62,0x75,0x61,0x52,0x36,0x19,0x00,0x0c,0x02,0x21,
+	0x3f,0x5d,0x7c,0x9a,0x7c,0x5e,0x3f,0x20,0x01,0x00,0x09,0x01,0x15,0x2c,0x43,0x5a,0x70,0x87,0x91,0x8c,0x8b,0x74,0x5d,0x46,0x2f,0x1b,0x09,0x00,0x03,0x03,0x1f,0x39,
+	0x4f,0x66,0x7c,0x92,0x85,0x96,0x7f,0x68,0x51,0x3a,0x21,0x05,0x00,0x06,0x14,0x34,0x54,0x74,0x8a,0x97,0x8b,0x8a,0x9c,0x94,0xa0,0xa2,0xa0,0xb6,0xd2,0xf1,0xff,0xff,
+	0xff,0xff,0xff,0x00,0x06,0x1a,0x3a,0x57,0x6c,0x6b,0x67,0x66,0x5e,0x6b,0x6d,0x6b,0x60,0x43,0x24,0x05,0x00,0x0b,0x06,0x22,0x3b,0x51,0x68,0x7e,0x95,0x84,0x94,0x7d,
+	0x66,0x4f,0x38,0x1e,0x02,0x00,0x06,0x15,0x2e,0x41,0x47,0x63,0x69,0x6c,0x6c,0x5b,0x68,0x66,0x69,0x6b,0x54,0x47,0x47,0x42,0x2f,0x16,0x00,0x02,0x05,0x25,0x45,0x65,
+	0x85,0x94,0x74,0x54,0x34,0x2b,0x39,0x3b,0x2e,0x19,0x00,0x09,0x07,0x25,0x41,0x56,0x5a,0x5a,0x76,0x69,0x56,0x50,0x5e,0x7e,0x61,0x59,0x5a,0x5a,0x51,0x39,0x1d,0x00,
+	0x03,0x15,0x2e,0x41,0x47,0x59,0x78,0x8e,0x93,0x90,0x88,0xa1,0x94,0xa3,0xa0,0xa2,0xb8,0xb9,0xc4,0xdb,0xf5,0xff,0x00,0x03,0x14,0x34,0x53,0x6e,0x66,0x71,0x72,0x72,
+	0x72,0x69,0x4b,0x2c,0x0c,0x00,0x04,0x0c,0x2c,0x4a,0x65,0x67,0x6b,0x6c,0x58,0x6a,0x68,0x67,0x69,0x51,0x33,0x13,0x00,0x09,0x05,0x25,0x45,0x65,0x81,0x95,0x89,0x95,
+	0x8f,0x9c,0x97,0xab,0x9d,0xaa,0xc5,0xe3,0xff,0xff,0xff,0xff,0x00,0x01,0x0c,0x2b,0x4a,0x65,0x68,0x6c,0x6c,0x58,0x6a,0x68,0x67,0x6a,0x51,0x33,0x14,0x00,0x02,0x04,
+	0x24,0x43,0x62,0x72,0x72,0x72,0x71,0x60,0x71,0x5a,0x3c,0x1c,0x00,0x06,0x07,0x1a,0x25,0x27,0x27,0x26,0x27,0x46,0x65,0x83,0x92,0x73,0x55,0x37,0x27,0x27,0x25,0x19,
+	0x05,0x00,0x03,0x15,0x2e,0x41,0x47,0x4b,0x66,0x7d,0x92,0x84,0x6e,0x82,0x92,0x7e,0x67,0x4c,0x47,0x42,0x2f,0x16,0x00,0x08,0x1e,0x3d,0x5b,0x72,0x89,0x8e,0x78,0x77,
+	0x8e,0x88,0x71,0x59,0x3b,0x1c,0x00,0x08,0x17,0x36,0x55,0x74,0x93,0x83,0x64,0x46,0x28,0x09,0x00,0x03,0x14,0x33,0x51,0x70,0x8e,0x87,0x68,0x4a,0x2b,0x0c,0x00,0x03,
+	0x01,0x15,0x23,0x27,0x27,0x34,0x53,0x71,0x90,0x85,0x67,0x48,0x2a,0x26,0x1b,0x09,0x00,0x04,0x01,0x15,0x23,0x27,0x40,0x5f,0x7d,0x98,0x7a,0x5b,0x3c,0x27,0x27,0x26,
+	0x1b,0x09,0x00,0x0c,0x05,0x22,0x3c,0x4d,0x4e,0x3d,0x23,0x3a,0x53,0x68,0x7d,0x96,0xb5,0xd5,0xf5,0x00,0x06,0x08,0x27,0x43,0x5b,0x68,0x79,0x66,0x6d,0x52,0x38,0x24,
+	0x0b,0x00,0x0d,0x17,0x35,0x53,0x72,0x90,0x85,0x66,0x47,0x29,0x0a,0x00,0x09,0x15,0x2e,0x41,0x58,0x71,0x87,0x90,0x7a,0x76,0x8c,0x8a,0x73,0x5b,0x45,0x36,0x1f,0x03,
+	0x00,0x02,0x0c,0x2b,0x4a,0x66,0x7c,0x92,0x85,0x6e,0x81,0x92,0x7e,0x67,0x4c,0x2d,0x0e,0x00,0x06,0x0e,0x2c,0x48,0x5d,0x71,0x71,0x57,0x68,0x5f,0x71,0x6d,0x4e,0x40,
+	0x33,0x1d,0x02,0x00,0x0b,0x10,0x2b,0x41,0x54,0x6f,0x64,0x4a,0x61,0x5f,0x72,0x5d,0x46,0x33,0x19,0x00,0x0c,0x0f,0x2f,0x4d,0x68,0x7f,0x92,0x82,0x6d,0x84,0x92,0x7c,
+	0x65,0x49,0x2a,0x0b,0x00,0x05,0x02,0x22,0x40,0x5b,0x67,0x67,0x64,0x70,0x57,0x43,0x4b,0x69,0x6c,0x50,0x63,0x67,0x67,0x5c,0x41,0x23,0x04,0x00,0x01,0x05,0x25,0x45,
+	0x65,0x85,0x94,0x74,0x54,0x34,0x42,0x57,0x59,0x46,0x2a,0x0c,0x00,0x08,0x0d,0x2d,0x4d,0x6d,0x7a,0x7a,0x6b,0x57,0x3f,0x37,0x51,0x5e,0x55,0x74,0x7a,0x7a,0x63,0x44,
+	0x24,0x04,0x00,0x01,0x02,0x22,0x40,0x5b,0x67,0x67,0x66,0x75,0x6c,0x58,0x68,0x58,0x75,0x68,0x58,0x67,0x67,0x66,0x51,0x34,0x15,0x00,0x04,0x15,0x35,0x55,0x75,0x95,
+	0x84,0x64,0x52,0x52,0x4e,0x3c,0x21,0x04,0x00,0x04,0x03,0x1f,0x38,0x49,0x64,0x6f,0x5c,0x66,0x66,0x6b,0x6a,0x4d,0x3d,0x25,0x09,0x00,0x09,0x01,0x1f,0x3c,0x54,0x68,
+	0x7c,0x61,0x66,0x66,0x66,0x7a,0x5c,0x42,0x3b,0x27,0x0e,0x00,0x05,0x02,0x1f,0x38,0x49,0x64,0x6f,0x66,0x67,0x67,0x6b,0x6a,0x4d,0x3d,0x25,0x0a,0x00,0x03,0x1a,0x35,
+	0x4b,0x52,0x52,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x06,0x1c,0x34,0x44,0x47,0x47,0x45,0x37,0x4f,0x6d,0x8c,0x88,0x69,0x4b,0x46,0x47,0x47,0x43,0x33,0x1a,0x00,
+	0x02,0x02,0x22,0x40,0x5b,0x67,0x67,0x69,0x72,0x72,0x6d,0x57,0x6b,0x72,0x72,0x6a,0x67,0x67,0x5c,0x41,0x23,0x04,0x00,0x07,0x1e,0x3e,0x5c,0x72,0x72,0x72,0x61,0x61,
+	0x72,0x72,0x72,0x5b,0x3c,0x1d,0x00,0x08,0x1f,0x3f,0x5e,0x7d,0x8e,0x79,0x5a,0x3c,0x1d,0x00,0x04,0x0a,0x29,0x47,0x66,0x84,0x8e,0x71,0x52,0x33,0x14,0x00,0x03,0x15,
+	0x2e,0x41,0x47,0x47,0x47,0x5b,0x7a,0x8e,0x7b,0x5d,0x47,0x47,0x45,0x36,0x1f,0x03,0x00,0x03,0x15,0x2e,0x41,0x47,0x47,0x55,0x73,0x8e,0x82,0x63,0x47,0x47,0x47,0x45,
+	0x36,0x1f,0x03,0x00,0x0c,0x0e,0x22,0x2f,0x2f,0x23,0x21,0x41,0x61,0x81,0x95,0xaa,0xc1,0xdd,0xfb,0x00,0x06,0x02,0x22,0x42,0x61,0x76,0x62,0x66,0x70,0x64,0x46,0x27,
+	0x07,0x00,0x0d,0x0c,0x2b,0x49,0x68,0x86,0x8e,0x6f,0x50,0x31,0x12,0x00,0x08,0x02,0x22,0x40,0x5b,0x67,0x71,0x72,0x72,0x67,0x67,0x72,0x72,0x72,0x67,0x63,0x4b,0x2d,
+	0x0e,0x00,0x02,0x0d,0x2c,0x4b,0x69,0x72,0x72,0x6e,0x67,0x6b,0x72,0x72,0x6a,0x4e,0x2e,0x0f,0x00,0x06,0x01,0x1b,0x30,0x44,0x58,0x59,0x51,0x70,0x6d,0x58,0x57,0x42,
+	0x26,0x17,0x06,0x00,0x0d,0x14,0x2a,0x42,0x51,0x4c,0x51,0x70,0x6d,0x52,0x48,0x31,0x1a,0x06,0x00,0x0c,0x10,0x30,0x4f,0x6b,0x72,0x72,0x6b,0x66,0x6d,0x72,0x72,0x68,
+	0x4a,0x2b,0x0b,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x87,0x73,0x53,0x44,0x2c,0x3c,0x4e,0x50,0x51,0x71,0x87,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,
+	0x85,0x94,0x74,0x54,0x34,0x4d,0x6d,0x72,0x52,0x32,0x12,0x00,0x08,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x23,0x37,0x3e,0x55,0x75,0x95,0x84,0x64,0x44,0x24,
+	0x04,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x87,0x7d,0x62,0x57,0x41,0x48,0x48,0x5a,0x54,0x61,0x81,0x87,0x78,0x58,0x38,0x18,0x00,0x04,0x15,0x35,0x55,0x75,0x95,0x84,
+	0x64,0x44,0x32,0x30,0x23,0x0e,0x00,0x06,0x0b,0x1e,0x38,0x4c,0x51,0x6a,0x86,0x86,0x84,0x66,0x48,0x29,0x10,0x00,0x0b,0x0f,0x27,0x3b,0x4f,0x5c,0x6a,0x86,0x86,0x84,
+	0x66,0x4d,0x33,0x1d,0x0f,0x00,0x07,0x0a,0x1e,0x37,0x4c,0x58,0x78,0x87,0x81,0x61,0x4f,0x3d,0x23,0x10,0x00,0x04,0x08,0x1e,0x2e,0x32,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,
+	0x3d,0x1d,0x00,0x05,0x0b,0x2a,0x48,0x61,0x67,0x67,0x64,0x4c,0x4e,0x69,0x6e,0x6e,0x5e,0x4e,0x65,0x67,0x67,0x60,0x46,0x28,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,
+	0x87,0x73,0x53,0x52,0x50,0x40,0x4f,0x52,0x52,0x71,0x87,0x86,0x66,0x46,0x26,0x06,0x00,0x07,0x15,0x31,0x47,0x52,0x52,0x52,0x70,0x6d,0x52,0x52,0x52,0x46,0x2f,0x13,
+	0x00,0x07,0x02,0x22,0x40,0x5c,0x6e,0x6e,0x6a,0x50,0x32,0x13,0x00,0x05,0x1f,0x3d,0x5b,0x6e,0x6e,0x6b,0x51,0x34,0x15,0x00,0x02,0x02,0x22,0x40,0x5b,0x67,0x67,0x67,
+	0x67,0x6e,0x6e,0x6c,0x67,0x67,0x67,0x63,0x4b,0x2d,0x0e,0x00,0x02,0x02,0x22,0x40,0x5b,0x67,0x67,0x67,0x67,0x6e,0x6e,0x67,0x67,0x67,0x67,0x63,0x4b,0x2d,0x0e,0x00,
+	0x05,0x08,0x08,0x08,0x08,0x00,0x04,0x06,0x0f,0x0f,0x07,0x1c,0x3a,0x54,0x60,0x51,0x3d,0x28,0x11,0x00,0x08,0x1a,0x36,0x4d,0x5c,0x66,0x79,0x6b,0x61,0x45,0x26,0x06,
+	0x00,0x0d,0x05,0x23,0x41,0x5d,0x6e,0x6e,0x6a,0x58,0x3d,0x1f,0x01,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x71,0x51,0x31,
+	0x11,0x00,0x02,0x04,0x21,0x3c,0x4e,0x52,0x5b,0x7b,0x87,0x7e,0x5e,0x52,0x4f,0x3d,0x23,0x06,0x00,0x07,0x03,0x17,0x2b,0x39,0x3a,0x4c,0x65,0x63,0x49,0x39,0x2b,0x15,
+	0x00,0x10,0x15,0x28,0x31,0x2e,0x4c,0x65,0x63,0x49,0x2c,0x1b,0x04,0x00,0x0d,0x08,0x24,0x3e,0x4f,0x52,0x6a,0x86,0x86,0x84,0x66,0x52,0x4e,0x3b,0x20,0x03,0x00,0x05,
+	0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x17,0x23,0x30,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,
+	0x46,0x5e,0x60,0x4a,0x2d,0x0e,0x00,0x08,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x19,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x01,0x05,0x25,
+	0x45,0x65,0x85,0xa5,0x8e,0x73,0x57,0x3c,0x28,0x30,0x3a,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x04,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x10,0x07,
+	0x00,0x08,0x0b,0x20,0x38,0x57,0x75,0x93,0xa0,0x8e,0x70,0x52,0x34,0x16,0x00,0x0c,0x0e,0x22,0x38,0x57,0x75,0x93,0xa0,0x8e,0x70,0x52,0x34,0x16,0x00,0x09,0x0a,0x20,
+	0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x24,0x10,0x00,0x06,0x03,0x0f,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x05,0x0d,0x2d,0x4d,0x6c,0x87,0x87,0x77,0x5a,
+	0x3e,0x4c,0x4e,0x4e,0x47,0x5c,0x79,0x87,0x87,0x6a,0x4b,0x2b,0x0b,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x31,0x26,0x30,0x32,0x51,0x71,0x91,0x86,
+	0x66,0x46,0x26,0x06,0x00,0x07,0x04,0x1b,0x2b,0x32,0x32,0x4c,0x65,0x63,0x49,0x32,0x32,0x2b,0x19,0x02,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x87,0x74,0x54,0x34,0x14,
+	0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x87,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x71,0x51,0x31,0x11,
+	0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x71,0x51,0x31,0x11,0x00,0x03,0x08,0x1c,0x27,0x28,0x28,0x27,0x1b,0x08,0x00,0x06,
+	0x0e,0x26,0x39,0x40,0x37,0x24,0x10,0x00,0x09,0x10,0x2e,0x4c,0x6a,0x86,0x86,0x84,0x66,0x48,0x29,0x0b,0x00,0x0d,0x10,0x2e,0x4c,0x6a,0x86,0x86,0x84,0x66,0x48,0x29,
+	0x0b,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x9b,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x91,0x71,0x51,0x31,0x11,0x00,0x03,0x0e,0x23,0x30,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,
+	0x3e,0x30,0x24,0x10,0x00,0x0a,0x10,0x1a,0x31,0x50,0x6e,0x6b,0x4d,0x2d,0x0f,0x00,0x12,0x0a,0x11,0x31,0x50,0x6e,0x6b,0x4d,0x2d,0x0d,0x00,0x0f,0x11,0x25,0x38,0x57,
+	0x75,0x93,0xa0,0x8e,0x70,0x52,0x34,0x22,0x0d,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x07,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,
+	0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x4d,0x6d,0x72,0x52,0x32,0x12,0x00,0x08,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x15,0x35,0x55,
+	0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0xa5,0x9f,0x84,0x68,0x4d,0x32,0x17,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x04,
+	0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x09,0x07,0x25,0x43,0x61,0x7f,0x9c,0x82,0x99,0x7b,0x5d,0x3f,0x20,0x02,0x00,0x0b,0x07,0x25,0x43,0x61,0x7f,
+	0x9c,0x82,0x99,0x7b,0x5d,0x3f,0x20,0x02,0x00,0x09,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x08,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,
+	0x05,0x07,0x24,0x41,0x5e,0x7b,0x97,0x85,0x68,0x4c,0x2f,0x2e,0x31,0x4e,0x6a,0x87,0x95,0x79,0x5c,0x3f,0x22,0x05,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,
+	0x33,0x13,0x09,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x09,0x0d,0x12,0x31,0x50,0x6e,0x6b,0x4d,0x2d,0x12,0x0d,0x00,0x09,0x05,0x25,0x45,0x65,0x85,
+	0x94,0x74,0x54,0x34,0x14,0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x9b,0x92,0x92,0x92,0x92,0x92,0x92,0x92,
+	0x91,0x71,0x51,0x31,0x11,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x9b,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x91,0x71,0x51,0x31,0x11,0x00,0x02,0x01,0x1d,0x36,0x46,0x47,
+	0x48,0x46,0x35,0x1c,0x00,0x07,0x0d,0x1b,0x20,0x1a,0x0b,0x00,0x0a,0x1a,0x38,0x57,0x75,0x93,0xa0,0x8e,0x70,0x52,0x34,0x16,0x00,0x0d,0x1a,0x38,0x57,0x75,0x93,0xa0,
+	0x8e,0x70,0x52,0x34,0x16,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x6c,0x4f,0x30,0x10,0x00,0x04,0x07,0x1b,0x3b,0x5b,0x7b,
+	0x9b,0x7e,0x5e,0x3e,0x1e,0x08,0x00,0x0c,0x09,0x27,0x41,0x53,0x52,0x3e,0x24,0x06,0x00,0x13,0x09,0x27,0x41,0x53,0x52,0x3e,0x24,0x06,0x00,0x0f,0x07,0x25,0x43,0x61,
+	0x7f,0x9c,0x82,0x99,0x7b,0x5d,0x3f,0x20,0x02,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,
+	0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x96,0x8e,0xac,0xcb,0xbc,0xa6,0xa4,0xb8,0xd4,0xf2,0xfb,0xfb,0xfb,0xfc,0xff,0xff,0xff,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,
+	0x8c,0x6c,0x4c,0x2c,0x0c,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x96,0x8b,0x95,0x79,0x5e,0x43,0x28,0x21,0x41,0x61,
+	0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x0f,0x26,0x37,0x4f,0x67,0x60,0x67,0x5b,0x3f,0x21,0x02,0x00,0x09,0x11,0x2f,0x4e,0x6c,0x8a,0x91,0x77,0x95,0x85,0x67,0x49,
+	0x2b,0x0d,0x00,0x0b,0x11,0x2f,0x4e,0x6c,0x8a,0x91,0x77,0x95,0x85,0x67,0x49,0x2b,0x0d,0x00,0x09,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x08,0x19,
+	0x38,0x54,0x67,0x5a,0x69,0x56,0x3a,0x2b,0x15,0x00,0x05,0x16,0x33,0x50,0x6d,0x89,0x93,0x76,0x5a,0x3d,0x22,0x3f,0x5c,0x78,0x95,0x87,0x6b,0x4e,0x31,0x14,0x00,0x02,
+	0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x0a,0x09,0x27,0x41,0x53,0x52,0x3e,0x24,0x06,
+	0x00,0x0a,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,
+	0x74,0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x6c,0x4f,0x30,0x10,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x6c,0x4f,0x30,0x10,
+	0x00,0x02,0x0b,0x2a,0x49,0x63,0x65,0x66,0x62,0x48,0x2a,0x0a,0x00,0x14,0x07,0x25,0x43,0x61,0x7f,0x9c,0x82,0x99,0x7b,0x5d,0x3f,0x20,0x02,0x00,0x0b,0x07,0x25,0x43,
+	0x61,0x7f,0x9c,0x82,0x99,0x7b,0x5d,0x3f,0x20,0x02,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x52,0x52,0x52,0x52,0x52,0x52,0x50,0x3e,0x25,0x08,0x00,0x05,
+	0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x0e,0x14,0x28,0x34,0x33,0x26,0x11,0x00,0x15,0x14,0x28,0x34,0x33,0x26,0x11,0x00,0x10,0x11,0x2f,0x4e,0x6c,0x8a,
+	0x91,0x77,0x95,0x85,0x67,0x49,0x2b,0x0d,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,
+	0x00,0x01,0x05,0x25,0x45,0x65,0x85,0xa5,0xaa,0xbb,0xd5,0xd2,0xc4,0xc2,0xcf,0xe5,0xe5,0xdb,0xdc,0xdb,0xdd,0xe9,0xfd,0xff,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,
+	0x6c,0x4c,0x2c,0x0c,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x7a,0x96,0x8a,0x6f,0x54,0x39,0x21,0x41,0x61,0x81,
+	0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x1e,0x3b,0x53,0x5d,0x74,0x5e,0x47,0x41,0x2e,0x14,0x00,0x0a,0x1c,0x3a,0x58,0x76,0x95,0x86,0x6d,0x8b,0x90,0x72,0x54,0x36,0x17,
+	0x00,0x0b,0x1c,0x3a,0x58,0x76,0x95,0x86,0x6d,0x8b,0x90,0x72,0x54,0x36,0x17,0x00,0x09,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x08,0x0d,0x28,0x3d,
+	0x47,0x56,0x72,0x65,0x58,0x42,0x26,0x08,0x00,0x04,0x08,0x25,0x42,0x5f,0x7b,0x98,0x85,0x68,0x4b,0x30,0x4d,0x6a,0x86,0x96,0x79,0x5d,0x40,0x23,0x06,0x00,0x02,0x05,
+	0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x0b,0x14,0x28,0x34,0x33,0x26,0x11,0x00,0x0b,0x05,
+	0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x52,
+	0x52,0x52,0x52,0x52,0x52,0x50,0x3e,0x25,0x08,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x52,0x52,0x52,0x52,0x52,0x52,0x50,0x3e,0x25,0x08,0x00,0x02,0x0d,
+	0x2d,0x4c,0x6b,0x6f,0x6f,0x6a,0x4c,0x2c,0x0c,0x00,0x14,0x11,0x2f,0x4e,0x6c,0x8a,0x91,0x77,0x95,0x85,0x67,0x49,0x2b,0x0d,0x00,0x0b,0x11,0x2f,0x4e,0x6c,0x8a,0x91,
+	0x77,0x95,0x85,0x67,0x49,0x2b,0x0d,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x32,0x32,0x32,0x32,0x32,0x31,0x25,0x11,0x00,0x06,0x1b,0x3b,0x5b,0x7b,
+	0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x07,0x06,0x07,0x07,0x06,0x00,0x04,0x0c,0x15,0x14,0x0a,0x00,0x04,0x06,0x06,0x07,0x06,0x00,0x07,0x06,0x07,0x07,0x06,0x00,0x04,0x0c,
+	0x15,0x14,0x0a,0x00,0x04,0x06,0x06,0x07,0x06,0x00,0x09,0x1c,0x3a,0x58,0x76,0x95,0x86,0x6d,0x8b,0x90,0x72,0x54,0x36,0x17,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x93,
+	0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0xa5,0xbb,0xc8,0xde,0xed,0xe3,0xe2,0xeb,0xe2,
+	0xca,0xbc,0xbd,0xbb,0xbe,0xd0,0xe8,0xff,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x01,
+	0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x85,0x9b,0x80,0x65,0x4a,0x2f,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x79,0x6b,0x69,0x61,0x45,
+	0x26,0x07,0x00,0x09,0x08,0x26,0x45,0x63,0x81,0x9a,0x7c,0x62,0x80,0x9b,0x7c,0x5e,0x40,0x22,0x04,0x00,0x09,0x08,0x26,0x45,0x63,0x81,0x9a,0x7c,0x62,0x80,0x9b,0x7c,
+	0x5e,0x40,0x22,0x04,0x00,0x08,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x09,0x1e,0x3d,0x5b,0x6b,0x69,0x72,0x6d,0x4d,0x2d,0x0d,0x00,0x05,0x17,0x34,
+	0x51,0x6d,0x8a,0x93,0x76,0x59,0x3e,0x5b,0x78,0x95,0x88,0x6b,0x4f,0x32,0x15,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,
+	0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x04,0x06,0x07,0x07,0x06,0x00,0x04,0x0c,0x15,0x14,0x0a,0x00,0x04,0x06,0x06,0x07,0x06,0x00,0x04,0x05,0x25,0x45,0x65,0x85,
+	0x94,0x74,0x54,0x34,0x14,0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x32,0x32,0x32,0x32,
+	0x32,0x31,0x25,0x11,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x32,0x32,0x32,0x32,0x32,0x31,0x25,0x11,0x00,0x03,0x06,0x23,0x3e,0x52,0x54,0x54,0x52,
+	0x3e,0x23,0x05,0x00,0x06,0x04,0x10,0x15,0x0f,0x02,0x00,0x09,0x1c,0x3a,0x58,0x76,0x95,0x86,0x6d,0x8b,0x90,0x72,0x54,0x36,0x17,0x00,0x0b,0x1c,0x3a,0x58,0x76,0x95,
+	0x86,0x6d,0x8b,0x90,0x72,0x54,0x36,0x17,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x26,0x26,0x26,0x20,0x12,0x11,0x09,0x00,0x07,0x1b,0x3b,0x5b,0x7b,
+	0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x05,0x07,0x1a,0x26,0x26,0x27,0x25,0x19,0x06,0x00,0x08,0x08,0x1b,0x26,0x26,0x27,0x25,0x19,0x05,0x00,0x03,0x07,0x1a,0x26,0x26,0x27,
+	0x25,0x19,0x06,0x00,0x08,0x08,0x1b,0x26,0x26,0x27,0x25,0x19,0x05,0x00,0x06,0x08,0x26,0x45,0x63,0x81,0x9a,0x7c,0x62,0x80,0x9b,0x7c,0x5e,0x40,0x22,0x04,0x00,0x05,
+	0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0xa2,0x9c,0xb2,
+	0xcf,0xed,0xff,0xff,0xf1,0xd3,0xb5,0x9e,0x9f,0x9c,0xa2,0xbc,0xda,0xf9,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x15,0x35,0x55,0x75,0x95,0x84,
+	0x64,0x44,0x24,0x04,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x74,0x8f,0x91,0x76,0x5b,0x40,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,
+	0x65,0x85,0x8e,0x8e,0x99,0xb8,0xd7,0xf7,0xff,0xff,0xff,0xff,0x00,0x05,0x13,0x31,0x4f,0x6d,0x8c,0x90,0x71,0x58,0x76,0x94,0x87,0x69,0x4b,0x2d,0x0e,0x00,0x09,0x13,
+	0x31,0x4f,0x6d,0x8c,0x90,0x71,0x58,0x76,0x94,0x87,0x69,0x4b,0x2d,0x0e,0x00,0x08,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x09,0x20,0x3f,0x5e,0x74,
+	0x76,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x05,0x09,0x26,0x42,0x5f,0x7c,0x99,0x84,0x67,0x4c,0x69,0x86,0x97,0x7a,0x5d,0x41,0x24,0x07,0x00,0x03,0x05,0x25,0x45,0x65,0x85,
+	0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x02,0x07,0x1a,0x26,0x26,0x27,0x25,0x19,0x06,0x00,0x08,0x08,0x1b,0x26,
+	0x26,0x27,0x25,0x19,0x05,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,
+	0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x26,0x26,0x26,0x20,0x12,0x11,0x09,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x26,0x26,0x26,0x20,0x12,0x11,
+	0x09,0x00,0x05,0x11,0x26,0x34,0x35,0x35,0x33,0x26,0x11,0x00,0x06,0x07,0x1e,0x2f,0x35,0x2d,0x1c,0x07,0x00,0x07,0x08,0x26,0x45,0x63,0x81,0x9a,0x7c,0x62,0x80,0x9b,
+	0x7c,0x5e,0x40,0x22,0x04,0x00,0x09,0x08,0x26,0x45,0x63,0x81,0x9a,0x7c,0x62,0x80,0x9b,0x7c,0x5e,0x40,0x22,0x04,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,
+	0x46,0x46,0x46,0x46,0x3d,0x28,0x0e,0x00,0x08,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x05,0x1c,0x34,0x45,0x46,0x46,0x44,0x33,0x1b,0x00,0x07,0x02,0x1d,
+	0x35,0x45,0x45,0x46,0x44,0x33,0x1a,0x00,0x03,0x1c,0x34,0x45,0x46,0x46,0x44,0x33,0x1b,0x00,0x07,0x02,0x1d,0x35,0x45,0x45,0x46,0x44,0x33,0x1a,0x00,0x06,0x13,0x31,
+	0x4f,0x6d,0x8c,0x90,0x71,0x58,0x76,0x94,0x87,0x69,0x4b,0x2d,0x0e,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,
+	0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x96,0x8b,0xaa,0xca,0xea,0xff,0xff,0xee,0xce,0xaf,0x8f,0x92,0x8a,0x97,0xb6,0xd6,0xf6,0x00,0x01,0x0d,
+	0x2d,0x4d,0x6d,0x71,0x71,0x6a,0x4b,0x2b,0x0b,0x15,0x35,0x54,0x73,0x69,0x7b,0x9b,0xbb,0xdb,0xfb,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x63,0x7e,0x99,0x87,
+	0x6c,0x51,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x98,0x89,0x96,0xb6,0xd6,0xf6,0xff,0xff,0xff,0xff,0x00,0x05,0x1d,0x3c,0x5a,
+	0x78,0x96,0x85,0x67,0x4d,0x6b,0x89,0x92,0x73,0x55,0x37,0x19,0x00,0x09,0x1d,0x3c,0x5a,0x78,0x96,0x85,0x67,0x4d,0x6b,0x89,0x92,0x73,0x55,0x37,0x19,0x00,0x08,0x18,
+	0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x08,0x01,0x21,0x41,0x61,0x7e,0x69,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x06,0x18,0x34,0x51,0x6e,0x8b,0x92,0x75,0x5a,
+	0x77,0x94,0x89,0x6c,0x4f,0x33,0x16,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,
+	0x02,0x1c,0x34,0x45,0x46,0x46,0x44,0x33,0x1b,0x00,0x07,0x02,0x1d,0x35,0x45,0x45,0x46,0x44,0x33,0x1a,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,
+	0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x46,0x46,0x46,0x46,0x3d,0x28,0x0e,0x00,0x05,0x05,
+	0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x46,0x46,0x46,0x46,0x3d,0x28,0x0e,0x00,0x07,0x0b,0x14,0x15,0x15,0x14,0x0a,0x00,0x04,0x04,0x04,0x00,0x01,0x18,0x34,0x4b,0x55,
+	0x49,0x34,0x20,0x0a,0x00,0x06,0x13,0x31,0x4f,0x6d,0x8c,0x90,0x71,0x58,0x76,0x94,0x87,0x69,0x4b,0x2d,0x0e,0x00,0x09,0x13,0x31,0x4f,0x6d,0x8c,0x90,0x71,0x58,0x76,
+	0x94,0x87,0x69,0x4b,0x2d,0x0e,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x66,0x66,0x66,0x66,0x66,0x55,0x39,0x1b,0x00,0x08,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,
+	0x3e,0x1e,0x00,0x04,0x0b,0x2a,0x48,0x61,0x64,0x65,0x60,0x46,0x28,0x09,0x00,0x06,0x0d,0x2c,0x49,0x62,0x63,0x65,0x60,0x46,0x27,0x08,0x00,0x01,0x0b,0x2a,0x48,0x61,
+	0x64,0x65,0x60,0x46,0x28,0x09,0x00,0x06,0x0d,0x2c,0x49,0x62,0x63,0x65,0x60,0x46,0x27,0x08,0x00,0x05,0x1d,0x3c,0x5a,0x78,0x96,0x85,0x67,0x4d,0x6b,0x89,0x92,0x73,
+	0x55,0x37,0x19,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,
+	0x65,0x85,0xa5,0xa6,0xb8,0xd3,0xf0,0xf9,0xf8,0xf4,0xd7,0xbb,0xa8,0xa9,0xa6,0xab,0xc1,0xde,0xfc,0x00,0x01,0x08,0x26,0x43,0x59,0x5a,0x56,0x53,0x3e,0x23,0x27,0x25,
+	0x2b,0x46,0x57,0x5b,0x7b,0x9b,0xbb,0xdb,0xfb,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x6d,0x88,0x98,0x7d,0x62,0x46,0x61,0x81,0x98,0x78,0x58,0x38,0x18,
+	0x00,0x02,0x04,0x23,0x42,0x60,0x6e,0x78,0x5f,0x57,0x3f,0x23,0x09,0x00,0x08,0x0a,0x28,0x46,0x64,0x83,0x99,0x7a,0x5c,0x57,0x61,0x7f,0x9c,0x7e,0x60,0x42,0x23,0x05,
+	0x00,0x07,0x0a,0x28,0x46,0x64,0x83,0x99,0x7a,0x5c,0x57,0x61,0x7f,0x9c,0x7e,0x60,0x42,0x23,0x05,0x00,0x07,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,
+	0x08,0x03,0x1b,0x38,0x52,0x5e,0x75,0x6a,0x66,0x4a,0x2b,0x0c,0x00,0x06,0x0a,0x26,0x43,0x60,0x7d,0x99,0x83,0x69,0x85,0x98,0x7b,0x5e,0x41,0x25,0x08,0x00,0x04,0x05,
+	0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x0b,0x2a,0x48,0x61,0x64,0x65,0x60,0x46,0x28,
+	0x09,0x00,0x06,0x0d,0x2c,0x49,0x62,0x63,0x65,0x60,0x46,0x27,0x08,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x04,0x01,0x21,0x41,0x61,0x81,
+	0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x66,0x66,0x66,0x66,0x66,0x55,0x39,0x1b,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x66,
+	0x66,0x66,0x66,0x66,0x55,0x39,0x1b,0x00,0x0f,0x06,0x19,0x24,0x24,0x1a,0x21,0x40,0x60,0x74,0x61,0x4d,0x37,0x1d,0x00,0x06,0x1d,0x3c,0x5a,0x78,0x96,0x85,0x67,0x4d,
+	0x6b,0x89,0x92,0x73,0x55,0x37,0x19,0x00,0x09,0x1d,0x3c,0x5a,0x78,0x96,0x85,0x67,0x4d,0x6b,0x89,0x92,0x73,0x55,0x37,0x19,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x95,
+	0x86,0x86,0x86,0x86,0x86,0x7e,0x5e,0x3e,0x1e,0x00,0x08,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x04,0x0d,0x2d,0x4d,0x6c,0x70,0x71,0x6a,0x4b,0x2b,0x0b,
+	0x00,0x06,0x0f,0x2f,0x4e,0x6d,0x6e,0x72,0x69,0x4a,0x2a,0x0b,0x00,0x01,0x0d,0x2d,0x4d,0x6c,0x70,0x71,0x6a,0x4b,0x2b,0x0b,0x00,0x06,0x0f,0x2f,0x4e,0x6d,0x6e,0x72,
+	0x69,0x4a,0x2a,0x0b,0x00,0x04,0x0a,0x28,0x46,0x64,0x83,0x99,0x7a,0x5c,0x57,0x61,0x7f,0x9c,0x7e,0x60,0x42,0x23,0x05,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x93,0x73,
+	0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0xa5,0xc3,0xcf,0xe4,0xe5,0xd9,0xd8,0xe2,0xe8,0xd3,
+	0xc6,0xc7,0xc5,0xc8,0xd8,0xee,0xff,0x00,0x02,0x16,0x2c,0x3b,0x3c,0x37,0x35,0x27,0x39,0x47,0x44,0x33,0x33,0x3f,0x5b,0x7b,0x9b,0xbb,0xdb,0xfb,0x00,0x01,0x05,0x25,
+	0x45,0x65,0x85,0x95,0x75,0x55,0x5c,0x77,0x92,0x8e,0x73,0x57,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x19,0x33,0x48,0x57,0x67,0x57,0x54,0x4c,0x36,0x1a,0x00,
+	0x08,0x14,0x33,0x51,0x6f,0x8d,0x8e,0x77,0x77,0x77,0x77,0x77,0x93,0x89,0x6a,0x4c,0x2e,0x10,0x00,0x07,0x14,0x33,0x51,0x6f,0x8d,0x8e,0x77,0x77,0x77,0x77,0x77,0x93,
+	0x89,0x6a,0x4c,0x2e,0x10,0x00,0x07,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x08,0x13,0x2f,0x47,0x54,0x50,0x65,0x5d,0x4b,0x39,0x20,0x03,0x00,0x07,
+	0x18,0x35,0x52,0x6f,0x8b,0x91,0x77,0x93,0x8a,0x6d,0x50,0x33,0x16,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,
+	0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x0d,0x2d,0x4d,0x6c,0x70,0x71,0x6a,0x4b,0x2b,0x0b,0x00,0x06,0x0f,0x2f,0x4e,0x6d,0x6e,0x72,0x69,0x4a,0x2a,0x0b,0x00,0x01,0x05,
+	0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x86,0x86,0x86,
+	0x86,0x86,0x7e,0x5e,0x3e,0x1e,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x95,0x86,0x86,0x86,0x86,0x86,0x7e,0x5e,0x3e,0x1e,0x00,0x0e,0x07,0x1c,0x33,0x43,0x43,0x35,0x1f,
+	0x3e,0x5b,0x71,0x85,0x9b,0xb8,0xd7,0xf6,0x00,0x04,0x0a,0x28,0x46,0x64,0x83,0x99,0x7a,0x5c,0x57,0x61,0x7f,0x9c,0x7e,0x60,0x42,0x23,0x05,0x00,0x07,0x0a,0x28,0x46,
+	0x64,0x83,0x99,0x7a,0x5c,0x57,0x61,0x7f,0x9c,0x7e,0x60,0x42,0x23,0x05,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x9a,0x90,0x90,0x90,0x90,0x90,0x7e,0x5e,0x3e,0x1e,0x00,
+	0x08,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x04,0x07,0x24,0x3f,0x54,0x55,0x56,0x53,0x3e,0x23,0x05,0x00,0x06,0x08,0x26,0x41,0x54,0x55,0x56,0x53,0x3d,
+	0x22,0x04,0x00,0x01,0x07,0x24,0x3f,0x54,0x55,0x56,0x53,0x3e,0x23,0x05,0x00,0x06,0x08,0x26,0x41,0x54,0x55,0x56,0x53,0x3d,0x22,0x04,0x00,0x04,0x14,0x33,0x51,0x6f,
+	0x8d,0x8e,0x77,0x77,0x77,0x77,0x77,0x93,0x89,0x6a,0x4c,0x2e,0x10,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,
+	0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0xa5,0xa4,0xb7,0xd2,0xcb,0xba,0xb9,0xc7,0xdf,0xef,0xe6,0xe6,0xe5,0xe7,0xf3,0xff,0xff,0x00,0x03,0x11,
+	0x1b,0x1c,0x17,0x16,0x31,0x4e,0x65,0x60,0x46,0x4b,0x5e,0x5b,0x7b,0x9b,0xbb,0xdb,0xfb,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x4b,0x66,0x81,0x9d,0x84,
+	0x68,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x06,0x1c,0x35,0x54,0x72,0x68,0x73,0x62,0x43,0x23,0x03,0x00,0x06,0x01,0x1f,0x3d,0x5b,0x7a,0x98,0x9a,0x97,0x97,
+	0x97,0x97,0x97,0x9d,0x93,0x75,0x57,0x39,0x1a,0x00,0x06,0x01,0x1f,0x3d,0x5b,0x7a,0x98,0x9a,0x97,0x97,0x97,0x97,0x97,0x9d,0x93,0x75,0x57,0x39,0x1a,0x00,0x07,0x18,
+	0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x08,0x1b,0x3b,0x5a,0x74,0x61,0x76,0x5c,0x3d,0x20,0x0c,0x00,0x08,0x0a,0x27,0x44,0x61,0x7d,0x9a,0x89,0x98,0x7b,
+	0x5f,0x42,0x25,0x08,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x07,0x24,
+	0x3f,0x54,0x55,0x56,0x53,0x3e,0x23,0x05,0x00,0x06,0x08,0x26,0x41,0x54,0x55,0x56,0x53,0x3d,0x22,0x04,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,
+	0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x9a,0x90,0x90,0x90,0x90,0x90,0x7e,0x5e,0x3e,0x1e,0x00,0x05,0x05,
+	0x25,0x45,0x65,0x85,0x9a,0x90,0x90,0x90,0x90,0x90,0x7e,0x5e,0x3e,0x1e,0x00,0x0d,0x0e,0x23,0x2f,0x48,0x60,0x61,0x4a,0x2c,0x2e,0x44,0x58,0x6d,0x65,0x48,0x29,0x09,
+	0x00,0x04,0x14,0x33,0x51,0x6f,0x8d,0x8e,0x77,0x77,0x77,0x77,0x77,0x93,0x89,0x6a,0x4c,0x2e,0x10,0x00,0x07,0x14,0x33,0x51,0x6f,0x8d,0x8e,0x77,0x77,0x77,0x77,0x77,
+	0x93,0x89,0x6a,0x4c,0x2e,0x10,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x70,0x70,0x70,0x70,0x6f,0x5a,0x3c,0x1d,0x00,0x08,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,
+	0x3e,0x1e,0x00,0x05,0x12,0x28,0x35,0x36,0x37,0x35,0x27,0x11,0x00,0x08,0x14,0x29,0x36,0x36,0x37,0x35,0x26,0x10,0x00,0x03,0x12,0x28,0x35,0x36,0x37,0x35,0x27,0x11,
+	0x00,0x08,0x14,0x29,0x36,0x36,0x37,0x35,0x26,0x10,0x00,0x04,0x01,0x1f,0x3d,0x5b,0x7a,0x98,0x9a,0x97,0x97,0x97,0x97,0x97,0x9d,0x93,0x75,0x57,0x39,0x1a,0x00,0x04,
+	0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x8b,0xab,
+	0xcb,0xb7,0x9e,0x9b,0xb3,0xd0,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x06,0x07,0x14,0x34,0x53,0x71,0x69,0x4a,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,
+	0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x3a,0x55,0x71,0x8c,0x95,0x79,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x04,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,
+	0x24,0x04,0x00,0x06,0x0b,0x2a,0x48,0x66,0x84,0x98,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x9c,0x80,0x61,0x43,0x25,0x07,0x00,0x05,0x0b,0x2a,0x48,0x66,0x84,0x98,0x7e,
+	0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x9c,0x80,0x61,0x43,0x25,0x07,0x00,0x06,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x08,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,
+	0x5d,0x3d,0x1d,0x00,0x0a,0x19,0x36,0x53,0x6f,0x8c,0xa7,0x8a,0x6d,0x51,0x34,0x17,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,
+	0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x02,0x12,0x28,0x35,0x36,0x37,0x35,0x27,0x11,0x00,0x08,0x14,0x29,0x36,0x36,0x37,0x35,0x26,0x10,0x00,0x02,0x05,0x25,
+	0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x70,0x70,0x70,
+	0x70,0x6f,0x5a,0x3c,0x1d,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x70,0x70,0x70,0x70,0x6f,0x5a,0x3c,0x1d,0x00,0x0c,0x05,0x22,0x3c,0x4e,0x4f,0x6e,0x6f,0x50,
+	0x30,0x16,0x2b,0x40,0x4f,0x4b,0x38,0x1e,0x01,0x00,0x03,0x01,0x1f,0x3d,0x5b,0x7a,0x98,0x9a,0x97,0x97,0x97,0x97,0x97,0x9d,0x93,0x75,0x57,0x39,0x1a,0x00,0x06,0x01,
+	0x1f,0x3d,0x5b,0x7a,0x98,0x9a,0x97,0x97,0x97,0x97,0x97,0x9d,0x93,0x75,0x57,0x39,0x1a,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x50,0x50,0x50,0x4f,0x45,
+	0x2e,0x13,0x00,0x08,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x06,0x0c,0x16,0x17,0x17,0x16,0x0b,0x00,0x04,0x04,0x04,0x00,0x04,0x0d,0x16,0x16,0x17,0x16,
+	0x0b,0x00,0x05,0x0c,0x16,0x17,0x17,0x16,0x0b,0x00,0x04,0x04,0x04,0x00,0x04,0x0d,0x16,0x16,0x17,0x16,0x0b,0x00,0x05,0x0b,0x2a,0x48,0x66,0x84,0x98,0x7e,0x7e,0x7e,
+	0x7e,0x7e,0x7e,0x7e,0x9c,0x80,0x61,0x43,0x25,0x07,0x00,0x03,0x04,0x23,0x43,0x60,0x6f,0x66,0x6b,0x51,0x32,0x12,0x04,0x10,0x30,0x4f,0x6a,0x68,0x6e,0x61,0x44,0x25,
+	0x05,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x4c,0x6b,0x70,0x51,0x32,0x12,0x00,0x0b,0x06,0x16,0x25,0x2c,0x32,0x51,0x6a,0x64,0x48,0x55,0x75,0x95,
+	0x84,0x64,0x44,0x24,0x04,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x44,0x60,0x7b,0x96,0x8a,0x6f,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x04,0x15,0x35,
+	0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x1e,0x13,0x01,0x00,0x04,0x16,0x34,0x52,0x71,0x8f,0x8d,0x6f,0x5e,0x5e,0x5e,0x5e,0x5e,0x73,0x91,0x8a,0x6c,0x4e,0x30,0x11,0x00,
+	0x05,0x16,0x34,0x52,0x71,0x8f,0x8d,0x6f,0x5e,0x5e,0x5e,0x5e,0x5e,0x73,0x91,0x8a,0x6c,0x4e,0x30,0x11,0x00,0x06,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,
+	0x00,0x06,0x0f,0x1c,0x20,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x0a,0x0b,0x28,0x45,0x61,0x7e,0x9c,0x7c,0x5f,0x43,0x26,0x09,0x00,0x06,0x04,0x23,0x43,0x60,
+	0x6f,0x66,0x6b,0x51,0x32,0x12,0x04,0x10,0x30,0x4f,0x6a,0x68,0x6e,0x61,0x44,0x25,0x05,0x00,0x03,0x0c,0x16,0x17,0x17,0x16,0x0b,0x00,0x04,0x04,0x04,0x00,0x04,0x0d,
+	0x16,0x16,0x17,0x16,0x0b,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,
+	0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x50,0x50,0x50,0x4f,0x45,0x2e,0x13,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x50,0x50,0x50,0x4f,0x45,0x2e,0x13,0x00,
+	0x0c,0x10,0x2e,0x4c,0x69,0x6b,0x6b,0x66,0x4c,0x2e,0x0e,0x13,0x25,0x2f,0x2d,0x20,0x0b,0x00,0x04,0x0b,0x2a,0x48,0x66,0x84,0x98,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,
+	0x9c,0x80,0x61,0x43,0x25,0x07,0x00,0x05,0x0b,0x2a,0x48,0x66,0x84,0x98,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x9c,0x80,0x61,0x43,0x25,0x07,0x00,0x03,0x05,0x25,0x45,
+	0x65,0x85,0x94,0x74,0x54,0x34,0x30,0x30,0x2f,0x29,0x18,0x09,0x01,0x00,0x07,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x0e,0x08,0x1a,0x24,0x24,0x18,0x06,
+	0x00,0x15,0x08,0x1a,0x24,0x24,0x18,0x06,0x00,0x0d,0x16,0x34,0x52,0x71,0x8f,0x8d,0x6f,0x5e,0x5e,0x5e,0x5e,0x5e,0x73,0x91,0x8a,0x6c,0x4e,0x30,0x11,0x00,0x04,0x19,
+	0x34,0x49,0x4f,0x4c,0x4e,0x3e,0x25,0x1f,0x24,0x1f,0x24,0x3d,0x4d,0x4c,0x4f,0x49,0x35,0x1a,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x4a,0x66,0x69,
+	0x4f,0x30,0x11,0x00,0x0a,0x0f,0x22,0x32,0x42,0x4c,0x44,0x52,0x6d,0x66,0x49,0x51,0x69,0x62,0x6c,0x5e,0x41,0x22,0x02,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,
+	0x55,0x35,0x33,0x4f,0x6a,0x85,0x9b,0x80,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x04,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x40,0x3d,0x2e,0x17,0x00,0x03,0x02,0x21,
+	0x3f,0x5d,0x7b,0x99,0x82,0x64,0x46,0x3e,0x3e,0x3e,0x4a,0x69,0x87,0x95,0x77,0x58,0x3a,0x1c,0x00,0x04,0x02,0x21,0x3f,0x5d,0x7b,0x99,0x82,0x64,0x46,0x3e,0x3e,0x3e,
+	0x4a,0x69,0x87,0x95,0x77,0x58,0x3a,0x1c,0x00,0x06,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x05,0x11,0x29,0x3a,0x40,0x40,0x5c,0x7c,0x9c,0x7d,0x5d,
+	0x3d,0x1d,0x00,0x0b,0x1e,0x3e,0x5e,0x7e,0x9c,0x7c,0x5c,0x3c,0x1c,0x00,0x08,0x19,0x34,0x49,0x4f,0x4c,0x4e,0x3e,0x25,0x1f,0x24,0x1f,0x24,0x3d,0x4d,0x4c,0x4f,0x49,
+	0x35,0x1a,0x00,0x0c,0x08,0x1a,0x24,0x24,0x18,0x06,0x00,0x0b,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x98,0x78,0x58,
+	0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x30,0x30,0x2f,0x29,0x18,0x09,0x01,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x30,
+	0x30,0x2f,0x29,0x18,0x09,0x01,0x00,0x0b,0x17,0x37,0x57,0x75,0x93,0x79,0x6d,0x4f,0x30,0x15,0x00,0x01,0x08,0x0f,0x0e,0x04,0x00,0x05,0x16,0x34,0x52,0x71,0x8f,0x8d,
+	0x6f,0x5e,0x5e,0x5e,0x5e,0x5e,0x73,0x91,0x8a,0x6c,0x4e,0x30,0x11,0x00,0x05,0x16,0x34,0x52,0x71,0x8f,0x8d,0x6f,0x5e,0x5e,0x5e,0x5e,0x5e,0x73,0x91,0x8a,0x6c,0x4e,
+	0x30,0x11,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x2a,0x2a,0x2a,0x2a,0x2a,0x28,0x1e,0x0b,0x00,0x06,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,
+	0x00,0x0d,0x03,0x1e,0x35,0x44,0x43,0x33,0x1b,0x00,0x14,0x03,0x1e,0x35,0x44,0x43,0x33,0x1b,0x00,0x0c,0x02,0x21,0x3f,0x5d,0x7b,0x99,0x82,0x64,0x46,0x3e,0x3e,0x3e,
+	0x4a,0x69,0x87,0x95,0x77,0x58,0x3a,0x1c,0x00,0x04,0x07,0x1c,0x2b,0x2f,0x2d,0x2f,0x24,0x28,0x3c,0x44,0x3d,0x29,0x23,0x2e,0x2e,0x2f,0x2c,0x1d,0x08,0x00,0x02,0x05,
+	0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x4b,0x68,0x6c,0x50,0x31,0x11,0x00,0x09,0x06,0x23,0x3c,0x4e,0x5e,0x6c,0x5c,0x40,0x50,0x4d,0x39,0x3d,0x4b,0x48,0x4c,0x45,
+	0x31,0x17,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x23,0x3e,0x59,0x74,0x8f,0x91,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x04,0x15,0x35,0x55,0x75,0x95,
+	0x84,0x64,0x60,0x60,0x5b,0x44,0x27,0x09,0x00,0x02,0x0d,0x2b,0x49,0x68,0x86,0x96,0x78,0x5a,0x3b,0x1e,0x1e,0x22,0x40,0x5e,0x7c,0x9a,0x81,0x63,0x45,0x27,0x08,0x00,
+	0x03,0x0d,0x2b,0x49,0x68,0x86,0x96,0x78,0x5a,0x3b,0x1e,0x1e,0x22,0x40,0x5e,0x7c,0x9a,0x81,0x63,0x45,0x27,0x08,0x00,0x05,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,
+	0x21,0x01,0x00,0x04,0x01,0x1f,0x3d,0x56,0x60,0x60,0x60,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x0b,0x1e,0x3e,0x5e,0x7e,0x9c,0x7c,0x5c,0x3c,0x1c,0x00,0x08,0x07,0x1c,
+	0x2b,0x2f,0x2d,0x2f,0x24,0x28,0x3c,0x44,0x3d,0x29,0x23,0x2e,0x2e,0x2f,0x2c,0x1d,0x08,0x00,0x0b,0x03,0x1e,0x35,0x44,0x43,0x33,0x1b,0x00,0x0b,0x05,0x25,0x45,0x65,
+	0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x2a,0x2a,0x2a,
+	0x2a,0x2a,0x28,0x1e,0x0b,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x2a,0x2a,0x2a,0x2a,0x2a,0x28,0x1e,0x0b,0x00,0x0a,0x14,0x33,0x50,0x6e,0x8b,0x99,
+	0xad,0xb1,0xbd,0xd5,0xf0,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x02,0x02,0x21,0x3f,0x5d,0x7b,0x99,0x82,0x64,0x46,0x3e,0x3e,0x3e,0x4a,0x69,0x87,0x95,0x77,0x58,0x3a,
+	0x1c,0x00,0x04,0x02,0x21,0x3f,0x5d,0x7b,0x99,0x82,0x64,0x46,0x3e,0x3e,0x3e,0x4a,0x69,0x87,0x95,0x77,0x58,0x3a,0x1c,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,
+	0x54,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,0x48,0x38,0x20,0x04,0x00,0x05,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x0d,0x0e,0x2d,0x4a,0x62,0x60,0x47,0x2a,0x0b,
+	0x00,0x13,0x0e,0x2d,0x4a,0x62,0x60,0x47,0x2a,0x0b,0x00,0x0b,0x0d,0x2b,0x49,0x68,0x86,0x96,0x78,0x5a,0x3b,0x1e,0x1e,0x22,0x40,0x5e,0x7c,0x9a,0x81,0x63,0x45,0x27,
+	0x08,0x00,0x04,0x01,0x0c,0x0f,0x0e,0x0f,0x1b,0x39,0x55,0x64,0x56,0x3b,0x1c,0x0f,0x0e,0x0f,0x0d,0x02,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x3b,
+	0x4e,0x4f,0x3f,0x25,0x09,0x00,0x09,0x0f,0x2f,0x4e,0x69,0x7a,0x89,0xa0,0xbd,0xad,0xb0,0xc4,0xdd,0xd4,0xd6,0xd3,0xd7,0xe6,0xfb,0xff,0x00,0x01,0x05,0x25,0x45,0x65,
+	0x85,0x95,0x75,0x55,0x35,0x15,0x2d,0x48,0x63,0x7e,0x99,0x90,0x98,0x78,0x58,0x38,0x18,0x00,0x04,0x12,0x30,0x4d,0x62,0x5d,0x64,0x7f,0x7f,0x7f,0x92,0xb2,0xd2,0xf2,
+	0x00,0x02,0x18,0x36,0x54,0x72,0x90,0x8b,0x6d,0x4f,0x31,0x13,0x00,0x01,0x17,0x35,0x53,0x72,0x90,0x8c,0x6e,0x4f,0x31,0x13,0x00,0x03,0x18,0x36,0x54,0x72,0x90,0x8b,
+	0x6d,0x4f,0x31,0x13,0x00,0x01,0x17,0x35,0x53,0x72,0x90,0x8c,0x6e,0x4f,0x31,0x13,0x00,0x05,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x04,0x05,0x25,
+	0x45,0x65,0x80,0x80,0x80,0x97,0xa7,0x9b,0xac,0xc7,0xe6,0xff,0xff,0x00,0x09,0x1e,0x3e,0x5e,0x7e,0x9c,0x7c,0x5c,0x3c,0x1c,0x00,0x09,0x01,0x0c,0x0f,0x0e,0x0f,0x1b,
+	0x39,0x55,0x64,0x56,0x3b,0x1c,0x0f,0x0e,0x0f,0x0d,0x02,0x00,0x0c,0x0e,0x2d,0x4a,0x62,0x60,0x47,0x2a,0x0b,0x00,0x0a,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,
+	0x14,0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,0x48,0x38,0x20,
+	0x04,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,0x48,0x38,0x20,0x04,0x00,0x09,0x0f,0x26,0x44,0x61,0x6d,0x69,0x67,0x6d,0x56,
+	0x38,0x19,0x00,0x08,0x0d,0x2b,0x49,0x68,0x86,0x96,0x78,0x5a,0x3b,0x1e,0x1e,0x22,0x40,0x5e,0x7c,0x9a,0x81,0x63,0x45,0x27,0x08,0x00,0x03,0x0d,0x2b,0x49,0x68,0x86,
+	0x96,0x78,0x5a,0x3b,0x1e,0x1e,0x22,0x40,0x5e,0x7c,0x9a,0x81,0x63,0x45,0x27,0x08,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,
+	0x65,0x4c,0x2e,0x0f,0x00,0x05,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x0d,0x11,0x31,0x51,0x70,0x6d,0x4d,0x2e,0x0e,0x00,0x13,0x11,0x31,0x51,0x70,0x6d,
+	0x4d,0x2e,0x0e,0x00,0x0b,0x18,0x36,0x54,0x72,0x90,0x8b,0x6d,0x4f,0x31,0x13,0x00,0x01,0x17,0x35,0x53,0x72,0x90,0x8c,0x6e,0x4f,0x31,0x13,0x00,0x09,0x1f,0x3f,0x5e,
+	0x7b,0x60,0x40,0x20,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x22,0x2f,0x30,0x25,0x11,0x00,0x0a,0x0f,0x2f,0x4e,0x6a,0x6a,0x5a,0x4a,0x53,0x6f,0x68,
+	0x4a,0x2a,0x0c,0x0a,0x0c,0x09,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x1c,0x37,0x52,0x6d,0x88,0xa4,0x98,0x78,0x58,0x38,0x18,0x00,0x04,0x06,
+	0x20,0x36,0x43,0x40,0x57,0x66,0x66,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x01,0x04,0x22,0x40,0x5e,0x7d,0x9b,0x81,0x63,0x44,0x26,0x08,0x00,0x01,0x0c,0x2b,0x49,0x67,0x85,
+	0x96,0x78,0x5a,0x3c,0x1e,0x00,0x02,0x04,0x22,0x40,0x5e,0x7d,0x9b,0x81,0x63,0x44,0x26,0x08,0x00,0x01,0x0c,0x2b,0x49,0x67,0x85,0x96,0x78,0x5a,0x3c,0x1e,0x00,0x05,
+	0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x99,0x99,0xa3,0xbd,0xbb,0xc4,0xd9,0xf2,0xff,0xff,0x00,0x09,0x1e,0x3e,0x5e,
+	0x7e,0x9c,0x7c,0x5c,0x3c,0x1c,0x00,0x0e,0x1f,0x3f,0x5e,0x7b,0x60,0x40,0x20,0x00,0x11,0x11,0x31,0x51,0x70,0x6d,0x4d,0x2e,0x0e,0x00,0x0a,0x05,0x25,0x45,0x65,0x85,
+	0x94,0x74,0x54,0x34,0x14,0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,
+	0x6a,0x65,0x4c,0x2e,0x0f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x65,0x4c,0x2e,0x0f,0x00,0x08,0x05,0x22,0x3c,0x54,0x6b,
+	0x6a,0x6b,0x68,0x70,0x57,0x39,0x19,0x00,0x08,0x18,0x36,0x54,0x72,0x90,0x8b,0x6d,0x4f,0x31,0x13,0x00,0x01,0x17,0x35,0x53,0x72,0x90,0x8c,0x6e,0x4f,0x31,0x13,0x00,
+	0x03,0x18,0x36,0x54,0x72,0x90,0x8b,0x6d,0x4f,0x31,0x13,0x00,0x01,0x17,0x35,0x53,0x72,0x90,0x8c,0x6e,0x4f,0x31,0x13,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x96,0x8a,
+	0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x71,0x51,0x31,0x11,0x00,0x05,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x0d,0x0f,0x2f,0x4d,0x67,0x65,0x4a,0x2b,0x0c,
+	0x00,0x13,0x0f,0x2f,0x4d,0x67,0x65,0x4a,0x2b,0x0c,0x00,0x0a,0x04,0x22,0x40,0x5e,0x7d,0x9b,0x81,0x63,0x44,0x26,0x08,0x00,0x01,0x0c,0x2b,0x49,0x67,0x85,0x96,0x78,
+	0x5a,0x3c,0x1e,0x00,0x09,0x1c,0x3b,0x58,0x6a,0x59,0x3c,0x1e,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x10,0x10,0x08,0x00,0x0b,0x07,0x23,0x3d,
+	0x4e,0x4d,0x3e,0x32,0x50,0x68,0x63,0x47,0x28,0x09,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x90,0x75,0x55,0x35,0x15,0x0b,0x26,0x41,0x5c,0x77,0x90,0x90,0x78,0x58,0x38,
+	0x18,0x00,0x05,0x0a,0x1b,0x23,0x3f,0x5f,0x79,0x79,0x79,0x6c,0x4d,0x2d,0x0d,0x00,0x01,0x0c,0x2c,0x4b,0x69,0x87,0x90,0x76,0x58,0x3a,0x1c,0x00,0x02,0x02,0x20,0x3e,
+	0x5c,0x7b,0x90,0x83,0x65,0x46,0x27,0x08,0x00,0x01,0x0c,0x2c,0x4b,0x69,0x87,0x90,0x76,0x58,0x3a,0x1c,0x00,0x02,0x02,0x20,0x3e,0x5c,0x7b,0x90,0x83,0x65,0x46,0x27,
+	0x08,0x00,0x04,0x18,0x38,0x58,0x78,0x90,0x81,0x61,0x41,0x21,0x01,0x00,0x04,0x05,0x25,0x45,0x64,0x79,0x79,0x79,0x67,0x47,0x28,0x1e,0x0e,0x00,0x0c,0x1e,0x3e,0x5e,
+	0x7e,0x9c,0x7c,0x5c,0x3c,0x1c,0x00,0x0e,0x1c,0x3b,0x58,0x6a,0x59,0x3c,0x1e,0x00,0x11,0x0f,0x2f,0x4d,0x67,0x65,0x4a,0x2b,0x0c,0x00,0x0a,0x05,0x25,0x45,0x65,0x85,
+	0x94,0x74,0x54,0x34,0x14,0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x96,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,
+	0x8a,0x71,0x51,0x31,0x11,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x96,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x71,0x51,0x31,0x11,0x00,0x08,0x0d,0x2d,0x4c,0x69,0x81,
+	0x8c,0x98,0xb1,0xaf,0xbb,0xd3,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x04,0x22,0x40,0x5e,0x7d,0x9b,0x81,0x63,0x44,0x26,0x08,0x00,0x01,0x0c,0x2b,0x49,0x67,
+	0x85,0x96,0x78,0x5a,0x3c,0x1e,0x00,0x02,0x04,0x22,0x40,0x5e,0x7d,0x9b,0x81,0x63,0x44,0x26,0x08,0x00,0x01,0x0c,0x2b,0x49,0x67,0x85,0x96,0x78,0x5a,0x3c,0x1e,0x00,
+	0x02,0x05,0x25,0x45,0x65,0x85,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x71,0x51,0x31,0x11,0x00,0x05,0x1b,0x3b,0x5b,0x7b,0x90,0x7e,0x5e,0x3e,0x1e,0x00,0x0d,
+	0x11,0x30,0x50,0x6d,0x6a,0x4c,0x2d,0x0d,0x00,0x13,0x11,0x30,0x50,0x6d,0x6a,0x4c,0x2d,0x0d,0x00,0x0a,0x0c,0x2c,0x4b,0x69,0x87,0x90,0x76,0x58,0x3a,0x1c,0x00,0x02,
+	0x02,0x20,0x3e,0x5c,0x7b,0x90,0x83,0x65,0x46,0x27,0x08,0x00,0x08,0x1e,0x3e,0x5d,0x75,0x5f,0x3f,0x20,0x00,0x08,0x05,0x25,0x45,0x65,0x83,0x83,0x74,0x54,0x34,0x14,
+	0x00,0x0f,0x0f,0x23,0x2e,0x2e,0x22,0x34,0x54,0x73,0x6a,0x4a,0x2b,0x0b,0x00,0x07,0x04,0x23,0x43,0x60,0x70,0x70,0x6c,0x52,0x33,0x14,0x00,0x01,0x15,0x30,0x4b,0x66,
+	0x70,0x70,0x6e,0x55,0x36,0x17,0x00,0x07,0x18,0x35,0x4e,0x59,0x59,0x59,0x55,0x40,0x25,0x07,0x00,0x01,0x0c,0x2c,0x4b,0x67,0x70,0x70,0x69,0x4d,0x2f,0x11,0x00,0x03,
+	0x15,0x34,0x52,0x6c,0x70,0x70,0x64,0x46,0x27,0x08,0x00,0x01,0x0c,0x2c,0x4b,0x67,0x70,0x70,0x69,0x4d,0x2f,0x11,0x00,0x03,0x15,0x34,0x52,0x6c,0x70,0x70,0x64,0x46,
+	0x27,0x08,0x00,0x04,0x17,0x36,0x55,0x6e,0x70,0x70,0x5d,0x3f,0x20,0x00,0x06,0x1d,0x3a,0x51,0x59,0x59,0x59,0x53,0x3c,0x20,0x02,0x00,0x0d,0x1e,0x3e,0x5e,0x7e,0x90,
+	0x7c,0x5c,0x3c,0x1c,0x00,0x0e,0x1e,0x3e,0x5d,0x75,0x5f,0x3f,0x20,0x00,0x11,0x11,0x30,0x50,0x6d,0x6a,0x4c,0x2d,0x0d,0x00,0x0a,0x05,0x25,0x45,0x65,0x85,0x90,0x74,
+	0x54,0x34,0x14,0x00,0x04,0x01,0x21,0x41,0x61,0x81,0x90,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x71,
+	0x51,0x31,0x11,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x71,0x51,0x31,0x11,0x00,0x08,0x0d,0x2c,0x4b,0x66,0x68,0x76,0x68,
+	0x48,0x31,0x28,0x17,0x00,0x08,0x0c,0x2c,0x4b,0x69,0x87,0x90,0x76,0x58,0x3a,0x1c,0x00,0x02,0x02,0x20,0x3e,0x5c,0x7b,0x90,0x83,0x65,0x46,0x27,0x08,0x00,0x01,0x0c,
+	0x2c,0x4b,0x69,0x87,0x90,0x76,0x58,0x3a,0x1c,0x00,0x02,0x02,0x20,0x3e,0x5c,0x7b,0x90,0x83,0x65,0x46,0x27,0x08,0x00,0x01,0x04,0x23,0x43,0x60,0x70,0x70,0x70,0x70,
+	0x70,0x70,0x70,0x70,0x70,0x70,0x6a,0x4e,0x2f,0x10,0x00,0x05,0x1a,0x3a,0x58,0x6f,0x70,0x6f,0x5a,0x3c,0x1c,0x00,0x0d,0x09,0x26,0x40,0x51,0x50,0x3d,0x23,0x06,0x00,
+	0x13,0x09,0x26,0x40,0x51,0x50,0x3d,0x23,0x06,0x00,0x0a,0x0c,0x2c,0x4b,0x67,0x70,0x70,0x69,0x4d,0x2f,0x11,0x00,0x03,0x15,0x34,0x52,0x6c,0x70,0x70,0x64,0x46,0x27,
+	0x08,0x00,0x08,0x16,0x32,0x4a,0x55,0x4b,0x33,0x17,0x00,0x08,0x02,0x20,0x3e,0x59,0x63,0x63,0x61,0x4c,0x2f,0x11,0x00,0x10,0x06,0x0f,0x0f,0x11,0x30,0x4d,0x63,0x5e,
+	0x45,0x27,0x08,0x00,0x08,0x19,0x34,0x49,0x50,0x50,0x4e,0x3f,0x27,0x0b,0x00,0x01,0x04,0x1f,0x39,0x4c,0x50,0x50,0x4f,0x41,0x29,0x0d,0x00,0x07,0x09,0x21,0x32,0x39,
+	0x39,0x39,0x37,0x29,0x13,0x00,0x02,0x04,0x20,0x3a,0x4c,0x50,0x50,0x4d,0x3c,0x23,0x06,0x00,0x03,0x0a,0x27,0x3f,0x4e,0x50,0x50,0x4a,0x37,0x1c,0x00,0x02,0x04,0x20,
+	0x3a,0x4c,0x50,0x50,0x4d,0x3c,0x23,0x06,0x00,0x03,0x0a,0x27,0x3f,0x4e,0x50,0x50,0x4a,0x37,0x1c,0x00,0x05,0x0d,0x29,0x41,0x4f,0x50,0x50,0x47,0x31,0x16,0x00,0x06,
+	0x0d,0x24,0x34,0x39,0x39,0x39,0x35,0x26,0x0f,0x00,0x0e,0x1c,0x3c,0x5a,0x6f,0x70,0x6f,0x59,0x3a,0x1b,0x00,0x0e,0x16,0x32,0x4a,0x55,0x4b,0x33,0x17,0x00,0x11,0x09,
+	0x26,0x40,0x51,0x50,0x3d,0x23,0x06,0x00,0x0a,0x04,0x23,0x43,0x60,0x70,0x70,0x6c,0x51,0x33,0x13,0x00,0x05,0x20,0x3f,0x5d,0x70,0x70,0x6e,0x55,0x36,0x17,0x00,0x02,
+	0x04,0x23,0x43,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x6a,0x4e,0x2f,0x10,0x00,0x02,0x04,0x23,0x43,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
+	0x70,0x70,0x6a,0x4e,0x2f,0x10,0x00,0x08,0x04,0x20,0x39,0x4a,0x4e,0x61,0x5a,0x41,0x24,0x0b,0x00,0x09,0x0c,0x2c,0x4b,0x67,0x70,0x70,0x69,0x4d,0x2f,0x11,0x00,0x03,
+	0x15,0x34,0x52,0x6c,0x70,0x70,0x64,0x46,0x27,0x08,0x00,0x01,0x0c,0x2c,0x4b,0x67,0x70,0x70,0x69,0x4d,0x2f,0x11,0x00,0x03,0x15,0x34,0x52,0x6c,0x70,0x70,0x64,0x46,
+	0x27,0x08,0x00,0x02,0x19,0x34,0x49,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x4d,0x3d,0x23,0x07,0x00,0x05,0x11,0x2c,0x43,0x4f,0x50,0x4f,0x45,0x2e,0x12,
+	0x00,0x0e,0x13,0x27,0x32,0x32,0x25,0x10,0x00,0x15,0x13,0x27,0x32,0x32,0x25,0x10,0x00,0x0b,0x04,0x20,0x3a,0x4c,0x50,0x50,0x4d,0x3c,0x23,0x06,0x00,0x03,0x0a,0x27,
+	0x3f,0x4e,0x50,0x50,0x4a,0x37,0x1c,0x00,0x09,0x06,0x1d,0x2f,0x35,0x2f,0x1e,0x07,0x00,0x09,0x13,0x2b,0x3d,0x43,0x43,0x42,0x35,0x1f,0x04,0x00,0x13,0x05,0x20,0x37,
+	0x44,0x42,0x31,0x19,0x00,0x09,0x07,0x1c,0x2b,0x30,0x30,0x2f,0x25,0x12,0x00,0x03,0x0c,0x20,0x2d,0x30,0x30,0x2f,0x26,0x14,0x00,0x09,0x07,0x14,0x19,0x19,0x19,0x18,
+	0x0d,0x00,0x04,0x0d,0x21,0x2d,0x30,0x30,0x2e,0x22,0x0f,0x00,0x05,0x12,0x25,0x2f,0x30,0x30,0x2c,0x1f,0x09,0x00,0x03,0x0d,0x21,0x2d,0x30,0x30,0x2e,0x22,0x0f,0x00,
+	0x05,0x12,0x25,0x2f,0x30,0x30,0x2c,0x1f,0x09,0x00,0x06,0x14,0x26,0x2f,0x30,0x30,0x2a,0x1a,0x04,0x00,0x07,0x0a,0x16,0x19,0x19,0x19,0x17,0x0b,0x00,0x0f,0x12,0x2e,
+	0x45,0x4f,0x50,0x4f,0x44,0x2d,0x11,0x00,0x0e,0x06,0x1d,0x2f,0x35,0x2f,0x1e,0x07,0x00,0x12,0x13,0x27,0x32,0x32,0x25,0x10,0x00,0x0c,0x19,0x34,0x49,0x50,0x50,0x4e,
+	0x3f,0x26,0x0a,0x00,0x05,0x16,0x31,0x47,0x50,0x50,0x4f,0x41,0x29,0x0d,0x00,0x03,0x19,0x34,0x49,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x4d,0x3d,0x23,
+	0x07,0x00,0x03,0x19,0x34,0x49,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x4d,0x3d,0x23,0x07,0x00,0x09,0x0c,0x20,0x2c,0x36,0x42,0x3e,0x2d,0x15,0x00,0x0a,
+	0x04,0x20,0x3a,0x4c,0x50,0x50,0x4d,0x3c,0x23,0x06,0x00,0x03,0x0a,0x27,0x3f,0x4e,0x50,0x50,0x4a,0x37,0x1c,0x00,0x02,0x04,0x20,0x3a,0x4c,0x50,0x50,0x4d,0x3c,0x23,
+	0x06,0x00,0x03,0x0a,0x27,0x3f,0x4e,0x50,0x50,0x4a,0x37,0x1c,0x00,0x03,0x07,0x1c,0x2b,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2e,0x23,0x0f,0x00,0x07,
+	0x16,0x28,0x2f,0x30,0x2f,0x29,0x18,0x01,0x00,0x0f,0x0a,0x13,0x12,0x09,0x00,0x17,0x0a,0x13,0x12,0x09,0x00,0x0d,0x0d,0x21,0x2d,0x30,0x30,0x2e,0x22,0x0f,0x00,0x05,
+	0x12,0x25,0x2f,0x30,0x30,0x2c,0x1f,0x09,0x00,0x0a,0x03,0x11,0x15,0x11,0x04,0x00,0x0b,0x12,0x1f,0x23,0x23,0x22,0x19,0x08,0x00,0x15,0x0a,0x1b,0x25,0x23,0x17,0x04,
+	0x00,0x0a,0x01,0x0c,0x10,0x10,0x0f,0x08,0x00,0x05,0x04,0x0e,0x10,0x10,0x0f,0x09,0x00,0x16,0x05,0x0e,0x10,0x10,0x0e,0x06,0x00,0x07,0x08,0x0f,0x0f,0x0f,0x0d,0x03,
+	0x00,0x05,0x05,0x0e,0x10,0x10,0x0e,0x06,0x00,0x07,0x08,0x0f,0x0f,0x0f,0x0d,0x03,0x00,0x08,0x09,0x0f,0x10,0x10,0x0b,0x00,0x1f,0x01,0x18,0x29,0x2f,0x30,0x2f,0x28,
+	0x17,0x00,0x10,0x03,0x11,0x15,0x11,0x04,0x00,0x14,0x0a,0x13,0x12,0x09,0x00,0x0d,0x07,0x1c,0x2b,0x30,0x30,0x2f,0x25,0x12,0x00,0x06,0x04,0x1a,0x2a,0x30,0x30,0x2f,
+	0x26,0x14,0x00,0x04,0x07,0x1c,0x2b,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2e,0x23,0x0f,0x00,0x04,0x07,0x1c,0x2b,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+	0x30,0x30,0x30,0x2e,0x23,0x0f,0x00,0x0b,0x03,0x0c,0x1a,0x22,0x20,0x13,0x00,0x0c,0x0d,0x21,0x2d,0x30,0x30,0x2e,0x22,0x0f,0x00,0x05,0x12,0x25,0x2f,0x30,0x30,0x2c,
+	0x1f,0x09,0x00,0x03,0x0d,0x21,0x2d,0x30,0x30,0x2e,0x22,0x0f,0x00,0x05,0x12,0x25,0x2f,0x30,0x30,0x2c,0x1f,0x09,0x00,0x04,0x01,0x0c,0x10,0x10,0x10,0x10,0x10,0x10,
+	0x10,0x10,0x10,0x10,0x0f,0x06,0x00,0x09,0x0a,0x0f,0x10,0x0f,0x0a,0x00,0x3e,0x05,0x0e,0x10,0x10,0x0e,0x06,0x00,0x07,0x08,0x0f,0x0f,0x0f,0x0d,0x03,0x00,0x1d,0x03,
+	0x03,0x03,0x00,0x19,0x05,0x04,0x00,0x8c,0x0a,0x0f,0x10,0x0f,0x0a,0x00,0x3c,0x01,0x0c,0x10,0x10,0x0f,0x07,0x00,0x09,0x0b,0x10,0x10,0x0f,0x09,0x00,0x06,0x01,0x0c,
+	0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x0f,0x06,0x00,0x06,0x01,0x0c,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x0f,0x06,0x00,0x0f,0x02,0x01,
+	0x00,0x0e,0x05,0x0e,0x10,0x10,0x0e,0x06,0x00,0x07,0x08,0x0f,0x0f,0x0f,0x0d,0x03,0x00,0x05,0x05,0x0e,0x10,0x10,0x0e,0x06,0x00,0x07,0x08,0x0f,0x0f,0x0f,0x0d,0x03,
+	0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x61,0x03,0x06,0x06,0x06,0x06,0x06,0x06,0x05,0x00,0x07,0x04,0x07,0x07,0x07,0x00,0x0a,0x04,0x07,0x07,0x07,0x00,0x08,0x03,0x06,
+	0x06,0x06,0x06,0x06,0x06,0x05,0x00,0x3a,0x09,0x0f,0x0f,0x0f,0x0b,0x00,0x0f,0x0c,0x0f,0x0f,0x0f,0x08,0x00,0x15,0x0b,0x0f,0x0f,0x0f,0x09,0x00,0x26,0x0a,0x0f,0x0f,
+	0x0f,0x0a,0x00,0x19,0x01,0x02,0x00,0x58,0x0b,0x0f,0x0f,0x0f,0x08,0x00,0x15,0x0a,0x0f,0x0f,0x0f,0x0a,0x00,0x68,0x0c,0x0f,0x0f,0x0f,0x08,0x00,0x0f,0x10,0x18,0x16,
+	0x0c,0x04,0x13,0x18,0x15,0x08,0x00,0x0e,0x06,0x13,0x17,0x17,0x16,0x0f,0x00,0x0b,0x15,0x22,0x26,0x26,0x26,0x26,0x26,0x26,0x24,0x19,0x06,0x00,0x03,0x01,0x15,0x23,
+	0x27,0x27,0x26,0x1d,0x0c,0x00,0x07,0x14,0x22,0x27,0x27,0x27,0x1e,0x0d,0x00,0x05,0x15,0x22,0x26,0x26,0x26,0x26,0x26,0x26,0x24,0x19,0x06,0x00,0x0a,0x01,0x06,0x03,
+	0x00,0x14,0x02,0x11,0x19,0x17,0x0c,0x00,0x11,0x15,0x27,0x2f,0x2f,0x2f,0x29,0x19,0x03,0x00,0x0b,0x06,0x1b,0x2a,0x2f,0x2f,0x2f,0x25,0x13,0x00,0x12,0x02,0x19,0x29,
+	0x2f,0x2f,0x2f,0x27,0x16,0x00,0x10,0x08,0x10,0x0f,0x05,0x00,0x0f,0x02,0x18,0x29,0x2f,0x2f,0x2f,0x28,0x16,0x00,0x13,0x01,0x00,0x03,0x13,0x20,0x22,0x1a,0x0a,0x00,
+	0x12,0x06,0x0f,0x0f,0x07,0x00,0x0c,0x0a,0x14,0x15,0x15,0x14,0x0a,0x00,0x07,0x0e,0x19,0x1a,0x1a,0x18,0x0e,0x00,0x03,0x02,0x12,0x1a,0x1a,0x1a,0x16,0x0a,0x00,0x06,
+	0x02,0x10,0x15,0x15,0x15,0x10,0x02,0x00,0x08,0x04,0x1a,0x2a,0x2f,0x2f,0x2f,0x26,0x14,0x00,0x12,0x01,0x18,0x28,0x2f,0x2f,0x2f,0x28,0x17,0x00,0x10,0x07,0x10,0x0f,
+	0x05,0x00,0x12,0x04,0x14,0x1b,0x19,0x0e,0x00,0x01,0x08,0x0f,0x0f,0x0f,0x0b,0x00,0x06,0x01,0x0c,0x0f,0x0f,0x0f,0x07,0x00,0x01,0x10,0x1a,0x1b,0x12,0x01,0x00,0x10,
+	0x0a,0x16,0x19,0x12,0x03,0x00,0x0d,0x06,0x1c,0x2b,0x2f,0x2f,0x2f,0x25,0x13,0x00,0x0d,0x18,0x2c,0x38,0x36,0x27,0x1e,0x30,0x38,0x33,0x22,0x0b,0x00,0x0c,0x09,0x20,
+	0x31,0x37,0x37,0x36,0x2c,0x19,0x00,0x09,0x14,0x2d,0x40,0x46,0x46,0x46,0x46,0x46,0x46,0x43,0x33,0x1b,0x00,0x03,0x15,0x2e,0x41,0x47,0x47,0x46,0x39,0x22,0x07,0x00,
+	0x05,0x13,0x2c,0x40,0x47,0x47,0x46,0x3a,0x24,0x09,0x00,0x03,0x14,0x2d,0x40,0x46,0x46,0x46,0x46,0x46,0x46,0x43,0x33,0x1b,0x00,0x09,0x10,0x20,0x26,0x22,0x14,0x10,
+	0x10,0x07,0x00,0x0f,0x01,0x1a,0x2e,0x39,0x36,0x26,0x10,0x00,0x0f,0x0f,0x2b,0x42,0x4f,0x4f,0x4f,0x46,0x30,0x15,0x00,0x0b,0x18,0x33,0x48,0x4f,0x4f,0x4e,0x40,0x28,
+	0x0c,0x00,0x11,0x14,0x2f,0x45,0x4f,0x4f,0x4f,0x43,0x2c,0x10,0x00,0x0e,0x12,0x25,0x2f,0x2e,0x21,0x0c,0x00,0x0e,0x13,0x2f,0x45,0x4f,0x4f,0x4f,0x43,0x2c,0x11,0x00,
+	0x10,0x0b,0x1b,0x21,0x1d,0x10,0x15,0x2d,0x3e,0x42,0x36,0x21,0x06,0x00,0x10,0x0e,0x22,0x2f,0x2f,0x23,0x10,0x00,0x0a,0x11,0x26,0x33,0x35,0x35,0x33,0x26,0x11,0x00,
+	0x05,0x14,0x2a,0x38,0x3a,0x3a,0x37,0x29,0x13,0x00,0x02,0x1a,0x2e,0x39,0x3a,0x3a,0x35,0x24,0x0d,0x00,0x04,0x04,0x1c,0x2e,0x35,0x35,0x35,0x2e,0x1c,0x04,0x00,0x07,
+	0x16,0x31,0x47,0x4f,0x4f,0x4f,0x41,0x2a,0x0e,0x00,0x11,0x12,0x2e,0x44,0x4f,0x4f,0x4f,0x44,0x2d,0x12,0x00,0x0e,0x11,0x24,0x2f,0x2e,0x22,0x0d,0x00,0x10,0x02,0x1c,
+	0x30,0x3b,0x38,0x28,0x14,0x26,0x2f,0x2f,0x2f,0x29,0x19,0x03,0x00,0x03,0x06,0x1c,0x2b,0x2f,0x2f,0x2e,0x24,0x15,0x2b,0x39,0x3b,0x2e,0x19,0x00,0x0f,0x0d,0x24,0x34,
+	0x39,0x2f,0x1c,0x04,0x00,0x0c,0x18,0x33,0x48,0x4f,0x4f,0x4e,0x40,0x28,0x0c,0x00,0x0b,0x18,0x2b,0x45,0x57,0x53,0x3e,0x32,0x4b,0x58,0x4f,0x37,0x22,0x0c,0x00,0x0b,
+	0x19,0x36,0x4d,0x57,0x57,0x56,0x46,0x2c,0x10,0x00,0x07,0x02,0x21,0x40,0x5b,0x66,0x66,0x66,0x66,0x66,0x66,0x60,0x47,0x29,0x0a,0x00,0x01,0x02,0x22,0x40,0x5b,0x67,
+	0x67,0x65,0x4e,0x31,0x12,0x00,0x05,0x20,0x3e,0x5a,0x67,0x67,0x66,0x50,0x33,0x14,0x00,0x02,0x02,0x21,0x40,0x5b,0x66,0x66,0x66,0x66,0x66,0x66,0x60,0x47,0x29,0x0a,
+	0x00,0x07,0x0d,0x27,0x3c,0x46,0x40,0x2e,0x30,0x2f,0x23,0x0e,0x00,0x0e,0x10,0x2d,0x47,0x58,0x53,0x3d,0x21,0x05,0x0d,0x0c,0x02,0x00,0x0b,0x1a,0x38,0x57,0x6e,0x6f,
+	0x6f,0x5c,0x3e,0x1f,0x00,0x0a,0x03,0x23,0x42,0x5f,0x6f,0x6f,0x6d,0x54,0x35,0x16,0x00,0x11,0x1e,0x3d,0x5b,0x6f,0x6f,0x6f,0x58,0x39,0x1a,0x00,0x0d,0x12,0x29,0x3f,
+	0x4f,0x4c,0x39,0x22,0x0b,0x00,0x0d,0x1d,0x3d,0x5b,0x6f,0x6f,0x6f,0x58,0x3a,0x1b,0x00,0x0f,0x0a,0x23,0x38,0x41,0x3b,0x29,0x24,0x41,0x5a,0x61,0x4e,0x31,0x13,0x00,
+	0x01,0x01,0x00,0x0d,0x0f,0x25,0x3c,0x4d,0x4e,0x3d,0x26,0x0f,0x00,0x08,0x06,0x23,0x3e,0x51,0x55,0x55,0x51,0x3e,0x23,0x06,0x00,0x03,0x07,0x25,0x41,0x56,0x5a,0x5a,
+	0x55,0x40,0x24,0x06,0x0f,0x2c,0x47,0x59,0x5a,0x5a,0x51,0x39,0x1d,0x00,0x04,0x15,0x31,0x49,0x55,0x55,0x55,0x49,0x31,0x14,0x00,0x06,0x01,0x21,0x40,0x5e,0x6f,0x6f,
+	0x6e,0x55,0x37,0x18,0x00,0x11,0x1d,0x3c,0x5a,0x6f,0x6f,0x6f,0x59,0x3b,0x1c,0x00,0x0d,0x11,0x28,0x3e,0x4e,0x4d,0x3a,0x23,0x0c,0x00,0x0f,0x10,0x2e,0x49,0x5b,0x55,
+	0x3e,0x2a,0x41,0x4f,0x4f,0x4f,0x46,0x30,0x15,0x00,0x03,0x19,0x33,0x48,0x4f,0x4f,0x4e,0x3f,0x26,0x42,0x57,0x59,0x46,0x2a,0x0c,0x00,0x0d,0x0e,0x23,0x3a,0x51,0x58,
+	0x49,0x30,0x1c,0x05,0x00,0x0a,0x03,0x23,0x42,0x60,0x6f,0x6f,0x6d,0x53,0x35,0x16,0x00,0x0a,0x10,0x2d,0x45,0x54,0x72,0x6a,0x51,0x4a,0x5c,0x78,0x62,0x4e,0x39,0x1e,
+	0x01,0x00,0x08,0x0b,0x17,0x21,0x41,0x61,0x77,0x77,0x73,0x56,0x37,0x17,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x86,0x86,0x86,0x86,0x86,0x6d,0x4d,0x2d,0x0d,0x00,0x01,
+	0x05,0x25,0x44,0x64,0x78,0x78,0x73,0x54,0x35,0x15,0x00,0x04,0x02,0x22,0x42,0x62,0x78,0x78,0x74,0x56,0x37,0x17,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x86,0x86,0x86,
+	0x86,0x86,0x6d,0x4d,0x2d,0x0d,0x00,0x06,0x05,0x1c,0x37,0x54,0x66,0x5a,0x4d,0x4f,0x4e,0x3c,0x22,0x05,0x00,0x0d,0x16,0x36,0x56,0x74,0x68,0x48,0x28,0x22,0x2c,0x2b,
+	0x1f,0x0b,0x00,0x09,0x03,0x22,0x41,0x60,0x7f,0x8f,0x7c,0x5d,0x3f,0x1f,0x00,0x0a,0x03,0x23,0x42,0x60,0x7f,0x8f,0x7b,0x5d,0x3e,0x1f,0x00,0x10,0x08,0x27,0x46,0x65,
+	0x84,0x8f,0x77,0x58,0x3a,0x1a,0x00,0x0c,0x13,0x29,0x40,0x56,0x6c,0x66,0x4f,0x38,0x21,0x0b,0x00,0x0c,0x1e,0x3d,0x5c,0x7a,0x8f,0x80,0x61,0x43,0x24,0x05,0x00,0x0e,
+	0x17,0x35,0x51,0x61,0x56,0x3c,0x28,0x48,0x68,0x76,0x57,0x37,0x22,0x1a,0x21,0x1e,0x12,0x00,0x0a,0x0f,0x26,0x3c,0x52,0x69,0x6a,0x53,0x3c,0x25,0x0e,0x00,0x07,0x0d,
+	0x2d,0x4c,0x6b,0x75,0x75,0x6b,0x4c,0x2e,0x0f,0x00,0x03,0x0d,0x2d,0x4d,0x6d,0x7a,0x7a,0x6b,0x4b,0x2b,0x0c,0x15,0x35,0x55,0x74,0x7a,0x7a,0x63,0x44,0x24,0x04,0x00,
+	0x03,0x1e,0x3d,0x5c,0x75,0x75,0x75,0x5c,0x3c,0x1d,0x00,0x06,0x01,0x21,0x40,0x5f,0x7d,0x8f,0x7d,0x5e,0x3f,0x21,0x02,0x00,0x0f,0x07,0x25,0x44,0x63,0x82,0x8f,0x78,
+	0x5a,0x3b,0x1c,0x00,0x0c,0x11,0x28,0x3e,0x55,0x6b,0x68,0x51,0x3a,0x23,0x0c,0x00,0x0e,0x16,0x36,0x56,0x76,0x68,0x49,0x37,0x55,0x6e,0x6f,0x6f,0x5c,0x3e,0x1f,0x00,
+	0x02,0x04,0x23,0x43,0x60,0x6f,0x6f,0x6c,0x51,0x32,0x4d,0x6d,0x72,0x52,0x32,0x12,0x00,0x0c,0x04,0x21,0x3b,0x4f,0x64,0x77,0x59,0x49,0x32,0x16,0x00,0x0a,0x03,0x23,
+	0x42,0x61,0x7f,0x8f,0x7b,0x5c,0x3d,0x1f,0x00,0x0a,0x19,0x39,0x58,0x72,0x64,0x6a,0x6c,0x5f,0x73,0x66,0x70,0x66,0x48,0x28,0x1b,0x09,0x00,0x06,0x0e,0x25,0x35,0x39,
+	0x42,0x62,0x82,0x97,0x77,0x57,0x37,0x17,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x93,0x93,0x93,0x96,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x02,0x1d,0x39,0x50,0x58,0x58,0x57,
+	0x46,0x2b,0x0e,0x00,0x05,0x1b,0x37,0x4f,0x58,0x58,0x57,0x47,0x2d,0x10,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x9b,0x93,0x93,0x93,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x06,
+	0x15,0x31,0x4a,0x5b,0x78,0x6b,0x68,0x6b,0x69,0x4c,0x2d,0x0d,0x00,0x0d,0x13,0x32,0x4f,0x64,0x5d,0x43,0x2e,0x3e,0x4c,0x4a,0x38,0x1f,0x02,0x00,0x08,0x0c,0x2b,0x4a,
+	0x68,0x87,0x90,0x72,0x53,0x35,0x16,0x00,0x0b,0x1a,0x38,0x56,0x75,0x93,0x84,0x65,0x46,0x28,0x09,0x00,0x0f,0x11,0x30,0x4f,0x6d,0x8c,0x8b,0x6d,0x4e,0x30,0x12,0x00,
+	0x0b,0x13,0x29,0x40,0x56,0x6d,0x83,0x7d,0x66,0x4f,0x38,0x21,0x0a,0x00,0x0b,0x15,0x33,0x52,0x70,0x8e,0x89,0x6a,0x4b,0x2d,0x0e,0x00,0x0d,0x02,0x1b,0x3b,0x5b,0x7b,
+	0x63,0x49,0x34,0x3e,0x55,0x5b,0x5b,0x50,0x37,0x36,0x41,0x3d,0x2b,0x13,0x00,0x08,0x0f,0x26,0x3c,0x53,0x69,0x80,0x80,0x69,0x52,0x3b,0x24,0x0d,0x00,0x06,0x0b,0x2b,
+	0x49,0x68,0x86,0x93,0x74,0x55,0x36,0x18,0x00,0x03,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x02,
+	0x08,0x27,0x46,0x65,0x84,0x95,0x76,0x58,0x3a,0x1b,0x00,0x07,0x18,0x36,0x55,0x73,0x92,0x86,0x67,0x48,0x29,0x0a,0x00,0x0f,0x0f,0x2e,0x4d,0x6c,0x8b,0x8d,0x6e,0x50,
+	0x32,0x13,0x00,0x0b,0x12,0x28,0x3f,0x55,0x6c,0x82,0x7e,0x67,0x50,0x39,0x22,0x0b,0x00,0x0d,0x13,0x31,0x4d,0x62,0x5b,0x42,0x38,0x58,0x78,0x8f,0x81,0x61,0x41,0x21,
+	0x01,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x8f,0x74,0x54,0x34,0x46,0x5e,0x60,0x4a,0x2d,0x0e,0x00,0x0c,0x0b,0x2b,0x4a,0x68,0x6e,0x65,0x73,0x5d,0x3e,0x1f,0x00,0x0b,
+	0x1a,0x38,0x57,0x75,0x94,0x84,0x65,0x46,0x27,0x08,0x00,0x09,0x18,0x37,0x55,0x6b,0x6a,0x65,0x67,0x5c,0x6c,0x6d,0x6a,0x62,0x47,0x45,0x36,0x1f,0x03,0x00,0x04,0x01,
+	0x1f,0x3b,0x52,0x59,0x49,0x61,0x79,0x67,0x75,0x57,0x37,0x17,0x0d,0x00,0x06,0x04,0x24,0x43,0x62,0x73,0x73,0x73,0x73,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x02,0x0c,
+	0x23,0x33,0x38,0x38,0x37,0x2c,0x18,0x00,0x06,0x0a,0x22,0x32,0x38,0x38,0x38,0x2d,0x1a,0x01,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x73,0x73,0x73,0x69,0x4b,
+	0x2c,0x0c,0x00,0x06,0x1d,0x3c,0x5c,0x76,0x6e,0x72,0x6e,0x71,0x66,0x4b,0x2c,0x0c,0x00,0x0d,0x16,0x36,0x56,0x76,0x69,0x49,0x49,0x59,0x69,0x65,0x49,0x2b,0x0b,0x00,
+	0x08,0x15,0x34,0x52,0x71,0x90,0x86,0x67,0x49,0x2b,0x0f,0x0f,0x0b,0x00,0x09,0x10,0x2e,0x4c,0x6b,0x89,0x8d,0x6e,0x4f,0x30,0x12,0x00,0x0f,0x1a,0x39,0x57,0x76,0x95,
+	0x81,0x63,0x44,0x26,0x07,0x00,0x0a,0x11,0x2a,0x40,0x57,0x6d,0x84,0x94,0x93,0x7c,0x65,0x4e,0x37,0x20,0x06,0x00,0x0a,0x0b,0x29,0x47,0x66,0x84,0x92,0x73,0x54,0x35,
+	0x16,0x0f,0x0f,0x0f,0x0b,0x00,0x07,0x06,0x18,0x22,0x21,0x33,0x4e,0x5d,0x70,0x60,0x42,0x29,0x3e,0x5e,0x7b,0x60,0x40,0x4f,0x61,0x58,0x3f,0x22,0x03,0x00,0x06,0x0d,
+	0x26,0x3d,0x53,0x6a,0x80,0x96,0x97,0x80,0x69,0x52,0x3b,0x24,0x0f,0x0b,0x00,0x04,0x02,0x21,0x3f,0x5d,0x7c,0x9a,0x7d,0x5e,0x3f,0x20,0x01,0x00,0x02,0x0d,0x2d,0x4d,
+	0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x02,0x11,0x30,0x4f,0x6d,0x8c,0x8b,0x6c,0x4e,0x30,0x11,0x00,0x07,0x0e,
+	0x2c,0x4b,0x69,0x87,0x8e,0x70,0x51,0x32,0x13,0x00,0x0f,0x18,0x37,0x56,0x74,0x93,0x83,0x64,0x46,0x27,0x09,0x00,0x0a,0x10,0x29,0x3f,0x56,0x6c,0x82,0x95,0x94,0x7d,
+	0x66,0x4f,0x38,0x21,0x07,0x00,0x0c,0x16,0x36,0x56,0x76,0x69,0x49,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,
+	0x34,0x4d,0x6d,0x72,0x52,0x32,0x12,0x00,0x0c,0x0a,0x29,0x48,0x63,0x68,0x6c,0x6c,0x5a,0x3c,0x1d,0x00,0x09,0x0a,0x17,0x1a,0x2e,0x4d,0x6b,0x8a,0x8c,0x6d,0x4f,0x30,
+	0x1a,0x1a,0x18,0x0e,0x00,0x05,0x02,0x22,0x40,0x5b,0x67,0x6e,0x67,0x67,0x67,0x67,0x71,0x67,0x67,0x67,0x63,0x4b,0x2d,0x0e,0x00,0x04,0x06,0x26,0x46,0x66,0x76,0x58,
+	0x5c,0x6b,0x61,0x6a,0x53,0x39,0x36,0x28,0x11,0x00,0x06,0x1a,0x36,0x4c,0x53,0x53,0x53,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x09,0x15,0x18,0x18,0x18,0x10,
+	0x00,0x08,0x07,0x14,0x18,0x18,0x18,0x10,0x01,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x53,0x53,0x4f,0x3c,0x21,0x04,0x00,0x06,0x1b,0x39,0x56,0x69,0x6f,
+	0x65,0x63,0x5e,0x4b,0x39,0x20,0x0f,0x0f,0x0b,0x00,0x07,0x01,0x02,0x02,0x01,0x12,0x30,0x4c,0x5f,0x59,0x44,0x62,0x75,0x85,0x97,0xb4,0xd4,0xf3,0x00,0x08,0x1d,0x3c,
+	0x5b,0x7a,0x99,0x7c,0x5d,0x3f,0x2f,0x2f,0x2f,0x29,0x19,0x03,0x00,0x07,0x06,0x24,0x42,0x61,0x7f,0x95,0x77,0x58,0x39,0x1a,0x00,0x0e,0x03,0x22,0x41,0x60,0x7f,0x95,
+	0x77,0x59,0x3a,0x1c,0x00,0x0a,0x01,0x20,0x3e,0x57,0x6e,0x84,0x93,0x7d,0x85,0x92,0x7b,0x64,0x4d,0x31,0x13,0x00,0x0a,0x01,0x1f,0x3d,0x5c,0x7a,0x99,0x7c,0x5d,0x3e,
+	0x26,0x2f,0x2f,0x2f,0x29,0x19,0x03,0x00,0x04,0x02,0x1d,0x33,0x41,0x41,0x31,0x39,0x57,0x6e,0x5f,0x42,0x22,0x39,0x54,0x64,0x56,0x53,0x68,0x7c,0x99,0xb8,0xd8,0xf8,
+	0xff,0x00,0x05,0x1b,0x39,0x53,0x6a,0x80,0x97,0x81,0x81,0x96,0x7f,0x68,0x51,0x36,0x2f,0x29,0x19,0x03,0x00,0x03,0x17,0x35,0x53,0x72,0x90,0x85,0x66,0x48,0x29,0x0a,
+	0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x02,0x1a,0x38,0x57,0x76,0x95,0x81,0x62,0x44,
+	0x26,0x07,0x00,0x07,0x04,0x22,0x41,0x5f,0x7d,0x97,0x78,0x59,0x3b,0x1c,0x00,0x0e,0x02,0x21,0x40,0x5e,0x7d,0x97,0x79,0x5a,0x3c,0x1d,0x00,0x0b,0x1e,0x3c,0x56,0x6c,
+	0x83,0x95,0x7e,0x83,0x93,0x7d,0x66,0x4e,0x33,0x15,0x00,0x08,0x04,0x04,0x04,0x03,0x11,0x2f,0x4a,0x5d,0x57,0x3f,0x38,0x57,0x74,0x65,0x7e,0x9e,0xbe,0xde,0xfe,0x00,
+	0x01,0x05,0x25,0x45,0x65,0x85,0x96,0x8e,0xac,0xcb,0xbc,0xa6,0xa4,0xb8,0xd4,0xf2,0xfb,0xfb,0xfb,0xfc,0xff,0xff,0xff,0x00,0x05,0x01,0x1d,0x36,0x4a,0x62,0x71,0x57,
+	0x43,0x2d,0x12,0x00,0x08,0x0d,0x25,0x35,0x3a,0x3a,0x43,0x61,0x7f,0x95,0x76,0x57,0x39,0x3a,0x3a,0x38,0x2a,0x14,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x87,0x87,0x87,
+	0x87,0x87,0x87,0x87,0x87,0x87,0x71,0x51,0x31,0x11,0x00,0x04,0x0a,0x23,0x41,0x5b,0x64,0x71,0x62,0x82,0x97,0x77,0x57,0x58,0x54,0x3e,0x22,0x1a,0x0a,0x00,0x04,0x09,
+	0x1f,0x2e,0x33,0x33,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x1b,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x33,0x31,0x23,0x0f,0x00,0x07,0x12,0x32,0x52,
+	0x72,0x6d,0x65,0x79,0x65,0x51,0x34,0x2f,0x2f,0x2f,0x29,0x19,0x03,0x00,0x03,0x03,0x16,0x21,0x21,0x21,0x20,0x15,0x1f,0x34,0x40,0x3d,0x44,0x62,0x6e,0x5e,0x4e,0x3b,
+	0x21,0x04,0x00,0x07,0x01,0x21,0x41,0x61,0x7b,0x7b,0x72,0x53,0x42,0x4f,0x4f,0x4f,0x46,0x30,0x15,0x00,0x08,0x1a,0x38,0x57,0x75,0x7b,0x7b,0x5e,0x3e,0x1e,0x00,0x0e,
+	0x06,0x26,0x46,0x66,0x7b,0x7b,0x6d,0x4f,0x30,0x12,0x00,0x0a,0x05,0x25,0x45,0x65,0x7e,0x7e,0x7c,0x66,0x6e,0x7e,0x7e,0x78,0x58,0x38,0x18,0x00,0x0b,0x15,0x33,0x52,
+	0x70,0x7b,0x7b,0x63,0x43,0x42,0x4f,0x4f,0x4f,0x46,0x30,0x15,0x00,0x04,0x0e,0x2c,0x49,0x60,0x5e,0x4d,0x46,0x42,0x4e,0x47,0x32,0x18,0x27,0x3b,0x44,0x45,0x65,0x80,
+	0x95,0xaa,0xc2,0xdf,0xfd,0xff,0x00,0x05,0x20,0x40,0x60,0x7e,0x7e,0x7e,0x6a,0x6a,0x7e,0x7e,0x7d,0x5d,0x4f,0x4f,0x46,0x30,0x15,0x00,0x03,0x0d,0x2b,0x49,0x68,0x86,
+	0x8e,0x6f,0x50,0x32,0x12,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x01,0x03,0x22,0x41,
+	0x60,0x7f,0x95,0x77,0x58,0x3a,0x1c,0x00,0x09,0x18,0x37,0x55,0x73,0x7b,0x7b,0x5f,0x40,0x20,0x00,0x0e,0x05,0x25,0x45,0x64,0x7b,0x7b,0x6e,0x50,0x32,0x13,0x00,0x0a,
+	0x04,0x24,0x44,0x64,0x7e,0x7e,0x7e,0x67,0x6d,0x7e,0x7e,0x79,0x59,0x39,0x19,0x00,0x06,0x05,0x18,0x23,0x24,0x24,0x23,0x17,0x1d,0x32,0x3d,0x3a,0x2a,0x2e,0x47,0x56,
+	0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0xa5,0xaa,0xbb,0xd5,0xd2,0xc4,0xc2,0xcf,0xe5,0xe5,0xdb,0xdc,0xdb,0xdd,0xe9,0xfd,0xff,0x00,0x05,
+	0x02,0x21,0x41,0x60,0x73,0x73,0x70,0x55,0x36,0x16,0x00,0x08,0x1d,0x3a,0x52,0x5a,0x5a,0x59,0x57,0x75,0x7b,0x7b,0x5d,0x55,0x5a,0x5a,0x56,0x41,0x25,0x07,0x00,0x03,
+	0x05,0x25,0x45,0x65,0x85,0x9b,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x91,0x71,0x51,0x31,0x11,0x00,0x03,0x05,0x20,0x37,0x46,0x44,0x59,0x6e,0x62,0x82,0x97,0x77,0x57,
+	0x74,0x69,0x4a,0x42,0x37,0x22,0x08,0x00,0x04,0x04,0x10,0x13,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x1b,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,
+	0x13,0x11,0x08,0x00,0x08,0x0e,0x2d,0x4a,0x60,0x5e,0x70,0x6d,0x76,0x58,0x42,0x4f,0x4f,0x4f,0x46,0x30,0x15,0x00,0x03,0x19,0x30,0x40,0x41,0x41,0x3f,0x2f,0x18,0x18,
+	0x20,0x1e,0x35,0x49,0x4f,0x42,0x33,0x22,0x0e,0x00,0x09,0x1b,0x37,0x56,0x74,0x68,0x59,0x46,0x56,0x6e,0x6f,0x6f,0x5c,0x3e,0x1f,0x00,0x08,0x10,0x2d,0x48,0x5a,0x74,
+	0x68,0x4e,0x35,0x17,0x00,0x0e,0x01,0x1f,0x3c,0x56,0x74,0x68,0x57,0x41,0x26,0x08,0x00,0x0a,0x01,0x1f,0x3d,0x55,0x5e,0x5e,0x5e,0x74,0x68,0x5e,0x5e,0x5e,0x4c,0x30,
+	0x12,0x00,0x0b,0x0b,0x29,0x44,0x58,0x74,0x68,0x51,0x39,0x56,0x6e,0x6f,0x6f,0x5c,0x3e,0x1f,0x00,0x04,0x11,0x31,0x51,0x71,0x6d,0x6c,0x5f,0x42,0x2e,0x2a,0x1b,0x05,
+	0x0f,0x1e,0x24,0x3e,0x59,0x63,0x52,0x3d,0x28,0x11,0x00,0x07,0x1b,0x38,0x52,0x5e,0x5e,0x5e,0x74,0x68,0x5e,0x5e,0x5e,0x6e,0x6f,0x6f,0x5c,0x3e,0x1f,0x00,0x03,0x03,
+	0x21,0x3f,0x5e,0x75,0x75,0x70,0x53,0x34,0x14,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,
+	0x01,0x04,0x24,0x44,0x63,0x75,0x75,0x6c,0x4e,0x34,0x17,0x00,0x09,0x0e,0x2c,0x47,0x59,0x75,0x69,0x4f,0x36,0x19,0x00,0x0f,0x1e,0x3a,0x55,0x75,0x69,0x57,0x43,0x27,
+	0x09,0x00,0x0b,0x1e,0x3b,0x54,0x5e,0x5e,0x5e,0x75,0x69,0x5e,0x5e,0x5e,0x4d,0x32,0x14,0x00,0x06,0x1b,0x32,0x42,0x43,0x43,0x42,0x32,0x1a,0x16,0x1e,0x1b,0x10,0x24,
+	0x3a,0x45,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0xa5,0xbb,0xc8,0xde,0xed,0xe3,0xe2,0xeb,0xe2,0xca,0xbc,0xbd,0xbb,0xbe,0xd0,0xe8,0xff,
+	0x00,0x05,0x02,0x22,0x42,0x62,0x82,0x93,0x77,0x57,0x37,0x17,0x00,0x07,0x05,0x25,0x45,0x64,0x7a,0x7a,0x74,0x55,0x5a,0x5b,0x5b,0x4e,0x6b,0x7a,0x7a,0x6c,0x4d,0x2d,
+	0x0d,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x6c,0x4f,0x30,0x10,0x00,0x03,0x0f,0x2e,0x4c,0x64,0x61,0x67,0x5c,0x62,0x82,
+	0x97,0x77,0x57,0x63,0x62,0x62,0x61,0x4f,0x33,0x14,0x00,0x06,0x0c,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x1b,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,
+	0x33,0x13,0x00,0x0a,0x03,0x1d,0x34,0x42,0x56,0x74,0x68,0x59,0x49,0x56,0x6e,0x6f,0x6f,0x5c,0x3e,0x1f,0x00,0x02,0x0a,0x28,0x45,0x5d,0x5f,0x60,0x5c,0x44,0x27,0x08,
+	0x00,0x01,0x08,0x1d,0x2c,0x2f,0x26,0x17,0x07,0x00,0x0a,0x13,0x32,0x4f,0x65,0x5e,0x43,0x39,0x59,0x79,0x8f,0x81,0x61,0x41,0x21,0x01,0x00,0x07,0x02,0x1b,0x32,0x4f,
+	0x64,0x5d,0x43,0x25,0x08,0x00,0x0f,0x13,0x32,0x4f,0x64,0x5d,0x43,0x2b,0x15,0x00,0x0c,0x10,0x28,0x39,0x3e,0x3e,0x4f,0x64,0x5d,0x43,0x3e,0x3e,0x33,0x1f,0x05,0x00,
+	0x0c,0x17,0x32,0x4f,0x65,0x5e,0x43,0x39,0x59,0x79,0x8f,0x81,0x61,0x41,0x21,0x01,0x00,0x03,0x0c,0x29,0x45,0x59,0x58,0x71,0x61,0x43,0x23,0x0b,0x00,0x02,0x03,0x13,
+	0x1a,0x2b,0x3d,0x43,0x39,0x25,0x12,0x02,0x00,0x07,0x0c,0x25,0x37,0x3e,0x3e,0x4f,0x65,0x5e,0x43,0x3e,0x59,0x79,0x8f,0x81,0x61,0x41,0x21,0x01,0x00,0x02,0x01,0x21,
+	0x41,0x61,0x7a,0x7a,0x77,0x59,0x39,0x19,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x02,
+	0x1c,0x3c,0x5c,0x79,0x7a,0x7a,0x5d,0x3d,0x1d,0x00,0x0a,0x1a,0x30,0x4d,0x61,0x5b,0x42,0x25,0x0a,0x00,0x0f,0x12,0x30,0x4d,0x61,0x5b,0x42,0x2c,0x16,0x00,0x0c,0x0f,
+	0x27,0x39,0x3e,0x3e,0x4d,0x61,0x5b,0x42,0x3e,0x3e,0x34,0x20,0x06,0x00,0x05,0x0a,0x29,0x47,0x5f,0x61,0x62,0x5f,0x46,0x28,0x09,0x00,0x02,0x16,0x34,0x51,0x64,0x5e,
+	0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0xa2,0x9c,0xb2,0xcf,0xed,0xff,0xff,0xf1,0xd3,0xb5,0x9e,0x9f,0x9c,0xa2,0xbc,0xda,0xf9,0x00,0x05,0x16,
+	0x2a,0x42,0x62,0x82,0x97,0x77,0x57,0x37,0x17,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x3a,0x3b,0x3b,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x03,
+	0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x52,0x52,0x52,0x52,0x52,0x52,0x50,0x3e,0x25,0x08,0x00,0x03,0x12,0x32,0x51,0x70,0x6b,0x75,0x65,0x62,0x82,0x97,0x77,0x57,
+	0x61,0x7d,0x7d,0x78,0x58,0x38,0x18,0x00,0x06,0x0c,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x05,0x04,0x07,0x05,0x07,0x01,0x00,0x07,0x04,0x07,0x06,0x07,
+	0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x0b,0x07,0x19,0x32,0x4f,0x65,0x5e,0x43,0x39,0x59,0x79,0x8f,0x81,0x61,0x41,0x21,0x01,0x00,0x01,
+	0x0d,0x2d,0x4d,0x6d,0x71,0x73,0x6b,0x4c,0x2c,0x0c,0x00,0x02,0x07,0x12,0x15,0x0e,0x00,0x0c,0x16,0x36,0x56,0x76,0x69,0x49,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,
+	0x01,0x00,0x08,0x16,0x36,0x56,0x76,0x69,0x49,0x29,0x09,0x00,0x0f,0x16,0x36,0x56,0x76,0x69,0x49,0x29,0x09,0x00,0x0d,0x0e,0x1b,0x1e,0x36,0x56,0x76,0x69,0x49,0x29,
+	0x1e,0x17,0x07,0x00,0x0d,0x16,0x36,0x56,0x76,0x69,0x49,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,0x04,0x18,0x2e,0x3a,0x45,0x52,0x4b,0x35,0x1a,0x00,0x02,
+	0x02,0x1b,0x2f,0x3a,0x3b,0x3b,0x3b,0x3b,0x3a,0x2e,0x19,0x00,0x08,0x0c,0x19,0x1e,0x36,0x56,0x76,0x69,0x49,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,0x02,
+	0x01,0x21,0x41,0x61,0x81,0x99,0x79,0x59,0x39,0x19,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x15,0x35,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,
+	0x00,0x02,0x1c,0x3c,0x5c,0x7c,0x9a,0x7e,0x5e,0x3e,0x1e,0x00,0x0a,0x15,0x35,0x55,0x75,0x69,0x49,0x29,0x09,0x00,0x0f,0x15,0x35,0x55,0x75,0x69,0x49,0x29,0x09,0x00,
+	0x0d,0x0d,0x1a,0x1e,0x35,0x55,0x75,0x69,0x49,0x29,0x1e,0x17,0x08,0x00,0x06,0x0d,0x2d,0x4d,0x6d,0x71,0x71,0x6c,0x4c,0x2c,0x0c,0x00,0x02,0x19,0x39,0x59,0x77,0x65,
+	0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x96,0x8b,0xaa,0xca,0xea,0xff,0xff,0xee,0xce,0xaf,0x8f,0x92,0x8a,0x97,0xb6,0xd6,0xf6,0x00,0x04,0x13,
+	0x2d,0x43,0x57,0x6b,0x82,0x97,0x77,0x57,0x37,0x17,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x1b,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,
+	0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x32,0x32,0x32,0x32,0x32,0x31,0x25,0x11,0x00,0x04,0x0b,0x28,0x43,0x55,0x54,0x57,0x50,0x62,0x82,0x97,0x77,0x57,
+	0x52,0x5d,0x5d,0x5c,0x4b,0x30,0x13,0x00,0x06,0x0c,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x04,0x14,0x23,0x27,0x24,0x27,0x1f,0x0e,0x00,0x04,0x01,0x16,
+	0x23,0x27,0x25,0x27,0x1d,0x0c,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x0c,0x16,0x36,0x56,0x76,0x69,0x49,0x39,0x59,0x79,0x99,0x81,0x61,
+	0x41,0x21,0x01,0x00,0x01,0x08,0x26,0x42,0x58,0x5a,0x5b,0x57,0x41,0x25,0x07,0x06,0x0b,0x22,0x31,0x35,0x2b,0x1c,0x0c,0x00,0x07,0x01,0x01,0x00,0x01,0x12,0x30,0x4c,
+	0x5f,0x59,0x41,0x39,0x58,0x74,0x64,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x04,0x01,0x12,0x1c,0x1d,0x1d,0x30,0x4b,0x5e,0x58,0x40,0x23,0x1d,0x1d,0x18,0x0b,0x00,0x08,0x01,
+	0x12,0x1c,0x1d,0x1d,0x30,0x4b,0x5e,0x58,0x40,0x23,0x1d,0x1d,0x18,0x0b,0x00,0x08,0x01,0x12,0x1c,0x1d,0x1d,0x30,0x4b,0x5e,0x58,0x40,0x23,0x1d,0x1d,0x18,0x0b,0x00,
+	0x09,0x01,0x01,0x00,0x01,0x12,0x30,0x4c,0x5f,0x59,0x41,0x39,0x58,0x74,0x64,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x03,0x03,0x18,0x25,0x29,0x2b,0x32,0x2d,0x1e,0x08,0x00,
+	0x02,0x10,0x2e,0x49,0x5a,0x5b,0x5b,0x5b,0x5b,0x59,0x47,0x2c,0x0e,0x00,0x06,0x01,0x01,0x00,0x01,0x12,0x30,0x4c,0x5f,0x59,0x41,0x39,0x58,0x74,0x64,0x7e,0x9e,0xbe,
+	0xde,0xfe,0x00,0x02,0x01,0x21,0x41,0x61,0x81,0x99,0x79,0x59,0x39,0x19,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x71,0x71,0x6a,0x4b,0x2b,0x0b,0x15,0x35,0x54,0x73,0x69,0x7b,
+	0x9b,0xbb,0xdb,0xfb,0x00,0x02,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x06,0x02,0x02,0x03,0x02,0x10,0x2e,0x49,0x5b,0x56,0x3f,0x23,0x04,0x03,0x01,0x03,
+	0x00,0x08,0x02,0x02,0x03,0x02,0x10,0x2e,0x49,0x5b,0x56,0x3f,0x23,0x04,0x03,0x01,0x03,0x00,0x08,0x02,0x02,0x03,0x02,0x10,0x2e,0x49,0x5b,0x56,0x3f,0x23,0x04,0x03,
+	0x01,0x03,0x00,0x05,0x07,0x25,0x41,0x56,0x58,0x58,0x56,0x40,0x25,0x07,0x07,0x06,0x13,0x30,0x4a,0x5a,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x01,0x05,0x25,0x45,0x65,
+	0x85,0xa5,0xa6,0xb8,0xd3,0xf0,0xf9,0xf8,0xf4,0xd7,0xbb,0xa8,0xa9,0xa6,0xab,0xc1,0xde,0xfc,0x00,0x04,0x20,0x3e,0x5a,0x70,0x84,0x98,0x8c,0x76,0x57,0x37,0x17,0x00,
+	0x07,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x26,
+	0x26,0x26,0x20,0x12,0x11,0x09,0x00,0x06,0x16,0x2a,0x36,0x35,0x37,0x42,0x62,0x82,0x97,0x77,0x57,0x3c,0x43,0x3d,0x3c,0x32,0x1e,0x05,0x00,0x06,0x0c,0x2c,0x4c,0x6c,
+	0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x12,0x2c,0x40,0x47,0x43,0x47,0x3a,0x24,0x09,0x00,0x03,0x15,0x2e,0x41,0x47,0x44,0x46,0x39,0x22,0x06,0x00,0x03,0x05,0x25,
+	0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x09,0x01,0x01,0x00,0x01,0x12,0x30,0x4c,0x5f,0x59,0x41,0x39,0x58,0x74,0x64,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x02,0x16,
+	0x2c,0x3a,0x3b,0x3c,0x3a,0x2b,0x14,0x1d,0x26,0x23,0x38,0x4e,0x54,0x47,0x37,0x27,0x11,0x00,0x03,0x03,0x15,0x20,0x20,0x21,0x1f,0x14,0x1f,0x34,0x40,0x3d,0x2c,0x2e,
+	0x47,0x55,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x02,0x03,0x16,0x21,0x2e,0x3b,0x3d,0x3d,0x3d,0x3d,0x3f,0x3d,0x3d,0x3d,0x3d,0x3d,0x37,0x25,0x1d,0x0f,0x00,0x04,0x03,
+	0x16,0x21,0x2e,0x3b,0x3d,0x3d,0x3d,0x3d,0x3f,0x3d,0x3d,0x3d,0x3d,0x3d,0x37,0x25,0x1d,0x0f,0x00,0x04,0x03,0x16,0x21,0x2e,0x3b,0x3d,0x3d,0x3d,0x3d,0x3f,0x3d,0x3d,
+	0x3d,0x3d,0x3d,0x37,0x25,0x1d,0x0f,0x00,0x04,0x03,0x15,0x20,0x20,0x21,0x1f,0x14,0x1f,0x34,0x40,0x3d,0x2c,0x2e,0x47,0x55,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x03,
+	0x16,0x30,0x43,0x49,0x49,0x4c,0x3d,0x25,0x09,0x00,0x02,0x17,0x37,0x56,0x75,0x7b,0x7b,0x7b,0x7b,0x73,0x54,0x34,0x14,0x00,0x03,0x03,0x15,0x20,0x20,0x21,0x1f,0x14,
+	0x1f,0x34,0x40,0x3d,0x2c,0x2e,0x47,0x55,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x02,0x01,0x21,0x41,0x61,0x81,0x99,0x79,0x59,0x39,0x19,0x00,0x02,0x08,0x26,0x43,0x59,
+	0x5a,0x56,0x53,0x3e,0x23,0x27,0x25,0x2b,0x46,0x57,0x5b,0x7b,0x9b,0xbb,0xdb,0xfb,0x00,0x02,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x04,0x04,0x16,0x21,
+	0x22,0x22,0x21,0x16,0x1c,0x30,0x3c,0x39,0x29,0x12,0x1b,0x23,0x20,0x23,0x1f,0x11,0x00,0x04,0x04,0x16,0x21,0x22,0x22,0x21,0x16,0x1c,0x30,0x3c,0x39,0x29,0x12,0x1b,
+	0x23,0x20,0x23,0x1f,0x11,0x00,0x04,0x04,0x16,0x21,0x22,0x22,0x21,0x16,0x1c,0x30,0x3c,0x39,0x29,0x12,0x1b,0x23,0x20,0x23,0x1f,0x11,0x00,0x04,0x14,0x2a,0x38,0x39,
+	0x39,0x38,0x29,0x13,0x1f,0x27,0x25,0x18,0x1e,0x33,0x3e,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0xa5,0xc3,0xcf,0xe4,0xe5,0xd9,0xd8,0xe2,
+	0xe8,0xd3,0xc6,0xc7,0xc5,0xc8,0xd8,0xee,0xff,0x00,0x03,0x02,0x22,0x42,0x61,0x76,0x62,0x77,0x8b,0xa0,0xb5,0xd0,0xee,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x05,
+	0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x46,0x46,0x46,0x46,
+	0x3d,0x28,0x0e,0x00,0x08,0x0e,0x17,0x16,0x21,0x41,0x60,0x74,0x67,0x76,0x57,0x56,0x63,0x54,0x39,0x1a,0x06,0x00,0x07,0x0c,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,
+	0x0d,0x00,0x03,0x1f,0x3d,0x59,0x67,0x5e,0x66,0x51,0x33,0x14,0x00,0x02,0x02,0x22,0x40,0x5c,0x67,0x60,0x65,0x4e,0x30,0x12,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x93,
+	0x73,0x53,0x33,0x13,0x00,0x06,0x03,0x15,0x20,0x20,0x21,0x1f,0x14,0x1f,0x34,0x40,0x3d,0x2c,0x2e,0x47,0x55,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x03,0x11,0x1b,0x1c,
+	0x1c,0x1b,0x10,0x23,0x39,0x45,0x42,0x46,0x64,0x73,0x63,0x53,0x3e,0x23,0x06,0x00,0x02,0x19,0x30,0x3f,0x40,0x40,0x3e,0x2f,0x17,0x18,0x20,0x1e,0x12,0x22,0x37,0x41,
+	0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x02,0x19,0x30,0x40,0x45,0x59,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x52,0x42,0x3b,0x27,0x0e,0x00,0x03,0x19,0x30,
+	0x40,0x45,0x59,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x52,0x42,0x3b,0x27,0x0e,0x00,0x03,0x19,0x30,0x40,0x45,0x59,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,
+	0x5d,0x5d,0x5d,0x52,0x42,0x3b,0x27,0x0e,0x00,0x03,0x19,0x30,0x3f,0x40,0x40,0x3e,0x2f,0x17,0x18,0x20,0x1e,0x12,0x22,0x37,0x41,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,
+	0x02,0x04,0x23,0x41,0x5d,0x68,0x64,0x6a,0x51,0x32,0x13,0x00,0x02,0x17,0x37,0x57,0x77,0x97,0x9b,0x9b,0x94,0x74,0x54,0x34,0x14,0x00,0x03,0x19,0x30,0x3f,0x40,0x40,
+	0x3e,0x2f,0x17,0x18,0x20,0x1e,0x12,0x22,0x37,0x41,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x02,0x01,0x21,0x41,0x61,0x81,0x99,0x79,0x59,0x39,0x19,0x00,0x03,0x16,0x2c,
+	0x3b,0x3c,0x37,0x35,0x27,0x39,0x47,0x44,0x33,0x33,0x3f,0x5b,0x7b,0x9b,0xbb,0xdb,0xfb,0x00,0x02,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x04,0x1a,0x31,
+	0x40,0x42,0x42,0x40,0x30,0x18,0x14,0x1c,0x1a,0x0f,0x21,0x37,0x42,0x3f,0x43,0x3d,0x2a,0x11,0x00,0x03,0x1a,0x31,0x40,0x42,0x42,0x40,0x30,0x18,0x14,0x1c,0x1a,0x0f,
+	0x21,0x37,0x42,0x3f,0x43,0x3d,0x2a,0x11,0x00,0x03,0x1a,0x31,0x40,0x42,0x42,0x40,0x30,0x18,0x14,0x1c,0x1a,0x0f,0x21,0x37,0x42,0x3f,0x43,0x3d,0x2a,0x11,0x00,0x04,
+	0x0e,0x19,0x19,0x19,0x18,0x0e,0x24,0x3a,0x47,0x43,0x31,0x31,0x4c,0x5c,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0xa5,0xa4,0xb7,0xd2,0xcb,
+	0xba,0xb9,0xc7,0xdf,0xef,0xe6,0xe6,0xe5,0xe7,0xf3,0xff,0xff,0x00,0x03,0x09,0x1a,0x36,0x4d,0x5c,0x7b,0x8f,0xa4,0xb8,0xcd,0xe2,0xeb,0xeb,0xeb,0xef,0xfc,0xff,0xff,
+	0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x66,0x66,
+	0x66,0x66,0x66,0x55,0x39,0x1b,0x00,0x07,0x02,0x0e,0x11,0x11,0x20,0x40,0x5e,0x6f,0x5f,0x68,0x52,0x60,0x7c,0x5e,0x3e,0x1e,0x00,0x08,0x0c,0x2c,0x4c,0x6c,0x8c,0x8d,
+	0x6d,0x4d,0x2d,0x0d,0x00,0x02,0x02,0x22,0x41,0x61,0x77,0x67,0x74,0x56,0x37,0x17,0x00,0x02,0x05,0x24,0x44,0x64,0x76,0x69,0x72,0x53,0x34,0x14,0x00,0x03,0x05,0x25,
+	0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x06,0x19,0x30,0x3f,0x40,0x40,0x3e,0x2f,0x17,0x18,0x20,0x1e,0x12,0x22,0x37,0x41,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,
+	0x07,0x11,0x25,0x32,0x4f,0x65,0x5d,0x43,0x5f,0x70,0x80,0x94,0xb3,0xd3,0xf3,0x00,0x01,0x09,0x28,0x45,0x5c,0x5e,0x5f,0x5b,0x44,0x26,0x08,0x00,0x02,0x16,0x34,0x50,
+	0x61,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x01,0x0a,0x28,0x45,0x5d,0x5f,0x70,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x62,0x62,0x54,0x39,0x1b,0x00,0x02,
+	0x0a,0x28,0x45,0x5d,0x5f,0x70,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x62,0x62,0x54,0x39,0x1b,0x00,0x02,0x0a,0x28,0x45,0x5d,0x5f,0x70,0x7d,0x7d,0x7d,
+	0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x62,0x62,0x54,0x39,0x1b,0x00,0x02,0x09,0x28,0x45,0x5c,0x5e,0x5f,0x5b,0x44,0x26,0x08,0x00,0x02,0x16,0x34,0x50,0x61,0x5e,0x7e,
+	0x9e,0xbe,0xde,0xfe,0x00,0x02,0x05,0x25,0x45,0x64,0x74,0x67,0x6e,0x52,0x33,0x13,0x06,0x00,0x01,0x17,0x37,0x57,0x77,0x7e,0x7e,0x84,0x94,0x74,0x54,0x34,0x14,0x00,
+	0x02,0x09,0x28,0x45,0x5c,0x5e,0x5f,0x5b,0x44,0x26,0x08,0x00,0x02,0x16,0x34,0x50,0x61,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x02,0x01,0x21,0x41,0x61,0x81,0x99,0x79,
+	0x59,0x39,0x19,0x00,0x04,0x11,0x1b,0x1c,0x17,0x16,0x31,0x4e,0x65,0x60,0x46,0x4b,0x5e,0x5b,0x7b,0x9b,0xbb,0xdb,0xfb,0x00,0x02,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,
+	0x3e,0x1e,0x00,0x03,0x0a,0x29,0x46,0x5e,0x60,0x61,0x5d,0x44,0x27,0x08,0x00,0x02,0x13,0x31,0x4e,0x62,0x5b,0x63,0x57,0x3d,0x1f,0x00,0x02,0x0a,0x29,0x46,0x5e,0x60,
+	0x61,0x5d,0x44,0x27,0x08,0x00,0x02,0x13,0x31,0x4e,0x62,0x5b,0x63,0x57,0x3d,0x1f,0x00,0x02,0x0a,0x29,0x46,0x5e,0x60,0x61,0x5d,0x44,0x27,0x08,0x00,0x02,0x13,0x31,
+	0x4e,0x62,0x5b,0x63,0x57,0x3d,0x1f,0x00,0x09,0x14,0x33,0x50,0x66,0x5f,0x44,0x38,0x58,0x78,0x66,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,
+	0x8b,0xab,0xcb,0xb7,0x9e,0x9b,0xb3,0xd0,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x02,0x10,0x25,0x32,0x33,0x37,0x53,0x63,0x57,0x43,0x2e,0x1a,0x2b,0x34,0x34,
+	0x34,0x2e,0x1d,0x06,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x05,0x25,0x45,0x65,0x85,
+	0x95,0x86,0x86,0x86,0x86,0x86,0x7e,0x5e,0x3e,0x1e,0x00,0x06,0x07,0x1d,0x2c,0x31,0x31,0x30,0x42,0x62,0x82,0x97,0x77,0x57,0x50,0x5c,0x4f,0x35,0x27,0x15,0x00,0x07,
+	0x0c,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x1a,0x36,0x4e,0x58,0x51,0x57,0x47,0x2d,0x10,0x00,0x03,0x1c,0x39,0x50,0x57,0x53,0x56,0x45,0x2a,0x0d,
+	0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x05,0x09,0x28,0x45,0x5c,0x5e,0x5f,0x5b,0x44,0x26,0x08,0x00,0x02,0x16,0x34,0x50,0x61,0x5e,0x7e,
+	0x9e,0xbe,0xde,0xfe,0x00,0x06,0x07,0x24,0x3e,0x50,0x56,0x74,0x68,0x48,0x45,0x55,0x64,0x61,0x47,0x29,0x0a,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x72,0x73,0x6c,0x4c,0x2c,
+	0x0c,0x00,0x02,0x1a,0x3a,0x5a,0x7a,0x65,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x71,0x61,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,
+	0x7d,0x60,0x40,0x20,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x71,0x61,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x7d,0x60,0x40,0x20,0x00,0x02,0x0d,0x2d,0x4d,
+	0x6d,0x71,0x61,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x7d,0x60,0x40,0x20,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x72,0x73,0x6c,0x4c,0x2c,0x0c,0x00,0x02,
+	0x1a,0x3a,0x5a,0x7a,0x65,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x03,0x1d,0x38,0x4f,0x5d,0x60,0x50,0x40,0x36,0x31,0x21,0x0a,0x12,0x30,0x4b,0x5d,0x5e,0x64,0x84,0x94,0x74,
+	0x54,0x34,0x14,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x72,0x73,0x6c,0x4c,0x2c,0x0c,0x00,0x02,0x1a,0x3a,0x5a,0x7a,0x65,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x02,0x01,0x21,0x41,
+	0x61,0x81,0x99,0x79,0x59,0x39,0x19,0x00,0x07,0x07,0x14,0x34,0x53,0x71,0x69,0x4a,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x02,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,
+	0x5e,0x3e,0x1e,0x00,0x03,0x0d,0x2d,0x4d,0x6d,0x71,0x73,0x6b,0x4c,0x2c,0x0c,0x00,0x02,0x17,0x37,0x57,0x76,0x68,0x7a,0x63,0x43,0x23,0x03,0x00,0x01,0x0d,0x2d,0x4d,
+	0x6d,0x71,0x73,0x6b,0x4c,0x2c,0x0c,0x00,0x02,0x17,0x37,0x57,0x76,0x68,0x7a,0x63,0x43,0x23,0x03,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x71,0x73,0x6b,0x4c,0x2c,0x0c,0x00,
+	0x02,0x17,0x37,0x57,0x76,0x68,0x7a,0x63,0x43,0x23,0x03,0x00,0x08,0x16,0x36,0x55,0x73,0x67,0x48,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x01,0x05,0x25,
+	0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x4c,0x6b,0x70,0x51,0x32,0x12,0x00,0x08,0x05,0x23,0x3d,0x51,0x52,0x53,0x50,0x43,0x3d,0x2a,0x16,0x2d,0x46,0x54,0x54,0x54,0x4a,
+	0x32,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x9a,0x90,
+	0x90,0x90,0x90,0x90,0x7e,0x5e,0x3e,0x1e,0x00,0x06,0x1a,0x35,0x4a,0x51,0x51,0x50,0x42,0x62,0x82,0x97,0x77,0x57,0x45,0x4f,0x48,0x4f,0x42,0x2b,0x0f,0x00,0x06,0x0c,
+	0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x09,0x21,0x32,0x38,0x34,0x37,0x2d,0x1a,0x01,0x00,0x03,0x0c,0x23,0x33,0x37,0x35,0x37,0x2c,0x17,0x00,0x04,
+	0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x05,0x0d,0x2d,0x4d,0x6d,0x72,0x73,0x6c,0x4c,0x2c,0x0c,0x00,0x02,0x1a,0x3a,0x5a,0x7a,0x65,0x7e,0x9e,0xbe,
+	0xde,0xfe,0x00,0x06,0x13,0x31,0x4e,0x6b,0x6b,0x6b,0x61,0x45,0x29,0x39,0x46,0x45,0x34,0x1c,0x00,0x02,0x08,0x27,0x43,0x59,0x5b,0x5b,0x58,0x42,0x25,0x07,0x05,0x03,
+	0x15,0x32,0x4d,0x5d,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x01,0x08,0x26,0x42,0x58,0x5a,0x6f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x5e,0x3e,
+	0x1e,0x00,0x02,0x08,0x26,0x42,0x58,0x5a,0x6f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x5e,0x3e,0x1e,0x00,0x02,0x08,0x26,0x42,0x58,0x5a,0x6f,
+	0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x5e,0x3e,0x1e,0x00,0x02,0x08,0x27,0x43,0x59,0x5b,0x5b,0x58,0x42,0x25,0x07,0x05,0x03,0x15,0x32,0x4d,
+	0x5d,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x03,0x0c,0x2c,0x4c,0x6c,0x72,0x53,0x48,0x56,0x4e,0x37,0x1c,0x26,0x25,0x33,0x3e,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,
+	0x00,0x02,0x08,0x27,0x43,0x59,0x5b,0x5b,0x58,0x42,0x25,0x07,0x05,0x03,0x15,0x32,0x4d,0x5d,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x02,0x01,0x21,0x41,0x61,0x81,0x99,
+	0x79,0x59,0x39,0x19,0x00,0x05,0x06,0x16,0x25,0x2c,0x32,0x51,0x6a,0x64,0x48,0x55,0x75,0x95,0x84,0x64,0x44,0x24,0x04,0x00,0x02,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,
+	0x3e,0x1e,0x00,0x03,0x08,0x26,0x42,0x58,0x59,0x5a,0x57,0x41,0x24,0x06,0x04,0x02,0x11,0x2e,0x49,0x5b,0x55,0x5c,0x52,0x39,0x1c,0x00,0x02,0x08,0x26,0x42,0x58,0x59,
+	0x5a,0x57,0x41,0x24,0x06,0x04,0x02,0x11,0x2e,0x49,0x5b,0x55,0x5c,0x52,0x39,0x1c,0x00,0x02,0x08,0x26,0x42,0x58,0x59,0x5a,0x57,0x41,0x24,0x06,0x04,0x02,0x11,0x2e,
+	0x49,0x5b,0x55,0x5c,0x52,0x39,0x1c,0x00,0x09,0x15,0x34,0x53,0x6c,0x63,0x46,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,
+	0x74,0x54,0x34,0x4a,0x66,0x69,0x4f,0x30,0x11,0x00,0x08,0x0d,0x2d,0x4c,0x6a,0x6e,0x6f,0x69,0x4a,0x2b,0x11,0x19,0x38,0x58,0x73,0x74,0x74,0x5e,0x3f,0x1f,0x00,0x02,
+	0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x70,0x70,0x70,0x70,
+	0x6f,0x5a,0x3c,0x1d,0x00,0x05,0x04,0x24,0x43,0x61,0x71,0x71,0x6d,0x53,0x62,0x82,0x97,0x77,0x57,0x5b,0x6f,0x60,0x6e,0x57,0x38,0x19,0x00,0x06,0x0c,0x2c,0x4c,0x6c,
+	0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x04,0x07,0x13,0x18,0x15,0x17,0x10,0x01,0x00,0x05,0x08,0x14,0x17,0x16,0x17,0x0f,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x93,0x73,
+	0x53,0x33,0x13,0x00,0x05,0x08,0x27,0x43,0x59,0x5b,0x5b,0x58,0x42,0x25,0x07,0x05,0x03,0x15,0x32,0x4d,0x5d,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x06,0x1a,0x39,0x59,
+	0x78,0x96,0x77,0x66,0x47,0x28,0x1d,0x27,0x26,0x1a,0x07,0x00,0x03,0x16,0x2d,0x3b,0x3c,0x3c,0x3b,0x2c,0x15,0x1c,0x25,0x22,0x16,0x20,0x34,0x3e,0x5e,0x7e,0x9e,0xbe,
+	0xde,0xfe,0x00,0x02,0x16,0x2c,0x3a,0x43,0x57,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x6a,0x69,0x5a,0x5a,0x4d,0x34,0x17,0x00,0x03,0x16,0x2c,0x3a,0x43,0x57,0x5a,
+	0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x6a,0x69,0x5a,0x5a,0x4d,0x34,0x17,0x00,0x03,0x16,0x2c,0x3a,0x43,0x57,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x6a,0x69,0x5a,
+	0x5a,0x4d,0x34,0x17,0x00,0x03,0x16,0x2d,0x3b,0x3c,0x3c,0x3b,0x2c,0x15,0x1c,0x25,0x22,0x16,0x20,0x34,0x3e,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x03,0x07,0x25,0x41,
+	0x57,0x5a,0x46,0x59,0x75,0x63,0x44,0x36,0x45,0x44,0x34,0x22,0x41,0x5c,0x68,0x6b,0x74,0x54,0x34,0x14,0x00,0x03,0x16,0x2d,0x3b,0x3c,0x3c,0x3b,0x2c,0x15,0x1c,0x25,
+	0x22,0x16,0x20,0x34,0x3e,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x02,0x01,0x21,0x41,0x61,0x81,0x99,0x79,0x59,0x39,0x19,0x00,0x04,0x0f,0x22,0x32,0x42,0x4c,0x44,0x52,
+	0x6d,0x66,0x49,0x51,0x69,0x62,0x6c,0x5e,0x41,0x22,0x02,0x00,0x02,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x04,0x15,0x2b,0x39,0x3a,0x3b,0x39,0x2a,0x14,
+	0x1b,0x24,0x22,0x16,0x1c,0x31,0x3b,0x38,0x3c,0x36,0x25,0x0d,0x00,0x03,0x15,0x2b,0x39,0x3a,0x3b,0x39,0x2a,0x14,0x1b,0x24,0x22,0x16,0x1c,0x31,0x3b,0x38,0x3c,0x36,
+	0x25,0x0d,0x00,0x03,0x15,0x2b,0x39,0x3a,0x3b,0x39,0x2a,0x14,0x1b,0x24,0x22,0x16,0x1c,0x31,0x3b,0x38,0x3c,0x36,0x25,0x0d,0x00,0x09,0x15,0x35,0x54,0x6f,0x65,0x47,
+	0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x4b,0x68,0x6c,0x50,0x31,0x11,0x00,0x08,0x0c,0x2b,0x49,0x64,
+	0x67,0x67,0x63,0x48,0x29,0x17,0x17,0x36,0x54,0x6a,0x6b,0x6b,0x5a,0x3c,0x1e,0x00,0x02,0x03,0x22,0x41,0x5d,0x69,0x61,0x68,0x50,0x32,0x26,0x29,0x48,0x62,0x67,0x72,
+	0x92,0xb2,0xd2,0xf2,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x50,0x50,0x50,0x4f,0x45,0x2e,0x13,0x00,0x05,0x04,0x23,0x42,0x60,0x6e,0x6e,0x6b,0x52,0x62,
+	0x82,0x97,0x77,0x57,0x5b,0x70,0x61,0x6f,0x57,0x38,0x19,0x00,0x06,0x0c,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x1b,0x05,0x25,0x45,0x65,0x85,0x93,0x73,
+	0x53,0x33,0x13,0x00,0x06,0x16,0x2d,0x3b,0x3c,0x3c,0x3b,0x2c,0x15,0x1c,0x25,0x22,0x16,0x20,0x34,0x3e,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x06,0x17,0x35,0x53,0x70,
+	0x8c,0x9c,0xb1,0xb1,0xbf,0xd7,0xf2,0xf9,0xff,0xff,0xff,0x00,0x03,0x11,0x1c,0x1d,0x1d,0x1c,0x11,0x22,0x38,0x45,0x41,0x30,0x32,0x4d,0x5d,0x5e,0x7e,0x9e,0xbe,0xde,
+	0xfe,0x00,0x03,0x11,0x1b,0x2b,0x38,0x3a,0x3a,0x3a,0x3a,0x45,0x42,0x3a,0x4f,0x6a,0x7a,0x8a,0xa1,0xc0,0xdf,0xf7,0xff,0x00,0x03,0x11,0x1b,0x2b,0x38,0x3a,0x3a,0x3a,
+	0x3a,0x45,0x42,0x3a,0x4f,0x6a,0x7a,0x8a,0xa1,0xc0,0xdf,0xf7,0xff,0x00,0x03,0x11,0x1b,0x2b,0x38,0x3a,0x3a,0x3a,0x3a,0x45,0x42,0x3a,0x4f,0x6a,0x7a,0x8a,0xa1,0xc0,
+	0xdf,0xf7,0xff,0x00,0x03,0x11,0x1c,0x1d,0x1d,0x1c,0x11,0x22,0x38,0x45,0x41,0x30,0x32,0x4d,0x5d,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x04,0x14,0x2b,0x39,0x3b,0x37,
+	0x54,0x69,0x5c,0x40,0x4b,0x63,0x61,0x48,0x37,0x49,0x5a,0x66,0x58,0x5c,0x49,0x2d,0x0f,0x00,0x04,0x11,0x1c,0x1d,0x1d,0x1c,0x11,0x22,0x38,0x45,0x41,0x30,0x32,0x4d,
+	0x5d,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x02,0x01,0x21,0x41,0x61,0x81,0x99,0x79,0x59,0x39,0x19,0x00,0x03,0x06,0x23,0x3c,0x4e,0x5e,0x6c,0x5c,0x40,0x50,0x4d,0x39,
+	0x3d,0x4b,0x48,0x4c,0x45,0x31,0x17,0x00,0x03,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x05,0x10,0x1a,0x1b,0x1b,0x1a,0x0f,0x21,0x37,0x44,0x40,0x2f,0x17,
+	0x14,0x1b,0x19,0x1c,0x18,0x0b,0x00,0x05,0x10,0x1a,0x1b,0x1b,0x1a,0x0f,0x21,0x37,0x44,0x40,0x2f,0x17,0x14,0x1b,0x19,0x1c,0x18,0x0b,0x00,0x05,0x10,0x1a,0x1b,0x1b,
+	0x1a,0x0f,0x21,0x37,0x44,0x40,0x2f,0x17,0x14,0x1b,0x19,0x1c,0x18,0x0b,0x00,0x0a,0x0d,0x29,0x42,0x50,0x4c,0x38,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,
+	0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x3b,0x4e,0x4f,0x3f,0x25,0x09,0x00,0x08,0x02,0x1e,0x37,0x48,0x49,0x49,0x47,0x36,0x2d,0x37,0x34,0x28,0x3e,0x4a,
+	0x4b,0x4b,0x42,0x2d,0x12,0x00,0x03,0x16,0x30,0x44,0x4a,0x46,0x49,0x3b,0x3b,0x46,0x40,0x35,0x47,0x52,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x03,0x05,0x25,0x45,0x65,0x85,
+	0x94,0x74,0x54,0x34,0x30,0x30,0x2f,0x29,0x18,0x09,0x01,0x00,0x05,0x18,0x33,0x47,0x4e,0x4e,0x5f,0x6a,0x62,0x82,0x97,0x77,0x57,0x46,0x50,0x49,0x50,0x43,0x2b,0x10,
+	0x00,0x04,0x0c,0x19,0x1c,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x1b,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x1c,0x1a,0x10,0x00,0x05,0x11,0x1c,
+	0x1d,0x1d,0x1c,0x11,0x22,0x38,0x45,0x41,0x30,0x32,0x4d,0x5d,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x06,0x11,0x29,0x46,0x63,0x6c,0x6b,0x65,0x6d,0x54,0x36,0x16,0x00,
+	0x0c,0x13,0x32,0x4f,0x64,0x5d,0x43,0x39,0x59,0x79,0x66,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x05,0x0f,0x19,0x1a,0x1a,0x32,0x4f,0x65,0x5d,0x43,0x3d,0x4f,0x5f,0x6d,0x5b,
+	0x3d,0x1e,0x00,0x07,0x0f,0x19,0x1a,0x1a,0x32,0x4f,0x65,0x5d,0x43,0x3d,0x4f,0x5f,0x6d,0x5b,0x3d,0x1e,0x00,0x07,0x0f,0x19,0x1a,0x1a,0x32,0x4f,0x65,0x5d,0x43,0x3d,
+	0x4f,0x5f,0x6d,0x5b,0x3d,0x1e,0x00,0x0a,0x13,0x32,0x4f,0x64,0x5d,0x43,0x39,0x59,0x79,0x66,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x05,0x0f,0x1a,0x1b,0x28,0x3e,0x49,0x43,
+	0x31,0x51,0x6f,0x6c,0x4d,0x48,0x64,0x6a,0x78,0x5a,0x3d,0x31,0x1c,0x02,0x00,0x09,0x13,0x32,0x4f,0x64,0x5d,0x43,0x39,0x59,0x79,0x66,0x7e,0x9e,0xbe,0xde,0xfe,0x00,
+	0x02,0x01,0x21,0x41,0x61,0x81,0x99,0x79,0x59,0x39,0x19,0x00,0x03,0x0f,0x2f,0x4e,0x69,0x7a,0x89,0xa0,0xbd,0xad,0xb0,0xc4,0xdd,0xd4,0xd6,0xd3,0xd7,0xe6,0xfb,0xff,
+	0x00,0x02,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x0a,0x12,0x31,0x4d,0x63,0x5d,0x43,0x25,0x06,0x00,0x0f,0x12,0x31,0x4d,0x63,0x5d,0x43,0x25,0x06,0x00,
+	0x0f,0x12,0x31,0x4d,0x63,0x5d,0x43,0x25,0x06,0x00,0x10,0x14,0x27,0x31,0x2e,0x20,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x01,0x05,0x25,0x45,0x65,0x85,
+	0x94,0x74,0x54,0x34,0x22,0x2f,0x30,0x25,0x11,0x00,0x0a,0x0a,0x1d,0x29,0x2a,0x2a,0x29,0x2d,0x46,0x57,0x51,0x3b,0x23,0x2b,0x2b,0x2b,0x25,0x15,0x00,0x04,0x03,0x18,
+	0x26,0x2a,0x27,0x29,0x36,0x53,0x66,0x5a,0x41,0x58,0x5b,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x2a,0x2a,0x2a,0x2a,0x2a,
+	0x28,0x1e,0x0b,0x00,0x04,0x06,0x1b,0x2a,0x46,0x5d,0x64,0x72,0x62,0x82,0x97,0x77,0x57,0x4b,0x60,0x5c,0x43,0x28,0x16,0x00,0x04,0x0f,0x26,0x37,0x3c,0x3c,0x4c,0x6c,
+	0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x04,0x04,0x08,0x08,0x08,0x03,0x00,0x09,0x06,0x08,0x08,0x07,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x3c,0x3c,0x3a,
+	0x2b,0x15,0x00,0x09,0x13,0x32,0x4f,0x64,0x5d,0x43,0x39,0x59,0x79,0x66,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x05,0x08,0x24,0x3e,0x56,0x6d,0x68,0x6d,0x66,0x6f,0x55,0x36,
+	0x17,0x00,0x0c,0x16,0x36,0x56,0x75,0x68,0x48,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,0x08,0x16,0x36,0x56,0x74,0x68,0x48,0x28,0x33,0x43,0x4d,0x44,0x2e,
+	0x13,0x00,0x0a,0x16,0x36,0x56,0x74,0x68,0x48,0x28,0x33,0x43,0x4d,0x44,0x2e,0x13,0x00,0x0a,0x16,0x36,0x56,0x74,0x68,0x48,0x28,0x33,0x43,0x4d,0x44,0x2e,0x13,0x00,
+	0x0a,0x16,0x36,0x56,0x75,0x68,0x48,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,0x08,0x11,0x22,0x29,0x25,0x28,0x43,0x56,0x54,0x40,0x49,0x67,0x6d,0x59,0x4a,
+	0x31,0x15,0x04,0x00,0x0a,0x16,0x36,0x56,0x75,0x68,0x48,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,0x02,0x01,0x21,0x41,0x61,0x81,0x99,0x79,0x59,0x39,0x19,
+	0x00,0x03,0x0f,0x2f,0x4e,0x6a,0x6a,0x5a,0x4a,0x53,0x6f,0x68,0x4a,0x2a,0x0c,0x0a,0x0c,0x09,0x00,0x05,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x0a,0x15,
+	0x35,0x55,0x74,0x69,0x49,0x29,0x09,0x00,0x0f,0x15,0x35,0x55,0x74,0x69,0x49,0x29,0x09,0x00,0x0f,0x15,0x35,0x55,0x74,0x69,0x49,0x29,0x09,0x00,0x11,0x0a,0x11,0x0f,
+	0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x10,0x10,0x08,0x00,0x0d,0x09,0x0a,0x0a,0x16,0x36,
+	0x56,0x74,0x67,0x48,0x28,0x0b,0x0b,0x0b,0x07,0x00,0x07,0x07,0x0a,0x08,0x1b,0x3b,0x5a,0x78,0x63,0x4c,0x6c,0x73,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x03,0x05,0x25,0x45,
+	0x65,0x85,0x94,0x74,0x54,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,0x48,0x38,0x20,0x04,0x00,0x04,0x0f,0x2f,0x4f,0x6f,0x70,0x54,0x5f,0x73,0x65,0x72,0x56,0x54,0x74,0x6b,0x4b,
+	0x2b,0x0b,0x00,0x04,0x1e,0x3b,0x53,0x5c,0x5c,0x5c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x13,0x22,0x28,0x28,0x28,0x21,0x11,0x00,0x06,0x04,0x18,0x25,0x28,
+	0x28,0x27,0x1d,0x0a,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x5c,0x5c,0x5c,0x58,0x42,0x25,0x07,0x00,0x08,0x16,0x36,0x56,0x75,0x68,0x48,0x39,0x59,0x79,0x99,
+	0x81,0x61,0x41,0x21,0x01,0x00,0x05,0x10,0x30,0x4f,0x6b,0x83,0x8b,0x9b,0xb2,0xaf,0xbd,0xd5,0xf1,0xff,0xff,0xff,0xff,0x00,0x08,0x14,0x34,0x52,0x69,0x61,0x45,0x39,
+	0x59,0x79,0x90,0x81,0x61,0x41,0x21,0x01,0x00,0x08,0x14,0x34,0x52,0x69,0x61,0x45,0x26,0x17,0x26,0x2d,0x27,0x17,0x01,0x00,0x0a,0x14,0x34,0x52,0x69,0x61,0x45,0x26,
+	0x17,0x26,0x2d,0x27,0x17,0x01,0x00,0x0a,0x14,0x34,0x52,0x69,0x61,0x45,0x26,0x17,0x26,0x2d,0x27,0x17,0x01,0x00,0x0a,0x14,0x34,0x52,0x69,0x61,0x45,0x39,0x59,0x79,
+	0x90,0x81,0x61,0x41,0x21,0x01,0x00,0x09,0x03,0x09,0x06,0x15,0x2a,0x37,0x36,0x28,0x3a,0x4d,0x50,0x40,0x30,0x1d,0x05,0x00,0x0b,0x14,0x34,0x52,0x69,0x61,0x45,0x39,
+	0x59,0x79,0x90,0x81,0x61,0x41,0x21,0x01,0x00,0x02,0x01,0x21,0x41,0x61,0x81,0x99,0x79,0x59,0x39,0x19,0x00,0x03,0x07,0x23,0x3d,0x4e,0x4d,0x3e,0x32,0x50,0x68,0x63,
+	0x47,0x28,0x09,0x00,0x08,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x0a,0x14,0x33,0x51,0x69,0x62,0x46,0x27,0x08,0x00,0x0f,0x14,0x33,0x51,0x69,0x62,0x46,
+	0x27,0x08,0x00,0x0f,0x14,0x33,0x51,0x69,0x62,0x46,0x27,0x08,0x00,0x14,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,
+	0x74,0x54,0x34,0x14,0x00,0x13,0x14,0x33,0x50,0x66,0x5e,0x43,0x25,0x06,0x00,0x0d,0x19,0x38,0x56,0x6c,0x5e,0x4c,0x6c,0x8b,0x8b,0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x05,
+	0x25,0x45,0x65,0x85,0x94,0x74,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x65,0x4c,0x2e,0x0f,0x00,0x04,0x0a,0x28,0x45,0x5a,0x5b,0x45,0x5f,0x71,0x63,0x6e,0x54,0x48,0x5b,
+	0x58,0x41,0x25,0x06,0x00,0x03,0x05,0x25,0x45,0x65,0x7c,0x7c,0x7c,0x7c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x02,0x10,0x2a,0x3f,0x48,0x48,0x48,0x3d,0x28,0x0d,0x00,
+	0x05,0x19,0x32,0x44,0x48,0x48,0x46,0x37,0x20,0x04,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,0x7c,0x7c,0x7c,0x7c,0x6c,0x4c,0x2c,0x0c,0x00,0x08,0x14,0x34,0x52,0x69,
+	0x61,0x45,0x39,0x59,0x79,0x90,0x81,0x61,0x41,0x21,0x01,0x00,0x05,0x0f,0x2f,0x4d,0x68,0x66,0x79,0x65,0x46,0x30,0x27,0x15,0x00,0x0d,0x16,0x35,0x55,0x71,0x66,0x47,
+	0x38,0x56,0x6e,0x70,0x70,0x5d,0x3f,0x1f,0x00,0x09,0x16,0x35,0x55,0x71,0x66,0x47,0x28,0x08,0x08,0x0d,0x08,0x00,0x0c,0x16,0x35,0x55,0x71,0x66,0x47,0x28,0x08,0x08,
+	0x0d,0x08,0x00,0x0c,0x16,0x35,0x55,0x71,0x66,0x47,0x28,0x08,0x08,0x0d,0x08,0x00,0x0c,0x16,0x35,0x55,0x71,0x66,0x47,0x38,0x56,0x6e,0x70,0x70,0x5d,0x3f,0x1f,0x00,
+	0x0e,0x0e,0x17,0x17,0x0d,0x22,0x2f,0x31,0x26,0x13,0x04,0x00,0x0c,0x16,0x35,0x55,0x71,0x66,0x47,0x38,0x56,0x6e,0x70,0x70,0x5d,0x3f,0x1f,0x00,0x03,0x01,0x21,0x41,
+	0x61,0x81,0x90,0x79,0x59,0x39,0x19,0x00,0x04,0x0f,0x23,0x2e,0x2e,0x22,0x34,0x54,0x73,0x6a,0x4a,0x2b,0x0b,0x00,0x08,0x1c,0x3c,0x5c,0x7c,0x90,0x7e,0x5e,0x3e,0x1e,
+	0x00,0x0a,0x15,0x35,0x54,0x70,0x67,0x48,0x29,0x09,0x00,0x0f,0x15,0x35,0x54,0x70,0x67,0x48,0x29,0x09,0x00,0x0f,0x15,0x35,0x54,0x70,0x67,0x48,0x29,0x09,0x00,0x14,
+	0x18,0x38,0x58,0x78,0x85,0x81,0x61,0x41,0x21,0x01,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x85,0x74,0x54,0x34,0x14,0x00,0x13,0x17,0x37,0x57,0x76,0x68,0x48,0x28,0x08,
+	0x00,0x0d,0x1a,0x3a,0x59,0x72,0x61,0x48,0x63,0x6b,0x6b,0x64,0x49,0x2a,0x0b,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x96,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x71,
+	0x51,0x31,0x11,0x00,0x05,0x18,0x2e,0x3c,0x3c,0x42,0x62,0x82,0x97,0x77,0x57,0x37,0x3c,0x3a,0x2b,0x14,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x9c,0x9c,0x9c,0x9d,0x8d,
+	0x6d,0x4d,0x2d,0x0d,0x00,0x02,0x1c,0x3b,0x57,0x68,0x68,0x68,0x54,0x37,0x18,0x00,0x04,0x06,0x26,0x44,0x5f,0x68,0x68,0x64,0x4c,0x2e,0x0f,0x00,0x02,0x05,0x25,0x45,
+	0x65,0x85,0x9d,0x9c,0x9c,0x9c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x08,0x16,0x35,0x55,0x71,0x66,0x47,0x38,0x56,0x6e,0x70,0x70,0x5d,0x3f,0x1f,0x00,0x06,0x06,0x22,0x3b,
+	0x4b,0x50,0x62,0x59,0x3f,0x21,0x0a,0x00,0x0e,0x0e,0x2a,0x43,0x53,0x4e,0x39,0x2a,0x42,0x4f,0x50,0x50,0x46,0x30,0x15,0x00,0x09,0x0e,0x2a,0x43,0x53,0x4e,0x39,0x1e,
+	0x01,0x00,0x0f,0x0e,0x2a,0x43,0x53,0x4e,0x39,0x1e,0x01,0x00,0x0f,0x0e,0x2a,0x43,0x53,0x4e,0x39,0x1e,0x01,0x00,0x0f,0x0e,0x2a,0x43,0x53,0x4e,0x39,0x2a,0x42,0x4f,
+	0x50,0x50,0x46,0x30,0x15,0x00,0x12,0x06,0x10,0x11,0x09,0x00,0x0e,0x0e,0x2a,0x43,0x53,0x4e,0x39,0x2a,0x42,0x4f,0x50,0x50,0x46,0x30,0x15,0x00,0x04,0x20,0x3f,0x5d,
+	0x70,0x70,0x6e,0x56,0x37,0x18,0x00,0x05,0x06,0x0f,0x0f,0x11,0x30,0x4d,0x63,0x5e,0x45,0x27,0x08,0x00,0x08,0x1b,0x3a,0x59,0x6f,0x70,0x6f,0x5a,0x3c,0x1c,0x00,0x0a,
+	0x0d,0x2a,0x43,0x53,0x4f,0x3a,0x1f,0x02,0x00,0x0f,0x0d,0x2a,0x43,0x53,0x4f,0x3a,0x1f,0x02,0x00,0x0f,0x0d,0x2a,0x43,0x53,0x4f,0x3a,0x1f,0x02,0x00,0x14,0x15,0x34,
+	0x50,0x64,0x65,0x65,0x57,0x3b,0x1d,0x00,0x02,0x02,0x21,0x3f,0x5a,0x65,0x65,0x63,0x4d,0x30,0x11,0x00,0x13,0x13,0x31,0x4d,0x61,0x5a,0x41,0x23,0x05,0x00,0x0d,0x12,
+	0x2e,0x46,0x53,0x4b,0x36,0x48,0x4b,0x4b,0x48,0x37,0x1e,0x02,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x71,0x51,0x31,0x11,
+	0x00,0x05,0x01,0x13,0x1d,0x22,0x42,0x62,0x7f,0x7f,0x77,0x57,0x37,0x1c,0x1b,0x10,0x00,0x05,0x05,0x25,0x45,0x65,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x6c,0x4c,0x2c,0x0c,
+	0x00,0x02,0x1e,0x3e,0x5e,0x77,0x77,0x76,0x5a,0x3a,0x1b,0x00,0x04,0x08,0x28,0x48,0x67,0x77,0x77,0x6f,0x50,0x31,0x11,0x00,0x02,0x05,0x25,0x45,0x65,0x7d,0x7d,0x7d,
+	0x7d,0x7d,0x7d,0x6c,0x4c,0x2c,0x0c,0x00,0x08,0x0e,0x2a,0x43,0x53,0x4e,0x39,0x2a,0x42,0x4f,0x50,0x50,0x46,0x30,0x15,0x00,0x07,0x0e,0x21,0x2c,0x38,0x42,0x3d,0x2c,
+	0x13,0x00,0x10,0x16,0x29,0x33,0x30,0x22,0x15,0x27,0x2f,0x30,0x30,0x2a,0x1a,0x03,0x00,0x0a,0x16,0x29,0x33,0x30,0x22,0x0c,0x00,0x11,0x16,0x29,0x33,0x30,0x22,0x0c,
+	0x00,0x11,0x16,0x29,0x33,0x30,0x22,0x0c,0x00,0x11,0x16,0x29,0x33,0x30,0x22,0x15,0x27,0x2f,0x30,0x30,0x2a,0x1a,0x03,0x00,0x25,0x16,0x29,0x33,0x30,0x22,0x15,0x27,
+	0x2f,0x30,0x30,0x2a,0x1a,0x03,0x00,0x04,0x16,0x31,0x47,0x50,0x50,0x4f,0x42,0x2a,0x0e,0x00,0x08,0x05,0x20,0x37,0x44,0x42,0x31,0x19,0x00,0x09,0x11,0x2d,0x44,0x4f,
+	0x50,0x4f,0x45,0x2e,0x12,0x00,0x0b,0x16,0x29,0x33,0x31,0x23,0x0d,0x00,0x11,0x16,0x29,0x33,0x31,0x23,0x0d,0x00,0x11,0x16,0x29,0x33,0x31,0x23,0x0d,0x00,0x15,0x09,
+	0x24,0x39,0x45,0x45,0x45,0x3e,0x2a,0x10,0x00,0x03,0x14,0x2d,0x3f,0x45,0x45,0x44,0x37,0x20,0x05,0x00,0x13,0x06,0x20,0x36,0x42,0x3e,0x2d,0x15,0x00,0x0e,0x01,0x19,
+	0x2b,0x33,0x2e,0x1f,0x29,0x2b,0x2b,0x29,0x1d,0x0a,0x00,0x04,0x04,0x23,0x43,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x6a,0x4e,0x2f,0x10,0x00,0x08,
+	0x1c,0x3a,0x54,0x5f,0x5f,0x5e,0x4c,0x30,0x12,0x00,0x08,0x1e,0x3b,0x54,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x58,0x42,0x26,0x07,0x00,0x02,0x17,0x33,0x4b,0x57,0x57,0x57,
+	0x49,0x30,0x13,0x00,0x04,0x02,0x20,0x3b,0x51,0x57,0x57,0x54,0x42,0x27,0x0a,0x00,0x03,0x1e,0x3b,0x54,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x58,0x42,0x26,0x07,0x00,0x09,
+	0x16,0x29,0x33,0x30,0x22,0x15,0x27,0x2f,0x30,0x30,0x2a,0x1a,0x03,0x00,0x08,0x04,0x0c,0x1b,0x22,0x1f,0x12,0x00,0x12,0x0c,0x13,0x11,0x07,0x00,0x01,0x09,0x0f,0x10,
+	0x10,0x0b,0x00,0x0d,0x0c,0x13,0x11,0x07,0x00,0x13,0x0c,0x13,0x11,0x07,0x00,0x13,0x0c,0x13,0x11,0x07,0x00,0x13,0x0c,0x13,0x11,0x07,0x00,0x01,0x09,0x0f,0x10,0x10,
+	0x0b,0x00,0x28,0x0c,0x13,0x11,0x07,0x00,0x01,0x09,0x0f,0x10,0x10,0x0b,0x00,0x06,0x04,0x1a,0x2a,0x30,0x30,0x2f,0x27,0x15,0x00,0x0a,0x0a,0x1b,0x25,0x23,0x17,0x04,
+	0x00,0x0a,0x17,0x28,0x2f,0x30,0x2f,0x29,0x18,0x01,0x00,0x0c,0x0c,0x13,0x12,0x07,0x00,0x13,0x0c,0x13,0x12,0x07,0x00,0x13,0x0c,0x13,0x12,0x07,0x00,0x17,0x0d,0x1d,
+	0x25,0x25,0x25,0x20,0x11,0x00,0x05,0x14,0x21,0x25,0x25,0x25,0x1b,0x0a,0x00,0x15,0x09,0x1a,0x22,0x1f,0x13,0x00,0x11,0x0d,0x13,0x0f,0x04,0x0a,0x0b,0x0b,0x0a,0x01,
+	0x00,0x06,0x19,0x34,0x49,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x4d,0x3d,0x23,0x07,0x00,0x08,0x0e,0x26,0x39,0x3f,0x3f,0x3f,0x34,0x1f,0x05,0x00,0x08,
+	0x0f,0x27,0x38,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x3a,0x2b,0x15,0x00,0x03,0x07,0x1e,0x30,0x37,0x37,0x37,0x2e,0x1c,0x03,0x00,0x05,0x0e,0x24,0x33,0x37,0x37,0x35,0x29,
+	0x15,0x00,0x04,0x0f,0x27,0x38,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x3a,0x2b,0x15,0x00,0x0b,0x0c,0x13,0x11,0x07,0x00,0x01,0x09,0x0f,0x10,0x10,0x0b,0x00,0x0d,0x03,0x00,
+	0xb4,0x0b,0x10,0x10,0x0f,0x09,0x00,0x0d,0x05,0x04,0x00,0x0d,0x0a,0x0f,0x10,0x0f,0x0a,0x00,0x59,0x05,0x05,0x05,0x01,0x00,0x07,0x02,0x05,0x05,0x05,0x00,0x19,0x02,
+	0x00,0x22,0x07,0x1c,0x2b,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2e,0x23,0x0f,0x00,0x0a,0x0d,0x1b,0x1f,0x1f,0x1f,0x17,0x07,0x00,0x0a,0x0d,0x19,0x1d,
+	0x1d,0x1d,0x1d,0x1d,0x1d,0x1b,0x10,0x00,0x05,0x04,0x12,0x17,0x17,0x17,0x11,0x02,0x00,0x07,0x09,0x14,0x17,0x17,0x16,0x0d,0x00,0x06,0x0d,0x19,0x1d,0x1d,0x1d,0x1d,
+	0x1d,0x1d,0x1b,0x10,0x00,0xff,0x00,0xa4,0x01,0x0c,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x0f,0x06,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfc,0x0b,0x0f,
+	0x0f,0x0f,0x09,0x00,0x39,0x09,0x0b,0x0b,0x04,0x00,0x15,0x04,0x03,0x00,0x01,0x02,0x08,0x08,0x08,0x05,0x00,0x0f,0x02,0x06,0x06,0x06,0x02,0x00,0x14,0x08,0x09,0x00,
+	0x14,0x04,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x05,0x00,0x1a,0x02,0x07,0x07,0x07,0x02,0x00,0x0c,0x04,0x0a,0x08,0x00,0x15,0x07,0x07,
+	0x00,0x15,0x06,0x07,0x07,0x05,0x00,0x14,0x08,0x08,0x00,0x17,0x03,0x00,0x13,0x04,0x0b,0x0a,0x00,0x12,0x01,0x07,0x06,0x00,0x1a,0x06,0x06,0x06,0x03,0x00,0x12,0x01,
+	0x01,0x01,0x00,0x0d,0x06,0x07,0x07,0x06,0x00,0x1c,0x03,0x06,0x06,0x06,0x00,0x13,0x04,0x07,0x07,0x06,0x00,0x07,0x06,0x07,0x07,0x04,0x00,0x15,0x02,0x19,0x29,0x2f,
+	0x2f,0x2f,0x27,0x16,0x00,0x0d,0x08,0x10,0x0e,0x04,0x00,0x10,0x03,0x12,0x1a,0x17,0x0c,0x00,0x01,0x09,0x0f,0x0f,0x0f,0x0b,0x00,0x0a,0x07,0x1b,0x28,0x2b,0x2b,0x22,
+	0x10,0x00,0x12,0x07,0x19,0x23,0x23,0x18,0x20,0x28,0x28,0x28,0x25,0x18,0x04,0x00,0x0c,0x11,0x20,0x26,0x26,0x26,0x21,0x12,0x00,0x11,0x09,0x1d,0x28,0x28,0x1d,0x0b,
+	0x00,0x10,0x01,0x16,0x23,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x25,0x1c,0x0a,0x00,0x0b,0x05,0x15,0x1c,0x1c,0x1c,0x18,0x0a,0x00,0x05,
+	0x10,0x20,0x27,0x27,0x27,0x20,0x11,0x00,0x0a,0x10,0x22,0x2a,0x27,0x1a,0x05,0x00,0x11,0x09,0x1c,0x26,0x26,0x1c,0x09,0x00,0x11,0x0a,0x1c,0x26,0x27,0x27,0x25,0x19,
+	0x06,0x00,0x10,0x09,0x1c,0x27,0x27,0x1c,0x09,0x00,0x11,0x03,0x11,0x17,0x1f,0x23,0x1c,0x0c,0x00,0x10,0x10,0x22,0x2b,0x29,0x1c,0x07,0x00,0x0f,0x0c,0x1e,0x27,0x25,
+	0x19,0x05,0x00,0x16,0x0c,0x1d,0x26,0x26,0x26,0x21,0x13,0x00,0x0f,0x0c,0x1b,0x21,0x21,0x21,0x1d,0x10,0x00,0x09,0x08,0x1b,0x25,0x27,0x27,0x25,0x1b,0x08,0x00,0x0c,
+	0x02,0x10,0x16,0x13,0x06,0x00,0x08,0x15,0x22,0x26,0x26,0x25,0x1c,0x0a,0x00,0x0f,0x01,0x15,0x23,0x27,0x27,0x26,0x1d,0x0b,0x00,0x03,0x09,0x1c,0x26,0x27,0x27,0x23,
+	0x16,0x02,0x00,0x13,0x14,0x2f,0x46,0x4f,0x4f,0x4f,0x43,0x2c,0x10,0x00,0x0b,0x12,0x25,0x30,0x2e,0x20,0x0c,0x00,0x0e,0x02,0x1b,0x2f,0x3a,0x36,0x27,0x15,0x27,0x2f,
+	0x2f,0x2f,0x29,0x19,0x02,0x00,0x08,0x1a,0x34,0x46,0x4b,0x4b,0x3d,0x26,0x0a,0x00,0x10,0x02,0x1d,0x34,0x43,0x42,0x32,0x3c,0x47,0x48,0x48,0x43,0x31,0x18,0x00,0x0b,
+	0x0f,0x29,0x3d,0x46,0x46,0x46,0x3e,0x2a,0x10,0x00,0x0f,0x02,0x1e,0x37,0x47,0x47,0x38,0x20,0x04,0x00,0x0f,0x16,0x2f,0x41,0x46,0x46,0x46,0x46,0x46,0x46,0x46,0x46,
+	0x46,0x46,0x46,0x46,0x46,0x45,0x37,0x20,0x05,0x00,0x09,0x04,0x1d,0x32,0x3c,0x3c,0x3c,0x36,0x24,0x0c,0x00,0x03,0x0d,0x28,0x3d,0x47,0x47,0x47,0x3d,0x28,0x0e,0x00,
+	0x08,0x0b,0x26,0x3d,0x4a,0x45,0x33,0x19,0x0e,0x0a,0x00,0x0e,0x02,0x1e,0x36,0x46,0x46,0x36,0x1e,0x02,0x00,0x0f,0x04,0x20,0x37,0x45,0x47,0x47,0x44,0x33,0x1b,0x00,
+	0x0f,0x03,0x1f,0x37,0x46,0x46,0x37,0x1f,0x03,0x00,0x0f,0x05,0x1d,0x2f,0x37,0x3d,0x43,0x39,0x24,0x0a,0x00,0x0e,0x0a,0x25,0x3d,0x4b,0x47,0x34,0x1b,0x00,0x0e,0x07,
+	0x23,0x39,0x47,0x44,0x32,0x19,0x00,0x15,0x07,0x22,0x39,0x45,0x46,0x46,0x3f,0x2c,0x12,0x00,0x0d,0x0b,0x24,0x38,0x41,0x41,0x41,0x3b,0x29,0x10,0x00,0x07,0x02,0x1d,
+	0x35,0x45,0x47,0x47,0x45,0x35,0x1d,0x16,0x0d,0x00,0x09,0x05,0x1c,0x2e,0x36,0x31,0x21,0x0a,0x00,0x06,0x14,0x2d,0x40,0x46,0x46,0x45,0x37,0x20,0x05,0x00,0x0e,0x15,
+	0x2e,0x41,0x47,0x47,0x46,0x38,0x21,0x05,0x00,0x01,0x04,0x1f,0x36,0x45,0x47,0x47,0x42,0x2f,0x16,0x00,0x13,0x1f,0x3e,0x5c,0x6f,0x6f,0x6e,0x57,0x39,0x1a,0x00,0x0a,
+	0x13,0x29,0x3f,0x4f,0x4c,0x39,0x22,0x0b,0x00,0x0d,0x11,0x2e,0x49,0x59,0x53,0x3c,0x2b,0x42,0x4f,0x4f,0x4f,0x46,0x2f,0x14,0x00,0x07,0x09,0x26,0x45,0x61,0x6b,0x69,
+	0x52,0x34,0x15,0x02,0x00,0x0f,0x0e,0x2d,0x4a,0x61,0x5f,0x47,0x52,0x67,0x68,0x68,0x5e,0x43,0x25,0x05,0x00,0x0a,0x1c,0x3a,0x56,0x66,0x66,0x66,0x57,0x3b,0x1c,0x00,
+	0x0f,0x0d,0x2c,0x4a,0x64,0x65,0x4b,0x2d,0x0e,0x00,0x02,0x04,0x03,0x00,0x0a,0x05,0x23,0x41,0x5c,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
+	0x63,0x4c,0x2f,0x10,0x00,0x09,0x12,0x30,0x4b,0x5c,0x5c,0x5c,0x51,0x38,0x1b,0x00,0x03,0x19,0x38,0x55,0x67,0x67,0x67,0x55,0x38,0x1a,0x00,0x08,0x16,0x35,0x53,0x69,
+	0x60,0x44,0x26,0x2e,0x29,0x1a,0x04,0x00,0x0c,0x0d,0x2c,0x4a,0x63,0x63,0x4a,0x2c,0x0d,0x00,0x0f,0x11,0x2f,0x4c,0x64,0x67,0x67,0x60,0x47,0x29,0x0a,0x00,0x0e,0x0d,
+	0x2c,0x4a,0x64,0x64,0x4a,0x2c,0x0d,0x00,0x0f,0x15,0x31,0x4a,0x57,0x57,0x62,0x51,0x36,0x17,0x0d,0x08,0x00,0x0c,0x14,0x33,0x51,0x69,0x62,0x46,0x27,0x07,0x00,0x0d,
+	0x12,0x31,0x4f,0x66,0x5f,0x45,0x27,0x08,0x00,0x14,0x13,0x32,0x4f,0x64,0x66,0x66,0x59,0x3d,0x1f,0x00,0x0a,0x04,0x14,0x1c,0x1a,0x37,0x52,0x61,0x61,0x61,0x56,0x3c,
+	0x1f,0x00,0x07,0x0c,0x2b,0x49,0x62,0x67,0x67,0x62,0x49,0x35,0x36,0x2a,0x15,0x00,0x07,0x06,0x1c,0x33,0x49,0x56,0x4d,0x37,0x21,0x0a,0x00,0x04,0x02,0x21,0x40,0x5b,
+	0x66,0x66,0x63,0x4d,0x2f,0x10,0x00,0x0d,0x02,0x22,0x40,0x5b,0x67,0x67,0x64,0x4d,0x2f,0x11,0x00,0x01,0x0f,0x2d,0x4b,0x63,0x67,0x67,0x5c,0x41,0x23,0x04,0x00,0x11,
+	0x09,0x28,0x46,0x65,0x84,0x8f,0x76,0x58,0x39,0x1a,0x00,0x09,0x13,0x29,0x40,0x56,0x6d,0x66,0x4f,0x38,0x21,0x0a,0x00,0x0c,0x17,0x37,0x57,0x76,0x67,0x48,0x38,0x57,
+	0x6e,0x6f,0x6f,0x5c,0x3e,0x1e,0x00,0x06,0x13,0x26,0x31,0x47,0x66,0x74,0x71,0x55,0x36,0x2c,0x1d,0x06,0x00,0x0e,0x11,0x31,0x51,0x70,0x6d,0x4e,0x61,0x7d,0x88,0x83,
+	0x66,0x47,0x27,0x08,0x00,0x09,0x0b,0x29,0x46,0x64,0x81,0x86,0x7d,0x5f,0x3f,0x1f,0x00,0x0f,0x0e,0x2e,0x4e,0x6c,0x6d,0x4f,0x30,0x10,0x0a,0x1b,0x24,0x22,0x16,0x03,
+	0x00,0x08,0x10,0x2e,0x4c,0x6a,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x73,0x53,0x33,0x13,0x00,0x09,0x18,0x38,0x58,0x77,0x7c,0x7c,0x61,
+	0x41,0x21,0x01,0x00,0x02,0x1c,0x3c,0x5c,0x7c,0x87,0x7d,0x5d,0x3d,0x1d,0x00,0x05,0x10,0x1a,0x1b,0x17,0x37,0x57,0x72,0x65,0x47,0x42,0x4e,0x46,0x32,0x17,0x00,0x0c,
+	0x0f,0x2f,0x4f,0x6d,0x6d,0x4f,0x2f,0x0f,0x00,0x0f,0x1e,0x3b,0x59,0x76,0x87,0x87,0x6b,0x4c,0x2c,0x0c,0x00,0x0e,0x0f,0x2f,0x4f,0x6d,0x6d,0x4f,0x2f,0x0f,0x00,0x0f,
+	0x1c,0x3c,0x5c,0x76,0x63,0x7a,0x5b,0x3b,0x27,0x2d,0x26,0x16,0x00,0x0b,0x15,0x35,0x54,0x70,0x66,0x48,0x28,0x08,0x00,0x0d,0x15,0x35,0x54,0x72,0x68,0x49,0x2a,0x0a,
+	0x00,0x14,0x16,0x36,0x56,0x76,0x86,0x82,0x62,0x42,0x22,0x02,0x00,0x08,0x02,0x1c,0x31,0x3c,0x39,0x46,0x62,0x7e,0x81,0x81,0x64,0x44,0x24,0x04,0x00,0x06,0x0f,0x2f,
+	0x4f,0x6d,0x87,0x87,0x73,0x56,0x54,0x55,0x42,0x27,0x0a,0x00,0x05,0x06,0x1d,0x33,0x4a,0x60,0x76,0x65,0x4e,0x37,0x20,0x09,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x86,
+	0x73,0x53,0x33,0x13,0x00,0x0d,0x05,0x25,0x45,0x65,0x85,0x87,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x87,0x86,0x66,0x46,0x26,0x06,0x00,0x11,0x11,0x30,
+	0x4f,0x6e,0x8d,0x8b,0x6c,0x4e,0x30,0x11,0x00,0x08,0x13,0x2a,0x40,0x57,0x6d,0x84,0x7c,0x65,0x4e,0x37,0x20,0x09,0x00,0x0b,0x14,0x32,0x4f,0x64,0x5c,0x42,0x3a,0x5a,
+	0x7a,0x8f,0x80,0x60,0x40,0x20,0x00,0x05,0x0a,0x27,0x40,0x50,0x4d,0x65,0x71,0x6f,0x54,0x52,0x49,0x33,0x18,0x01,0x00,0x0d,0x0f,0x2e,0x4c,0x65,0x63,0x50,0x61,0x6f,
+	0x70,0x8c,0xa8,0xc4,0xe0,0xfe,0xff,0xff,0xff,0x00,0x06,0x17,0x35,0x52,0x70,0x8d,0x8e,0x71,0x53,0x36,0x18,0x00,0x0f,0x0d,0x2d,0x4c,0x68,0x69,0x4d,0x2f,0x0f,0x23,
+	0x37,0x44,0x41,0x30,0x18,0x00,0x08,0x1a,0x38,0x57,0x75,0x93,0x93,0x93,0x93,0x9d,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x73,0x53,0x33,0x13,0x00,0x09,0x14,0x32,
+	0x4f,0x62,0x63,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x02,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x04,0x15,0x2b,0x3a,0x3b,0x33,0x36,0x54,0x6e,0x63,0x4b,0x57,
+	0x6d,0x5e,0x41,0x22,0x02,0x00,0x0b,0x0e,0x2d,0x4c,0x67,0x67,0x4c,0x2d,0x0e,0x00,0x0e,0x0d,0x2b,0x48,0x65,0x83,0x99,0x7c,0x5e,0x41,0x23,0x06,0x00,0x0e,0x0e,0x2e,
+	0x4c,0x68,0x68,0x4c,0x2e,0x0f,0x0e,0x05,0x00,0x0d,0x1a,0x39,0x56,0x68,0x61,0x68,0x56,0x39,0x44,0x4d,0x43,0x2d,0x12,0x00,0x0a,0x15,0x34,0x53,0x6e,0x65,0x47,0x28,
+	0x08,0x00,0x0a,0x08,0x14,0x17,0x16,0x33,0x52,0x6b,0x64,0x47,0x28,0x18,0x17,0x11,0x03,0x00,0x0d,0x03,0x13,0x1b,0x19,0x16,0x36,0x56,0x76,0x96,0x82,0x62,0x42,0x22,
+	0x02,0x00,0x08,0x10,0x2e,0x49,0x5b,0x56,0x55,0x71,0x8d,0x8f,0x73,0x57,0x3b,0x1e,0x00,0x07,0x18,0x2f,0x43,0x61,0x7e,0x9c,0x80,0x6a,0x73,0x6f,0x51,0x32,0x13,0x00,
+	0x04,0x06,0x1d,0x33,0x4a,0x60,0x77,0x8d,0x7b,0x64,0x4d,0x36,0x1f,0x08,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x19,0x1a,0x12,0x01,0x00,0x09,
+	0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x0d,0x0a,0x17,0x1a,0x1a,0x1a,0x39,0x58,0x77,
+	0x95,0x81,0x62,0x44,0x25,0x18,0x0e,0x00,0x05,0x0a,0x17,0x2a,0x41,0x57,0x6d,0x84,0x94,0x93,0x7c,0x65,0x4e,0x37,0x20,0x0e,0x00,0x0a,0x17,0x37,0x57,0x77,0x68,0x48,
+	0x3a,0x5a,0x7a,0x9a,0x80,0x60,0x40,0x20,0x00,0x03,0x06,0x19,0x25,0x33,0x52,0x6d,0x67,0x63,0x6e,0x6c,0x5a,0x71,0x60,0x41,0x26,0x20,0x0f,0x00,0x0c,0x11,0x31,0x50,
+	0x6e,0x6b,0x63,0x7a,0x5d,0x67,0x63,0x48,0x2c,0x10,0x00,0x09,0x06,0x24,0x41,0x5f,0x7c,0x9a,0x82,0x64,0x47,0x29,0x0c,0x00,0x0f,0x0e,0x2d,0x4c,0x69,0x6a,0x4e,0x2f,
+	0x26,0x3b,0x50,0x63,0x5d,0x44,0x26,0x07,0x00,0x06,0x07,0x25,0x43,0x61,0x7f,0x9c,0x7d,0x73,0x83,0x96,0x76,0x73,0x73,0x73,0x73,0x73,0x73,0x73,0x6e,0x51,0x32,0x12,
+	0x00,0x05,0x05,0x16,0x1f,0x1d,0x1f,0x37,0x57,0x77,0x7e,0x7e,0x61,0x41,0x21,0x01,0x00,0x02,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x03,0x07,0x25,0x42,
+	0x58,0x5a,0x53,0x51,0x54,0x6d,0x62,0x66,0x6a,0x71,0x60,0x44,0x2c,0x10,0x00,0x0b,0x0f,0x2e,0x4e,0x6b,0x6b,0x4e,0x2e,0x0f,0x0f,0x07,0x00,0x0c,0x1a,0x37,0x55,0x72,
+	0x8f,0x8d,0x6f,0x52,0x34,0x17,0x00,0x0f,0x0f,0x2e,0x4d,0x6a,0x6a,0x4d,0x2f,0x2f,0x2d,0x21,0x0d,0x00,0x0b,0x0a,0x27,0x40,0x51,0x66,0x79,0x76,0x5b,0x54,0x5b,0x6d,
+	0x5a,0x3c,0x1d,0x00,0x06,0x09,0x13,0x14,0x14,0x14,0x34,0x52,0x6c,0x63,0x46,0x27,0x14,0x11,0x14,0x10,0x03,0x00,0x05,0x0b,0x22,0x33,0x37,0x35,0x38,0x53,0x6e,0x66,
+	0x48,0x38,0x38,0x37,0x2e,0x1c,0x03,0x00,0x0b,0x01,0x1b,0x2f,0x3a,0x38,0x28,0x36,0x56,0x76,0x96,0x82,0x62,0x42,0x22,0x02,0x00,0x08,0x15,0x35,0x55,0x75,0x69,0x64,
+	0x80,0x9c,0x80,0x64,0x48,0x2c,0x0f,0x00,0x06,0x0a,0x28,0x45,0x5c,0x66,0x72,0x8f,0x8d,0x89,0x91,0x78,0x59,0x3b,0x1b,0x00,0x04,0x1c,0x34,0x4a,0x61,0x77,0x8e,0x8c,
+	0x91,0x7a,0x63,0x4c,0x35,0x1d,0x02,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x2a,0x38,0x3a,0x2e,0x19,0x00,0x09,0x05,0x25,0x45,0x65,0x85,0x93,0x73,
+	0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x0c,0x0d,0x25,0x35,0x3a,0x3a,0x39,0x42,0x60,0x7f,0x95,0x77,0x58,0x3a,0x3a,0x38,
+	0x2a,0x14,0x00,0x03,0x0d,0x25,0x35,0x3e,0x57,0x6e,0x84,0x93,0x7d,0x85,0x92,0x7b,0x64,0x4d,0x38,0x2a,0x14,0x00,0x05,0x08,0x08,0x03,0x01,0x12,0x31,0x4c,0x5f,0x58,
+	0x3f,0x39,0x58,0x73,0x63,0x7f,0x9f,0xbf,0xdf,0xff,0x00,0x02,0x1c,0x34,0x44,0x45,0x50,0x6a,0x64,0x49,0x4e,0x4d,0x58,0x6d,0x5d,0x40,0x46,0x3c,0x27,0x0c,0x00,0x0b,
+	0x09,0x27,0x41,0x53,0x56,0x72,0x8f,0x8e,0x70,0x50,0x35,0x1c,0x00,0x0a,0x13,0x30,0x4e,0x6b,0x89,0x92,0x75,0x58,0x3a,0x1d,0x00,0x10,0x05,0x22,0x3c,0x4d,0x4e,0x3d,
+	0x23,0x3a,0x53,0x68,0x7d,0x96,0xb5,0xd5,0xf5,0x00,0x06,0x11,0x2f,0x4e,0x6c,0x8a,0x91,0x73,0x63,0x83,0x96,0x76,0x56,0x53,0x53,0x53,0x53,0x53,0x53,0x51,0x40,0x27,
+	0x0a,0x00,0x04,0x02,0x1d,0x32,0x3e,0x3c,0x3f,0x3a,0x4b,0x5d,0x5e,0x5e,0x52,0x38,0x1b,0x00,0x03,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x03,0x0c,0x2c,
+	0x4c,0x6c,0x72,0x6f,0x6a,0x4b,0x4e,0x4b,0x68,0x71,0x71,0x70,0x57,0x38,0x19,0x00,0x0b,0x07,0x24,0x43,0x5e,0x67,0x52,0x34,0x2f,0x2f,0x23,0x10,0x00,0x0a,0x09,0x26,
+	0x44,0x61,0x7f,0x9c,0x80,0x63,0x45,0x28,0x0a,0x00,0x0f,0x13,0x2f,0x45,0x4f,0x4f,0x4b,0x4f,0x4f,0x4c,0x3b,0x21,0x05,0x00,0x0a,0x12,0x32,0x51,0x6e,0x68,0x5d,0x56,
+	0x53,0x70,0x69,0x72,0x5c,0x3e,0x1e,0x00,0x05,0x10,0x25,0x32,0x34,0x34,0x32,0x27,0x3f,0x4d,0x49,0x36,0x2b,0x34,0x30,0x34,0x2e,0x1d,0x06,0x00,0x04,0x1c,0x38,0x4f,
+	0x57,0x53,0x57,0x46,0x50,0x4c,0x4c,0x58,0x58,0x57,0x49,0x30,0x13,0x00,0x0b,0x0f,0x2d,0x48,0x5a,0x55,0x3e,0x36,0x56,0x76,0x96,0x82,0x62,0x42,0x22,0x02,0x00,0x08,
+	0x12,0x30,0x4d,0x61,0x5b,0x65,0x6d,0x72,0x8e,0xaa,0xc6,0xe3,0xff,0xff,0xff,0x00,0x04,0x0e,0x2e,0x4e,0x6e,0x84,0x8d,0x92,0x9c,0x80,0x77,0x6f,0x59,0x3a,0x1b,0x00,
+	0x03,0x0b,0x2a,0x47,0x61,0x77,0x8e,0x89,0x73,0x86,0x91,0x7a,0x63,0x49,0x2c,0x0d,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x40,0x56,0x59,0x46,0x2b,
+	0x0d,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x0c,0x1d,0x3a,0x52,0x5a,0x5a,
+	0x59,0x47,0x67,0x7b,0x7b,0x6c,0x55,0x5a,0x5a,0x56,0x41,0x25,0x07,0x00,0x02,0x1d,0x3a,0x52,0x5a,0x66,0x7e,0x7e,0x7c,0x66,0x6e,0x7e,0x7e,0x77,0x5a,0x56,0x41,0x25,
+	0x07,0x00,0x02,0x08,0x1c,0x27,0x28,0x22,0x21,0x15,0x1f,0x34,0x3f,0x3b,0x2b,0x2e,0x46,0x54,0x5f,0x7f,0x9f,0xbf,0xdf,0xff,0x00,0x01,0x0b,0x2a,0x47,0x61,0x63,0x64,
+	0x60,0x49,0x37,0x2e,0x2d,0x42,0x55,0x66,0x5a,0x66,0x54,0x37,0x18,0x00,0x0c,0x14,0x2d,0x49,0x65,0x82,0x9b,0x7f,0x63,0x47,0x2a,0x0c,0x00,0x09,0x01,0x1f,0x3d,0x5a,
+	0x78,0x95,0x86,0x68,0x4b,0x2e,0x10,0x00,0x11,0x0e,0x22,0x2f,0x2f,0x23,0x21,0x41,0x61,0x81,0x95,0xaa,0xc1,0xdd,0xfb,0x00,0x06,0x1c,0x3a,0x58,0x76,0x95,0x87,0x68,
+	0x63,0x83,0x96,0x76,0x56,0x36,0x33,0x33,0x33,0x33,0x33,0x32,0x27,0x13,0x00,0x05,0x11,0x2e,0x4a,0x5d,0x59,0x5f,0x56,0x3d,0x3d,0x3e,0x3e,0x37,0x25,0x0c,0x00,0x03,
+	0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x03,0x09,0x28,0x45,0x5d,0x60,0x67,0x63,0x51,0x4d,0x3f,0x5d,0x6e,0x6e,0x6d,0x56,0x38,0x18,0x00,0x0b,0x07,0x26,
+	0x46,0x65,0x74,0x57,0x3c,0x4d,0x4e,0x3d,0x23,0x07,0x00,0x09,0x16,0x33,0x50,0x6e,0x8b,0x91,0x73,0x56,0x39,0x1b,0x00,0x10,0x1d,0x3d,0x5b,0x6f,0x5c,0x65,0x6f,0x6f,
+	0x68,0x4c,0x2d,0x0d,0x00,0x09,0x0e,0x25,0x36,0x4f,0x68,0x64,0x49,0x36,0x4f,0x67,0x61,0x52,0x48,0x31,0x15,0x00,0x04,0x05,0x23,0x3d,0x51,0x54,0x54,0x50,0x3c,0x24,
+	0x2e,0x2b,0x2d,0x46,0x54,0x4d,0x54,0x4a,0x32,0x16,0x00,0x03,0x04,0x24,0x44,0x63,0x76,0x69,0x73,0x54,0x39,0x3e,0x5e,0x78,0x78,0x76,0x59,0x3a,0x1a,0x00,0x0b,0x15,
+	0x35,0x55,0x75,0x69,0x49,0x36,0x56,0x76,0x96,0x82,0x62,0x42,0x22,0x02,0x00,0x08,0x15,0x35,0x55,0x75,0x69,0x79,0x5d,0x69,0x61,0x46,0x29,0x0d,0x00,0x07,0x09,0x28,
+	0x47,0x65,0x84,0x7c,0x76,0x93,0x89,0x6b,0x50,0x44,0x2d,0x11,0x00,0x03,0x0d,0x2d,0x4d,0x6c,0x78,0x78,0x73,0x5c,0x70,0x78,0x78,0x6e,0x4f,0x2f,0x0f,0x00,0x01,0x05,
+	0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x4c,0x6c,0x72,0x53,0x33,0x13,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,
+	0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x0b,0x05,0x25,0x45,0x64,0x7a,0x7a,0x74,0x55,0x54,0x5b,0x5b,0x57,0x6b,0x7a,0x7a,0x6c,0x4d,0x2d,0x0d,0x00,0x01,0x05,0x25,0x45,
+	0x64,0x7a,0x7a,0x74,0x5e,0x5e,0x4f,0x57,0x5e,0x6b,0x7a,0x7a,0x6c,0x4d,0x2d,0x0d,0x00,0x01,0x01,0x1d,0x36,0x46,0x47,0x42,0x40,0x2f,0x17,0x18,0x1f,0x1d,0x11,0x24,
+	0x39,0x43,0x5f,0x7f,0x9f,0xbf,0xdf,0xff,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0e,0x1e,0x3e,0x5e,0x7e,0x9b,0x7b,0x5b,0x3b,0x1b,0x00,0x05,0x06,
+	0x07,0x07,0x06,0x00,0x02,0x04,0x20,0x3c,0x58,0x75,0x91,0x8c,0x70,0x54,0x38,0x1b,0x06,0x07,0x06,0x00,0x07,0x0e,0x2b,0x49,0x66,0x84,0x97,0x79,0x5c,0x3f,0x21,0x17,
+	0x0e,0x00,0x09,0x08,0x08,0x08,0x08,0x00,0x04,0x06,0x0f,0x0f,0x07,0x1c,0x3a,0x54,0x60,0x51,0x3d,0x28,0x11,0x00,0x06,0x08,0x26,0x45,0x63,0x81,0x9a,0x7c,0x5e,0x63,
+	0x83,0x96,0x76,0x56,0x36,0x27,0x27,0x27,0x22,0x13,0x12,0x0a,0x00,0x05,0x10,0x2a,0x3d,0x54,0x74,0x6b,0x7a,0x65,0x45,0x44,0x40,0x2e,0x19,0x0b,0x00,0x04,0x1c,0x3c,
+	0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x04,0x19,0x30,0x45,0x5a,0x65,0x80,0x9b,0x94,0xad,0xb5,0xa5,0xad,0xb2,0xbe,0xd5,0xf1,0xff,0x00,0x04,0x09,0x09,0x09,0x08,
+	0x08,0x0c,0x0a,0x25,0x44,0x61,0x6c,0x54,0x54,0x69,0x6a,0x4e,0x2f,0x0f,0x09,0x09,0x00,0x06,0x05,0x22,0x40,0x5d,0x7a,0x98,0x84,0x67,0x4a,0x2c,0x0f,0x00,0x0a,0x09,
+	0x0a,0x0a,0x09,0x09,0x0c,0x1e,0x3d,0x5b,0x70,0x5c,0x6a,0x8a,0x8f,0x6f,0x4f,0x2f,0x0f,0x0a,0x09,0x00,0x06,0x01,0x1f,0x3b,0x52,0x5a,0x6b,0x69,0x4c,0x3f,0x52,0x6f,
+	0x68,0x4a,0x2c,0x1b,0x04,0x00,0x04,0x0d,0x2d,0x4c,0x6a,0x74,0x74,0x69,0x4a,0x2b,0x0e,0x19,0x38,0x58,0x73,0x63,0x74,0x5e,0x3f,0x1f,0x00,0x03,0x02,0x21,0x40,0x5b,
+	0x67,0x5f,0x7b,0x65,0x4b,0x3b,0x57,0x67,0x67,0x67,0x53,0x36,0x17,0x00,0x0b,0x12,0x31,0x4d,0x62,0x5c,0x43,0x36,0x56,0x76,0x96,0x82,0x62,0x42,0x22,0x02,0x00,0x04,
+	0x02,0x02,0x03,0x02,0x10,0x2e,0x49,0x5b,0x75,0x91,0x8b,0x6d,0x4d,0x34,0x1a,0x00,0x09,0x1f,0x3d,0x59,0x65,0x5d,0x69,0x87,0x95,0x78,0x5a,0x3d,0x20,0x02,0x00,0x03,
+	0x07,0x25,0x40,0x54,0x58,0x5c,0x79,0x7a,0x7a,0x5d,0x58,0x55,0x42,0x26,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x45,0x5e,0x61,0x4b,0x2e,0x0f,
+	0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x0b,0x05,0x25,0x45,0x65,0x85,0x95,
+	0x75,0x55,0x37,0x3b,0x3b,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x3e,0x35,0x3b,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,
+	0x2d,0x0d,0x00,0x01,0x0b,0x2a,0x49,0x63,0x65,0x61,0x5c,0x44,0x26,0x07,0x00,0x02,0x17,0x35,0x51,0x63,0x5f,0x7f,0x9f,0xbf,0xdf,0xff,0x00,0x01,0x0d,0x2d,0x4d,0x6d,
+	0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x1e,0x3e,0x5e,0x7e,0x9b,0x7b,0x5b,0x3b,0x1b,0x00,0x03,0x07,0x1a,0x26,0x26,0x27,0x25,0x19,0x06,0x13,0x2f,0x4b,0x68,0x84,0x99,0x7d,
+	0x61,0x45,0x28,0x26,0x26,0x27,0x25,0x19,0x05,0x00,0x05,0x1a,0x38,0x55,0x73,0x90,0x8a,0x6d,0x4f,0x38,0x38,0x37,0x2a,0x15,0x00,0x06,0x08,0x1c,0x27,0x28,0x28,0x27,
+	0x1b,0x08,0x00,0x06,0x0e,0x26,0x39,0x40,0x37,0x24,0x10,0x00,0x07,0x13,0x31,0x4f,0x6d,0x8c,0x90,0x71,0x53,0x63,0x83,0x96,0x76,0x56,0x47,0x47,0x47,0x47,0x3f,0x2b,
+	0x11,0x00,0x06,0x1e,0x3c,0x57,0x64,0x74,0x94,0x85,0x65,0x64,0x64,0x5c,0x42,0x24,0x05,0x00,0x04,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x04,0x10,0x30,
+	0x50,0x70,0x6f,0x63,0x66,0x6e,0x53,0x59,0x77,0x65,0x45,0x26,0x14,0x00,0x04,0x09,0x1c,0x28,0x29,0x29,0x28,0x27,0x2c,0x29,0x2b,0x45,0x63,0x6f,0x56,0x6d,0x81,0x96,
+	0xb2,0xd0,0xd6,0xd6,0xd7,0xe3,0xf6,0xff,0x00,0x03,0x11,0x2f,0x4c,0x6a,0x87,0x95,0x78,0x66,0x55,0x39,0x1b,0x00,0x08,0x0a,0x1d,0x29,0x2a,0x2a,0x29,0x27,0x2c,0x29,
+	0x3e,0x5d,0x74,0x5e,0x64,0x6b,0x70,0x90,0xb0,0xd0,0xd5,0xd5,0xd6,0xe2,0xf5,0xff,0x00,0x03,0x06,0x26,0x46,0x66,0x77,0x69,0x66,0x5c,0x5f,0x65,0x68,0x63,0x48,0x29,
+	0x0a,0x00,0x05,0x0c,0x2b,0x49,0x64,0x6b,0x6b,0x63,0x48,0x29,0x0d,0x20,0x36,0x54,0x6a,0x5e,0x6b,0x5a,0x3c,0x1e,0x00,0x04,0x15,0x2e,0x4c,0x6c,0x72,0x6d,0x87,0xa1,
+	0xbc,0xc0,0xb8,0xb8,0xb8,0xc3,0xd9,0xf3,0xff,0xff,0xff,0x00,0x08,0x15,0x35,0x55,0x75,0x6a,0x4a,0x36,0x56,0x76,0x96,0x82,0x62,0x42,0x22,0x02,0x00,0x02,0x04,0x16,
+	0x21,0x22,0x22,0x21,0x16,0x30,0x4c,0x68,0x84,0x98,0x7c,0x60,0x43,0x26,0x23,0x1f,0x11,0x00,0x07,0x12,0x2c,0x3f,0x46,0x58,0x66,0x7a,0x98,0x84,0x67,0x4a,0x2c,0x0f,
+	0x00,0x04,0x13,0x29,0x36,0x3c,0x5c,0x7c,0x9a,0x7e,0x5e,0x3e,0x37,0x2a,0x15,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x4c,0x6c,0x73,0x53,0x33,0x13,
+	0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x0b,0x05,0x25,0x45,0x65,0x85,0x95,
+	0x75,0x55,0x35,0x1b,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x18,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,
+	0x2d,0x0d,0x00,0x01,0x0d,0x2d,0x4c,0x6b,0x6f,0x74,0x6a,0x4b,0x2b,0x0b,0x00,0x02,0x1b,0x3b,0x5b,0x7a,0x64,0x7f,0x9f,0xbf,0xdf,0xff,0x00,0x01,0x0d,0x2d,0x4d,0x6d,
+	0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x1e,0x3e,0x5e,0x7e,0x9b,0x7b,0x5b,0x3b,0x1b,0x00,0x03,0x1c,0x34,0x45,0x46,0x46,0x44,0x33,0x1b,0x22,0x3f,0x5b,0x77,0x93,0x8a,0x6e,
+	0x52,0x35,0x35,0x45,0x45,0x46,0x44,0x33,0x1a,0x00,0x04,0x09,0x27,0x44,0x62,0x7f,0x9b,0x7e,0x60,0x52,0x58,0x58,0x55,0x42,0x26,0x09,0x00,0x04,0x01,0x1d,0x36,0x46,
+	0x47,0x48,0x46,0x35,0x1c,0x00,0x07,0x0d,0x1b,0x20,0x1a,0x0b,0x00,0x08,0x1d,0x3c,0x5a,0x78,0x96,0x85,0x67,0x49,0x63,0x83,0x96,0x76,0x67,0x67,0x67,0x67,0x67,0x58,
+	0x3c,0x1d,0x00,0x05,0x01,0x21,0x41,0x61,0x81,0x84,0x95,0x87,0x84,0x84,0x84,0x68,0x48,0x28,0x08,0x00,0x04,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x03,
+	0x02,0x1f,0x38,0x49,0x60,0x60,0x7b,0x67,0x70,0x53,0x51,0x64,0x5a,0x40,0x2d,0x1b,0x03,0x00,0x02,0x01,0x1d,0x36,0x47,0x48,0x48,0x47,0x45,0x4b,0x47,0x4b,0x3d,0x4b,
+	0x51,0x59,0x73,0x65,0x50,0x3c,0x46,0x49,0x48,0x47,0x36,0x1d,0x01,0x00,0x02,0x01,0x1e,0x3c,0x59,0x76,0x94,0x89,0x6b,0x79,0x5d,0x3e,0x1e,0x00,0x07,0x02,0x1e,0x37,
+	0x48,0x49,0x49,0x47,0x44,0x4c,0x47,0x4c,0x59,0x6b,0x5a,0x4c,0x50,0x70,0x90,0xb0,0xb8,0xb6,0xb6,0xb7,0xc8,0xe1,0xfd,0x00,0x03,0x03,0x22,0x40,0x5b,0x64,0x64,0x57,
+	0x70,0x7b,0x7a,0x5e,0x63,0x4f,0x32,0x13,0x03,0x00,0x04,0x02,0x1e,0x37,0x48,0x4b,0x4b,0x47,0x36,0x1c,0x26,0x3a,0x4b,0x4a,0x4a,0x45,0x4b,0x42,0x2d,0x12,0x00,0x04,
+	0x09,0x28,0x46,0x61,0x7b,0x63,0x75,0x8f,0xa9,0xc3,0xd8,0xd8,0xd8,0xdf,0xf0,0xff,0xff,0xff,0xff,0x00,0x04,0x02,0x02,0x02,0x02,0x11,0x2f,0x4a,0x5d,0x58,0x40,0x35,
+	0x54,0x70,0x66,0x7d,0x9d,0xbd,0xdd,0xfd,0x00,0x02,0x1a,0x31,0x40,0x42,0x42,0x40,0x30,0x3f,0x5b,0x77,0x93,0x89,0x6d,0x50,0x42,0x3f,0x43,0x3d,0x2a,0x11,0x00,0x07,
+	0x13,0x21,0x41,0x60,0x79,0x6e,0x8c,0x91,0x74,0x56,0x39,0x1b,0x00,0x05,0x0d,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x0e,0x00,0x03,0x05,0x25,0x45,0x65,0x85,
+	0x97,0x91,0xad,0xcd,0xbc,0xa5,0xa2,0xb7,0xd3,0xf1,0xfd,0xfd,0xfc,0xfe,0xff,0xff,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,
+	0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x0b,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x01,
+	0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x01,0x06,0x23,0x3e,0x52,0x54,0x5a,0x56,0x40,0x24,0x05,0x07,
+	0x05,0x15,0x32,0x4d,0x5c,0x5f,0x7f,0x9f,0xbf,0xdf,0xff,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x1e,0x3e,0x5e,0x7e,0x9b,0x7b,0x5b,0x3b,0x1b,
+	0x00,0x02,0x0b,0x2a,0x48,0x61,0x64,0x65,0x60,0x46,0x28,0x32,0x4e,0x6a,0x86,0x97,0x7b,0x5f,0x42,0x2c,0x49,0x62,0x63,0x65,0x60,0x46,0x27,0x08,0x00,0x03,0x15,0x33,
+	0x50,0x6e,0x8c,0x8f,0x71,0x54,0x68,0x78,0x78,0x6e,0x4f,0x2f,0x18,0x09,0x00,0x03,0x0b,0x2a,0x49,0x63,0x65,0x66,0x62,0x48,0x2a,0x0a,0x00,0x12,0x0a,0x28,0x46,0x64,
+	0x83,0x99,0x7b,0x5c,0x59,0x63,0x83,0x98,0x87,0x87,0x87,0x87,0x87,0x80,0x60,0x40,0x20,0x00,0x05,0x01,0x21,0x41,0x61,0x81,0x95,0x9e,0x96,0x95,0x95,0x88,0x68,0x48,
+	0x28,0x08,0x00,0x04,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x03,0x0c,0x2b,0x4a,0x65,0x68,0x68,0x65,0x62,0x69,0x50,0x49,0x55,0x4c,0x55,0x48,0x30,0x13,
+	0x00,0x02,0x0b,0x2b,0x49,0x63,0x66,0x66,0x63,0x5e,0x6b,0x62,0x69,0x51,0x33,0x31,0x47,0x54,0x4c,0x38,0x47,0x62,0x67,0x66,0x63,0x49,0x2b,0x0b,0x00,0x02,0x0d,0x2b,
+	0x48,0x66,0x83,0xa0,0x9e,0xa4,0x94,0xa7,0xc4,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x0c,0x2b,0x49,0x64,0x67,0x67,0x63,0x5c,0x6c,0x60,0x6b,0x54,0x4b,0x52,
+	0x6a,0x62,0x70,0x90,0xb0,0x9c,0x98,0x98,0x9b,0xb6,0xd4,0xf3,0x00,0x04,0x15,0x2d,0x40,0x5e,0x7a,0x61,0x61,0x64,0x5d,0x68,0x75,0x56,0x39,0x2f,0x1b,0x02,0x00,0x04,
+	0x0a,0x1d,0x29,0x2b,0x2b,0x29,0x1c,0x2a,0x3e,0x53,0x67,0x67,0x4c,0x33,0x2b,0x25,0x15,0x00,0x04,0x04,0x1a,0x2a,0x34,0x4d,0x5c,0x72,0x63,0x7d,0x97,0xb1,0xcb,0xe5,
+	0xe4,0xe4,0xe4,0xed,0xfd,0xff,0xff,0x00,0x02,0x04,0x16,0x21,0x22,0x22,0x21,0x16,0x1d,0x32,0x3e,0x3b,0x2b,0x2a,0x43,0x52,0x5d,0x7d,0x9d,0xbd,0xdd,0xfd,0x00,0x01,
+	0x0a,0x29,0x46,0x5e,0x60,0x61,0x5d,0x44,0x4e,0x6a,0x86,0x96,0x7a,0x5e,0x4e,0x62,0x5b,0x63,0x57,0x3d,0x1f,0x00,0x08,0x1f,0x3e,0x5b,0x6b,0x5c,0x60,0x61,0x7f,0x9c,
+	0xba,0xd7,0xf4,0xff,0x00,0x04,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0xa5,0xad,0xbe,0xd8,0xd2,0xc3,0xc1,0xce,0xe4,0xe8,
+	0xdd,0xdd,0xdd,0xde,0xea,0xfd,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,
+	0x0b,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,
+	0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x02,0x11,0x26,0x34,0x35,0x3b,0x39,0x2a,0x13,0x1e,0x27,0x24,0x17,0x21,0x36,0x3f,0x5f,0x7f,0x9f,0xbf,0xdf,0xff,
+	0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x1e,0x3e,0x5e,0x7e,0x9b,0x7b,0x5b,0x3b,0x1b,0x00,0x02,0x0d,0x2d,0x4d,0x6c,0x70,0x71,0x6a,0x4b,0x2b,
+	0x41,0x5d,0x79,0x95,0x88,0x6c,0x4f,0x33,0x2f,0x4e,0x6d,0x6e,0x72,0x69,0x4a,0x2a,0x0b,0x00,0x02,0x04,0x22,0x3f,0x5d,0x7a,0x98,0x82,0x65,0x49,0x69,0x89,0x90,0x70,
+	0x50,0x3f,0x35,0x22,0x08,0x00,0x02,0x0d,0x2d,0x4c,0x6b,0x6f,0x6f,0x6a,0x4c,0x2c,0x0c,0x00,0x12,0x14,0x33,0x51,0x6f,0x8d,0x8e,0x79,0x79,0x79,0x79,0x83,0x9d,0x92,
+	0x92,0x92,0x92,0x92,0x80,0x60,0x40,0x20,0x00,0x05,0x01,0x21,0x41,0x60,0x75,0x75,0x94,0x85,0x75,0x75,0x75,0x66,0x47,0x27,0x07,0x00,0x04,0x1c,0x3c,0x5c,0x7c,0x9c,
+	0x7d,0x5d,0x3d,0x1d,0x00,0x03,0x0d,0x2c,0x4c,0x69,0x6c,0x6d,0x68,0x4b,0x4a,0x4d,0x5c,0x74,0x61,0x74,0x5b,0x3b,0x1c,0x00,0x02,0x0d,0x2d,0x4c,0x6b,0x6e,0x6f,0x6a,
+	0x61,0x73,0x66,0x70,0x54,0x35,0x2a,0x40,0x4b,0x45,0x31,0x4b,0x69,0x6f,0x6e,0x6b,0x4c,0x2d,0x0d,0x00,0x02,0x1a,0x37,0x55,0x72,0x90,0xad,0xbd,0xa0,0x8b,0xa3,0xc2,
+	0xe2,0xe8,0xe7,0xe9,0xf3,0xff,0xff,0x00,0x01,0x0d,0x2d,0x4c,0x6a,0x6e,0x6e,0x69,0x5f,0x72,0x63,0x71,0x56,0x44,0x54,0x70,0x65,0x70,0x90,0xb0,0x96,0x90,0x91,0x95,
+	0xb3,0xd2,0xf2,0x00,0x05,0x17,0x34,0x4e,0x5b,0x70,0x70,0x7a,0x69,0x54,0x5a,0x52,0x59,0x48,0x2e,0x11,0x00,0x06,0x09,0x0b,0x0b,0x14,0x2d,0x42,0x57,0x6b,0x80,0x95,
+	0xa1,0xb5,0xd1,0xef,0xff,0xff,0xff,0x00,0x02,0x16,0x31,0x47,0x4f,0x44,0x55,0x70,0x8a,0x95,0x7b,0x60,0x46,0x37,0x3b,0x3b,0x3a,0x2e,0x19,0x00,0x04,0x1a,0x31,0x40,
+	0x42,0x42,0x40,0x30,0x19,0x16,0x1e,0x1c,0x11,0x22,0x37,0x43,0x5d,0x7d,0x9d,0xbd,0xdd,0xfd,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x71,0x73,0x6b,0x4c,0x5d,0x79,0x95,0x87,
+	0x6b,0x4e,0x57,0x76,0x68,0x7a,0x63,0x43,0x23,0x03,0x00,0x03,0x0d,0x17,0x18,0x18,0x20,0x40,0x5f,0x74,0x5c,0x42,0x55,0x72,0x90,0xad,0xca,0xe8,0xff,0x00,0x04,0x1c,
+	0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0xa5,0xbd,0xc9,0xdf,0xed,0xe2,0xe1,0xea,0xe4,0xcd,0xbe,0xbe,0xbd,0xbf,0xd0,0xe8,0xff,
+	0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x0b,0x05,0x25,0x45,0x65,0x85,0x95,
+	0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,
+	0x2d,0x0d,0x00,0x03,0x0b,0x14,0x15,0x1b,0x1a,0x0f,0x24,0x3a,0x46,0x42,0x30,0x33,0x4e,0x5f,0x5f,0x7f,0x9f,0xbf,0xdf,0xff,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,
+	0x6c,0x4c,0x2c,0x0c,0x1e,0x3e,0x5e,0x7e,0x9b,0x7b,0x5b,0x3b,0x1b,0x00,0x02,0x07,0x24,0x3f,0x54,0x55,0x56,0x53,0x3e,0x34,0x50,0x6c,0x88,0x95,0x79,0x5d,0x40,0x24,
+	0x26,0x41,0x54,0x55,0x56,0x53,0x3d,0x22,0x04,0x00,0x02,0x11,0x2e,0x4c,0x69,0x87,0x93,0x76,0x5f,0x5f,0x69,0x89,0x90,0x70,0x5f,0x5f,0x4f,0x34,0x16,0x00,0x02,0x06,
+	0x23,0x3e,0x52,0x54,0x54,0x52,0x3e,0x23,0x05,0x00,0x06,0x04,0x10,0x15,0x0f,0x02,0x00,0x06,0x01,0x1f,0x3d,0x5b,0x7a,0x98,0x9c,0x99,0x99,0x99,0x99,0x99,0x96,0x76,
+	0x72,0x72,0x72,0x72,0x72,0x5d,0x3f,0x1f,0x00,0x06,0x18,0x35,0x4c,0x55,0x74,0x94,0x85,0x65,0x55,0x55,0x4f,0x3a,0x1e,0x01,0x00,0x04,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,
+	0x5d,0x3d,0x1d,0x00,0x03,0x05,0x22,0x3c,0x4f,0x50,0x51,0x4f,0x43,0x60,0x6c,0x63,0x6a,0x5c,0x6a,0x56,0x39,0x1a,0x00,0x02,0x06,0x23,0x3e,0x51,0x53,0x53,0x51,0x4b,
+	0x53,0x4e,0x52,0x43,0x43,0x48,0x56,0x6b,0x5f,0x4a,0x3c,0x51,0x53,0x53,0x51,0x3e,0x23,0x06,0x00,0x02,0x1f,0x3f,0x5f,0x7f,0x9c,0xba,0xcc,0xb4,0xab,0xb6,0xce,0xc9,
+	0xc8,0xc7,0xca,0xd8,0xee,0xff,0x00,0x01,0x05,0x23,0x3d,0x51,0x52,0x52,0x50,0x49,0x52,0x4c,0x52,0x55,0x64,0x56,0x52,0x50,0x70,0x90,0xb0,0xaf,0xac,0xad,0xae,0xc2,
+	0xdc,0xfa,0x00,0x05,0x08,0x20,0x33,0x48,0x5f,0x5e,0x5b,0x54,0x52,0x62,0x67,0x75,0x57,0x37,0x17,0x00,0x08,0x02,0x21,0x3f,0x5a,0x6f,0x84,0x98,0x8d,0x75,0x55,0x35,
+	0x15,0x00,0x04,0x01,0x21,0x40,0x5e,0x6f,0x5d,0x64,0x5d,0x77,0x92,0x8d,0x73,0x59,0x53,0x5b,0x5b,0x59,0x46,0x2b,0x0d,0x00,0x02,0x0a,0x29,0x46,0x5e,0x60,0x60,0x5d,
+	0x45,0x28,0x09,0x00,0x02,0x14,0x32,0x4f,0x62,0x5d,0x7d,0x9d,0xbd,0xdd,0xfd,0x00,0x01,0x08,0x26,0x42,0x58,0x59,0x5a,0x57,0x50,0x6c,0x88,0x94,0x78,0x5c,0x3f,0x49,
+	0x5b,0x55,0x5c,0x52,0x39,0x1c,0x00,0x03,0x13,0x29,0x36,0x37,0x37,0x36,0x33,0x4b,0x54,0x49,0x31,0x48,0x66,0x83,0xa3,0xc3,0xe3,0xff,0x00,0x04,0x1c,0x3c,0x5c,0x7c,
+	0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0xa3,0x9e,0xb3,0xcf,0xee,0xff,0xff,0xf3,0xd5,0xb8,0xa0,0xa0,0x9e,0xa3,0xbb,0xd9,0xf8,0x00,0x01,0x05,
+	0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x0b,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,
+	0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,
+	0x08,0x14,0x33,0x50,0x66,0x5d,0x43,0x3a,0x5a,0x7a,0x9a,0x80,0x60,0x40,0x20,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x1e,0x3e,0x5e,0x7e,0x9b,
+	0x7b,0x5b,0x3b,0x1b,0x00,0x03,0x12,0x28,0x35,0x36,0x37,0x35,0x27,0x43,0x5f,0x7b,0x97,0x86,0x6a,0x4d,0x31,0x15,0x14,0x29,0x36,0x36,0x37,0x35,0x26,0x10,0x00,0x03,
+	0x1d,0x3b,0x58,0x76,0x93,0x87,0x7f,0x7f,0x7f,0x7f,0x89,0x90,0x7f,0x7f,0x7b,0x5b,0x3b,0x1b,0x00,0x03,0x11,0x26,0x34,0x35,0x35,0x33,0x26,0x11,0x00,0x06,0x07,0x1e,
+	0x2f,0x35,0x2d,0x1c,0x07,0x00,0x05,0x0b,0x2a,0x48,0x66,0x84,0x97,0x80,0x80,0x80,0x80,0x80,0x83,0x96,0x76,0x56,0x52,0x52,0x52,0x52,0x48,0x32,0x16,0x00,0x06,0x08,
+	0x1f,0x34,0x54,0x74,0x94,0x85,0x65,0x45,0x35,0x32,0x23,0x0d,0x00,0x05,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x04,0x0f,0x24,0x33,0x50,0x65,0x5e,0x44,
+	0x63,0x70,0x71,0x6b,0x66,0x56,0x40,0x2a,0x0f,0x00,0x03,0x11,0x26,0x33,0x34,0x34,0x33,0x2f,0x33,0x30,0x33,0x43,0x5e,0x67,0x59,0x73,0x88,0x9d,0xb5,0xcd,0xcb,0xcb,
+	0xcc,0xd9,0xee,0xff,0x00,0x01,0x07,0x25,0x40,0x54,0x60,0x57,0x54,0x3f,0x2e,0x34,0x2d,0x41,0x55,0x56,0x57,0x53,0x3e,0x22,0x04,0x00,0x02,0x10,0x25,0x32,0x33,0x33,
+	0x32,0x2d,0x32,0x2f,0x3f,0x5f,0x7b,0x60,0x60,0x65,0x70,0x90,0xb0,0xb6,0xc7,0xcc,0xcd,0xda,0xef,0xff,0x00,0x05,0x0c,0x19,0x25,0x32,0x41,0x41,0x3b,0x3c,0x5c,0x7b,
+	0x63,0x65,0x50,0x33,0x14,0x00,0x08,0x04,0x24,0x44,0x64,0x84,0x9c,0x89,0x74,0x60,0x4a,0x2e,0x10,0x00,0x04,0x01,0x21,0x40,0x5e,0x70,0x68,0x74,0x55,0x65,0x7f,0x99,
+	0x85,0x6b,0x65,0x7b,0x7b,0x73,0x53,0x33,0x13,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x71,0x72,0x6c,0x4c,0x2c,0x0c,0x00,0x02,0x18,0x38,0x57,0x77,0x67,0x7d,0x9d,0xbd,0xdd,
+	0xfd,0x00,0x02,0x15,0x2b,0x39,0x3a,0x3b,0x43,0x5f,0x7b,0x98,0x85,0x69,0x4c,0x30,0x31,0x3b,0x38,0x3c,0x36,0x25,0x0d,0x00,0x02,0x07,0x25,0x40,0x54,0x56,0x57,0x54,
+	0x3f,0x2e,0x34,0x2d,0x41,0x55,0x56,0x60,0x53,0x3e,0x22,0x04,0x00,0x04,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x95,0x8b,
+	0xaa,0xca,0xea,0xff,0xff,0xf0,0xd0,0xb0,0x90,0x8f,0x8b,0x95,0xb4,0xd4,0xf4,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x01,0x11,0x31,0x51,
+	0x71,0x91,0x86,0x66,0x46,0x26,0x06,0x00,0x0b,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x01,0x05,0x25,
+	0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x07,0x07,0x17,0x37,0x56,0x74,0x67,0x47,0x3a,0x5a,0x7a,0x9a,0x80,0x60,
+	0x40,0x20,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0x8c,0x6c,0x4c,0x2c,0x0c,0x1e,0x3e,0x5e,0x7e,0x9b,0x7b,0x5b,0x3b,0x1b,0x00,0x04,0x0c,0x16,0x17,0x17,0x1a,0x36,0x52,
+	0x6e,0x8a,0x93,0x77,0x5a,0x3e,0x22,0x06,0x00,0x01,0x0d,0x16,0x16,0x17,0x16,0x0b,0x00,0x03,0x0a,0x29,0x47,0x64,0x82,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9c,0x9f,0x9a,
+	0x9a,0x7b,0x5b,0x3b,0x1b,0x00,0x04,0x0b,0x14,0x15,0x15,0x14,0x0a,0x00,0x04,0x04,0x04,0x00,0x01,0x18,0x34,0x4b,0x55,0x49,0x34,0x20,0x0a,0x00,0x04,0x16,0x34,0x52,
+	0x71,0x8f,0x8d,0x6f,0x60,0x60,0x60,0x63,0x83,0x96,0x76,0x56,0x36,0x32,0x32,0x32,0x2c,0x1b,0x08,0x01,0x00,0x06,0x14,0x34,0x54,0x74,0x94,0x85,0x65,0x45,0x25,0x13,
+	0x08,0x00,0x06,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x04,0x0b,0x20,0x36,0x56,0x74,0x67,0x48,0x63,0x72,0x63,0x60,0x7b,0x5f,0x3f,0x1f,0x00,0x05,0x0a,
+	0x14,0x14,0x14,0x13,0x10,0x13,0x11,0x26,0x46,0x65,0x74,0x57,0x5b,0x70,0x6f,0x50,0x30,0x14,0x14,0x14,0x0a,0x00,0x03,0x0d,0x2d,0x4d,0x6c,0x70,0x71,0x6a,0x4b,0x2b,
+	0x14,0x2e,0x4e,0x6d,0x6f,0x73,0x69,0x4a,0x2a,0x0a,0x00,0x03,0x09,0x13,0x13,0x13,0x13,0x0e,0x12,0x1c,0x3b,0x58,0x6a,0x59,0x6a,0x8a,0x95,0x96,0x98,0x9a,0xb5,0xcb,
+	0xe0,0xf6,0xff,0xff,0x00,0x03,0x03,0x1a,0x2a,0x32,0x44,0x47,0x39,0x23,0x1b,0x34,0x4e,0x5d,0x52,0x45,0x39,0x23,0x09,0x00,0x08,0x04,0x24,0x44,0x64,0x84,0x95,0x75,
+	0x5b,0x47,0x33,0x1d,0x03,0x00,0x05,0x17,0x32,0x48,0x50,0x53,0x58,0x47,0x53,0x6d,0x87,0x98,0x7e,0x65,0x76,0x6a,0x70,0x52,0x33,0x13,0x00,0x02,0x08,0x26,0x42,0x58,
+	0x59,0x5a,0x57,0x41,0x25,0x07,0x05,0x03,0x12,0x2f,0x4a,0x5b,0x5d,0x7d,0x9d,0xbd,0xdd,0xfd,0x00,0x03,0x10,0x1a,0x1b,0x35,0x52,0x6e,0x8a,0x92,0x76,0x5a,0x3d,0x21,
+	0x14,0x1b,0x19,0x1c,0x18,0x0b,0x00,0x03,0x0d,0x2d,0x4d,0x6c,0x70,0x71,0x6a,0x4b,0x2b,0x14,0x2e,0x4e,0x6d,0x6f,0x73,0x69,0x4a,0x2a,0x0a,0x00,0x04,0x1c,0x3c,0x5c,
+	0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0xa5,0xa5,0xb7,0xd2,0xf0,0xfb,0xfa,0xf5,0xd7,0xbc,0xa7,0xa6,0xa5,0xa9,0xbf,0xdb,0xfa,0x00,0x01,
+	0x04,0x23,0x43,0x60,0x6f,0x66,0x6b,0x51,0x32,0x12,0x04,0x10,0x30,0x4f,0x6a,0x68,0x6e,0x61,0x44,0x25,0x05,0x00,0x0b,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,
+	0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,
+	0x05,0x09,0x1a,0x26,0x28,0x35,0x53,0x6b,0x61,0x45,0x38,0x57,0x6e,0x60,0x6f,0x5c,0x3e,0x1e,0x00,0x02,0x0c,0x2c,0x4b,0x67,0x6a,0x6b,0x66,0x49,0x31,0x25,0x26,0x3c,
+	0x5a,0x6f,0x5f,0x6f,0x58,0x39,0x1a,0x00,0x07,0x0c,0x29,0x45,0x61,0x7d,0x9a,0x84,0x67,0x4b,0x2f,0x13,0x00,0x0b,0x0d,0x2d,0x4d,0x6d,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,
+	0x7a,0x89,0x90,0x7a,0x7a,0x79,0x5b,0x3b,0x1b,0x00,0x0c,0x06,0x19,0x24,0x24,0x1a,0x21,0x40,0x60,0x74,0x61,0x4d,0x37,0x1d,0x00,0x03,0x02,0x21,0x3f,0x5d,0x7b,0x99,
+	0x82,0x64,0x46,0x40,0x43,0x63,0x83,0x96,0x76,0x56,0x36,0x29,0x29,0x29,0x29,0x29,0x28,0x1e,0x0c,0x00,0x05,0x14,0x34,0x54,0x74,0x94,0x85,0x65,0x45,0x25,0x0a,0x0a,
+	0x06,0x00,0x05,0x1c,0x3c,0x5c,0x7c,0x93,0x7d,0x5d,0x3d,0x1d,0x00,0x03,0x01,0x1e,0x39,0x4c,0x50,0x57,0x52,0x43,0x5f,0x6b,0x72,0x8b,0xa4,0xb0,0xc5,0xda,0xf4,0xff,
+	0x00,0x0a,0x06,0x25,0x44,0x61,0x6c,0x54,0x42,0x55,0x56,0x43,0x27,0x0a,0x00,0x06,0x0b,0x2a,0x47,0x61,0x63,0x64,0x60,0x46,0x28,0x27,0x2b,0x49,0x61,0x62,0x64,0x5f,
+	0x45,0x27,0x08,0x00,0x0a,0x1e,0x3e,0x5d,0x75,0x5e,0x68,0x70,0x6d,0x75,0x6d,0x6a,0x60,0x4c,0x30,0x12,0x00,0x05,0x14,0x30,0x47,0x51,0x5f,0x66,0x4f,0x31,0x24,0x2d,
+	0x34,0x3d,0x37,0x25,0x1d,0x0c,0x00,0x09,0x04,0x24,0x44,0x64,0x84,0x95,0x75,0x55,0x35,0x1a,0x06,0x00,0x06,0x05,0x1b,0x2b,0x3c,0x4a,0x60,0x5d,0x45,0x5a,0x74,0x8f,
+	0x90,0x76,0x5c,0x52,0x55,0x43,0x29,0x0c,0x00,0x03,0x15,0x2b,0x39,0x3a,0x3b,0x39,0x2b,0x14,0x1c,0x25,0x23,0x16,0x1e,0x33,0x3e,0x5d,0x7d,0x9d,0xbd,0xdd,0xfd,0x00,
+	0x04,0x0d,0x29,0x43,0x57,0x74,0x65,0x7c,0x98,0xa2,0xbc,0xda,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x0b,0x2a,0x47,0x61,0x63,0x64,0x60,0x46,0x28,0x27,
+	0x2b,0x49,0x61,0x62,0x64,0x5f,0x45,0x27,0x08,0x00,0x04,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0xa5,0xc1,0xce,0xe3,0xe7,
+	0xdc,0xdb,0xe4,0xe9,0xd3,0xc5,0xc5,0xc4,0xc6,0xd5,0xec,0xff,0x00,0x02,0x19,0x34,0x49,0x4f,0x4c,0x4e,0x3e,0x25,0x1f,0x24,0x1f,0x24,0x3d,0x4d,0x4c,0x4f,0x49,0x35,
+	0x1a,0x00,0x0c,0x03,0x22,0x41,0x5d,0x69,0x61,0x68,0x50,0x32,0x26,0x29,0x48,0x62,0x67,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x01,0x03,0x22,0x41,0x5d,0x69,0x61,0x68,0x50,
+	0x32,0x26,0x29,0x48,0x62,0x67,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x04,0x14,0x25,0x35,0x45,0x48,0x3a,0x55,0x70,0x64,0x46,0x2b,0x42,0x4f,0x48,0x4f,0x46,0x2f,0x14,0x00,
+	0x02,0x04,0x20,0x3a,0x4c,0x4d,0x4e,0x62,0x5e,0x45,0x45,0x45,0x53,0x65,0x58,0x48,0x4f,0x43,0x2c,0x10,0x00,0x07,0x19,0x35,0x54,0x70,0x8d,0x91,0x74,0x58,0x43,0x33,
+	0x1b,0x00,0x0b,0x07,0x25,0x41,0x56,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x69,0x89,0x90,0x70,0x5a,0x5a,0x4c,0x32,0x15,0x00,0x0b,0x01,0x1c,0x33,0x43,0x43,0x35,0x1f,0x3e,
+	0x5b,0x71,0x85,0x9b,0xb8,0xd7,0xf6,0x00,0x02,0x0d,0x2b,0x49,0x68,0x86,0x96,0x78,0x59,0x3b,0x23,0x43,0x63,0x83,0x96,0x76,0x56,0x49,0x49,0x49,0x49,0x49,0x49,0x47,
+	0x39,0x21,0x06,0x00,0x03,0x09,0x1d,0x34,0x54,0x74,0x94,0x85,0x65,0x45,0x2a,0x2a,0x2a,0x25,0x16,0x00,0x04,0x1c,0x3b,0x5a,0x73,0x73,0x73,0x5b,0x3c,0x1c,0x00,0x03,
+	0x0a,0x29,0x49,0x66,0x70,0x70,0x69,0x4d,0x46,0x4b,0x5b,0x6c,0x5c,0x64,0x52,0x36,0x17,0x00,0x0b,0x06,0x26,0x45,0x63,0x6f,0x56,0x37,0x37,0x37,0x2b,0x15,0x00,0x08,
+	0x1c,0x34,0x44,0x45,0x45,0x43,0x32,0x3f,0x47,0x3e,0x34,0x44,0x45,0x46,0x43,0x32,0x19,0x00,0x0b,0x16,0x32,0x4a,0x55,0x4b,0x50,0x5a,0x6a,0x5e,0x51,0x69,0x76,0x56,
+	0x36,0x16,0x00,0x05,0x1e,0x3d,0x5c,0x71,0x68,0x72,0x54,0x3e,0x44,0x4d,0x49,0x35,0x1b,0x0c,0x00,0x0b,0x04,0x24,0x44,0x64,0x84,0x8a,0x75,0x55,0x35,0x15,0x00,0x08,
+	0x1f,0x3d,0x57,0x62,0x73,0x6c,0x4c,0x48,0x62,0x7c,0x96,0x88,0x98,0xb2,0xc5,0xd5,0xe9,0xff,0xff,0x00,0x03,0x10,0x1a,0x1b,0x1b,0x1a,0x10,0x21,0x38,0x44,0x41,0x30,
+	0x2f,0x4b,0x5d,0x5d,0x7d,0x9d,0xbd,0xdd,0xfd,0x00,0x04,0x1c,0x39,0x55,0x70,0x68,0x63,0x71,0x74,0x69,0x49,0x29,0x09,0x00,0x09,0x1c,0x34,0x44,0x45,0x45,0x43,0x32,
+	0x3f,0x47,0x3e,0x34,0x44,0x45,0x46,0x43,0x32,0x19,0x00,0x05,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0xa5,0xa2,0xb6,0xd2,
+	0xcd,0xbd,0xbb,0xc9,0xe0,0xee,0xe4,0xe4,0xe4,0xe5,0xf0,0xff,0xff,0x00,0x02,0x07,0x1c,0x2b,0x2f,0x2d,0x2f,0x24,0x28,0x3c,0x44,0x3d,0x29,0x23,0x2e,0x2e,0x2f,0x2c,
+	0x1d,0x08,0x00,0x0d,0x16,0x30,0x44,0x4a,0x46,0x49,0x3b,0x3b,0x46,0x40,0x35,0x47,0x52,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x02,0x16,0x30,0x44,0x4a,0x46,0x49,0x3b,0x3b,
+	0x46,0x40,0x35,0x47,0x52,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x03,0x11,0x2b,0x41,0x51,0x61,0x66,0x4f,0x43,0x51,0x4c,0x38,0x1d,0x27,0x2f,0x2b,0x2f,0x29,0x19,0x02,0x00,
+	0x03,0x0d,0x21,0x2d,0x34,0x53,0x73,0x6b,0x5d,0x65,0x64,0x5c,0x79,0x62,0x42,0x2f,0x27,0x16,0x00,0x07,0x0e,0x2a,0x46,0x5a,0x6c,0x63,0x7e,0x9a,0x9d,0x9f,0xb8,0xd5,
+	0xf4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x02,0x14,0x2a,0x38,0x3a,0x3a,0x3a,0x3a,0x3a,0x49,0x69,0x89,0x90,0x70,0x50,0x3a,0x31,0x1e,0x06,0x00,0x0b,
+	0x0c,0x2a,0x48,0x60,0x61,0x4a,0x2c,0x2e,0x44,0x58,0x6d,0x65,0x48,0x29,0x09,0x00,0x02,0x18,0x36,0x54,0x72,0x90,0x8b,0x6d,0x4f,0x31,0x23,0x43,0x63,0x83,0x96,0x76,
+	0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x65,0x4d,0x30,0x11,0x00,0x02,0x02,0x1e,0x36,0x47,0x54,0x74,0x94,0x85,0x65,0x4a,0x4a,0x4a,0x4a,0x42,0x2d,0x13,0x00,0x03,0x1b,
+	0x36,0x4c,0x5f,0x79,0x5f,0x4d,0x37,0x1c,0x00,0x03,0x0a,0x29,0x48,0x65,0x6f,0x6f,0x72,0x5a,0x50,0x4a,0x5b,0x72,0x64,0x78,0x5a,0x3a,0x1a,0x00,0x0b,0x0d,0x2c,0x49,
+	0x61,0x61,0x49,0x2c,0x18,0x18,0x0f,0x00,0x09,0x06,0x19,0x25,0x25,0x26,0x24,0x3c,0x58,0x67,0x56,0x3a,0x25,0x25,0x26,0x24,0x18,0x04,0x00,0x0b,0x0d,0x2c,0x4a,0x62,
+	0x62,0x6c,0x63,0x75,0x5d,0x40,0x57,0x5d,0x4a,0x2f,0x11,0x00,0x05,0x1d,0x3d,0x5b,0x6e,0x5c,0x56,0x45,0x58,0x64,0x6c,0x63,0x46,0x27,0x08,0x00,0x0b,0x02,0x22,0x40,
+	0x5d,0x6a,0x6a,0x67,0x4f,0x31,0x12,0x00,0x07,0x04,0x24,0x43,0x63,0x7b,0x5b,0x57,0x41,0x35,0x50,0x6a,0x84,0xa2,0x92,0x98,0xb2,0xcc,0xe6,0xff,0xff,0x00,0x08,0x12,
+	0x31,0x4e,0x63,0x5d,0x43,0x36,0x56,0x76,0x69,0x7d,0x9d,0xbd,0xdd,0xfd,0x00,0x03,0x0f,0x2b,0x48,0x64,0x80,0x9c,0x86,0xa2,0x96,0x9d,0xb9,0xd8,0xf7,0xff,0xff,0xff,
+	0xff,0xff,0xff,0xff,0x00,0x02,0x06,0x19,0x25,0x25,0x26,0x24,0x3c,0x58,0x67,0x56,0x3a,0x25,0x25,0x26,0x24,0x18,0x04,0x00,0x05,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,
+	0x3e,0x1e,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x93,0x8c,0xac,0xcc,0xb9,0xa0,0x9d,0xb3,0xd0,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x03,0x01,0x0c,0x0f,0x0e,
+	0x0f,0x1b,0x39,0x55,0x64,0x56,0x3b,0x1c,0x0f,0x0e,0x0f,0x0d,0x02,0x00,0x0e,0x03,0x18,0x26,0x2a,0x27,0x29,0x36,0x53,0x66,0x5a,0x41,0x58,0x5b,0x72,0x92,0xb2,0xd2,
+	0xf2,0x00,0x02,0x03,0x18,0x26,0x2a,0x27,0x29,0x36,0x53,0x66,0x5a,0x41,0x58,0x5b,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x03,0x1c,0x3b,0x58,0x6c,0x7d,0x8e,0xab,0xbc,0xac,
+	0xb1,0xc6,0xe1,0xf6,0xf0,0xf3,0xf0,0xf4,0xff,0xff,0xff,0x00,0x03,0x04,0x0e,0x2b,0x46,0x58,0x55,0x68,0x7a,0x75,0x56,0x5a,0x50,0x38,0x1b,0x09,0x00,0x07,0x01,0x1e,
+	0x3a,0x56,0x72,0x6d,0x61,0x6a,0x56,0x70,0x6d,0x4d,0x2e,0x0e,0x00,0x0c,0x0e,0x19,0x1a,0x1a,0x1a,0x1a,0x29,0x49,0x69,0x89,0x90,0x70,0x50,0x30,0x14,0x05,0x00,0x0c,
+	0x0e,0x2e,0x4e,0x6e,0x6f,0x50,0x30,0x16,0x2b,0x40,0x4f,0x4b,0x38,0x1e,0x01,0x00,0x01,0x04,0x22,0x40,0x5e,0x7d,0x9b,0x81,0x62,0x44,0x26,0x23,0x43,0x63,0x83,0x98,
+	0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x73,0x53,0x33,0x13,0x00,0x02,0x0b,0x2b,0x49,0x64,0x6a,0x74,0x94,0x85,0x6a,0x6a,0x6a,0x6a,0x6a,0x5a,0x3e,0x1f,0x00,0x02,
+	0x04,0x24,0x44,0x62,0x72,0x66,0x72,0x63,0x45,0x25,0x06,0x00,0x02,0x01,0x1e,0x38,0x53,0x6f,0x67,0x6c,0x57,0x6f,0x62,0x47,0x52,0x51,0x5a,0x4b,0x31,0x14,0x00,0x0b,
+	0x0f,0x2f,0x4f,0x6e,0x6e,0x4f,0x2f,0x0f,0x00,0x0d,0x05,0x06,0x06,0x21,0x41,0x60,0x78,0x5d,0x3e,0x1e,0x06,0x06,0x05,0x00,0x0d,0x0f,0x2f,0x4f,0x6e,0x6e,0x73,0x92,
+	0xaa,0xb5,0xcd,0xc5,0xc2,0xcd,0xe2,0xfc,0xff,0xff,0x00,0x03,0x13,0x2e,0x44,0x4e,0x45,0x36,0x43,0x62,0x7a,0x6f,0x65,0x4d,0x35,0x18,0x00,0x0b,0x05,0x23,0x3d,0x51,
+	0x67,0x77,0x57,0x49,0x31,0x15,0x00,0x08,0x1d,0x3a,0x53,0x5c,0x4d,0x3a,0x31,0x45,0x4c,0x59,0x65,0x6b,0x6c,0x86,0xa0,0xba,0xd4,0xf0,0xff,0x00,0x08,0x15,0x35,0x55,
+	0x74,0x69,0x49,0x36,0x56,0x76,0x96,0x82,0x62,0x42,0x22,0x02,0x00,0x02,0x02,0x1e,0x3b,0x57,0x73,0x8f,0x8e,0x72,0x56,0x70,0x67,0x48,0x29,0x09,0x00,0x0b,0x05,0x06,
+	0x06,0x21,0x41,0x60,0x78,0x5d,0x3e,0x1e,0x06,0x06,0x05,0x00,0x07,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,
+	0x33,0x4c,0x6b,0x72,0x53,0x33,0x13,0x00,0x0f,0x1f,0x3f,0x5e,0x7b,0x60,0x40,0x20,0x00,0x15,0x07,0x0a,0x08,0x1b,0x3b,0x5a,0x78,0x63,0x4c,0x6c,0x73,0x72,0x92,0xb2,
+	0xd2,0xf2,0x00,0x04,0x07,0x0a,0x08,0x1b,0x3b,0x5a,0x78,0x63,0x4c,0x6c,0x73,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x03,0x1e,0x3e,0x5d,0x75,0x67,0x57,0x44,0x55,0x71,0x66,
+	0x47,0x28,0x08,0x00,0x0c,0x19,0x2e,0x39,0x45,0x61,0x6b,0x69,0x52,0x3a,0x34,0x23,0x0c,0x00,0x08,0x09,0x29,0x48,0x65,0x81,0x90,0x7f,0x60,0x4d,0x67,0x65,0x4a,0x2b,
+	0x0c,0x00,0x11,0x09,0x29,0x49,0x69,0x89,0x90,0x70,0x50,0x30,0x0f,0x00,0x0d,0x0d,0x2c,0x4a,0x64,0x66,0x4c,0x2e,0x0e,0x13,0x25,0x2f,0x2d,0x20,0x0b,0x00,0x02,0x0c,
+	0x2c,0x4b,0x69,0x87,0x90,0x76,0x58,0x3a,0x1b,0x23,0x43,0x63,0x83,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x73,0x53,0x33,0x13,0x00,0x02,0x0d,0x2d,0x4d,0x6d,
+	0x8a,0x8a,0x97,0x8c,0x8a,0x8a,0x8a,0x8a,0x81,0x61,0x41,0x21,0x01,0x00,0x01,0x03,0x23,0x42,0x5e,0x6b,0x6e,0x6b,0x5f,0x43,0x24,0x05,0x00,0x03,0x13,0x32,0x50,0x69,
+	0x63,0x4c,0x55,0x6d,0x61,0x44,0x32,0x35,0x3a,0x31,0x1e,0x05,0x00,0x0b,0x0e,0x2d,0x4c,0x66,0x66,0x4c,0x2d,0x0e,0x00,0x10,0x1f,0x3e,0x5b,0x6c,0x59,0x3b,0x1c,0x00,
+	0x10,0x0e,0x2d,0x4c,0x67,0x67,0x6b,0x8a,0xa9,0xc9,0xe2,0xe4,0xe1,0xe9,0xfa,0xff,0xff,0xff,0x00,0x03,0x01,0x18,0x28,0x2e,0x28,0x21,0x3f,0x5c,0x6b,0x5f,0x79,0x5f,
+	0x3f,0x1f,0x00,0x0b,0x0c,0x2c,0x4c,0x6a,0x6e,0x62,0x75,0x5c,0x3d,0x1d,0x00,0x08,0x0e,0x26,0x37,0x3d,0x34,0x22,0x41,0x5e,0x6c,0x56,0x62,0x79,0x90,0x8c,0x72,0x57,
+	0x38,0x19,0x00,0x09,0x14,0x33,0x51,0x69,0x62,0x46,0x36,0x56,0x76,0x90,0x82,0x62,0x42,0x22,0x02,0x00,0x02,0x0c,0x2b,0x4a,0x66,0x82,0x96,0x7f,0x62,0x46,0x53,0x4f,
+	0x3a,0x1f,0x02,0x00,0x0e,0x1f,0x3e,0x5b,0x6c,0x59,0x3b,0x1c,0x00,0x0a,0x1c,0x3c,0x5c,0x7c,0x9c,0x7e,0x5e,0x3e,0x1e,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x90,0x73,
+	0x53,0x33,0x48,0x63,0x68,0x4f,0x30,0x11,0x00,0x0f,0x1c,0x3b,0x58,0x6a,0x59,0x3c,0x1e,0x00,0x18,0x19,0x38,0x56,0x6c,0x5e,0x4c,0x6c,0x8b,0x8b,0x6d,0x4d,0x2d,0x0d,
+	0x00,0x07,0x19,0x38,0x56,0x6c,0x5e,0x4c,0x6c,0x8b,0x8b,0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x16,0x32,0x4a,0x55,0x4b,0x3b,0x34,0x52,0x69,0x61,0x45,0x26,0x07,0x00,0x0c,
+	0x01,0x11,0x28,0x47,0x66,0x74,0x71,0x55,0x36,0x16,0x09,0x00,0x09,0x09,0x29,0x48,0x65,0x70,0x70,0x6d,0x54,0x50,0x6d,0x6a,0x4c,0x2d,0x0d,0x00,0x11,0x08,0x27,0x47,
+	0x64,0x70,0x70,0x69,0x4d,0x2e,0x0e,0x00,0x0d,0x0e,0x2e,0x4d,0x6b,0x6d,0x4f,0x30,0x10,0x00,0x01,0x08,0x0f,0x0e,0x04,0x00,0x03,0x0c,0x2c,0x4b,0x67,0x70,0x70,0x69,
+	0x4d,0x2f,0x11,0x21,0x41,0x5f,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x6c,0x50,0x31,0x12,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0x90,0x90,0x90,0x90,0x90,
+	0x90,0x90,0x81,0x61,0x41,0x21,0x01,0x00,0x02,0x17,0x31,0x45,0x5c,0x71,0x5d,0x46,0x32,0x18,0x00,0x04,0x09,0x24,0x3c,0x4b,0x48,0x38,0x58,0x75,0x65,0x46,0x27,0x17,
+	0x1a,0x14,0x05,0x00,0x0c,0x0f,0x2f,0x4e,0x6b,0x6b,0x4e,0x2f,0x0f,0x00,0x10,0x20,0x40,0x5e,0x73,0x5c,0x3d,0x1d,0x00,0x10,0x0f,0x2e,0x4e,0x6b,0x6b,0x5f,0x68,0x52,
+	0x34,0x15,0x00,0x0c,0x0a,0x0e,0x0a,0x22,0x42,0x60,0x73,0x5a,0x66,0x57,0x3b,0x1c,0x00,0x0b,0x0b,0x2a,0x49,0x63,0x66,0x6e,0x6a,0x58,0x3b,0x1c,0x00,0x09,0x0c,0x19,
+	0x1d,0x16,0x23,0x43,0x61,0x72,0x59,0x4e,0x67,0x70,0x70,0x6f,0x57,0x38,0x19,0x00,0x09,0x15,0x35,0x54,0x70,0x67,0x48,0x34,0x53,0x6d,0x70,0x70,0x5e,0x40,0x21,0x01,
+	0x00,0x02,0x0e,0x2e,0x4e,0x6c,0x76,0x76,0x6f,0x53,0x37,0x33,0x31,0x23,0x0d,0x00,0x0f,0x20,0x40,0x5e,0x73,0x5c,0x3d,0x1d,0x00,0x0a,0x1c,0x3c,0x5c,0x7c,0x90,0x7e,
+	0x5e,0x3e,0x1e,0x00,0x04,0x04,0x23,0x43,0x60,0x70,0x70,0x6b,0x51,0x32,0x4b,0x69,0x6e,0x51,0x32,0x12,0x00,0x0f,0x1e,0x3e,0x5d,0x75,0x5f,0x3f,0x20,0x00,0x18,0x1a,
+	0x3a,0x59,0x72,0x61,0x48,0x63,0x6b,0x6b,0x64,0x49,0x2a,0x0b,0x00,0x07,0x1a,0x3a,0x59,0x72,0x61,0x48,0x63,0x6b,0x6b,0x64,0x49,0x2a,0x0b,0x00,0x03,0x05,0x1d,0x2e,
+	0x35,0x2f,0x1f,0x36,0x56,0x75,0x68,0x48,0x28,0x09,0x00,0x0d,0x01,0x1e,0x39,0x4e,0x54,0x53,0x44,0x2b,0x0e,0x00,0x0a,0x01,0x1e,0x38,0x4b,0x50,0x50,0x4f,0x40,0x40,
+	0x51,0x50,0x3d,0x23,0x06,0x00,0x12,0x1d,0x37,0x4b,0x50,0x50,0x4e,0x3c,0x23,0x06,0x00,0x0d,0x07,0x24,0x3e,0x51,0x52,0x40,0x25,0x08,0x00,0x08,0x04,0x20,0x3a,0x4c,
+	0x50,0x50,0x4d,0x3c,0x23,0x06,0x17,0x33,0x48,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x4f,0x3f,0x26,0x09,0x00,0x02,0x0c,0x2c,0x4b,0x67,0x70,0x70,0x70,
+	0x70,0x70,0x70,0x70,0x70,0x70,0x5d,0x3f,0x20,0x00,0x03,0x04,0x19,0x30,0x47,0x51,0x47,0x31,0x1a,0x05,0x00,0x05,0x0f,0x21,0x2b,0x29,0x35,0x52,0x67,0x5e,0x42,0x24,
+	0x05,0x00,0x0f,0x07,0x24,0x3e,0x50,0x50,0x3e,0x24,0x07,0x00,0x10,0x17,0x33,0x49,0x53,0x48,0x30,0x14,0x00,0x10,0x07,0x23,0x3d,0x4f,0x4f,0x45,0x49,0x3c,0x25,0x0a,
+	0x00,0x0f,0x19,0x35,0x4b,0x54,0x47,0x46,0x3e,0x2a,0x10,0x00,0x0b,0x01,0x1d,0x36,0x47,0x63,0x6e,0x55,0x40,0x2b,0x10,0x00,0x0d,0x1a,0x35,0x4b,0x53,0x46,0x39,0x4c,
+	0x50,0x50,0x4f,0x43,0x2b,0x0f,0x00,0x09,0x0d,0x2a,0x43,0x53,0x4f,0x3a,0x28,0x40,0x4f,0x50,0x50,0x47,0x32,0x17,0x00,0x03,0x07,0x25,0x40,0x53,0x56,0x56,0x54,0x42,
+	0x28,0x13,0x12,0x07,0x00,0x10,0x17,0x33,0x49,0x53,0x48,0x30,0x14,0x00,0x0a,0x1b,0x3a,0x59,0x6f,0x70,0x6f,0x5a,0x3c,0x1c,0x00,0x05,0x19,0x34,0x49,0x50,0x50,0x4e,
+	0x3e,0x25,0x3c,0x50,0x52,0x41,0x27,0x0a,0x00,0x0f,0x16,0x32,0x4a,0x55,0x4b,0x33,0x17,0x00,0x18,0x12,0x2e,0x46,0x53,0x4b,0x36,0x48,0x4b,0x4b,0x48,0x37,0x1e,0x02,
+	0x00,0x07,0x12,0x2e,0x46,0x53,0x4b,0x36,0x48,0x4b,0x4b,0x48,0x37,0x1e,0x02,0x00,0x04,0x03,0x10,0x15,0x11,0x13,0x32,0x4f,0x64,0x5d,0x43,0x25,0x06,0x00,0x0e,0x0c,
+	0x22,0x30,0x34,0x33,0x2a,0x16,0x00,0x0c,0x0b,0x1f,0x2d,0x30,0x30,0x2f,0x26,0x27,0x32,0x32,0x25,0x10,0x00,0x13,0x0a,0x1f,0x2d,0x30,0x30,0x2f,0x23,0x0f,0x00,0x0f,
+	0x11,0x26,0x33,0x33,0x27,0x13,0x00,0x0a,0x0d,0x21,0x2d,0x30,0x30,0x2e,0x22,0x0f,0x00,0x01,0x06,0x1c,0x2b,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2f,
+	0x25,0x11,0x00,0x03,0x04,0x20,0x3a,0x4c,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x47,0x31,0x16,0x00,0x04,0x03,0x1a,0x2b,0x31,0x2b,0x1b,0x04,0x00,0x07,0x04,
+	0x0b,0x0b,0x26,0x3c,0x48,0x43,0x30,0x17,0x00,0x11,0x11,0x25,0x31,0x31,0x25,0x11,0x00,0x11,0x06,0x1d,0x2d,0x33,0x2c,0x1b,0x04,0x00,0x11,0x10,0x24,0x30,0x30,0x26,
+	0x29,0x21,0x0f,0x00,0x10,0x08,0x1e,0x2e,0x34,0x2c,0x26,0x21,0x12,0x00,0x0d,0x09,0x1c,0x36,0x4a,0x4f,0x41,0x29,0x14,0x00,0x0e,0x08,0x1f,0x2e,0x33,0x2b,0x21,0x2d,
+	0x30,0x30,0x2f,0x27,0x16,0x00,0x0b,0x16,0x29,0x33,0x31,0x23,0x13,0x25,0x2f,0x30,0x30,0x2a,0x1b,0x05,0x00,0x04,0x12,0x28,0x34,0x36,0x36,0x35,0x29,0x15,0x00,0x13,
+	0x06,0x1d,0x2d,0x33,0x2c,0x1b,0x04,0x00,0x0a,0x11,0x2d,0x44,0x4f,0x50,0x4f,0x45,0x2e,0x12,0x00,0x05,0x07,0x1c,0x2b,0x30,0x30,0x2f,0x24,0x11,0x24,0x31,0x33,0x28,
+	0x14,0x00,0x10,0x06,0x1d,0x2f,0x35,0x2f,0x1e,0x07,0x00,0x18,0x01,0x19,0x2b,0x33,0x2e,0x1f,0x29,0x2b,0x2b,0x29,0x1d,0x0a,0x00,0x08,0x01,0x19,0x2b,0x33,0x2e,0x1f,
+	0x29,0x2b,0x2b,0x29,0x1d,0x0a,0x00,0x09,0x07,0x22,0x38,0x45,0x41,0x30,0x17,0x00,0x10,0x07,0x11,0x14,0x13,0x0c,0x00,0x0e,0x04,0x0e,0x10,0x10,0x0f,0x08,0x0a,0x13,
+	0x12,0x09,0x00,0x15,0x04,0x0e,0x10,0x10,0x0f,0x06,0x00,0x11,0x0a,0x13,0x14,0x0b,0x00,0x0c,0x05,0x0e,0x10,0x10,0x0e,0x06,0x00,0x03,0x01,0x0d,0x10,0x10,0x10,0x10,
+	0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x08,0x00,0x05,0x0d,0x21,0x2d,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2a,0x1a,0x04,0x00,0x06,0x0d,0x11,0x0d,0x00,0x0c,
+	0x0f,0x20,0x28,0x25,0x18,0x03,0x00,0x12,0x09,0x12,0x12,0x09,0x00,0x13,0x02,0x0f,0x13,0x0e,0x01,0x00,0x13,0x08,0x11,0x11,0x08,0x09,0x03,0x00,0x12,0x04,0x10,0x14,
+	0x0e,0x06,0x02,0x00,0x0f,0x08,0x1e,0x2c,0x2f,0x26,0x14,0x00,0x10,0x04,0x0f,0x13,0x0d,0x04,0x0e,0x10,0x10,0x0f,0x09,0x00,0x0d,0x0c,0x13,0x12,0x07,0x00,0x01,0x08,
+	0x0f,0x10,0x10,0x0c,0x00,0x07,0x0c,0x15,0x16,0x16,0x15,0x0d,0x00,0x15,0x02,0x0f,0x13,0x0e,0x01,0x00,0x0c,0x17,0x28,0x2f,0x2f,0x2f,0x29,0x18,0x01,0x00,0x06,0x01,
+	0x0c,0x10,0x10,0x0f,0x07,0x00,0x01,0x08,0x12,0x13,0x0b,0x00,0x12,0x03,0x11,0x15,0x11,0x04,0x00,0x1b,0x0d,0x13,0x0f,0x04,0x0a,0x0b,0x0b,0x0a,0x01,0x00,0x0b,0x0d,
+	0x13,0x0f,0x04,0x0a,0x0b,0x0b,0x0a,0x01,0x00,0x0b,0x0b,0x1c,0x25,0x22,0x16,0x02,0x00,0x86,0x05,0x0e,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x0b,0x00,0x18,
+	0x02,0x08,0x06,0x00,0x71,0x02,0x0d,0x0f,0x09,0x00,0x66,0x0a,0x0f,0x10,0x0f,0x0a,0x00,0x6f,0x05,0x03,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xdb,0x04,0x03,0x00,0x14,
+	0x07,0x07,0x00,0x06,0x01,0x07,0x08,0x08,0x06,0x00,0x11,0x07,0x08,0x02,0x00,0x24,0x06,0x0b,0x08,0x00,0x0b,0x05,0x07,0x07,0x07,0x07,0x06,0x07,0x07,0x05,0x00,0x0c,
+	0x06,0x0a,0x06,0x00,0x0e,0x07,0x0c,0x08,0x00,0x02,0x09,0x0c,0x06,0x00,0x0a,0x06,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x06,0x00,0x0b,0x06,0x0c,0x08,0x00,
+	0x02,0x08,0x0c,0x06,0x00,0x11,0x08,0x09,0x02,0x00,0x01,0x07,0x0e,0x0c,0x01,0x00,0x0a,0x04,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x06,0x00,0x12,0x03,0x08,
+	0x08,0x08,0x05,0x00,0x07,0x05,0x08,0x08,0x08,0x08,0x08,0x06,0x00,0x13,0x07,0x0c,0x08,0x00,0x02,0x09,0x0c,0x06,0x00,0x11,0x04,0x07,0x07,0x06,0x00,0x02,0x04,0x07,
+	0x07,0x06,0x00,0x10,0x05,0x0b,0x09,0x00,0x02,0x07,0x0c,0x07,0x00,0x0c,0x06,0x07,0x07,0x07,0x07,0x06,0x00,0x0e,0x06,0x07,0x07,0x07,0x07,0x03,0x00,0x11,0x08,0x0a,
+	0x03,0x00,0x01,0x06,0x0e,0x0c,0x03,0x00,0x0d,0x05,0x07,0x07,0x07,0x05,0x00,0x07,0x05,0x08,0x08,0x09,0x09,0x09,0x09,0x05,0x00,0x0d,0x04,0x07,0x07,0x07,0x00,0x2d,
+	0x07,0x19,0x23,0x23,0x18,0x05,0x00,0x10,0x0a,0x1c,0x27,0x26,0x1b,0x08,0x00,0x03,0x0d,0x1e,0x27,0x28,0x28,0x26,0x19,0x06,0x00,0x0d,0x05,0x19,0x26,0x28,0x20,0x0e,
+	0x00,0x0c,0x04,0x0f,0x11,0x0a,0x00,0x01,0x08,0x11,0x10,0x07,0x00,0x0d,0x14,0x24,0x2b,0x26,0x18,0x02,0x00,0x07,0x03,0x17,0x24,0x27,0x27,0x27,0x27,0x26,0x27,0x27,
+	0x24,0x18,0x04,0x00,0x09,0x16,0x25,0x2a,0x24,0x14,0x00,0x0c,0x15,0x25,0x2c,0x27,0x17,0x19,0x28,0x2b,0x24,0x12,0x00,0x07,0x07,0x1a,0x25,0x27,0x27,0x27,0x27,0x27,
+	0x27,0x27,0x27,0x27,0x26,0x1c,0x0a,0x00,0x08,0x13,0x24,0x2c,0x27,0x19,0x18,0x27,0x2c,0x24,0x14,0x00,0x0d,0x02,0x0f,0x1b,0x28,0x29,0x1f,0x14,0x25,0x2e,0x2b,0x1d,
+	0x09,0x00,0x07,0x01,0x15,0x23,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x26,0x1d,0x0c,0x00,0x0f,0x11,0x21,0x28,0x28,0x28,0x24,0x16,0x01,0x00,0x03,0x01,0x16,
+	0x24,0x28,0x28,0x28,0x28,0x28,0x25,0x19,0x05,0x00,0x10,0x14,0x25,0x2c,0x27,0x18,0x19,0x28,0x2b,0x24,0x13,0x00,0x0e,0x02,0x16,0x23,0x27,0x27,0x26,0x1c,0x16,0x24,
+	0x27,0x27,0x26,0x1c,0x0a,0x00,0x0d,0x11,0x23,0x2b,0x28,0x1b,0x16,0x26,0x2c,0x26,0x16,0x00,0x09,0x07,0x1a,0x25,0x27,0x27,0x27,0x27,0x26,0x1c,0x0a,0x00,0x0a,0x06,
+	0x1a,0x25,0x27,0x27,0x27,0x27,0x21,0x12,0x00,0x0e,0x0e,0x19,0x27,0x2a,0x21,0x14,0x23,0x2d,0x2c,0x1f,0x0b,0x00,0x0a,0x03,0x17,0x24,0x27,0x27,0x27,0x24,0x18,0x04,
+	0x00,0x03,0x01,0x16,0x24,0x28,0x28,0x29,0x29,0x29,0x29,0x23,0x14,0x00,0x0a,0x01,0x15,0x23,0x27,0x27,0x26,0x1d,0x0c,0x00,0x2a,0x02,0x1d,0x34,0x43,0x42,0x32,0x1b,
+	0x00,0x0f,0x04,0x1f,0x37,0x46,0x45,0x35,0x1d,0x01,0x00,0x01,0x08,0x23,0x3a,0x47,0x48,0x48,0x44,0x33,0x1a,0x00,0x0a,0x0e,0x18,0x19,0x19,0x32,0x44,0x48,0x3b,0x24,
+	0x09,0x00,0x0a,0x0a,0x20,0x2e,0x31,0x28,0x15,0x24,0x30,0x30,0x24,0x10,0x00,0x0b,0x0f,0x2a,0x40,0x4b,0x44,0x2f,0x15,0x00,0x07,0x18,0x30,0x42,0x47,0x47,0x47,0x47,
+	0x45,0x47,0x47,0x43,0x31,0x19,0x00,0x08,0x13,0x2d,0x42,0x4a,0x41,0x2b,0x10,0x00,0x0a,0x13,0x2b,0x41,0x4c,0x44,0x2f,0x32,0x45,0x4b,0x3f,0x29,0x12,0x00,0x06,0x1c,
+	0x34,0x44,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x45,0x37,0x20,0x04,0x00,0x06,0x12,0x2a,0x40,0x4b,0x45,0x31,0x30,0x44,0x4c,0x41,0x2a,0x13,0x00,0x0b,0x06,
+	0x1d,0x2d,0x35,0x46,0x49,0x3a,0x34,0x40,0x4e,0x49,0x36,0x23,0x0e,0x00,0x06,0x15,0x2e,0x41,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x46,0x39,0x22,0x07,0x00,
+	0x0d,0x0d,0x28,0x3d,0x48,0x48,0x48,0x42,0x2f,0x15,0x00,0x03,0x15,0x2f,0x42,0x48,0x48,0x48,0x48,0x48,0x44,0x32,0x19,0x00,0x0f,0x13,0x2b,0x41,0x4c,0x44,0x2f,0x31,
+	0x45,0x4b,0x40,0x29,0x12,0x00,0x0d,0x16,0x2f,0x42,0x47,0x47,0x46,0x38,0x30,0x42,0x47,0x47,0x45,0x37,0x20,0x04,0x00,0x0b,0x10,0x27,0x3e,0x4b,0x46,0x33,0x2d,0x43,
+	0x4c,0x42,0x2d,0x15,0x01,0x00,0x07,0x1c,0x34,0x44,0x47,0x47,0x47,0x47,0x45,0x37,0x1f,0x04,0x00,0x09,0x1b,0x34,0x44,0x47,0x47,0x47,0x47,0x3e,0x2a,0x10,0x00,0x0b,
+	0x03,0x1a,0x2c,0x33,0x45,0x49,0x3c,0x34,0x3e,0x4d,0x4a,0x38,0x25,0x10,0x00,0x09,0x17,0x30,0x42,0x47,0x47,0x47,0x43,0x31,0x18,0x00,0x03,0x15,0x2f,0x42,0x48,0x48,
+	0x49,0x49,0x49,0x49,0x41,0x2c,0x12,0x00,0x09,0x15,0x2e,0x41,0x47,0x47,0x46,0x39,0x22,0x07,0x00,0x29,0x0e,0x2d,0x4a,0x61,0x5f,0x47,0x29,0x0b,0x00,0x0e,0x0e,0x2d,
+	0x4b,0x64,0x62,0x49,0x2b,0x0c,0x00,0x01,0x17,0x33,0x4f,0x66,0x68,0x68,0x60,0x46,0x28,0x09,0x00,0x08,0x14,0x2a,0x38,0x38,0x2c,0x45,0x60,0x67,0x51,0x33,0x14,0x00,
+	0x09,0x0a,0x1e,0x37,0x4c,0x51,0x42,0x2a,0x3d,0x4f,0x4f,0x3d,0x23,0x10,0x00,0x0a,0x1a,0x39,0x57,0x6b,0x5c,0x3f,0x21,0x01,0x00,0x05,0x06,0x25,0x43,0x5e,0x67,0x67,
+	0x67,0x67,0x62,0x67,0x67,0x5f,0x44,0x26,0x07,0x00,0x07,0x1f,0x3e,0x5a,0x6a,0x58,0x3b,0x1c,0x00,0x09,0x12,0x2c,0x3f,0x58,0x6c,0x5c,0x42,0x42,0x5f,0x6b,0x55,0x3e,
+	0x2a,0x10,0x00,0x04,0x0b,0x2a,0x48,0x61,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x64,0x4c,0x2e,0x0f,0x00,0x05,0x11,0x2a,0x3e,0x56,0x6b,0x5e,0x42,0x42,0x5d,
+	0x6b,0x57,0x3f,0x2c,0x12,0x00,0x0a,0x18,0x33,0x49,0x53,0x62,0x67,0x4f,0x54,0x54,0x6d,0x63,0x4f,0x3b,0x21,0x04,0x00,0x04,0x02,0x22,0x40,0x5b,0x67,0x67,0x67,0x67,
+	0x67,0x67,0x67,0x67,0x67,0x65,0x4e,0x31,0x12,0x00,0x0d,0x1d,0x39,0x55,0x68,0x68,0x68,0x5c,0x40,0x22,0x03,0x00,0x01,0x03,0x22,0x40,0x5c,0x68,0x68,0x68,0x68,0x68,
+	0x5f,0x45,0x26,0x07,0x00,0x0d,0x12,0x2c,0x3f,0x57,0x6b,0x5c,0x42,0x42,0x5e,0x6b,0x55,0x3e,0x2a,0x11,0x00,0x0b,0x04,0x23,0x41,0x5c,0x67,0x67,0x64,0x4d,0x42,0x5d,
+	0x67,0x67,0x64,0x4c,0x2e,0x0f,0x00,0x0a,0x0e,0x28,0x3d,0x53,0x6a,0x60,0x44,0x40,0x5a,0x6c,0x5a,0x41,0x2e,0x15,0x00,0x06,0x0b,0x2a,0x48,0x61,0x67,0x67,0x67,0x67,
+	0x63,0x4b,0x2e,0x0f,0x00,0x08,0x0a,0x29,0x47,0x61,0x67,0x67,0x67,0x67,0x57,0x3b,0x1c,0x00,0x0b,0x16,0x30,0x47,0x53,0x5f,0x68,0x52,0x54,0x51,0x6b,0x65,0x52,0x3d,
+	0x24,0x08,0x00,0x07,0x0d,0x28,0x43,0x5d,0x67,0x67,0x67,0x5e,0x44,0x26,0x07,0x00,0x01,0x03,0x22,0x40,0x5c,0x68,0x68,0x69,0x69,0x69,0x69,0x59,0x3d,0x1e,0x00,0x08,
+	0x02,0x22,0x40,0x5b,0x67,0x67,0x65,0x4e,0x31,0x12,0x00,0x29,0x11,0x31,0x51,0x70,0x6d,0x4e,0x2e,0x0e,0x00,0x0c,0x04,0x0f,0x12,0x30,0x50,0x6f,0x6c,0x4e,0x2e,0x12,
+	0x0e,0x26,0x42,0x5e,0x7b,0x88,0x86,0x6a,0x4b,0x2b,0x0b,0x00,0x07,0x08,0x26,0x41,0x56,0x57,0x43,0x48,0x67,0x73,0x56,0x36,0x1a,0x17,0x0b,0x00,0x06,0x02,0x1f,0x38,
+	0x49,0x64,0x6f,0x55,0x42,0x4e,0x6b,0x6a,0x4d,0x3d,0x25,0x0a,0x00,0x09,0x1c,0x3c,0x5c,0x7c,0x9c,0xbc,0xdc,0xfc,0x00,0x04,0x01,0x08,0x28,0x48,0x67,0x78,0x78,0x78,
+	0x84,0x90,0x78,0x78,0x95,0xb5,0xd5,0xf5,0x00,0x06,0x01,0x20,0x40,0x5f,0x75,0x5c,0x3d,0x1d,0x00,0x09,0x1f,0x3e,0x59,0x66,0x73,0x65,0x5d,0x5f,0x64,0x72,0x66,0x57,
+	0x3b,0x1d,0x0e,0x00,0x03,0x0d,0x2d,0x4d,0x6d,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x71,0x51,0x32,0x12,0x00,0x05,0x1d,0x3c,0x57,0x66,0x73,0x64,0x5e,0x5d,
+	0x65,0x73,0x66,0x59,0x3d,0x1f,0x00,0x09,0x10,0x2c,0x46,0x5e,0x73,0x69,0x70,0x66,0x71,0x67,0x6f,0x83,0x97,0xb3,0xd3,0xf2,0xff,0xff,0xff,0x00,0x01,0x05,0x25,0x45,
+	0x65,0x85,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x75,0x55,0x35,0x15,0x00,0x0c,0x10,0x2c,0x48,0x64,0x80,0x88,0x80,0x64,0x44,0x24,0x05,0x00,0x01,0x05,0x25,0x45,
+	0x65,0x85,0x88,0x88,0x88,0x88,0x97,0xb6,0xd6,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x04,0x1f,0x3d,0x59,0x66,0x73,0x65,0x5d,0x5e,0x64,0x72,0x66,
+	0x57,0x3c,0x1d,0x00,0x0b,0x06,0x26,0x46,0x66,0x86,0x87,0x73,0x53,0x47,0x67,0x87,0x87,0x72,0x52,0x32,0x12,0x00,0x0a,0x1a,0x38,0x55,0x66,0x71,0x65,0x61,0x5b,0x65,
+	0x73,0x65,0x5b,0x40,0x22,0x0f,0x0b,0x00,0x04,0x0d,0x2d,0x4d,0x6d,0x87,0x87,0x87,0x87,0x8f,0xae,0xce,0xee,0xff,0xff,0xff,0xff,0xff,0x00,0x03,0x0d,0x2d,0x4d,0x6d,
+	0x87,0x87,0x87,0x87,0xa1,0xc0,0xe0,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x04,0x0c,0x29,0x43,0x5b,0x73,0x66,0x72,0x63,0x73,0x67,0x6d,0x81,0x94,0xb0,0xcf,0xef,0xff,
+	0xff,0xff,0x00,0x03,0x02,0x1d,0x39,0x54,0x6f,0x87,0x87,0x87,0x69,0x49,0x29,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x88,0x89,0x89,0x89,0x89,0xa0,0xbf,0xdf,0xff,
+	0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x87,0x75,0x55,0x35,0x20,0x19,0x09,0x00,0x27,0x0f,0x2e,0x4c,0x65,0x63,0x49,0x2b,0x0c,0x00,0x0b,
+	0x09,0x1f,0x2e,0x32,0x30,0x4d,0x68,0x66,0x4b,0x2f,0x32,0x2d,0x35,0x51,0x6e,0x8a,0x93,0x77,0x5b,0x3e,0x22,0x04,0x00,0x07,0x0e,0x2e,0x4e,0x6d,0x70,0x50,0x45,0x62,
+	0x6c,0x53,0x35,0x3a,0x36,0x25,0x0e,0x00,0x05,0x0c,0x2b,0x4a,0x65,0x68,0x6c,0x6c,0x58,0x6a,0x68,0x67,0x6a,0x51,0x33,0x14,0x00,0x04,0x0a,0x17,0x1a,0x1a,0x17,0x1c,
+	0x3c,0x5c,0x7c,0x9c,0xbc,0xdc,0xfc,0x00,0x02,0x03,0x15,0x20,0x21,0x20,0x3c,0x52,0x58,0x58,0x64,0x84,0x90,0x70,0x75,0x95,0xb5,0xd5,0xf5,0x00,0x07,0x20,0x3f,0x5d,
+	0x6f,0x5a,0x3c,0x1d,0x00,0x08,0x0d,0x25,0x42,0x62,0x78,0x60,0x75,0x67,0x6a,0x72,0x60,0x79,0x5f,0x40,0x38,0x2a,0x14,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0x93,0x93,
+	0x93,0x93,0x93,0x93,0x9d,0x89,0x6a,0x4b,0x2b,0x0c,0x00,0x05,0x20,0x40,0x60,0x79,0x60,0x73,0x69,0x68,0x74,0x60,0x78,0x62,0x42,0x22,0x02,0x00,0x08,0x18,0x37,0x57,
+	0x73,0x6c,0x6c,0x71,0x6a,0x68,0x78,0x5f,0x69,0x67,0x4b,0x2c,0x0d,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x9c,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x75,0x55,0x35,0x15,
+	0x00,0x0b,0x02,0x1f,0x3b,0x57,0x73,0x8f,0x8d,0x71,0x55,0x39,0x1c,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x9b,0x91,0x91,0x91,0x9c,0xb8,0xd7,0xf7,0xff,0xff,0xff,0xff,
+	0xff,0xff,0xff,0xff,0xff,0x00,0x03,0x02,0x22,0x42,0x62,0x78,0x60,0x74,0x68,0x69,0x73,0x60,0x79,0x60,0x40,0x20,0x00,0x09,0x04,0x07,0x07,0x26,0x46,0x66,0x86,0x93,
+	0x73,0x53,0x47,0x67,0x87,0x92,0x72,0x52,0x32,0x12,0x07,0x07,0x00,0x08,0x1d,0x3d,0x5d,0x78,0x61,0x70,0x6d,0x64,0x77,0x61,0x76,0x65,0x45,0x2f,0x2f,0x29,0x19,0x03,
+	0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0x93,0x93,0x93,0x97,0xb1,0xd0,0xef,0xf6,0xf6,0xff,0xff,0xff,0x00,0x03,0x0d,0x2d,0x4d,0x6d,0x8d,0x92,0x92,0x92,0xa5,0xc2,0xe1,
+	0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x04,0x14,0x34,0x53,0x70,0x6c,0x69,0x74,0x6a,0x6a,0x77,0x63,0x67,0x69,0x4e,0x2f,0x29,0x19,0x03,0x00,0x04,0x13,0x2e,0x49,0x65,
+	0x80,0x9b,0xa4,0x89,0x69,0x49,0x29,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x9b,0x91,0x91,0x91,0x91,0xa3,0xc1,0xe0,0xf7,0xf3,0xf8,0xff,0xff,0xff,0xff,0x00,0x01,
+	0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x41,0x40,0x36,0x21,0x07,0x00,0x26,0x11,0x31,0x50,0x6e,0x6b,0x4d,0x2d,0x0d,0x00,0x0b,0x1b,0x36,0x4b,0x52,0x4e,0x50,0x6c,
+	0x6a,0x51,0x4d,0x52,0x4a,0x44,0x61,0x7d,0x99,0x84,0x68,0x4b,0x2f,0x13,0x00,0x08,0x0f,0x2a,0x48,0x60,0x61,0x70,0x57,0x64,0x6f,0x54,0x4b,0x5a,0x52,0x3a,0x21,0x18,
+	0x07,0x00,0x03,0x0d,0x2c,0x4c,0x69,0x6d,0x65,0x73,0x5b,0x6f,0x66,0x66,0x6f,0x54,0x34,0x15,0x00,0x03,0x0d,0x25,0x35,0x3a,0x3a,0x36,0x3a,0x3a,0x58,0x6e,0x5e,0x40,
+	0x21,0x01,0x00,0x02,0x19,0x30,0x3f,0x40,0x33,0x25,0x34,0x38,0x44,0x64,0x84,0x90,0x70,0x75,0x95,0xb5,0xd5,0xf5,0x00,0x03,0x12,0x1c,0x1d,0x1d,0x20,0x3f,0x5d,0x6f,
+	0x5a,0x3c,0x1d,0x1d,0x1d,0x1c,0x10,0x00,0x04,0x1d,0x3a,0x52,0x5a,0x5d,0x7d,0x62,0x52,0x54,0x65,0x7a,0x5a,0x5a,0x5a,0x56,0x41,0x25,0x07,0x00,0x01,0x0d,0x2c,0x4c,
+	0x69,0x73,0x73,0x73,0x73,0x73,0x73,0x78,0x98,0x83,0x63,0x44,0x25,0x05,0x00,0x05,0x19,0x36,0x4e,0x5b,0x7b,0x64,0x53,0x5b,0x63,0x7c,0x5c,0x4f,0x37,0x1b,0x00,0x09,
+	0x16,0x35,0x53,0x6a,0x7e,0x8e,0x9d,0x8a,0xa1,0x8d,0x97,0xb2,0xb3,0xc5,0xdf,0xfb,0xff,0xff,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x72,0x72,0x72,0x72,
+	0x72,0x72,0x6e,0x53,0x33,0x14,0x00,0x0b,0x12,0x2e,0x4a,0x66,0x82,0x9a,0x7e,0x62,0x46,0x2a,0x0d,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x71,0x71,0x65,0x48,
+	0x28,0x09,0x00,0x0d,0x1b,0x37,0x4f,0x5d,0x7d,0x62,0x53,0x58,0x65,0x7a,0x5a,0x4e,0x36,0x19,0x00,0x07,0x01,0x16,0x23,0x27,0x27,0x27,0x46,0x66,0x86,0x93,0x73,0x53,
+	0x47,0x67,0x87,0x92,0x72,0x52,0x32,0x27,0x27,0x26,0x1c,0x0a,0x00,0x06,0x16,0x33,0x4c,0x59,0x78,0x67,0x55,0x57,0x60,0x7e,0x5f,0x51,0x4f,0x4f,0x4f,0x46,0x30,0x15,
+	0x00,0x02,0x0d,0x2c,0x4c,0x69,0x73,0x73,0x73,0x73,0x6d,0x50,0x31,0x29,0x29,0x28,0x1d,0x09,0x00,0x04,0x0c,0x2c,0x4b,0x69,0x72,0x72,0x72,0x72,0x5d,0x3e,0x1e,0x1a,
+	0x1b,0x19,0x0e,0x00,0x06,0x12,0x32,0x50,0x68,0x7c,0x8b,0x9c,0x8b,0x9d,0x8f,0x94,0xb3,0xb0,0xb0,0xb0,0xb9,0xcf,0xea,0xff,0x00,0x02,0x08,0x23,0x3f,0x5a,0x75,0x91,
+	0x8d,0x90,0x89,0x69,0x49,0x29,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x71,0x71,0x71,0x5d,0x3f,0x2c,0x27,0x2c,0x25,0x15,0x00,0x04,0x05,0x25,0x45,0x65,
+	0x85,0x95,0x75,0x61,0x61,0x60,0x4e,0x32,0x14,0x00,0x26,0x09,0x27,0x41,0x53,0x52,0x3e,0x24,0x06,0x00,0x0a,0x05,0x25,0x44,0x62,0x71,0x68,0x6d,0x51,0x54,0x6f,0x65,
+	0x72,0x60,0x54,0x70,0x8c,0x91,0x75,0x58,0x3c,0x20,0x04,0x00,0x07,0x0c,0x26,0x3c,0x46,0x43,0x60,0x6d,0x56,0x4c,0x50,0x42,0x5a,0x78,0x64,0x45,0x40,0x34,0x1e,0x04,
+	0x00,0x02,0x05,0x22,0x3c,0x4f,0x67,0x75,0x5a,0x5a,0x5a,0x6e,0x6e,0x52,0x42,0x29,0x0c,0x00,0x03,0x1d,0x3a,0x52,0x5a,0x5a,0x53,0x5a,0x5a,0x5a,0x5a,0x50,0x38,0x1b,
+	0x00,0x02,0x0a,0x28,0x45,0x5d,0x5f,0x49,0x2c,0x15,0x24,0x44,0x64,0x84,0x90,0x70,0x75,0x95,0xb5,0xd5,0xf5,0x00,0x02,0x16,0x2d,0x3c,0x3d,0x3d,0x3b,0x31,0x47,0x4f,
+	0x45,0x2e,0x3c,0x3c,0x3d,0x3b,0x2b,0x14,0x00,0x02,0x05,0x25,0x45,0x64,0x7a,0x7a,0x74,0x55,0x3a,0x3d,0x55,0x5e,0x6b,0x7a,0x7a,0x6c,0x4d,0x2d,0x0d,0x00,0x01,0x05,
+	0x22,0x3c,0x4f,0x53,0x53,0x53,0x53,0x53,0x60,0x7f,0x9b,0x7c,0x5c,0x3d,0x1e,0x00,0x06,0x09,0x21,0x33,0x4e,0x5e,0x54,0x55,0x75,0x69,0x5e,0x4f,0x34,0x22,0x0b,0x00,
+	0x09,0x0b,0x26,0x3d,0x51,0x65,0x62,0x55,0x75,0x69,0x66,0x5f,0x45,0x2d,0x21,0x0d,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x52,0x52,0x52,0x52,0x52,0x51,
+	0x41,0x28,0x0b,0x00,0x0a,0x05,0x21,0x3d,0x59,0x75,0x92,0x8b,0x6f,0x53,0x37,0x1a,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x51,0x4c,0x38,0x1e,0x01,0x00,
+	0x0d,0x0b,0x22,0x35,0x50,0x5e,0x53,0x56,0x74,0x68,0x5e,0x4e,0x33,0x21,0x09,0x00,0x07,0x15,0x2e,0x41,0x47,0x47,0x47,0x47,0x66,0x86,0x93,0x73,0x53,0x47,0x67,0x87,
+	0x92,0x72,0x52,0x47,0x47,0x47,0x46,0x37,0x20,0x04,0x00,0x05,0x06,0x1f,0x31,0x4c,0x5e,0x57,0x56,0x74,0x68,0x5e,0x51,0x56,0x6e,0x6f,0x6f,0x5c,0x3e,0x1f,0x00,0x02,
+	0x05,0x22,0x3c,0x4f,0x53,0x53,0x53,0x53,0x51,0x40,0x46,0x49,0x48,0x47,0x36,0x1e,0x02,0x00,0x03,0x04,0x21,0x3c,0x4e,0x52,0x52,0x52,0x52,0x48,0x31,0x39,0x3a,0x3b,
+	0x38,0x29,0x13,0x00,0x05,0x08,0x23,0x3b,0x4f,0x63,0x64,0x56,0x74,0x68,0x64,0x61,0x56,0x6e,0x6f,0x6f,0x5c,0x3e,0x1f,0x00,0x03,0x19,0x34,0x4f,0x6b,0x86,0x98,0x7d,
+	0x90,0x89,0x69,0x49,0x29,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x51,0x51,0x48,0x41,0x4c,0x44,0x4c,0x42,0x2c,0x11,0x00,0x03,0x05,0x25,0x45,0x65,
+	0x85,0x95,0x81,0x81,0x81,0x86,0xa6,0xc6,0xe6,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x21,0x14,0x28,0x34,0x33,0x26,0x11,0x00,0x0b,0x04,0x24,0x43,0x60,0x6c,0x64,0x69,
+	0x55,0x54,0x6b,0x62,0x6d,0x5e,0x63,0x7f,0x9b,0x82,0x65,0x49,0x2d,0x11,0x00,0x08,0x18,0x36,0x53,0x66,0x5b,0x67,0x57,0x41,0x2e,0x31,0x35,0x51,0x64,0x62,0x61,0x5f,
+	0x4b,0x2e,0x10,0x00,0x03,0x0f,0x24,0x3b,0x52,0x59,0x77,0x7a,0x7a,0x61,0x55,0x41,0x28,0x15,0x00,0x03,0x05,0x25,0x45,0x64,0x7a,0x7a,0x66,0x7a,0x7a,0x7a,0x7a,0x62,
+	0x42,0x23,0x03,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x71,0x52,0x32,0x12,0x24,0x44,0x64,0x84,0x90,0x70,0x75,0x95,0xb5,0xd5,0xf5,0x00,0x01,0x09,0x27,0x43,0x59,0x5b,0x5c,
+	0x59,0x42,0x2a,0x2f,0x29,0x44,0x5a,0x5b,0x5c,0x58,0x41,0x24,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x28,0x39,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,
+	0x2d,0x0d,0x00,0x02,0x0f,0x24,0x31,0x33,0x33,0x33,0x33,0x47,0x67,0x86,0x94,0x75,0x56,0x36,0x17,0x00,0x07,0x08,0x21,0x35,0x3e,0x39,0x4d,0x61,0x5b,0x42,0x35,0x22,
+	0x09,0x00,0x0b,0x10,0x24,0x38,0x47,0x46,0x4d,0x61,0x5b,0x47,0x44,0x32,0x19,0x04,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x32,0x32,0x32,0x32,0x31,
+	0x27,0x14,0x00,0x0b,0x14,0x30,0x4c,0x68,0x84,0x98,0x7c,0x60,0x44,0x27,0x0b,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x2e,0x20,0x0b,0x05,0x05,0x05,
+	0x05,0x03,0x00,0x0a,0x09,0x22,0x36,0x3e,0x38,0x4f,0x64,0x5d,0x43,0x34,0x20,0x07,0x00,0x07,0x02,0x22,0x40,0x5c,0x67,0x67,0x67,0x67,0x67,0x86,0x93,0x73,0x67,0x67,
+	0x67,0x87,0x92,0x72,0x67,0x67,0x67,0x67,0x64,0x4c,0x2e,0x0f,0x00,0x06,0x05,0x1f,0x33,0x3e,0x3a,0x4f,0x65,0x5e,0x43,0x39,0x59,0x79,0x8f,0x81,0x61,0x41,0x21,0x01,
+	0x00,0x02,0x0f,0x24,0x31,0x33,0x33,0x33,0x33,0x32,0x47,0x62,0x67,0x66,0x64,0x49,0x2b,0x0c,0x00,0x04,0x0e,0x23,0x30,0x32,0x32,0x32,0x32,0x2c,0x43,0x58,0x58,0x5a,
+	0x56,0x40,0x23,0x05,0x00,0x05,0x0e,0x22,0x36,0x46,0x47,0x4f,0x65,0x5e,0x46,0x45,0x59,0x79,0x8f,0x81,0x61,0x41,0x21,0x01,0x00,0x01,0x09,0x28,0x45,0x60,0x7b,0x97,
+	0x87,0x70,0x90,0x89,0x69,0x49,0x29,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x31,0x39,0x57,0x6b,0x5d,0x6c,0x58,0x3b,0x1c,0x00,0x03,0x05,0x25,
+	0x45,0x65,0x85,0xa1,0x99,0x99,0x99,0x9a,0xae,0xcb,0xe9,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x1a,0x06,0x07,0x07,0x06,0x00,0x04,0x0c,0x15,0x14,0x0a,0x00,0x04,0x06,
+	0x06,0x07,0x06,0x00,0x05,0x18,0x33,0x47,0x4d,0x49,0x50,0x6f,0x6c,0x4e,0x48,0x4d,0x56,0x72,0x8e,0x8f,0x73,0x56,0x3a,0x1e,0x02,0x00,0x08,0x1a,0x3a,0x5a,0x77,0x64,
+	0x78,0x5f,0x3f,0x26,0x25,0x26,0x46,0x66,0x7e,0x7e,0x74,0x54,0x34,0x14,0x00,0x04,0x0f,0x25,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x2a,0x14,0x00,0x04,0x05,0x25,0x45,
+	0x65,0x85,0x9a,0xa4,0x9a,0x9a,0x9a,0x83,0x63,0x43,0x23,0x03,0x00,0x01,0x08,0x26,0x43,0x59,0x5a,0x46,0x2a,0x19,0x24,0x44,0x64,0x84,0x90,0x70,0x75,0x95,0xb5,0xd5,
+	0xf5,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x72,0x73,0x6c,0x4c,0x2c,0x0f,0x2f,0x4f,0x6f,0x70,0x75,0x6a,0x4a,0x2a,0x0a,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,
+	0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x08,0x11,0x13,0x13,0x13,0x2f,0x4e,0x6d,0x8d,0x8d,0x6e,0x4f,0x30,0x10,0x00,0x08,0x09,0x18,0x1e,
+	0x35,0x55,0x75,0x69,0x49,0x29,0x09,0x00,0x0d,0x0b,0x1d,0x28,0x35,0x55,0x75,0x69,0x49,0x29,0x19,0x05,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x47,0x41,
+	0x2f,0x16,0x12,0x12,0x0a,0x00,0x0b,0x07,0x23,0x3f,0x5b,0x77,0x94,0x89,0x6d,0x51,0x35,0x18,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x25,0x25,0x25,
+	0x25,0x25,0x25,0x25,0x23,0x17,0x09,0x00,0x09,0x0a,0x18,0x1e,0x36,0x56,0x76,0x69,0x49,0x29,0x09,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x87,0x87,0x87,0x87,0x8a,0x94,
+	0x87,0x87,0x87,0x87,0x8a,0x94,0x87,0x87,0x87,0x87,0x87,0x72,0x52,0x32,0x12,0x00,0x07,0x07,0x17,0x1e,0x36,0x56,0x76,0x69,0x49,0x39,0x59,0x79,0x99,0x81,0x61,0x41,
+	0x21,0x01,0x00,0x03,0x08,0x11,0x13,0x21,0x28,0x28,0x2b,0x4a,0x69,0x70,0x6e,0x6b,0x4d,0x2d,0x0d,0x00,0x05,0x07,0x10,0x12,0x12,0x12,0x12,0x2f,0x4f,0x6f,0x6f,0x73,
+	0x6a,0x4b,0x2b,0x0b,0x00,0x06,0x09,0x1c,0x27,0x36,0x56,0x76,0x69,0x49,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x7e,0x7e,0x77,
+	0x70,0x90,0x89,0x69,0x49,0x29,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x29,0x3b,0x5a,0x73,0x60,0x73,0x5b,0x3c,0x1d,0x00,0x03,0x05,0x25,0x45,
+	0x65,0x85,0x95,0x79,0x79,0x79,0x76,0x58,0x39,0x19,0x0a,0x0a,0x0a,0x01,0x00,0x1a,0x07,0x1a,0x26,0x26,0x27,0x25,0x19,0x06,0x00,0x08,0x08,0x1b,0x26,0x26,0x27,0x25,
+	0x19,0x05,0x00,0x03,0x06,0x1b,0x29,0x2d,0x2d,0x4b,0x64,0x62,0x49,0x2c,0x49,0x65,0x81,0x9c,0x80,0x63,0x47,0x2b,0x0f,0x00,0x09,0x13,0x30,0x4a,0x58,0x50,0x58,0x4d,
+	0x37,0x45,0x44,0x34,0x3c,0x55,0x5e,0x5e,0x5c,0x48,0x2d,0x0f,0x00,0x05,0x19,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,0x04,0x05,0x25,0x45,0x65,0x7f,0x7f,
+	0x98,0x81,0x7f,0x7f,0x7f,0x63,0x43,0x23,0x03,0x00,0x02,0x16,0x2c,0x3b,0x3c,0x2f,0x28,0x38,0x3c,0x44,0x64,0x84,0x90,0x70,0x75,0x95,0xb5,0xd5,0xf5,0x00,0x01,0x09,
+	0x28,0x45,0x5c,0x5e,0x5f,0x5b,0x43,0x26,0x2c,0x29,0x46,0x5d,0x5d,0x5f,0x5a,0x42,0x25,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,
+	0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x07,0x16,0x36,0x55,0x74,0x93,0x87,0x67,0x48,0x29,0x0a,0x00,0x06,0x02,0x02,0x03,0x02,0x10,0x2e,0x49,0x5b,0x56,0x3f,0x23,
+	0x04,0x03,0x01,0x03,0x00,0x08,0x02,0x02,0x03,0x02,0x10,0x2e,0x49,0x5b,0x56,0x3f,0x23,0x04,0x03,0x01,0x03,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x67,0x67,
+	0x5c,0x41,0x23,0x04,0x00,0x0d,0x16,0x32,0x4e,0x6a,0x87,0x96,0x7a,0x5e,0x42,0x25,0x09,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x45,0x45,0x45,0x45,0x45,
+	0x45,0x45,0x45,0x41,0x30,0x28,0x1a,0x05,0x00,0x05,0x01,0x12,0x1c,0x1d,0x1d,0x30,0x4b,0x5e,0x58,0x40,0x23,0x1d,0x1d,0x18,0x0b,0x00,0x05,0x05,0x25,0x45,0x65,0x85,
+	0x92,0x92,0x92,0x92,0x93,0x9a,0x92,0x92,0x92,0x92,0x93,0x99,0x92,0x92,0x92,0x92,0x92,0x72,0x52,0x32,0x12,0x00,0x06,0x01,0x01,0x00,0x01,0x12,0x30,0x4c,0x5f,0x59,
+	0x41,0x39,0x58,0x74,0x64,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x04,0x0e,0x29,0x3e,0x48,0x48,0x46,0x3c,0x50,0x53,0x53,0x52,0x3e,0x23,0x06,0x00,0x07,0x03,0x18,0x26,0x29,
+	0x2a,0x48,0x5f,0x60,0x61,0x5d,0x44,0x26,0x08,0x00,0x05,0x01,0x01,0x00,0x01,0x12,0x30,0x4c,0x5f,0x59,0x41,0x39,0x58,0x74,0x64,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x01,
+	0x09,0x27,0x43,0x5a,0x5e,0x5e,0x5d,0x70,0x90,0x89,0x69,0x49,0x29,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x49,0x49,0x41,0x47,0x53,0x4b,0x53,0x48,
+	0x30,0x14,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x59,0x59,0x59,0x49,0x2f,0x28,0x2a,0x29,0x29,0x1e,0x0b,0x00,0x19,0x1c,0x34,0x45,0x46,0x46,0x44,0x33,0x1b,
+	0x00,0x07,0x02,0x1d,0x35,0x45,0x45,0x46,0x44,0x33,0x1a,0x00,0x05,0x0a,0x11,0x31,0x51,0x71,0x6e,0x4e,0x3c,0x58,0x74,0x90,0x8d,0x70,0x54,0x38,0x1c,0x12,0x04,0x00,
+	0x08,0x04,0x1d,0x2f,0x38,0x33,0x38,0x31,0x4b,0x63,0x61,0x48,0x2a,0x3c,0x41,0x3e,0x3d,0x31,0x1b,0x02,0x00,0x05,0x19,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,
+	0x00,0x04,0x01,0x1f,0x3c,0x55,0x5f,0x78,0x98,0x81,0x61,0x5f,0x5f,0x54,0x3a,0x1d,0x00,0x04,0x11,0x1b,0x1c,0x21,0x3e,0x55,0x5c,0x5c,0x64,0x84,0x90,0x70,0x75,0x95,
+	0xb5,0xd5,0xf5,0x00,0x02,0x18,0x2f,0x3e,0x3f,0x40,0x3e,0x2e,0x43,0x4c,0x42,0x30,0x45,0x62,0x76,0x5b,0x3b,0x1c,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,
+	0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x07,0x1d,0x3c,0x5c,0x7b,0x9a,0x80,0x61,0x41,0x22,0x03,0x00,0x04,0x04,0x16,0x21,0x22,0x22,0x21,0x16,
+	0x1c,0x30,0x3c,0x39,0x29,0x12,0x1b,0x23,0x20,0x23,0x1f,0x11,0x00,0x04,0x04,0x16,0x21,0x22,0x22,0x21,0x16,0x1c,0x30,0x3c,0x39,0x29,0x12,0x1b,0x23,0x20,0x23,0x1f,
+	0x11,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x96,0x87,0x87,0x87,0x9a,0xb9,0xd9,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x06,0x09,0x25,0x41,0x5d,0x7a,0x96,0x87,0x6b,
+	0x4f,0x32,0x16,0x00,0x05,0x0a,0x29,0x47,0x65,0x85,0x95,0x75,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x5e,0x4b,0x46,0x32,0x18,0x00,0x03,0x03,0x16,0x21,0x2e,
+	0x3b,0x3d,0x3d,0x3d,0x3d,0x3f,0x3d,0x3d,0x3d,0x3d,0x3d,0x37,0x25,0x1d,0x0f,0x00,0x03,0x04,0x24,0x43,0x61,0x72,0x72,0x72,0x72,0x72,0x86,0x93,0x73,0x72,0x72,0x72,
+	0x87,0x92,0x72,0x72,0x72,0x72,0x72,0x6c,0x50,0x30,0x11,0x00,0x03,0x03,0x15,0x20,0x20,0x21,0x1f,0x14,0x1f,0x34,0x40,0x3d,0x2c,0x2e,0x47,0x55,0x5e,0x7e,0x9e,0xbe,
+	0xde,0xfe,0x00,0x04,0x1a,0x39,0x56,0x68,0x68,0x64,0x4c,0x49,0x48,0x36,0x33,0x26,0x11,0x00,0x08,0x17,0x31,0x44,0x49,0x3d,0x32,0x44,0x48,0x42,0x40,0x30,0x18,0x00,
+	0x03,0x03,0x15,0x20,0x20,0x21,0x1f,0x14,0x1f,0x34,0x40,0x3d,0x2c,0x2e,0x47,0x55,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x02,0x17,0x2d,0x3c,0x3e,0x3e,0x50,0x70,0x90,
+	0x89,0x69,0x49,0x29,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x69,0x69,0x69,0x59,0x45,0x53,0x4c,0x36,0x2c,0x1b,0x03,0x00,0x03,0x05,0x25,0x45,0x65,0x85,
+	0x95,0x75,0x55,0x39,0x39,0x2f,0x35,0x47,0x4a,0x48,0x48,0x38,0x20,0x04,0x00,0x17,0x0b,0x2a,0x48,0x61,0x64,0x65,0x60,0x46,0x28,0x09,0x00,0x06,0x0d,0x2c,0x49,0x62,
+	0x63,0x65,0x60,0x46,0x27,0x08,0x00,0x05,0x0d,0x2b,0x48,0x5e,0x5d,0x46,0x4b,0x67,0x83,0x9a,0x7d,0x61,0x45,0x32,0x38,0x30,0x1d,0x05,0x00,0x08,0x04,0x12,0x18,0x15,
+	0x18,0x31,0x51,0x70,0x6c,0x4d,0x3e,0x57,0x61,0x50,0x34,0x16,0x04,0x00,0x06,0x19,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,0x05,0x10,0x28,0x3a,0x58,0x78,
+	0x98,0x81,0x61,0x41,0x3f,0x39,0x27,0x0e,0x00,0x06,0x08,0x28,0x48,0x68,0x7c,0x7c,0x64,0x84,0x90,0x70,0x75,0x95,0xb5,0xd5,0xf5,0x00,0x02,0x02,0x15,0x1f,0x20,0x20,
+	0x1f,0x3e,0x5b,0x6c,0x59,0x3b,0x51,0x6f,0x8c,0xaa,0xc7,0xe6,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,
+	0x2d,0x0d,0x00,0x06,0x05,0x24,0x43,0x62,0x82,0x98,0x79,0x5a,0x3b,0x1b,0x00,0x05,0x1a,0x31,0x40,0x42,0x42,0x40,0x30,0x18,0x14,0x1c,0x1a,0x0f,0x21,0x37,0x42,0x3f,
+	0x43,0x3d,0x2a,0x11,0x00,0x03,0x1a,0x31,0x40,0x42,0x42,0x40,0x30,0x18,0x14,0x1c,0x1a,0x0f,0x21,0x37,0x42,0x3f,0x43,0x3d,0x2a,0x11,0x00,0x02,0x05,0x25,0x45,0x65,
+	0x85,0x92,0x92,0x92,0x92,0x9f,0xbc,0xdb,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x06,0x18,0x34,0x50,0x6d,0x89,0x94,0x78,0x5c,0x3f,0x23,0x07,0x00,0x05,0x0d,0x2d,
+	0x4d,0x6d,0x87,0x96,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x96,0x94,0xa0,0xbd,0xdb,0xfb,0x00,0x02,0x19,0x30,0x40,0x45,0x59,0x5d,0x5d,0x5d,0x5d,0x5d,
+	0x5d,0x5d,0x5d,0x5d,0x5d,0x52,0x42,0x3b,0x27,0x0e,0x00,0x03,0x1a,0x35,0x4a,0x52,0x52,0x52,0x52,0x66,0x86,0x93,0x73,0x53,0x52,0x67,0x87,0x92,0x72,0x52,0x52,0x52,
+	0x52,0x50,0x3f,0x25,0x08,0x00,0x03,0x19,0x30,0x3f,0x40,0x40,0x3e,0x2f,0x17,0x18,0x20,0x1e,0x12,0x22,0x37,0x41,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x04,0x1d,0x3d,
+	0x5d,0x7d,0x88,0x90,0xae,0x98,0x9b,0xb6,0xd5,0xf4,0xff,0xff,0x00,0x06,0x04,0x24,0x42,0x5e,0x68,0x52,0x44,0x5f,0x67,0x51,0x33,0x16,0x02,0x00,0x03,0x19,0x30,0x3f,
+	0x40,0x40,0x3e,0x2f,0x17,0x18,0x20,0x1e,0x12,0x22,0x37,0x41,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x03,0x12,0x1d,0x1e,0x30,0x50,0x70,0x90,0x89,0x69,0x49,0x29,0x09,
+	0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x96,0x89,0x89,0x89,0x89,0xa0,0xa7,0x8d,0x9c,0xbb,0xdb,0xfa,0xff,0xff,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,
+	0x35,0x19,0x28,0x46,0x62,0x68,0x65,0x65,0x4b,0x2d,0x0e,0x00,0x17,0x0d,0x2d,0x4d,0x6c,0x70,0x71,0x6a,0x4b,0x2b,0x0b,0x00,0x06,0x0f,0x2f,0x4e,0x6d,0x6e,0x72,0x69,
+	0x4a,0x2a,0x0b,0x00,0x05,0x01,0x1c,0x32,0x40,0x3f,0x3e,0x5a,0x76,0x92,0x8a,0x6e,0x52,0x36,0x4e,0x58,0x4b,0x32,0x15,0x00,0x08,0x03,0x0c,0x0d,0x0d,0x15,0x34,0x52,
+	0x6a,0x61,0x45,0x45,0x65,0x7a,0x5a,0x3a,0x1a,0x00,0x07,0x19,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,0x06,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,
+	0x1b,0x0d,0x00,0x07,0x05,0x24,0x41,0x5b,0x63,0x7e,0x9b,0x7b,0x70,0x90,0x8a,0x6a,0x4a,0x2a,0x0a,0x00,0x07,0x20,0x40,0x5f,0x73,0x5c,0x58,0x5e,0x7b,0x99,0xb6,0xd4,
+	0xf1,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x06,0x0b,0x2b,0x4a,0x69,0x88,0x92,0x72,
+	0x53,0x34,0x15,0x00,0x04,0x0a,0x29,0x46,0x5e,0x60,0x61,0x5d,0x44,0x27,0x08,0x00,0x02,0x13,0x31,0x4e,0x62,0x5b,0x63,0x57,0x3d,0x1f,0x00,0x02,0x0a,0x29,0x46,0x5e,
+	0x60,0x61,0x5d,0x44,0x27,0x08,0x00,0x02,0x13,0x31,0x4e,0x62,0x5b,0x63,0x57,0x3d,0x1f,0x00,0x02,0x04,0x24,0x43,0x62,0x72,0x72,0x72,0x72,0x72,0x63,0x45,0x25,0x1b,
+	0x19,0x1a,0x11,0x00,0x08,0x0b,0x27,0x43,0x5f,0x7c,0x98,0x85,0x69,0x4c,0x30,0x14,0x00,0x06,0x0d,0x2d,0x4d,0x6d,0x8d,0x99,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,
+	0x8d,0x8d,0x99,0x8d,0x9c,0xbb,0xda,0xfa,0x00,0x01,0x0a,0x28,0x45,0x5d,0x5f,0x70,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x62,0x62,0x54,0x39,0x1b,0x00,
+	0x03,0x15,0x2f,0x42,0x48,0x48,0x48,0x48,0x66,0x86,0x93,0x73,0x53,0x48,0x67,0x87,0x92,0x72,0x52,0x48,0x48,0x48,0x47,0x38,0x20,0x05,0x00,0x02,0x09,0x28,0x45,0x5c,
+	0x5e,0x5f,0x5b,0x44,0x26,0x08,0x00,0x02,0x16,0x34,0x50,0x61,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x04,0x1d,0x3d,0x5d,0x7d,0x91,0x96,0xae,0x91,0x95,0xb3,0xd3,0xf3,
+	0xff,0xff,0x00,0x06,0x06,0x26,0x46,0x65,0x74,0x57,0x48,0x67,0x73,0x56,0x36,0x16,0x00,0x03,0x09,0x28,0x45,0x5c,0x5e,0x5f,0x5b,0x44,0x26,0x08,0x00,0x02,0x16,0x34,
+	0x50,0x61,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x05,0x10,0x30,0x50,0x70,0x90,0x89,0x69,0x49,0x29,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x9a,0x90,0x90,0x90,0x90,
+	0x93,0xaa,0x94,0xa0,0xbd,0xdc,0xfb,0xff,0xff,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2a,0x49,0x68,0x70,0x6c,0x6c,0x4e,0x2f,0x0f,0x00,
+	0x17,0x07,0x24,0x3f,0x54,0x55,0x56,0x53,0x3e,0x23,0x05,0x00,0x06,0x08,0x26,0x41,0x54,0x55,0x56,0x53,0x3d,0x22,0x04,0x00,0x06,0x05,0x17,0x21,0x31,0x4d,0x69,0x85,
+	0x98,0x7b,0x5f,0x43,0x42,0x61,0x77,0x5c,0x3c,0x1c,0x02,0x00,0x06,0x0b,0x1f,0x2b,0x2d,0x2d,0x2b,0x36,0x55,0x70,0x65,0x47,0x3c,0x54,0x5d,0x4d,0x32,0x22,0x10,0x00,
+	0x06,0x19,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,0x06,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x09,0x15,0x2e,0x3f,0x5e,0x7e,0x9b,0x7b,
+	0x70,0x90,0x8a,0x6a,0x4a,0x2a,0x0a,0x00,0x07,0x20,0x3f,0x5e,0x71,0x6b,0x73,0x6b,0x88,0xa5,0xc3,0xe0,0xfe,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,
+	0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x06,0x12,0x31,0x51,0x70,0x8f,0x8b,0x6c,0x4c,0x2d,0x0e,0x00,0x04,0x0d,0x2d,0x4d,0x6d,0x71,0x73,0x6b,
+	0x4c,0x2c,0x0c,0x00,0x02,0x17,0x37,0x57,0x76,0x68,0x7a,0x63,0x43,0x23,0x03,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x71,0x73,0x6b,0x4c,0x2c,0x0c,0x00,0x02,0x17,0x37,0x57,
+	0x76,0x68,0x7a,0x63,0x43,0x23,0x03,0x00,0x02,0x1a,0x36,0x4b,0x52,0x52,0x52,0x52,0x52,0x4c,0x37,0x37,0x3b,0x39,0x3a,0x2d,0x18,0x00,0x07,0x1a,0x36,0x52,0x6f,0x8b,
+	0x92,0x76,0x59,0x3d,0x21,0x05,0x00,0x06,0x0c,0x2b,0x4a,0x66,0x85,0x95,0x75,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x63,0x53,0x4c,0x37,0x1b,0x00,0x02,0x0d,
+	0x2d,0x4d,0x6d,0x71,0x61,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x7d,0x60,0x40,0x20,0x00,0x02,0x03,0x22,0x40,0x5c,0x68,0x68,0x68,0x68,0x68,0x86,
+	0x93,0x73,0x68,0x68,0x68,0x87,0x92,0x72,0x68,0x68,0x68,0x68,0x64,0x4c,0x2e,0x0f,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x72,0x73,0x6c,0x4c,0x2c,0x0c,0x00,0x02,0x1a,0x3a,
+	0x5a,0x7a,0x65,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x04,0x1c,0x3c,0x5a,0x71,0x71,0x6c,0x4f,0x52,0x50,0x3d,0x2a,0x1e,0x0a,0x00,0x05,0x08,0x13,0x16,0x1d,0x39,0x56,0x6f,
+	0x62,0x44,0x51,0x56,0x46,0x2c,0x0f,0x00,0x03,0x0d,0x2d,0x4d,0x6d,0x72,0x73,0x6c,0x4c,0x2c,0x0c,0x00,0x02,0x1a,0x3a,0x5a,0x7a,0x65,0x7e,0x9e,0xbe,0xde,0xfe,0x00,
+	0x05,0x10,0x30,0x50,0x70,0x90,0x89,0x69,0x49,0x29,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x70,0x70,0x70,0x6d,0x52,0x4b,0x45,0x32,0x2b,0x20,0x0d,0x00,
+	0x03,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x2f,0x26,0x3b,0x4f,0x53,0x51,0x51,0x3f,0x25,0x07,0x00,0x18,0x12,0x28,0x35,0x36,0x37,0x35,0x27,0x11,0x00,0x08,
+	0x14,0x29,0x36,0x36,0x37,0x35,0x26,0x10,0x00,0x08,0x07,0x24,0x40,0x5c,0x78,0x94,0x88,0x6c,0x50,0x34,0x3e,0x5a,0x67,0x55,0x39,0x21,0x22,0x18,0x07,0x00,0x03,0x03,
+	0x1f,0x39,0x4a,0x4d,0x4d,0x4a,0x38,0x43,0x52,0x4d,0x39,0x30,0x44,0x4c,0x47,0x4b,0x3e,0x26,0x0b,0x00,0x05,0x19,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,
+	0x06,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x0a,0x1e,0x3e,0x5e,0x7e,0x9b,0x7b,0x70,0x90,0x8a,0x6a,0x4a,0x2a,0x0a,0x00,0x07,0x1f,0x3f,0x5c,0x6e,
+	0x77,0x95,0x88,0x6a,0x4d,0x30,0x12,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x06,0x19,0x38,
+	0x57,0x77,0x96,0x84,0x65,0x46,0x26,0x07,0x00,0x04,0x08,0x26,0x42,0x58,0x59,0x5a,0x57,0x41,0x24,0x06,0x04,0x02,0x11,0x2e,0x49,0x5b,0x55,0x5c,0x52,0x39,0x1c,0x00,
+	0x02,0x08,0x26,0x42,0x58,0x59,0x5a,0x57,0x41,0x24,0x06,0x04,0x02,0x11,0x2e,0x49,0x5b,0x55,0x5c,0x52,0x39,0x1c,0x00,0x03,0x09,0x1f,0x2e,0x32,0x32,0x32,0x32,0x32,
+	0x2e,0x3d,0x54,0x5a,0x57,0x58,0x45,0x2a,0x0c,0x00,0x05,0x0d,0x29,0x45,0x62,0x7e,0x9a,0x83,0x67,0x4a,0x2e,0x12,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,
+	0x4d,0x4d,0x4d,0x4d,0x4d,0x4d,0x4d,0x4d,0x49,0x36,0x2f,0x20,0x0a,0x00,0x02,0x08,0x26,0x42,0x58,0x5a,0x6f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,
+	0x7a,0x5e,0x3e,0x1e,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x88,0x88,0x88,0x88,0x8a,0x95,0x88,0x88,0x88,0x88,0x8b,0x94,0x88,0x88,0x88,0x88,0x88,0x72,0x52,0x32,0x12,
+	0x00,0x02,0x08,0x27,0x43,0x59,0x5b,0x5b,0x58,0x42,0x25,0x07,0x05,0x03,0x15,0x32,0x4d,0x5d,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x04,0x13,0x2f,0x46,0x51,0x51,0x4f,
+	0x3e,0x48,0x4a,0x4a,0x49,0x38,0x1f,0x03,0x00,0x03,0x0c,0x23,0x32,0x36,0x2d,0x37,0x55,0x6d,0x61,0x44,0x33,0x36,0x2c,0x19,0x00,0x04,0x08,0x27,0x43,0x59,0x5b,0x5b,
+	0x58,0x42,0x25,0x07,0x05,0x03,0x15,0x32,0x4d,0x5d,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x05,0x10,0x30,0x50,0x70,0x90,0x89,0x69,0x49,0x29,0x09,0x00,0x01,0x05,0x25,
+	0x45,0x65,0x85,0x94,0x74,0x54,0x50,0x50,0x4f,0x40,0x46,0x4b,0x48,0x4a,0x3b,0x22,0x06,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x4f,0x4f,0x42,0x2a,0x31,
+	0x33,0x33,0x33,0x26,0x12,0x00,0x1a,0x0c,0x16,0x17,0x17,0x16,0x0b,0x00,0x04,0x04,0x04,0x00,0x04,0x0d,0x16,0x16,0x17,0x16,0x0b,0x00,0x09,0x17,0x33,0x4f,0x6b,0x87,
+	0x95,0x79,0x5d,0x42,0x3e,0x43,0x62,0x7c,0x5d,0x42,0x40,0x41,0x34,0x1d,0x03,0x00,0x02,0x0c,0x2b,0x4a,0x66,0x6d,0x6d,0x65,0x49,0x2b,0x32,0x2f,0x21,0x40,0x5d,0x6b,
+	0x61,0x6a,0x52,0x34,0x15,0x00,0x05,0x19,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,0x06,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x0a,0x1e,
+	0x3e,0x5e,0x7e,0x9b,0x7b,0x70,0x90,0x8a,0x6a,0x4a,0x2a,0x0a,0x00,0x07,0x15,0x30,0x49,0x66,0x84,0x98,0x7b,0x5e,0x40,0x23,0x05,0x00,0x03,0x03,0x22,0x41,0x5d,0x69,
+	0x61,0x68,0x50,0x32,0x26,0x29,0x48,0x62,0x67,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x06,0x20,0x3f,0x5e,0x7e,0x9d,0x7d,0x5e,0x3f,0x20,0x00,0x06,0x15,0x2b,0x39,0x3a,0x3b,
+	0x39,0x2a,0x14,0x1b,0x24,0x22,0x16,0x1c,0x31,0x3b,0x38,0x3c,0x36,0x25,0x0d,0x00,0x03,0x15,0x2b,0x39,0x3a,0x3b,0x39,0x2a,0x14,0x1b,0x24,0x22,0x16,0x1c,0x31,0x3b,
+	0x38,0x3c,0x36,0x25,0x0d,0x00,0x04,0x04,0x0f,0x12,0x12,0x12,0x12,0x12,0x27,0x47,0x67,0x76,0x6d,0x71,0x51,0x32,0x12,0x00,0x05,0x1c,0x38,0x55,0x71,0x8d,0x90,0x74,
+	0x57,0x3b,0x1f,0x03,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2a,0x1d,0x10,0x05,0x00,0x04,0x16,0x2c,0x3a,0x43,
+	0x57,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x6a,0x69,0x5a,0x5a,0x4d,0x34,0x17,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x91,0x91,0x91,0x91,0x92,0x99,0x91,0x91,0x91,
+	0x91,0x92,0x99,0x91,0x91,0x91,0x91,0x91,0x72,0x52,0x32,0x12,0x00,0x03,0x16,0x2d,0x3b,0x3c,0x3c,0x3b,0x2c,0x15,0x1c,0x25,0x22,0x16,0x20,0x34,0x3e,0x5e,0x7e,0x9e,
+	0xbe,0xde,0xfe,0x00,0x04,0x08,0x19,0x2a,0x31,0x31,0x30,0x48,0x63,0x68,0x67,0x65,0x4a,0x2b,0x0c,0x00,0x03,0x1d,0x39,0x4f,0x56,0x49,0x4a,0x41,0x4e,0x48,0x34,0x19,
+	0x16,0x0f,0x00,0x06,0x16,0x2d,0x3b,0x3c,0x3c,0x3b,0x2c,0x15,0x1c,0x25,0x22,0x16,0x20,0x34,0x3e,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x05,0x10,0x30,0x50,0x70,0x90,
+	0x89,0x69,0x49,0x29,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x30,0x30,0x44,0x60,0x6a,0x64,0x68,0x4e,0x30,0x10,0x00,0x02,0x05,0x25,0x45,0x65,
+	0x85,0x95,0x75,0x6f,0x6f,0x6e,0x56,0x37,0x18,0x14,0x13,0x13,0x0a,0x00,0x23,0x08,0x1a,0x24,0x24,0x18,0x06,0x00,0x10,0x0a,0x26,0x42,0x5e,0x7a,0x96,0x86,0x6a,0x4e,
+	0x62,0x5a,0x63,0x56,0x61,0x5a,0x62,0x5d,0x60,0x4a,0x2d,0x0f,0x00,0x02,0x0d,0x2c,0x4b,0x69,0x72,0x72,0x68,0x4b,0x36,0x1e,0x25,0x22,0x42,0x61,0x73,0x65,0x71,0x55,
+	0x36,0x16,0x00,0x05,0x19,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,0x06,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x0a,0x1e,0x3e,0x5e,0x7e,
+	0x9b,0x7b,0x70,0x90,0x8a,0x6a,0x4a,0x2a,0x0a,0x00,0x07,0x1b,0x38,0x55,0x73,0x90,0x8c,0x6e,0x51,0x34,0x16,0x00,0x05,0x16,0x30,0x44,0x4a,0x46,0x49,0x3b,0x3b,0x46,
+	0x40,0x35,0x47,0x52,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x05,0x07,0x26,0x46,0x65,0x84,0x96,0x77,0x57,0x38,0x19,0x00,0x07,0x10,0x1a,0x1b,0x1b,0x1a,0x0f,0x21,0x37,0x44,
+	0x40,0x2f,0x17,0x14,0x1b,0x19,0x1c,0x18,0x0b,0x00,0x05,0x10,0x1a,0x1b,0x1b,0x1a,0x0f,0x21,0x37,0x44,0x40,0x2f,0x17,0x14,0x1b,0x19,0x1c,0x18,0x0b,0x00,0x05,0x15,
+	0x24,0x2a,0x2a,0x2a,0x2a,0x2a,0x26,0x41,0x5b,0x63,0x5f,0x61,0x4a,0x2d,0x0e,0x00,0x04,0x0f,0x2b,0x48,0x64,0x80,0x9c,0x81,0x64,0x48,0x2c,0x10,0x00,0x08,0x05,0x25,
+	0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x27,0x1a,0x0d,0x0d,0x0d,0x0d,0x0d,0x0b,0x01,0x00,0x07,0x11,0x1b,0x2b,0x38,0x3a,0x3a,0x3a,0x3a,0x45,0x42,0x3a,0x4f,0x6a,0x7a,
+	0x8a,0xa1,0xc0,0xdf,0xf7,0xff,0x00,0x01,0x04,0x24,0x43,0x61,0x71,0x71,0x71,0x71,0x71,0x86,0x93,0x73,0x71,0x71,0x71,0x87,0x92,0x72,0x71,0x71,0x71,0x71,0x6b,0x4f,
+	0x30,0x11,0x00,0x04,0x11,0x1c,0x1d,0x1d,0x1c,0x11,0x22,0x38,0x45,0x41,0x30,0x32,0x4d,0x5d,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x02,0x09,0x1c,0x28,0x2a,0x2a,0x2a,
+	0x2a,0x2a,0x4a,0x68,0x6f,0x6d,0x6a,0x4c,0x2d,0x0d,0x00,0x02,0x06,0x26,0x46,0x65,0x74,0x65,0x68,0x4e,0x2f,0x2a,0x2a,0x2a,0x2a,0x28,0x1c,0x09,0x00,0x05,0x11,0x1c,
+	0x1d,0x1d,0x1c,0x11,0x22,0x38,0x45,0x41,0x30,0x32,0x4d,0x5d,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x05,0x10,0x30,0x50,0x70,0x90,0x89,0x69,0x49,0x29,0x09,0x00,0x01,
+	0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x2a,0x29,0x46,0x64,0x71,0x69,0x6d,0x50,0x31,0x11,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x9a,0x8f,0x8f,0x8f,0x90,0xa9,
+	0xc8,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x20,0x03,0x1e,0x35,0x44,0x43,0x33,0x1b,0x00,0x10,0x19,0x35,0x51,0x6d,0x89,0x93,0x77,0x5b,0x57,0x77,0x68,0x7c,0x62,
+	0x48,0x67,0x77,0x6c,0x72,0x52,0x32,0x12,0x00,0x02,0x04,0x21,0x3c,0x4e,0x52,0x52,0x62,0x63,0x4b,0x39,0x45,0x40,0x35,0x4b,0x53,0x4e,0x52,0x43,0x2a,0x0e,0x00,0x05,
+	0x19,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,0x06,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x0a,0x1e,0x3e,0x5e,0x7e,0x9b,0x7b,0x70,0x90,
+	0x8a,0x6a,0x4a,0x2a,0x0a,0x00,0x06,0x0a,0x27,0x45,0x62,0x7f,0x9d,0x7f,0x62,0x44,0x27,0x0a,0x00,0x05,0x03,0x18,0x26,0x2a,0x27,0x29,0x36,0x53,0x66,0x5a,0x41,0x58,
+	0x5b,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x05,0x0e,0x2d,0x4c,0x6c,0x8b,0x8f,0x70,0x51,0x31,0x12,0x00,0x0c,0x12,0x31,0x4d,0x63,0x5d,0x43,0x25,0x06,0x00,0x0f,0x12,0x31,
+	0x4d,0x63,0x5d,0x43,0x25,0x06,0x00,0x09,0x12,0x2d,0x41,0x4a,0x4a,0x4a,0x4a,0x4a,0x44,0x31,0x3f,0x43,0x41,0x42,0x34,0x1d,0x03,0x00,0x03,0x02,0x1e,0x3a,0x57,0x73,
+	0x8f,0x8e,0x71,0x55,0x39,0x1d,0x01,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x4a,0x45,0x33,0x1a,0x00,0x0f,0x0f,0x19,0x1a,0x1a,0x32,0x4f,0x65,0x5d,0x43,
+	0x3d,0x4f,0x5f,0x6d,0x5b,0x3d,0x1e,0x00,0x04,0x1a,0x35,0x4a,0x51,0x51,0x51,0x51,0x66,0x86,0x93,0x73,0x53,0x51,0x67,0x87,0x92,0x72,0x52,0x51,0x51,0x51,0x4f,0x3e,
+	0x25,0x08,0x00,0x09,0x13,0x32,0x4f,0x64,0x5d,0x43,0x39,0x59,0x79,0x66,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x01,0x01,0x1d,0x36,0x47,0x4a,0x4a,0x4a,0x4a,0x48,0x3b,0x4f,
+	0x52,0x51,0x50,0x3d,0x23,0x06,0x00,0x02,0x04,0x24,0x42,0x5e,0x68,0x69,0x6d,0x50,0x4a,0x4a,0x4a,0x4a,0x4a,0x47,0x36,0x1e,0x02,0x00,0x09,0x13,0x32,0x4f,0x64,0x5d,
+	0x43,0x39,0x59,0x79,0x66,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x05,0x10,0x30,0x50,0x70,0x90,0x89,0x69,0x49,0x29,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,
+	0x4a,0x4a,0x49,0x3b,0x4d,0x53,0x50,0x51,0x40,0x26,0x09,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x97,0x89,0x89,0x89,0x8b,0xa7,0xc7,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,
+	0x00,0x20,0x0e,0x2d,0x4a,0x62,0x60,0x47,0x2a,0x0b,0x00,0x0e,0x0c,0x28,0x44,0x60,0x7c,0x99,0x84,0x68,0x4c,0x4a,0x5b,0x55,0x5c,0x5a,0x68,0x55,0x5b,0x58,0x5a,0x46,
+	0x2b,0x0d,0x00,0x03,0x0e,0x23,0x30,0x4a,0x5c,0x6d,0x6e,0x50,0x50,0x64,0x5c,0x41,0x4b,0x5d,0x56,0x3e,0x29,0x16,0x00,0x06,0x19,0x39,0x59,0x79,0x99,0x81,0x61,0x41,
+	0x21,0x01,0x00,0x06,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x0a,0x1e,0x3e,0x5e,0x7e,0x9b,0x7b,0x70,0x90,0x8a,0x6a,0x4a,0x2a,0x0a,0x00,0x06,0x16,
+	0x34,0x51,0x6f,0x8c,0x90,0x73,0x55,0x38,0x1a,0x00,0x08,0x07,0x0a,0x08,0x1b,0x3b,0x5a,0x78,0x63,0x4c,0x6c,0x73,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x05,0x15,0x34,0x53,
+	0x73,0x92,0x88,0x69,0x4a,0x2a,0x0b,0x00,0x0c,0x15,0x35,0x55,0x74,0x69,0x49,0x29,0x09,0x00,0x0f,0x15,0x35,0x55,0x74,0x69,0x49,0x29,0x09,0x00,0x09,0x1e,0x3d,0x5a,
+	0x6a,0x6a,0x6a,0x6a,0x6a,0x5e,0x42,0x23,0x24,0x22,0x23,0x19,0x07,0x00,0x04,0x11,0x2d,0x4a,0x66,0x82,0x9b,0x7e,0x62,0x46,0x2a,0x0e,0x00,0x09,0x05,0x25,0x45,0x65,
+	0x85,0x95,0x75,0x6a,0x6a,0x60,0x45,0x27,0x07,0x00,0x11,0x16,0x36,0x56,0x74,0x68,0x48,0x28,0x33,0x43,0x4d,0x44,0x2e,0x13,0x00,0x04,0x07,0x1d,0x2c,0x31,0x31,0x31,
+	0x46,0x66,0x86,0x93,0x73,0x53,0x47,0x67,0x87,0x92,0x72,0x52,0x32,0x31,0x31,0x30,0x24,0x11,0x00,0x0a,0x16,0x36,0x56,0x75,0x68,0x48,0x39,0x59,0x79,0x99,0x81,0x61,
+	0x41,0x21,0x01,0x00,0x01,0x0b,0x2a,0x49,0x63,0x6a,0x6a,0x6a,0x6a,0x66,0x4d,0x31,0x32,0x32,0x31,0x25,0x10,0x00,0x04,0x1c,0x34,0x46,0x4e,0x66,0x6a,0x6a,0x6a,0x6a,
+	0x6a,0x6a,0x6a,0x63,0x49,0x2b,0x0c,0x00,0x09,0x16,0x36,0x56,0x75,0x68,0x48,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,0x05,0x10,0x30,0x50,0x70,0x90,0x89,
+	0x69,0x49,0x29,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x5f,0x6a,0x6a,0x67,0x50,0x32,0x33,0x31,0x32,0x27,0x13,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x95,
+	0x75,0x69,0x69,0x68,0x53,0x35,0x16,0x00,0x26,0x11,0x31,0x51,0x70,0x6d,0x4d,0x2e,0x0e,0x00,0x0e,0x1b,0x37,0x53,0x6f,0x8c,0x91,0x75,0x59,0x3d,0x31,0x3c,0x38,0x42,
+	0x61,0x77,0x5c,0x3c,0x3a,0x3b,0x2f,0x19,0x00,0x05,0x17,0x37,0x57,0x76,0x68,0x55,0x42,0x58,0x76,0x66,0x47,0x58,0x78,0x67,0x47,0x27,0x07,0x00,0x06,0x19,0x39,0x59,
+	0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,0x06,0x18,0x38,0x58,0x78,0x98,0x81,0x61,0x41,0x21,0x01,0x00,0x0a,0x1e,0x3e,0x5e,0x7e,0x9b,0x7b,0x70,0x90,0x8a,0x6a,0x4a,
+	0x2a,0x0a,0x00,0x05,0x05,0x23,0x40,0x5e,0x7b,0x98,0x83,0x66,0x49,0x2b,0x0e,0x00,0x0b,0x19,0x38,0x56,0x6c,0x5e,0x4c,0x6c,0x8b,0x8b,0x6d,0x4d,0x2d,0x0d,0x00,0x05,
+	0x1b,0x3b,0x5a,0x79,0x99,0x82,0x62,0x43,0x24,0x04,0x00,0x0c,0x14,0x33,0x51,0x69,0x62,0x46,0x27,0x08,0x00,0x0f,0x14,0x33,0x51,0x69,0x62,0x46,0x27,0x08,0x00,0x08,
+	0x01,0x21,0x41,0x61,0x81,0x8a,0x8a,0x8a,0x8a,0x9b,0xba,0xd9,0xf9,0xfc,0xfc,0xff,0xff,0xff,0xff,0x00,0x01,0x04,0x20,0x3d,0x59,0x75,0x91,0x8c,0x6f,0x53,0x37,0x1b,
+	0x00,0x0a,0x05,0x25,0x45,0x65,0x85,0x97,0x8a,0x8a,0x8a,0x98,0xb6,0xd6,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x08,0x14,0x34,0x52,0x69,0x61,0x45,
+	0x26,0x17,0x26,0x2d,0x27,0x17,0x01,0x00,0x05,0x02,0x0e,0x11,0x11,0x26,0x46,0x66,0x86,0x93,0x73,0x53,0x47,0x67,0x87,0x92,0x72,0x52,0x32,0x12,0x11,0x10,0x08,0x00,
+	0x0b,0x14,0x34,0x52,0x69,0x61,0x45,0x39,0x59,0x79,0x90,0x81,0x61,0x41,0x21,0x01,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8a,0x8a,0x8a,0x8a,0x91,0xae,0xce,0xec,0xed,0xed,
+	0xf7,0xff,0xff,0x00,0x02,0x0a,0x29,0x47,0x62,0x66,0x70,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x91,0xb1,0xd1,0xf1,0xff,0x00,0x08,0x14,0x34,0x52,0x69,0x61,0x45,0x39,
+	0x59,0x79,0x90,0x81,0x61,0x41,0x21,0x01,0x00,0x05,0x10,0x30,0x50,0x70,0x90,0x89,0x69,0x49,0x29,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x67,0x87,0x8a,
+	0x8e,0xab,0xcb,0xea,0xed,0xec,0xf5,0xff,0xff,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x49,0x49,0x3d,0x26,0x0b,0x00,0x26,0x0f,0x2f,0x4d,0x67,0x65,
+	0x4a,0x2b,0x0c,0x00,0x0d,0x06,0x26,0x45,0x62,0x7f,0x90,0x82,0x66,0x4a,0x2d,0x14,0x1c,0x21,0x40,0x5d,0x6e,0x58,0x3a,0x1b,0x1b,0x13,0x02,0x00,0x05,0x13,0x31,0x4d,
+	0x61,0x5a,0x41,0x43,0x5f,0x69,0x53,0x3c,0x4e,0x61,0x59,0x3f,0x22,0x03,0x00,0x06,0x19,0x39,0x59,0x79,0x90,0x81,0x61,0x41,0x21,0x01,0x00,0x06,0x18,0x38,0x58,0x78,
+	0x90,0x81,0x61,0x41,0x21,0x01,0x00,0x0a,0x1e,0x3e,0x5e,0x7e,0x90,0x7b,0x70,0x90,0x8a,0x6a,0x4a,0x2a,0x0a,0x00,0x05,0x0e,0x2d,0x4c,0x6a,0x88,0x90,0x77,0x59,0x3c,
+	0x1f,0x01,0x00,0x0b,0x1a,0x3a,0x59,0x72,0x61,0x48,0x63,0x6b,0x6b,0x64,0x49,0x2a,0x0b,0x00,0x04,0x03,0x22,0x42,0x61,0x80,0x90,0x7b,0x5b,0x3c,0x1d,0x00,0x0d,0x15,
+	0x35,0x54,0x70,0x67,0x48,0x29,0x09,0x00,0x0f,0x15,0x35,0x54,0x70,0x67,0x48,0x29,0x09,0x00,0x08,0x01,0x21,0x41,0x61,0x81,0x90,0x90,0x90,0x90,0x9e,0xbb,0xda,0xfa,
+	0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x0c,0x2c,0x4b,0x68,0x84,0x90,0x7c,0x60,0x44,0x28,0x0c,0x00,0x0a,0x05,0x25,0x45,0x65,0x85,0x90,0x90,0x90,0x90,0x9b,0xb8,
+	0xd7,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x08,0x16,0x35,0x55,0x71,0x66,0x47,0x28,0x08,0x08,0x0d,0x08,0x00,0x0a,0x06,0x26,0x46,0x66,0x86,0x90,
+	0x73,0x53,0x47,0x67,0x87,0x90,0x72,0x52,0x32,0x12,0x00,0x0e,0x16,0x35,0x55,0x71,0x66,0x47,0x38,0x56,0x6e,0x70,0x70,0x5d,0x3f,0x1f,0x00,0x02,0x0d,0x2d,0x4d,0x6d,
+	0x8d,0x90,0x90,0x90,0x95,0xb0,0xcf,0xef,0xff,0xff,0xff,0xff,0xff,0x00,0x02,0x0b,0x2b,0x4b,0x6b,0x8a,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x8e,0x6e,0x4e,0x2e,0x0e,
+	0x00,0x09,0x16,0x35,0x55,0x71,0x66,0x47,0x38,0x56,0x6e,0x70,0x70,0x5d,0x3f,0x1f,0x00,0x06,0x10,0x30,0x50,0x70,0x90,0x89,0x69,0x49,0x29,0x09,0x00,0x01,0x05,0x25,
+	0x45,0x65,0x85,0x90,0x74,0x67,0x87,0x90,0x93,0xad,0xcc,0xeb,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x90,0x75,0x55,0x35,0x29,0x21,0x10,
+	0x00,0x27,0x11,0x30,0x50,0x6d,0x6a,0x4c,0x2d,0x0d,0x00,0x0d,0x06,0x26,0x45,0x62,0x70,0x70,0x6e,0x57,0x3a,0x1e,0x02,0x01,0x21,0x41,0x5f,0x71,0x5a,0x3b,0x1c,0x00,
+	0x08,0x06,0x20,0x36,0x42,0x3e,0x2d,0x46,0x64,0x73,0x57,0x38,0x36,0x41,0x3d,0x2c,0x13,0x00,0x07,0x18,0x37,0x56,0x6e,0x70,0x70,0x5d,0x3f,0x20,0x00,0x07,0x17,0x37,
+	0x55,0x6e,0x70,0x70,0x5d,0x3f,0x1f,0x00,0x0b,0x1c,0x3c,0x5a,0x6f,0x70,0x6f,0x69,0x70,0x70,0x64,0x47,0x28,0x08,0x00,0x05,0x0e,0x2d,0x4c,0x69,0x70,0x70,0x69,0x4d,
+	0x2f,0x12,0x00,0x0c,0x12,0x2e,0x46,0x53,0x4b,0x36,0x48,0x4b,0x4b,0x48,0x37,0x1e,0x02,0x00,0x04,0x03,0x22,0x41,0x5f,0x70,0x70,0x6d,0x54,0x35,0x16,0x00,0x0d,0x0d,
+	0x2a,0x43,0x53,0x4f,0x3a,0x1f,0x02,0x00,0x0f,0x0d,0x2a,0x43,0x53,0x4f,0x3a,0x1f,0x02,0x00,0x09,0x1f,0x3f,0x5d,0x70,0x70,0x70,0x70,0x70,0x61,0x44,0x25,0x05,0x00,
+	0x07,0x0c,0x2c,0x4b,0x67,0x70,0x70,0x6b,0x51,0x35,0x19,0x00,0x0b,0x04,0x23,0x43,0x60,0x70,0x70,0x70,0x70,0x70,0x64,0x47,0x28,0x08,0x00,0x11,0x0e,0x2a,0x43,0x53,
+	0x4e,0x39,0x1e,0x01,0x00,0x0d,0x05,0x25,0x44,0x61,0x70,0x70,0x6b,0x50,0x45,0x62,0x70,0x70,0x6b,0x4f,0x30,0x11,0x00,0x0e,0x0e,0x2a,0x43,0x53,0x4e,0x39,0x2a,0x42,
+	0x4f,0x50,0x50,0x46,0x30,0x15,0x00,0x02,0x0c,0x2c,0x4b,0x67,0x70,0x70,0x70,0x70,0x6a,0x4f,0x30,0x10,0x00,0x07,0x07,0x27,0x46,0x63,0x70,0x70,0x70,0x70,0x70,0x70,
+	0x70,0x70,0x70,0x68,0x4b,0x2c,0x0d,0x00,0x09,0x0e,0x2a,0x43,0x53,0x4e,0x39,0x2a,0x42,0x4f,0x50,0x50,0x46,0x30,0x15,0x00,0x06,0x0f,0x2e,0x4d,0x69,0x70,0x70,0x64,
+	0x47,0x28,0x08,0x00,0x01,0x04,0x23,0x43,0x60,0x70,0x70,0x6c,0x63,0x70,0x70,0x6c,0x52,0x33,0x14,0x00,0x07,0x04,0x23,0x43,0x60,0x70,0x70,0x6c,0x52,0x33,0x14,0x03,
+	0x00,0x28,0x09,0x26,0x40,0x51,0x50,0x3d,0x23,0x06,0x00,0x0e,0x1b,0x35,0x4a,0x50,0x50,0x4f,0x42,0x2b,0x0f,0x00,0x02,0x17,0x33,0x49,0x51,0x46,0x2e,0x12,0x00,0x09,
+	0x09,0x1a,0x22,0x1f,0x1d,0x38,0x4e,0x54,0x46,0x2d,0x19,0x21,0x1e,0x12,0x00,0x08,0x0e,0x2a,0x42,0x4f,0x50,0x50,0x47,0x31,0x16,0x00,0x07,0x0e,0x2a,0x42,0x4f,0x50,
+	0x50,0x46,0x30,0x15,0x00,0x0b,0x12,0x2e,0x45,0x4f,0x50,0x4f,0x4d,0x50,0x50,0x4b,0x37,0x1d,0x00,0x06,0x05,0x22,0x3b,0x4d,0x50,0x50,0x4d,0x3b,0x22,0x05,0x00,0x0c,
+	0x01,0x19,0x2b,0x33,0x2e,0x1f,0x29,0x2b,0x2b,0x29,0x1d,0x0a,0x00,0x06,0x18,0x33,0x48,0x50,0x50,0x4f,0x41,0x29,0x0d,0x00,0x0e,0x16,0x29,0x33,0x31,0x23,0x0d,0x00,
+	0x11,0x16,0x29,0x33,0x31,0x23,0x0d,0x00,0x0a,0x15,0x30,0x46,0x50,0x50,0x50,0x50,0x50,0x49,0x35,0x1a,0x00,0x08,0x04,0x20,0x3a,0x4c,0x50,0x50,0x4e,0x3e,0x25,0x0a,
+	0x00,0x0c,0x19,0x34,0x49,0x50,0x50,0x50,0x50,0x50,0x4b,0x37,0x1d,0x00,0x13,0x16,0x29,0x33,0x30,0x22,0x0c,0x00,0x0f,0x1a,0x35,0x49,0x50,0x50,0x4e,0x3e,0x35,0x4a,
+	0x50,0x50,0x4e,0x3d,0x24,0x08,0x00,0x0f,0x16,0x29,0x33,0x30,0x22,0x15,0x27,0x2f,0x30,0x30,0x2a,0x1a,0x03,0x00,0x02,0x04,0x20,0x3a,0x4c,0x50,0x50,0x50,0x50,0x4e,
+	0x3d,0x24,0x08,0x00,0x08,0x1c,0x36,0x4a,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x4c,0x3a,0x21,0x04,0x00,0x0a,0x16,0x29,0x33,0x30,0x22,0x15,0x27,0x2f,0x30,
+	0x30,0x2a,0x1a,0x03,0x00,0x06,0x06,0x23,0x3c,0x4d,0x50,0x50,0x4b,0x37,0x1d,0x00,0x03,0x19,0x34,0x49,0x50,0x50,0x4e,0x4a,0x50,0x50,0x4e,0x3f,0x27,0x0b,0x00,0x08,
+	0x19,0x34,0x49,0x50,0x50,0x4e,0x3f,0x27,0x0b,0x00,0x2a,0x13,0x27,0x32,0x32,0x25,0x10,0x00,0x0f,0x08,0x1e,0x2c,0x30,0x30,0x2f,0x27,0x15,0x00,0x03,0x06,0x1c,0x2c,
+	0x31,0x2a,0x19,0x01,0x00,0x0b,0x02,0x00,0x01,0x0b,0x21,0x31,0x34,0x2b,0x18,0x00,0x01,0x01,0x00,0x0b,0x15,0x27,0x2f,0x2f,0x2f,0x2a,0x1a,0x04,0x00,0x08,0x15,0x26,
+	0x2f,0x30,0x30,0x2a,0x1a,0x03,0x00,0x0b,0x01,0x18,0x29,0x2f,0x30,0x2f,0x2e,0x30,0x30,0x2d,0x1f,0x0a,0x00,0x07,0x0e,0x22,0x2e,0x30,0x30,0x2e,0x22,0x0e,0x00,0x0f,
+	0x0d,0x13,0x0f,0x04,0x0a,0x0b,0x0b,0x0a,0x01,0x00,0x07,0x06,0x1c,0x2b,0x30,0x30,0x2f,0x26,0x14,0x00,0x10,0x0c,0x13,0x12,0x07,0x00,0x13,0x0c,0x13,0x12,0x07,0x00,
+	0x0b,0x03,0x1a,0x2a,0x30,0x30,0x30,0x30,0x30,0x2c,0x1d,0x08,0x00,0x09,0x0d,0x21,0x2d,0x30,0x30,0x2f,0x24,0x11,0x00,0x0d,0x07,0x1c,0x2b,0x30,0x30,0x30,0x30,0x30,
+	0x2d,0x1f,0x0a,0x00,0x14,0x0c,0x13,0x11,0x07,0x00,0x10,0x08,0x1d,0x2c,0x2f,0x2f,0x2f,0x24,0x1e,0x2c,0x30,0x30,0x2e,0x23,0x10,0x00,0x11,0x0c,0x13,0x11,0x07,0x00,
+	0x01,0x09,0x0f,0x10,0x10,0x0b,0x00,0x05,0x0d,0x21,0x2d,0x30,0x30,0x30,0x30,0x2e,0x23,0x10,0x00,0x09,0x09,0x1e,0x2c,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+	0x2e,0x21,0x0d,0x00,0x0c,0x0c,0x13,0x11,0x07,0x00,0x01,0x09,0x0f,0x10,0x10,0x0b,0x00,0x09,0x0f,0x22,0x2e,0x30,0x30,0x2c,0x1f,0x0a,0x00,0x03,0x07,0x1c,0x2b,0x30,
+	0x30,0x2f,0x2c,0x30,0x30,0x2f,0x25,0x12,0x00,0x09,0x07,0x1c,0x2b,0x30,0x30,0x2f,0x25,0x12,0x00,0x2c,0x0a,0x13,0x12,0x09,0x00,0x11,0x02,0x0d,0x10,0x10,0x0f,0x09,
+	0x00,0x05,0x01,0x0d,0x11,0x0c,0x00,0x10,0x06,0x12,0x14,0x0e,0x00,0x0f,0x09,0x0f,0x10,0x10,0x0b,0x00,0x0b,0x09,0x0f,0x10,0x10,0x0b,0x00,0x0f,0x0a,0x0f,0x0f,0x0f,
+	0x0e,0x10,0x10,0x0d,0x03,0x00,0x09,0x05,0x0e,0x10,0x10,0x0e,0x05,0x00,0x22,0x0c,0x0f,0x0f,0x0f,0x08,0x00,0x39,0x0b,0x10,0x10,0x10,0x10,0x10,0x0d,0x02,0x00,0x0b,
+	0x05,0x0e,0x10,0x10,0x0f,0x07,0x00,0x0f,0x01,0x0c,0x10,0x10,0x10,0x10,0x10,0x0d,0x03,0x00,0x2a,0x02,0x0d,0x10,0x10,0x0f,0x07,0x02,0x0d,0x10,0x10,0x0f,0x07,0x00,
+	0x22,0x05,0x0e,0x10,0x10,0x10,0x10,0x0f,0x06,0x00,0x0b,0x03,0x0d,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x0e,0x05,0x00,0x21,0x06,0x0e,0x10,0x10,0x0d,0x03,
+	0x00,0x05,0x01,0x0c,0x10,0x10,0x0f,0x0d,0x10,0x10,0x0f,0x08,0x00,0x0b,0x01,0x0c,0x10,0x10,0x0f,0x08,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x29,0x04,0x07,
+	0x07,0x07,0x01,0x00,0x06,0x03,0x07,0x07,0x07,0x01,0x00,0x07,0x05,0x08,0x08,0x08,0x08,0x08,0x06,0x00,0x10,0x04,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,
+	0x06,0x00,0x08,0x04,0x07,0x07,0x06,0x00,0x06,0x03,0x07,0x07,0x07,0x00,0x08,0x08,0x0b,0x0b,0x0b,0x04,0x00,0x0e,0x04,0x07,0x07,0x06,0x00,0x08,0x04,0x07,0x07,0x06,
+	0x00,0x0b,0x05,0x07,0x07,0x06,0x00,0x07,0x03,0x06,0x06,0x05,0x00,0x04,0x02,0x06,0x06,0x06,0x05,0x00,0x08,0x04,0x07,0x07,0x07,0x00,0x0d,0x04,0x07,0x07,0x07,0x03,
+	0x00,0x0a,0x05,0x07,0x07,0x07,0x03,0x00,0x07,0x04,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x06,0x00,0x08,0x04,0x07,0x07,0x07,0x07,0x07,0x07,0x01,0x00,
+	0x15,0x08,0x07,0x00,0x10,0x03,0x06,0x06,0x06,0x06,0x06,0x04,0x00,0x0d,0x06,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x06,0x00,0x07,0x06,0x08,0x08,
+	0x07,0x00,0x09,0x07,0x08,0x08,0x05,0x00,0x07,0x06,0x08,0x08,0x07,0x00,0x04,0x06,0x08,0x08,0x07,0x00,0x08,0x02,0x08,0x08,0x08,0x05,0x00,0x07,0x06,0x07,0x07,0x07,
+	0x00,0x07,0x06,0x07,0x07,0x06,0x00,0x08,0x06,0x07,0x07,0x06,0x00,0x07,0x06,0x07,0x07,0x05,0x00,0x07,0x06,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,
+	0x07,0x06,0x00,0x08,0x06,0x08,0x08,0x07,0x00,0x17,0x04,0x06,0x06,0x06,0x03,0x00,0x0d,0x06,0x09,0x09,0x08,0x01,0x00,0x14,0x01,0x15,0x23,0x27,0x27,0x27,0x1e,0x0d,
+	0x00,0x04,0x13,0x22,0x27,0x27,0x27,0x1f,0x0e,0x00,0x04,0x01,0x16,0x24,0x28,0x28,0x28,0x28,0x28,0x25,0x19,0x05,0x00,0x0c,0x01,0x15,0x23,0x27,0x27,0x27,0x27,0x27,
+	0x27,0x27,0x27,0x27,0x27,0x26,0x1b,0x09,0x00,0x04,0x01,0x15,0x23,0x27,0x27,0x26,0x1d,0x0b,0x00,0x03,0x14,0x22,0x27,0x27,0x26,0x1e,0x0c,0x00,0x04,0x04,0x19,0x27,
+	0x2b,0x2b,0x2b,0x21,0x0f,0x00,0x0b,0x01,0x15,0x23,0x27,0x27,0x26,0x1d,0x0b,0x00,0x04,0x01,0x15,0x23,0x27,0x27,0x26,0x1d,0x0b,0x00,0x07,0x05,0x19,0x25,0x27,0x27,
+	0x25,0x1a,0x07,0x00,0x04,0x15,0x22,0x26,0x26,0x25,0x1b,0x08,0x00,0x01,0x11,0x20,0x26,0x26,0x26,0x24,0x19,0x06,0x00,0x04,0x01,0x15,0x23,0x27,0x27,0x26,0x1d,0x0c,
+	0x00,0x09,0x01,0x15,0x23,0x27,0x27,0x27,0x22,0x14,0x00,0x07,0x03,0x17,0x24,0x27,0x27,0x27,0x21,0x12,0x00,0x04,0x01,0x15,0x23,0x27,0x27,0x27,0x27,0x27,0x27,0x27,
+	0x27,0x27,0x27,0x26,0x1b,0x09,0x00,0x04,0x01,0x15,0x23,0x27,0x27,0x27,0x27,0x27,0x27,0x1f,0x0e,0x00,0x12,0x0b,0x1d,0x28,0x27,0x1b,0x08,0x00,0x0d,0x15,0x22,0x26,
+	0x26,0x26,0x26,0x26,0x24,0x18,0x05,0x00,0x09,0x07,0x1a,0x25,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x26,0x1b,0x08,0x00,0x03,0x07,0x1a,0x26,0x28,
+	0x28,0x26,0x1c,0x09,0x00,0x05,0x0c,0x1e,0x27,0x28,0x28,0x25,0x18,0x04,0x00,0x03,0x07,0x1a,0x26,0x28,0x28,0x26,0x1c,0x09,0x07,0x1a,0x26,0x28,0x28,0x26,0x1c,0x09,
+	0x00,0x05,0x0f,0x20,0x28,0x28,0x28,0x23,0x15,0x00,0x04,0x07,0x1a,0x25,0x27,0x27,0x26,0x1e,0x0c,0x00,0x03,0x08,0x1b,0x26,0x27,0x27,0x26,0x1d,0x0b,0x00,0x04,0x07,
+	0x1a,0x25,0x27,0x27,0x26,0x1c,0x0a,0x00,0x03,0x0c,0x1d,0x26,0x27,0x27,0x25,0x19,0x05,0x00,0x03,0x07,0x1a,0x25,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,
+	0x27,0x27,0x26,0x1d,0x0b,0x00,0x04,0x07,0x1a,0x26,0x28,0x28,0x27,0x1d,0x0b,0x00,0x13,0x01,0x16,0x23,0x26,0x26,0x26,0x21,0x13,0x00,0x0a,0x02,0x17,0x25,0x29,0x29,
+	0x28,0x1f,0x0d,0x00,0x13,0x15,0x2e,0x41,0x47,0x47,0x46,0x3a,0x24,0x09,0x00,0x02,0x11,0x2b,0x3f,0x47,0x47,0x46,0x3b,0x24,0x0a,0x00,0x03,0x15,0x2f,0x42,0x48,0x48,
+	0x48,0x48,0x48,0x44,0x32,0x19,0x00,0x0c,0x15,0x2e,0x41,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x45,0x36,0x1f,0x03,0x00,0x03,0x15,0x2e,0x41,0x47,0x47,
+	0x46,0x38,0x21,0x06,0x00,0x01,0x12,0x2c,0x40,0x47,0x47,0x46,0x39,0x23,0x08,0x00,0x03,0x17,0x31,0x45,0x4b,0x4b,0x4a,0x3c,0x25,0x09,0x00,0x0a,0x15,0x2e,0x41,0x47,
+	0x47,0x46,0x38,0x21,0x06,0x00,0x03,0x15,0x2e,0x41,0x47,0x47,0x46,0x38,0x21,0x06,0x00,0x06,0x1a,0x33,0x43,0x47,0x47,0x44,0x34,0x1c,0x01,0x00,0x02,0x14,0x2d,0x40,
+	0x46,0x46,0x44,0x36,0x1e,0x11,0x29,0x3d,0x46,0x46,0x46,0x43,0x33,0x1b,0x00,0x04,0x15,0x2e,0x41,0x47,0x47,0x46,0x39,0x22,0x07,0x00,0x08,0x15,0x2e,0x41,0x47,0x47,
+	0x47,0x40,0x2c,0x12,0x00,0x06,0x18,0x31,0x43,0x47,0x47,0x47,0x3e,0x2a,0x10,0x00,0x03,0x15,0x2e,0x41,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x45,0x36,
+	0x1f,0x03,0x00,0x03,0x15,0x2e,0x41,0x47,0x47,0x47,0x47,0x47,0x47,0x3b,0x25,0x0a,0x00,0x10,0x04,0x20,0x38,0x47,0x46,0x35,0x1d,0x01,0x00,0x0b,0x14,0x2d,0x40,0x46,
+	0x46,0x46,0x46,0x46,0x43,0x32,0x1a,0x00,0x09,0x1c,0x34,0x44,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x45,0x35,0x1e,0x02,0x00,0x01,0x01,0x1c,0x35,
+	0x45,0x48,0x48,0x46,0x36,0x1e,0x03,0x00,0x03,0x07,0x22,0x39,0x47,0x48,0x48,0x43,0x31,0x18,0x00,0x02,0x01,0x1c,0x35,0x45,0x48,0x48,0x46,0x36,0x1e,0x1c,0x35,0x45,
+	0x48,0x48,0x46,0x36,0x1e,0x03,0x00,0x03,0x0c,0x26,0x3c,0x48,0x48,0x48,0x41,0x2e,0x14,0x00,0x03,0x1c,0x34,0x44,0x47,0x47,0x46,0x39,0x23,0x08,0x00,0x01,0x02,0x1e,
+	0x35,0x45,0x47,0x47,0x46,0x38,0x21,0x06,0x00,0x03,0x1c,0x34,0x44,0x47,0x47,0x45,0x37,0x20,0x05,0x00,0x01,0x07,0x22,0x39,0x46,0x47,0x47,0x43,0x33,0x1a,0x00,0x03,
+	0x1c,0x34,0x44,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x46,0x38,0x21,0x05,0x00,0x02,0x01,0x1c,0x35,0x45,0x48,0x48,0x47,0x38,0x21,0x06,0x00,
+	0x12,0x16,0x2f,0x41,0x46,0x46,0x46,0x3f,0x2b,0x12,0x00,0x09,0x16,0x2f,0x43,0x49,0x49,0x48,0x3a,0x23,0x08,0x00,0x11,0x02,0x22,0x40,0x5b,0x67,0x67,0x66,0x51,0x36,
+	0x1a,0x00,0x02,0x1e,0x3c,0x58,0x67,0x67,0x66,0x51,0x34,0x15,0x00,0x02,0x03,0x22,0x40,0x5c,0x68,0x68,0x68,0x68,0x68,0x5f,0x45,0x26,0x07,0x00,0x0a,0x02,0x22,0x40,
+	0x5b,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x63,0x4b,0x2d,0x0e,0x00,0x02,0x02,0x22,0x40,0x5b,0x67,0x67,0x64,0x4e,0x30,0x11,0x00,0x01,0x1f,0x3e,0x59,
+	0x67,0x67,0x65,0x4f,0x32,0x13,0x00,0x02,0x03,0x23,0x41,0x5e,0x6b,0x6b,0x69,0x50,0x32,0x13,0x00,0x09,0x02,0x22,0x40,0x5b,0x67,0x67,0x64,0x4e,0x30,0x11,0x00,0x02,
+	0x02,0x22,0x40,0x5b,0x67,0x67,0x64,0x4e,0x30,0x11,0x00,0x05,0x09,0x28,0x46,0x60,0x67,0x67,0x61,0x48,0x2a,0x0b,0x00,0x01,0x02,0x21,0x40,0x5b,0x66,0x66,0x62,0x4a,
+	0x2d,0x26,0x3e,0x56,0x66,0x66,0x66,0x60,0x47,0x29,0x0a,0x00,0x02,0x02,0x22,0x40,0x5b,0x67,0x67,0x65,0x4e,0x31,0x12,0x00,0x07,0x02,0x22,0x40,0x5b,0x67,0x67,0x67,
+	0x59,0x3f,0x25,0x0a,0x00,0x04,0x10,0x2a,0x44,0x5e,0x67,0x67,0x67,0x57,0x3a,0x1c,0x00,0x02,0x02,0x22,0x40,0x5b,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+	0x63,0x4b,0x2d,0x0e,0x00,0x02,0x02,0x22,0x40,0x5b,0x67,0x67,0x67,0x67,0x67,0x66,0x52,0x35,0x16,0x00,0x10,0x0f,0x2e,0x4c,0x65,0x63,0x49,0x2b,0x0c,0x00,0x0a,0x02,
+	0x21,0x40,0x5b,0x66,0x66,0x66,0x66,0x66,0x5f,0x45,0x27,0x08,0x00,0x07,0x0b,0x2a,0x48,0x61,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x62,0x4a,0x2c,
+	0x0d,0x00,0x01,0x0b,0x2a,0x48,0x62,0x68,0x68,0x63,0x4a,0x2d,0x0e,0x00,0x03,0x13,0x31,0x4f,0x65,0x68,0x68,0x5e,0x43,0x25,0x05,0x00,0x01,0x0b,0x2a,0x48,0x62,0x68,
+	0x68,0x63,0x4a,0x2d,0x2a,0x48,0x62,0x68,0x68,0x63,0x4a,0x2d,0x0e,0x00,0x03,0x18,0x36,0x53,0x67,0x68,0x68,0x5b,0x3f,0x21,0x01,0x00,0x01,0x0b,0x2a,0x48,0x61,0x67,
+	0x67,0x65,0x4f,0x34,0x19,0x00,0x01,0x13,0x2f,0x4a,0x62,0x67,0x67,0x64,0x4d,0x30,0x11,0x00,0x02,0x0b,0x2a,0x48,0x61,0x67,0x67,0x64,0x4c,0x30,0x13,0x00,0x01,0x15,
+	0x31,0x4e,0x65,0x67,0x67,0x60,0x46,0x28,0x09,0x00,0x01,0x0b,0x2a,0x48,0x61,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x64,0x4d,0x2f,0x11,0x00,
+	0x02,0x0b,0x2a,0x48,0x62,0x68,0x68,0x65,0x4d,0x31,0x15,0x00,0x11,0x05,0x23,0x41,0x5c,0x66,0x66,0x66,0x58,0x3d,0x1f,0x01,0x00,0x07,0x03,0x22,0x41,0x5c,0x69,0x69,
+	0x66,0x4f,0x32,0x13,0x00,0x11,0x05,0x25,0x45,0x65,0x85,0x87,0x7d,0x62,0x46,0x2b,0x10,0x01,0x21,0x41,0x61,0x81,0x87,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,
+	0x65,0x85,0x88,0x88,0x88,0x88,0x97,0xb6,0xd6,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x87,0x87,0x87,0x87,0x87,0x87,
+	0x87,0x87,0x87,0x71,0x51,0x31,0x11,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x87,0x74,0x54,0x34,0x14,0x02,0x22,0x42,0x62,0x82,0x87,0x76,0x56,0x36,0x16,0x00,0x02,0x05,
+	0x25,0x45,0x65,0x85,0x8b,0x75,0x55,0x35,0x15,0x00,0x09,0x05,0x25,0x45,0x65,0x85,0x87,0x74,0x54,0x34,0x14,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x87,0x74,0x54,0x34,
+	0x14,0x00,0x05,0x0b,0x2b,0x4b,0x6b,0x87,0x87,0x6e,0x4e,0x2e,0x0e,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x86,0x71,0x51,0x31,0x3a,0x53,0x6b,0x83,0x86,0x85,0x6c,0x4d,
+	0x2d,0x0d,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x87,0x75,0x55,0x35,0x15,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x87,0x86,0x6b,0x51,0x37,0x1c,0x02,0x00,0x02,0x08,0x22,
+	0x3c,0x57,0x71,0x87,0x87,0x7f,0x5f,0x3f,0x1f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x71,0x51,0x31,0x11,0x00,0x02,0x05,
+	0x25,0x45,0x65,0x85,0x87,0x87,0x87,0x87,0x89,0xa7,0xc7,0xe6,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x0a,0x11,0x31,0x50,0x6f,0x6c,0x4d,0x2d,0x0d,0x00,0x0a,0x05,0x25,
+	0x45,0x65,0x85,0x86,0x86,0x86,0x86,0x95,0xb4,0xd4,0xf4,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,
+	0x87,0x87,0x70,0x50,0x30,0x10,0x00,0x01,0x0d,0x2d,0x4d,0x6c,0x88,0x88,0x74,0x55,0x37,0x19,0x00,0x03,0x1d,0x3c,0x5a,0x78,0x88,0x85,0x66,0x47,0x27,0x08,0x00,0x01,
+	0x0d,0x2d,0x4d,0x6c,0x88,0x88,0x74,0x56,0x37,0x2d,0x4d,0x6c,0x88,0x88,0x74,0x56,0x37,0x19,0x00,0x02,0x04,0x22,0x40,0x5f,0x7d,0x88,0x81,0x62,0x43,0x23,0x03,0x00,
+	0x01,0x0d,0x2d,0x4d,0x6c,0x87,0x87,0x7b,0x60,0x45,0x29,0x0e,0x24,0x3f,0x5b,0x76,0x87,0x87,0x72,0x53,0x33,0x14,0x00,0x02,0x0d,0x2d,0x4d,0x6c,0x87,0x87,0x77,0x5a,
+	0x3e,0x21,0x06,0x23,0x40,0x5c,0x79,0x87,0x87,0x6a,0x4b,0x2b,0x0b,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x73,
+	0x53,0x33,0x13,0x00,0x02,0x0d,0x2d,0x4d,0x6c,0x88,0x88,0x79,0x5d,0x40,0x24,0x08,0x00,0x10,0x10,0x2e,0x4c,0x6a,0x86,0x86,0x84,0x66,0x48,0x29,0x0b,0x00,0x07,0x05,
+	0x25,0x45,0x65,0x85,0x89,0x75,0x55,0x35,0x15,0x00,0x11,0x05,0x25,0x45,0x65,0x85,0xa5,0x8e,0x73,0x57,0x3c,0x21,0x06,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,
+	0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x9b,0x91,0x91,0x91,0x9c,0xb8,0xd7,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x9b,
+	0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x91,0x71,0x51,0x31,0x11,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x02,0x22,0x42,0x62,0x82,0x96,0x76,0x56,
+	0x36,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x1a,0x1a,0x1a,0x1a,0x13,0x04,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,
+	0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x05,0x0b,0x2b,0x4b,0x6b,0x8b,0x8e,0x6e,0x4e,0x2e,0x0e,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x91,
+	0x71,0x51,0x37,0x4f,0x67,0x80,0x98,0x89,0x71,0x58,0x40,0x24,0x07,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x00,0x07,0x05,0x25,0x45,0x65,0x85,
+	0xa5,0x98,0x7e,0x63,0x49,0x2f,0x14,0x00,0x02,0x1a,0x34,0x4f,0x69,0x83,0x9d,0x9f,0x7f,0x5f,0x3f,0x1f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x9b,0x92,0x92,0x92,0x92,
+	0x92,0x92,0x92,0x91,0x71,0x51,0x31,0x11,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x9d,0x93,0x93,0x93,0x94,0xab,0xc9,0xe8,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x0a,0x10,
+	0x2f,0x4e,0x69,0x66,0x4b,0x2c,0x0c,0x00,0x0a,0x05,0x25,0x45,0x65,0x85,0x9d,0x93,0x93,0x93,0x9c,0xb7,0xd6,0xf5,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x0d,0x2d,
+	0x4d,0x6d,0x8d,0x91,0x91,0x91,0x91,0xa1,0x91,0x91,0x91,0x91,0x90,0x70,0x50,0x30,0x10,0x00,0x01,0x06,0x25,0x43,0x61,0x7f,0x9c,0x7e,0x60,0x42,0x23,0x05,0x00,0x01,
+	0x0a,0x28,0x46,0x64,0x83,0x98,0x7a,0x5c,0x3e,0x1f,0x01,0x00,0x01,0x06,0x25,0x43,0x61,0x7f,0x9d,0x7e,0x60,0x42,0x25,0x43,0x61,0x7f,0x9d,0x7e,0x60,0x42,0x24,0x06,
+	0x00,0x01,0x0e,0x2d,0x4b,0x69,0x87,0x94,0x76,0x58,0x3a,0x1b,0x00,0x02,0x07,0x24,0x40,0x5b,0x77,0x92,0x8c,0x71,0x56,0x3a,0x1f,0x35,0x50,0x6b,0x87,0x97,0x7c,0x61,
+	0x46,0x2a,0x0d,0x00,0x02,0x07,0x24,0x41,0x5e,0x7b,0x97,0x85,0x68,0x4c,0x2f,0x14,0x31,0x4e,0x6a,0x87,0x95,0x79,0x5c,0x3f,0x22,0x05,0x00,0x01,0x0d,0x2d,0x4d,0x6d,
+	0x8d,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x9b,0x93,0x73,0x53,0x33,0x13,0x00,0x02,0x06,0x24,0x40,0x5c,0x79,0x95,0x88,0x6c,0x50,0x33,0x17,0x00,0x10,0x1a,
+	0x38,0x57,0x75,0x93,0xa0,0x8e,0x70,0x52,0x34,0x16,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x1d,0x1a,0x0d,0x00,0x0f,0x05,0x25,0x45,0x65,0x85,0xa5,
+	0x9f,0x84,0x68,0x4d,0x32,0x17,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x71,0x71,0x65,0x48,0x28,0x09,0x00,0x0a,
+	0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x6c,0x4f,0x30,0x10,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x02,0x22,
+	0x42,0x62,0x82,0x96,0x76,0x56,0x36,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x33,0x3a,0x3a,0x3a,0x3a,0x30,0x1d,0x04,0x00,0x02,0x05,0x25,0x45,
+	0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x05,0x0b,0x2b,0x4b,0x6b,0x8b,0x8e,0x6e,0x4e,0x2e,0x0e,0x00,
+	0x01,0x05,0x25,0x45,0x65,0x85,0x91,0x71,0x51,0x4c,0x64,0x7c,0x95,0x8c,0x74,0x5c,0x44,0x2b,0x13,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x00,
+	0x07,0x05,0x25,0x45,0x65,0x85,0x97,0x8f,0x90,0x75,0x5b,0x41,0x26,0x0c,0x12,0x2c,0x46,0x61,0x7b,0x95,0x8c,0x9d,0x7f,0x5f,0x3f,0x1f,0x00,0x02,0x05,0x25,0x45,0x65,
+	0x85,0x93,0x73,0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x6c,0x4f,0x30,0x10,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x73,0x73,0x71,0x57,0x38,0x18,0x11,0x10,0x10,
+	0x07,0x00,0x0c,0x10,0x30,0x4f,0x6b,0x69,0x4c,0x2d,0x0d,0x00,0x0a,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x73,0x73,0x68,0x4a,0x2a,0x10,0x0d,0x10,0x0c,0x00,0x04,0x0c,
+	0x2c,0x4b,0x68,0x71,0x71,0x71,0x71,0x7b,0x9b,0x7e,0x71,0x71,0x71,0x71,0x6a,0x4d,0x2e,0x0f,0x00,0x02,0x1a,0x38,0x57,0x75,0x93,0x89,0x6a,0x4c,0x2e,0x10,0x00,0x01,
+	0x14,0x32,0x51,0x6f,0x8d,0x8e,0x70,0x51,0x33,0x15,0x00,0x03,0x1a,0x38,0x56,0x74,0x92,0x89,0x6b,0x4d,0x2f,0x38,0x56,0x74,0x92,0x89,0x6b,0x4d,0x2f,0x11,0x00,0x01,
+	0x19,0x37,0x55,0x73,0x92,0x8a,0x6c,0x4d,0x2f,0x11,0x00,0x03,0x14,0x2f,0x4b,0x66,0x81,0x9c,0x82,0x66,0x4b,0x30,0x46,0x61,0x7c,0x97,0x86,0x6b,0x50,0x35,0x1a,0x00,
+	0x04,0x16,0x33,0x50,0x6d,0x89,0x93,0x76,0x5a,0x3d,0x22,0x3f,0x5c,0x78,0x95,0x87,0x6b,0x4e,0x31,0x14,0x00,0x02,0x0d,0x2c,0x4c,0x69,0x72,0x72,0x72,0x72,0x72,0x72,
+	0x72,0x72,0x72,0x7d,0x97,0x88,0x6e,0x51,0x32,0x13,0x00,0x03,0x15,0x31,0x4d,0x69,0x86,0x97,0x7b,0x5f,0x42,0x26,0x0a,0x00,0x0e,0x07,0x25,0x43,0x61,0x7f,0x9c,0x82,
+	0x99,0x7b,0x5d,0x3f,0x20,0x02,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x3d,0x38,0x27,0x0f,0x00,0x0e,0x05,0x25,0x45,0x65,0x85,0x96,0x8b,0x95,0x79,
+	0x5e,0x43,0x28,0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x51,0x4c,0x38,0x1e,0x01,0x00,0x0a,0x05,0x25,0x45,
+	0x65,0x85,0x94,0x74,0x54,0x52,0x52,0x52,0x52,0x52,0x52,0x50,0x3e,0x25,0x08,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x02,0x22,0x42,0x62,0x82,
+	0x96,0x76,0x56,0x36,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x38,0x4d,0x5a,0x5a,0x5a,0x5a,0x4a,0x30,0x12,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,
+	0x74,0x54,0x34,0x14,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x05,0x0b,0x2b,0x4b,0x6b,0x8b,0x8e,0x6e,0x4e,0x2e,0x0e,0x00,0x01,0x05,0x25,
+	0x45,0x65,0x85,0x91,0x71,0x51,0x60,0x79,0x91,0x90,0x78,0x5f,0x47,0x2f,0x16,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x00,0x07,0x05,0x25,0x45,
+	0x65,0x85,0x94,0x7d,0x97,0x88,0x6d,0x53,0x39,0x1e,0x24,0x3e,0x59,0x73,0x8d,0x92,0x7b,0x9b,0x7f,0x5f,0x3f,0x1f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,
+	0x52,0x52,0x52,0x52,0x52,0x52,0x50,0x3e,0x25,0x08,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x53,0x52,0x45,0x2c,0x2e,0x30,0x30,0x30,0x24,0x10,0x00,0x0b,
+	0x08,0x25,0x3e,0x4f,0x4e,0x3c,0x22,0x05,0x00,0x0a,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x53,0x4f,0x3b,0x27,0x30,0x2c,0x30,0x2a,0x1a,0x04,0x00,0x02,0x04,0x21,
+	0x3b,0x4e,0x51,0x51,0x51,0x5b,0x7b,0x9b,0x7e,0x5e,0x51,0x51,0x51,0x4f,0x3d,0x23,0x06,0x00,0x02,0x10,0x2e,0x4c,0x6a,0x88,0x93,0x75,0x57,0x39,0x1a,0x01,0x1f,0x3d,
+	0x5b,0x79,0x98,0x83,0x65,0x47,0x29,0x0a,0x00,0x03,0x0f,0x2d,0x4b,0x69,0x87,0x94,0x76,0x58,0x3a,0x2d,0x4b,0x69,0x87,0x94,0x76,0x58,0x3a,0x1c,0x05,0x23,0x41,0x60,
+	0x7e,0x9c,0x7f,0x61,0x43,0x25,0x06,0x00,0x03,0x03,0x1f,0x3a,0x55,0x70,0x8c,0x92,0x77,0x5c,0x41,0x56,0x72,0x8d,0x91,0x76,0x5a,0x3f,0x24,0x09,0x00,0x04,0x08,0x25,
+	0x42,0x5f,0x7b,0x98,0x85,0x68,0x4b,0x30,0x4d,0x6a,0x86,0x96,0x79,0x5d,0x40,0x23,0x06,0x00,0x02,0x05,0x22,0x3c,0x4f,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x5b,0x75,
+	0x8f,0x90,0x76,0x5c,0x41,0x27,0x0a,0x00,0x03,0x06,0x22,0x3e,0x5a,0x77,0x93,0x8a,0x6e,0x52,0x35,0x19,0x00,0x0e,0x11,0x2f,0x4e,0x6c,0x8a,0x91,0x77,0x95,0x85,0x67,
+	0x49,0x2b,0x0d,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x4e,0x5d,0x54,0x3b,0x1e,0x00,0x0e,0x05,0x25,0x45,0x65,0x85,0x95,0x7a,0x96,0x8a,0x6f,0x54,0x39,
+	0x21,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x2e,0x20,0x0b,0x00,0x0b,0x05,0x25,0x45,0x65,0x85,0x94,0x74,
+	0x54,0x34,0x32,0x32,0x32,0x32,0x32,0x31,0x25,0x11,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x08,0x22,0x42,0x62,0x82,0x96,0x76,0x56,0x36,0x16,
+	0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x50,0x65,0x7a,0x7a,0x7a,0x77,0x59,0x39,0x19,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,
+	0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x05,0x0b,0x2b,0x4b,0x6b,0x8b,0x8e,0x6e,0x4e,0x2e,0x0e,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x91,0x71,
+	0x5d,0x75,0x8e,0x94,0x7b,0x63,0x4b,0x32,0x1a,0x02,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x85,
+	0x9a,0x7f,0x65,0x4b,0x30,0x36,0x50,0x6b,0x85,0x9a,0x80,0x7b,0x9b,0x7f,0x5f,0x3f,0x1f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x32,0x32,0x32,0x32,
+	0x32,0x31,0x25,0x11,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x33,0x2a,0x39,0x4d,0x50,0x4f,0x4f,0x3d,0x23,0x06,0x00,0x0b,0x11,0x25,0x30,0x2f,0x23,
+	0x0e,0x00,0x0b,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x30,0x2b,0x43,0x50,0x4a,0x50,0x47,0x31,0x15,0x00,0x03,0x0e,0x23,0x2f,0x31,0x31,0x3b,0x5b,0x7b,0x9b,
+	0x7e,0x5e,0x3e,0x31,0x31,0x30,0x24,0x10,0x00,0x03,0x05,0x23,0x41,0x60,0x7e,0x9c,0x80,0x61,0x43,0x25,0x0b,0x29,0x48,0x66,0x84,0x97,0x79,0x5a,0x3c,0x1e,0x00,0x04,
+	0x04,0x22,0x40,0x5f,0x7d,0x9b,0x81,0x63,0x44,0x26,0x40,0x5e,0x7d,0x9b,0x81,0x63,0x45,0x26,0x0f,0x2e,0x4c,0x6a,0x88,0x93,0x75,0x56,0x38,0x1a,0x00,0x05,0x0e,0x29,
+	0x44,0x60,0x7b,0x96,0x88,0x6d,0x51,0x67,0x82,0x9b,0x80,0x65,0x4a,0x2e,0x13,0x00,0x06,0x17,0x34,0x51,0x6d,0x8a,0x93,0x76,0x59,0x3e,0x5b,0x78,0x95,0x88,0x6b,0x4f,
+	0x32,0x15,0x00,0x04,0x0f,0x23,0x30,0x32,0x32,0x32,0x32,0x32,0x38,0x53,0x6d,0x87,0x98,0x7e,0x64,0x49,0x2f,0x15,0x00,0x05,0x13,0x2f,0x4b,0x67,0x84,0x99,0x7d,0x61,
+	0x45,0x28,0x0c,0x00,0x0d,0x1c,0x3a,0x58,0x76,0x95,0x86,0x6d,0x8b,0x90,0x72,0x54,0x36,0x17,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x5b,0x7b,0x64,0x44,
+	0x24,0x04,0x00,0x0d,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x85,0x9b,0x80,0x65,0x4a,0x2f,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,
+	0x95,0x75,0x55,0x35,0x15,0x05,0x00,0x03,0x04,0x0b,0x0a,0x0b,0x09,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x26,0x26,0x26,0x20,0x12,0x11,0x09,0x00,
+	0x04,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x28,0x28,0x28,0x42,0x62,0x82,0x96,0x76,0x56,0x36,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x67,
+	0x7d,0x92,0x92,0x7d,0x67,0x51,0x34,0x15,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,
+	0x00,0x05,0x0b,0x2b,0x4b,0x6b,0x8b,0x8e,0x6e,0x4e,0x2e,0x0e,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x91,0x71,0x72,0x8a,0x97,0x7f,0x66,0x4e,0x36,0x1d,0x05,0x00,0x05,
+	0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x73,0x8d,0x92,0x77,0x5d,0x43,0x48,0x63,0x7d,0x97,0x88,0x6d,0x7b,
+	0x9b,0x7f,0x5f,0x3f,0x1f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x28,0x28,0x28,0x22,0x12,0x11,0x09,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x95,0x75,
+	0x55,0x35,0x15,0x29,0x48,0x66,0x6e,0x6a,0x6a,0x4d,0x2e,0x0f,0x00,0x03,0x01,0x0a,0x0b,0x0b,0x0a,0x01,0x00,0x03,0x08,0x10,0x10,0x07,0x00,0x03,0x02,0x0b,0x0b,0x0b,
+	0x0a,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x18,0x37,0x56,0x6f,0x62,0x70,0x5d,0x3e,0x1f,0x00,0x04,0x06,0x10,0x11,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,
+	0x5e,0x3e,0x1e,0x11,0x10,0x07,0x00,0x05,0x19,0x37,0x55,0x73,0x92,0x8a,0x6c,0x4e,0x2f,0x16,0x34,0x52,0x70,0x8f,0x8c,0x6e,0x50,0x32,0x13,0x00,0x05,0x17,0x36,0x54,
+	0x72,0x90,0x8c,0x6d,0x4f,0x31,0x36,0x54,0x72,0x90,0x8c,0x6e,0x4f,0x31,0x1a,0x38,0x56,0x75,0x93,0x88,0x6a,0x4c,0x2e,0x10,0x00,0x06,0x18,0x34,0x4f,0x6a,0x85,0x99,
+	0x7d,0x62,0x78,0x93,0x8a,0x6f,0x54,0x39,0x1e,0x02,0x00,0x06,0x09,0x26,0x42,0x5f,0x7c,0x99,0x84,0x67,0x4c,0x69,0x86,0x97,0x7a,0x5d,0x41,0x24,0x07,0x00,0x05,0x07,
+	0x11,0x12,0x12,0x12,0x16,0x30,0x4b,0x65,0x7f,0x9a,0x86,0x6c,0x51,0x37,0x1d,0x03,0x00,0x05,0x04,0x20,0x3c,0x58,0x74,0x91,0x8c,0x70,0x54,0x38,0x1b,0x00,0x0c,0x08,
+	0x26,0x45,0x63,0x81,0x9a,0x7c,0x62,0x80,0x9b,0x7c,0x5e,0x40,0x22,0x04,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x52,0x63,0x58,0x3e,0x20,0x01,0x00,0x0d,
+	0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x74,0x8f,0x91,0x76,0x5b,0x40,0x41,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,
+	0x15,0x00,0x03,0x0e,0x21,0x2b,0x29,0x2b,0x28,0x1a,0x05,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x46,0x46,0x46,0x46,0x3d,0x28,0x0e,0x00,0x05,0x05,0x25,
+	0x45,0x65,0x85,0x94,0x74,0x54,0x48,0x48,0x48,0x48,0x48,0x62,0x82,0x96,0x76,0x56,0x36,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x6a,0x7f,0x95,0x90,0x7a,
+	0x65,0x4f,0x3a,0x24,0x09,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x05,0x0b,
+	0x2b,0x4b,0x6b,0x8b,0x8e,0x6e,0x4e,0x2e,0x0e,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x91,0x71,0x87,0x9b,0x82,0x6a,0x52,0x39,0x21,0x09,0x00,0x06,0x05,0x25,0x45,0x65,
+	0x85,0x95,0x75,0x55,0x35,0x15,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x61,0x7b,0x95,0x8a,0x6f,0x55,0x5a,0x75,0x8f,0x90,0x75,0x5b,0x7b,0x9b,0x7f,0x5f,0x3f,
+	0x1f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x48,0x48,0x48,0x48,0x3f,0x2a,0x0f,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x29,0x48,
+	0x64,0x6b,0x68,0x68,0x4c,0x2e,0x0e,0x00,0x02,0x0a,0x1e,0x2a,0x2b,0x2b,0x29,0x1d,0x09,0x00,0x08,0x0b,0x1f,0x2a,0x2a,0x2b,0x29,0x1c,0x08,0x00,0x02,0x05,0x25,0x45,
+	0x65,0x85,0x95,0x75,0x55,0x35,0x18,0x37,0x55,0x6d,0x61,0x6f,0x5c,0x3e,0x1f,0x00,0x07,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x08,0x0e,0x2c,0x4b,0x69,
+	0x87,0x95,0x76,0x58,0x3a,0x20,0x3e,0x5d,0x7b,0x99,0x82,0x64,0x45,0x27,0x09,0x00,0x05,0x0d,0x2b,0x49,0x67,0x85,0x96,0x78,0x5a,0x3c,0x2b,0x49,0x67,0x85,0x96,0x78,
+	0x5a,0x3c,0x24,0x43,0x61,0x7f,0x9c,0x7e,0x60,0x41,0x23,0x05,0x00,0x06,0x07,0x23,0x3e,0x59,0x74,0x90,0x8e,0x73,0x89,0x95,0x7a,0x5e,0x43,0x28,0x0d,0x00,0x08,0x18,
+	0x34,0x51,0x6e,0x8b,0x92,0x75,0x5a,0x77,0x94,0x89,0x6c,0x4f,0x33,0x16,0x00,0x0a,0x0e,0x28,0x43,0x5d,0x77,0x91,0x8e,0x74,0x59,0x3f,0x25,0x0b,0x00,0x07,0x11,0x2d,
+	0x49,0x65,0x81,0x9b,0x7f,0x63,0x47,0x2b,0x0e,0x00,0x0b,0x13,0x31,0x4f,0x6d,0x8c,0x90,0x71,0x58,0x76,0x94,0x87,0x69,0x4b,0x2d,0x0e,0x00,0x05,0x05,0x25,0x45,0x65,
+	0x85,0x99,0x91,0xac,0xa4,0x86,0x9b,0xbb,0xdb,0xeb,0xeb,0xec,0xf6,0xff,0xff,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x63,0x7e,0x99,0x87,0x6c,0x51,0x41,0x61,
+	0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x00,0x02,0x08,0x23,0x3b,0x4a,0x48,0x4b,0x46,0x32,0x18,0x00,0x02,0x05,
+	0x25,0x45,0x65,0x85,0x94,0x74,0x66,0x66,0x66,0x66,0x66,0x55,0x39,0x1b,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x82,0x96,
+	0x76,0x56,0x36,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x81,0x97,0x8d,0x78,0x62,0x4d,0x38,0x22,0x0d,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,
+	0x34,0x14,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x05,0x0b,0x2b,0x4b,0x6b,0x8b,0x8e,0x6e,0x4e,0x2e,0x0e,0x00,0x01,0x05,0x25,0x45,0x65,
+	0x85,0x91,0x83,0x9b,0x86,0x6e,0x55,0x3d,0x25,0x0c,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,
+	0x69,0x83,0x9c,0x81,0x67,0x6d,0x87,0x98,0x7e,0x63,0x5b,0x7b,0x9b,0x7f,0x5f,0x3f,0x1f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x68,0x68,0x68,0x68,0x68,0x56,
+	0x3a,0x1b,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x35,0x2c,0x37,0x49,0x4d,0x4b,0x4b,0x3a,0x21,0x05,0x00,0x01,0x02,0x1e,0x37,0x49,0x4a,0x4a,0x48,
+	0x36,0x1d,0x01,0x00,0x06,0x04,0x20,0x39,0x49,0x49,0x4a,0x48,0x36,0x1c,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x33,0x2a,0x41,0x4e,0x48,0x4f,0x45,
+	0x2f,0x14,0x00,0x07,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x08,0x04,0x22,0x40,0x5e,0x7c,0x9b,0x81,0x63,0x45,0x2b,0x49,0x67,0x85,0x95,0x77,0x59,0x3b,
+	0x1d,0x00,0x06,0x02,0x20,0x3e,0x5c,0x7a,0x98,0x83,0x65,0x47,0x2f,0x4d,0x6c,0x8a,0xa1,0x83,0x65,0x47,0x2f,0x4d,0x6b,0x8a,0x92,0x73,0x55,0x37,0x19,0x00,0x08,0x12,
+	0x2d,0x48,0x64,0x7f,0x9a,0x84,0x99,0x84,0x69,0x4e,0x32,0x17,0x00,0x09,0x0a,0x26,0x43,0x60,0x7d,0x99,0x83,0x69,0x85,0x98,0x7b,0x5e,0x41,0x25,0x08,0x00,0x09,0x06,
+	0x20,0x3a,0x55,0x6f,0x89,0x96,0x7c,0x61,0x47,0x2d,0x13,0x00,0x08,0x02,0x1e,0x3a,0x56,0x72,0x8e,0x8e,0x72,0x56,0x3a,0x1d,0x01,0x00,0x0a,0x1d,0x3c,0x5a,0x78,0x96,
+	0x85,0x67,0x4d,0x6b,0x89,0x92,0x73,0x55,0x37,0x19,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0xa5,0xaf,0xbe,0xb3,0xa4,0xad,0xc5,0xcd,0xcc,0xcc,0xcd,0xda,0xef,0xff,0x00,
+	0x08,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x6d,0x88,0x98,0x7d,0x62,0x46,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,
+	0x35,0x15,0x00,0x02,0x12,0x31,0x4f,0x68,0x63,0x6b,0x5f,0x42,0x24,0x04,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x86,0x86,0x86,0x86,0x86,0x7e,0x5e,0x3e,0x1e,0x00,
+	0x05,0x05,0x25,0x45,0x65,0x85,0x96,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x96,0x76,0x56,0x36,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x84,0x99,0x8b,
+	0x75,0x60,0x4b,0x35,0x20,0x0a,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x05,
+	0x0b,0x2b,0x4b,0x6b,0x8b,0x8e,0x6e,0x4e,0x2e,0x0e,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x9a,0x99,0x89,0x71,0x59,0x40,0x28,0x10,0x00,0x08,0x05,0x25,0x45,0x65,0x85,
+	0x95,0x75,0x55,0x35,0x15,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x57,0x71,0x8b,0x94,0x79,0x7f,0x99,0x86,0x6b,0x51,0x5b,0x7b,0x9b,0x7f,0x5f,0x3f,0x1f,
+	0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x88,0x88,0x88,0x88,0x88,0x7e,0x5e,0x3e,0x1e,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x55,0x55,0x46,0x2d,0x2b,
+	0x2d,0x2c,0x2c,0x21,0x0d,0x00,0x02,0x0c,0x2b,0x4a,0x65,0x67,0x68,0x63,0x48,0x29,0x0a,0x00,0x06,0x0d,0x2d,0x4b,0x66,0x66,0x69,0x63,0x47,0x29,0x09,0x00,0x01,0x05,
+	0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x55,0x51,0x3c,0x26,0x2e,0x2b,0x2f,0x29,0x19,0x02,0x00,0x07,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x09,0x17,0x36,
+	0x54,0x72,0x90,0x8c,0x6d,0x4f,0x35,0x54,0x72,0x90,0x8b,0x6d,0x4f,0x30,0x12,0x00,0x07,0x15,0x33,0x51,0x70,0x8e,0x8e,0x70,0x52,0x3a,0x58,0x76,0x94,0x9f,0x8e,0x70,
+	0x52,0x39,0x58,0x76,0x94,0x87,0x69,0x4b,0x2c,0x0e,0x00,0x08,0x01,0x1c,0x38,0x53,0x6e,0x89,0xa2,0x8e,0x73,0x58,0x3d,0x22,0x06,0x00,0x0a,0x18,0x35,0x52,0x6f,0x8b,
+	0x91,0x77,0x93,0x8a,0x6d,0x50,0x33,0x16,0x00,0x0a,0x18,0x32,0x4d,0x67,0x81,0x9c,0x84,0x69,0x4f,0x35,0x1b,0x00,0x0a,0x0f,0x2b,0x47,0x63,0x7f,0x9b,0x81,0x65,0x49,
+	0x2d,0x10,0x00,0x09,0x0a,0x28,0x46,0x64,0x83,0x99,0x7a,0x5c,0x57,0x61,0x7f,0x9c,0x7e,0x60,0x42,0x23,0x05,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0xa5,0xac,0xbc,0xcd,
+	0xc4,0xc9,0xc2,0xae,0xac,0xac,0xae,0xc2,0xdd,0xfa,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x5c,0x77,0x92,0x8e,0x73,0x57,0x61,0x81,0x98,0x78,0x58,0x38,
+	0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x00,0x02,0x13,0x32,0x52,0x6e,0x68,0x72,0x63,0x44,0x25,0x05,0x00,0x01,0x05,0x25,0x45,0x65,0x85,
+	0x9a,0x90,0x90,0x90,0x90,0x90,0x7e,0x5e,0x3e,0x1e,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x9b,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x96,0x76,0x56,0x36,0x16,
+	0x00,0x02,0x05,0x25,0x45,0x65,0x85,0xa3,0x9e,0x88,0x73,0x5e,0x48,0x33,0x1d,0x08,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x02,0x05,0x25,
+	0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x05,0x0b,0x2b,0x4b,0x6b,0x8b,0x8e,0x6e,0x4e,0x2e,0x0e,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0xa5,0x98,0x7e,0x66,0x4e,
+	0x37,0x1f,0x07,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x44,0x5f,0x79,0x93,0x8b,0x91,0x8e,
+	0x74,0x59,0x3f,0x5b,0x7b,0x9b,0x7f,0x5f,0x3f,0x1f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x9a,0x91,0x91,0x91,0x91,0x91,0x7e,0x5e,0x3e,0x1e,0x00,0x05,0x05,0x25,0x45,
+	0x65,0x85,0x95,0x75,0x75,0x75,0x73,0x58,0x38,0x18,0x0d,0x0d,0x0d,0x04,0x00,0x03,0x0d,0x2c,0x4c,0x6a,0x6d,0x6e,0x68,0x4a,0x2b,0x0b,0x00,0x06,0x0e,0x2e,0x4e,0x6b,
+	0x6c,0x6f,0x67,0x49,0x2a,0x0a,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x75,0x75,0x69,0x4a,0x2b,0x0e,0x0c,0x0f,0x0a,0x00,0x09,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,
+	0x5e,0x3e,0x1e,0x00,0x09,0x0d,0x2b,0x49,0x67,0x86,0x96,0x78,0x5a,0x40,0x5e,0x7c,0x9b,0x80,0x62,0x44,0x26,0x08,0x00,0x07,0x0a,0x28,0x47,0x65,0x83,0x99,0x7b,0x5c,
+	0x44,0x62,0x81,0x9b,0x82,0x99,0x7b,0x5d,0x44,0x62,0x80,0x9b,0x7d,0x5e,0x40,0x22,0x04,0x00,0x09,0x18,0x33,0x4e,0x69,0x85,0xa0,0x8a,0x6f,0x54,0x39,0x1d,0x02,0x00,
+	0x0a,0x0a,0x27,0x44,0x61,0x7d,0x9a,0x89,0x98,0x7b,0x5f,0x42,0x25,0x08,0x00,0x09,0x10,0x2a,0x45,0x5f,0x79,0x94,0x8c,0x71,0x57,0x3d,0x23,0x08,0x00,0x0b,0x1c,0x38,
+	0x54,0x70,0x8c,0x90,0x74,0x58,0x3c,0x20,0x03,0x00,0x08,0x14,0x33,0x51,0x6f,0x8d,0x8e,0x77,0x77,0x77,0x77,0x77,0x93,0x89,0x6a,0x4c,0x2e,0x10,0x00,0x04,0x05,0x25,
+	0x45,0x65,0x85,0x98,0x8f,0xab,0xcb,0xe4,0xd3,0xb3,0x95,0x91,0x91,0x95,0xb3,0xd3,0xf3,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x4b,0x66,0x81,0x9d,0x84,
+	0x68,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x00,0x02,0x0b,0x27,0x41,0x52,0x4f,0x53,0x4c,0x37,0x1b,0x00,
+	0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x70,0x70,0x70,0x70,0x6f,0x5a,0x3c,0x1d,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x71,0x71,0x71,0x71,0x71,0x71,0x71,
+	0x82,0x96,0x76,0x56,0x36,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0xa5,0x8d,0x74,0x5b,0x46,0x31,0x1b,0x06,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,
+	0x14,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x05,0x0b,0x2b,0x4b,0x6b,0x8b,0x8e,0x6e,0x4e,0x2e,0x0e,0x00,0x01,0x05,0x25,0x45,0x65,0x85,
+	0x92,0x8f,0x93,0x7c,0x64,0x4c,0x34,0x1c,0x05,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,
+	0x4d,0x67,0x81,0x9c,0x96,0x7c,0x61,0x47,0x3b,0x5b,0x7b,0x9b,0x7f,0x5f,0x3f,0x1f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x71,0x71,0x71,0x71,0x71,0x5b,0x3c,
+	0x1d,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x9e,0x95,0x95,0x95,0x96,0xac,0xc9,0xe8,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x05,0x22,0x3d,0x50,0x51,0x52,0x4f,0x3b,
+	0x21,0x04,0x00,0x06,0x07,0x24,0x3e,0x50,0x51,0x52,0x4f,0x3b,0x20,0x03,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x9e,0x95,0x95,0x95,0x9d,0xb8,0xd7,0xf0,0xff,0xff,0xff,
+	0xff,0xff,0xff,0x00,0x06,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x09,0x02,0x20,0x3f,0x5d,0x7b,0x99,0x82,0x64,0x4a,0x69,0x87,0x94,0x76,0x58,0x39,0x1b,
+	0x00,0x09,0x1e,0x3c,0x5a,0x78,0x96,0x85,0x67,0x4f,0x6d,0x8b,0x90,0x78,0x96,0x86,0x68,0x4e,0x6d,0x8b,0x90,0x72,0x54,0x36,0x17,0x00,0x09,0x0d,0x28,0x44,0x5f,0x7a,
+	0x95,0x8c,0x9b,0x80,0x65,0x49,0x2e,0x13,0x00,0x0b,0x19,0x36,0x53,0x6f,0x8c,0xa7,0x8a,0x6d,0x51,0x34,0x17,0x00,0x09,0x08,0x22,0x3d,0x57,0x71,0x8b,0x94,0x79,0x5f,
+	0x45,0x2b,0x10,0x00,0x0c,0x0c,0x29,0x45,0x61,0x7d,0x99,0x83,0x67,0x4b,0x2f,0x13,0x00,0x07,0x01,0x1f,0x3d,0x5b,0x7a,0x98,0x9a,0x97,0x97,0x97,0x97,0x97,0x9d,0x93,
+	0x75,0x57,0x39,0x1a,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x08,0x05,0x25,0x45,0x65,0x85,
+	0x95,0x75,0x55,0x3a,0x55,0x71,0x8c,0x95,0x79,0x61,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x00,0x03,0x14,0x27,
+	0x32,0x31,0x33,0x2f,0x20,0x0a,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x50,0x50,0x50,0x4f,0x45,0x2e,0x13,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x94,0x74,
+	0x54,0x51,0x51,0x51,0x51,0x51,0x62,0x82,0x96,0x76,0x56,0x36,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0xa1,0x9c,0x88,0x70,0x58,0x40,0x27,0x0f,0x00,0x06,0x05,0x25,
+	0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x05,0x0b,0x2b,0x4b,0x6b,0x8b,0x8e,0x6e,0x4e,0x2e,0x0e,
+	0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x91,0x79,0x91,0x91,0x79,0x61,0x4a,0x32,0x1a,0x02,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x00,0x07,0x05,
+	0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x3a,0x55,0x6f,0x7f,0x7f,0x69,0x4f,0x35,0x3b,0x5b,0x7b,0x9b,0x7f,0x5f,0x3f,0x1f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,
+	0x73,0x53,0x51,0x51,0x51,0x51,0x46,0x2f,0x14,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x95,0x83,0x83,0x83,0x87,0xa6,0xc6,0xe6,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x02,
+	0x0f,0x24,0x31,0x32,0x32,0x31,0x23,0x0e,0x00,0x08,0x11,0x25,0x32,0x32,0x33,0x31,0x23,0x0e,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x86,0x9e,0x8a,0x93,0xab,0xc3,
+	0xdb,0xf2,0xff,0xff,0xff,0xff,0xff,0x00,0x06,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x0a,0x16,0x34,0x52,0x71,0x8f,0x8d,0x6f,0x55,0x73,0x91,0x8a,0x6b,
+	0x4d,0x2f,0x11,0x00,0x09,0x13,0x31,0x4f,0x6d,0x8b,0x90,0x72,0x59,0x78,0x96,0x86,0x6d,0x8b,0x91,0x73,0x59,0x77,0x95,0x86,0x67,0x49,0x2b,0x0d,0x00,0x08,0x03,0x1e,
+	0x39,0x54,0x70,0x8b,0x93,0x78,0x8e,0x91,0x75,0x5a,0x3f,0x24,0x08,0x00,0x0a,0x0b,0x28,0x45,0x61,0x7e,0x9c,0x7c,0x5f,0x43,0x26,0x09,0x00,0x09,0x1a,0x34,0x4f,0x69,
+	0x83,0x9c,0x81,0x67,0x4d,0x33,0x18,0x00,0x0e,0x19,0x36,0x52,0x6e,0x8a,0x92,0x76,0x5a,0x3e,0x22,0x06,0x00,0x06,0x0b,0x2a,0x48,0x66,0x84,0x98,0x7e,0x7e,0x7e,0x7e,
+	0x7e,0x7e,0x7e,0x9c,0x80,0x61,0x43,0x25,0x07,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x08,
+	0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x44,0x60,0x7b,0x96,0x8a,0x6f,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,
+	0x15,0x00,0x04,0x0b,0x13,0x12,0x13,0x10,0x05,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x30,0x30,0x2f,0x29,0x18,0x09,0x01,0x00,0x04,0x05,0x25,0x45,
+	0x65,0x85,0x94,0x74,0x54,0x34,0x31,0x31,0x31,0x42,0x62,0x82,0x96,0x76,0x56,0x36,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x84,0x9c,0x85,0x6d,0x54,0x3c,0x24,
+	0x0c,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x05,0x0b,0x2b,0x4b,0x6b,0x8b,
+	0x8e,0x6e,0x4e,0x2e,0x0e,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x91,0x71,0x7b,0x93,0x8f,0x77,0x5f,0x47,0x2f,0x18,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,
+	0x35,0x15,0x0a,0x0a,0x08,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x28,0x43,0x5a,0x5f,0x5f,0x56,0x3d,0x23,0x3b,0x5b,0x7b,0x9b,0x7f,0x5f,0x3f,0x1f,
+	0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x31,0x31,0x31,0x2a,0x19,0x02,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x63,0x63,0x62,0x4f,0x33,0x15,
+	0x00,0x09,0x08,0x12,0x12,0x13,0x12,0x08,0x00,0x03,0x01,0x09,0x08,0x00,0x03,0x07,0x0a,0x12,0x12,0x13,0x11,0x07,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x89,
+	0x99,0x81,0x69,0x52,0x3a,0x22,0x0a,0x00,0x0a,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x0a,0x0b,0x2a,0x48,0x66,0x84,0x98,0x79,0x60,0x7e,0x9c,0x7f,0x61,
+	0x43,0x24,0x06,0x00,0x09,0x08,0x26,0x44,0x62,0x81,0x9b,0x7d,0x64,0x82,0x99,0x7b,0x62,0x80,0x9b,0x7d,0x63,0x81,0x99,0x7b,0x5d,0x3f,0x20,0x02,0x00,0x08,0x14,0x2f,
+	0x4a,0x65,0x81,0x9c,0x82,0x67,0x7d,0x98,0x86,0x6b,0x50,0x34,0x19,0x00,0x0b,0x1e,0x3e,0x5e,0x7e,0x9c,0x7c,0x5c,0x3c,0x1c,0x00,0x09,0x12,0x2c,0x47,0x61,0x7b,0x96,
+	0x89,0x6f,0x55,0x3b,0x20,0x0a,0x0a,0x0a,0x0a,0x02,0x00,0x0a,0x0a,0x27,0x43,0x5f,0x7b,0x97,0x85,0x69,0x4d,0x31,0x15,0x00,0x06,0x16,0x34,0x52,0x71,0x8f,0x8d,0x6f,
+	0x5e,0x5e,0x5e,0x5e,0x5e,0x73,0x91,0x8a,0x6c,0x4e,0x30,0x11,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,
+	0x0d,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x33,0x4f,0x6a,0x85,0x9b,0x80,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,
+	0x75,0x55,0x35,0x27,0x1a,0x06,0x00,0x0b,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x2a,0x2a,0x2a,0x2a,0x2a,0x28,0x1e,0x0b,0x00,0x03,0x05,0x25,0x45,0x65,0x85,
+	0x94,0x74,0x54,0x34,0x14,0x11,0x22,0x42,0x62,0x82,0x96,0x76,0x56,0x36,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x87,0x9a,0x82,0x69,0x51,0x39,0x20,0x08,
+	0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x03,0x09,0x1c,0x28,0x2a,0x4a,0x68,
+	0x6f,0x6d,0x6a,0x4c,0x2d,0x0d,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x91,0x71,0x66,0x7e,0x96,0x8c,0x74,0x5d,0x45,0x2d,0x15,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x95,
+	0x75,0x55,0x35,0x2a,0x2a,0x2a,0x28,0x1c,0x09,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x16,0x2d,0x3c,0x3f,0x3f,0x3a,0x29,0x1b,0x3b,0x5b,0x7b,0x9b,
+	0x7f,0x5f,0x3f,0x1f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x11,0x11,0x0c,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x43,0x42,0x37,
+	0x22,0x08,0x00,0x11,0x0b,0x1e,0x28,0x28,0x1c,0x09,0x17,0x25,0x2a,0x2a,0x2a,0x2a,0x27,0x1b,0x07,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x73,0x8b,0x97,0x7f,
+	0x67,0x4f,0x37,0x20,0x08,0x00,0x09,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x0a,0x01,0x1f,0x3d,0x5b,0x7a,0x98,0x84,0x6a,0x88,0x93,0x74,0x56,0x38,0x1a,
+	0x00,0x0b,0x1b,0x39,0x58,0x76,0x94,0x88,0x6e,0x8d,0x8f,0x71,0x57,0x75,0x93,0x88,0x6e,0x8c,0x8f,0x71,0x52,0x34,0x16,0x00,0x08,0x09,0x24,0x40,0x5b,0x76,0x91,0x8d,
+	0x71,0x56,0x6c,0x87,0x97,0x7c,0x61,0x45,0x2a,0x0f,0x00,0x0a,0x1e,0x3e,0x5e,0x7e,0x9c,0x7c,0x5c,0x3c,0x1c,0x00,0x08,0x0a,0x24,0x3f,0x59,0x73,0x8e,0x91,0x77,0x5d,
+	0x43,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x20,0x0d,0x00,0x0a,0x17,0x34,0x50,0x6c,0x88,0x95,0x78,0x5c,0x40,0x24,0x08,0x00,0x04,0x02,0x21,0x3f,0x5d,0x7b,0x99,0x82,0x64,
+	0x46,0x3e,0x3e,0x3e,0x4a,0x69,0x87,0x95,0x77,0x58,0x3a,0x1c,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,
+	0x0d,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x23,0x3e,0x59,0x74,0x8f,0x91,0x81,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,
+	0x75,0x55,0x4a,0x45,0x33,0x1a,0x00,0x0b,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,0x48,0x38,0x20,0x04,0x00,0x02,0x05,0x25,0x45,0x65,
+	0x85,0x94,0x74,0x54,0x34,0x14,0x02,0x22,0x42,0x62,0x82,0x96,0x76,0x56,0x36,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x72,0x8b,0x96,0x7e,0x66,0x4e,0x35,
+	0x1d,0x05,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x02,0x01,0x1d,0x36,0x47,
+	0x48,0x3b,0x4f,0x52,0x51,0x50,0x3d,0x23,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x91,0x71,0x51,0x68,0x80,0x98,0x8a,0x72,0x5a,0x42,0x2b,0x13,0x00,0x04,0x05,0x25,
+	0x45,0x65,0x85,0x95,0x75,0x55,0x4a,0x4a,0x4a,0x4a,0x47,0x36,0x1e,0x02,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x12,0x1d,0x1f,0x1f,0x1c,0x0f,
+	0x1b,0x3b,0x5b,0x7b,0x9b,0x7f,0x5f,0x3f,0x1f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x0a,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,
+	0x22,0x1b,0x0b,0x00,0x11,0x05,0x20,0x38,0x48,0x47,0x36,0x1e,0x30,0x43,0x4a,0x4a,0x4a,0x4a,0x46,0x34,0x1b,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x5e,0x76,
+	0x8d,0x94,0x7c,0x65,0x4d,0x35,0x1d,0x05,0x00,0x08,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x0b,0x14,0x33,0x51,0x6f,0x8d,0x8e,0x75,0x93,0x88,0x6a,0x4c,
+	0x2d,0x0f,0x00,0x0b,0x11,0x2f,0x4d,0x6b,0x89,0x92,0x79,0x97,0x84,0x66,0x4c,0x6a,0x88,0x93,0x78,0x96,0x84,0x66,0x48,0x2a,0x0b,0x00,0x08,0x1a,0x35,0x50,0x6c,0x87,
+	0x97,0x7c,0x61,0x45,0x5b,0x77,0x92,0x8d,0x71,0x56,0x3b,0x20,0x04,0x00,0x09,0x1e,0x3e,0x5e,0x7e,0x9c,0x7c,0x5c,0x3c,0x1c,0x00,0x07,0x01,0x1c,0x37,0x51,0x6b,0x85,
+	0x99,0x7f,0x65,0x4b,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,0x49,0x3a,0x23,0x07,0x00,0x09,0x08,0x24,0x41,0x5d,0x79,0x95,0x88,0x6b,0x4f,0x33,0x17,0x00,0x04,0x0d,0x2b,0x49,
+	0x68,0x86,0x96,0x78,0x5a,0x3b,0x1e,0x1e,0x22,0x40,0x5e,0x7c,0x9a,0x81,0x63,0x45,0x27,0x08,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2d,0x4d,
+	0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2d,0x48,0x63,0x7e,0x99,0x90,0x98,0x78,0x58,0x38,0x18,0x00,0x02,
+	0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x6a,0x6a,0x60,0x45,0x27,0x07,0x00,0x0a,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x65,0x4c,0x2e,
+	0x0f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x02,0x22,0x42,0x62,0x82,0x96,0x76,0x56,0x36,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,
+	0x5e,0x76,0x8e,0x93,0x7b,0x62,0x4a,0x32,0x1a,0x01,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,
+	0x34,0x14,0x00,0x02,0x0b,0x2a,0x49,0x63,0x66,0x4d,0x31,0x32,0x32,0x31,0x25,0x10,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x91,0x71,0x51,0x53,0x6b,0x83,0x9a,0x87,0x70,
+	0x58,0x40,0x28,0x10,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x6a,0x6a,0x6a,0x6a,0x6a,0x64,0x4a,0x2b,0x0c,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,
+	0x34,0x14,0x00,0x06,0x1b,0x3b,0x5b,0x7b,0x9b,0x7f,0x5f,0x3f,0x1f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x0a,0x05,0x25,0x45,0x65,0x85,
+	0x95,0x75,0x55,0x35,0x15,0x00,0x13,0x0f,0x2e,0x4c,0x65,0x63,0x49,0x30,0x41,0x5d,0x6a,0x6a,0x6a,0x6a,0x61,0x46,0x28,0x09,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,
+	0x75,0x55,0x60,0x78,0x90,0x92,0x7a,0x62,0x4a,0x33,0x1b,0x03,0x00,0x07,0x1b,0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x0b,0x0a,0x28,0x46,0x65,0x83,0x99,0x7f,
+	0x9c,0x7e,0x5f,0x41,0x23,0x05,0x00,0x0b,0x06,0x24,0x42,0x60,0x7e,0x9c,0x85,0x98,0x7a,0x5c,0x41,0x5f,0x7e,0x9c,0x85,0x98,0x7a,0x5c,0x3d,0x1f,0x01,0x00,0x07,0x10,
+	0x2b,0x46,0x61,0x7c,0x98,0x86,0x6b,0x50,0x35,0x4b,0x66,0x81,0x9c,0x82,0x67,0x4c,0x30,0x15,0x00,0x09,0x1e,0x3e,0x5e,0x7e,0x9c,0x7c,0x5c,0x3c,0x1c,0x00,0x07,0x0b,
+	0x2a,0x48,0x63,0x7d,0x98,0x87,0x6d,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x67,0x4f,0x30,0x11,0x00,0x0a,0x15,0x31,0x4e,0x6a,0x86,0x97,0x7b,0x5e,0x42,0x26,0x0a,
+	0x00,0x03,0x18,0x36,0x54,0x72,0x90,0x8b,0x6d,0x4f,0x31,0x13,0x00,0x01,0x17,0x35,0x53,0x72,0x90,0x8c,0x6e,0x4f,0x31,0x13,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,
+	0x75,0x55,0x35,0x15,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x1c,0x37,0x52,0x6d,0x88,0xa4,0x98,
+	0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x97,0x8a,0x8a,0x8a,0x98,0xb6,0xd6,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x05,0x25,
+	0x45,0x65,0x85,0x96,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x71,0x51,0x31,0x11,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x02,0x22,0x42,0x62,
+	0x82,0x96,0x76,0x56,0x36,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x61,0x7a,0x92,0x90,0x77,0x5f,0x47,0x2e,0x13,0x00,0x02,0x05,0x25,0x45,0x65,0x85,
+	0x94,0x74,0x54,0x34,0x14,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0xad,0xcd,0xec,0xed,0xed,0xf7,0xff,0xff,
+	0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x91,0x71,0x51,0x3e,0x55,0x6d,0x85,0x9d,0x85,0x6d,0x55,0x3e,0x24,0x08,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x97,0x8a,0x8a,0x8a,
+	0x8a,0x8a,0x8a,0x6e,0x4e,0x2e,0x0e,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x06,0x1b,0x3b,0x5b,0x7b,0x9b,0x7f,0x5f,0x3f,0x1f,0x00,0x02,
+	0x05,0x25,0x45,0x65,0x85,0x93,0x73,0x53,0x33,0x13,0x00,0x0a,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x00,0x13,0x11,0x31,0x50,0x6e,0x6b,0x50,0x50,0x50,
+	0x63,0x75,0x75,0x75,0x75,0x94,0xb4,0xd4,0xf4,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x4b,0x63,0x7a,0x92,0x8f,0x78,0x60,0x48,0x30,0x15,0x00,0x07,0x1b,
+	0x3b,0x5b,0x7b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x0c,0x1e,0x3c,0x5a,0x78,0x96,0x98,0x91,0x73,0x55,0x37,0x18,0x00,0x0d,0x19,0x37,0x55,0x73,0x92,0xa5,0x8d,0x6f,0x51,
+	0x36,0x55,0x73,0x91,0xa5,0x8d,0x6f,0x51,0x33,0x15,0x00,0x07,0x04,0x20,0x3c,0x57,0x72,0x8d,0x91,0x75,0x5a,0x3f,0x24,0x3a,0x55,0x70,0x8c,0x93,0x78,0x5c,0x41,0x26,
+	0x0a,0x00,0x08,0x1e,0x3e,0x5e,0x7e,0x9c,0x7c,0x5c,0x3c,0x1c,0x00,0x07,0x0d,0x2d,0x4d,0x6d,0x8d,0x9c,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x73,0x53,
+	0x33,0x13,0x00,0x0a,0x06,0x22,0x3e,0x5b,0x77,0x93,0x8a,0x6d,0x51,0x35,0x19,0x00,0x02,0x04,0x22,0x40,0x5e,0x7d,0x9b,0x81,0x63,0x44,0x26,0x08,0x00,0x01,0x0c,0x2b,
+	0x49,0x67,0x85,0x96,0x78,0x5a,0x3c,0x1e,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x08,0x05,
+	0x25,0x45,0x65,0x85,0x90,0x75,0x55,0x35,0x15,0x0b,0x26,0x41,0x5c,0x77,0x90,0x90,0x78,0x58,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x90,0x90,0x90,0x90,0x9b,
+	0xb8,0xd7,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x71,0x51,0x31,0x11,
+	0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x90,0x74,0x54,0x34,0x14,0x02,0x22,0x42,0x62,0x82,0x90,0x76,0x56,0x36,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x90,0x75,0x55,
+	0x4c,0x65,0x7d,0x90,0x8c,0x74,0x5a,0x3c,0x1d,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x90,0x74,0x54,0x34,0x14,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x90,0x74,0x54,0x34,
+	0x14,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0xad,0xcd,0xed,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x90,0x71,0x51,0x31,0x40,0x58,0x6f,0x87,0x90,
+	0x83,0x6b,0x4f,0x30,0x11,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x90,0x90,0x90,0x90,0x90,0x90,0x8e,0x6e,0x4e,0x2e,0x0e,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x90,0x74,
+	0x54,0x34,0x14,0x00,0x06,0x1b,0x3b,0x5b,0x7b,0x8e,0x7f,0x5f,0x3f,0x1f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x90,0x73,0x53,0x33,0x13,0x00,0x0a,0x05,0x25,0x45,0x65,
+	0x85,0x90,0x75,0x55,0x35,0x15,0x00,0x13,0x10,0x30,0x4f,0x6a,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x74,0x94,0xb4,0xd4,0xf4,0x00,0x01,0x05,0x25,0x45,0x65,0x85,
+	0x90,0x75,0x55,0x35,0x4d,0x65,0x7d,0x90,0x8d,0x75,0x5c,0x3e,0x1f,0x00,0x07,0x1b,0x3b,0x5b,0x7b,0x90,0x7e,0x5e,0x3e,0x1e,0x00,0x0c,0x13,0x31,0x50,0x6e,0x8c,0x8f,
+	0x87,0x68,0x4a,0x2c,0x0e,0x00,0x0d,0x0e,0x2c,0x4a,0x69,0x87,0x90,0x83,0x65,0x46,0x2c,0x4a,0x68,0x86,0x90,0x83,0x65,0x47,0x28,0x0a,0x00,0x07,0x0c,0x2c,0x4b,0x68,
+	0x83,0x90,0x80,0x65,0x49,0x2e,0x13,0x29,0x44,0x60,0x7b,0x90,0x88,0x6d,0x51,0x32,0x13,0x00,0x08,0x1e,0x3e,0x5e,0x7e,0x90,0x7c,0x5c,0x3c,0x1c,0x00,0x07,0x0d,0x2d,
+	0x4d,0x6d,0x8d,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x73,0x53,0x33,0x13,0x00,0x0b,0x13,0x2f,0x4c,0x68,0x84,0x90,0x7d,0x60,0x43,0x23,0x04,0x00,
+	0x01,0x0c,0x2c,0x4b,0x69,0x87,0x90,0x76,0x58,0x3a,0x1c,0x00,0x02,0x02,0x20,0x3e,0x5c,0x7b,0x90,0x83,0x65,0x46,0x27,0x08,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x90,
+	0x75,0x55,0x35,0x15,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x08,0x04,0x23,0x43,0x60,0x70,0x70,0x6c,0x52,0x33,0x14,0x00,0x01,0x15,0x30,0x4b,0x66,0x70,
+	0x70,0x6e,0x55,0x36,0x17,0x00,0x02,0x04,0x23,0x43,0x60,0x70,0x70,0x70,0x70,0x70,0x64,0x47,0x28,0x08,0x00,0x0a,0x04,0x23,0x43,0x60,0x70,0x70,0x70,0x70,0x70,0x70,
+	0x70,0x70,0x70,0x70,0x6a,0x4e,0x2f,0x10,0x00,0x02,0x04,0x23,0x43,0x60,0x70,0x70,0x6c,0x51,0x33,0x13,0x01,0x21,0x40,0x5e,0x70,0x70,0x6d,0x53,0x34,0x15,0x00,0x02,
+	0x04,0x23,0x43,0x60,0x70,0x70,0x6c,0x52,0x38,0x50,0x68,0x70,0x70,0x6f,0x5a,0x3c,0x1d,0x00,0x02,0x04,0x23,0x43,0x60,0x70,0x70,0x6c,0x51,0x33,0x13,0x00,0x02,0x04,
+	0x23,0x43,0x60,0x70,0x70,0x6c,0x51,0x33,0x13,0x00,0x02,0x0c,0x2c,0x4b,0x67,0x6a,0x4f,0x30,0x10,0x00,0x06,0x04,0x23,0x43,0x60,0x70,0x70,0x6a,0x4e,0x2f,0x2a,0x42,
+	0x5a,0x6f,0x70,0x70,0x6b,0x4f,0x30,0x11,0x00,0x02,0x04,0x23,0x43,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x4c,0x2d,0x0d,0x00,0x01,0x04,0x23,0x43,0x60,
+	0x70,0x70,0x6c,0x51,0x33,0x13,0x00,0x06,0x19,0x39,0x57,0x6d,0x6e,0x6e,0x5a,0x3c,0x1d,0x00,0x02,0x04,0x23,0x43,0x60,0x70,0x70,0x6b,0x51,0x32,0x12,0x00,0x0a,0x04,
+	0x23,0x43,0x60,0x70,0x70,0x6c,0x52,0x33,0x14,0x00,0x13,0x10,0x30,0x4f,0x6a,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x65,0x48,0x29,0x0a,0x00,0x01,0x04,0x23,
+	0x43,0x60,0x70,0x70,0x6c,0x52,0x33,0x38,0x50,0x67,0x70,0x70,0x70,0x5c,0x3e,0x1f,0x00,0x07,0x1a,0x3a,0x58,0x6f,0x70,0x6f,0x5a,0x3c,0x1c,0x00,0x0c,0x09,0x27,0x45,
+	0x62,0x6f,0x6f,0x6f,0x5d,0x40,0x22,0x03,0x00,0x0d,0x03,0x22,0x40,0x5d,0x70,0x70,0x6f,0x5a,0x3c,0x21,0x3f,0x5d,0x70,0x70,0x6f,0x5a,0x3c,0x1e,0x00,0x08,0x0c,0x2c,
+	0x4b,0x67,0x70,0x70,0x6d,0x54,0x38,0x1d,0x02,0x18,0x34,0x4f,0x69,0x70,0x70,0x6c,0x51,0x32,0x13,0x00,0x08,0x1c,0x3c,0x5a,0x6f,0x70,0x6f,0x59,0x3a,0x1b,0x00,0x07,
+	0x0c,0x2c,0x4b,0x67,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x6b,0x51,0x32,0x12,0x00,0x0b,0x04,0x20,0x3c,0x59,0x6f,0x70,0x70,0x60,0x43,0x23,
+	0x04,0x00,0x01,0x0c,0x2c,0x4b,0x67,0x70,0x70,0x69,0x4d,0x2f,0x11,0x00,0x03,0x15,0x34,0x52,0x6c,0x70,0x70,0x64,0x46,0x27,0x08,0x00,0x01,0x04,0x23,0x43,0x60,0x70,
+	0x70,0x6c,0x52,0x33,0x14,0x2b,0x4a,0x67,0x70,0x70,0x67,0x4a,0x2b,0x0c,0x00,0x09,0x19,0x34,0x49,0x50,0x50,0x4e,0x3f,0x27,0x0b,0x00,0x01,0x04,0x1f,0x39,0x4c,0x50,
+	0x50,0x4f,0x41,0x29,0x0d,0x00,0x03,0x19,0x34,0x49,0x50,0x50,0x50,0x50,0x50,0x4b,0x37,0x1d,0x00,0x0c,0x19,0x34,0x49,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,
+	0x50,0x4d,0x3d,0x23,0x07,0x00,0x03,0x19,0x34,0x49,0x50,0x50,0x4e,0x3f,0x26,0x0a,0x00,0x01,0x17,0x32,0x47,0x50,0x50,0x4f,0x40,0x28,0x0c,0x00,0x03,0x19,0x34,0x49,
+	0x50,0x50,0x4e,0x3f,0x27,0x3b,0x4d,0x50,0x50,0x4f,0x45,0x2e,0x13,0x00,0x03,0x19,0x34,0x49,0x50,0x50,0x4e,0x3f,0x26,0x0a,0x00,0x03,0x19,0x34,0x49,0x50,0x50,0x4e,
+	0x3f,0x26,0x0a,0x00,0x02,0x04,0x20,0x3a,0x4c,0x4e,0x3d,0x24,0x08,0x00,0x07,0x19,0x34,0x49,0x50,0x50,0x4d,0x3d,0x23,0x15,0x2d,0x43,0x4f,0x50,0x50,0x4e,0x3d,0x24,
+	0x08,0x00,0x03,0x19,0x34,0x49,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x4c,0x3b,0x21,0x04,0x00,0x02,0x19,0x34,0x49,0x50,0x50,0x4e,0x3f,0x26,0x0a,0x00,0x06,0x0f,
+	0x2b,0x42,0x4e,0x4e,0x4e,0x44,0x2e,0x13,0x00,0x03,0x19,0x34,0x49,0x50,0x50,0x4e,0x3e,0x25,0x09,0x00,0x0b,0x19,0x34,0x49,0x50,0x50,0x4e,0x3f,0x27,0x0b,0x00,0x13,
+	0x07,0x24,0x3d,0x4d,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x4b,0x38,0x1e,0x01,0x00,0x02,0x19,0x34,0x49,0x50,0x50,0x4e,0x3f,0x27,0x22,0x3a,0x4c,0x50,0x50,
+	0x50,0x46,0x30,0x15,0x00,0x07,0x11,0x2c,0x43,0x4f,0x50,0x4f,0x45,0x2e,0x12,0x00,0x0d,0x1b,0x35,0x49,0x4f,0x4f,0x4f,0x46,0x31,0x16,0x00,0x0f,0x16,0x31,0x47,0x50,
+	0x50,0x4f,0x45,0x2e,0x15,0x30,0x46,0x50,0x50,0x4f,0x45,0x2e,0x12,0x00,0x08,0x04,0x20,0x3a,0x4c,0x50,0x50,0x4f,0x40,0x28,0x0c,0x00,0x01,0x08,0x23,0x3c,0x4d,0x50,
+	0x50,0x4e,0x3f,0x26,0x0a,0x00,0x08,0x12,0x2e,0x45,0x4f,0x50,0x4f,0x44,0x2d,0x11,0x00,0x07,0x04,0x20,0x3a,0x4c,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,
+	0x50,0x50,0x4e,0x3e,0x25,0x09,0x00,0x0c,0x11,0x2d,0x44,0x4f,0x50,0x50,0x49,0x34,0x19,0x00,0x02,0x04,0x20,0x3a,0x4c,0x50,0x50,0x4d,0x3c,0x23,0x06,0x00,0x03,0x0a,
+	0x27,0x3f,0x4e,0x50,0x50,0x4a,0x37,0x1c,0x00,0x03,0x19,0x34,0x49,0x50,0x50,0x4e,0x3f,0x27,0x0b,0x20,0x3a,0x4c,0x50,0x50,0x4c,0x3a,0x20,0x03,0x00,0x09,0x07,0x1c,
+	0x2b,0x30,0x30,0x2f,0x25,0x12,0x00,0x03,0x0c,0x20,0x2d,0x30,0x30,0x2f,0x26,0x14,0x00,0x04,0x07,0x1c,0x2b,0x30,0x30,0x30,0x30,0x30,0x2d,0x1f,0x0a,0x00,0x0c,0x07,
+	0x1c,0x2b,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2e,0x23,0x0f,0x00,0x04,0x07,0x1c,0x2b,0x30,0x30,0x2f,0x25,0x12,0x00,0x02,0x05,0x1b,0x2a,0x30,0x30,
+	0x2f,0x25,0x13,0x00,0x04,0x07,0x1c,0x2b,0x30,0x30,0x2f,0x25,0x12,0x22,0x2e,0x30,0x30,0x2f,0x29,0x18,0x01,0x00,0x03,0x07,0x1c,0x2b,0x30,0x30,0x2f,0x25,0x12,0x00,
+	0x04,0x07,0x1c,0x2b,0x30,0x30,0x2f,0x25,0x12,0x00,0x04,0x0d,0x21,0x2d,0x2e,0x23,0x10,0x00,0x08,0x07,0x1c,0x2b,0x30,0x30,0x2e,0x23,0x0f,0x00,0x01,0x16,0x28,0x2f,
+	0x30,0x30,0x2e,0x23,0x10,0x00,0x04,0x07,0x1c,0x2b,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2e,0x22,0x0d,0x00,0x03,0x07,0x1c,0x2b,0x30,0x30,0x2f,0x25,0x12,0x00,
+	0x08,0x15,0x26,0x2e,0x2e,0x2e,0x28,0x17,0x01,0x00,0x03,0x07,0x1c,0x2b,0x30,0x30,0x2f,0x24,0x11,0x00,0x0c,0x07,0x1c,0x2b,0x30,0x30,0x2f,0x25,0x12,0x00,0x15,0x10,
+	0x23,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2d,0x20,0x0b,0x00,0x03,0x07,0x1c,0x2b,0x30,0x30,0x2f,0x25,0x12,0x0d,0x21,0x2d,0x30,0x30,0x30,0x2a,0x19,
+	0x03,0x00,0x08,0x16,0x28,0x2f,0x2f,0x2f,0x29,0x18,0x01,0x00,0x0d,0x08,0x1d,0x2b,0x2f,0x2f,0x2f,0x29,0x1a,0x04,0x00,0x0f,0x04,0x1a,0x2a,0x30,0x30,0x2f,0x29,0x18,
+	0x03,0x1a,0x2a,0x30,0x30,0x2f,0x29,0x18,0x01,0x00,0x09,0x0d,0x21,0x2d,0x30,0x30,0x2f,0x25,0x13,0x00,0x03,0x0f,0x23,0x2e,0x30,0x30,0x2f,0x24,0x11,0x00,0x09,0x01,
+	0x18,0x29,0x2f,0x30,0x2f,0x28,0x17,0x00,0x09,0x0d,0x21,0x2d,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2f,0x24,0x11,0x00,0x0e,0x17,0x28,0x2f,
+	0x30,0x30,0x2b,0x1c,0x07,0x00,0x03,0x0d,0x21,0x2d,0x30,0x30,0x2e,0x22,0x0f,0x00,0x05,0x12,0x25,0x2f,0x30,0x30,0x2c,0x1f,0x09,0x00,0x03,0x07,0x1c,0x2b,0x30,0x30,
+	0x2f,0x25,0x12,0x00,0x01,0x0d,0x21,0x2d,0x30,0x30,0x2d,0x21,0x0d,0x00,0x0b,0x01,0x0c,0x10,0x10,0x0f,0x08,0x00,0x05,0x04,0x0e,0x10,0x10,0x0f,0x09,0x00,0x06,0x01,
+	0x0c,0x10,0x10,0x10,0x10,0x10,0x0d,0x03,0x00,0x0e,0x01,0x0c,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x0f,0x06,0x00,0x06,0x01,0x0c,0x10,0x10,0x0f,0x07,
+	0x00,0x05,0x0c,0x10,0x10,0x0f,0x08,0x00,0x06,0x01,0x0c,0x10,0x10,0x0f,0x08,0x00,0x01,0x05,0x0e,0x0f,0x0f,0x0f,0x0b,0x00,0x06,0x01,0x0c,0x10,0x10,0x0f,0x07,0x00,
+	0x06,0x01,0x0c,0x10,0x10,0x0f,0x07,0x00,0x06,0x05,0x0e,0x0f,0x06,0x00,0x0a,0x01,0x0c,0x10,0x10,0x0f,0x06,0x00,0x03,0x0a,0x0f,0x10,0x10,0x0f,0x07,0x00,0x06,0x01,
+	0x0c,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x0e,0x05,0x00,0x05,0x01,0x0c,0x10,0x10,0x0f,0x07,0x00,0x0a,0x08,0x0e,0x0e,0x0e,0x09,0x00,0x06,0x01,0x0c,0x10,0x10,
+	0x0f,0x07,0x00,0x0e,0x01,0x0c,0x10,0x10,0x0f,0x08,0x00,0x17,0x06,0x0f,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x0e,0x04,0x00,0x05,0x01,0x0c,0x10,0x10,0x0f,
+	0x08,0x00,0x02,0x05,0x0e,0x10,0x10,0x10,0x0b,0x00,0x0b,0x0a,0x0f,0x10,0x0f,0x0a,0x00,0x10,0x01,0x0c,0x0f,0x0f,0x0f,0x0b,0x00,0x13,0x0c,0x10,0x10,0x0f,0x0a,0x00,
+	0x03,0x0b,0x10,0x10,0x0f,0x0a,0x00,0x0c,0x05,0x0e,0x10,0x10,0x0f,0x08,0x00,0x05,0x06,0x0e,0x10,0x10,0x0f,0x07,0x00,0x0c,0x0a,0x0f,0x10,0x0f,0x0a,0x00,0x0b,0x05,
+	0x0e,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x0f,0x07,0x00,0x10,0x0a,0x0f,0x10,0x10,0x0c,0x01,0x00,0x05,0x05,0x0e,0x10,0x10,0x0e,0x06,0x00,
+	0x07,0x08,0x0f,0x0f,0x0f,0x0d,0x03,0x00,0x05,0x01,0x0c,0x10,0x10,0x0f,0x08,0x00,0x03,0x05,0x0e,0x10,0x10,0x0e,0x05,0x00,0xff,0x00,0xff,0x00,0x11,0x04,0x07,0x07,
+	0x06,0x00,0x0a,0x04,0x07,0x07,0x07,0x01,0x00,0x13,0x05,0x08,0x08,0x08,0x01,0x00,0x07,0x08,0x0a,0x0a,0x09,0x02,0x00,0x05,0x01,0x09,0x0a,0x0a,0x08,0x00,0x07,0x05,
+	0x08,0x08,0x09,0x09,0x09,0x09,0x05,0x00,0x0e,0x04,0x09,0x04,0x00,0x0e,0x04,0x04,0x04,0x00,0x0f,0x03,0x0a,0x08,0x00,0x02,0x0b,0x0e,0x09,0x00,0x20,0x04,0x05,0x00,
+	0x4f,0x05,0x03,0x00,0xff,0x00,0x03,0x02,0x16,0x24,0x27,0x27,0x26,0x1d,0x0b,0x00,0x06,0x01,0x15,0x23,0x27,0x27,0x27,0x1e,0x0d,0x00,0x07,0x09,0x10,0x0f,0x04,0x00,
+	0x05,0x01,0x16,0x24,0x28,0x28,0x27,0x1f,0x0e,0x00,0x04,0x09,0x1c,0x28,0x2a,0x2a,0x29,0x1f,0x0d,0x00,0x03,0x0c,0x1f,0x29,0x2a,0x2a,0x28,0x1c,0x09,0x00,0x03,0x01,
+	0x16,0x24,0x28,0x28,0x29,0x29,0x29,0x29,0x23,0x14,0x00,0x0c,0x14,0x23,0x29,0x23,0x14,0x00,0x0b,0x0d,0x1d,0x24,0x24,0x24,0x1f,0x10,0x00,0x0b,0x07,0x11,0x20,0x29,
+	0x27,0x1a,0x1a,0x29,0x2e,0x27,0x16,0x03,0x00,0x0c,0x02,0x11,0x19,0x17,0x0c,0x00,0x0b,0x06,0x19,0x24,0x25,0x1b,0x0e,0x02,0x00,0x18,0x07,0x17,0x1f,0x1d,0x11,0x00,
+	0x0a,0x0a,0x17,0x1a,0x1a,0x1a,0x12,0x02,0x00,0x02,0x0e,0x18,0x1a,0x1a,0x18,0x0e,0x00,0x13,0x04,0x11,0x1d,0x25,0x23,0x16,0x02,0x00,0x07,0x0d,0x1a,0x1d,0x17,0x08,
+	0x00,0x0c,0x01,0x11,0x18,0x16,0x0b,0x00,0x01,0x09,0x0f,0x0f,0x0f,0x0b,0x00,0x01,0x08,0x15,0x19,0x14,0x05,0x00,0x12,0x01,0x11,0x18,0x16,0x0b,0x00,0x01,0x09,0x0f,
+	0x0f,0x0f,0x0b,0x00,0x0c,0x02,0x11,0x19,0x17,0x0c,0x00,0x10,0x04,0x14,0x1c,0x1a,0x0f,0x00,0x0d,0x05,0x12,0x18,0x13,0x06,0x04,0x14,0x1c,0x1a,0x0f,0x00,0x01,0x0c,
+	0x16,0x17,0x0e,0x00,0x07,0x0e,0x19,0x1a,0x1a,0x19,0x10,0x00,0x01,0x08,0x15,0x1a,0x1a,0x1a,0x15,0x07,0x00,0x04,0x0f,0x19,0x1a,0x1a,0x19,0x0f,0x00,0x05,0x0d,0x17,
+	0x18,0x18,0x17,0x0e,0x00,0x04,0x05,0x13,0x18,0x18,0x18,0x14,0x07,0x00,0x05,0x01,0x0c,0x0f,0x0f,0x0f,0x07,0x14,0x1a,0x16,0x0a,0x00,0x0a,0x0b,0x15,0x17,0x17,0x16,
+	0x0f,0x00,0x02,0x08,0x14,0x17,0x17,0x17,0x12,0x04,0x00,0x05,0x0b,0x15,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x15,0x0a,0x00,0x07,0x16,0x2f,0x42,
+	0x47,0x47,0x46,0x38,0x21,0x05,0x00,0x05,0x15,0x2e,0x41,0x47,0x47,0x46,0x3a,0x24,0x09,0x00,0x05,0x14,0x26,0x30,0x2e,0x20,0x0b,0x00,0x04,0x15,0x2f,0x42,0x48,0x48,
+	0x47,0x3b,0x25,0x0a,0x00,0x02,0x01,0x1d,0x36,0x47,0x4a,0x4a,0x48,0x3a,0x22,0x07,0x00,0x01,0x06,0x22,0x39,0x48,0x4a,0x4a,0x47,0x36,0x1e,0x02,0x00,0x02,0x15,0x2f,
+	0x42,0x48,0x48,0x49,0x49,0x49,0x49,0x41,0x2c,0x12,0x00,0x0a,0x12,0x2b,0x40,0x49,0x40,0x2b,0x13,0x00,0x09,0x0a,0x24,0x39,0x44,0x44,0x44,0x3c,0x28,0x0f,0x00,0x09,
+	0x0e,0x23,0x30,0x3c,0x49,0x45,0x34,0x32,0x46,0x4e,0x43,0x30,0x1c,0x06,0x00,0x0a,0x01,0x1a,0x2e,0x39,0x36,0x26,0x10,0x00,0x0a,0x1b,0x33,0x43,0x44,0x38,0x2c,0x1f,
+	0x13,0x06,0x00,0x15,0x05,0x1f,0x34,0x3f,0x3b,0x2b,0x14,0x02,0x00,0x07,0x0d,0x25,0x35,0x3a,0x3a,0x39,0x2e,0x1a,0x00,0x01,0x13,0x29,0x38,0x3a,0x3a,0x38,0x2a,0x14,
+	0x00,0x10,0x09,0x15,0x22,0x2e,0x3b,0x45,0x41,0x2f,0x16,0x00,0x06,0x0f,0x27,0x38,0x3d,0x34,0x20,0x07,0x00,0x0a,0x01,0x1a,0x2d,0x38,0x35,0x26,0x15,0x26,0x2f,0x2f,
+	0x2f,0x29,0x19,0x22,0x33,0x39,0x31,0x1f,0x06,0x00,0x10,0x01,0x1a,0x2d,0x38,0x35,0x26,0x15,0x26,0x2f,0x2f,0x2f,0x29,0x19,0x03,0x00,0x09,0x01,0x1a,0x2e,0x39,0x36,
+	0x26,0x10,0x00,0x0e,0x02,0x1c,0x31,0x3c,0x39,0x2a,0x13,0x00,0x0b,0x08,0x1f,0x30,0x38,0x31,0x20,0x1c,0x31,0x3c,0x39,0x2a,0x13,0x27,0x35,0x36,0x2b,0x16,0x00,0x05,
+	0x14,0x2a,0x38,0x3a,0x3a,0x39,0x2c,0x17,0x22,0x33,0x3a,0x3a,0x3a,0x33,0x20,0x08,0x00,0x02,0x15,0x2b,0x38,0x3a,0x3a,0x38,0x2a,0x15,0x00,0x03,0x13,0x29,0x36,0x38,
+	0x38,0x37,0x2a,0x15,0x00,0x02,0x06,0x1e,0x31,0x38,0x38,0x38,0x32,0x20,0x09,0x00,0x03,0x06,0x1c,0x2b,0x2f,0x2f,0x2e,0x24,0x32,0x3a,0x35,0x24,0x0c,0x00,0x08,0x12,
+	0x27,0x35,0x37,0x37,0x36,0x2c,0x18,0x0c,0x23,0x32,0x37,0x37,0x37,0x30,0x1e,0x06,0x00,0x03,0x12,0x27,0x35,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,
+	0x34,0x26,0x10,0x00,0x05,0x04,0x23,0x41,0x5d,0x67,0x67,0x64,0x4d,0x2f,0x11,0x00,0x04,0x02,0x22,0x40,0x5b,0x67,0x67,0x66,0x51,0x34,0x15,0x00,0x04,0x14,0x28,0x41,
+	0x50,0x4c,0x38,0x1e,0x0b,0x00,0x02,0x03,0x22,0x40,0x5c,0x68,0x68,0x67,0x51,0x34,0x15,0x00,0x02,0x0b,0x2a,0x49,0x63,0x6a,0x6a,0x66,0x4e,0x31,0x15,0x00,0x01,0x14,
+	0x31,0x4e,0x66,0x6a,0x6a,0x63,0x49,0x2b,0x0c,0x00,0x01,0x03,0x22,0x40,0x5c,0x68,0x68,0x69,0x69,0x69,0x69,0x59,0x3d,0x1e,0x00,0x09,0x13,0x2b,0x3d,0x58,0x69,0x58,
+	0x3e,0x2c,0x14,0x00,0x08,0x16,0x35,0x51,0x63,0x64,0x64,0x55,0x3a,0x1c,0x00,0x08,0x09,0x21,0x3b,0x4f,0x51,0x68,0x60,0x53,0x50,0x5e,0x6e,0x5d,0x49,0x33,0x18,0x00,
+	0x0a,0x10,0x2d,0x47,0x58,0x53,0x3d,0x21,0x03,0x00,0x08,0x0a,0x29,0x47,0x60,0x62,0x56,0x49,0x3d,0x30,0x24,0x17,0x0b,0x00,0x13,0x12,0x30,0x4c,0x5e,0x58,0x40,0x23,
+	0x22,0x1e,0x11,0x00,0x05,0x1d,0x3a,0x52,0x5a,0x5a,0x59,0x47,0x2c,0x0f,0x24,0x40,0x55,0x5a,0x5a,0x56,0x41,0x25,0x07,0x00,0x0c,0x01,0x0d,0x1a,0x26,0x33,0x3f,0x4c,
+	0x58,0x65,0x5c,0x42,0x24,0x05,0x00,0x04,0x10,0x26,0x3b,0x54,0x5d,0x4e,0x33,0x21,0x09,0x00,0x09,0x0f,0x2d,0x47,0x57,0x52,0x3c,0x2a,0x42,0x4f,0x4f,0x4f,0x46,0x30,
+	0x37,0x4f,0x59,0x4c,0x33,0x16,0x00,0x10,0x0f,0x2d,0x47,0x57,0x52,0x3c,0x2a,0x42,0x4f,0x4f,0x4f,0x46,0x30,0x15,0x00,0x09,0x10,0x2d,0x47,0x58,0x53,0x3d,0x21,0x05,
+	0x0d,0x0c,0x02,0x00,0x0a,0x10,0x2e,0x49,0x5b,0x56,0x3f,0x23,0x05,0x00,0x09,0x07,0x1e,0x35,0x4c,0x58,0x4d,0x37,0x2e,0x49,0x5b,0x56,0x3f,0x29,0x3f,0x53,0x56,0x43,
+	0x2d,0x16,0x00,0x03,0x07,0x25,0x41,0x56,0x5a,0x5a,0x57,0x44,0x28,0x36,0x4f,0x5a,0x5a,0x5a,0x4d,0x34,0x17,0x00,0x01,0x09,0x27,0x42,0x57,0x5a,0x5a,0x56,0x42,0x26,
+	0x08,0x00,0x01,0x07,0x25,0x40,0x54,0x58,0x58,0x55,0x42,0x27,0x09,0x00,0x01,0x16,0x33,0x4c,0x58,0x58,0x58,0x4d,0x35,0x18,0x00,0x03,0x19,0x33,0x48,0x4f,0x4f,0x4e,
+	0x3f,0x4c,0x5a,0x51,0x39,0x1c,0x00,0x07,0x06,0x24,0x3f,0x53,0x57,0x57,0x56,0x45,0x2b,0x1e,0x39,0x4f,0x57,0x57,0x57,0x4b,0x33,0x16,0x00,0x02,0x06,0x24,0x3f,0x53,
+	0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x52,0x3d,0x22,0x04,0x00,0x04,0x07,0x27,0x47,0x67,0x87,0x87,0x73,0x53,0x33,0x13,0x00,0x04,0x05,0x25,0x45,
+	0x65,0x85,0x87,0x78,0x58,0x38,0x18,0x00,0x03,0x0f,0x2a,0x40,0x53,0x6e,0x65,0x49,0x38,0x1f,0x03,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x88,0x78,0x58,0x38,0x18,0x00,
+	0x02,0x0d,0x2d,0x4c,0x6b,0x88,0x8a,0x79,0x5c,0x3f,0x23,0x06,0x22,0x3f,0x5c,0x79,0x8a,0x88,0x6b,0x4d,0x2d,0x0d,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x88,0x89,0x89,
+	0x89,0x89,0xa0,0xbf,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x01,0x02,0x20,0x3e,0x59,0x63,0x76,0x62,0x59,0x3f,0x22,0x03,0x00,0x07,0x1a,0x3a,0x5a,0x7a,0x84,
+	0x80,0x60,0x40,0x20,0x0d,0x0d,0x04,0x00,0x05,0x19,0x35,0x4c,0x68,0x6e,0x71,0x67,0x6f,0x69,0x65,0x76,0x89,0xa0,0xbe,0xdd,0xfd,0xff,0x00,0x08,0x16,0x36,0x56,0x74,
+	0x68,0x48,0x28,0x09,0x00,0x08,0x0d,0x2d,0x4d,0x6d,0x80,0x73,0x67,0x5a,0x4e,0x41,0x35,0x28,0x1c,0x0f,0x03,0x00,0x0d,0x05,0x0f,0x10,0x17,0x37,0x57,0x77,0x69,0x49,
+	0x38,0x42,0x3c,0x2a,0x12,0x00,0x03,0x05,0x25,0x45,0x64,0x7a,0x7a,0x74,0x55,0x35,0x15,0x2c,0x4c,0x6b,0x7a,0x7a,0x6c,0x4d,0x2d,0x0d,0x00,0x0a,0x05,0x12,0x1e,0x2b,
+	0x37,0x44,0x50,0x5d,0x69,0x76,0x82,0x67,0x47,0x27,0x07,0x00,0x03,0x03,0x21,0x3d,0x52,0x64,0x7b,0x5b,0x4e,0x36,0x19,0x00,0x09,0x16,0x36,0x56,0x74,0x68,0x48,0x37,
+	0x56,0x6e,0x6f,0x6f,0x5c,0x3e,0x42,0x62,0x79,0x5c,0x3c,0x1d,0x00,0x10,0x16,0x36,0x56,0x74,0x68,0x48,0x37,0x56,0x6e,0x6f,0x6f,0x5c,0x3e,0x1f,0x00,0x09,0x16,0x36,
+	0x56,0x74,0x68,0x48,0x28,0x22,0x2c,0x2b,0x1f,0x0b,0x00,0x09,0x15,0x35,0x55,0x75,0x69,0x49,0x29,0x09,0x00,0x09,0x1a,0x35,0x4b,0x62,0x78,0x64,0x4d,0x36,0x55,0x75,
+	0x69,0x49,0x3f,0x56,0x6c,0x71,0x5a,0x43,0x2c,0x11,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x7a,0x7a,0x70,0x52,0x34,0x40,0x60,0x7a,0x7a,0x7a,0x5e,0x41,0x23,0x05,0x15,0x33,
+	0x51,0x6e,0x7a,0x7a,0x6d,0x4e,0x2e,0x0e,0x00,0x01,0x0d,0x2d,0x4d,0x6c,0x78,0x78,0x6e,0x51,0x33,0x15,0x04,0x21,0x3f,0x5d,0x78,0x78,0x78,0x5f,0x40,0x20,0x00,0x02,
+	0x04,0x23,0x43,0x60,0x6f,0x6f,0x6c,0x51,0x5b,0x79,0x63,0x43,0x23,0x03,0x00,0x06,0x0d,0x2d,0x4d,0x6b,0x77,0x77,0x73,0x57,0x3c,0x2e,0x4a,0x65,0x77,0x77,0x77,0x5d,
+	0x3e,0x1e,0x00,0x02,0x0d,0x2d,0x4d,0x6b,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x69,0x4b,0x2b,0x0b,0x00,0x04,0x0e,0x27,0x47,0x67,0x87,0x93,0x73,
+	0x53,0x33,0x14,0x05,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x1a,0x39,0x57,0x6b,0x6c,0x66,0x65,0x4b,0x2c,0x0d,0x00,0x01,0x05,0x25,
+	0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x02,0x06,0x23,0x40,0x5d,0x7a,0x96,0x87,0x6a,0x4d,0x31,0x14,0x31,0x4d,0x6a,0x87,0x97,0x7a,0x5d,0x40,0x24,0x06,0x00,
+	0x01,0x05,0x25,0x45,0x65,0x85,0x9b,0x91,0x91,0x91,0x91,0xa3,0xc1,0xe0,0xf7,0xf3,0xf8,0xff,0xff,0xff,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x79,0x5e,0x78,0x66,0x46,
+	0x26,0x06,0x00,0x07,0x1a,0x3a,0x5a,0x7a,0x9a,0x80,0x60,0x40,0x22,0x2d,0x2c,0x20,0x0c,0x00,0x03,0x06,0x22,0x42,0x61,0x75,0x69,0x76,0x67,0x68,0x68,0x73,0x5c,0x6e,
+	0x5e,0x41,0x22,0x02,0x00,0x09,0x13,0x32,0x4f,0x64,0x5d,0x43,0x25,0x06,0x00,0x08,0x0d,0x2d,0x4d,0x6d,0x8d,0x91,0x84,0x78,0x6b,0x5f,0x52,0x46,0x39,0x2d,0x20,0x14,
+	0x08,0x00,0x0a,0x0c,0x21,0x2e,0x2f,0x28,0x32,0x4f,0x64,0x5d,0x43,0x50,0x61,0x57,0x3d,0x20,0x01,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,
+	0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x08,0x0a,0x16,0x23,0x2f,0x3c,0x48,0x55,0x61,0x6e,0x7a,0x87,0x93,0x87,0x67,0x47,0x27,0x07,0x00,0x03,0x09,0x29,0x49,
+	0x68,0x73,0x61,0x78,0x61,0x41,0x21,0x01,0x00,0x08,0x13,0x32,0x4f,0x65,0x5e,0x43,0x39,0x59,0x79,0x8f,0x81,0x61,0x41,0x3d,0x59,0x66,0x54,0x38,0x19,0x00,0x10,0x13,
+	0x32,0x4f,0x65,0x5e,0x43,0x39,0x59,0x79,0x8f,0x81,0x61,0x41,0x21,0x01,0x00,0x08,0x13,0x32,0x4f,0x64,0x5d,0x43,0x2e,0x3e,0x4c,0x4a,0x38,0x1f,0x02,0x00,0x08,0x12,
+	0x30,0x4d,0x61,0x5b,0x42,0x25,0x06,0x00,0x08,0x06,0x26,0x45,0x62,0x79,0x90,0x7b,0x63,0x46,0x4d,0x61,0x5b,0x42,0x51,0x6c,0x83,0x87,0x71,0x58,0x3a,0x1b,0x00,0x02,
+	0x0a,0x29,0x47,0x65,0x83,0x99,0x7c,0x5e,0x40,0x3b,0x59,0x76,0x94,0x88,0x6a,0x4c,0x2f,0x11,0x21,0x3e,0x5c,0x7a,0x98,0x83,0x66,0x48,0x2a,0x0b,0x00,0x01,0x0b,0x2a,
+	0x48,0x65,0x83,0x98,0x7a,0x5d,0x3f,0x21,0x10,0x2d,0x4b,0x69,0x87,0x95,0x77,0x59,0x3b,0x1d,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x8f,0x74,0x54,0x53,0x65,0x59,0x3d,
+	0x1f,0x00,0x07,0x0b,0x2a,0x48,0x64,0x7f,0x97,0x84,0x68,0x4d,0x3f,0x5a,0x76,0x91,0x8e,0x72,0x57,0x3a,0x1c,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0x97,0x97,0x97,0x97,
+	0x97,0x97,0x97,0x97,0x97,0x8b,0x6b,0x4b,0x2b,0x0b,0x00,0x03,0x14,0x2a,0x38,0x47,0x67,0x87,0x93,0x73,0x53,0x3a,0x31,0x1d,0x05,0x00,0x02,0x05,0x25,0x45,0x65,0x85,
+	0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x1c,0x3b,0x5a,0x73,0x63,0x6c,0x6b,0x4d,0x2e,0x0e,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x15,
+	0x32,0x4f,0x6b,0x88,0x95,0x78,0x5c,0x3f,0x22,0x3f,0x5b,0x78,0x95,0x88,0x6c,0x4f,0x32,0x16,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x71,0x71,0x71,0x5d,0x3f,
+	0x2c,0x27,0x2c,0x25,0x15,0x00,0x05,0x1e,0x3b,0x53,0x5f,0x7e,0x60,0x54,0x3c,0x1f,0x01,0x00,0x07,0x17,0x36,0x53,0x67,0x5e,0x66,0x57,0x3b,0x3e,0x4c,0x4b,0x39,0x20,
+	0x03,0x00,0x02,0x19,0x33,0x48,0x5c,0x71,0x85,0x99,0x98,0x8e,0xa0,0x88,0xa1,0xb0,0xb8,0xcd,0xe8,0xff,0xff,0x00,0x08,0x16,0x36,0x56,0x76,0x69,0x49,0x29,0x09,0x00,
+	0x08,0x0d,0x2d,0x4d,0x6c,0x7e,0x8b,0x97,0x95,0x89,0x7c,0x70,0x63,0x57,0x4a,0x3e,0x31,0x25,0x19,0x0c,0x00,0x07,0x02,0x1f,0x39,0x4c,0x4f,0x48,0x47,0x56,0x75,0x68,
+	0x5d,0x60,0x7a,0x64,0x44,0x26,0x0b,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x05,0x02,0x0e,
+	0x1b,0x27,0x34,0x40,0x4d,0x59,0x66,0x72,0x7f,0x8b,0x98,0x95,0x89,0x7c,0x66,0x47,0x27,0x07,0x00,0x03,0x07,0x26,0x44,0x5f,0x65,0x72,0x67,0x59,0x3d,0x1e,0x00,0x09,
+	0x16,0x36,0x56,0x76,0x69,0x49,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x42,0x62,0x7d,0x5d,0x3d,0x1d,0x00,0x10,0x16,0x36,0x56,0x76,0x69,0x49,0x39,0x59,0x79,0x99,0x81,
+	0x61,0x41,0x21,0x01,0x00,0x08,0x16,0x36,0x56,0x76,0x69,0x49,0x49,0x59,0x69,0x65,0x49,0x2b,0x0b,0x00,0x08,0x15,0x35,0x55,0x75,0x69,0x49,0x29,0x09,0x00,0x08,0x07,
+	0x26,0x46,0x63,0x7b,0x92,0x93,0x9e,0x9b,0xaa,0x8a,0x96,0xaa,0x98,0x95,0x9a,0x8a,0x73,0x5a,0x3b,0x1b,0x00,0x03,0x1d,0x3b,0x59,0x77,0x94,0x87,0x6a,0x4c,0x2f,0x4d,
+	0x6a,0x88,0x94,0x76,0x58,0x3b,0x1d,0x2c,0x4a,0x68,0x86,0x95,0x78,0x5a,0x3c,0x1e,0x01,0x00,0x02,0x1e,0x3c,0x5a,0x77,0x95,0x86,0x68,0x4b,0x2d,0x1b,0x39,0x57,0x75,
+	0x92,0x89,0x6b,0x4d,0x30,0x12,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x96,0x8f,0xac,0xa3,0x83,0x9c,0xbc,0xdc,0xef,0xef,0xef,0xf9,0xff,0xff,0x00,0x01,0x01,0x1d,0x38,
+	0x53,0x6f,0x8a,0x94,0x79,0x5e,0x50,0x6b,0x86,0x98,0x7d,0x62,0x46,0x2b,0x10,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x84,0xa2,0x8b,
+	0x6b,0x4b,0x2b,0x0b,0x00,0x02,0x07,0x25,0x41,0x56,0x5a,0x67,0x87,0x93,0x73,0x5a,0x5a,0x4b,0x31,0x14,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,
+	0x00,0x03,0x13,0x2f,0x47,0x58,0x75,0x68,0x52,0x3e,0x24,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x07,0x24,0x41,0x5d,0x7a,0x97,
+	0x86,0x6a,0x4d,0x30,0x4d,0x69,0x86,0x97,0x7a,0x5e,0x41,0x24,0x07,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x51,0x51,0x48,0x41,0x4c,0x44,0x4c,0x42,0x2c,
+	0x11,0x00,0x04,0x1a,0x39,0x56,0x6a,0x6a,0x6a,0x57,0x39,0x1a,0x00,0x08,0x0c,0x26,0x3c,0x56,0x76,0x69,0x49,0x4a,0x5a,0x6a,0x66,0x4a,0x2c,0x0c,0x00,0x01,0x04,0x23,
+	0x43,0x60,0x6f,0x6f,0x6c,0x5b,0x5b,0x79,0x63,0x68,0x57,0x3b,0x2a,0x1b,0x05,0x00,0x06,0x01,0x12,0x1c,0x1d,0x1d,0x30,0x4b,0x5e,0x58,0x40,0x23,0x1d,0x1d,0x18,0x0b,
+	0x00,0x05,0x07,0x25,0x40,0x54,0x61,0x6d,0x7a,0x87,0x93,0x9a,0x8d,0x81,0x74,0x68,0x5b,0x4f,0x42,0x36,0x29,0x1d,0x11,0x04,0x00,0x04,0x0b,0x2a,0x49,0x67,0x6c,0x66,
+	0x63,0x49,0x59,0x53,0x6c,0x72,0x67,0x66,0x52,0x36,0x17,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,
+	0x00,0x03,0x06,0x13,0x1f,0x2c,0x38,0x45,0x51,0x5e,0x6a,0x77,0x83,0x90,0x9c,0x91,0x84,0x78,0x6b,0x5f,0x52,0x3b,0x1f,0x01,0x00,0x04,0x19,0x31,0x43,0x5e,0x6c,0x56,
+	0x3f,0x2c,0x12,0x00,0x06,0x01,0x01,0x00,0x01,0x12,0x30,0x4c,0x5f,0x59,0x41,0x39,0x58,0x74,0x64,0x68,0x59,0x3c,0x3b,0x54,0x60,0x50,0x36,0x1d,0x1d,0x1c,0x14,0x05,
+	0x00,0x09,0x01,0x01,0x00,0x01,0x12,0x30,0x4c,0x5f,0x59,0x41,0x39,0x58,0x74,0x64,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x04,0x01,0x02,0x02,0x01,0x12,0x30,0x4c,0x5f,0x59,
+	0x44,0x62,0x75,0x85,0x97,0xb4,0xd4,0xf3,0x00,0x04,0x02,0x02,0x03,0x02,0x10,0x2e,0x49,0x5b,0x56,0x3f,0x23,0x04,0x03,0x01,0x03,0x00,0x06,0x1c,0x37,0x4e,0x64,0x77,
+	0x5d,0x6c,0x70,0x51,0x5b,0x56,0x5c,0x77,0x61,0x68,0x73,0x5d,0x46,0x2e,0x12,0x00,0x03,0x12,0x2f,0x4d,0x6b,0x89,0x93,0x76,0x58,0x3a,0x41,0x5f,0x7c,0x9a,0x82,0x64,
+	0x46,0x29,0x38,0x56,0x74,0x92,0x8a,0x6c,0x4e,0x30,0x13,0x00,0x03,0x12,0x30,0x4e,0x6c,0x89,0x92,0x74,0x57,0x39,0x27,0x45,0x63,0x80,0x9b,0x7d,0x5f,0x42,0x24,0x06,
+	0x00,0x02,0x05,0x25,0x45,0x65,0x85,0xa5,0xab,0xbc,0xaf,0x9f,0xaa,0xc4,0xd0,0xcf,0xcf,0xd0,0xdd,0xf1,0xff,0x00,0x02,0x0c,0x27,0x43,0x5e,0x79,0x94,0x8a,0x6f,0x60,
+	0x7c,0x97,0x87,0x6c,0x51,0x36,0x1a,0x00,0x03,0x0a,0x29,0x46,0x5e,0x63,0x63,0x63,0x63,0x63,0x63,0x64,0x7c,0x94,0x8e,0x76,0x5e,0x44,0x27,0x08,0x00,0x02,0x0d,0x2d,
+	0x4d,0x6d,0x7a,0x7a,0x87,0x93,0x7a,0x7a,0x78,0x5a,0x3a,0x1a,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x14,0x34,0x53,0x73,0x7a,0x7a,
+	0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x04,0x16,0x33,0x4f,0x6c,0x89,0x94,0x78,0x5b,0x3e,0x5b,0x78,0x94,0x89,0x6c,
+	0x4f,0x33,0x16,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x31,0x39,0x57,0x6b,0x5d,0x6c,0x58,0x3b,0x1c,0x00,0x04,0x1c,0x3c,0x5c,0x7c,0x8a,0x7d,0x5d,
+	0x3d,0x1d,0x00,0x05,0x01,0x02,0x02,0x01,0x12,0x30,0x4b,0x5e,0x58,0x44,0x62,0x75,0x85,0x97,0xb4,0xd3,0xf3,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x8f,0x74,0x54,0x53,
+	0x65,0x59,0x48,0x3f,0x2a,0x10,0x00,0x06,0x03,0x16,0x21,0x2e,0x3b,0x3d,0x3d,0x3d,0x3d,0x3f,0x3d,0x3d,0x3d,0x3d,0x3d,0x37,0x25,0x1d,0x0f,0x00,0x04,0x13,0x29,0x37,
+	0x44,0x50,0x5d,0x69,0x76,0x82,0x8f,0x9b,0x92,0x85,0x79,0x6c,0x60,0x53,0x47,0x3a,0x2e,0x1f,0x0a,0x00,0x03,0x0a,0x2a,0x49,0x65,0x6b,0x6e,0x6b,0x4c,0x39,0x41,0x60,
+	0x78,0x78,0x76,0x59,0x39,0x19,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x02,0x0e,0x23,0x30,
+	0x3d,0x49,0x56,0x62,0x6f,0x7b,0x88,0x94,0x99,0x8c,0x80,0x73,0x67,0x5a,0x4e,0x41,0x35,0x25,0x0e,0x00,0x05,0x04,0x18,0x31,0x46,0x4c,0x41,0x2a,0x13,0x00,0x04,0x03,
+	0x15,0x20,0x20,0x21,0x1f,0x14,0x1f,0x34,0x40,0x3d,0x2c,0x2e,0x47,0x55,0x4f,0x48,0x40,0x3d,0x3d,0x3d,0x40,0x3d,0x3d,0x3d,0x3d,0x3c,0x31,0x22,0x19,0x07,0x00,0x04,
+	0x03,0x15,0x20,0x20,0x21,0x1f,0x14,0x1f,0x34,0x40,0x3d,0x2c,0x2e,0x47,0x55,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x02,0x03,0x16,0x21,0x21,0x21,0x20,0x15,0x1f,0x34,
+	0x40,0x3d,0x44,0x62,0x6e,0x5e,0x4e,0x3b,0x21,0x04,0x00,0x02,0x04,0x16,0x21,0x22,0x22,0x21,0x16,0x1c,0x30,0x3c,0x39,0x29,0x12,0x1b,0x23,0x20,0x23,0x1f,0x11,0x00,
+	0x04,0x0a,0x20,0x37,0x4d,0x58,0x77,0x68,0x55,0x43,0x3c,0x39,0x4b,0x58,0x74,0x6b,0x56,0x46,0x2f,0x19,0x01,0x00,0x03,0x06,0x24,0x41,0x5f,0x7d,0x9a,0x81,0x64,0x46,
+	0x35,0x53,0x71,0x8e,0x8e,0x70,0x52,0x34,0x44,0x62,0x80,0x9c,0x7e,0x60,0x42,0x25,0x07,0x00,0x03,0x07,0x24,0x42,0x60,0x7e,0x9b,0x80,0x62,0x45,0x33,0x51,0x6e,0x8c,
+	0x8f,0x71,0x54,0x36,0x18,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0xa5,0xaf,0xbf,0xc9,0xbf,0xc5,0xc4,0xb1,0xb0,0xb0,0xb1,0xc4,0xde,0xfb,0x00,0x03,0x17,0x32,0x4d,0x68,
+	0x84,0x9b,0x7f,0x71,0x8c,0x92,0x77,0x5b,0x40,0x25,0x0a,0x00,0x04,0x1a,0x31,0x40,0x43,0x43,0x43,0x43,0x49,0x61,0x79,0x91,0x91,0x79,0x61,0x49,0x30,0x18,0x00,0x03,
+	0x0d,0x2d,0x4d,0x6d,0x8d,0x9a,0x9b,0xa1,0x9a,0x9a,0x7a,0x5a,0x3a,0x1a,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x14,0x34,0x54,0x74,
+	0x94,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x04,0x08,0x25,0x41,0x5e,0x7b,0x98,0x86,0x69,0x4c,0x69,0x86,0x97,
+	0x7b,0x5e,0x41,0x25,0x08,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x29,0x3b,0x5a,0x73,0x60,0x73,0x5b,0x3c,0x1d,0x00,0x04,0x1c,0x3c,0x5c,0x7c,0x9c,
+	0x7d,0x5d,0x3d,0x1d,0x00,0x03,0x03,0x16,0x21,0x21,0x21,0x20,0x15,0x1e,0x34,0x3f,0x3c,0x43,0x61,0x6e,0x5e,0x4e,0x3b,0x21,0x04,0x00,0x01,0x05,0x25,0x45,0x65,0x85,
+	0x96,0x8f,0xac,0xa3,0x83,0x9c,0xbc,0xdc,0xec,0xef,0xef,0xf9,0xff,0xff,0x00,0x02,0x19,0x30,0x40,0x45,0x59,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x52,
+	0x42,0x3b,0x27,0x0e,0x00,0x04,0x0d,0x1a,0x26,0x33,0x3f,0x4c,0x58,0x65,0x71,0x7e,0x8a,0x97,0x96,0x8a,0x7d,0x71,0x64,0x58,0x4b,0x37,0x1c,0x00,0x03,0x02,0x1e,0x38,
+	0x4b,0x52,0x64,0x79,0x5b,0x3b,0x36,0x4e,0x58,0x58,0x58,0x49,0x2f,0x12,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,
+	0x4d,0x2d,0x0d,0x00,0x01,0x04,0x21,0x3b,0x4e,0x5a,0x67,0x73,0x80,0x8c,0x99,0x94,0x88,0x7b,0x6f,0x62,0x56,0x49,0x3d,0x30,0x24,0x17,0x0a,0x00,0x07,0x04,0x19,0x28,
+	0x2c,0x25,0x14,0x00,0x05,0x19,0x30,0x3f,0x40,0x40,0x3e,0x2f,0x17,0x18,0x20,0x1e,0x12,0x22,0x37,0x41,0x4e,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5c,
+	0x4a,0x41,0x34,0x1e,0x04,0x00,0x03,0x19,0x30,0x3f,0x40,0x40,0x3e,0x2f,0x17,0x18,0x20,0x1e,0x12,0x22,0x37,0x41,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x02,0x19,0x30,
+	0x40,0x41,0x41,0x3f,0x2f,0x18,0x18,0x20,0x1e,0x35,0x49,0x4f,0x42,0x33,0x22,0x0e,0x00,0x03,0x1a,0x31,0x40,0x42,0x42,0x40,0x30,0x18,0x14,0x1c,0x1a,0x0f,0x21,0x37,
+	0x42,0x3f,0x43,0x3d,0x2a,0x11,0x00,0x03,0x1b,0x32,0x42,0x43,0x4d,0x60,0x59,0x40,0x2a,0x1c,0x1d,0x30,0x4a,0x5f,0x5b,0x43,0x45,0x3e,0x2a,0x11,0x00,0x04,0x18,0x35,
+	0x53,0x71,0x8f,0x8d,0x6f,0x52,0x3e,0x5c,0x79,0x97,0x9a,0x7c,0x5e,0x40,0x50,0x6e,0x8b,0x90,0x72,0x54,0x37,0x19,0x00,0x05,0x19,0x36,0x54,0x72,0x90,0x8c,0x6e,0x51,
+	0x3f,0x5d,0x7a,0x98,0x83,0x66,0x48,0x2a,0x0c,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x99,0x92,0xad,0xcc,0xdf,0xd3,0xb4,0x97,0x93,0x93,0x97,0xb4,0xd3,0xf3,0x00,0x03,
+	0x06,0x21,0x3c,0x58,0x73,0x8e,0x90,0x82,0x9c,0x81,0x66,0x4b,0x2f,0x14,0x00,0x05,0x04,0x16,0x21,0x23,0x23,0x2e,0x46,0x5e,0x76,0x8e,0x94,0x7c,0x64,0x4c,0x34,0x1b,
+	0x03,0x00,0x03,0x0d,0x2d,0x4d,0x6d,0x7f,0x7f,0x87,0x93,0x7f,0x7f,0x7a,0x5a,0x3a,0x1a,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x14,
+	0x34,0x54,0x74,0x94,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x05,0x17,0x33,0x50,0x6d,0x8a,0x94,0x77,0x5a,0x77,
+	0x94,0x89,0x6d,0x50,0x33,0x16,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x49,0x49,0x41,0x47,0x53,0x4b,0x53,0x48,0x30,0x14,0x00,0x04,0x1c,0x3c,0x5c,0x7c,
+	0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x03,0x19,0x30,0x40,0x41,0x41,0x3f,0x2f,0x18,0x17,0x1f,0x1d,0x34,0x48,0x4e,0x42,0x32,0x22,0x0e,0x00,0x02,0x05,0x25,0x45,0x65,0x85,
+	0xa5,0xab,0xbc,0xaf,0x9f,0xaa,0xc4,0xd0,0xcf,0xcf,0xd0,0xdd,0xf1,0xff,0x00,0x01,0x0a,0x28,0x45,0x5d,0x5f,0x70,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,
+	0x62,0x62,0x54,0x39,0x1b,0x00,0x06,0x09,0x15,0x22,0x2e,0x3b,0x47,0x54,0x60,0x6d,0x79,0x86,0x92,0x9b,0x8e,0x82,0x75,0x63,0x46,0x26,0x07,0x00,0x03,0x10,0x30,0x4f,
+	0x6d,0x6b,0x63,0x52,0x36,0x37,0x56,0x6e,0x61,0x43,0x2f,0x1c,0x03,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,
+	0x2d,0x0d,0x00,0x01,0x0c,0x2c,0x4b,0x68,0x78,0x84,0x91,0x9c,0x90,0x83,0x77,0x6a,0x5e,0x51,0x45,0x38,0x2c,0x1f,0x13,0x06,0x00,0x08,0x02,0x18,0x26,0x2b,0x2b,0x2b,
+	0x22,0x11,0x00,0x03,0x09,0x28,0x45,0x5c,0x5e,0x5f,0x5b,0x44,0x26,0x08,0x00,0x02,0x16,0x34,0x50,0x61,0x5c,0x7b,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x76,
+	0x5c,0x60,0x4b,0x2e,0x10,0x00,0x02,0x09,0x28,0x45,0x5c,0x5e,0x5f,0x5b,0x44,0x26,0x08,0x00,0x02,0x16,0x34,0x50,0x61,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x01,0x0a,
+	0x28,0x45,0x5d,0x5f,0x60,0x5c,0x44,0x27,0x08,0x00,0x01,0x08,0x1d,0x2c,0x2f,0x26,0x17,0x07,0x00,0x03,0x0a,0x29,0x46,0x5e,0x60,0x61,0x5d,0x44,0x27,0x08,0x00,0x02,
+	0x13,0x31,0x4e,0x62,0x5b,0x63,0x57,0x3d,0x1f,0x00,0x02,0x0a,0x29,0x47,0x5f,0x61,0x62,0x5f,0x46,0x2c,0x14,0x00,0x01,0x04,0x1e,0x34,0x50,0x64,0x5b,0x65,0x57,0x3c,
+	0x1e,0x00,0x04,0x0c,0x2a,0x47,0x65,0x83,0x99,0x7b,0x5e,0x4a,0x67,0x85,0x99,0x98,0x88,0x6a,0x4c,0x5c,0x79,0x97,0x84,0x67,0x49,0x2b,0x0d,0x00,0x05,0x0d,0x2b,0x48,
+	0x66,0x84,0x98,0x7a,0x5d,0x4b,0x68,0x86,0x95,0x78,0x5a,0x3c,0x1e,0x01,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,
+	0x4d,0x2d,0x0d,0x00,0x04,0x10,0x2c,0x47,0x62,0x7e,0x99,0x98,0x8c,0x70,0x55,0x3a,0x1f,0x03,0x00,0x07,0x02,0x12,0x2a,0x43,0x5b,0x73,0x8b,0x97,0x7f,0x67,0x4f,0x37,
+	0x1f,0x06,0x00,0x04,0x09,0x27,0x44,0x5a,0x5f,0x67,0x87,0x93,0x73,0x5f,0x5e,0x4e,0x33,0x15,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x03,
+	0x14,0x34,0x54,0x74,0x94,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x24,0x44,0x64,0x78,0x78,0x74,0x57,0x37,0x17,0x00,0x04,0x0b,0x24,0x36,0x42,0x5f,0x7b,0x98,0x85,
+	0x68,0x85,0x98,0x7b,0x5f,0x42,0x36,0x24,0x0c,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x69,0x69,0x69,0x59,0x45,0x53,0x4c,0x36,0x2c,0x1b,0x03,0x00,0x04,0x1c,
+	0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x02,0x0a,0x28,0x45,0x5d,0x5f,0x60,0x5c,0x44,0x27,0x08,0x00,0x01,0x07,0x1c,0x2b,0x2e,0x26,0x16,0x07,0x00,0x03,0x05,
+	0x25,0x45,0x65,0x85,0xa5,0xaf,0xbf,0xc9,0xbf,0xc5,0xc4,0xb1,0xb0,0xb0,0xb1,0xc4,0xde,0xfb,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x71,0x61,0x65,0x65,0x65,0x65,0x65,0x65,
+	0x65,0x65,0x65,0x65,0x65,0x7d,0x60,0x40,0x20,0x00,0x08,0x04,0x11,0x1d,0x2a,0x36,0x43,0x4f,0x5c,0x68,0x75,0x81,0x92,0x9f,0x87,0x67,0x47,0x27,0x07,0x00,0x03,0x0e,
+	0x2e,0x4c,0x66,0x65,0x4a,0x39,0x24,0x38,0x56,0x6f,0x61,0x44,0x24,0x13,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,
+	0x4d,0x2d,0x0d,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0xa2,0x8d,0x7f,0x72,0x66,0x59,0x4d,0x40,0x34,0x27,0x1b,0x0e,0x02,0x00,0x0a,0x16,0x30,0x44,0x4b,0x4b,0x4a,0x3e,
+	0x27,0x0c,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x72,0x73,0x6c,0x4c,0x2c,0x0c,0x00,0x02,0x1a,0x3a,0x5a,0x7a,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,
+	0x6b,0x73,0x54,0x34,0x14,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x72,0x73,0x6c,0x4c,0x2c,0x0c,0x00,0x02,0x1a,0x3a,0x5a,0x7a,0x65,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x01,0x0d,
+	0x2d,0x4d,0x6d,0x71,0x73,0x6b,0x4c,0x2c,0x0c,0x00,0x02,0x07,0x12,0x15,0x0e,0x00,0x05,0x0d,0x2d,0x4d,0x6d,0x71,0x73,0x6b,0x4c,0x2c,0x0c,0x00,0x02,0x17,0x37,0x57,
+	0x76,0x68,0x7a,0x63,0x43,0x23,0x03,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x71,0x71,0x6c,0x4c,0x2c,0x0c,0x00,0x02,0x18,0x38,0x58,0x77,0x66,0x7a,0x61,0x41,0x21,0x01,0x00,
+	0x04,0x1e,0x3c,0x59,0x77,0x95,0x87,0x69,0x55,0x73,0x91,0x8b,0x88,0x93,0x76,0x58,0x67,0x85,0x96,0x79,0x5b,0x3d,0x1f,0x01,0x00,0x05,0x01,0x1f,0x3d,0x5a,0x78,0x96,
+	0x86,0x68,0x56,0x74,0x92,0x8a,0x6c,0x4e,0x30,0x13,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,
+	0x05,0x1b,0x37,0x52,0x6d,0x8a,0x9a,0x7b,0x60,0x45,0x29,0x0e,0x00,0x08,0x0f,0x27,0x40,0x58,0x70,0x88,0x9b,0x82,0x6a,0x52,0x3a,0x22,0x0a,0x00,0x06,0x17,0x2e,0x3c,
+	0x47,0x67,0x87,0x93,0x73,0x53,0x3f,0x35,0x21,0x07,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x14,0x34,0x54,0x74,0x94,0x86,0x66,0x46,
+	0x26,0x06,0x00,0x02,0x1c,0x39,0x50,0x58,0x58,0x57,0x47,0x2d,0x10,0x00,0x04,0x1a,0x37,0x51,0x5d,0x5d,0x6d,0x8a,0x93,0x77,0x93,0x8a,0x6d,0x5d,0x5d,0x51,0x38,0x1b,
+	0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x96,0x89,0x89,0x89,0x89,0xa0,0xa7,0x8d,0x9c,0xbb,0xdb,0xfa,0xff,0xff,0xff,0x00,0x02,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,
+	0x1d,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x71,0x73,0x6b,0x4c,0x2c,0x0c,0x00,0x02,0x06,0x11,0x14,0x0e,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x99,0x92,0xad,0xcc,0xdf,0xd3,
+	0xb4,0x97,0x93,0x93,0x97,0xb4,0xd3,0xf3,0x00,0x01,0x08,0x26,0x42,0x58,0x5a,0x6f,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x5e,0x3e,0x1e,0x00,
+	0x07,0x0b,0x17,0x23,0x2f,0x3b,0x47,0x53,0x5f,0x6b,0x77,0x83,0x8f,0x9c,0x92,0x86,0x67,0x47,0x27,0x07,0x00,0x03,0x19,0x30,0x3f,0x49,0x48,0x3f,0x30,0x19,0x2b,0x42,
+	0x50,0x49,0x49,0x40,0x2a,0x0f,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x95,0x75,0x55,0x35,0x15,0x2c,0x4c,0x6c,0x8c,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x01,0x0d,0x2d,0x4d,
+	0x6d,0x88,0x95,0x99,0x8d,0x81,0x75,0x69,0x5d,0x51,0x45,0x38,0x2c,0x20,0x14,0x08,0x00,0x08,0x03,0x21,0x40,0x5d,0x6b,0x6b,0x6a,0x54,0x36,0x17,0x00,0x02,0x08,0x27,
+	0x43,0x59,0x5b,0x5b,0x58,0x42,0x25,0x07,0x05,0x03,0x15,0x32,0x4d,0x5d,0x5b,0x79,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x7a,0x71,0x52,0x32,0x12,0x00,
+	0x02,0x08,0x27,0x43,0x59,0x5b,0x5b,0x58,0x42,0x25,0x07,0x05,0x03,0x15,0x32,0x4d,0x5d,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x01,0x08,0x26,0x42,0x58,0x5a,0x5b,0x57,
+	0x41,0x25,0x07,0x06,0x0b,0x22,0x31,0x35,0x2b,0x1c,0x0c,0x00,0x03,0x08,0x26,0x42,0x58,0x59,0x5a,0x57,0x41,0x24,0x06,0x04,0x02,0x11,0x2e,0x49,0x5b,0x55,0x5c,0x52,
+	0x39,0x1c,0x00,0x02,0x07,0x25,0x41,0x56,0x58,0x58,0x56,0x48,0x34,0x1a,0x07,0x0e,0x24,0x3d,0x4c,0x5a,0x53,0x5a,0x50,0x37,0x1a,0x00,0x05,0x12,0x30,0x4d,0x6b,0x89,
+	0x93,0x75,0x61,0x7f,0x9d,0x7f,0x7d,0x9a,0x82,0x64,0x73,0x91,0x8b,0x6d,0x4f,0x31,0x14,0x00,0x07,0x13,0x31,0x4f,0x6c,0x8a,0x92,0x74,0x62,0x80,0x9c,0x7e,0x60,0x42,
+	0x25,0x07,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x04,0x11,0x2c,0x47,0x63,0x7e,0x99,0x99,
+	0x8c,0x71,0x55,0x3a,0x1f,0x04,0x00,0x06,0x0c,0x24,0x3c,0x55,0x6d,0x85,0x9d,0x86,0x6d,0x55,0x3d,0x25,0x0d,0x08,0x00,0x06,0x01,0x13,0x27,0x47,0x67,0x87,0x93,0x73,
+	0x53,0x33,0x18,0x09,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x14,0x34,0x54,0x74,0x94,0x86,0x66,0x46,0x26,0x06,0x00,0x02,0x19,0x34,
+	0x49,0x50,0x50,0x4f,0x41,0x29,0x0d,0x00,0x04,0x20,0x40,0x60,0x7d,0x7d,0x7d,0x7d,0x9b,0x8b,0x9a,0x7d,0x7d,0x7d,0x7d,0x60,0x41,0x21,0x01,0x00,0x02,0x05,0x25,0x45,
+	0x65,0x85,0x9a,0x90,0x90,0x90,0x90,0x93,0xaa,0x94,0xa0,0xbd,0xdc,0xfb,0xff,0xff,0xff,0x00,0x02,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x02,0x08,0x26,
+	0x42,0x58,0x5a,0x5b,0x57,0x41,0x25,0x07,0x05,0x0a,0x21,0x30,0x34,0x2b,0x1b,0x0b,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x2d,0x4d,0x6d,0x8d,
+	0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x02,0x16,0x2c,0x3a,0x43,0x57,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x6a,0x69,0x5a,0x5a,0x4d,0x34,0x17,0x00,0x04,0x04,0x10,0x1c,
+	0x28,0x34,0x40,0x4c,0x58,0x64,0x70,0x7d,0x89,0x95,0x99,0x8d,0x81,0x75,0x69,0x5b,0x41,0x23,0x04,0x00,0x02,0x0a,0x28,0x45,0x5d,0x62,0x62,0x5d,0x45,0x28,0x39,0x56,
+	0x69,0x5b,0x69,0x57,0x3a,0x1b,0x00,0x02,0x03,0x22,0x41,0x5d,0x69,0x61,0x68,0x50,0x32,0x26,0x29,0x48,0x62,0x67,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x01,0x0a,0x29,0x46,
+	0x5e,0x6b,0x77,0x83,0x8f,0x9b,0x92,0x86,0x7a,0x6e,0x62,0x56,0x4a,0x3e,0x32,0x26,0x1a,0x0e,0x01,0x00,0x05,0x0b,0x2a,0x49,0x68,0x86,0x8b,0x76,0x57,0x38,0x18,0x00,
+	0x03,0x16,0x2d,0x3b,0x3c,0x3c,0x3b,0x2c,0x15,0x1c,0x25,0x22,0x16,0x20,0x34,0x3e,0x4c,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x6f,0x63,0x5a,0x57,0x44,0x29,
+	0x0c,0x00,0x03,0x16,0x2d,0x3b,0x3c,0x3c,0x3b,0x2c,0x15,0x1c,0x25,0x22,0x16,0x20,0x34,0x3e,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x02,0x16,0x2c,0x3a,0x3b,0x3c,0x3a,
+	0x2b,0x14,0x1d,0x26,0x23,0x38,0x4e,0x54,0x47,0x37,0x27,0x11,0x00,0x03,0x15,0x2b,0x39,0x3a,0x3b,0x39,0x2a,0x14,0x1b,0x24,0x22,0x16,0x1c,0x31,0x3b,0x38,0x3c,0x36,
+	0x25,0x0d,0x00,0x03,0x14,0x2a,0x38,0x3c,0x53,0x6b,0x61,0x45,0x34,0x27,0x25,0x3a,0x50,0x6a,0x64,0x48,0x3a,0x34,0x22,0x0b,0x00,0x05,0x06,0x24,0x42,0x5f,0x7d,0x9b,
+	0x81,0x6d,0x8b,0x91,0x73,0x71,0x8e,0x8d,0x70,0x7f,0x9d,0x7f,0x61,0x43,0x26,0x08,0x00,0x07,0x07,0x25,0x43,0x61,0x7e,0x9c,0x80,0x6e,0x8c,0x90,0x72,0x54,0x37,0x19,
+	0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x06,0x21,0x3d,0x58,0x73,0x8f,0x90,0x82,0x9d,
+	0x81,0x66,0x4b,0x30,0x14,0x00,0x05,0x09,0x21,0x39,0x51,0x6a,0x82,0x9a,0x89,0x71,0x58,0x40,0x2a,0x2a,0x2a,0x27,0x1b,0x07,0x00,0x05,0x07,0x27,0x47,0x67,0x87,0x93,
+	0x73,0x53,0x33,0x13,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x14,0x34,0x54,0x74,0x94,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x04,0x24,
+	0x43,0x61,0x70,0x70,0x6e,0x55,0x36,0x16,0x00,0x04,0x20,0x40,0x60,0x80,0x9d,0x9d,0x9d,0x9d,0xa9,0x9d,0x9d,0x9d,0x9d,0x81,0x61,0x41,0x21,0x01,0x00,0x02,0x05,0x25,
+	0x45,0x65,0x85,0x94,0x74,0x70,0x70,0x70,0x6d,0x52,0x4b,0x45,0x32,0x2b,0x20,0x0d,0x00,0x04,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x03,0x16,0x2c,0x3a,
+	0x3b,0x3c,0x3a,0x2b,0x14,0x1c,0x25,0x22,0x37,0x4d,0x54,0x47,0x37,0x27,0x11,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x2d,0x4d,0x6d,0x8d,0x8d,
+	0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x11,0x1b,0x2b,0x38,0x3a,0x3a,0x3a,0x3a,0x45,0x42,0x3a,0x4f,0x6a,0x7a,0x8a,0xa1,0xc0,0xdf,0xf7,0xff,0x00,0x02,0x0c,0x20,0x2e,0x3a,
+	0x46,0x52,0x5e,0x6a,0x76,0x82,0x8e,0x9a,0x93,0x87,0x7b,0x6f,0x63,0x57,0x4b,0x3f,0x2d,0x15,0x00,0x03,0x0d,0x2d,0x4d,0x6d,0x7d,0x7d,0x6d,0x52,0x43,0x45,0x5b,0x75,
+	0x61,0x75,0x5c,0x3c,0x1d,0x00,0x03,0x16,0x30,0x44,0x4a,0x46,0x49,0x3b,0x3b,0x46,0x40,0x35,0x47,0x52,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x02,0x1a,0x31,0x41,0x4d,0x59,
+	0x65,0x71,0x7d,0x89,0x95,0x98,0x8c,0x80,0x74,0x68,0x5c,0x50,0x44,0x38,0x2c,0x1d,0x08,0x00,0x04,0x14,0x33,0x52,0x70,0x8f,0x8a,0x6c,0x4d,0x2f,0x10,0x00,0x04,0x11,
+	0x1c,0x1d,0x1d,0x1c,0x11,0x22,0x38,0x45,0x41,0x30,0x32,0x4d,0x5d,0x55,0x4f,0x46,0x3a,0x3a,0x3f,0x46,0x3c,0x3b,0x5a,0x70,0x80,0x91,0xad,0xcc,0xe8,0xff,0xff,0x00,
+	0x03,0x11,0x1c,0x1d,0x1d,0x1c,0x11,0x22,0x38,0x45,0x41,0x30,0x32,0x4d,0x5d,0x5e,0x7e,0x9e,0xbe,0xde,0xfe,0x00,0x03,0x11,0x1b,0x1c,0x1c,0x1b,0x10,0x23,0x39,0x45,
+	0x42,0x46,0x64,0x73,0x63,0x53,0x3e,0x23,0x06,0x00,0x03,0x10,0x1a,0x1b,0x1b,0x1a,0x0f,0x21,0x37,0x44,0x40,0x2f,0x17,0x14,0x1b,0x19,0x1c,0x18,0x0b,0x00,0x04,0x11,
+	0x29,0x3f,0x56,0x63,0x70,0x64,0x60,0x4a,0x47,0x44,0x53,0x63,0x6e,0x67,0x62,0x4e,0x37,0x21,0x08,0x00,0x06,0x18,0x36,0x53,0x71,0x8f,0x8d,0x79,0x97,0x85,0x67,0x65,
+	0x83,0x99,0x7b,0x8b,0x91,0x73,0x55,0x38,0x1a,0x00,0x09,0x19,0x37,0x55,0x73,0x90,0x8c,0x7a,0x98,0x84,0x66,0x48,0x2b,0x0d,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x94,
+	0x74,0x54,0x34,0x14,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x03,0x17,0x32,0x4d,0x69,0x84,0x9b,0x7f,0x71,0x8c,0x92,0x77,0x5c,0x40,0x25,0x0a,0x00,0x03,
+	0x01,0x1d,0x36,0x4e,0x66,0x7f,0x97,0x8c,0x74,0x5c,0x4a,0x4a,0x4a,0x4a,0x4a,0x46,0x34,0x1b,0x00,0x05,0x07,0x27,0x47,0x67,0x87,0x93,0x73,0x53,0x33,0x13,0x00,0x04,
+	0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x14,0x34,0x54,0x74,0x94,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x90,0x78,0x58,
+	0x38,0x18,0x00,0x04,0x20,0x40,0x60,0x7d,0x7d,0x7d,0x7d,0x7d,0x9d,0x7d,0x7d,0x7d,0x7d,0x7d,0x60,0x41,0x21,0x01,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,
+	0x50,0x50,0x4f,0x40,0x46,0x4b,0x48,0x4a,0x3b,0x22,0x06,0x00,0x03,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x04,0x11,0x1b,0x1c,0x1c,0x1b,0x10,0x22,0x38,
+	0x45,0x41,0x45,0x63,0x73,0x63,0x53,0x3f,0x24,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,
+	0x05,0x0f,0x19,0x1a,0x1a,0x32,0x4f,0x65,0x5d,0x43,0x3d,0x4f,0x5f,0x6d,0x5b,0x3d,0x1e,0x00,0x03,0x03,0x20,0x3a,0x4b,0x57,0x63,0x70,0x7c,0x88,0x94,0x9a,0x8e,0x82,
+	0x76,0x6a,0x5d,0x51,0x45,0x39,0x2d,0x21,0x14,0x00,0x04,0x08,0x26,0x43,0x59,0x5d,0x5d,0x7b,0x63,0x5f,0x64,0x4d,0x55,0x52,0x55,0x49,0x31,0x15,0x00,0x03,0x03,0x18,
+	0x26,0x2a,0x27,0x29,0x36,0x53,0x66,0x5a,0x41,0x58,0x5b,0x72,0x92,0xb2,0xd2,0xf2,0x00,0x02,0x04,0x17,0x23,0x30,0x3c,0x48,0x54,0x60,0x6c,0x78,0x84,0x90,0x9c,0x91,
+	0x85,0x79,0x6d,0x61,0x55,0x49,0x35,0x1b,0x00,0x04,0x1d,0x3b,0x5a,0x79,0x98,0x80,0x62,0x43,0x25,0x06,0x00,0x09,0x13,0x32,0x4f,0x64,0x5d,0x43,0x39,0x59,0x79,0x66,
+	0x6f,0x5c,0x3e,0x3d,0x59,0x66,0x54,0x38,0x44,0x55,0x65,0x69,0x50,0x32,0x13,0x00,0x0a,0x13,0x32,0x4f,0x64,0x5d,0x43,0x39,0x59,0x79,0x66,0x7e,0x9e,0xbe,0xde,0xfe,
+	0x00,0x08,0x13,0x32,0x4f,0x65,0x5d,0x43,0x5f,0x70,0x80,0x94,0xb3,0xd3,0xf3,0x00,0x08,0x12,0x31,0x4d,0x63,0x5d,0x43,0x25,0x06,0x00,0x08,0x02,0x21,0x3d,0x56,0x6c,
+	0x83,0xa1,0x92,0x8e,0xae,0x99,0xa0,0xa2,0x84,0x9d,0x96,0x7b,0x65,0x4e,0x34,0x16,0x00,0x06,0x0c,0x2a,0x48,0x65,0x83,0x99,0x85,0x97,0x79,0x5b,0x59,0x77,0x95,0x87,
+	0x96,0x85,0x67,0x4a,0x2c,0x0e,0x00,0x09,0x0e,0x2b,0x49,0x67,0x85,0x98,0x86,0x96,0x78,0x5a,0x3d,0x1f,0x01,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,
+	0x14,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x02,0x0c,0x27,0x43,0x5e,0x79,0x95,0x8a,0x6f,0x60,0x7c,0x97,0x88,0x6c,0x51,0x36,0x1b,0x00,0x03,0x0b,0x2a,
+	0x49,0x63,0x7c,0x94,0x8f,0x77,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x62,0x47,0x28,0x09,0x00,0x04,0x07,0x27,0x47,0x67,0x87,0x93,0x73,0x53,0x33,0x13,0x00,0x04,0x05,
+	0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x14,0x34,0x54,0x74,0x94,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,
+	0x18,0x00,0x04,0x1e,0x3c,0x59,0x69,0x69,0x69,0x69,0x7d,0x9d,0x7d,0x69,0x69,0x69,0x69,0x59,0x3d,0x1e,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x30,
+	0x30,0x44,0x60,0x6a,0x64,0x68,0x4e,0x30,0x10,0x00,0x03,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x09,0x14,0x32,0x4f,0x64,0x5d,0x43,0x5e,0x71,0x81,0x94,
+	0xb2,0xd2,0xf2,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x08,0x16,0x36,0x56,0x74,0x68,0x48,
+	0x28,0x33,0x43,0x4d,0x44,0x2e,0x13,0x00,0x03,0x0c,0x2c,0x4b,0x67,0x75,0x81,0x8d,0x99,0x94,0x88,0x7c,0x70,0x64,0x58,0x4c,0x40,0x34,0x28,0x1c,0x10,0x04,0x00,0x06,
+	0x16,0x2c,0x43,0x61,0x71,0x63,0x57,0x6a,0x72,0x53,0x64,0x70,0x56,0x36,0x1c,0x04,0x00,0x05,0x07,0x0a,0x08,0x1b,0x3b,0x5a,0x78,0x63,0x4c,0x6c,0x73,0x72,0x92,0xb2,
+	0xd2,0xf2,0x00,0x04,0x06,0x12,0x1e,0x2a,0x36,0x42,0x4e,0x5a,0x66,0x72,0x7e,0x8a,0x96,0x97,0x8b,0x7f,0x73,0x62,0x45,0x26,0x06,0x00,0x02,0x07,0x25,0x44,0x63,0x82,
+	0x94,0x76,0x58,0x39,0x1b,0x00,0x0a,0x16,0x36,0x56,0x75,0x68,0x48,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x42,0x62,0x78,0x5c,0x3c,0x29,0x39,0x48,0x4b,0x3d,0x25,0x09,
+	0x00,0x0a,0x16,0x36,0x56,0x75,0x68,0x48,0x39,0x59,0x79,0x99,0x81,0x61,0x41,0x21,0x01,0x00,0x08,0x16,0x36,0x56,0x74,0x68,0x48,0x45,0x55,0x64,0x61,0x47,0x29,0x0a,
+	0x00,0x08,0x15,0x35,0x55,0x74,0x69,0x49,0x29,0x09,0x00,0x08,0x07,0x27,0x47,0x67,0x83,0x9a,0x89,0x99,0xa6,0xaa,0x8d,0x97,0xb1,0xa3,0x8e,0x92,0x92,0x7b,0x5c,0x3c,
+	0x1c,0x00,0x07,0x1e,0x3c,0x5a,0x77,0x95,0xa1,0x8b,0x6d,0x50,0x4d,0x6b,0x89,0xa1,0x97,0x79,0x5c,0x3e,0x20,0x02,0x00,0x09,0x02,0x1f,0x3d,0x5b,0x79,0x97,0xa1,0x8a,
+	0x6c,0x4f,0x31,0x13,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x02,0x1d,0x38,0x53,0x6f,0x8a,
+	0x94,0x79,0x5e,0x50,0x6b,0x86,0x98,0x7d,0x62,0x47,0x2b,0x0f,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0xa2,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x6b,0x4b,0x2b,
+	0x0b,0x00,0x04,0x07,0x27,0x47,0x67,0x87,0x93,0x73,0x53,0x33,0x13,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x14,0x34,0x54,0x74,0x94,
+	0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x04,0x20,0x40,0x60,0x80,0x89,0x89,0x89,0x89,0x9e,0x89,0x89,0x89,0x89,
+	0x81,0x61,0x41,0x21,0x01,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x2a,0x29,0x46,0x64,0x71,0x69,0x6d,0x50,0x31,0x11,0x00,0x03,0x1c,0x3c,0x5c,0x7c,
+	0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x08,0x0f,0x2a,0x41,0x56,0x75,0x68,0x48,0x45,0x55,0x65,0x62,0x48,0x2a,0x0b,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,
+	0x14,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x08,0x14,0x34,0x52,0x69,0x61,0x45,0x26,0x17,0x26,0x2d,0x27,0x17,0x01,0x00,0x03,0x0d,0x2d,0x4d,0x6d,0x8d,
+	0x9b,0x8f,0x83,0x77,0x6a,0x5e,0x52,0x46,0x3a,0x2e,0x22,0x16,0x0a,0x00,0x09,0x03,0x23,0x42,0x5f,0x6d,0x56,0x51,0x69,0x62,0x46,0x61,0x6b,0x53,0x35,0x16,0x00,0x09,
+	0x19,0x38,0x56,0x6c,0x5e,0x4c,0x6c,0x8b,0x8b,0x6d,0x4d,0x2d,0x0d,0x00,0x07,0x0c,0x18,0x24,0x31,0x3d,0x49,0x55,0x61,0x6d,0x79,0x85,0x91,0x9d,0x87,0x67,0x47,0x27,
+	0x07,0x00,0x02,0x0f,0x2e,0x4d,0x6c,0x8a,0x8a,0x6c,0x4e,0x2f,0x11,0x00,0x0a,0x14,0x34,0x52,0x69,0x61,0x45,0x39,0x59,0x79,0x90,0x81,0x61,0x41,0x3f,0x5c,0x6b,0x57,
+	0x3a,0x1b,0x1d,0x2a,0x2c,0x22,0x0f,0x00,0x0b,0x14,0x34,0x52,0x69,0x61,0x45,0x39,0x59,0x79,0x90,0x81,0x61,0x41,0x21,0x01,0x00,0x08,0x14,0x34,0x52,0x69,0x61,0x45,
+	0x29,0x39,0x46,0x45,0x34,0x1c,0x00,0x09,0x14,0x33,0x51,0x69,0x62,0x46,0x27,0x08,0x00,0x08,0x04,0x23,0x40,0x5a,0x71,0x88,0x73,0x5c,0x41,0x52,0x6b,0x63,0x47,0x4c,
+	0x64,0x7b,0x7f,0x69,0x52,0x36,0x18,0x00,0x07,0x12,0x30,0x4e,0x6b,0x89,0x90,0x7f,0x62,0x44,0x41,0x5f,0x7d,0x90,0x8c,0x6e,0x50,0x32,0x14,0x00,0x0b,0x14,0x31,0x4f,
+	0x6d,0x8b,0x90,0x7e,0x61,0x43,0x25,0x07,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x90,0x74,0x54,0x34,0x14,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x01,0x08,
+	0x28,0x47,0x64,0x7f,0x90,0x83,0x68,0x4d,0x3f,0x5a,0x75,0x90,0x8e,0x73,0x57,0x38,0x19,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,
+	0x90,0x8b,0x6b,0x4b,0x2b,0x0b,0x00,0x04,0x07,0x27,0x47,0x67,0x87,0x93,0x73,0x53,0x33,0x13,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x03,
+	0x14,0x34,0x54,0x74,0x94,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x04,0x20,0x40,0x60,0x80,0x91,0x91,0x91,0x91,
+	0xa1,0x91,0x91,0x91,0x91,0x81,0x61,0x41,0x21,0x01,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x4a,0x4a,0x49,0x3b,0x4d,0x53,0x50,0x51,0x40,0x26,0x09,0x00,
+	0x03,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x08,0x19,0x38,0x56,0x6d,0x5f,0x6b,0x5a,0x3d,0x39,0x47,0x46,0x35,0x1d,0x01,0x00,0x01,0x05,0x25,0x45,0x65,
+	0x85,0x94,0x74,0x54,0x34,0x14,0x2d,0x4d,0x6d,0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x08,0x16,0x35,0x55,0x71,0x66,0x47,0x28,0x08,0x08,0x0d,0x08,0x00,0x05,0x0d,0x2d,
+	0x4d,0x6d,0x89,0x7d,0x71,0x65,0x59,0x4d,0x41,0x35,0x29,0x1d,0x11,0x05,0x00,0x0c,0x18,0x32,0x47,0x4d,0x41,0x54,0x70,0x67,0x48,0x47,0x4c,0x3f,0x27,0x0c,0x00,0x09,
+	0x1a,0x3a,0x59,0x72,0x61,0x48,0x63,0x6b,0x6b,0x64,0x49,0x2a,0x0b,0x00,0x09,0x07,0x13,0x1f,0x2b,0x37,0x43,0x4f,0x5b,0x67,0x73,0x7f,0x87,0x67,0x47,0x27,0x07,0x00,
+	0x02,0x16,0x36,0x55,0x74,0x87,0x80,0x62,0x44,0x25,0x07,0x00,0x0a,0x16,0x35,0x55,0x71,0x66,0x47,0x38,0x56,0x6e,0x70,0x70,0x5d,0x3f,0x41,0x60,0x73,0x5b,0x3c,0x1c,
+	0x01,0x0b,0x0c,0x05,0x00,0x0c,0x16,0x35,0x55,0x71,0x66,0x47,0x38,0x56,0x6e,0x70,0x70,0x5d,0x3f,0x1f,0x00,0x09,0x16,0x35,0x55,0x71,0x66,0x47,0x28,0x1d,0x27,0x26,
+	0x1a,0x07,0x00,0x09,0x15,0x35,0x54,0x70,0x67,0x48,0x29,0x09,0x00,0x09,0x14,0x2d,0x43,0x5a,0x6c,0x5c,0x45,0x34,0x53,0x6e,0x65,0x48,0x37,0x4e,0x64,0x68,0x52,0x3b,
+	0x25,0x0b,0x00,0x07,0x06,0x24,0x42,0x5f,0x70,0x70,0x6e,0x56,0x38,0x36,0x53,0x6d,0x70,0x70,0x61,0x44,0x26,0x09,0x00,0x0b,0x08,0x26,0x43,0x61,0x70,0x70,0x6e,0x55,
+	0x37,0x19,0x00,0x07,0x04,0x23,0x43,0x60,0x70,0x70,0x6c,0x51,0x33,0x13,0x2b,0x4a,0x67,0x70,0x70,0x67,0x4a,0x2b,0x0c,0x00,0x01,0x08,0x28,0x47,0x64,0x70,0x70,0x6f,
+	0x57,0x3c,0x2e,0x49,0x65,0x70,0x70,0x6f,0x57,0x38,0x19,0x00,0x02,0x0c,0x2c,0x4b,0x67,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x66,0x49,0x2a,0x0a,
+	0x00,0x04,0x07,0x27,0x47,0x67,0x87,0x93,0x73,0x53,0x33,0x13,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x14,0x34,0x54,0x74,0x94,0x86,
+	0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x04,0x1f,0x3e,0x5d,0x71,0x71,0x71,0x71,0x7d,0x9d,0x7d,0x71,0x71,0x71,0x71,
+	0x5d,0x3f,0x1f,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x6a,0x6a,0x6a,0x67,0x50,0x32,0x33,0x31,0x32,0x27,0x13,0x00,0x04,0x1c,0x3c,0x5c,0x7c,0x9c,0x7d,0x5d,
+	0x3d,0x1d,0x00,0x08,0x1a,0x3a,0x5a,0x7a,0x9a,0x80,0x60,0x40,0x20,0x28,0x27,0x1b,0x08,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x2d,0x4d,0x6d,
+	0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x08,0x0e,0x2a,0x43,0x53,0x4e,0x39,0x1e,0x01,0x00,0x08,0x0c,0x2c,0x4b,0x67,0x6b,0x5f,0x53,0x47,0x3b,0x2f,0x23,0x17,0x0b,0x00,
+	0x0f,0x05,0x1a,0x29,0x2d,0x2a,0x43,0x53,0x4f,0x3a,0x29,0x2c,0x23,0x12,0x00,0x0a,0x12,0x2e,0x46,0x53,0x4b,0x36,0x48,0x4b,0x4b,0x48,0x37,0x1e,0x02,0x00,0x0b,0x01,
+	0x0d,0x19,0x25,0x31,0x3e,0x4a,0x56,0x62,0x6e,0x63,0x45,0x26,0x06,0x00,0x02,0x13,0x32,0x4f,0x65,0x67,0x66,0x56,0x39,0x1b,0x00,0x0b,0x0e,0x2a,0x43,0x53,0x4e,0x39,
+	0x2a,0x42,0x4f,0x50,0x50,0x46,0x30,0x34,0x4b,0x54,0x48,0x30,0x13,0x00,0x10,0x0e,0x2a,0x43,0x53,0x4e,0x39,0x2a,0x42,0x4f,0x50,0x50,0x46,0x30,0x15,0x00,0x09,0x0e,
+	0x2a,0x43,0x53,0x4e,0x39,0x1e,0x01,0x07,0x06,0x00,0x0b,0x0d,0x2a,0x43,0x53,0x4f,0x3a,0x1f,0x02,0x00,0x0a,0x16,0x2d,0x42,0x4c,0x43,0x2f,0x28,0x41,0x50,0x4c,0x38,
+	0x20,0x37,0x49,0x4a,0x3b,0x25,0x0e,0x00,0x09,0x18,0x33,0x48,0x50,0x50,0x4f,0x42,0x2a,0x28,0x40,0x4f,0x50,0x50,0x49,0x35,0x1a,0x00,0x0d,0x19,0x34,0x49,0x50,0x50,
+	0x4f,0x41,0x29,0x0d,0x00,0x08,0x19,0x34,0x49,0x50,0x50,0x4e,0x3f,0x26,0x0a,0x20,0x3a,0x4c,0x50,0x50,0x4c,0x3a,0x20,0x03,0x00,0x02,0x1d,0x37,0x4b,0x50,0x50,0x4f,
+	0x43,0x2b,0x1d,0x38,0x4b,0x50,0x50,0x4f,0x43,0x2b,0x0f,0x00,0x02,0x04,0x20,0x3a,0x4c,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x4b,0x39,0x1f,0x02,
+	0x00,0x04,0x07,0x27,0x47,0x67,0x87,0x93,0x73,0x53,0x33,0x13,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x03,0x14,0x34,0x54,0x74,0x94,0x86,
+	0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x98,0x78,0x58,0x38,0x18,0x00,0x04,0x15,0x31,0x47,0x51,0x51,0x51,0x5d,0x7d,0x9d,0x7d,0x5d,0x51,0x51,0x51,
+	0x47,0x31,0x16,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x96,0x8a,0x8a,0x8a,0x8a,0x8e,0xab,0xcb,0xea,0xed,0xec,0xf5,0xff,0xff,0xff,0x00,0x02,0x1c,0x3c,0x5c,0x7c,0x9c,
+	0x7d,0x5d,0x3d,0x1d,0x00,0x08,0x1a,0x3a,0x5a,0x79,0x7d,0x7d,0x60,0x40,0x20,0x08,0x07,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x90,0x74,0x54,0x34,0x14,0x2d,0x4d,0x6d,
+	0x8d,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x09,0x16,0x29,0x33,0x30,0x22,0x0c,0x00,0x09,0x04,0x20,0x3a,0x4c,0x4e,0x42,0x36,0x2a,0x1e,0x12,0x06,0x00,0x13,0x0a,0x0d,0x16,
+	0x29,0x33,0x31,0x23,0x0d,0x0c,0x06,0x00,0x0b,0x01,0x19,0x2b,0x33,0x2e,0x1f,0x29,0x2b,0x2b,0x29,0x1d,0x0a,0x00,0x0f,0x08,0x14,0x20,0x2c,0x38,0x44,0x4f,0x4a,0x36,
+	0x1b,0x00,0x03,0x08,0x22,0x39,0x46,0x47,0x47,0x3d,0x29,0x0f,0x00,0x0c,0x16,0x29,0x33,0x30,0x22,0x15,0x27,0x2f,0x30,0x30,0x2a,0x1a,0x1e,0x2e,0x34,0x2c,0x1b,0x03,
+	0x00,0x11,0x16,0x29,0x33,0x30,0x22,0x15,0x27,0x2f,0x30,0x30,0x2a,0x1a,0x03,0x00,0x0a,0x16,0x29,0x33,0x30,0x22,0x0c,0x00,0x0f,0x16,0x29,0x33,0x31,0x23,0x0d,0x00,
+	0x0c,0x16,0x26,0x2c,0x27,0x17,0x14,0x27,0x31,0x2e,0x20,0x0b,0x1e,0x2a,0x2b,0x21,0x0e,0x00,0x0a,0x06,0x1c,0x2b,0x30,0x30,0x2f,0x27,0x15,0x13,0x26,0x2f,0x30,0x30,
+	0x2c,0x1d,0x08,0x00,0x0d,0x07,0x1d,0x2b,0x2f,0x2f,0x2f,0x26,0x14,0x00,0x09,0x07,0x1c,0x2b,0x30,0x30,0x2f,0x25,0x12,0x00,0x01,0x0d,0x21,0x2d,0x30,0x30,0x2d,0x21,
+	0x0d,0x00,0x03,0x0a,0x1f,0x2c,0x30,0x30,0x2f,0x27,0x16,0x0a,0x1f,0x2d,0x30,0x30,0x2f,0x27,0x16,0x00,0x04,0x0d,0x21,0x2d,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+	0x30,0x30,0x30,0x2d,0x20,0x0b,0x00,0x05,0x07,0x27,0x47,0x67,0x87,0x90,0x73,0x53,0x33,0x13,0x00,0x04,0x05,0x25,0x45,0x65,0x85,0x90,0x78,0x58,0x38,0x18,0x00,0x03,
+	0x14,0x34,0x54,0x74,0x90,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x90,0x78,0x58,0x38,0x18,0x00,0x04,0x04,0x1a,0x2b,0x31,0x31,0x3d,0x5d,0x7d,
+	0x90,0x7d,0x5d,0x3d,0x31,0x31,0x2b,0x1b,0x04,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0x90,0x90,0x90,0x90,0x90,0x93,0xad,0xcc,0xeb,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
+	0x02,0x1c,0x3c,0x5c,0x7c,0x90,0x7d,0x5d,0x3d,0x1d,0x00,0x08,0x14,0x32,0x4c,0x5c,0x5d,0x5d,0x50,0x37,0x1a,0x00,0x06,0x04,0x23,0x43,0x60,0x70,0x70,0x6c,0x51,0x33,
+	0x13,0x2b,0x4a,0x67,0x70,0x70,0x67,0x4a,0x2b,0x0c,0x00,0x0a,0x0c,0x13,0x11,0x07,0x00,0x0b,0x0d,0x21,0x2d,0x2e,0x24,0x18,0x0c,0x00,0x19,0x0c,0x13,0x12,0x07,0x00,
+	0x10,0x0d,0x13,0x0f,0x04,0x0a,0x0b,0x0b,0x0a,0x01,0x00,0x12,0x02,0x0e,0x1a,0x26,0x2f,0x2c,0x1e,0x08,0x00,0x04,0x0c,0x1d,0x26,0x27,0x27,0x20,0x11,0x00,0x0e,0x0c,
+	0x13,0x11,0x07,0x00,0x01,0x09,0x0f,0x10,0x10,0x0b,0x00,0x01,0x04,0x10,0x14,0x0e,0x01,0x00,0x13,0x0c,0x13,0x11,0x07,0x00,0x01,0x09,0x0f,0x10,0x10,0x0b,0x00,0x0d,
+	0x0c,0x13,0x11,0x07,0x00,0x11,0x0c,0x13,0x12,0x07,0x00,0x0e,0x07,0x0c,0x08,0x00,0x02,0x09,0x11,0x0f,0x05,0x00,0x01,0x01,0x0b,0x0b,0x04,0x00,0x0d,0x0c,0x0f,0x0f,
+	0x0f,0x09,0x00,0x02,0x08,0x0f,0x10,0x10,0x0d,0x02,0x00,0x0f,0x01,0x0c,0x10,0x10,0x0f,0x09,0x00,0x0b,0x01,0x0c,0x10,0x10,0x0f,0x07,0x00,0x03,0x05,0x0e,0x10,0x10,
+	0x0e,0x05,0x00,0x05,0x03,0x0d,0x10,0x10,0x0f,0x09,0x00,0x02,0x03,0x0d,0x10,0x10,0x0f,0x09,0x00,0x06,0x05,0x0e,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+	0x10,0x0e,0x04,0x00,0x06,0x05,0x25,0x44,0x62,0x70,0x70,0x6b,0x51,0x32,0x12,0x00,0x04,0x04,0x23,0x43,0x60,0x70,0x70,0x6e,0x55,0x36,0x16,0x00,0x03,0x13,0x32,0x51,
+	0x6c,0x70,0x70,0x61,0x44,0x25,0x05,0x00,0x01,0x04,0x23,0x43,0x60,0x70,0x70,0x6e,0x55,0x36,0x16,0x00,0x06,0x0c,0x11,0x1b,0x3b,0x59,0x6f,0x70,0x6f,0x5a,0x3b,0x1c,
+	0x11,0x0d,0x00,0x05,0x04,0x23,0x43,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x6c,0x52,0x33,0x14,0x00,0x08,0x1b,0x3a,0x59,0x6f,0x70,0x6f,0x59,0x3b,0x1b,0x00,0x08,0x06,
+	0x1f,0x33,0x3d,0x3d,0x3d,0x36,0x23,0x0b,0x00,0x07,0x19,0x34,0x49,0x50,0x50,0x4e,0x3f,0x26,0x0a,0x20,0x3a,0x4c,0x50,0x50,0x4c,0x3a,0x20,0x03,0x00,0x1a,0x05,0x0e,
+	0x0f,0x06,0x00,0x4d,0x09,0x0f,0x0d,0x02,0x00,0x07,0x06,0x07,0x07,0x02,0x00,0xf6,0x1a,0x35,0x49,0x50,0x50,0x4e,0x3e,0x25,0x09,0x00,0x05,0x19,0x34,0x49,0x50,0x50,
+	0x4f,0x41,0x29,0x0d,0x00,0x03,0x0a,0x26,0x3f,0x4e,0x50,0x50,0x49,0x35,0x1a,0x00,0x03,0x19,0x34,0x49,0x50,0x50,0x4f,0x41,0x29,0x0d,0x00,0x08,0x12,0x2d,0x44,0x4f,
+	0x50,0x4f,0x44,0x2e,0x12,0x00,0x08,0x19,0x34,0x49,0x50,0x50,0x50,0x50,0x50,0x50,0x4e,0x3f,0x27,0x0b,0x00,0x08,0x11,0x2d,0x44,0x4f,0x50,0x4f,0x44,0x2d,0x12,0x00,
+	0x09,0x07,0x16,0x1d,0x1d,0x1d,0x18,0x0a,0x00,0x08,0x07,0x1c,0x2b,0x30,0x30,0x2f,0x25,0x12,0x00,0x01,0x0d,0x21,0x2d,0x30,0x30,0x2d,0x21,0x0d,0x00,0xff,0x00,0x72,
+	0x08,0x1d,0x2c,0x2f,0x2f,0x2f,0x24,0x11,0x00,0x06,0x07,0x1c,0x2b,0x30,0x30,0x2f,0x26,0x14,0x00,0x05,0x11,0x24,0x2f,0x30,0x30,0x2c,0x1d,0x08,0x00,0x03,0x07,0x1c,
+	0x2b,0x30,0x30,0x2f,0x26,0x14,0x00,0x0a,0x17,0x28,0x2f,0x30,0x2f,0x28,0x18,0x01,0x00,0x08,0x07,0x1c,0x2b,0x30,0x30,0x30,0x30,0x30,0x30,0x2f,0x25,0x12,0x00,0x0a,
+	0x17,0x28,0x2f,0x30,0x2f,0x28,0x17,0x00,0x1a,0x01,0x0c,0x10,0x10,0x0f,0x07,0x00,0x03,0x05,0x0e,0x10,0x10,0x0e,0x05,0x00,0xff,0x00,0x74,0x02,0x0d,0x10,0x10,0x0f,
+	0x07,0x00,0x08,0x01,0x0c,0x0f,0x0f,0x0f,0x09,0x00,0x07,0x07,0x0f,0x10,0x10,0x0d,0x02,0x00,0x05,0x01,0x0c,0x0f,0x0f,0x0f,0x09,0x00,0x0c,0x0a,0x0f,0x10,0x0f,0x0a,
+	0x00,0x0b,0x01,0x0c,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x08,0x00,0x0c,0x0a,0x0f,0x10,0x0f,0x0a,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xd2,0x03,0x07,0x07,0x07,0x00,
+	0x13,0x08,0x0a,0x04,0x00,0x47,0x01,0x00,0x16,0x01,0x01,0x01,0x01,0x00,0x02,0x01,0x01,0x01,0x00,0x09,0x01,0x01,0x01,0x00,0x02,0x01,0x01,0x01,0x01,0x00,0x10,0x06,
+	0x07,0x07,0x05,0x00,0x0e,0x06,0x07,0x07,0x07,0x01,0x00,0x0e,0x06,0x04,0x00,0x0b,0x09,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0b,0x0c,0x0c,0x0c,0x07,
+	0x00,0x07,0x04,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x02,0x00,0x15,0x05,0x06,0x06,0x05,0x06,0x06,0x05,0x00,0x08,0x05,0x06,0x06,0x05,
+	0x00,0x08,0x05,0x0b,0x0b,0x0b,0x07,0x00,0x0b,0x02,0x02,0x00,0x11,0x09,0x0f,0x0f,0x0f,0x0b,0x00,0x08,0x01,0x0c,0x0f,0x0f,0x0f,0x08,0x00,0x27,0x08,0x0c,0x07,0x00,
+	0x02,0x0a,0x0b,0x04,0x00,0x14,0x05,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x04,0x00,0x08,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,
+	0x0c,0x04,0x0d,0x0f,0x1b,0x1d,0x15,0x05,0x00,0x08,0x01,0x0c,0x0f,0x0f,0x0f,0x0c,0x18,0x1a,0x12,0x03,0x00,0x03,0x0d,0x18,0x1a,0x12,0x02,0x00,0x0f,0x14,0x22,0x27,
+	0x27,0x27,0x1e,0x0d,0x00,0x0f,0x04,0x19,0x27,0x2a,0x22,0x11,0x00,0x0c,0x07,0x16,0x1d,0x1a,0x0e,0x00,0x0b,0x0d,0x1b,0x1f,0x1f,0x1f,0x17,0x07,0x00,0x10,0x0b,0x17,
+	0x1a,0x14,0x05,0x00,0x0c,0x0f,0x1d,0x20,0x1a,0x0b,0x00,0x02,0x04,0x16,0x1f,0x1f,0x14,0x02,0x00,0x0a,0x07,0x18,0x21,0x21,0x21,0x21,0x1a,0x1f,0x21,0x21,0x21,0x1e,
+	0x10,0x00,0x05,0x10,0x1d,0x21,0x21,0x21,0x1f,0x1a,0x21,0x21,0x21,0x21,0x19,0x08,0x00,0x0c,0x08,0x1b,0x26,0x27,0x27,0x24,0x18,0x04,0x00,0x0a,0x07,0x1a,0x25,0x27,
+	0x27,0x27,0x1f,0x0f,0x00,0x0b,0x0e,0x1e,0x26,0x23,0x16,0x02,0x00,0x07,0x0a,0x1d,0x29,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2c,0x2c,0x2c,0x25,
+	0x15,0x00,0x04,0x06,0x19,0x24,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x26,0x21,0x13,0x00,0x06,0x0e,0x1a,0x1c,0x1c,0x19,0x0c,0x00,0x06,0x06,
+	0x19,0x24,0x26,0x26,0x24,0x26,0x26,0x25,0x1a,0x08,0x00,0x04,0x06,0x19,0x24,0x26,0x26,0x24,0x19,0x06,0x00,0x05,0x13,0x23,0x2b,0x2b,0x2b,0x26,0x16,0x01,0x00,0x07,
+	0x07,0x19,0x22,0x21,0x16,0x04,0x00,0x03,0x0d,0x17,0x18,0x0f,0x00,0x07,0x15,0x27,0x2f,0x2f,0x2f,0x29,0x19,0x03,0x00,0x05,0x06,0x1c,0x2b,0x2f,0x2f,0x2f,0x25,0x12,
+	0x00,0x06,0x03,0x12,0x19,0x16,0x0a,0x00,0x06,0x10,0x1a,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x16,0x08,0x00,0x05,0x01,0x17,0x26,0x2c,0x25,0x15,0x1c,
+	0x29,0x2b,0x22,0x10,0x00,0x07,0x05,0x15,0x1c,0x19,0x0d,0x00,0x05,0x06,0x19,0x25,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x23,0x15,0x01,0x00,
+	0x03,0x03,0x15,0x1f,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x1c,0x0e,0x00,0x09,0x0c,0x20,0x2d,0x2e,0x3a,0x3d,0x32,0x1d,0x1c,0x15,0x05,0x00,0x04,0x06,0x1c,
+	0x2b,0x2f,0x2f,0x2e,0x27,0x37,0x3a,0x2f,0x1b,0x02,0x00,0x01,0x11,0x28,0x37,0x39,0x2e,0x1a,0x01,0x00,0x0d,0x12,0x2c,0x40,0x47,0x47,0x46,0x3a,0x24,0x09,0x00,0x0e,
+	0x17,0x31,0x44,0x4a,0x3e,0x27,0x0c,0x00,0x0a,0x06,0x1f,0x33,0x3d,0x39,0x28,0x10,0x00,0x09,0x0e,0x26,0x39,0x3f,0x3f,0x3f,0x34,0x1f,0x05,0x00,0x0e,0x0e,0x26,0x36,
+	0x3a,0x31,0x1d,0x04,0x00,0x0a,0x12,0x29,0x3b,0x40,0x37,0x23,0x0c,0x05,0x1c,0x31,0x3f,0x3e,0x2f,0x19,0x03,0x00,0x08,0x07,0x1e,0x34,0x40,0x41,0x41,0x41,0x37,0x3e,
+	0x41,0x41,0x41,0x3c,0x2a,0x11,0x00,0x03,0x10,0x29,0x3b,0x41,0x41,0x41,0x3e,0x36,0x41,0x41,0x41,0x41,0x35,0x1f,0x08,0x00,0x08,0x02,0x15,0x20,0x20,0x36,0x45,0x47,
+	0x47,0x43,0x31,0x21,0x1e,0x11,0x00,0x07,0x01,0x1c,0x34,0x44,0x47,0x47,0x47,0x3c,0x26,0x0b,0x00,0x09,0x0a,0x24,0x3a,0x46,0x41,0x2f,0x16,0x00,0x06,0x02,0x1e,0x37,
+	0x48,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4c,0x4c,0x4c,0x41,0x2b,0x10,0x00,0x03,0x1b,0x33,0x43,0x46,0x46,0x46,0x46,0x46,0x46,0x46,0x46,0x46,
+	0x46,0x46,0x46,0x46,0x3f,0x2c,0x12,0x00,0x04,0x12,0x29,0x39,0x3c,0x3c,0x37,0x27,0x0f,0x00,0x05,0x1b,0x33,0x43,0x46,0x46,0x43,0x46,0x46,0x44,0x35,0x1e,0x02,0x00,
+	0x03,0x1b,0x33,0x43,0x46,0x46,0x43,0x33,0x1b,0x00,0x04,0x0e,0x29,0x3f,0x4b,0x4b,0x4b,0x43,0x2e,0x14,0x00,0x06,0x03,0x1e,0x34,0x41,0x40,0x31,0x1c,0x1f,0x18,0x13,
+	0x29,0x36,0x37,0x2b,0x1b,0x0b,0x00,0x04,0x0f,0x2b,0x42,0x4f,0x4f,0x4f,0x46,0x30,0x15,0x00,0x05,0x19,0x33,0x48,0x4f,0x4f,0x4e,0x40,0x27,0x0b,0x00,0x04,0x03,0x1c,
+	0x2f,0x39,0x34,0x25,0x0e,0x00,0x04,0x15,0x2b,0x39,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x34,0x21,0x09,0x00,0x03,0x02,0x16,0x2f,0x44,0x4c,0x42,0x2c,
+	0x35,0x47,0x4b,0x3d,0x25,0x0f,0x00,0x05,0x05,0x1e,0x32,0x3c,0x37,0x27,0x0f,0x00,0x04,0x1c,0x34,0x44,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,
+	0x41,0x2e,0x15,0x00,0x03,0x1a,0x30,0x3f,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x3a,0x27,0x0e,0x00,0x07,0x03,0x1f,0x39,0x4b,0x4e,0x57,0x5c,0x4a,0x38,0x3c,
+	0x31,0x1d,0x04,0x00,0x03,0x19,0x33,0x48,0x4f,0x4f,0x4e,0x3f,0x54,0x59,0x48,0x2d,0x16,0x18,0x22,0x3e,0x54,0x59,0x47,0x2d,0x0f,0x00,0x0d,0x1f,0x3d,0x59,0x67,0x67,
+	0x66,0x50,0x33,0x14,0x00,0x0d,0x09,0x23,0x42,0x5e,0x69,0x54,0x36,0x17,0x00,0x09,0x07,0x1f,0x31,0x4c,0x5d,0x55,0x3d,0x28,0x12,0x00,0x08,0x1c,0x3a,0x54,0x5f,0x5f,
+	0x5e,0x4c,0x30,0x12,0x00,0x0d,0x0e,0x24,0x3b,0x52,0x5a,0x4a,0x30,0x1d,0x06,0x00,0x08,0x12,0x29,0x3f,0x56,0x60,0x50,0x3a,0x23,0x1c,0x32,0x49,0x5d,0x5c,0x46,0x30,
+	0x19,0x00,0x07,0x05,0x1d,0x34,0x4c,0x60,0x61,0x61,0x61,0x4f,0x5b,0x61,0x61,0x61,0x57,0x3d,0x20,0x01,0x00,0x02,0x1e,0x3c,0x56,0x61,0x61,0x61,0x5c,0x4e,0x61,0x61,
+	0x61,0x60,0x4d,0x35,0x1e,0x06,0x00,0x07,0x18,0x2f,0x3f,0x40,0x4a,0x62,0x67,0x67,0x5e,0x44,0x41,0x3c,0x2b,0x13,0x00,0x06,0x0c,0x2a,0x48,0x61,0x67,0x67,0x66,0x52,
+	0x36,0x17,0x00,0x09,0x15,0x34,0x51,0x66,0x5c,0x41,0x23,0x04,0x00,0x05,0x0c,0x2b,0x49,0x64,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6c,0x6c,0x6c,
+	0x58,0x3a,0x1b,0x00,0x02,0x0a,0x29,0x47,0x60,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x59,0x3d,0x1f,0x00,0x03,0x04,0x22,0x3e,0x56,0x5c,
+	0x5c,0x54,0x3b,0x1f,0x00,0x04,0x0b,0x2a,0x47,0x60,0x66,0x66,0x60,0x66,0x66,0x62,0x4a,0x2c,0x0d,0x00,0x02,0x0b,0x2a,0x47,0x60,0x66,0x66,0x60,0x47,0x29,0x0a,0x00,
+	0x03,0x19,0x38,0x56,0x6a,0x6b,0x6b,0x5b,0x3e,0x1f,0x00,0x04,0x04,0x0d,0x10,0x2e,0x4b,0x60,0x5e,0x46,0x3b,0x3f,0x35,0x25,0x40,0x54,0x56,0x47,0x37,0x25,0x0d,0x00,
+	0x03,0x19,0x38,0x57,0x6e,0x6f,0x6f,0x5c,0x3e,0x20,0x01,0x00,0x03,0x05,0x24,0x43,0x60,0x6f,0x6f,0x6c,0x53,0x34,0x15,0x00,0x03,0x04,0x1b,0x2f,0x49,0x58,0x51,0x3a,
+	0x24,0x0f,0x00,0x02,0x08,0x26,0x42,0x57,0x5b,0x5b,0x5b,0x5b,0x5b,0x5b,0x5b,0x5b,0x5b,0x5b,0x4e,0x35,0x18,0x00,0x03,0x16,0x2f,0x41,0x5b,0x6c,0x58,0x40,0x46,0x62,
+	0x69,0x51,0x3c,0x27,0x0d,0x00,0x03,0x06,0x1e,0x30,0x4b,0x5b,0x54,0x3c,0x26,0x11,0x00,0x02,0x0b,0x2a,0x47,0x61,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,
+	0x67,0x67,0x5c,0x41,0x22,0x03,0x00,0x01,0x0b,0x2a,0x46,0x5d,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x61,0x54,0x3a,0x1c,0x00,0x07,0x0c,0x2b,0x4a,0x66,0x6b,0x69,
+	0x76,0x56,0x55,0x5b,0x4a,0x2f,0x12,0x00,0x02,0x04,0x23,0x43,0x60,0x6f,0x6f,0x6c,0x51,0x68,0x75,0x56,0x36,0x35,0x38,0x2d,0x49,0x69,0x74,0x55,0x35,0x15,0x00,0x0c,
+	0x02,0x22,0x42,0x62,0x82,0x87,0x77,0x57,0x37,0x17,0x00,0x0c,0x0c,0x23,0x33,0x45,0x63,0x73,0x58,0x38,0x19,0x00,0x09,0x17,0x33,0x4c,0x59,0x79,0x66,0x54,0x3f,0x24,
+	0x06,0x00,0x03,0x09,0x13,0x15,0x15,0x22,0x42,0x62,0x7f,0x7f,0x77,0x57,0x37,0x17,0x15,0x15,0x11,0x05,0x00,0x08,0x03,0x21,0x3c,0x50,0x65,0x78,0x59,0x4a,0x32,0x16,
+	0x00,0x07,0x07,0x24,0x3f,0x56,0x6d,0x7d,0x67,0x50,0x3a,0x32,0x49,0x60,0x76,0x74,0x5d,0x46,0x2d,0x0f,0x00,0x05,0x04,0x1b,0x32,0x4a,0x61,0x79,0x81,0x81,0x79,0x5a,
+	0x72,0x81,0x81,0x81,0x64,0x44,0x24,0x04,0x00,0x01,0x03,0x23,0x43,0x63,0x81,0x81,0x81,0x73,0x5b,0x78,0x81,0x81,0x7a,0x62,0x4b,0x33,0x1c,0x04,0x00,0x05,0x10,0x2a,
+	0x45,0x5c,0x5f,0x50,0x70,0x87,0x87,0x69,0x51,0x61,0x58,0x3f,0x25,0x0a,0x00,0x05,0x17,0x35,0x53,0x71,0x87,0x87,0x7d,0x5e,0x40,0x22,0x04,0x00,0x06,0x07,0x10,0x18,
+	0x38,0x58,0x76,0x66,0x46,0x26,0x12,0x0c,0x00,0x04,0x0d,0x2d,0x4d,0x6d,0x8b,0x8b,0x8b,0x8b,0x8b,0x8b,0x8b,0x8b,0x8b,0x8b,0x8b,0x8c,0x8c,0x7d,0x5d,0x3d,0x1d,0x00,
+	0x02,0x0d,0x2d,0x4d,0x6d,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x83,0x63,0x43,0x23,0x03,0x00,0x02,0x10,0x2d,0x4b,0x69,0x7c,0x7c,0x65,0x45,
+	0x25,0x05,0x00,0x03,0x0d,0x2d,0x4d,0x6d,0x86,0x86,0x6c,0x86,0x86,0x70,0x50,0x30,0x10,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x86,0x86,0x6c,0x4c,0x2c,0x0c,0x00,0x02,0x03,
+	0x22,0x41,0x5f,0x7e,0x8b,0x7e,0x5f,0x40,0x21,0x01,0x00,0x02,0x0c,0x20,0x2c,0x2d,0x33,0x53,0x73,0x6e,0x4e,0x57,0x5f,0x4d,0x3e,0x4d,0x6c,0x72,0x62,0x52,0x3a,0x1d,
+	0x00,0x03,0x19,0x38,0x57,0x76,0x8f,0x85,0x66,0x47,0x28,0x0a,0x00,0x03,0x0e,0x2c,0x4b,0x6a,0x89,0x8f,0x71,0x53,0x34,0x15,0x00,0x03,0x15,0x31,0x48,0x58,0x76,0x65,
+	0x4f,0x3c,0x21,0x04,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x5e,0x3e,0x1e,0x00,0x02,0x04,0x23,0x42,0x5c,0x65,0x73,0x66,
+	0x5a,0x61,0x66,0x70,0x66,0x54,0x37,0x19,0x00,0x03,0x16,0x33,0x4b,0x59,0x78,0x66,0x52,0x3e,0x23,0x05,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x87,0x87,0x87,0x87,0x87,0x87,
+	0x87,0x87,0x87,0x87,0x87,0x86,0x66,0x46,0x26,0x06,0x00,0x01,0x10,0x30,0x50,0x70,0x81,0x81,0x81,0x81,0x81,0x81,0x81,0x81,0x81,0x61,0x41,0x21,0x01,0x00,0x06,0x0c,
+	0x2c,0x4b,0x68,0x6c,0x5b,0x62,0x61,0x71,0x77,0x57,0x38,0x18,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x8f,0x74,0x54,0x5c,0x63,0x4e,0x3d,0x53,0x57,0x46,0x43,0x5d,0x63,
+	0x4e,0x31,0x12,0x00,0x0c,0x02,0x22,0x42,0x62,0x82,0x97,0x77,0x57,0x37,0x17,0x00,0x0c,0x1c,0x38,0x50,0x58,0x66,0x79,0x59,0x39,0x19,0x00,0x09,0x1e,0x3e,0x5e,0x78,
+	0x61,0x70,0x6b,0x4c,0x2c,0x0c,0x00,0x02,0x10,0x25,0x32,0x35,0x35,0x35,0x42,0x62,0x82,0x97,0x77,0x57,0x37,0x35,0x35,0x35,0x2f,0x1f,0x08,0x00,0x04,0x10,0x1b,0x1c,
+	0x1c,0x2a,0x4a,0x68,0x6f,0x64,0x74,0x5e,0x3f,0x1f,0x1c,0x1c,0x18,0x0b,0x00,0x03,0x0d,0x2d,0x4d,0x6c,0x84,0x94,0x7d,0x67,0x50,0x49,0x60,0x76,0x8d,0x8a,0x74,0x56,
+	0x36,0x16,0x00,0x04,0x02,0x19,0x31,0x48,0x60,0x77,0x8f,0x93,0x7c,0x64,0x70,0x87,0x9b,0x83,0x6c,0x55,0x3b,0x1e,0x00,0x03,0x1d,0x3a,0x54,0x6b,0x82,0x9a,0x88,0x71,
+	0x63,0x7b,0x92,0x90,0x78,0x61,0x49,0x32,0x1a,0x03,0x00,0x03,0x04,0x21,0x3c,0x57,0x71,0x79,0x67,0x70,0x90,0x89,0x69,0x6b,0x7d,0x6c,0x51,0x37,0x1b,0x00,0x04,0x03,
+	0x21,0x3f,0x5e,0x7c,0x9a,0xa0,0x87,0x69,0x4b,0x2c,0x0e,0x00,0x05,0x0e,0x23,0x30,0x30,0x38,0x58,0x78,0x66,0x47,0x31,0x32,0x2a,0x19,0x01,0x00,0x02,0x0d,0x2d,0x4d,
+	0x6d,0x8d,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x9d,0x7d,0x5d,0x3d,0x1d,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0x94,0x94,0x94,0x94,0x94,0x94,0x94,
+	0x94,0x94,0x94,0x94,0x83,0x63,0x43,0x23,0x03,0x00,0x02,0x16,0x36,0x56,0x75,0x93,0x7a,0x5c,0x3f,0x26,0x15,0x00,0x03,0x0c,0x2c,0x4c,0x6c,0x8c,0x8b,0x6b,0x88,0x8f,
+	0x6f,0x4f,0x2f,0x0f,0x00,0x02,0x0c,0x2c,0x4c,0x6c,0x8c,0x8b,0x6b,0x4b,0x2b,0x0b,0x00,0x02,0x0c,0x2b,0x49,0x68,0x87,0x92,0x74,0x55,0x37,0x19,0x00,0x02,0x03,0x20,
+	0x39,0x4b,0x4c,0x3e,0x4d,0x64,0x61,0x47,0x66,0x79,0x59,0x5b,0x5f,0x61,0x71,0x81,0x9b,0xbb,0xdb,0xfb,0x00,0x02,0x10,0x2f,0x4d,0x6b,0x8a,0x8d,0x6f,0x50,0x31,0x12,
+	0x00,0x03,0x16,0x35,0x54,0x73,0x92,0x86,0x67,0x49,0x2b,0x0c,0x00,0x03,0x1e,0x3d,0x5c,0x73,0x65,0x6e,0x69,0x4b,0x2c,0x0c,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0x9b,
+	0x9b,0x9b,0x9b,0x9b,0x9b,0x9b,0x9b,0x7e,0x5e,0x3e,0x1e,0x00,0x02,0x07,0x27,0x47,0x66,0x76,0x61,0x78,0x63,0x6e,0x6f,0x62,0x78,0x5b,0x3c,0x1c,0x00,0x03,0x1e,0x3e,
+	0x5d,0x76,0x62,0x70,0x6a,0x4c,0x2c,0x0c,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x66,0x46,0x26,0x06,0x00,0x01,
+	0x10,0x30,0x50,0x70,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x81,0x61,0x41,0x21,0x01,0x00,0x05,0x11,0x1e,0x21,0x3b,0x4d,0x4f,0x68,0x75,0x7d,0x8c,0x9c,0xb1,0xcd,
+	0xeb,0xff,0x00,0x01,0x05,0x25,0x45,0x65,0x85,0x99,0x92,0xad,0x96,0x89,0xa9,0xb6,0x97,0x8c,0xaa,0xb5,0x95,0x8a,0xaa,0xca,0xe2,0xe4,0xe3,0xec,0xfd,0xff,0xff,0x00,
+	0x03,0x10,0x1a,0x1b,0x1b,0x22,0x42,0x62,0x82,0x97,0x77,0x57,0x37,0x1b,0x1b,0x1b,0x17,0x0a,0x00,0x06,0x04,0x06,0x24,0x44,0x63,0x78,0x78,0x76,0x58,0x38,0x2a,0x1b,
+	0x06,0x06,0x01,0x00,0x05,0x1b,0x3a,0x56,0x67,0x71,0x64,0x60,0x47,0x29,0x0a,0x00,0x01,0x06,0x23,0x3e,0x51,0x55,0x55,0x55,0x55,0x62,0x82,0x97,0x77,0x57,0x55,0x55,
+	0x55,0x55,0x4c,0x35,0x19,0x00,0x03,0x15,0x2c,0x3a,0x3c,0x3c,0x3c,0x47,0x63,0x68,0x6e,0x6b,0x5a,0x3c,0x3c,0x3c,0x3c,0x36,0x24,0x0c,0x00,0x02,0x0b,0x2a,0x48,0x62,
+	0x78,0x8f,0x94,0x7d,0x67,0x60,0x76,0x8d,0x96,0x7f,0x68,0x50,0x33,0x14,0x00,0x04,0x18,0x2f,0x46,0x5e,0x75,0x8d,0x95,0x7d,0x66,0x6e,0x86,0x9c,0x85,0x6e,0x56,0x3f,
+	0x27,0x0f,0x00,0x03,0x0e,0x26,0x3e,0x55,0x6d,0x84,0x9b,0x87,0x6f,0x65,0x7c,0x94,0x8e,0x76,0x5f,0x47,0x30,0x19,0x01,0x00,0x02,0x0d,0x2c,0x4b,0x69,0x83,0x94,0x81,
+	0x70,0x90,0x89,0x73,0x85,0x98,0x7e,0x63,0x45,0x25,0x06,0x00,0x03,0x0d,0x2c,0x4a,0x68,0x86,0x93,0x89,0x92,0x73,0x55,0x37,0x19,0x00,0x04,0x04,0x21,0x3c,0x4e,0x50,
+	0x51,0x4e,0x61,0x58,0x4e,0x50,0x52,0x46,0x2e,0x12,0x00,0x02,0x0c,0x2c,0x4a,0x66,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x7c,0x9c,0x7d,0x5d,0x3d,
+	0x1d,0x00,0x02,0x0d,0x2d,0x4c,0x6a,0x74,0x74,0x74,0x74,0x74,0x74,0x74,0x74,0x74,0x74,0x74,0x74,0x74,0x61,0x42,0x22,0x02,0x00,0x02,0x13,0x32,0x50,0x6d,0x8a,0x98,
+	0xb1,0xb1,0xbd,0xd4,0xef,0xff,0x00,0x01,0x0b,0x2b,0x4b,0x6b,0x8b,0x8a,0x6b,0x88,0x8e,0x6e,0x4e,0x2e,0x0e,0x00,0x02,0x0b,0x2b,0x4b,0x6b,0x8b,0x8a,0x6b,0x4b,0x2b,
+	0x0b,0x00,0x02,0x14,0x33,0x52,0x71,0x90,0x88,0x6a,0x4b,0x2d,0x0f,0x00,0x02,0x0c,0x2c,0x4a,0x66,0x6a,0x59,0x52,0x70,0x6b,0x5c,0x6c,0x5f,0x4d,0x6c,0x73,0x53,0x55,
+	0x63,0x58,0x3e,0x20,0x01,0x00,0x02,0x06,0x25,0x43,0x61,0x80,0x96,0x77,0x59,0x3a,0x1b,0x00,0x03,0x1f,0x3e,0x5d,0x7b,0x9a,0x7c,0x5d,0x3f,0x21,0x02,0x00,0x03,0x1c,
+	0x3b,0x59,0x6c,0x6d,0x68,0x64,0x49,0x2a,0x0b,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7d,0x5e,0x3e,0x1e,0x00,0x02,0x01,0x1f,
+	0x3b,0x52,0x61,0x7d,0x5e,0x50,0x56,0x6a,0x75,0x59,0x4b,0x32,0x15,0x00,0x03,0x1c,0x3b,0x57,0x69,0x6f,0x65,0x62,0x48,0x29,0x0a,0x00,0x01,0x0a,0x29,0x46,0x5e,0x63,
+	0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x59,0x3f,0x21,0x02,0x00,0x01,0x0d,0x2c,0x4b,0x64,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x5a,0x3e,
+	0x1f,0x00,0x05,0x12,0x2a,0x3c,0x41,0x3e,0x40,0x3e,0x55,0x5a,0x64,0x57,0x47,0x37,0x21,0x07,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0xa5,0xaf,0xbf,0xa7,0xa1,0xb4,0xbb,
+	0xa1,0x9a,0xb0,0xbe,0xa6,0xa1,0xb4,0xc6,0xc2,0xc4,0xc3,0xd0,0xe6,0xff,0xff,0x00,0x02,0x15,0x2b,0x39,0x3b,0x3b,0x3b,0x42,0x62,0x82,0x97,0x77,0x57,0x3b,0x3b,0x3b,
+	0x3b,0x36,0x24,0x0c,0x00,0x03,0x04,0x17,0x24,0x26,0x26,0x44,0x64,0x84,0x91,0x92,0xaa,0xb1,0xb8,0xcd,0xda,0xd9,0xdf,0xef,0xff,0xff,0x00,0x02,0x0f,0x29,0x3e,0x54,
+	0x6b,0x60,0x44,0x33,0x1b,0x00,0x02,0x0d,0x2d,0x4c,0x6a,0x75,0x75,0x75,0x75,0x75,0x82,0x97,0x77,0x75,0x75,0x75,0x75,0x75,0x61,0x42,0x22,0x02,0x00,0x01,0x08,0x26,
+	0x42,0x58,0x5c,0x5c,0x5c,0x5c,0x5c,0x62,0x6f,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x51,0x39,0x1b,0x00,0x03,0x1c,0x34,0x4b,0x62,0x78,0x8f,0x94,0x7d,0x76,0x8d,0x96,0x7f,
+	0x68,0x52,0x3b,0x24,0x09,0x00,0x03,0x16,0x2d,0x45,0x5c,0x74,0x8b,0x97,0x7f,0x68,0x6d,0x84,0x9b,0x87,0x6f,0x58,0x40,0x29,0x12,0x00,0x05,0x11,0x28,0x3f,0x57,0x6e,
+	0x86,0x9c,0x85,0x6d,0x67,0x7e,0x96,0x8c,0x75,0x5d,0x46,0x2e,0x17,0x00,0x02,0x0c,0x2b,0x4a,0x66,0x78,0x8b,0x9c,0x89,0x90,0x89,0x8d,0x99,0x87,0x75,0x61,0x44,0x25,
+	0x05,0x00,0x03,0x18,0x36,0x54,0x73,0x91,0x89,0x7e,0x9c,0x7e,0x60,0x42,0x23,0x05,0x00,0x03,0x0d,0x2c,0x4b,0x69,0x6c,0x71,0x58,0x41,0x4b,0x68,0x6c,0x71,0x5a,0x3b,
+	0x1b,0x00,0x02,0x03,0x20,0x39,0x4b,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x02,0x06,0x23,0x3e,0x51,0x55,0x55,
+	0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x4c,0x35,0x19,0x00,0x03,0x0e,0x26,0x43,0x60,0x6d,0x69,0x67,0x6e,0x57,0x39,0x1a,0x00,0x02,0x0a,0x2a,0x4a,
+	0x6a,0x8a,0x8a,0x6a,0x87,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x02,0x0a,0x2a,0x4a,0x6a,0x8a,0x8a,0x6a,0x4a,0x2a,0x0a,0x00,0x02,0x1d,0x3c,0x5b,0x7a,0x98,0x7e,0x60,0x41,
+	0x23,0x05,0x00,0x02,0x0c,0x2c,0x4b,0x68,0x7a,0x8a,0x9e,0xaa,0xac,0xa0,0x8d,0xa4,0xb8,0x9f,0x9b,0xb2,0xc6,0xbc,0xc1,0xd4,0xed,0xff,0x00,0x03,0x1b,0x39,0x57,0x76,
+	0x94,0x80,0x61,0x42,0x24,0x05,0x00,0x01,0x09,0x28,0x47,0x65,0x84,0x90,0x72,0x53,0x35,0x17,0x00,0x04,0x11,0x2c,0x42,0x56,0x70,0x62,0x48,0x37,0x1e,0x01,0x00,0x01,
+	0x08,0x27,0x43,0x59,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x50,0x36,0x18,0x00,0x03,0x0e,0x25,0x39,0x53,0x5e,0x50,0x36,0x40,0x58,0x5d,0x4a,0x30,0x1e,
+	0x05,0x00,0x03,0x10,0x2a,0x3f,0x55,0x6d,0x61,0x45,0x35,0x1c,0x00,0x03,0x1a,0x31,0x40,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x3e,0x2c,0x13,
+	0x00,0x02,0x03,0x1f,0x37,0x47,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x41,0x2d,0x13,0x00,0x04,0x01,0x20,0x3e,0x57,0x61,0x5b,0x5f,0x4b,0x38,0x3d,0x44,0x3b,
+	0x2b,0x1b,0x0a,0x00,0x03,0x05,0x25,0x45,0x65,0x85,0xa5,0xa5,0xb8,0xc3,0xc0,0xc2,0xa9,0xa2,0xa6,0xa3,0xb7,0xc3,0xc0,0xc1,0xa9,0xa3,0xa6,0xa5,0xb9,0xd5,0xf3,0xff,
+	0x00,0x01,0x08,0x26,0x42,0x57,0x5b,0x5b,0x5b,0x5b,0x62,0x82,0x97,0x77,0x5b,0x5b,0x5b,0x5b,0x5b,0x51,0x39,0x1c,0x00,0x03,0x18,0x31,0x42,0x45,0x46,0x44,0x64,0x84,
+	0x85,0x6f,0x6d,0x6e,0x5f,0x43,0x45,0x46,0x3d,0x28,0x0e,0x00,0x04,0x12,0x28,0x40,0x4c,0x47,0x33,0x19,0x06,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0x95,0x95,0x95,0x95,
+	0x95,0x9f,0x95,0x95,0x95,0x95,0x95,0x83,0x63,0x43,0x23,0x03,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x62,
+	0x42,0x22,0x02,0x00,0x02,0x07,0x1e,0x34,0x4b,0x62,0x78,0x8f,0x94,0x8d,0x96,0x7f,0x68,0x52,0x3b,0x24,0x0e,0x00,0x03,0x08,0x26,0x42,0x5b,0x72,0x89,0x98,0x81,0x69,
+	0x6b,0x82,0x9a,0x88,0x71,0x59,0x42,0x2b,0x13,0x00,0x07,0x12,0x2a,0x41,0x58,0x70,0x87,0x9b,0x83,0x6c,0x68,0x80,0x97,0x8a,0x73,0x5b,0x44,0x27,0x09,0x00,0x01,0x03,
+	0x1f,0x39,0x4c,0x5e,0x70,0x82,0x95,0xa4,0xa2,0x91,0x7e,0x6c,0x5a,0x48,0x34,0x19,0x00,0x03,0x04,0x23,0x41,0x5f,0x7d,0x9b,0x7e,0x74,0x92,0x88,0x6a,0x4c,0x2e,0x10,
+	0x00,0x03,0x0c,0x2b,0x4a,0x66,0x69,0x6d,0x56,0x45,0x49,0x65,0x69,0x6d,0x58,0x3a,0x1b,0x00,0x03,0x0c,0x20,0x2c,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x3c,
+	0x5c,0x7c,0x9c,0x7d,0x5d,0x3d,0x1d,0x00,0x02,0x0d,0x2d,0x4c,0x6a,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x75,0x61,0x42,0x22,0x02,0x00,0x01,
+	0x04,0x21,0x3c,0x53,0x6b,0x6b,0x6a,0x69,0x70,0x58,0x39,0x1a,0x00,0x02,0x0a,0x2a,0x4a,0x6a,0x8a,0x89,0x69,0x86,0x8d,0x6d,0x4d,0x2d,0x0d,0x00,0x02,0x0a,0x2a,0x4a,
+	0x6a,0x8a,0x89,0x69,0x49,0x29,0x09,0x00,0x01,0x07,0x26,0x45,0x63,0x82,0x92,0x74,0x56,0x37,0x19,0x00,0x03,0x04,0x21,0x3b,0x4e,0x5e,0x6e,0x60,0x42,0x35,0x49,0x52,
+	0x47,0x4c,0x6b,0x71,0x53,0x33,0x23,0x20,0x12,0x00,0x05,0x11,0x2f,0x4d,0x6c,0x7b,0x7b,0x67,0x48,0x28,0x08,0x00,0x01,0x0c,0x2c,0x4c,0x6c,0x7b,0x7b,0x68,0x49,0x2b,
+	0x0c,0x00,0x05,0x15,0x2b,0x43,0x51,0x4b,0x36,0x1d,0x0a,0x00,0x03,0x16,0x2d,0x3b,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x36,0x23,0x0a,0x00,0x04,0x0d,
+	0x26,0x38,0x3e,0x36,0x23,0x2b,0x3b,0x3e,0x32,0x1d,0x05,0x00,0x05,0x13,0x29,0x41,0x4e,0x48,0x34,0x1b,0x07,0x00,0x03,0x04,0x16,0x21,0x23,0x23,0x23,0x23,0x23,0x23,
+	0x23,0x23,0x23,0x23,0x23,0x23,0x20,0x13,0x00,0x04,0x0a,0x1d,0x28,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x24,0x15,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x94,
+	0x74,0x54,0x34,0x1f,0x24,0x1e,0x0f,0x00,0x05,0x05,0x25,0x45,0x65,0x85,0x95,0x8c,0xab,0xcb,0xd8,0xb8,0x99,0x87,0x93,0x8c,0xac,0xcc,0xd8,0xb8,0x98,0x88,0x92,0x8e,
+	0xad,0xcd,0xed,0xff,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x7b,0x7b,0x7b,0x7b,0x7b,0x82,0x97,0x7b,0x7b,0x7b,0x7b,0x7b,0x7b,0x62,0x43,0x23,0x03,0x00,0x01,0x07,0x26,0x44,
+	0x5e,0x64,0x66,0x56,0x64,0x84,0x85,0x6c,0x70,0x70,0x60,0x5f,0x64,0x66,0x55,0x39,0x1a,0x00,0x05,0x13,0x24,0x2c,0x29,0x1b,0x06,0x00,0x03,0x0d,0x2d,0x4d,0x6d,0x85,
+	0x85,0x85,0x85,0x85,0x86,0x98,0x85,0x85,0x85,0x85,0x85,0x83,0x63,0x43,0x23,0x03,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0x9c,0x9c,0x9c,0x9c,0x9c,0x9c,0x9c,0x9c,0x9c,
+	0x9c,0x9c,0x82,0x62,0x42,0x22,0x02,0x00,0x03,0x07,0x1e,0x34,0x4b,0x62,0x78,0x94,0x9e,0x7f,0x68,0x52,0x3b,0x24,0x0e,0x00,0x04,0x0d,0x2d,0x4d,0x6d,0x88,0x9f,0x83,
+	0x6b,0x63,0x81,0x98,0x8d,0x72,0x5b,0x44,0x2d,0x16,0x00,0x09,0x15,0x2c,0x43,0x5a,0x71,0x8b,0x99,0x82,0x65,0x6a,0x82,0xa0,0x89,0x6e,0x4f,0x2f,0x0f,0x00,0x02,0x19,
+	0x30,0x43,0x55,0x67,0x79,0x8b,0xa7,0xa0,0x88,0x75,0x63,0x51,0x3f,0x2c,0x14,0x00,0x03,0x0f,0x2d,0x4b,0x6a,0x88,0x92,0x74,0x69,0x87,0x93,0x75,0x57,0x38,0x1a,0x00,
+	0x03,0x03,0x1f,0x39,0x4a,0x4b,0x4d,0x51,0x65,0x5c,0x4a,0x4c,0x4d,0x42,0x2c,0x10,0x00,0x04,0x04,0x0d,0x0e,0x0e,0x0e,0x0e,0x0e,0x0e,0x0e,0x0e,0x1c,0x3c,0x5c,0x7c,
+	0x93,0x7d,0x5d,0x3d,0x1d,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x83,0x63,0x43,0x23,0x03,0x00,0x01,0x0d,0x2c,
+	0x4b,0x69,0x80,0x8d,0x98,0xb1,0xae,0xbb,0xd2,0xee,0xff,0x00,0x01,0x09,0x29,0x49,0x69,0x89,0x88,0x68,0x85,0x8c,0x6c,0x4c,0x2c,0x0c,0x00,0x02,0x09,0x29,0x49,0x69,
+	0x89,0x88,0x68,0x48,0x28,0x08,0x00,0x01,0x0d,0x2d,0x4d,0x6c,0x87,0x87,0x6a,0x4c,0x2d,0x0f,0x00,0x04,0x0e,0x22,0x32,0x42,0x4e,0x48,0x33,0x1d,0x2d,0x32,0x2b,0x3f,
+	0x54,0x56,0x44,0x2a,0x0c,0x01,0x00,0x06,0x06,0x24,0x40,0x56,0x5b,0x5b,0x54,0x3d,0x21,0x02,0x00,0x01,0x06,0x24,0x40,0x56,0x5b,0x5b,0x54,0x3d,0x21,0x02,0x00,0x06,
+	0x16,0x28,0x31,0x2d,0x1e,0x09,0x00,0x05,0x11,0x1c,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x18,0x0a,0x00,0x06,0x0c,0x1a,0x1e,0x19,0x0a,0x10,0x1c,0x1e,
+	0x16,0x05,0x00,0x07,0x14,0x26,0x2e,0x2a,0x1c,0x07,0x00,0x06,0x02,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x08,0x08,0x09,0x09,0x09,0x09,
+	0x09,0x09,0x09,0x09,0x09,0x05,0x00,0x06,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x04,0x00,0x07,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x27,0x47,
+	0x67,0x87,0x93,0x73,0x53,0x33,0x27,0x47,0x67,0x87,0x92,0x72,0x52,0x32,0x12,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x8d,0x9b,0x9b,0x9b,0x9b,0x9c,0xa4,0x9b,0x9b,0x9b,0x9b,
+	0x9b,0x83,0x63,0x43,0x23,0x03,0x00,0x01,0x0a,0x2a,0x4a,0x69,0x73,0x79,0x5e,0x64,0x84,0x8e,0x8f,0x9c,0xae,0xb4,0x95,0x8d,0x86,0xa2,0xc2,0xe2,0xff,0x00,0x04,0x04,
+	0x13,0x1a,0x17,0x0b,0x00,0x04,0x0a,0x29,0x47,0x60,0x65,0x65,0x65,0x65,0x65,0x82,0x97,0x77,0x65,0x65,0x65,0x65,0x65,0x59,0x3d,0x1f,0x00,0x02,0x0d,0x2d,0x4d,0x6d,
+	0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x7d,0x62,0x42,0x22,0x02,0x00,0x02,0x06,0x1c,0x33,0x49,0x60,0x77,0x8d,0x96,0x8e,0x94,0x7d,0x67,0x50,
+	0x3a,0x23,0x0c,0x00,0x03,0x0a,0x28,0x45,0x5e,0x75,0x8c,0x97,0x81,0x6a,0x6e,0x85,0x9b,0x88,0x71,0x5a,0x43,0x2c,0x16,0x00,0x07,0x15,0x2c,0x42,0x59,0x70,0x87,0x9c,
+	0x85,0x6f,0x69,0x80,0x97,0x8d,0x76,0x5f,0x47,0x2a,0x0b,0x00,0x01,0x0a,0x28,0x45,0x5d,0x6f,0x81,0x94,0x92,0x94,0x8f,0x96,0x90,0x7e,0x6b,0x59,0x3f,0x22,0x03,0x00,
+	0x02,0x19,0x38,0x56,0x74,0x92,0x88,0x69,0x5e,0x7d,0x9b,0x7f,0x61,0x43,0x25,0x06,0x00,0x03,0x0b,0x1f,0x2b,0x2c,0x38,0x58,0x76,0x66,0x46,0x2c,0x2d,0x26,0x15,0x00,
+	0x0f,0x1b,0x3b,0x5a,0x73,0x73,0x73,0x5b,0x3c,0x1c,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x83,0x63,0x43,0x23,
+	0x03,0x00,0x01,0x0c,0x2b,0x4a,0x66,0x69,0x75,0x69,0x49,0x31,0x29,0x17,0x00,0x03,0x07,0x26,0x45,0x61,0x6c,0x6c,0x61,0x6c,0x6c,0x63,0x48,0x29,0x0a,0x00,0x02,0x07,
+	0x26,0x45,0x61,0x6c,0x6c,0x61,0x44,0x25,0x06,0x00,0x01,0x0b,0x2a,0x47,0x61,0x67,0x67,0x5c,0x41,0x23,0x05,0x00,0x05,0x07,0x17,0x26,0x2e,0x2a,0x1c,0x06,0x0e,0x12,
+	0x12,0x28,0x36,0x37,0x2b,0x17,0x00,0x09,0x14,0x2a,0x38,0x3b,0x3b,0x37,0x27,0x10,0x00,0x03,0x14,0x2a,0x38,0x3b,0x3b,0x37,0x27,0x10,0x00,0x08,0x0b,0x11,0x0e,0x03,
+	0x00,0x2c,0x08,0x0e,0x0b,0x01,0x00,0x2d,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x27,0x47,0x67,
+	0x87,0x93,0x73,0x53,0x33,0x27,0x47,0x67,0x87,0x92,0x72,0x52,0x32,0x12,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x7e,0x7e,0x7e,0x7e,0x7e,0x82,0x97,0x7e,0x7e,0x7e,0x7e,0x7e,
+	0x7e,0x63,0x43,0x23,0x03,0x00,0x01,0x04,0x22,0x3d,0x53,0x57,0x59,0x4d,0x64,0x84,0x87,0x93,0x7a,0x62,0x4a,0x54,0x57,0x59,0x4c,0x33,0x16,0x00,0x04,0x03,0x1c,0x30,
+	0x39,0x35,0x25,0x0e,0x00,0x04,0x1b,0x33,0x43,0x45,0x45,0x45,0x45,0x62,0x82,0x97,0x77,0x57,0x45,0x45,0x45,0x45,0x3f,0x2b,0x12,0x00,0x02,0x08,0x26,0x42,0x58,0x5d,
+	0x5d,0x5d,0x5d,0x5d,0x61,0x6f,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x52,0x39,0x1c,0x00,0x03,0x1b,0x33,0x49,0x60,0x77,0x8d,0x96,0x7f,0x78,0x8e,0x94,0x7d,0x67,0x50,0x3a,
+	0x22,0x08,0x00,0x03,0x19,0x31,0x48,0x5e,0x75,0x8c,0x97,0x80,0x69,0x6e,0x85,0x9c,0x87,0x71,0x5a,0x43,0x2c,0x15,0x00,0x05,0x14,0x2b,0x42,0x59,0x70,0x86,0x9c,0x86,
+	0x6f,0x68,0x7f,0x96,0x8d,0x76,0x5f,0x49,0x32,0x1a,0x00,0x02,0x0d,0x2d,0x4d,0x6d,0x89,0x9c,0x8a,0x78,0x90,0x89,0x7c,0x8e,0x98,0x84,0x66,0x46,0x26,0x07,0x00,0x01,
+	0x06,0x24,0x42,0x60,0x7f,0x9b,0x7d,0x5f,0x54,0x72,0x90,0x8a,0x6c,0x4d,0x2f,0x11,0x00,0x04,0x03,0x0c,0x18,0x38,0x58,0x78,0x66,0x46,0x26,0x0d,0x08,0x00,0x10,0x13,
+	0x2f,0x47,0x53,0x53,0x53,0x48,0x30,0x14,0x00,0x02,0x0a,0x29,0x47,0x5f,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x58,0x3d,0x1f,0x00,0x02,
+	0x03,0x1f,0x39,0x4a,0x4d,0x61,0x5b,0x42,0x24,0x0b,0x00,0x05,0x1a,0x34,0x47,0x4c,0x4c,0x47,0x4c,0x4c,0x48,0x36,0x1d,0x00,0x04,0x1a,0x34,0x47,0x4c,0x4c,0x47,0x33,
+	0x19,0x00,0x03,0x1c,0x34,0x44,0x47,0x47,0x41,0x2f,0x16,0x00,0x08,0x09,0x0f,0x0c,0x00,0x05,0x0c,0x16,0x17,0x0f,0x00,0x0b,0x0f,0x19,0x1b,0x1b,0x18,0x0d,0x00,0x05,
+	0x0f,0x19,0x1b,0x1b,0x18,0x0d,0x00,0x6a,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x27,0x47,0x67,
+	0x87,0x93,0x73,0x53,0x33,0x27,0x47,0x67,0x87,0x92,0x72,0x52,0x32,0x12,0x00,0x02,0x08,0x27,0x43,0x59,0x5e,0x5e,0x5e,0x5e,0x62,0x82,0x97,0x77,0x5e,0x5e,0x5e,0x5e,
+	0x5e,0x53,0x3a,0x1d,0x00,0x03,0x11,0x27,0x36,0x38,0x39,0x44,0x64,0x84,0x85,0x81,0x8f,0x78,0x60,0x46,0x38,0x39,0x31,0x1f,0x07,0x00,0x03,0x05,0x1c,0x2f,0x49,0x59,
+	0x52,0x3b,0x25,0x0f,0x00,0x02,0x02,0x1e,0x36,0x47,0x4a,0x4a,0x4a,0x4a,0x62,0x82,0x90,0x77,0x57,0x4a,0x4a,0x4a,0x4a,0x43,0x2f,0x15,0x00,0x03,0x16,0x2c,0x3a,0x3d,
+	0x3d,0x3d,0x47,0x62,0x67,0x6e,0x6a,0x59,0x3d,0x3d,0x3d,0x3d,0x36,0x25,0x0c,0x00,0x02,0x0a,0x29,0x47,0x60,0x77,0x8d,0x96,0x7f,0x68,0x61,0x78,0x8e,0x94,0x7d,0x67,
+	0x4f,0x32,0x14,0x00,0x03,0x04,0x1a,0x31,0x48,0x5f,0x76,0x8c,0x96,0x80,0x69,0x6e,0x85,0x9c,0x87,0x70,0x59,0x43,0x2c,0x15,0x00,0x03,0x14,0x2b,0x42,0x58,0x6f,0x86,
+	0x9d,0x86,0x6f,0x68,0x7f,0x96,0x8d,0x77,0x60,0x49,0x32,0x1b,0x04,0x00,0x02,0x08,0x26,0x42,0x5d,0x77,0x82,0x70,0x70,0x90,0x89,0x69,0x74,0x86,0x72,0x57,0x3d,0x20,
+	0x02,0x00,0x01,0x0d,0x2d,0x4c,0x6b,0x89,0x8a,0x73,0x54,0x49,0x67,0x86,0x8a,0x76,0x58,0x39,0x19,0x00,0x06,0x14,0x33,0x4f,0x61,0x59,0x3f,0x22,0x03,0x00,0x11,0x02,
+	0x1a,0x2b,0x33,0x33,0x33,0x2c,0x1a,0x03,0x00,0x03,0x1a,0x32,0x42,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x3e,0x2b,0x11,0x00,0x03,0x0b,
+	0x1f,0x2b,0x36,0x42,0x3f,0x2e,0x16,0x00,0x06,0x07,0x1b,0x29,0x2c,0x2c,0x29,0x2c,0x2c,0x2a,0x1d,0x09,0x00,0x04,0x07,0x1b,0x29,0x2c,0x2c,0x29,0x1b,0x06,0x00,0x03,
+	0x06,0x19,0x25,0x27,0x27,0x23,0x16,0x02,0x00,0x9a,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x27,
+	0x47,0x67,0x87,0x93,0x73,0x53,0x33,0x27,0x47,0x67,0x87,0x92,0x72,0x52,0x32,0x12,0x00,0x03,0x16,0x2d,0x3b,0x3e,0x3e,0x3e,0x42,0x62,0x82,0x97,0x77,0x57,0x3e,0x3e,
+	0x3e,0x3e,0x38,0x26,0x0e,0x00,0x04,0x0c,0x17,0x18,0x24,0x44,0x63,0x78,0x78,0x6c,0x78,0x78,0x6a,0x4b,0x2b,0x19,0x13,0x06,0x00,0x04,0x15,0x31,0x49,0x58,0x77,0x65,
+	0x50,0x3d,0x22,0x05,0x00,0x01,0x0b,0x2b,0x49,0x64,0x6a,0x6a,0x6a,0x6a,0x6a,0x70,0x70,0x6e,0x6a,0x6a,0x6a,0x6a,0x6a,0x5c,0x3f,0x20,0x01,0x00,0x03,0x11,0x1b,0x1d,
+	0x1d,0x2b,0x4a,0x68,0x6f,0x63,0x75,0x5e,0x3f,0x1f,0x1d,0x1d,0x18,0x0b,0x00,0x03,0x0d,0x2d,0x4d,0x6c,0x85,0x96,0x7f,0x68,0x52,0x4a,0x61,0x78,0x8e,0x8c,0x75,0x56,
+	0x37,0x17,0x00,0x04,0x04,0x1b,0x32,0x48,0x5f,0x76,0x8d,0x96,0x7f,0x68,0x6f,0x85,0x9c,0x87,0x70,0x59,0x42,0x26,0x08,0x00,0x01,0x07,0x25,0x41,0x58,0x6f,0x86,0x9c,
+	0x86,0x6f,0x67,0x7e,0x95,0x8e,0x77,0x60,0x49,0x32,0x1c,0x05,0x00,0x04,0x16,0x31,0x4b,0x65,0x68,0x56,0x70,0x83,0x83,0x69,0x5a,0x6b,0x60,0x45,0x2b,0x10,0x00,0x02,
+	0x0b,0x2b,0x49,0x63,0x6a,0x6a,0x64,0x4a,0x3f,0x5b,0x6a,0x6a,0x69,0x54,0x36,0x17,0x00,0x06,0x08,0x22,0x37,0x42,0x3d,0x2c,0x14,0x00,0x14,0x0e,0x13,0x13,0x13,0x0e,
+	0x01,0x00,0x04,0x05,0x18,0x23,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x20,0x12,0x00,0x05,0x03,0x0c,0x1a,0x22,0x20,0x14,0x01,0x00,0x08,
+	0x0a,0x0c,0x0c,0x0a,0x0c,0x0c,0x0a,0x01,0x00,0x07,0x0a,0x0c,0x0c,0x0a,0x00,0x07,0x05,0x07,0x07,0x04,0x00,0x9c,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,
+	0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x27,0x47,0x67,0x87,0x93,0x73,0x53,0x33,0x27,0x47,0x67,0x87,0x92,0x72,0x52,0x32,0x12,0x00,0x04,0x11,0x1c,
+	0x1e,0x1e,0x22,0x42,0x62,0x82,0x97,0x77,0x57,0x37,0x1e,0x1e,0x1e,0x19,0x0c,0x00,0x08,0x1c,0x38,0x50,0x58,0x5e,0x6a,0x58,0x58,0x54,0x3e,0x23,0x05,0x00,0x06,0x1e,
+	0x3d,0x5d,0x74,0x64,0x6e,0x69,0x4b,0x2c,0x0c,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x83,0x63,0x43,0x23,0x03,
+	0x00,0x06,0x04,0x21,0x3c,0x50,0x65,0x78,0x59,0x4a,0x33,0x17,0x00,0x07,0x07,0x25,0x41,0x58,0x6e,0x7f,0x68,0x52,0x3b,0x34,0x4a,0x61,0x78,0x75,0x5f,0x48,0x2e,0x10,
+	0x00,0x05,0x04,0x1b,0x32,0x49,0x60,0x76,0x85,0x85,0x7f,0x63,0x6f,0x85,0x85,0x85,0x6e,0x4e,0x2e,0x0e,0x00,0x01,0x0d,0x2d,0x4d,0x6c,0x85,0x85,0x85,0x70,0x62,0x7e,
+	0x85,0x85,0x77,0x60,0x4a,0x33,0x1c,0x05,0x00,0x05,0x04,0x1f,0x38,0x49,0x4b,0x48,0x5f,0x63,0x63,0x5b,0x42,0x4c,0x47,0x33,0x19,0x00,0x03,0x01,0x1d,0x36,0x47,0x4a,
+	0x4a,0x47,0x37,0x2e,0x42,0x4a,0x4a,0x4a,0x3e,0x27,0x0c,0x00,0x07,0x0a,0x1a,0x22,0x1f,0x12,0x00,0x21,0x03,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,
+	0x04,0x04,0x01,0x00,0x09,0x02,0x01,0x00,0xc4,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x27,0x47,
+	0x67,0x87,0x93,0x73,0x53,0x33,0x27,0x47,0x67,0x87,0x92,0x72,0x52,0x32,0x12,0x00,0x07,0x02,0x22,0x42,0x62,0x82,0x97,0x77,0x57,0x37,0x17,0x00,0x0c,0x0c,0x23,0x33,
+	0x45,0x63,0x73,0x58,0x38,0x36,0x27,0x11,0x00,0x07,0x1c,0x3b,0x58,0x6b,0x6d,0x67,0x63,0x48,0x2a,0x0b,0x00,0x01,0x0d,0x2d,0x4d,0x6d,0x8d,0x90,0x90,0x90,0x90,0x90,
+	0x90,0x90,0x90,0x90,0x90,0x90,0x83,0x63,0x43,0x23,0x03,0x00,0x07,0x0f,0x24,0x3b,0x53,0x5a,0x4b,0x30,0x1d,0x06,0x00,0x08,0x14,0x2b,0x41,0x57,0x62,0x52,0x3b,0x24,
+	0x1d,0x34,0x4a,0x5f,0x5e,0x48,0x31,0x1b,0x02,0x00,0x06,0x05,0x1b,0x32,0x49,0x5f,0x65,0x65,0x65,0x59,0x58,0x65,0x65,0x65,0x60,0x48,0x2a,0x0c,0x00,0x01,0x0a,0x29,
+	0x47,0x60,0x65,0x65,0x65,0x59,0x59,0x65,0x65,0x65,0x60,0x4a,0x33,0x1c,0x06,0x00,0x07,0x0a,0x1e,0x2a,0x2b,0x32,0x41,0x43,0x43,0x3f,0x2e,0x2c,0x29,0x1b,0x06,0x00,
+	0x04,0x09,0x1c,0x28,0x2a,0x2a,0x28,0x1d,0x16,0x25,0x2a,0x2a,0x2a,0x22,0x11,0x00,0x0a,0x02,0x00,0xff,0x00,0x02,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x14,
+	0x00,0x08,0x05,0x25,0x45,0x65,0x85,0x94,0x74,0x54,0x34,0x27,0x47,0x67,0x87,0x93,0x73,0x53,0x33,0x27,0x47,0x67,0x87,0x92,0x72,0x52,0x32,0x12,0x00,0x07,0x02,0x22,
+	0x42,0x62,0x82,0x89,0x77,0x57,0x37,0x17,0x00,0x0d,0x09,0x26,0x46,0x66,0x79,0x59,0x39,0x19,0x0c,0x00,0x08,0x11,0x2c,0x41,0x56,0x6f,0x62,0x47,0x36,0x1d,0x01,0x00,
+	0x01,0x0c,0x2c,0x4b,0x67,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x5f,0x41,0x21,0x02,0x00,0x08,0x0f,0x26,0x36,0x3b,0x31,0x1d,0x04,0x00,
+	0x0a,0x14,0x2a,0x3d,0x43,0x39,0x24,0x0e,0x07,0x1d,0x33,0x41,0x40,0x31,0x1b,0x04,0x00,0x08,0x05,0x1c,0x32,0x42,0x45,0x45,0x45,0x3f,0x3e,0x45,0x45,0x45,0x43,0x33,
+	0x1c,0x01,0x00,0x02,0x1b,0x33,0x43,0x45,0x45,0x45,0x3f,0x3f,0x45,0x45,0x45,0x43,0x33,0x1d,0x06,0x00,0x09,0x02,0x0b,0x0c,0x17,0x21,0x23,0x23,0x20,0x14,0x0c,0x0a,
+	0x00,0x08,0x09,0x0a,0x0a,0x09,0x00,0x02,0x06,0x0a,0x0a,0x0a,0x04,0x00,0xff,0x00,0x0e,0x05,0x25,0x45,0x65,0x85,0x90,0x74,0x54,0x34,0x14,0x00,0x08,0x05,0x25,0x45,
+	0x65,0x85,0x90,0x74,0x54,0x34,0x27,0x47,0x67,0x87,0x90,0x73,0x53,0x33,0x27,0x47,0x67,0x87,0x90,0x72,0x52,0x32,0x12,0x00,0x08,0x1f,0x3e,0x5a,0x69,0x69,0x68,0x51,
+	0x34,0x15,0x00,0x0d,0x01,0x1f,0x3c,0x55,0x5d,0x4c,0x31,0x14,0x00,0x0a,0x15,0x2b,0x43,0x50,0x4a,0x35,0x1d,0x09,0x00,0x02,0x04,0x20,0x3a,0x4c,0x50,0x50,0x50,0x50,
+	0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x48,0x32,0x17,0x00,0x0a,0x0c,0x18,0x1b,0x14,0x05,0x00,0x0c,0x11,0x1f,0x23,0x1c,0x0c,0x00,0x02,0x06,0x18,0x22,0x21,
+	0x16,0x04,0x00,0x0a,0x05,0x18,0x23,0x25,0x25,0x25,0x21,0x21,0x25,0x25,0x25,0x24,0x19,0x06,0x00,0x03,0x05,0x18,0x23,0x25,0x25,0x25,0x21,0x21,0x25,0x25,0x25,0x24,
+	0x19,0x06,0x00,0x0e,0x02,0x03,0x03,0x01,0x00,0xff,0x00,0x24,0x04,0x23,0x43,0x60,0x70,0x70,0x6c,0x51,0x33,0x13,0x00,0x08,0x04,0x23,0x43,0x60,0x70,0x70,0x6c,0x51,
+	0x33,0x25,0x44,0x62,0x70,0x70,0x6b,0x51,0x32,0x26,0x45,0x63,0x70,0x70,0x6a,0x4f,0x30,0x10,0x00,0x08,0x13,0x2d,0x42,0x49,0x49,0x48,0x3c,0x25,0x0a,0x00,0x0e,0x10,
+	0x27,0x38,0x3d,0x33,0x1f,0x06,0x00,0x0b,0x15,0x27,0x30,0x2c,0x1e,0x08,0x00,0x04,0x0d,0x21,0x2d,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+	0x2a,0x1b,0x05,0x00,0x1d,0x03,0x00,0x06,0x02,0x01,0x00,0x0e,0x04,0x05,0x05,0x05,0x02,0x02,0x05,0x05,0x05,0x04,0x00,0x07,0x04,0x05,0x05,0x05,0x02,0x02,0x05,0x05,
+	0x05,0x04,0x00,0xff,0x00,0x39,0x19,0x34,0x49,0x50,0x50,0x4e,0x3f,0x26,0x0a,0x00,0x09,0x19,0x34,0x49,0x50,0x50,0x4e,0x3f,0x26,0x1a,0x35,0x49,0x50,0x50,0x4e,0x3e,
+	0x25,0x1b,0x36,0x4a,0x50,0x50,0x4e,0x3d,0x24,0x08,0x00,0x09,0x15,0x24,0x29,0x29,0x29,0x20,0x0f,0x00,0x10,0x0d,0x1a,0x1d,0x16,0x07,0x00,0x0d,0x0a,0x10,0x0d,0x02,
+	0x00,0x06,0x05,0x0e,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x0c,0x00,0xff,0x00,0x8a,0x07,0x1c,0x2b,0x30,0x30,0x2f,0x25,0x12,0x00,0x0a,
+	0x07,0x1c,0x2b,0x30,0x30,0x2f,0x25,0x12,0x08,0x1d,0x2c,0x30,0x30,0x2f,0x24,0x11,0x08,0x1e,0x2c,0x30,0x30,0x2e,0x23,0x10,0x00,0x0b,0x05,0x09,0x09,0x09,0x02,0x00,
+	0xff,0x00,0xc8,0x01,0x0c,0x10,0x10,0x0f,0x07,0x00,0x0c,0x01,0x0c,0x10,0x10,0x0f,0x07,0x00,0x02,0x02,0x0d,0x10,0x10,0x0f,0x07,0x00,0x02,0x02,0x0d,0x10,0x10,0x0f,
+	0x06,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xb8,
+};
+
+static const BakedFontAtlas BakedFontAtlases[] = {
+	{ "SulphurPoint", { 32, 255, 32.0f, 0.82249999f, -0.17750001f, 0.416666687f, 0.125f }, 512, 512, bakedFontGlyphs0, bakedFontBitmap0, sizeof(bakedFontBitmap0) },
+};
+static const size_t BakedFontAtlasCount = sizeof(BakedFontAtlases) / sizeof(BakedFontAtlases[0]);
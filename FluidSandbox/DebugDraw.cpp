@@ -0,0 +1,150 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - DebugDraw.cpp
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#include "DebugDraw.h"
+
+#include <glm/gtc/constants.hpp>
+
+#include "Renderer.h"
+#include "VBO.h"
+
+static CDebugDraw *gDebugDrawTarget = nullptr;
+
+CDebugDraw::CDebugDraw():
+	vbo(nullptr),
+	uploadedCount(0),
+	isDirty(false) {
+	vbo = new CVBO();
+}
+
+CDebugDraw::~CDebugDraw() {
+	if(gDebugDrawTarget == this) {
+		gDebugDrawTarget = nullptr;
+	}
+	delete vbo;
+}
+
+void CDebugDraw::Clear() {
+	verts.clear();
+	isDirty = true;
+}
+
+void CDebugDraw::AddLine(const glm::vec3 &a, const glm::vec3 &b, const glm::vec4 &color) {
+	DebugVertex v;
+	v.color = color;
+	v.pos = a;
+	verts.push_back(v);
+	v.pos = b;
+	verts.push_back(v);
+	isDirty = true;
+}
+
+void CDebugDraw::AddBox(const glm::vec3 &min, const glm::vec3 &max, const glm::vec4 &color) {
+	glm::vec3 corners[8] = {
+		glm::vec3(min.x, min.y, min.z),
+		glm::vec3(max.x, min.y, min.z),
+		glm::vec3(max.x, max.y, min.z),
+		glm::vec3(min.x, max.y, min.z),
+		glm::vec3(min.x, min.y, max.z),
+		glm::vec3(max.x, min.y, max.z),
+		glm::vec3(max.x, max.y, max.z),
+		glm::vec3(min.x, max.y, max.z),
+	};
+	for(int i = 0; i < 4; ++i) {
+		AddLine(corners[i], corners[(i + 1) % 4], color);
+		AddLine(corners[4 + i], corners[4 + (i + 1) % 4], color);
+		AddLine(corners[i], corners[4 + i], color);
+	}
+}
+
+void CDebugDraw::AddBox(const glm::mat4 &transform, const glm::vec3 &halfExtents, const glm::vec4 &color) {
+	glm::vec3 corners[8];
+	for(int i = 0; i < 8; ++i) {
+		glm::vec3 local = glm::vec3((i & 1) ? halfExtents.x : -halfExtents.x, (i & 2) ? halfExtents.y : -halfExtents.y, (i & 4) ? halfExtents.z : -halfExtents.z);
+		corners[i] = glm::vec3(transform * glm::vec4(local, 1.0f));
+	}
+	for(int i = 0; i < 8; ++i) {
+		for(int axis = 0; axis < 3; ++axis) {
+			int other = i | (1 << axis);
+			if(other != i) {
+				AddLine(corners[i], corners[other], color);
+			}
+		}
+	}
+}
+
+void CDebugDraw::AddSphere(const glm::vec3 &center, const float radius, const glm::vec4 &color, const uint32_t segments) {
+	// Three axis aligned circles
+	float step = glm::two_pi<float>() / (float)segments;
+	for(uint32_t i = 0; i < segments; ++i) {
+		float a0 = step * (float)i;
+		float a1 = step * (float)(i + 1);
+		glm::vec2 p0 = glm::vec2(cosf(a0), sinf(a0)) * radius;
+		glm::vec2 p1 = glm::vec2(cosf(a1), sinf(a1)) * radius;
+		AddLine(center + glm::vec3(p0.x, p0.y, 0.0f), center + glm::vec3(p1.x, p1.y, 0.0f), color);
+		AddLine(center + glm::vec3(p0.x, 0.0f, p0.y), center + glm::vec3(p1.x, 0.0f, p1.y), color);
+		AddLine(center + glm::vec3(0.0f, p0.x, p0.y), center + glm::vec3(0.0f, p1.x, p1.y), color);
+	}
+}
+
+void CDebugDraw::Draw(CRenderer *renderer) {
+	if(verts.size() == 0) {
+		return;
+	}
+
+	// NOTE(final): The scene may be drawn multiple times per frame, so we upload only when something has changed
+	if(isDirty) {
+		vbo->BufferVertices(&verts[0].pos[0], sizeof(DebugVertex) * verts.size(), GL_STREAM_DRAW);
+		uploadedCount = verts.size();
+		isDirty = false;
+	}
+
+	// Vertex (vec3, vec4)
+	vbo->Bind();
+
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+	glVertexPointer(3, GL_FLOAT, sizeof(DebugVertex), (void *)(offsetof(DebugVertex, pos)));
+	glColorPointer(4, GL_FLOAT, sizeof(DebugVertex), (void *)(offsetof(DebugVertex, color)));
+	renderer->DrawVBOArrays(vbo, GL_LINES, 0, (GLsizei)uploadedCount);
+	glDisableClientState(GL_COLOR_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+
+	vbo->Unbind();
+}
+
+namespace DebugDraw {
+	void SetTarget(CDebugDraw *target) {
+		gDebugDrawTarget = target;
+	}
+
+	bool IsActive() {
+		return(gDebugDrawTarget != nullptr);
+	}
+
+	void Line(const glm::vec3 &a, const glm::vec3 &b, const glm::vec4 &color) {
+		if(gDebugDrawTarget != nullptr)
+			gDebugDrawTarget->AddLine(a, b, color);
+	}
+
+	void Box(const glm::vec3 &min, const glm::vec3 &max, const glm::vec4 &color) {
+		if(gDebugDrawTarget != nullptr)
+			gDebugDrawTarget->AddBox(min, max, color);
+	}
+
+	void Box(const glm::mat4 &transform, const glm::vec3 &halfExtents, const glm::vec4 &color) {
+		if(gDebugDrawTarget != nullptr)
+			gDebugDrawTarget->AddBox(transform, halfExtents, color);
+	}
+
+	void Sphere(const glm::vec3 &center, const float radius, const glm::vec4 &color) {
+		if(gDebugDrawTarget != nullptr)
+			gDebugDrawTarget->AddSphere(center, radius, color);
+	}
+};
@@ -0,0 +1,57 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - DebugDraw.h
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+class CRenderer;
+struct CVBO;
+
+struct DebugVertex {
+	glm::vec3 pos;
+	glm::vec4 color;
+};
+
+// Collects debug lines for one frame into a single vertex stream, which is uploaded and drawn in one call
+class CDebugDraw {
+private:
+	std::vector<DebugVertex> verts;
+	CVBO *vbo;
+	size_t uploadedCount;
+	bool isDirty;
+public:
+	CDebugDraw();
+	~CDebugDraw();
+
+	void Clear();
+
+	void AddLine(const glm::vec3 &a, const glm::vec3 &b, const glm::vec4 &color);
+	void AddBox(const glm::vec3 &min, const glm::vec3 &max, const glm::vec4 &color);
+	void AddBox(const glm::mat4 &transform, const glm::vec3 &halfExtents, const glm::vec4 &color);
+	void AddSphere(const glm::vec3 &center, const float radius, const glm::vec4 &color, const uint32_t segments = 16);
+
+	// Expects that a shader is already bound, uploads the vertices only when changed since the last draw
+	void Draw(CRenderer *renderer);
+
+	inline size_t GetLineCount() const { return verts.size() / 2; }
+};
+
+// Global debug drawing API, can be called from anywhere (physics code for example), does nothing without an active target
+namespace DebugDraw {
+	void SetTarget(CDebugDraw *target);
+	bool IsActive();
+	void Line(const glm::vec3 &a, const glm::vec3 &b, const glm::vec4 &color);
+	void Box(const glm::vec3 &min, const glm::vec3 &max, const glm::vec4 &color);
+	void Box(const glm::mat4 &transform, const glm::vec3 &halfExtents, const glm::vec4 &color);
+	void Sphere(const glm::vec3 &center, const float radius, const glm::vec4 &color);
+};
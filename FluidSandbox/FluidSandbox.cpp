@@ -168,6 +168,7 @@ License:
 #include <iostream>
 #include <vector>
 #include <unordered_set>
+#include <unordered_map>
 #include <cstdint>
 #include <typeinfo>
 
@@ -186,12 +187,15 @@ License:
 #include "Frustum.h"
 #include "OSLowLevel.h"
 #include "GLSL.h"
+#include "ShaderCache.h"
 #include "SphericalPointSprites.h"
 #include "Renderer.h"
 #include "Camera.hpp"
 #include "Utils.h"
 #include "ScreenSpaceFluidRendering.h"
 #include "Scenario.h"
+#include "ScenarioLibrary.h"
+#include "ScenarioCache.h"
 #include "Actor.hpp"
 #include "Scene.h"
 #include "Primitives.h"
@@ -199,6 +203,12 @@ License:
 #include "FluidProperties.h"
 #include "GeometryVBO.h"
 #include "PhysicsEngine.h"
+#include "StaticGeometry.h"
+#include "RenderQueue.h"
+#include "DebugDraw.h"
+#include "TextCache.h"
+#include "StartupGraph.h"
+#include "AssetPack.h"
 
 // Assets
 #include "TextureFont.h"
@@ -351,10 +361,14 @@ static FluidProperty gFluidCurrentProperty = FluidProperty::None;
 // Scenario
 static bool gStoppedEmitter = false;
 static glm::vec3 gRigidBodyFallPos(0.0f, 10.0f, 0.0f);
-static std::vector<Scenario *> gScenarios;
+static CScenarioLibrary *gScenarioLibrary = nullptr;
+static CScenarioCache *gScenarioCache = nullptr;
 static Scenario *gActiveScenario = nullptr;
 static int gActiveScenarioIdx = -1;
 static bool gWaterAddBySceneChange = true;
+// How often the active scenario file is checked for changes in seconds
+constexpr float ScenarioWatchInterval = 1.0f;
+static float gScenarioWatchElapsed = 0.0f;
 
 // Renderer
 static CRenderer *gRenderer = nullptr;
@@ -368,7 +382,12 @@ static bool gSSFBlurActive = true;
 static int gSSFCurrentFluidIndex = 0; // // Current fluid color index
 
 // Managers
+// Asset pack, mapped at startup when it exists next to the executable
+static CAssetPack *gAssetPack = nullptr;
+
+static CTextureCache *gTextureCache = nullptr;
 static CTextureManager *gTexMng = nullptr;
+static bool gUseTextureCompression = false;
 
 // Scene
 static CScene *gActiveScene = nullptr;
@@ -380,6 +399,7 @@ static CCamera gCamera;
 static Frustum gFrustum;
 
 // Non fluid rendering
+static CShaderCache *gShaderCache = nullptr;
 static CColoredShader *gColoredShader = nullptr;
 static CLineShader *gLineShader = nullptr;
 static CLightingShader *gLightingShader = nullptr;
@@ -397,15 +417,58 @@ static GeometryVBO *gBoxVBO = nullptr;
 static GeometryVBO *gSphereVBO = nullptr;
 static GeometryVBO *gCylinderVBO = nullptr;
 
-static FontAtlas *gFontAtlas16 = nullptr;
-static FontAtlas *gFontAtlas32 = nullptr;
-static CTextureFont *gFontTexture16 = nullptr;
-static CTextureFont *gFontTexture32 = nullptr;
+// Rigid body instancing
+enum class RigidBodyPrimitive: int {
+	Box = 0,
+	Sphere,
+	Cylinder,
+	Count
+};
+struct RigidBodyInstance {
+	glm::mat4 model;
+	glm::vec4 color;
+};
+struct RigidBodyInstanceBatch {
+	std::vector<RigidBodyInstance> instances;
+};
+static RigidBodyInstanceBatch gRigidBodyBatches[2][(int)RigidBodyPrimitive::Count]; // [Opaque, Blending][Primitive]
+static std::vector<RigidBodyInstance> gRigidBodyInstanceData;
+static DynamicVBO *gRigidBodyInstanceVBO = nullptr;
+static CLightingInstancedShader *gLightingInstancedShader = nullptr;
+static Primitives::Primitive gRigidBodyPrimitives[(int)RigidBodyPrimitive::Count];
+
+// Static geometry batching
+static CStaticGeometry *gStaticGeometry = nullptr;
+static bool gStaticGeometryDirty = false;
+
+// Render queue and counters from the last frame
+static CRenderQueue *gRenderQueue = nullptr;
+static RenderStats gLastRenderStats = {};
+
+// Debug lines, collected once per frame
+static CDebugDraw *gDebugDraw = nullptr;
+static CDebugLineShader *gDebugLineShader = nullptr;
+
+// Fonts which are baked into BakedFonts.h with -bake-fonts, fonts which does not match a baked atlas are packed at runtime
+struct AppFont {
+	const char *name;
+	const uint8_t *data;
+	float size;
+	uint32_t minChar;
+	uint32_t maxChar;
+	bool isSDF;
+};
+// NOTE(final): One distance field atlas renders the OSD at every font height
+static const AppFont gAppFonts[] = {
+	{ "SulphurPoint", sulphurPointRegularData, 32.0f, 32, 255, true },
+};
+
+static FontAtlas *gFontAtlas = nullptr;
+static CTextureFont *gFontTexture = nullptr;
 
-constexpr static uint32_t MaxFontVBOQuadCount = 4096;
-constexpr static uint32_t MaxFontVBOVertexCount = MaxFontVBOQuadCount * 4;
-constexpr static uint32_t MaxFontVBOIndexCount = MaxFontVBOQuadCount * 6;
-static DynamicVBO *gFontVBO = nullptr;
+constexpr static uint32_t MaxOSDLineCount = 64;
+constexpr static uint32_t MaxOSDLineCharCount = 128;
+static CTextCache *gOSDTextCache = nullptr;
 
 // Timing
 static fplSeconds gTotalTimeElapsed = 0;
@@ -594,10 +657,17 @@ static PhysicsRigidBody::MotionKind ToMotionKind(const ActorMovementType movemen
 	}
 }
 
+static void ApplyInitialVelocity(PhysicsRigidBody *rigidBody, const Actor &actor) {
+	if (rigidBody != nullptr && actor.movementType == ActorMovementType::Dynamic) {
+		rigidBody->SetLinearVelocity(actor.velocity);
+	}
+}
+
 static void AddBox(PhysicsEngine &physics, CubeActor &cube) {
 	PhysicsShape shape = PhysicsShape::MakeBox(cube.halfExtents);
 	shape.isParticleDrain = cube.particleDrain;
 	PhysicsRigidBody *rigidBody = physics.AddRigidBody(ToMotionKind(cube.movementType), cube.transform.position, cube.transform.rotation, shape);
+	ApplyInitialVelocity(rigidBody, cube);
 	cube.physicsData = rigidBody;
 }
 
@@ -605,6 +675,7 @@ static void AddSphere(PhysicsEngine &physics, SphereActor &sphere) {
 	PhysicsShape shape = PhysicsShape::MakeSphere(sphere.radius);
 	shape.isParticleDrain = sphere.particleDrain;
 	PhysicsRigidBody *rigidBody = physics.AddRigidBody(ToMotionKind(sphere.movementType), sphere.transform.position, sphere.transform.rotation, shape);
+	ApplyInitialVelocity(rigidBody, sphere);
 	sphere.physicsData = rigidBody;
 }
 
@@ -612,6 +683,7 @@ static void AddCapsule(PhysicsEngine &physics, CapsuleActor &capsule) {
 	PhysicsShape shape = PhysicsShape::MakeCapsule(capsule.radius, capsule.halfHeight);
 	shape.isParticleDrain = capsule.particleDrain;
 	PhysicsRigidBody *rigidBody = physics.AddRigidBody(ToMotionKind(capsule.movementType), capsule.transform.position, capsule.transform.rotation, shape);
+	ApplyInitialVelocity(rigidBody, capsule);
 	capsule.physicsData = rigidBody;
 }
 
@@ -623,6 +695,9 @@ static void AddPlane(PhysicsEngine &physics, PlaneActor &plane) {
 }
 
 static void AddScenarioActor(PhysicsEngine &physics, Actor *actor) {
+	if (actor->movementType == ActorMovementType::Static) {
+		gStaticGeometryDirty = true;
+	}
 	if (actor->type == ActorType::Cube) {
 		CubeActor *cube = static_cast<CubeActor *>(actor);
 		AddBox(physics, *cube);
@@ -658,7 +733,7 @@ static void SingleStepPhysX(const float frametime) {
 }
 
 static void ClearScene(PhysicsEngine &physics) {
-	// Destroy all physics actors
+	// Remove all physics actors, the engine keeps the particle system and the bodies for the next scene
 	physics.Clear();
 	gPhysicsParticles = nullptr;
 	gActiveParticleCount = 0;
@@ -669,6 +744,10 @@ static void ClearScene(PhysicsEngine &physics) {
 		delete actor;
 	}
 	gActors.clear();
+
+	// Static geometry references the actors, so it needs to be rebaked
+	gStaticGeometry->Clear();
+	gStaticGeometryDirty = true;
 }
 
 static Actor *CloneBodyActor(const Actor *actor) {
@@ -709,6 +788,30 @@ static Actor *CloneBodyActor(const Actor *actor) {
 	return(nullptr);
 }
 
+static Actor *AddScenarioBody(PhysicsEngine &physics, const Actor *sourceActor) {
+	Actor *targetActor = CloneBodyActor(sourceActor);
+	if (targetActor != nullptr) {
+		targetActor->timeElapsed = 0.0f;
+		if (targetActor->time == -1) {
+			AddScenarioActor(physics, targetActor);
+		}
+	}
+	return(targetActor);
+}
+
+static FluidActor *AddScenarioFluid(const FluidActor *sourceActor, const bool addParticles) {
+	FluidActor *targetActor = new FluidActor(sourceActor->size, sourceActor->radius, sourceActor->fluidType);
+	targetActor->Assign(sourceActor);
+	targetActor->timeElapsed = 0.0f;
+	targetActor->emitterElapsed = 0.0f;
+	targetActor->emitterCoolDownElapsed = 0.0f;
+	targetActor->emitterCoolDownActive = false;
+	if (targetActor->time == -1 && !targetActor->isEmitter && addParticles) {
+		AddFluid(*gPhysicsParticles, *targetActor, targetActor->fluidType);
+	}
+	return(targetActor);
+}
+
 static void ResetScene(PhysicsEngine &physics) {
 	assert(gActiveScenario != nullptr);
 
@@ -744,29 +847,13 @@ static void ResetScene(PhysicsEngine &physics) {
 	// Add bodies immediately from scenario
 	for (size_t i = 0, count = gActiveScenario->bodies.size(); i < count; i++) {
 		const Actor *sourceActor = gActiveScenario->bodies[i];
-		Actor *targetActor = CloneBodyActor(sourceActor);
-		gActors.push_back(targetActor);
-		if (targetActor != nullptr) {
-			targetActor->timeElapsed = 0.0f;
-			if (targetActor->time == -1) {
-				AddScenarioActor(physics, targetActor);
-			}
-		}
+		gActors.push_back(AddScenarioBody(physics, sourceActor));
 	}
 
 	// Add waters immediately from scenario
 	for (size_t i = 0, count = gActiveScenario->fluids.size(); i < count; i++) {
 		const FluidActor *sourceActor = gActiveScenario->fluids[i];
-		FluidActor *targetActor = new FluidActor(sourceActor->size, sourceActor->radius, sourceActor->fluidType);
-		targetActor->Assign(sourceActor);
-		targetActor->timeElapsed = 0.0f;
-		targetActor->emitterElapsed = 0.0f;
-		targetActor->emitterCoolDownElapsed = 0.0f;
-		targetActor->emitterCoolDownActive = false;
-		gActors.push_back(targetActor);
-		if (targetActor->time == -1 && !targetActor->isEmitter && gWaterAddBySceneChange) {
-			AddFluid(*gPhysicsParticles, *targetActor, targetActor->fluidType);
-		}
+		gActors.push_back(AddScenarioFluid(sourceActor, gWaterAddBySceneChange));
 	}
 
 	gTotalTimeElapsed = 0;
@@ -774,6 +861,175 @@ static void ResetScene(PhysicsEngine &physics) {
 	SingleStepPhysX(PhysXInitDT);
 }
 
+static bool IsSameBodyPhysics(const Actor &live, const Actor &source) {
+	if (live.type != source.type || live.movementType != source.movementType || live.time != source.time) return(false);
+	if (live.transform.position != source.transform.position || live.transform.rotation != source.transform.rotation) return(false);
+	if (live.density != source.density || live.particleDrain != source.particleDrain || live.velocity != source.velocity) return(false);
+	switch (source.type) {
+		case ActorType::Cube:
+			return static_cast<const CubeActor &>(live).halfExtents == static_cast<const CubeActor &>(source).halfExtents;
+		case ActorType::Sphere:
+			return static_cast<const SphereActor &>(live).radius == static_cast<const SphereActor &>(source).radius;
+		case ActorType::Capsule:
+		{
+			const CapsuleActor &liveCapsule = static_cast<const CapsuleActor &>(live);
+			const CapsuleActor &sourceCapsule = static_cast<const CapsuleActor &>(source);
+			return liveCapsule.radius == sourceCapsule.radius && liveCapsule.halfHeight == sourceCapsule.halfHeight;
+		}
+		default:
+			return(true);
+	}
+}
+
+static bool IsSameFluid(const FluidActor &live, const FluidActor &source) {
+	bool result =
+		live.transform.position == source.transform.position &&
+		live.velocity == source.velocity &&
+		live.size == source.size &&
+		live.radius == source.radius &&
+		live.fluidType == source.fluidType &&
+		live.time == source.time &&
+		live.isEmitter == source.isEmitter &&
+		live.emitterRate == source.emitterRate &&
+		live.emitterDuration == source.emitterDuration &&
+		live.emitterCoolDown == source.emitterCoolDown;
+	return(result);
+}
+
+static void RemoveScenarioBody(PhysicsEngine &physics, Actor *actor) {
+	if (actor->physicsData != nullptr) {
+		if (actor->movementType == ActorMovementType::Static) {
+			gStaticGeometryDirty = true;
+		}
+		physics.DeleteRigidBody(static_cast<PhysicsRigidBody *>(actor->physicsData));
+		actor->physicsData = nullptr;
+	}
+	delete actor;
+}
+
+// Applies the active scenario to the running scene without clearing the physics scene or the particles.
+// Scenario actors are matched by their stable id: Removed actors are destroyed, new ones are added and changed ones are replaced,
+// unchanged actors keep their physics state. Changed fluids keep their particles, only new fluids add particles.
+static void ReloadScene(PhysicsEngine &physics) {
+	assert(gActiveScenario != nullptr);
+	assert(gPhysicsParticles != nullptr);
+
+	// NOTE(final): The particle grid cannot be changed on a live particle system, so that requires a full reset
+	const FluidSimulationProperties &sim = gActiveScenario->sim;
+	if (sim.particleRadius != gCurrentProperties.sim.particleRadius || sim.restParticleDistance != gCurrentProperties.sim.restParticleDistance || sim.cellSize != gCurrentProperties.sim.cellSize) {
+		ResetScene(physics);
+		return;
+	}
+
+	printf("Incremental reload scene: %s\n", gActiveScenario->displayName);
+
+	// Scene and fluid properties
+	physics.SetGravity(gActiveScenario->gravity);
+	gRigidBodyFallPos = gActiveScenario->actorCreatePosition;
+	gCurrentProperties.render = gActiveScenario->render;
+	if (memcmp(&sim, &gCurrentProperties.sim, sizeof(sim)) != 0) {
+		gCurrentProperties.sim = sim;
+		physics.ConfigureParticleSystem(gPhysicsParticles, sim);
+	}
+
+	// Index the scenario actors
+	std::unordered_map<uint64_t, const Actor *> bodySources;
+	std::unordered_map<uint64_t, const FluidActor *> fluidSources;
+	bodySources.reserve(gActiveScenario->bodies.size());
+	fluidSources.reserve(gActiveScenario->fluids.size());
+	for (size_t i = 0, count = gActiveScenario->bodies.size(); i < count; i++) {
+		const Actor *sourceActor = gActiveScenario->bodies[i];
+		if (!bodySources.insert(std::make_pair(sourceActor->id, sourceActor)).second) {
+			std::cerr << "  Duplicate actor id in scenario '" << gActiveScenario->displayName << "', only the first actor is reloaded!" << std::endl;
+		}
+	}
+	for (size_t i = 0, count = gActiveScenario->fluids.size(); i < count; i++) {
+		const FluidActor *sourceActor = gActiveScenario->fluids[i];
+		if (!fluidSources.insert(std::make_pair(sourceActor->id, sourceActor)).second) {
+			std::cerr << "  Duplicate fluid id in scenario '" << gActiveScenario->displayName << "', only the first fluid is reloaded!" << std::endl;
+		}
+	}
+
+	// Diff the live scenario actors, actors created at runtime have no id and are kept as they are
+	size_t removedCount = 0, changedCount = 0, addedCount = 0;
+	size_t writeIndex = 0;
+	for (size_t readIndex = 0, count = gActors.size(); readIndex < count; ++readIndex) {
+		Actor *actor = gActors[readIndex];
+		if (actor->id != 0 && actor->type == ActorType::Fluid) {
+			FluidActor *fluid = static_cast<FluidActor *>(actor);
+			auto found = fluidSources.find(actor->id);
+			if (found == fluidSources.end()) {
+				delete fluid;
+				++removedCount;
+				continue;
+			}
+			const FluidActor *sourceActor = found->second;
+			fluidSources.erase(found);
+			if (!IsSameFluid(*fluid, *sourceActor)) {
+				delete fluid;
+				actor = AddScenarioFluid(sourceActor, false);
+				++changedCount;
+			}
+		} else if (actor->id != 0) {
+			auto found = bodySources.find(actor->id);
+			if (found == bodySources.end()) {
+				RemoveScenarioBody(physics, actor);
+				++removedCount;
+				continue;
+			}
+			const Actor *sourceActor = found->second;
+			bodySources.erase(found);
+			if (!IsSameBodyPhysics(*actor, *sourceActor)) {
+				RemoveScenarioBody(physics, actor);
+				actor = AddScenarioBody(physics, sourceActor);
+				++changedCount;
+			} else if (actor->color != sourceActor->color || actor->visible != sourceActor->visible || actor->blending != sourceActor->blending) {
+				// Visual properties only, the rigid body is kept
+				if (actor->movementType == ActorMovementType::Static) {
+					gStaticGeometryDirty = true;
+				}
+				actor->color = sourceActor->color;
+				actor->visible = sourceActor->visible;
+				actor->blending = sourceActor->blending;
+				++changedCount;
+			}
+		}
+		gActors[writeIndex++] = actor;
+	}
+	gActors.resize(writeIndex);
+
+	// Add the new actors in scenario order
+	for (size_t i = 0, count = gActiveScenario->bodies.size(); i < count; i++) {
+		const Actor *sourceActor = gActiveScenario->bodies[i];
+		if (bodySources.erase(sourceActor->id) > 0) {
+			gActors.push_back(AddScenarioBody(physics, sourceActor));
+			++addedCount;
+		}
+	}
+	for (size_t i = 0, count = gActiveScenario->fluids.size(); i < count; i++) {
+		const FluidActor *sourceActor = gActiveScenario->fluids[i];
+		if (fluidSources.erase(sourceActor->id) > 0) {
+			gActors.push_back(AddScenarioFluid(sourceActor, gWaterAddBySceneChange));
+			++addedCount;
+		}
+	}
+
+	printf("  Removed %zu, changed %zu and added %zu actors\n", removedCount, changedCount, addedCount);
+}
+
+// Reloads the active scenario when its file has changed, see ReloadScene
+static void WatchActiveScenario(const float frametime) {
+	if (gScenarioLibrary == nullptr || gActiveScenario == nullptr || gActiveScenarioIdx < 0) return;
+	gScenarioWatchElapsed += frametime;
+	if (gScenarioWatchElapsed < ScenarioWatchInterval) return;
+	gScenarioWatchElapsed = 0.0f;
+	Scenario *scenario = gScenarioLibrary->Get(gActiveScenarioIdx);
+	if (scenario != nullptr && scenario != gActiveScenario) {
+		gActiveScenario = scenario;
+		ReloadScene(*gPhysics);
+	}
+}
+
 void InitializePhysics() {
 	// CPU Dispatcher based on number of cpu cores
 	uint32_t coreCount = COSLowLevel::getNumCPUCores();
@@ -790,36 +1046,19 @@ void InitializePhysics() {
 	gPhysicsUseGPUAcceleration = gPhysics->IsGPUAcceleration();
 }
 
-void DrawFontsVBO(const glm::mat4 &mvp, DynamicVBO *vbo, const uint32_t triangleIndexCount) {
-	size_t stride = vbo->reservedVertexStride;
-
-	// Vertex (vec4, vec2, vec2)
-	vbo->Bind();
-
-	glEnableClientState(GL_COLOR_ARRAY);
-	glEnableClientState(GL_VERTEX_ARRAY);
-	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-	glColorPointer(4, GL_FLOAT, (GLsizei)stride, (void *)(offsetof(FontVertex, color)));
-	glVertexPointer(2, GL_FLOAT, (GLsizei)stride, (void *)(offsetof(FontVertex, pos)));
-	glTexCoordPointer(2, GL_FLOAT, (GLsizei)stride, (void *)(offsetof(FontVertex, uv)));
-	gRenderer->DrawVBO(vbo, GL_TRIANGLES, triangleIndexCount, 0);
-	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-	glDisableClientState(GL_VERTEX_ARRAY);
-	glDisableClientState(GL_COLOR_ARRAY);
-
-	vbo->Unbind();
-
-	GLenum err = glGetError();
-	assert(err == GL_NO_ERROR);
-}
-
-static void DrawGrid(const glm::mat4 &mvp) {
+static void DrawGridPacket(CRenderer *renderer, const RenderPacket &packet, const glm::mat4 &viewProj) {
 	glm::vec4 color = glm::vec4(0.25f, 0.25f, 0.25f, 1.0f);
-	gLineShader->enable();
 	gLineShader->uniform4f(gLineShader->ulocColor, &color[0]);
-	gLineShader->uniformMatrix4(gLineShader->ulocMVP, &mvp[0][0]);
-	gRenderer->DrawPrimitive(gGridVBO, true);
-	gLineShader->disable();
+	gLineShader->uniformMatrix4(gLineShader->ulocMVP, &viewProj[0][0]);
+	renderer->DrawPrimitive(gGridVBO, true);
+}
+
+static void EnqueueGrid() {
+	RenderPacket packet = {};
+	packet.state = RenderState(false, true, gDrawWireframe);
+	packet.shader = gLineShader;
+	packet.draw = DrawGridPacket;
+	gRenderQueue->Push(RenderPass::Opaque, packet, gGridVBO, gRenderQueue->ComputeDepth(glm::vec3(0.0f)));
 }
 
 
@@ -837,6 +1076,12 @@ void UpdatePhysX(const float frametime) {
 	if (!gPaused) {
 		SingleStepPhysX(frametime);
 	}
+
+	// Collect debug lines for this frame
+	gDebugDraw->Clear();
+	if (gDrawBoundBox) {
+		gPhysics->DrawDebug();
+	}
 }
 
 glm::mat4 ComputeGlobalPose(const PhysicsTransform &bodyTransform, const PhysicsTransform &shapeTransform) {
@@ -846,103 +1091,199 @@ glm::mat4 ComputeGlobalPose(const PhysicsTransform &bodyTransform, const Physics
 	return(result);
 }
 
-void DrawBoxShape(const glm::mat4 &cameraMVP, const PhysicsTransform &bodyTransform, const PhysicsTransform &shapeTransform, const PhysicsBoxShape &box, const glm::vec4 &color) {
-	glm::vec3 scale = box.halfExtents;
-	glm::mat4 modelView = ComputeGlobalPose(bodyTransform, shapeTransform);
-	glm::mat4 modelViewScaled = glm::scale(modelView, scale);
-	glm::mat4 mvp = cameraMVP * modelViewScaled;
-
-	gLightingShader->enable();
-	gLightingShader->uniform4f(gLightingShader->ulocColor, &color[0]);
-	gLightingShader->uniformMatrix4(gLightingShader->ulocMVP, &mvp[0][0]);
-	gRenderer->DrawPrimitive(gBoxVBO, false);
-	gLightingShader->disable();
+static void PushRigidBodyInstance(const RigidBodyPrimitive primitive, const bool isBlending, const glm::mat4 &model, const glm::vec4 &color) {
+	RigidBodyInstanceBatch &batch = gRigidBodyBatches[isBlending ? 1 : 0][(int)primitive];
+	RigidBodyInstance instance;
+	instance.model = model;
+	instance.color = color;
+	batch.instances.push_back(instance);
 }
 
-void DrawSphereShape(const glm::mat4 &cameraMVP, const PhysicsTransform &bodyTransform, const PhysicsTransform &shapeTransform, const PhysicsSphereShape &sphere, const glm::vec4 &color) {
-	glm::vec3 scale = glm::vec3(sphere.radius);
-	glm::mat4 modelView = ComputeGlobalPose(bodyTransform, shapeTransform);
-	glm::mat4 modelViewScaled = glm::scale(modelView, scale);
-	glm::mat4 mvp = cameraMVP * modelViewScaled;
+static uint32_t GetShapeInstances(const PhysicsTransform &bodyTransform, const PhysicsShape &shape, RigidBodyPrimitive outPrimitives[3], glm::mat4 outModels[3]) {
+	glm::mat4 model = ComputeGlobalPose(bodyTransform, shape.local);
+	switch (shape.type) {
+		case PhysicsShape::Type::Box:
+		{
+			outPrimitives[0] = RigidBodyPrimitive::Box;
+			outModels[0] = glm::scale(model, shape.box.halfExtents);
+			return(1);
+		}
 
-	gLightingShader->enable();
-	gLightingShader->uniform4f(gLightingShader->ulocColor, &color[0]);
-	gLightingShader->uniformMatrix4(gLightingShader->ulocMVP, &mvp[0][0]);
-	gRenderer->DrawPrimitive(gSphereVBO, false);
-	gLightingShader->disable();
-}
+		case PhysicsShape::Type::Sphere:
+		{
+			outPrimitives[0] = RigidBodyPrimitive::Sphere;
+			outModels[0] = glm::scale(model, glm::vec3(shape.sphere.radius));
+			return(1);
+		}
 
-void DrawCapsuleShape(const glm::mat4 &cameraMVP, const PhysicsTransform &bodyTransform, const PhysicsTransform &shapeTransform, const PhysicsCapsuleShape &capsule, const glm::vec4 &color) {
-	float radius = capsule.radius;
-	float halfHeight = capsule.halfHeight;
+		case PhysicsShape::Type::Capsule:
+		{
+			// Capsule is a cylinder with two spheres at each end
+			float radius = shape.capsule.radius;
+			float halfHeight = shape.capsule.halfHeight;
 
-	glm::mat4 modelView = ComputeGlobalPose(bodyTransform, shapeTransform);
-	glm::mat4 baseMvp = cameraMVP * modelView;
+			glm::mat4 rotation = glm::rotate(model, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f));
 
-	gLightingShader->enable();
-	gLightingShader->uniform4f(gLightingShader->ulocColor, &color[0]);
+			outPrimitives[0] = RigidBodyPrimitive::Cylinder;
+			outModels[0] = glm::scale(rotation, glm::vec3(radius, radius, 2.0f * halfHeight));
 
-	glm::mat4 rotationMVP = glm::rotate(baseMvp, glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+			glm::mat4 translation1 = glm::translate(rotation, glm::vec3(0.0f, 0.0f, -halfHeight));
+			outPrimitives[1] = RigidBodyPrimitive::Sphere;
+			outModels[1] = glm::scale(translation1, glm::vec3(radius));
 
-	glm::mat4 translation0 = glm::translate(rotationMVP, glm::vec3(0.0f, 0.0f, 0.0f));
-	glm::mat4 scaled0 = glm::scale(translation0, glm::vec3(radius, radius, 2.0f * halfHeight));
-	gLightingShader->uniformMatrix4(gLightingShader->ulocMVP, &scaled0[0][0]);
-	gRenderer->DrawPrimitive(gCylinderVBO, false);
+			glm::mat4 translation2 = glm::translate(rotation, glm::vec3(0.0f, 0.0f, halfHeight));
+			outPrimitives[2] = RigidBodyPrimitive::Sphere;
+			outModels[2] = glm::scale(translation2, glm::vec3(radius));
+			return(3);
+		}
 
-	glm::mat4 translation1 = glm::translate(rotationMVP, glm::vec3(0.0f, 0.0f, -halfHeight));
-	glm::mat4 scaled1 = glm::scale(translation1, glm::vec3(radius));
-	gLightingShader->uniformMatrix4(gLightingShader->ulocMVP, &scaled1[0][0]);
-	gRenderer->DrawPrimitive(gSphereVBO, false);
+		default:
+			return(0);
+	}
+}
 
-	glm::mat4 translation2 = glm::translate(rotationMVP, glm::vec3(0.0f, 0.0f, halfHeight));
-	glm::mat4 scaled2 = glm::scale(translation2, glm::vec3(radius));
-	gLightingShader->uniformMatrix4(gLightingShader->ulocMVP, &scaled2[0][0]);
-	gRenderer->DrawPrimitive(gSphereVBO, false);
+void PushShapeInstances(const PhysicsTransform &bodyTransform, const PhysicsShape &shape, const glm::vec4 &color, const bool isBlending) {
+	RigidBodyPrimitive primitives[3];
+	glm::mat4 models[3];
+	uint32_t count = GetShapeInstances(bodyTransform, shape, primitives, models);
+	for (uint32_t i = 0; i < count; ++i) {
+		PushRigidBodyInstance(primitives[i], isBlending, models[i], color);
+	}
+}
 
-	gLightingShader->disable();
+static bool IsStaticBatched(const Actor &actor, const PhysicsRigidBody &rigidBody) {
+	bool result = rigidBody.motionKind == PhysicsRigidBody::MotionKind::Static && !actor.blending && actor.visible;
+	return(result);
 }
 
-void DrawShape(const glm::mat4 &mvp, const PhysicsTransform &bodyTransform, const PhysicsShape &shape, const glm::vec4 &color) {
-	switch (shape.type) {
-		case PhysicsShape::Type::Box:
-			DrawBoxShape(mvp, bodyTransform, shape.local, shape.box, color);
-			break;
+static void BuildStaticGeometry() {
+	gStaticGeometry->Begin();
+	for (size_t index = 0, count = gActors.size(); index < count; ++index) {
+		const Actor *actor = gActors[index];
+		if (actor->physicsData == nullptr) continue;
+		const PhysicsActor *pactor = static_cast<const PhysicsActor *>(actor->physicsData);
+		if (pactor->type != PhysicsActor::Type::RigidBody) continue;
+		const PhysicsRigidBody *rigidBody = static_cast<const PhysicsRigidBody *>(pactor);
+		if (!IsStaticBatched(*actor, *rigidBody)) continue;
+		bool isNewActor = true;
+		for (size_t shapeIndex = 0; shapeIndex < rigidBody->shapeCount; ++shapeIndex) {
+			RigidBodyPrimitive primitives[3];
+			glm::mat4 models[3];
+			uint32_t instanceCount = GetShapeInstances(rigidBody->transform, rigidBody->shapes[shapeIndex], primitives, models);
+			for (uint32_t i = 0; i < instanceCount; ++i) {
+				gStaticGeometry->AddPrimitive(gRigidBodyPrimitives[(int)primitives[i]], models[i], actor->color, isNewActor);
+				isNewActor = false;
+			}
+		}
+	}
+	gStaticGeometry->End();
+	gStaticGeometryDirty = false;
+}
+
+static void DrawRigidBodyInstances(GeometryVBO *vbo, const size_t firstInstance, const GLuint instanceCount) {
+	CLightingInstancedShader *shader = gLightingInstancedShader;
+	GLint modelLoc = shader->alocInstanceModel;
+	GLint colorLoc = shader->alocInstanceColor;
+	assert(modelLoc != -1 && colorLoc != -1);
+
+	if (gRenderer->IsInstancingSupported()) {
+		// Per-instance attributes (mat4, vec4) are sourced from the instance buffer, advancing once per instance
+		size_t baseOffset = firstInstance * sizeof(RigidBodyInstance);
+		glBindBuffer(GL_ARRAY_BUFFER, gRigidBodyInstanceVBO->vboId);
+		for (int column = 0; column < 4; ++column) {
+			GLint loc = modelLoc + column;
+			glEnableVertexAttribArray(loc);
+			glVertexAttribPointer(loc, 4, GL_FLOAT, GL_FALSE, sizeof(RigidBodyInstance), (void *)(baseOffset + offsetof(RigidBodyInstance, model) + sizeof(glm::vec4) * column));
+			glVertexAttribDivisor(loc, 1);
+		}
+		glEnableVertexAttribArray(colorLoc);
+		glVertexAttribPointer(colorLoc, 4, GL_FLOAT, GL_FALSE, sizeof(RigidBodyInstance), (void *)(baseOffset + offsetof(RigidBodyInstance, color)));
+		glVertexAttribDivisor(colorLoc, 1);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		gRenderer->DrawPrimitiveInstanced(vbo, instanceCount);
+
+		glVertexAttribDivisor(colorLoc, 0);
+		glDisableVertexAttribArray(colorLoc);
+		for (int column = 0; column < 4; ++column) {
+			GLint loc = modelLoc + column;
+			glVertexAttribDivisor(loc, 0);
+			glDisableVertexAttribArray(loc);
+		}
+	} else {
+		// No instancing available, so we feed the instance data as constant attributes and draw one by one
+		for (GLuint instanceIndex = 0; instanceIndex < instanceCount; ++instanceIndex) {
+			const RigidBodyInstance &instance = gRigidBodyInstanceData[firstInstance + instanceIndex];
+			for (int column = 0; column < 4; ++column) {
+				glVertexAttrib4fv(modelLoc + column, &instance.model[column][0]);
+			}
+			glVertexAttrib4fv(colorLoc, &instance.color[0]);
+			gRenderer->DrawPrimitive(vbo, false);
+		}
+	}
+}
 
-		case PhysicsShape::Type::Sphere:
-			DrawSphereShape(mvp, bodyTransform, shape.local, shape.sphere, color);
-			break;
+static void DrawRigidBodyInstancesPacket(CRenderer *renderer, const RenderPacket &packet, const glm::mat4 &viewProj) {
+	gLightingInstancedShader->uniformMatrix4(gLightingInstancedShader->ulocViewProj, &viewProj[0][0]);
+	DrawRigidBodyInstances((GeometryVBO *)packet.userData, packet.param0, packet.param1);
+}
 
-		case PhysicsShape::Type::Capsule:
-			DrawCapsuleShape(mvp, bodyTransform, shape.local, shape.capsule, color);
-			break;
+static void EnqueueRigidBodyInstances() {
+	// Pack all batches into a single instance stream, so we upload only once per pass
+	size_t batchOffsets[2][(int)RigidBodyPrimitive::Count];
+	gRigidBodyInstanceData.clear();
+	for (int blendIndex = 0; blendIndex < 2; ++blendIndex) {
+		for (int primitiveIndex = 0; primitiveIndex < (int)RigidBodyPrimitive::Count; ++primitiveIndex) {
+			const RigidBodyInstanceBatch &batch = gRigidBodyBatches[blendIndex][primitiveIndex];
+			batchOffsets[blendIndex][primitiveIndex] = gRigidBodyInstanceData.size();
+			gRigidBodyInstanceData.insert(gRigidBodyInstanceData.end(), batch.instances.begin(), batch.instances.end());
+		}
+	}
+	if (gRigidBodyInstanceData.size() == 0) {
+		return;
+	}
+
+	if (gRenderer->IsInstancingSupported()) {
+		gRigidBodyInstanceVBO->BufferVertices((const GLfloat *)&gRigidBodyInstanceData[0], sizeof(RigidBodyInstance) * gRigidBodyInstanceData.size(), GL_STREAM_DRAW);
 	}
-}
 
-void DrawBounds(const glm::mat4 &cameraMVP, const PhysicsBoundingBox &bounds) {
-	glm::vec3 center = bounds.GetCenter();
-	glm::vec3 ext = bounds.GetSize() * 0.5f;
-	glm::vec4 color = glm::vec4(0, 1, 1, 1);
+	GeometryVBO *primitiveVBOs[(int)RigidBodyPrimitive::Count] = { gBoxVBO, gSphereVBO, gCylinderVBO };
 
-	glm::mat4 translation = glm::translate(glm::mat4(1.0f), center);
-	glm::mat4 scaled = glm::scale(translation, ext);
-	glm::mat4 mvp = cameraMVP * scaled;
+	// Blended batches are drawn without depth testing in the transparent pass
+	for (int blendIndex = 0; blendIndex < 2; ++blendIndex) {
+		bool isBlending = blendIndex == 1;
+		for (int primitiveIndex = 0; primitiveIndex < (int)RigidBodyPrimitive::Count; ++primitiveIndex) {
+			const RigidBodyInstanceBatch &batch = gRigidBodyBatches[blendIndex][primitiveIndex];
+			if (batch.instances.size() == 0) {
+				continue;
+			}
+			RenderPacket packet = {};
+			packet.state = RenderState(isBlending, !isBlending, gDrawWireframe);
+			packet.shader = gLightingInstancedShader;
+			packet.draw = DrawRigidBodyInstancesPacket;
+			packet.userData = primitiveVBOs[primitiveIndex];
+			packet.param0 = (uint32_t)batchOffsets[blendIndex][primitiveIndex];
+			packet.param1 = (uint32_t)batch.instances.size();
+			gRenderQueue->Push(isBlending ? RenderPass::Transparent : RenderPass::Opaque, packet, primitiveVBOs[primitiveIndex], 0.0f);
+		}
+	}
+}
 
-	gLineShader->enable();
-	gLineShader->uniform4f(gLineShader->ulocColor, &color[0]);
-	gLineShader->uniformMatrix4(gLineShader->ulocMVP, &mvp[0][0]);
-	gRenderer->DrawPrimitive(gBoxVBO, true);
-	gLineShader->disable();
+static void DrawDebugPacket(CRenderer *renderer, const RenderPacket &packet, const glm::mat4 &viewProj) {
+	gDebugLineShader->uniformMatrix4(gDebugLineShader->ulocMVP, &viewProj[0][0]);
+	gDebugDraw->Draw(renderer);
 }
 
-void DrawActorBounds(const glm::mat4 &mvp, const PhysicsActor &physicsActor) {
-	PhysicsBoundingBox bounds = physicsActor.bounds;
-	if (gFrustum.containsBounds(bounds.min, bounds.max)) {
-		gDrawedActors++;
-		DrawBounds(mvp, bounds);
-	}
+static void EnqueueDebugDraw() {
+	if (gDebugDraw->GetLineCount() == 0) return;
+	RenderPacket packet = {};
+	packet.state = RenderState(false, true, gDrawWireframe);
+	packet.shader = gDebugLineShader;
+	packet.draw = DrawDebugPacket;
+	gRenderQueue->Push(RenderPass::Overlay, packet, nullptr, 0.0f);
 }
 
-void DrawRigidBody(const glm::mat4 &mvp, const Actor &actor, const PhysicsRigidBody &rigidBody, const bool isVisible, const bool isBlending) {
+void DrawRigidBody(const Actor &actor, const PhysicsRigidBody &rigidBody, const bool isVisible, const bool isBlending) {
 	PhysicsBoundingBox bounds = rigidBody.bounds;
 	if (gFrustum.containsBounds(bounds.min, bounds.max)) {
 		if (isVisible) {
@@ -950,19 +1291,9 @@ void DrawRigidBody(const glm::mat4 &mvp, const Actor &actor, const PhysicsRigidB
 			if (rigidBody.motionKind == PhysicsRigidBody::MotionKind::Dynamic && !gHideDynamicRigidBodies ||
 				rigidBody.motionKind == PhysicsRigidBody::MotionKind::Static && !gHideStaticRigidBodies) {
 
-				if (isBlending) {
-					gRenderer->SetBlending(true);
-					gRenderer->SetDepthTest(false);
-				}
-
 				for (size_t shapeIndex = 0; shapeIndex < rigidBody.shapeCount; ++shapeIndex) {
 					const PhysicsShape &shape = rigidBody.shapes[shapeIndex];
-					DrawShape(mvp, rigidBody.transform, shape, actor.color);
-				}
-
-				if (isBlending) {
-					gRenderer->SetBlending(false);
-					gRenderer->SetDepthTest(true);
+					PushShapeInstances(rigidBody.transform, shape, actor.color, isBlending);
 				}
 
 				gDrawedActors++;
@@ -971,29 +1302,39 @@ void DrawRigidBody(const glm::mat4 &mvp, const Actor &actor, const PhysicsRigidB
 	}
 }
 
-void RenderActors(const glm::mat4 &mvp) {
-	// Render all the actors in the scene
+void EnqueueActors() {
+	// Rebake static geometry when static actors were added or removed
+	if (gStaticGeometryDirty) {
+		BuildStaticGeometry();
+	}
+
+	// Draw all static geometry at once
+	if (!gHideStaticRigidBodies) {
+		gDrawedActors += gStaticGeometry->Enqueue(*gRenderQueue, gLightingShader, RenderState(false, true, gDrawWireframe), gFrustum);
+	}
+
+	// Reset instance batches from the previous pass
+	for (int blendIndex = 0; blendIndex < 2; ++blendIndex) {
+		for (int primitiveIndex = 0; primitiveIndex < (int)RigidBodyPrimitive::Count; ++primitiveIndex) {
+			gRigidBodyBatches[blendIndex][primitiveIndex].instances.clear();
+		}
+	}
+
+	// Collect all the actors in the scene into instance batches
 	for (size_t index = 0, count = gActors.size(); index < count; ++index) {
 		Actor *actor = gActors[index];
 		if (actor->physicsData != nullptr) {
 			PhysicsActor *pactor = static_cast<PhysicsActor *>(actor->physicsData);
 			if (pactor->type == PhysicsActor::Type::RigidBody) {
 				PhysicsRigidBody *rigidBody = static_cast<PhysicsRigidBody *>(pactor);
-				DrawRigidBody(mvp, *actor, *rigidBody, actor->visible, actor->blending);
+				if (IsStaticBatched(*actor, *rigidBody)) continue;
+				DrawRigidBody(*actor, *rigidBody, actor->visible, actor->blending);
 			}
 		}
 	}
-}
 
-void RenderActorBoundings(const glm::mat4 &mvp) {
-	// Render all the actors in the scene as bounding volume
-	for (size_t index = 0, count = gActors.size(); index < count; ++index) {
-		Actor *actor = gActors[index];
-		if (actor->physicsData != nullptr) {
-			PhysicsActor *pactor = static_cast<PhysicsActor *>(actor->physicsData);
-			DrawActorBounds(mvp, *pactor);
-		}
-	}
+	// Draw each primitive type at once
+	EnqueueRigidBodyInstances();
 }
 
 const char *GetFluidProperty(const FluidProperty prop) {
@@ -1201,6 +1542,9 @@ void Update(const glm::mat4 &proj, const glm::mat4 &modl, const float frametime)
 	// Update frustum
 	gFrustum.update(&proj[0][0], &modl[0][0]);
 
+	// Reload scenario when its file has changed
+	WatchActiveScenario(frametime);
+
 	// Create actor based on time
 	if (!gPaused) {
 		CreateActorsBasedOnTime(frametime * 1000.0f);
@@ -1212,23 +1556,17 @@ void Update(const glm::mat4 &proj, const glm::mat4 &modl, const float frametime)
 
 struct OSDRenderPosition {
 	CTextureFont *fontTexture;
-	VBOWritter *writer;
 	float x;
 	float y;
 	float fontHeight;
 	float lineHeight;
 
-	OSDRenderPosition(VBOWritter *writer, const float fontHeight, const float lineHeight):
-		fontTexture(nullptr),
-		writer(writer),
+	OSDRenderPosition(const float fontHeight, const float lineHeight):
+		fontTexture(gFontTexture),
 		x(0),
 		y(0),
 		fontHeight(fontHeight),
 		lineHeight(lineHeight) {
-		if (fontHeight <= 32)
-			fontTexture = gFontTexture16;
-		else
-			fontTexture = gFontTexture32;
 	}
 
 	void newLine() {
@@ -1238,10 +1576,8 @@ struct OSDRenderPosition {
 
 void RenderOSDLine(OSDRenderPosition &osdpos, char *value) {
 	assert(osdpos.fontTexture != nullptr);
-	assert(osdpos.writer != nullptr);
 	const FontAtlas *fontAtlas = &osdpos.fontTexture->GetAtlas();
-	gRenderer->DrawString(fontAtlas, osdpos.x, osdpos.y, osdpos.fontHeight, value, glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), *osdpos.writer);
-	gRenderer->DrawString(fontAtlas, osdpos.x + 1, osdpos.y + 1, osdpos.fontHeight, value, glm::vec4(1, 1, 1, 1), *osdpos.writer);
+	gOSDTextCache->AddLine(gRenderer, fontAtlas, osdpos.x, osdpos.y, osdpos.fontHeight, value, glm::vec4(1, 1, 1, 1), glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
 	osdpos.newLine();
 }
 
@@ -1267,20 +1603,21 @@ void RenderOSD(const int windowWidth, const int windowHeight) {
 		glm::vec3 backTranslation = glm::vec3(backScale.x * 0.5f, backScale.y * 0.5f, 0.0f);
 		glm::mat4 backView = glm::translate(glm::mat4(1.0f), backTranslation) * glm::scale(glm::mat4(1.0f), backScale);
 		glm::mat4 backMVP = orthoProj * backView;
-		gColoredShader->enable();
+		gRenderer->BindShader(gColoredShader);
 		gColoredShader->uniform4f(gColoredShader->ulocColor, &backColor[0]);
 		gColoredShader->uniformMatrix4(gColoredShader->ulocMVP, &backMVP[0][0]);
 		gRenderer->DrawPrimitive(gQuadVBO, false);
-		gColoredShader->disable();
+		gRenderer->UnbindShader();
 	}
 
 	// Font height is proportional to window height
 	const float targetFontScale = 0.0225f;
 	float fontHeight = (float)windowHeight * targetFontScale;
 
-	VBOWritter fontWriter = gFontVBO->BeginWrite();
+	// Lines are only rebuilt when their text has changed
+	gOSDTextCache->Begin();
 
-	OSDRenderPosition osdPos = OSDRenderPosition(&fontWriter, fontHeight, fontHeight * 0.9f);
+	OSDRenderPosition osdPos = OSDRenderPosition(fontHeight, fontHeight * 0.9f);
 	osdPos.x = 20;
 	osdPos.y = 20;
 
@@ -1293,6 +1630,8 @@ void RenderOSD(const int windowWidth, const int windowHeight) {
 	if (gShowOSD) {
 		sprintf_s(buffer, "Drawed actors: %zu of %zu", gDrawedActors, gTotalActors);
 		RenderOSDLine(osdPos, buffer);
+		sprintf_s(buffer, "Draw calls: %u, State changes: %u, Shader binds: %u", gLastRenderStats.drawCalls, gLastRenderStats.stateChanges, gLastRenderStats.shaderBinds);
+		RenderOSDLine(osdPos, buffer);
 		sprintf_s(buffer, "Total fluid particles: %lu", gActiveParticleCount);
 		RenderOSDLine(osdPos, buffer);
 		sprintf_s(buffer, "Draw error: %s", drawingError.c_str());
@@ -1357,7 +1696,7 @@ void RenderOSD(const int windowWidth, const int windowHeight) {
 		RenderOSDLine(osdPos, buffer);
 		sprintf_s(buffer, "    Fluid color falloff alpha: %f", activeFluidColor.falloff.w);
 		RenderOSDLine(osdPos, buffer);
-		sprintf_s(buffer, "Fluid scenario (L): %d / %zu - %s", gActiveScenarioIdx + 1, gScenarios.size(), gActiveScenario ? gActiveScenario->displayName : "No scenario loaded!");
+		sprintf_s(buffer, "Fluid scenario (L): %d / %zu - %s", gActiveScenarioIdx + 1, gScenarioLibrary->GetCount(), gActiveScenario ? gActiveScenario->displayName : "No scenario loaded!");
 		RenderOSDLine(osdPos, buffer);
 		sprintf_s(buffer, "New actor (Space)");
 		RenderOSDLine(osdPos, buffer);
@@ -1385,21 +1724,21 @@ void RenderOSD(const int windowWidth, const int windowHeight) {
 		RenderOSDLine(osdPos, buffer);
 	}
 
-	gFontVBO->EndWrite(fontWriter);
+	gOSDTextCache->End();
 
 	//
-	// Draw Font VBO
+	// Draw cached text
 	//
 	CTextureFont *fontTexture = osdPos.fontTexture;
-	uint32_t triangleIndexCount = fontWriter.indexOffset;
 
 	gRenderer->EnableTexture(0, fontTexture);
 
-	gFontShader->enable();
+	gRenderer->BindShader(gFontShader);
 	gFontShader->uniform1i(gFontShader->ulocFontTex, 0);
+	gFontShader->uniform1f(gFontShader->ulocIsSDF, fontTexture->GetAtlas().IsSDF() ? 1.0f : 0.0f);
 	gFontShader->uniformMatrix4(gFontShader->ulocMVP, &orthoProj[0][0]);
-	DrawFontsVBO(orthoProj, gFontVBO, triangleIndexCount);
-	gFontShader->disable();
+	gOSDTextCache->Draw(gRenderer);
+	gRenderer->UnbindShader();
 
 	gRenderer->DisableTexture(0, fontTexture);
 
@@ -1419,11 +1758,11 @@ void RenderSkybox(const glm::mat4 &mvp) {
 
 	gRenderer->EnableTexture(0, gSkyboxCubemap);
 
-	gSkyboxShader->enable();
+	gRenderer->BindShader(gSkyboxShader);
 	gSkyboxShader->uniformMatrix4(gSkyboxShader->ulocMVP, &mvp[0][0]);
 	gSkyboxShader->uniform1i(gSkyboxShader->ulocCubemap, 0);
 	gRenderer->DrawPrimitive(gSkyboxVBO, false);
-	gSkyboxShader->disable();
+	gRenderer->UnbindShader();
 
 	gRenderer->DisableTexture(0, gSkyboxCubemap);
 
@@ -1434,28 +1773,16 @@ void RenderScene(const glm::mat4 &mvp) {
 	// Draw skybox
 	RenderSkybox(mvp);
 
-	// Draw the grid
-	DrawGrid(mvp);
+	// Record the grid, actors and debug lines and submit them sorted by state
+	gRenderQueue->Begin(mvp);
 
-	if (gDrawWireframe)
-		gRenderer->SetWireframe(true);
+	EnqueueGrid();
 
-	// Render actors
-	RenderActors(mvp);
+	EnqueueActors();
 
-	// Render actor boundings if required
-	if (gDrawBoundBox) {
-		if (!gDrawWireframe)
-			gRenderer->SetWireframe(true);
-
-		RenderActorBoundings(mvp);
+	EnqueueDebugDraw();
 
-		if (!gDrawWireframe)
-			gRenderer->SetWireframe(false);
-	}
-
-	if (gDrawWireframe)
-		gRenderer->SetWireframe(false);
+	gRenderQueue->Submit(gRenderer);
 }
 
 void RenderSceneFBO(const glm::mat4 &mvp, const int windowWidth, const int windowHeight) {
@@ -1514,6 +1841,10 @@ static void CreatePipeline(FluidSandbox &app, const int width, const int height)
 	pipelineDesc.scissor = fsr::ScissorRect(0, 0, width, height);
 	pipelineDesc.settings.clear.value.color.v4 = glm::vec4(0.1f, 0.2f, 0.6f, 1.0f);
 	pipelineDesc.settings.clear.flags = fsr::ClearFlags::ColorAndDepth;
+	pipelineDesc.settings.clear.value.depthStencil.depth = 1.0f;
+	pipelineDesc.settings.depth.test = fsr::DepthTest::On;
+	pipelineDesc.settings.depth.func = fsr::DepthFunc::LessOrEqual;
+	pipelineDesc.settings.depth.writeEnabled = 1;
 	app.pipelineId = r->CreatePipeline(pipelineDesc);
 }
 
@@ -1539,6 +1870,175 @@ static void ReleaseRenderer2(FluidSandbox &app) {
 	app.renderer = nullptr;
 }
 
+// Records millions of draw commands per frame and prints the recording throughput.
+// The commands are discarded instead of submitted, so only the recording and the command arena are measured.
+static void RunCommandBufferBenchmark(FluidSandbox &app) {
+	constexpr size_t WarmupFrameCount = 2;
+	constexpr size_t FrameCount = 100;
+	constexpr size_t DrawsPerFrame = 50000;
+
+	fsr::CommandBuffer *cmd = app.commandBuffer;
+	fsr::BufferID vertexBuffer = { 1 };
+
+	fplConsoleFormatOut("Command buffer benchmark: %zu frames with %zu draws each\n", FrameCount, DrawsPerFrame);
+
+	size_t warmupAllocations = 0;
+	fplTimestamp startTime = {};
+	for(size_t frameIndex = 0; frameIndex < WarmupFrameCount + FrameCount; ++frameIndex) {
+		if(frameIndex == WarmupFrameCount) {
+			warmupAllocations = cmd->GetMemoryStats().allocationCount;
+			startTime = fplTimestampQuery();
+		}
+		cmd->Begin();
+		cmd->BindPipeline(app.pipelineId);
+		for(size_t drawIndex = 0; drawIndex < DrawsPerFrame; ++drawIndex) {
+			cmd->BindVertexBuffers({ vertexBuffer });
+			cmd->Draw(36, 0, 1, 0);
+		}
+		cmd->End();
+		cmd->Reset();
+	}
+	fplTimestamp endTime = fplTimestampQuery();
+	fplSeconds elapsed = fplTimestampElapsed(startTime, endTime);
+
+	fsr::CommandBufferMemoryStats memStats = cmd->GetMemoryStats();
+	size_t commandCount = FrameCount * (DrawsPerFrame * 2 + 1);
+	double commandsPerSecond = elapsed > 0 ? (double)commandCount / (double)elapsed : 0.0;
+	fplConsoleFormatOut("  Recorded %zu commands in %.3f ms (%.2f M commands/s)\n", commandCount, elapsed * 1000.0, commandsPerSecond / 1000000.0);
+	fplConsoleFormatOut("  Arena: %zu chunks, %zu KB reserved, %zu chunk allocations after warmup\n", memStats.chunkCount, memStats.reservedBytes / 1024, memStats.allocationCount - warmupAllocations);
+}
+
+struct ParallelRecordBenchmark {
+	fsr::PipelineID pipelineId;
+	fsr::BufferID vertexBuffer;
+	size_t drawsPerBuffer;
+};
+
+static void RecordBenchmarkCommands(fsr::CommandBuffer &cmd, const size_t index, void *userData) {
+	const ParallelRecordBenchmark *bench = (const ParallelRecordBenchmark *)userData;
+	cmd.BindPipeline(bench->pipelineId);
+	for(size_t drawIndex = 0; drawIndex < bench->drawsPerBuffer; ++drawIndex) {
+		cmd.BindVertexBuffers({ bench->vertexBuffer });
+		cmd.Draw(36, 0, 1, 0);
+	}
+}
+
+// Records the same amount of commands into several command buffers with an increasing number of threads and prints the scaling
+static void RunParallelRecordingBenchmark(FluidSandbox &app) {
+	constexpr size_t BufferCount = 16;
+	constexpr size_t FrameCount = 20;
+
+	ParallelRecordBenchmark bench = {};
+	bench.pipelineId = app.pipelineId;
+	bench.vertexBuffer = { 1 };
+	bench.drawsPerBuffer = 25000;
+
+	fsr::CommandBuffer *buffers[BufferCount];
+	for(size_t bufferIndex = 0; bufferIndex < BufferCount; ++bufferIndex) {
+		buffers[bufferIndex] = app.renderer->CreateCommandBuffer();
+	}
+
+	size_t maxThreadCount = std::min(std::max(fplCPUGetCoreCount(), (size_t)1), BufferCount);
+	size_t commandCount = FrameCount * BufferCount * (bench.drawsPerBuffer * 2 + 1);
+
+	fplConsoleFormatOut("Parallel recording benchmark: %zu frames with %zu command buffers, %zu draws each\n", FrameCount, BufferCount, bench.drawsPerBuffer);
+
+	double singleThreadRate = 0.0;
+	for(size_t threadCount = 1; ; threadCount *= 2) {
+		if(threadCount > maxThreadCount) {
+			threadCount = maxThreadCount;
+		}
+
+		// Warmup, so all arenas have reached their steady-state size
+		app.renderer->RecordCommandBuffers(buffers, BufferCount, RecordBenchmarkCommands, &bench, threadCount);
+		for(size_t bufferIndex = 0; bufferIndex < BufferCount; ++bufferIndex) {
+			buffers[bufferIndex]->Reset();
+		}
+
+		fplTimestamp startTime = fplTimestampQuery();
+		for(size_t frameIndex = 0; frameIndex < FrameCount; ++frameIndex) {
+			app.renderer->RecordCommandBuffers(buffers, BufferCount, RecordBenchmarkCommands, &bench, threadCount);
+			for(size_t bufferIndex = 0; bufferIndex < BufferCount; ++bufferIndex) {
+				buffers[bufferIndex]->Reset();
+			}
+		}
+		fplSeconds elapsed = fplTimestampElapsed(startTime, fplTimestampQuery());
+
+		double commandsPerSecond = elapsed > 0 ? (double)commandCount / (double)elapsed : 0.0;
+		if(threadCount == 1) {
+			singleThreadRate = commandsPerSecond;
+		}
+		double speedup = singleThreadRate > 0 ? commandsPerSecond / singleThreadRate : 0.0;
+		fplConsoleFormatOut("  %2zu threads: %.3f ms, %.2f M commands/s (%.2fx)\n", threadCount, elapsed * 1000.0, commandsPerSecond / 1000000.0, speedup);
+
+		if(threadCount == maxThreadCount) {
+			break;
+		}
+	}
+
+	for(size_t bufferIndex = 0; bufferIndex < BufferCount; ++bufferIndex) {
+		app.renderer->DestroyCommandBuffer(buffers[bufferIndex]);
+	}
+}
+
+// Records and submits frames through the null backend, so the full frontend including submission and validation is measured without a GPU
+static void RunNullBackendBenchmark() {
+	constexpr size_t FrameCount = 20;
+	constexpr size_t DrawsPerFrame = 100000;
+
+	fsr::Renderer *r = fsr::Renderer::Create(fsr::RendererType::Null);
+	assert(r != nullptr);
+
+	fsr::PipelineDescriptor pipelineDesc = {};
+	pipelineDesc.viewport = fsr::Viewport(0, 0, (float)DefaultWindowWidth, (float)DefaultWindowHeight);
+	pipelineDesc.scissor = fsr::ScissorRect(0, 0, DefaultWindowWidth, DefaultWindowHeight);
+	pipelineDesc.settings.depth.test = fsr::DepthTest::On;
+	pipelineDesc.settings.depth.func = fsr::DepthFunc::LessOrEqual;
+	pipelineDesc.settings.depth.writeEnabled = 1;
+	fsr::PipelineID pipelineId = r->CreatePipeline(pipelineDesc);
+
+	float vertices[3 * 3] = {};
+	fsr::BufferID vertexBuffer = r->CreateBuffer(fsr::BufferType::Vertex, fsr::BufferAccess::ReadWrite, fsr::BufferUsage::Dynamic, sizeof(vertices), (const uint8_t *)vertices);
+
+	fsr::CommandQueue *queue = r->GetCommandQueue();
+	fsr::CommandBuffer *cmd = r->CreateCommandBuffer();
+
+	fplConsoleFormatOut("Null backend benchmark: %zu frames with %zu draws each\n", FrameCount, DrawsPerFrame);
+
+	fplTimestamp startTime = fplTimestampQuery();
+	for(size_t frameIndex = 0; frameIndex < FrameCount; ++frameIndex) {
+		// Dynamic vertex data is replaced every frame
+		vertices[0] = (float)frameIndex;
+		r->WriteBuffer(vertexBuffer, 0, sizeof(vertices), (const uint8_t *)vertices);
+
+		cmd->Begin();
+		cmd->BeginRenderPass(fsr::RenderPassID {}, fsr::FrameBufferID {}, nullptr, {});
+		cmd->BindPipeline(pipelineId);
+		for(size_t drawIndex = 0; drawIndex < DrawsPerFrame; ++drawIndex) {
+			// Per-draw constants are just copied into the uniform ring
+			glm::vec4 drawColor = glm::vec4((float)(drawIndex & 0xFF) / 255.0f, 0.0f, 0.0f, 1.0f);
+			cmd->PushUniforms(0, &drawColor, sizeof(drawColor));
+			cmd->BindVertexBuffers({ vertexBuffer });
+			cmd->Draw(3, 0, 1, 0);
+		}
+		cmd->EndRenderPass();
+		cmd->End();
+		queue->Submit(*cmd);
+		r->Present();
+	}
+	fplSeconds elapsed = fplTimestampElapsed(startTime, fplTimestampQuery());
+
+	fsr::CommandQueueStats frameStats = r->GetFrameStats();
+	fplConsoleFormatOut("  %.3f ms per frame\n", (elapsed * 1000.0) / (double)FrameCount);
+	fplConsoleFormatOut("  Last frame: %zu commands, %zu draws, %zu API calls, %zu skipped calls, %zu validation errors\n", frameStats.commandCount, frameStats.drawCount, frameStats.apiCallCount, frameStats.skippedCallCount, frameStats.validationErrorCount);
+	fplConsoleFormatOut("  Uniform ring: %zu KB per frame\n", frameStats.uniformBytes / 1024);
+
+	r->DestroyCommandBuffer(cmd);
+	r->DestroyBuffer(vertexBuffer);
+	r->DestroyPipeline(pipelineId);
+	delete r;
+}
+
 static void ResizeRenderer2(FluidSandbox &app, const int newWidth, const int newHeight) {
 	DestroyPipeline(app);
 	CreatePipeline(app, newWidth, newHeight);
@@ -1561,6 +2061,7 @@ static void OnRender2(FluidSandbox &app, const int windowWidth, const int window
 	cmd->Begin();
 
 	cmd->BindPipeline(app.pipelineId);
+	cmd->PushUniforms(0, &mvp[0][0], sizeof(mvp));
 
 	cmd->End();
 	queue->Submit(*cmd);
@@ -1583,6 +2084,8 @@ void OnRender(const int windowWidth, const int windowHeight, const float frameti
 	// Update counters
 	gTotalActors = gActors.size();
 	gDrawedActors = 0;
+	gLastRenderStats = gRenderer->GetStats();
+	gRenderer->ResetStats();
 
 	// Set drawing options
 	const FluidColor &activeFluidColor = gActiveScene->getFluidColor(gSSFCurrentFluidIndex);;
@@ -1855,13 +2358,21 @@ static void OnKeyUp(const fplKey key, const int x, const int y) {
 
 		case fplKey_L: // l
 		{
-			if (gScenarios.size() > 0) {
-				gActiveScenarioIdx++;
+			if (gScenarioLibrary->GetCount() > 0) {
+				int nextScenarioIdx = gActiveScenarioIdx + 1;
 
-				if (gActiveScenarioIdx > (int)gScenarios.size() - 1) gActiveScenarioIdx = 0;
+				if (nextScenarioIdx > (int)gScenarioLibrary->GetCount() - 1) nextScenarioIdx = 0;
 
-				gActiveScenario = gScenarios[gActiveScenarioIdx];
-				ResetScene(*gPhysics);
+				// NOTE(final): Usually the scenario is already prefetched, otherwise its parsed right here
+				Scenario *nextScenario = gScenarioLibrary->Get(nextScenarioIdx);
+				if (nextScenario != nullptr) {
+					gActiveScenarioIdx = nextScenarioIdx;
+					gActiveScenario = nextScenario;
+					ResetScene(*gPhysics);
+				} else {
+					std::cerr << "Failed to load scenario '" << gScenarioLibrary->GetDisplayName(nextScenarioIdx) << "'!" << std::endl;
+				}
+				gScenarioLibrary->PrefetchAround(nextScenarioIdx);
 			}
 
 			break;
@@ -2092,92 +2603,160 @@ void KeyDown(const fplKey key, const int x, const int y) {
 	}
 }
 
-void LoadFluidScenarios(const char *appPath) {
-	// Load scenarios
-	std::string scenariosPath = COSLowLevel::pathCombine(appPath, "scenarios");
-	std::vector<std::string> scenFiles = COSLowLevel::getFilesInDirectory(scenariosPath.c_str(), "*.xml");
+// NOTE(final): Startup runs as a dependency graph, CPU only tasks runs on worker threads and only the tasks which creates opengl objects runs on the main thread
+struct StartupPrimitives {
+	Primitives::Primitive skybox;
+	Primitives::Primitive box;
+	Primitives::Primitive sphere;
+	Primitives::Primitive cylinder;
+	Primitives::Primitive grid;
+	Primitives::Primitive quad;
+	Primitives::Primitive fullscreenQuad;
+};
 
-	for (unsigned int i = 0; i < scenFiles.size(); i++) {
-		std::string filePath = COSLowLevel::pathCombine(scenariosPath, scenFiles[i]);
-		Scenario *scenario = Scenario::load(filePath.c_str(), gActiveScene);
-		gScenarios.push_back(scenario);
-	}
+struct StartupContext {
+	std::vector<std::string> scenarioFiles;
+	StartupPrimitives primitives;
+};
 
-	if (gScenarios.size() > 0) {
-		gActiveScenarioIdx = 0;
-		gActiveScenario = gScenarios[gActiveScenarioIdx];
-	} else {
-		gActiveScenarioIdx = -1;
-		gActiveScenario = nullptr;
-		std::cerr << "  No fluid scenario found!" << std::endl;
-	}
+static void StartupDecodeTextures(void *userData) {
+	gTexMng->loadQueued();
 }
 
-static void InitResources(const char *appPath) {
-	// Create texture manager
-	printf("  Create texture manager\n");
-	gTexMng = new CTextureManager();
+static void StartupUploadTextures(void *userData) {
+	gTexMng->finishLoading();
+	gSkyboxCubemap = (CTextureCubemap *)gTexMng->get("skybox");
+}
 
-	gSkyboxCubemap = gTexMng->addCubemap("skybox", "textures\\skybox_texture.jpg");
+static void StartupPackFonts(void *userData) {
+	const AppFont &osdFont = gAppFonts[0];
+	gFontAtlas = FontAtlas::Load(osdFont.name, osdFont.data, 0, osdFont.size, osdFont.minChar, osdFont.maxChar, osdFont.isSDF);
+}
 
-	gFontAtlas16 = FontAtlas::LoadFromMemory(sulphurPointRegularData, 0, 16.0f, 32, 255);
-	gFontAtlas32 = FontAtlas::LoadFromMemory(sulphurPointRegularData, 0, 32.0f, 32, 255);
-	gFontTexture16 = gTexMng->addFont("Font", *gFontAtlas16);
-	gFontTexture32 = gTexMng->addFont("Font", *gFontAtlas32);
+static void StartupUploadFonts(void *userData) {
+	gFontTexture = gTexMng->addFont("Font", *gFontAtlas);
+}
 
-	// Create scene
+static void StartupLoadScene(void *userData) {
 	printf("  Load scene\n");
 	gActiveScene = new CScene(DefaultRigidBodyDensity);
 	gActiveScene->load("scene.xml");
 	gCurrentProperties.sim = gActiveScene->sim;
 	gCurrentProperties.render = gActiveScene->render;
 	gSSFCurrentFluidIndex = gActiveScene->fluidColorDefaultIndex;
+}
 
-	// Create scene FBO
+static void StartupIndexScenarios(void *userData) {
+	StartupContext *context = (StartupContext *)userData;
+	gScenarioLibrary = new CScenarioLibrary(*gActiveScene, gScenarioCache);
+	for (size_t i = 0; i < context->scenarioFiles.size(); i++) {
+		gScenarioLibrary->AddFile(context->scenarioFiles[i]);
+	}
+
+	// Only the first scenario is parsed at startup, all others are parsed when they are needed
+	if (gScenarioLibrary->GetCount() > 0) {
+		gScenarioLibrary->Get(0);
+	}
+}
+
+static void StartupInitializePhysics(void *userData) {
+	printf("  Initialize PhysX\n");
+	InitializePhysics();
+}
+
+static void StartupCreatePrimitives(void *userData) {
+	StartupPrimitives *prims = (StartupPrimitives *)userData;
+	prims->skybox = Primitives::CreateBox(glm::vec3(100.0f), true);
+	prims->box = Primitives::CreateBox(glm::vec3(1.0f), false);
+	prims->sphere = Primitives::CreateSphere(1.0f, 16, 16);
+	prims->cylinder = Primitives::CreateCylinder(1.0f, 1.0f, 1.0f, 16, 16);
+	prims->grid = Primitives::CreateGridXZ(1.0f, 40.0f);
+	prims->quad = Primitives::CreateQuatXY(1.0f, 1.0f);
+	prims->fullscreenQuad = Primitives::CreateQuatXY(2.0f, 2.0f);
+	gRigidBodyPrimitives[(int)RigidBodyPrimitive::Box] = prims->box;
+	gRigidBodyPrimitives[(int)RigidBodyPrimitive::Sphere] = prims->sphere;
+	gRigidBodyPrimitives[(int)RigidBodyPrimitive::Cylinder] = prims->cylinder;
+}
+
+static void StartupCreateSceneFBO(void *userData) {
 	printf("  Create scene FBO\n");
 	gSceneFBO = new CSceneFBO(128, 128); // Initial FBO size does not matter, because its resized on render anyway
 	gSceneFBO->depthTexture = gSceneFBO->addRenderTarget(GL_DEPTH_COMPONENT32, GL_DEPTH_COMPONENT, GL_UNSIGNED_BYTE, GL_DEPTH_ATTACHMENT, GL_NEAREST);
 	gSceneFBO->sceneTexture = gSceneFBO->addTextureTarget(GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, GL_COLOR_ATTACHMENT0, GL_LINEAR);
 	gSceneFBO->update();
+}
 
-	// Create colored shader
+static void StartupBuildShaders(void *userData) {
+	// All programs are added to the shader cache first and then built at once
 	printf("  Create shaders renderer\n");
+
+	// Create colored shader
 	gColoredShader = new CColoredShader();
-	Utils::attachShaderFromFile(gColoredShader, GL_VERTEX_SHADER, "shaders\\Colored.vertex", "    ");
-	Utils::attachShaderFromFile(gColoredShader, GL_FRAGMENT_SHADER, "shaders\\Colored.fragment", "    ");
+	Utils::addShaderSourceFromFile(gColoredShader, GL_VERTEX_SHADER, "shaders\\Colored.vertex", "    ");
+	Utils::addShaderSourceFromFile(gColoredShader, GL_FRAGMENT_SHADER, "shaders\\Colored.fragment", "    ");
+	gShaderCache->Add(gColoredShader);
 
 	// Create line shader
 	gLineShader = new CLineShader();
-	Utils::attachShaderFromFile(gLineShader, GL_VERTEX_SHADER, "shaders\\Line.vertex", "    ");
-	Utils::attachShaderFromFile(gLineShader, GL_FRAGMENT_SHADER, "shaders\\Line.fragment", "    ");
+	Utils::addShaderSourceFromFile(gLineShader, GL_VERTEX_SHADER, "shaders\\Line.vertex", "    ");
+	Utils::addShaderSourceFromFile(gLineShader, GL_FRAGMENT_SHADER, "shaders\\Line.fragment", "    ");
+	gShaderCache->Add(gLineShader);
 
 	// Create lightning shader
 	gLightingShader = new CLightingShader();
-	Utils::attachShaderFromFile(gLightingShader, GL_VERTEX_SHADER, "shaders\\Lighting.vertex", "    ");
-	Utils::attachShaderFromFile(gLightingShader, GL_FRAGMENT_SHADER, "shaders\\Lighting.fragment", "    ");
+	Utils::addShaderSourceFromFile(gLightingShader, GL_VERTEX_SHADER, "shaders\\Lighting.vertex", "    ");
+	Utils::addShaderSourceFromFile(gLightingShader, GL_FRAGMENT_SHADER, "shaders\\Lighting.fragment", "    ");
+	gShaderCache->Add(gLightingShader);
+
+	// Create instanced lightning shader
+	{
+		std::string lightingInstancedShaderPath = std::string("shaders\\" + std::string(CLightingInstancedShader::ShaderName));
+		gLightingInstancedShader = new CLightingInstancedShader();
+		Utils::addShaderSourceFromFile(gLightingInstancedShader, GL_VERTEX_SHADER, (lightingInstancedShaderPath + ".vertex").c_str(), "    ");
+		Utils::addShaderSourceFromFile(gLightingInstancedShader, GL_FRAGMENT_SHADER, (lightingInstancedShaderPath + ".fragment").c_str(), "    ");
+		gShaderCache->Add(gLightingInstancedShader);
+	}
+
+	// Create debug line shader
+	{
+		std::string debugLineShaderPath = std::string("shaders\\" + std::string(CDebugLineShader::ShaderName));
+		gDebugLineShader = new CDebugLineShader();
+		Utils::addShaderSourceFromFile(gDebugLineShader, GL_VERTEX_SHADER, (debugLineShaderPath + ".vertex").c_str(), "    ");
+		Utils::addShaderSourceFromFile(gDebugLineShader, GL_FRAGMENT_SHADER, (debugLineShaderPath + ".fragment").c_str(), "    ");
+		gShaderCache->Add(gDebugLineShader);
+	}
 
 	// Create skybox shader
 	gSkyboxShader = new CSkyboxShader();
-	Utils::attachShaderFromFile(gSkyboxShader, GL_VERTEX_SHADER, "shaders\\Skybox.vertex", "    ");
-	Utils::attachShaderFromFile(gSkyboxShader, GL_FRAGMENT_SHADER, "shaders\\Skybox.fragment", "    ");
+	Utils::addShaderSourceFromFile(gSkyboxShader, GL_VERTEX_SHADER, "shaders\\Skybox.vertex", "    ");
+	Utils::addShaderSourceFromFile(gSkyboxShader, GL_FRAGMENT_SHADER, "shaders\\Skybox.fragment", "    ");
+	gShaderCache->Add(gSkyboxShader);
 
 	// Create font shader
 	gFontShader = new CFontShader();
-	Utils::attachShaderFromFile(gFontShader, GL_VERTEX_SHADER, "shaders\\FontTexture.vertex", "    ");
-	Utils::attachShaderFromFile(gFontShader, GL_FRAGMENT_SHADER, "shaders\\FontTexture.fragment", "    ");
+	Utils::addShaderSourceFromFile(gFontShader, GL_VERTEX_SHADER, "shaders\\FontTexture.vertex", "    ");
+	Utils::addShaderSourceFromFile(gFontShader, GL_FRAGMENT_SHADER, "shaders\\FontTexture.fragment", "    ");
+	gShaderCache->Add(gFontShader);
+
+	// Build all shaders
+	gShaderCache->Build("    ");
+}
+
+static void StartupCreateVertexBuffers(void *userData) {
+	StartupPrimitives *prims = (StartupPrimitives *)userData;
 
 	// Create geometry buffers
 	printf("  Create vertex buffers\n");
 	gSkyboxVBO = new GeometryVBO();
 	{
-		Primitives::Primitive skyboxPrim = Primitives::CreateBox(glm::vec3(100.0f), true);
+		Primitives::Primitive &skyboxPrim = prims->skybox;
 		gSkyboxVBO->BufferVertices(skyboxPrim.verts[0].data(), skyboxPrim.sizeOfVertices, GL_STATIC_DRAW);
 		gSkyboxVBO->BufferIndices(&skyboxPrim.indices[0], (GLuint)skyboxPrim.indexCount, GL_STATIC_DRAW);
 		gSkyboxVBO->triangleIndexCount = skyboxPrim.indexCount;
 	}
 	gBoxVBO = new GeometryVBO();
 	{
-		Primitives::Primitive prim = Primitives::CreateBox(glm::vec3(1.0f), false);
+		Primitives::Primitive &prim = prims->box;
 		gBoxVBO->BufferVertices(prim.verts[0].data(), prim.sizeOfVertices, GL_STATIC_DRAW);
 		//gBoxVBO->BufferIndices(&geoBoxPrim.indices[0], (GLuint)geoBoxPrim.indexCount, GL_STATIC_DRAW);
 		gBoxVBO->ReserveIndices(prim.indexCount + prim.lineIndexCount, GL_STATIC_DRAW);
@@ -2188,18 +2767,17 @@ static void InitResources(const char *appPath) {
 	}
 	gSphereVBO = new GeometryVBO();
 	{
-		Primitives::Primitive prim = Primitives::CreateSphere(1.0f, 16, 16);
+		Primitives::Primitive &prim = prims->sphere;
 		gSphereVBO->BufferVertices(prim.verts[0].data(), prim.sizeOfVertices, GL_STATIC_DRAW);
 		gSphereVBO->ReserveIndices(prim.indexCount + prim.lineIndexCount, GL_STATIC_DRAW);
 		gSphereVBO->SubbufferIndices(&prim.indices[0], 0, prim.indexCount);
 		gSphereVBO->SubbufferIndices(&prim.lineIndices[0], prim.indexCount, prim.lineIndexCount);
 		gSphereVBO->triangleIndexCount = prim.indexCount;
 		gSphereVBO->lineIndexCount = prim.lineIndexCount;
-
 	}
 	gCylinderVBO = new GeometryVBO();
 	{
-		Primitives::Primitive prim = Primitives::CreateCylinder(1.0f, 1.0f, 1.0f, 16, 16);
+		Primitives::Primitive &prim = prims->cylinder;
 		gCylinderVBO->BufferVertices(prim.verts[0].data(), prim.sizeOfVertices, GL_STATIC_DRAW);
 		gCylinderVBO->ReserveIndices(prim.indexCount + prim.lineIndexCount, GL_STATIC_DRAW);
 		gCylinderVBO->SubbufferIndices(&prim.indices[0], 0, prim.indexCount);
@@ -2209,7 +2787,7 @@ static void InitResources(const char *appPath) {
 	}
 	gGridVBO = new GeometryVBO();
 	{
-		Primitives::Primitive prim = Primitives::CreateGridXZ(1.0f, 40.0f);
+		Primitives::Primitive &prim = prims->grid;
 		gGridVBO->BufferVertices(prim.verts[0].data(), prim.sizeOfVertices, GL_STATIC_DRAW);
 		gGridVBO->ReserveIndices(prim.lineIndexCount, GL_STATIC_DRAW);
 		gGridVBO->SubbufferIndices(&prim.lineIndices[0], 0, prim.lineIndexCount);
@@ -2217,7 +2795,7 @@ static void InitResources(const char *appPath) {
 	}
 	gQuadVBO = new GeometryVBO();
 	{
-		Primitives::Primitive prim = Primitives::CreateQuatXY(1.0f, 1.0f);
+		Primitives::Primitive &prim = prims->quad;
 		gQuadVBO->BufferVertices(prim.verts[0].data(), prim.sizeOfVertices, GL_STATIC_DRAW);
 		gQuadVBO->ReserveIndices(prim.indexCount + prim.lineIndexCount, GL_STATIC_DRAW);
 		gQuadVBO->SubbufferIndices(&prim.indices[0], 0, prim.indexCount);
@@ -2227,7 +2805,7 @@ static void InitResources(const char *appPath) {
 	}
 	gFullscreenQuadVBO = new GeometryVBO();
 	{
-		Primitives::Primitive prim = Primitives::CreateQuatXY(2.0f, 2.0f);
+		Primitives::Primitive &prim = prims->fullscreenQuad;
 		gFullscreenQuadVBO->BufferVertices(prim.verts[0].data(), prim.sizeOfVertices, GL_STATIC_DRAW);
 		gFullscreenQuadVBO->ReserveIndices(prim.indexCount + prim.lineIndexCount, GL_STATIC_DRAW);
 		gFullscreenQuadVBO->SubbufferIndices(&prim.indices[0], 0, prim.indexCount);
@@ -2236,10 +2814,23 @@ static void InitResources(const char *appPath) {
 		gFullscreenQuadVBO->lineIndexCount = prim.lineIndexCount;
 	}
 
-	// Font VBO
-	gFontVBO = new DynamicVBO();
-	gFontVBO->ReserveVertices(MaxFontVBOVertexCount, FontVertexStride, GL_DYNAMIC_DRAW);
-	gFontVBO->ReserveIndices(MaxFontVBOIndexCount, GL_DYNAMIC_DRAW);
+	// Rigid body instance VBO, resized on every pass
+	gRigidBodyInstanceVBO = new DynamicVBO();
+}
+
+static void StartupCreateRenderers(void *userData) {
+	// Static geometry, baked when the scene changes
+	gStaticGeometry = new CStaticGeometry();
+
+	// Render queue
+	gRenderQueue = new CRenderQueue();
+
+	// Debug drawing, also used by the physics engine
+	gDebugDraw = new CDebugDraw();
+	DebugDraw::SetTarget(gDebugDraw);
+
+	// OSD text cache
+	gOSDTextCache = new CTextCache(MaxOSDLineCount, MaxOSDLineCharCount);
 
 	// Create spherical point sprites
 	printf("  Allocate spherical point sprites\n");
@@ -2249,7 +2840,89 @@ static void InitResources(const char *appPath) {
 	// Create fluid renderer
 	printf("  Create fluid renderer\n");
 	// Initial FBO size does not matter, because its resized on render anyway
-	gFluidRenderer = new CScreenSpaceFluidRendering(128, 128, gRenderer, gSkyboxCubemap, gSceneFBO->sceneTexture, gPointSprites, gFullscreenQuadVBO);
+	gFluidRenderer = new CScreenSpaceFluidRendering(128, 128, gRenderer, gShaderCache, gSkyboxCubemap, gSceneFBO->sceneTexture, gPointSprites, gFullscreenQuadVBO);
+}
+
+static void StartupResetScene(void *userData) {
+	gActiveScenarioIdx = -1;
+	gActiveScenario = nullptr;
+	for (size_t i = 0; i < gScenarioLibrary->GetCount(); i++) {
+		gActiveScenario = gScenarioLibrary->Get(i);
+		if (gActiveScenario != nullptr) {
+			gActiveScenarioIdx = (int)i;
+			gScenarioLibrary->PrefetchAround(i);
+			break;
+		}
+	}
+	if (gActiveScenario == nullptr) {
+		std::cerr << "  No fluid scenario found!" << std::endl;
+	}
+
+	printf("  Load fluid scenario\n");
+	ResetScene(*gPhysics);
+}
+
+static void InitResourcesAndScene(const char *appPath) {
+	StartupContext context;
+
+	// NOTE(final): The pack is optional, every asset which is not in the pack (or is edited on disk) is loaded as loose file
+	std::string assetPackPath = COSLowLevel::pathCombine(appPath, "assets.pack");
+	gAssetPack = new CAssetPack();
+	if(gAssetPack->Open(assetPackPath, appPath)) {
+		printf("  Mapped asset pack '%s'\n", assetPackPath.c_str());
+		Assets::SetPack(gAssetPack);
+	} else {
+		printf("  No asset pack found, load loose asset files only\n");
+	}
+
+	// Texture manager and shader cache are created upfront, their tasks only fills them
+	printf("  Create texture manager\n");
+	gTextureCache = new CTextureCache(COSLowLevel::pathCombine(appPath, "texturecache"), gUseTextureCompression);
+	gTexMng = new CTextureManager(gTextureCache);
+	gTexMng->queueCubemap("skybox", "textures\\skybox_texture.jpg");
+	gShaderCache = new CShaderCache(COSLowLevel::pathCombine(appPath, "shadercache"));
+
+	gScenarioCache = new CScenarioCache(COSLowLevel::pathCombine(appPath, "scenariocache"));
+	std::string scenariosPath = COSLowLevel::pathCombine(appPath, "scenarios");
+	std::vector<std::string> scenFiles = Assets::GetFilesInDirectory(scenariosPath, "*.xml");
+	for (size_t i = 0; i < scenFiles.size(); i++) {
+		context.scenarioFiles.push_back(COSLowLevel::pathCombine(scenariosPath, scenFiles[i]));
+	}
+
+	CStartupGraph graph;
+
+	// Worker tasks
+	StartupTaskID decodeTextures = graph.AddTask("Decode textures", StartupDecodeTextures, nullptr);
+	StartupTaskID packFonts = graph.AddTask("Pack fonts", StartupPackFonts, nullptr);
+	StartupTaskID createPrimitives = graph.AddTask("Create primitives", StartupCreatePrimitives, &context.primitives);
+	StartupTaskID loadScene = graph.AddTask("Load scene", StartupLoadScene, nullptr);
+	StartupTaskID initPhysics = graph.AddTask("Initialize PhysX", StartupInitializePhysics, nullptr);
+	graph.DependsOn(initPhysics, loadScene);
+	StartupTaskID indexScenarios = graph.AddTask("Index scenarios", StartupIndexScenarios, &context);
+	graph.DependsOn(indexScenarios, loadScene);
+
+	// Main thread tasks
+	StartupTaskID createSceneFBO = graph.AddTask("Create scene FBO", StartupCreateSceneFBO, nullptr, StartupTaskThread::Main);
+	StartupTaskID buildShaders = graph.AddTask("Build shaders", StartupBuildShaders, nullptr, StartupTaskThread::Main);
+	StartupTaskID uploadFonts = graph.AddTask("Upload fonts", StartupUploadFonts, nullptr, StartupTaskThread::Main);
+	graph.DependsOn(uploadFonts, packFonts);
+	StartupTaskID uploadTextures = graph.AddTask("Upload textures", StartupUploadTextures, nullptr, StartupTaskThread::Main);
+	graph.DependsOn(uploadTextures, decodeTextures);
+	StartupTaskID createVertexBuffers = graph.AddTask("Create vertex buffers", StartupCreateVertexBuffers, &context.primitives, StartupTaskThread::Main);
+	graph.DependsOn(createVertexBuffers, createPrimitives);
+	StartupTaskID createRenderers = graph.AddTask("Create renderers", StartupCreateRenderers, nullptr, StartupTaskThread::Main);
+	graph.DependsOn(createRenderers, createSceneFBO);
+	graph.DependsOn(createRenderers, buildShaders);
+	graph.DependsOn(createRenderers, uploadTextures);
+	graph.DependsOn(createRenderers, createVertexBuffers);
+	StartupTaskID resetScene = graph.AddTask("Reset scene", StartupResetScene, nullptr, StartupTaskThread::Main);
+	graph.DependsOn(resetScene, initPhysics);
+	graph.DependsOn(resetScene, createRenderers);
+	graph.DependsOn(resetScene, indexScenarios);
+
+	uint32_t coreCount = COSLowLevel::getNumCPUCores();
+	graph.Run(coreCount > 1 ? coreCount - 1 : 0);
+	graph.PrintTimeline("  ");
 }
 
 void ReleaseResources() {
@@ -2259,19 +2932,32 @@ void ReleaseResources() {
 	if (gPointSprites != nullptr)
 		delete gPointSprites;
 
+	if (gRenderQueue != nullptr)
+		delete gRenderQueue;
+
+	DebugDraw::SetTarget(nullptr);
+	if (gDebugDraw != nullptr)
+		delete gDebugDraw;
+
 	printf("  Release vertex buffers\n");
-	CVBO *vbos[] { gFullscreenQuadVBO, gFontVBO, gQuadVBO, gGridVBO, gCylinderVBO, gSphereVBO, gBoxVBO, gSkyboxVBO };
+	if (gOSDTextCache != nullptr)
+		delete gOSDTextCache;
+	if (gStaticGeometry != nullptr)
+		delete gStaticGeometry;
+	CVBO *vbos[] { gFullscreenQuadVBO, gRigidBodyInstanceVBO, gQuadVBO, gGridVBO, gCylinderVBO, gSphereVBO, gBoxVBO, gSkyboxVBO };
 	for (size_t i = 0; i < fplArrayCount(vbos); ++i) {
 		CVBO *vbo = vbos[i];
 		delete vbo;
 	}
 
 	printf("  Release shaders\n");
-	CGLSL *shaders[] { gFontShader, gSkyboxShader, gLightingShader, gLineShader, gColoredShader };
+	CGLSL *shaders[] { gFontShader, gSkyboxShader, gDebugLineShader, gLightingInstancedShader, gLightingShader, gLineShader, gColoredShader };
 	for (size_t i = 0; i < fplArrayCount(shaders); ++i) {
 		CGLSL *shader = shaders[i];
 		delete shader;
 	}
+	if (gShaderCache != nullptr)
+		delete gShaderCache;
 
 	// Release scene FBO
 	printf("  Release frame buffer objects\n");
@@ -2282,16 +2968,22 @@ void ReleaseResources() {
 	printf("  Release textures\n");
 	if (gTexMng != nullptr)
 		delete gTexMng;
-	if (gFontAtlas32 != nullptr) {
-		delete gFontAtlas32;
-	}
-	if (gFontAtlas16 != nullptr) {
-		delete gFontAtlas16;
+	if (gTextureCache != nullptr)
+		delete gTextureCache;
+	if (gFontAtlas != nullptr) {
+		delete gFontAtlas;
 	}
 
 	printf("  Release world\n");
 	if (gActiveScene != nullptr)
 		delete gActiveScene;
+
+	printf("  Release asset pack\n");
+	Assets::SetPack(nullptr);
+	if (gAssetPack != nullptr) {
+		delete gAssetPack;
+		gAssetPack = nullptr;
+	}
 }
 
 void OnShutdown() {
@@ -2307,11 +2999,15 @@ void OnShutdown() {
 
 	// Release scenarios
 	printf("Release Fluid Scenarios\n");
-	for (unsigned int i = 0; i < gScenarios.size(); i++) {
-		Scenario *scenario = gScenarios[i];
-		delete scenario;
+	if (gScenarioLibrary != nullptr) {
+		delete gScenarioLibrary;
+		gScenarioLibrary = nullptr;
 	}
-	gScenarios.clear();
+	if (gScenarioCache != nullptr) {
+		delete gScenarioCache;
+		gScenarioCache = nullptr;
+	}
+	gActiveScenario = nullptr;
 
 	// Release renderer
 	printf("Release Renderer\n");
@@ -2398,6 +3094,59 @@ OpenGLVersion ParseOpenGLVersion(const char *str) {
 	return(result);
 }
 
+static int BakeFonts(const char *filePath) {
+	fplConsoleFormatOut("Bake %zu font atlases into '%s'\n", fplArrayCount(gAppFonts), filePath);
+	FontAtlas *atlases[fplArrayCount(gAppFonts)] = {};
+	FontBakeEntry entries[fplArrayCount(gAppFonts)] = {};
+	bool result = true;
+	for(size_t i = 0; i < fplArrayCount(gAppFonts); ++i) {
+		const AppFont &font = gAppFonts[i];
+		if(font.isSDF)
+			atlases[i] = FontAtlas::LoadSDFFromMemory(font.data, 0, font.size, font.minChar, font.maxChar);
+		else
+			atlases[i] = FontAtlas::LoadFromMemory(font.data, 0, font.size, font.minChar, font.maxChar);
+		if(atlases[i] == nullptr) {
+			fplConsoleFormatError("Failed packing font '%s' with size %f!\n", font.name, font.size);
+			result = false;
+			break;
+		}
+		fplConsoleFormatOut("  Packed font '%s' with size %f into %ux%u\n", font.name, font.size, atlases[i]->bitmapWidth, atlases[i]->bitmapHeight);
+		entries[i].name = font.name;
+		entries[i].atlas = atlases[i];
+	}
+	if(result && !FontAtlas::WriteBakedHeader(filePath, entries, fplArrayCount(entries))) {
+		fplConsoleFormatError("Failed writing baked fonts to '%s'!\n", filePath);
+		result = false;
+	}
+	for(size_t i = 0; i < fplArrayCount(atlases); ++i) {
+		if(atlases[i] != nullptr)
+			delete atlases[i];
+	}
+	return(result ? 0 : 1);
+}
+
+static void AddAssetFiles(const std::string &appPath, const std::string &folder, const std::string &filter, std::vector<std::string> &outFiles) {
+	std::string folderPath = folder.empty() ? appPath : COSLowLevel::pathCombine(appPath, folder);
+	std::vector<std::string> names = COSLowLevel::getFilesInDirectory(folderPath, filter);
+	for(size_t i = 0; i < names.size(); ++i)
+		outFiles.push_back(folder.empty() ? names[i] : (folder + "/" + names[i]));
+}
+
+static int PackAssets(const char *filePath, const std::string &appPath) {
+	std::vector<std::string> files;
+	files.push_back("scene.xml");
+	AddAssetFiles(appPath, "shaders", "*.vertex", files);
+	AddAssetFiles(appPath, "shaders", "*.fragment", files);
+	AddAssetFiles(appPath, "scenarios", "*.xml", files);
+	AddAssetFiles(appPath, "textures", "*.*", files);
+	fplConsoleFormatOut("Pack %zu asset files from '%s' into '%s'\n", files.size(), appPath.c_str(), filePath);
+	if(!CAssetPack::Write(filePath, appPath, files)) {
+		fplConsoleFormatError("Failed writing asset pack '%s'!\n", filePath);
+		return(1);
+	}
+	return(0);
+}
+
 int main(int argc, char **argv) {
 	fplConsoleFormatOut("%s v%s\n", APPLICATION_NAME, APPLICATION_VERSION);
 	fplConsoleFormatOut("%s\n", APPLICATION_COPYRIGHT);
@@ -2406,6 +3155,32 @@ int main(int argc, char **argv) {
 	// Get application path
 	std::string appPath = COSLowLevel::getAppPath(argc, argv);
 
+	// Parse arguments
+	bool runCommandBenchmark = false;
+	const char *bakeFontsPath = nullptr;
+	const char *packAssetsPath = nullptr;
+	for(int argIndex = 1; argIndex < argc; ++argIndex) {
+		if(strcmp(argv[argIndex], "-benchmark-commands") == 0) {
+			runCommandBenchmark = true;
+		} else if(strcmp(argv[argIndex], "-texture-compression") == 0) {
+			gUseTextureCompression = true;
+		} else if(strcmp(argv[argIndex], "-bake-fonts") == 0 && (argIndex + 1) < argc) {
+			bakeFontsPath = argv[++argIndex];
+		} else if(strcmp(argv[argIndex], "-pack-assets") == 0 && (argIndex + 1) < argc) {
+			packAssetsPath = argv[++argIndex];
+		}
+	}
+
+	// Bake the font atlases and exit, does not require any window or opengl
+	if(bakeFontsPath != nullptr) {
+		return BakeFonts(bakeFontsPath);
+	}
+
+	// Pack all assets into a single file and exit, the pack is used on the next start when it is placed next to the executable
+	if(packAssetsPath != nullptr) {
+		return PackAssets(packAssetsPath, appPath);
+	}
+
 	// Initialize random generator
 	srand((unsigned int)time(nullptr));
 
@@ -2493,18 +3268,10 @@ int main(int argc, char **argv) {
 
 		fplConsoleFormatOut("Initialize Renderer\n");
 		gRenderer = new CRenderer();
+		fplConsoleFormatOut("  Instanced drawing supported: %s\n", (gRenderer->IsInstancingSupported() ? "yes" : "no"));
 
-		fplConsoleFormatOut("Initialize Resources\n");
-		InitResources(appPath.c_str());
-
-		fplConsoleFormatOut("Load Fluid Scenarios\n");
-		LoadFluidScenarios(appPath.c_str());
-
-		fplConsoleFormatOut("Initialize PhysX\n");
-		InitializePhysics();
-
-		fplConsoleFormatOut("Load Fluid Scenario\n");
-		ResetScene(*gPhysics);
+		fplConsoleFormatOut("Initialize Resources, PhysX and Fluid Scenarios\n");
+		InitResourcesAndScene(appPath.c_str());
 
 		fplWindowSize initialWinSize;
 		fplGetWindowSize(&initialWinSize);
@@ -2512,12 +3279,18 @@ int main(int argc, char **argv) {
 		FluidSandbox app = {};
 		InitRenderer2(app, initialWinSize.width, initialWinSize.height);
 
+		if(runCommandBenchmark) {
+			RunCommandBufferBenchmark(app);
+			RunParallelRecordingBenchmark(app);
+			RunNullBackendBenchmark();
+		}
+
 		fplEvent ev;
 
 		float frametime = 1.0f / 60.0f;
 		fplTimestamp lastTime = fplTimestampQuery();
 		fplConsoleFormatOut("Main loop\n\n");
-		while (fplWindowUpdate()) {
+		while (!runCommandBenchmark && fplWindowUpdate()) {
 			while (fplPollEvent(&ev)) {
 				switch (ev.type) {
 					case fplEventType_Keyboard:
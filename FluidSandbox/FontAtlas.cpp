@@ -12,7 +12,37 @@
 #define STB_TRUETYPE_IMPLEMENTATION
 #include <stb/stb_truetype.h>
 
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <vector>
+#include <algorithm>
+
+#include <final_platform_layer.h>
+
 #include "OSLowLevel.h"
+#include "BakedFonts.h"
+
+constexpr uint32_t BakedGlyphFloatCount = 17;
+
+static void AppendFormat(std::string &out, const char *format, ...) {
+	char buffer[1024];
+	va_list argList;
+	va_start(argList, format);
+	vsnprintf(buffer, sizeof(buffer), format, argList);
+	va_end(argList);
+	out += buffer;
+}
+
+// Float literal which converts back to exactly the same value
+static void AppendFloat(std::string &out, const float value) {
+	char buffer[32];
+	snprintf(buffer, sizeof(buffer), "%.9g", value);
+	out += buffer;
+	if(strpbrk(buffer, ".e") == nullptr)
+		out += ".0";
+	out += "f";
+}
 
 FontAtlas::FontAtlas():
 	glyphs(nullptr),
@@ -147,6 +177,168 @@ FontAtlas *FontAtlas::LoadFromMemory(const uint8_t *fontData, const int fontInde
 	return(result);
 }
 
+struct SDFGlyphRect {
+	uint8_t *pixels;
+	int width;
+	int height;
+	int xoff;
+	int yoff;
+	uint32_t x;
+	uint32_t y;
+};
+
+// Simple shelf packer, glyphs are placed in rows sorted by height with one pixel gap
+static bool PackSDFGlyphs(std::vector<SDFGlyphRect> &rects, const std::vector<uint32_t> &order, const uint32_t bitmapSize, uint32_t *outUsedHeight) {
+	uint32_t x = 1, y = 1, rowHeight = 0;
+	for(size_t i = 0; i < order.size(); ++i) {
+		SDFGlyphRect &rect = rects[order[i]];
+		if(rect.pixels == nullptr)
+			continue;
+		if(x + rect.width + 1 > bitmapSize) {
+			x = 1;
+			y += rowHeight + 1;
+			rowHeight = 0;
+		}
+		if(x + rect.width + 1 > bitmapSize || y + rect.height + 1 > bitmapSize)
+			return(false);
+		rect.x = x;
+		rect.y = y;
+		x += rect.width + 1;
+		if((uint32_t)rect.height > rowHeight)
+			rowHeight = rect.height;
+	}
+	*outUsedHeight = y + rowHeight + 1;
+	return(true);
+}
+
+FontAtlas *FontAtlas::LoadSDFFromMemory(const uint8_t *fontData, const int fontIndex, const float fontSize, const uint32_t minChar, const uint32_t maxChar, const int padding, const uint32_t minBitmapSize, const uint32_t maxBitmapSize) {
+	int fontOffset = stbtt_GetFontOffsetForIndex(fontData, fontIndex);
+	if(fontOffset < 0) {
+		return(nullptr);
+	}
+
+	stbtt_fontinfo fontInfo;
+	if(!stbtt_InitFont(&fontInfo, fontData, fontOffset)) {
+		return(nullptr);
+	}
+
+	uint32_t charCount = (maxChar - minChar) + 1;
+
+	float pixelScale = stbtt_ScaleForPixelHeight(&fontInfo, fontSize);
+
+	int ascent, descent, lineGap;
+	stbtt_GetFontVMetrics(&fontInfo, &ascent, &descent, &lineGap);
+
+	// NOTE(final): The edge is stored as 128 and the distance of padding pixels maps to the full range on each side
+	const uint8_t onEdgeValue = 128;
+	float pixelDistScale = (float)onEdgeValue / (float)padding;
+
+	std::vector<SDFGlyphRect> rects(charCount);
+	std::vector<uint32_t> order(charCount);
+	for(uint32_t charIndex = 0; charIndex < charCount; ++charIndex) {
+		SDFGlyphRect &rect = rects[charIndex];
+		rect = {};
+		rect.pixels = stbtt_GetCodepointSDF(&fontInfo, pixelScale, minChar + charIndex, padding, onEdgeValue, pixelDistScale, &rect.width, &rect.height, &rect.xoff, &rect.yoff);
+		order[charIndex] = charIndex;
+	}
+	std::sort(order.begin(), order.end(), [&rects](const uint32_t a, const uint32_t b) { return rects[a].height > rects[b].height; });
+
+	// Find bitmap size where every glyph fits in, the height is cut down to the used rows
+	uint32_t bitmapSize = minBitmapSize;
+	uint32_t usedHeight = 0;
+	bool isPacked = false;
+	while(!(isPacked = PackSDFGlyphs(rects, order, bitmapSize, &usedHeight)) && bitmapSize < maxBitmapSize)
+		bitmapSize *= 2;
+	if(!isPacked) {
+		for(uint32_t charIndex = 0; charIndex < charCount; ++charIndex)
+			stbtt_FreeSDF(rects[charIndex].pixels, nullptr);
+		return(nullptr);
+	}
+	uint32_t bitmapWidth = bitmapSize;
+	uint32_t bitmapHeight = minBitmapSize;
+	while(bitmapHeight < usedHeight)
+		bitmapHeight *= 2;
+
+	uint8_t *fontBitmap = new uint8_t[bitmapWidth * bitmapHeight];
+	memset(fontBitmap, 0, bitmapWidth * bitmapHeight);
+
+	float invAtlasW = 1.0f / (float)bitmapWidth;
+	float invAtlasH = 1.0f / (float)bitmapHeight;
+
+	float fontScale = 1.0f / fontSize;
+
+	FontGlyph *glyphs = new FontGlyph[charCount];
+
+	float spaceAdvance = 0.0f;
+
+	for(uint32_t charIndex = 0; charIndex < charCount; ++charIndex) {
+		SDFGlyphRect &rect = rects[charIndex];
+
+		FontGlyph *outGlyph = glyphs + charIndex;
+
+		outGlyph->codePoint = minChar + charIndex;
+
+		int advanceWidth, leftSideBearing;
+		stbtt_GetCodepointHMetrics(&fontInfo, outGlyph->codePoint, &advanceWidth, &leftSideBearing);
+		outGlyph->advance = advanceWidth * pixelScale * fontScale;
+
+		if(outGlyph->codePoint == ' ') {
+			spaceAdvance = outGlyph->advance;
+		}
+
+		if(rect.pixels == nullptr) {
+			for(int i = 0; i < 4; ++i) {
+				outGlyph->uv[i] = glm::vec2(0.0f);
+				outGlyph->offset[i] = glm::vec2(0.0f);
+			}
+			continue;
+		}
+
+		for(int y = 0; y < rect.height; ++y) {
+			memcpy(fontBitmap + (rect.y + y) * bitmapWidth + rect.x, rect.pixels + y * rect.width, rect.width);
+		}
+		stbtt_FreeSDF(rect.pixels, nullptr);
+		rect.pixels = nullptr;
+
+		float s0 = rect.x * invAtlasW;
+		float t0 = rect.y * invAtlasH;
+		float s1 = (rect.x + rect.width) * invAtlasW;
+		float t1 = (rect.y + rect.height) * invAtlasH;
+
+		float x0 = rect.xoff * fontScale;
+		float y0 = rect.yoff * fontScale;
+		float x1 = (rect.xoff + rect.width) * fontScale;
+		float y1 = (rect.yoff + rect.height) * fontScale;
+
+		outGlyph->offset[0] = glm::vec2(x1, y0); // Top-right
+		outGlyph->offset[1] = glm::vec2(x0, y0); // Top-left
+		outGlyph->offset[2] = glm::vec2(x0, y1); // Bottom-left
+		outGlyph->offset[3] = glm::vec2(x1, y1); // Bottom-right
+
+		outGlyph->uv[0] = glm::vec2(s1, t0);
+		outGlyph->uv[1] = glm::vec2(s0, t0);
+		outGlyph->uv[2] = glm::vec2(s0, t1);
+		outGlyph->uv[3] = glm::vec2(s1, t1);
+	}
+
+	FontInfo info = {};
+	info.fontSize = fontSize;
+	info.minChar = minChar;
+	info.maxChar = maxChar;
+	info.descent = descent * pixelScale * fontScale;
+	info.ascent = ascent * pixelScale * fontScale;
+	info.spaceAdvance = spaceAdvance;
+	info.distanceSpread = padding * fontScale;
+
+	FontAtlas *result = new FontAtlas();
+	result->info = info;
+	result->glyphs = glyphs;
+	result->bitmapWidth = bitmapWidth;
+	result->bitmapHeight = bitmapHeight;
+	result->bitmap = fontBitmap;
+	return(result);
+}
+
 FontAtlas *FontAtlas::LoadFromFile(const std::string &filePath, const int fontIndex, const float fontSize, const uint32_t minChar, const uint32_t maxChar, const uint32_t minBitmapSize, const uint32_t maxBitmapSize) {
 	FontAtlas *result = nullptr;
 	const uint8_t *data = COSLowLevel::getBinaryFileContent(filePath);
@@ -154,4 +346,150 @@ FontAtlas *FontAtlas::LoadFromFile(const std::string &filePath, const int fontIn
 		result = LoadFromMemory(data, fontIndex, fontSize, minChar, maxChar, minBitmapSize, maxBitmapSize);
 	}
 	return(result);
-}
\ No newline at end of file
+}
+
+FontAtlas *FontAtlas::LoadFromBaked(const BakedFontAtlas &baked) {
+	uint32_t charCount = (baked.info.maxChar - baked.info.minChar) + 1;
+	size_t bitmapSize = (size_t)baked.bitmapWidth * baked.bitmapHeight;
+
+	uint8_t *fontBitmap = new uint8_t[bitmapSize];
+	size_t bitmapOffset = 0;
+	for(uint32_t i = 0; i < baked.bitmapDataSize && bitmapOffset < bitmapSize; ++i) {
+		uint8_t value = baked.bitmapData[i];
+		if(value == 0 && (i + 1) < baked.bitmapDataSize) {
+			size_t runLength = baked.bitmapData[++i];
+			if(runLength > bitmapSize - bitmapOffset)
+				runLength = bitmapSize - bitmapOffset;
+			memset(fontBitmap + bitmapOffset, 0, runLength);
+			bitmapOffset += runLength;
+		} else {
+			fontBitmap[bitmapOffset++] = value;
+		}
+	}
+	if(bitmapOffset != bitmapSize) {
+		delete[] fontBitmap;
+		return(nullptr);
+	}
+
+	FontGlyph *glyphs = new FontGlyph[charCount];
+	for(uint32_t charIndex = 0; charIndex < charCount; ++charIndex) {
+		const float *g = baked.glyphData + charIndex * BakedGlyphFloatCount;
+		FontGlyph *outGlyph = glyphs + charIndex;
+		outGlyph->codePoint = baked.info.minChar + charIndex;
+		for(int i = 0; i < 4; ++i) {
+			outGlyph->uv[i] = glm::vec2(g[i * 2 + 0], g[i * 2 + 1]);
+			outGlyph->offset[i] = glm::vec2(g[8 + i * 2 + 0], g[8 + i * 2 + 1]);
+		}
+		outGlyph->advance = g[16];
+	}
+
+	FontAtlas *result = new FontAtlas();
+	result->info = baked.info;
+	result->glyphs = glyphs;
+	result->bitmapWidth = baked.bitmapWidth;
+	result->bitmapHeight = baked.bitmapHeight;
+	result->bitmap = fontBitmap;
+	return(result);
+}
+
+FontAtlas *FontAtlas::Load(const char *name, const uint8_t *fontData, const int fontIndex, const float fontSize, const uint32_t minChar, const uint32_t maxChar, const bool isSDF) {
+	for(size_t i = 0; i < BakedFontAtlasCount; ++i) {
+		const BakedFontAtlas &baked = BakedFontAtlases[i];
+		if(strcmp(baked.name, name) == 0 && baked.info.fontSize == fontSize && baked.info.minChar == minChar && baked.info.maxChar == maxChar && (baked.info.distanceSpread > 0.0f) == isSDF) {
+			FontAtlas *result = LoadFromBaked(baked);
+			if(result != nullptr)
+				return(result);
+		}
+	}
+	if(isSDF)
+		return LoadSDFFromMemory(fontData, fontIndex, fontSize, minChar, maxChar);
+	return LoadFromMemory(fontData, fontIndex, fontSize, minChar, maxChar);
+}
+
+bool FontAtlas::WriteBakedHeader(const char *filePath, const FontBakeEntry *entries, const size_t entryCount) {
+	std::string out;
+	AppendFormat(out, "/*\n");
+	AppendFormat(out, "======================================================================================================================\n");
+	AppendFormat(out, "\tFluid Sandbox - BakedFonts.h\n");
+	AppendFormat(out, "\n");
+	AppendFormat(out, "\tCopyright (C) Torsten Spaete 2011-2021. All rights reserved.\n");
+	AppendFormat(out, "\tMPL v2 licensed. See LICENSE.txt for more details.\n");
+	AppendFormat(out, "======================================================================================================================\n");
+	AppendFormat(out, "*/\n");
+	AppendFormat(out, "\n");
+	AppendFormat(out, "// NOTE(final): Generated by \"FluidSandbox -bake-fonts <path to BakedFonts.h>\". Do not modify by hand!\n");
+	AppendFormat(out, "\n");
+	AppendFormat(out, "#pragma once\n");
+	AppendFormat(out, "\n");
+	AppendFormat(out, "#include \"FontAtlas.h\"\n");
+
+	for(size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex) {
+		const FontAtlas *atlas = entries[entryIndex].atlas;
+		uint32_t charCount = (atlas->info.maxChar - atlas->info.minChar) + 1;
+
+		AppendFormat(out, "\n");
+		AppendFormat(out, "static const float bakedFontGlyphs%zu[] = {\n", entryIndex);
+		for(uint32_t charIndex = 0; charIndex < charCount; ++charIndex) {
+			const FontGlyph &glyph = atlas->glyphs[charIndex];
+			const float values[BakedGlyphFloatCount] = {
+				glyph.uv[0].x, glyph.uv[0].y, glyph.uv[1].x, glyph.uv[1].y, glyph.uv[2].x, glyph.uv[2].y, glyph.uv[3].x, glyph.uv[3].y,
+				glyph.offset[0].x, glyph.offset[0].y, glyph.offset[1].x, glyph.offset[1].y, glyph.offset[2].x, glyph.offset[2].y, glyph.offset[3].x, glyph.offset[3].y,
+				glyph.advance,
+			};
+			out += "\t";
+			for(uint32_t i = 0; i < BakedGlyphFloatCount; ++i) {
+				AppendFloat(out, values[i]);
+				out += ",";
+			}
+			out += "\n";
+		}
+		AppendFormat(out, "};\n");
+
+		std::vector<uint8_t> bitmapData;
+		size_t bitmapSize = (size_t)atlas->bitmapWidth * atlas->bitmapHeight;
+		for(size_t i = 0; i < bitmapSize;) {
+			if(atlas->bitmap[i] == 0) {
+				size_t runLength = 1;
+				while(runLength < 255 && (i + runLength) < bitmapSize && atlas->bitmap[i + runLength] == 0)
+					++runLength;
+				bitmapData.push_back(0);
+				bitmapData.push_back((uint8_t)runLength);
+				i += runLength;
+			} else {
+				bitmapData.push_back(atlas->bitmap[i++]);
+			}
+		}
+
+		AppendFormat(out, "\n");
+		AppendFormat(out, "static const uint8_t bakedFontBitmap%zu[] = {", entryIndex);
+		for(size_t i = 0; i < bitmapData.size(); ++i) {
+			if((i % 32) == 0)
+				AppendFormat(out, "\n\t");
+			AppendFormat(out, "0x%02x,", bitmapData[i]);
+		}
+		AppendFormat(out, "\n};\n");
+	}
+
+	AppendFormat(out, "\n");
+	AppendFormat(out, "static const BakedFontAtlas BakedFontAtlases[] = {\n");
+	for(size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex) {
+		const FontAtlas *atlas = entries[entryIndex].atlas;
+		const FontInfo &info = atlas->info;
+		AppendFormat(out, "\t{ \"%s\", { %u, %u, ", entries[entryIndex].name, info.minChar, info.maxChar);
+		const float infoValues[] = { info.fontSize, info.ascent, info.descent, info.spaceAdvance, info.distanceSpread };
+		for(size_t i = 0; i < fplArrayCount(infoValues); ++i) {
+			AppendFloat(out, infoValues[i]);
+			out += i < (fplArrayCount(infoValues) - 1) ? ", " : " }, ";
+		}
+		AppendFormat(out, "%u, %u, bakedFontGlyphs%zu, bakedFontBitmap%zu, sizeof(bakedFontBitmap%zu) },\n", atlas->bitmapWidth, atlas->bitmapHeight, entryIndex, entryIndex, entryIndex);
+	}
+	AppendFormat(out, "};\n");
+	AppendFormat(out, "static const size_t BakedFontAtlasCount = sizeof(BakedFontAtlases) / sizeof(BakedFontAtlases[0]);\n");
+
+	fplFileHandle file;
+	if(!fplFileCreateBinary(filePath, &file))
+		return(false);
+	bool result = fplFileWriteBlock(&file, out.c_str(), out.size()) == out.size();
+	fplFileClose(&file);
+	return(result);
+}
@@ -22,6 +22,8 @@ struct FontInfo {
 	float ascent;
 	float descent;
 	float spaceAdvance;
+	// Distance in font units which the distance field covers on each side of the glyph edge, zero when the atlas stores coverage
+	float distanceSpread;
 };
 
 struct FontGlyph {
@@ -32,6 +34,26 @@ struct FontGlyph {
 	uint32_t codePoint; // The unicode codepoint
 };
 
+// Font atlas which was packed at build time, see FontAtlas::WriteBakedHeader() and BakedFonts.h
+struct BakedFontAtlas {
+	const char *name;
+	FontInfo info;
+	uint32_t bitmapWidth;
+	uint32_t bitmapHeight;
+	// Per glyph: uv[4], offset[4], advance
+	const float *glyphData;
+	// Zero runs are stored as a zero byte followed by the run length (1-255), other bytes are stored as-is
+	const uint8_t *bitmapData;
+	uint32_t bitmapDataSize;
+};
+
+struct FontAtlas;
+
+struct FontBakeEntry {
+	const char *name;
+	const FontAtlas *atlas;
+};
+
 struct FontAtlas {
 	FontInfo info;
 	FontGlyph *glyphs;
@@ -41,5 +63,12 @@ struct FontAtlas {
 	FontAtlas();
 	~FontAtlas();
 	static FontAtlas *LoadFromMemory(const uint8_t *fontData, const int fontIndex, const float fontSize, const uint32_t minChar, const uint32_t maxChar, const uint32_t minBitmapSize = 256, const uint32_t maxBitmapSize = 8192);
+	// Signed distance field atlas, rasterized once at the given font size and rendered at any size with the SDF path in FontTexture.fragment
+	static FontAtlas *LoadSDFFromMemory(const uint8_t *fontData, const int fontIndex, const float fontSize, const uint32_t minChar, const uint32_t maxChar, const int padding = 4, const uint32_t minBitmapSize = 128, const uint32_t maxBitmapSize = 4096);
+	static FontAtlas *LoadFromBaked(const BakedFontAtlas &baked);
+	// Uses the baked atlas with the same name, size, character range and type if there is one, otherwise the atlas is packed from the font data
+	static FontAtlas *Load(const char *name, const uint8_t *fontData, const int fontIndex, const float fontSize, const uint32_t minChar, const uint32_t maxChar, const bool isSDF);
+	inline bool IsSDF() const { return info.distanceSpread > 0.0f; }
+	static bool WriteBakedHeader(const char *filePath, const FontBakeEntry *entries, const size_t entryCount);
 	static FontAtlas *LoadFromFile(const std::string &filePath, const int fontIndex, const float fontSize, const uint32_t minChar, const uint32_t maxChar, const uint32_t minBitmapSize = 256, const uint32_t maxBitmapSize = 8192);
 };
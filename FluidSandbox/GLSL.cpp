@@ -8,12 +8,21 @@
 */
 
 #include "GLSL.h"
+#include "ShaderCache.h"
 
 #include <iostream>
+#include <assert.h>
+
+// GL_KHR_parallel_shader_compile and GL_ARB_parallel_shader_compile shares the same value
+#ifndef GL_COMPLETION_STATUS_KHR
+#	define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
 
 CGLSL::CGLSL(void)
 {
 	program = glCreateProgram();
+	cacheKey = 0;
+	isLinkPending = false;
 }
 
 
@@ -56,6 +65,92 @@ void CGLSL::attachShader(const GLuint shaderType, const char* source)
 	updateUniformLocations();
 }
 
+void CGLSL::addShaderSource(const GLuint shaderType, const char* source)
+{
+	assert(!isLinkPending);
+	GLSLShaderSource shaderSource;
+	shaderSource.source = source;
+	shaderSource.type = shaderType;
+	shaderSource.id = 0;
+	sources.push_back(shaderSource);
+}
+
+bool CGLSL::beginLink(CShaderCache *cache)
+{
+	assert(!isLinkPending);
+	assert(sources.size() > 0);
+
+	if (cache != nullptr)
+	{
+		cacheKey = cache->ComputeKey(sources);
+		if (cache->LoadProgram(program, cacheKey))
+		{
+			isLinkPending = true;
+			return true;
+		}
+		if (cache->IsBinarySupported())
+			glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+
+	// NOTE(final): No status queries here, because any query would block until the driver has finished compiling
+	for (size_t i = 0; i < sources.size(); ++i)
+	{
+		GLSLShaderSource &shaderSource = sources[i];
+		const char *source = shaderSource.source.c_str();
+		shaderSource.id = glCreateShader(shaderSource.type);
+		glShaderSource(shaderSource.id, 1, &source, nullptr);
+		glCompileShader(shaderSource.id);
+		glAttachShader(program, shaderSource.id);
+	}
+	glLinkProgram(program);
+	isLinkPending = true;
+	return false;
+}
+
+bool CGLSL::isLinkCompleted(const bool hasCompletionStatus)
+{
+	if (!isLinkPending || !hasCompletionStatus)
+		return true;
+	GLint r = GL_FALSE;
+	glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &r);
+	return r == GL_TRUE;
+}
+
+bool CGLSL::endLink(CShaderCache *cache)
+{
+	assert(isLinkPending);
+	isLinkPending = false;
+
+	bool isCompiled = false;
+	GLint r = GL_FALSE;
+	for (size_t i = 0; i < sources.size(); ++i)
+	{
+		GLSLShaderSource &shaderSource = sources[i];
+		if (shaderSource.id == 0)
+			continue;
+		isCompiled = true;
+		glGetShaderiv(shaderSource.id, GL_COMPILE_STATUS, &r);
+		if (r == GL_FALSE)
+			printShaderInfoLog(shaderSource.id);
+		glDetachShader(program, shaderSource.id);
+		glDeleteShader(shaderSource.id);
+		shaderSource.id = 0;
+	}
+
+	glGetProgramiv(program, GL_LINK_STATUS, &r);
+	bool result = r == GL_TRUE;
+	if (!result)
+		printProgramInfoLog(program);
+	else if (isCompiled && cache != nullptr)
+		cache->SaveProgram(program, cacheKey);
+
+	sources.clear();
+
+	updateUniformLocations();
+
+	return result;
+}
+
 void CGLSL::printShaderInfoLog(GLuint obj)
 {
 	int infologLength = 0;
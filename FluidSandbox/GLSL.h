@@ -11,10 +11,25 @@
 
 #include <final_dynamic_opengl.h>
 
+#include <string>
+#include <vector>
+#include <cstdint>
+
+class CShaderCache;
+
+struct GLSLShaderSource {
+	std::string source;
+	GLuint type;
+	GLuint id;
+};
+
 class CGLSL
 {
 private:
+	std::vector<GLSLShaderSource> sources;
+	uint64_t cacheKey;
 	GLuint program;
+	bool isLinkPending;
 	void printShaderInfoLog(GLuint obj);
 	void printProgramInfoLog(GLuint obj);
 protected:
@@ -24,7 +39,17 @@ public:
 	~CGLSL(void);
 	void enable();
 	void disable();
+	inline GLuint getProgram() const { return program; }
 	void attachShader(const GLuint shaderType, const char* source);
+
+	// Deferred build: Sources are added first, compiling and linking is started by beginLink() and the results are queried in endLink() only.
+	// This way the driver can compile multiple programs in parallel, see CShaderCache::Build()
+	void addShaderSource(const GLuint shaderType, const char* source);
+	inline const std::vector<GLSLShaderSource> &getShaderSources() const { return sources; }
+	// Returns true when the program was loaded from the cache
+	bool beginLink(CShaderCache *cache);
+	bool isLinkCompleted(const bool hasCompletionStatus);
+	bool endLink(CShaderCache *cache);
 	GLint getUniformLocation(const char* name);
 	GLint getAttribLocation(const char* name);
 	void uniform1i(const GLint location, const GLint value);
@@ -14,6 +14,15 @@
 
 #include "final_platform_layer.h"
 
+#if defined(FPL_PLATFORM_WINDOWS)
+#	include <windows.h>
+#else
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#endif
+
 #include "Utils.h"
 
 namespace COSLowLevel {
@@ -55,9 +64,67 @@ namespace COSLowLevel {
 		return(result);
 	}
 
+	bool COSLowLevel::mapFile(const char *filePath, MappedFile *outFile) {
+		*outFile = {};
+#if defined(FPL_PLATFORM_WINDOWS)
+		HANDLE file = CreateFileA(filePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if(file == INVALID_HANDLE_VALUE)
+			return(false);
+		LARGE_INTEGER fileSize;
+		if(!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+			CloseHandle(file);
+			return(false);
+		}
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if(mapping == nullptr) {
+			CloseHandle(file);
+			return(false);
+		}
+		void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if(data == nullptr) {
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return(false);
+		}
+		outFile->data = (const uint8_t *)data;
+		outFile->size = (size_t)fileSize.QuadPart;
+		outFile->fileHandle = file;
+		outFile->mappingHandle = mapping;
+#else
+		int fd = open(filePath, O_RDONLY);
+		if(fd == -1)
+			return(false);
+		struct stat fileStat;
+		if(fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+			close(fd);
+			return(false);
+		}
+		void *data = mmap(nullptr, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if(data == MAP_FAILED)
+			return(false);
+		outFile->data = (const uint8_t *)data;
+		outFile->size = (size_t)fileStat.st_size;
+#endif
+		return(true);
+	}
+
+	void COSLowLevel::unmapFile(MappedFile *file) {
+		if(file->data == nullptr)
+			return;
+#if defined(FPL_PLATFORM_WINDOWS)
+		UnmapViewOfFile(file->data);
+		CloseHandle((HANDLE)file->mappingHandle);
+		CloseHandle((HANDLE)file->fileHandle);
+#else
+		munmap((void *)file->data, file->size);
+#endif
+		*file = {};
+	}
+
 	std::vector<std::string> COSLowLevel::getFilesInDirectory(const std::string &folderPath, const std::string &filter) {
 		std::vector<std::string> result;
-		fplFileEntry entry;
+		fplFileEntry entry = {};
 		for(bool isValid = fplDirectoryListBegin(folderPath.c_str(), filter.c_str(), &entry); isValid; isValid = fplDirectoryListNext(&entry)) {
 			if(entry.type == fplFileEntryType_File) {
 				result.push_back(std::string(entry.name));
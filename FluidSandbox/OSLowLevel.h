@@ -15,10 +15,20 @@
 
 namespace COSLowLevel
 {
+	// Read-only view of a whole file
+	struct MappedFile {
+		const uint8_t *data;
+		size_t size;
+		void *fileHandle;
+		void *mappingHandle;
+	};
+
 	uint32_t getNumCPUCores();
 	std::string getTextFileContent(const std::string &filePath);
 	uint8_t *getBinaryFileContent(const std::string &filePath);
 	bool fileExists(const char* filePath);
+	bool mapFile(const char *filePath, MappedFile *outFile);
+	void unmapFile(MappedFile *file);
 	std::vector<std::string> getFilesInDirectory(const std::string &folderPath, const std::string &filter);
 	double getTimeMilliSeconds();
 	std::string getAppPath(const int argc, char** argv);
@@ -19,6 +19,7 @@
 #include <typeinfo>
 
 #include "OSLowLevel.h"
+#include "DebugDraw.h"
 
 namespace PhysicsUtils {
 	inline physx::PxForceMode::Enum toPxForceMode(const PhysicsForceMode mode) {
@@ -54,33 +55,30 @@ namespace PhysicsUtils {
 	}
 }
 
-static physx::PxShape *CreateShape(physx::PxPhysics &physics, physx::PxMaterial &defaultMaterial, const PhysicsShape &shape) {
-	physx::PxGeometry *geometry = nullptr;
-	physx::PxBoxGeometry boxGeometry;
-	physx::PxSphereGeometry sphereGeometry;
-	physx::PxCapsuleGeometry capsuleGeometry;
-	physx::PxPlaneGeometry planeGeometry;
+static physx::PxGeometryHolder CreateGeometry(const PhysicsShape &shape) {
+	physx::PxGeometryHolder result;
 	switch(shape.type) {
 		case PhysicsShape::Type::Box:
-			boxGeometry = physx::PxBoxGeometry(shape.box.halfExtents.x, shape.box.halfExtents.y, shape.box.halfExtents.z);
-			geometry = &boxGeometry;
+			result.storeAny(physx::PxBoxGeometry(shape.box.halfExtents.x, shape.box.halfExtents.y, shape.box.halfExtents.z));
 			break;
 		case PhysicsShape::Type::Sphere:
-			sphereGeometry = physx::PxSphereGeometry(shape.sphere.radius);
-			geometry = &sphereGeometry;
+			result.storeAny(physx::PxSphereGeometry(shape.sphere.radius));
 			break;
 		case PhysicsShape::Type::Capsule:
-			capsuleGeometry = physx::PxCapsuleGeometry(shape.capsule.radius, shape.capsule.halfHeight);
-			geometry = &capsuleGeometry;
+			result.storeAny(physx::PxCapsuleGeometry(shape.capsule.radius, shape.capsule.halfHeight));
 			break;
 		case PhysicsShape::Type::Plane:
-			planeGeometry = physx::PxPlaneGeometry();
-			geometry = &planeGeometry;
+			result.storeAny(physx::PxPlaneGeometry());
 			break;
 		default:
 			assert(!"Shape type not supported!");
 			break;
 	}
+	return(result);
+}
+
+static physx::PxShape *CreateShape(physx::PxPhysics &physics, physx::PxMaterial &defaultMaterial, const PhysicsShape &shape) {
+	physx::PxGeometryHolder geometry = CreateGeometry(shape);
 
 	physx::PxShapeFlags shapeFlags =
 		physx::PxShapeFlag::eVISUALIZATION |
@@ -90,7 +88,7 @@ static physx::PxShape *CreateShape(physx::PxPhysics &physics, physx::PxMaterial
 		shapeFlags |= physx::PxShapeFlag::ePARTICLE_DRAIN;
 	}
 
-	physx::PxShape *result = physics.createShape(*geometry, defaultMaterial, true, shapeFlags);
+	physx::PxShape *result = physics.createShape(geometry.any(), defaultMaterial, true, shapeFlags);
 	return(result);
 }
 
@@ -146,12 +144,54 @@ struct NativeRigidBody: public PhysicsRigidBody {
 			actor->attachShape(*newShape);
 		}
 	}
+
+	void SetLinearVelocity(const glm::vec3 &velocity) {
+		this->velocity = velocity;
+		physx::PxRigidDynamic *dynamicActor = actor != nullptr ? actor->is<physx::PxRigidDynamic>() : nullptr;
+		if(dynamicActor != nullptr) {
+			dynamicActor->setLinearVelocity(PhysicsUtils::toPxVec3(velocity));
+		}
+	}
+
+	// Reuses the actor and its shape for a new body with the same motion kind and shape type
+	void Reuse(const glm::vec3 &pos, const glm::quat &rotation, const PhysicsShape &shape) {
+		assert(shapeCount == 1 && shapes[0].type == shape.type);
+		shapes[0] = shape;
+		velocity = glm::vec3(0);
+		bounds = PhysicsBoundingBox();
+		userData = nullptr;
+		this->transform = PhysicsTransform(pos, rotation);
+
+		physx::PxShape *nshape = nullptr;
+		actor->getShapes(&nshape, 1);
+		nshape->setFlag(physx::PxShapeFlag::ePARTICLE_DRAIN, shape.isParticleDrain);
+
+		// Planes are always created at the origin
+		if(shape.type == PhysicsShape::Type::Plane)
+			return;
+
+		actor->setGlobalPose(physx::PxTransform(PhysicsUtils::toPxVec3(pos), PhysicsUtils::toPxQuat(rotation)));
+		nshape->setGeometry(CreateGeometry(shape).any());
+
+		physx::PxRigidDynamic *dynamicActor = actor->is<physx::PxRigidDynamic>();
+		if(dynamicActor != nullptr) {
+			dynamicActor->setLinearVelocity(physx::PxVec3(0.0f), false);
+			dynamicActor->setAngularVelocity(physx::PxVec3(0.0f), false);
+			physx::PxRigidBodyExt::updateMassAndInertia(*dynamicActor, density);
+		}
+	}
 };
 
 struct NativeParticleSystem: public PhysicsParticleSystem {
 	physx::PxParticleExt::IndexPool *indexPool;
 	physx::PxParticleFluid *fluid;
 
+	// Scratch buffers which are reused for every frame and every added particle batch
+	std::vector<physx::PxU32> drainedIndices;
+	std::vector<physx::PxU32> createIndices;
+	std::vector<physx::PxVec3> createPositions;
+	std::vector<physx::PxVec3> createVelocities;
+
 	NativeParticleSystem(physx::PxPhysics *physics, const bool useGPUAcceleration, const FluidSimulationProperties &desc, const uint32_t maxParticleCount):
 		PhysicsParticleSystem(maxParticleCount),
 		indexPool(nullptr),
@@ -164,26 +204,42 @@ struct NativeParticleSystem: public PhysicsParticleSystem {
 			fluid->setParticleReadDataFlag(physx::PxParticleReadDataFlag::ePOSITION_BUFFER, true);
 			fluid->setParticleReadDataFlag(physx::PxParticleReadDataFlag::eDENSITY_BUFFER, true);
 			fluid->setParticleReadDataFlag(physx::PxParticleReadDataFlag::eVELOCITY_BUFFER, true);
-			fluid->setStiffness(desc.stiffness);
-			fluid->setViscosity(desc.viscosity);
-			fluid->setRestitution(desc.restitution);
-			fluid->setDamping(desc.damping);
-			fluid->setDynamicFriction(desc.dynamicFriction);
-			fluid->setStaticFriction(desc.staticFriction);
-			fluid->setMaxMotionDistance(desc.maxMotionDistance);
-			fluid->setRestOffset(desc.restOffset);
-			fluid->setContactOffset(desc.contactOffset);
-			fluid->setRestParticleDistance(desc.restParticleDistance);
-			fluid->setParticleMass(desc.particleMass);
-			fluid->setGridSize(desc.cellSize);
-
 			fluid->setParticleBaseFlag(physx::PxParticleBaseFlag::eCOLLISION_TWOWAY, true);
-
-			// Set GPU acceleration for particle fluid if supported
-			fluid->setParticleBaseFlag(physx::PxParticleBaseFlag::eGPU, useGPUAcceleration);
+			ApplyProperties(desc, useGPUAcceleration);
 		}
 	}
 
+	// NOTE(final): Grid size, rest particle distance, offsets and max motion distance can only be changed while the fluid is not part of a scene
+	void ApplyProperties(const FluidSimulationProperties &desc, const bool useGPUAcceleration) {
+		cellSize = desc.cellSize;
+
+		fluid->setStiffness(desc.stiffness);
+		fluid->setViscosity(desc.viscosity);
+		fluid->setRestitution(desc.restitution);
+		fluid->setDamping(desc.damping);
+		fluid->setDynamicFriction(desc.dynamicFriction);
+		fluid->setStaticFriction(desc.staticFriction);
+		fluid->setMaxMotionDistance(desc.maxMotionDistance);
+		fluid->setRestOffset(desc.restOffset);
+		fluid->setContactOffset(desc.contactOffset);
+		fluid->setRestParticleDistance(desc.restParticleDistance);
+		fluid->setParticleMass(desc.particleMass);
+		fluid->setGridSize(desc.cellSize);
+
+		// Set GPU acceleration for particle fluid if supported
+		fluid->setParticleBaseFlag(physx::PxParticleBaseFlag::eGPU, useGPUAcceleration);
+	}
+
+	// Releases all particles at once, so the fluid and its buffers can be reused for the next scene
+	void Recycle() {
+		fluid->releaseParticles();
+		indexPool->freeIndices();
+		activeParticleCount = 0;
+		bounds = PhysicsBoundingBox();
+		userData = nullptr;
+		SetExternalAcceleration(glm::vec3(0.0f));
+	}
+
 	~NativeParticleSystem() {
 		if(fluid != nullptr) {
 			fluid->release();
@@ -208,7 +264,7 @@ struct NativeParticleSystem: public PhysicsParticleSystem {
 		physx::PxBounds3 nbounds = fluid->getWorldBounds();
 		this->bounds = PhysicsBoundingBox(PhysicsUtils::toGLMVec3(nbounds.minimum), PhysicsUtils::toGLMVec3(nbounds.maximum));
 
-		std::vector<physx::PxU32> deletedPartices;
+		drainedIndices.clear();
 
 		physx::PxParticleFluidReadData *rd = fluid->lockParticleFluidReadData(physx::PxDataAccessFlag::eREADABLE);
 		uint32_t count = 0;
@@ -221,7 +277,7 @@ struct NativeParticleSystem: public PhysicsParticleSystem {
 				physx::PxParticleFlags flags = *flagsIt;
 				bool isDrained = flags & physx::PxParticleFlag::eCOLLISION_WITH_DRAIN;
 				if(isDrained) {
-					deletedPartices.push_back(i);
+					drainedIndices.push_back(i);
 				}
 				if(flags & physx::PxParticleFlag::eVALID && !isDrained) {
 					positions[count].x = positionIt->x;
@@ -236,8 +292,8 @@ struct NativeParticleSystem: public PhysicsParticleSystem {
 			}
 			rd->unlock();
 		}
-		if(deletedPartices.size() > 0) {
-			releaseParticles(physx::PxStrideIterator<physx::PxU32>(&deletedPartices[0]), (physx::PxU32)deletedPartices.size());
+		if(drainedIndices.size() > 0) {
+			releaseParticles(physx::PxStrideIterator<physx::PxU32>(&drainedIndices[0]), (physx::PxU32)drainedIndices.size());
 		}
 		activeParticleCount = count;
 	}
@@ -246,29 +302,29 @@ struct NativeParticleSystem: public PhysicsParticleSystem {
 		assert(storage.positions != nullptr);
 		assert(storage.velocities != nullptr);
 
-		std::vector<physx::PxU32> indicesList;
-		std::vector<physx::PxVec3> positions;
-		std::vector<physx::PxVec3> velocities;
-
 		assert((activeParticleCount + storage.numParticles) <= maxParticleCount);
 
+		createIndices.clear();
+		createPositions.clear();
+		createVelocities.clear();
+
 		int addedParticles = 0;
 		for(uint32_t i = 0; i < storage.numParticles; i++) {
-			positions.push_back(PhysicsUtils::toPxVec3(storage.positions[i]));
-			velocities.push_back(PhysicsUtils::toPxVec3(storage.velocities[i]));
-			indicesList.push_back(physx::PxU32(0));
+			createPositions.push_back(PhysicsUtils::toPxVec3(storage.positions[i]));
+			createVelocities.push_back(PhysicsUtils::toPxVec3(storage.velocities[i]));
+			createIndices.push_back(physx::PxU32(0));
 			++addedParticles;
 		}
 		activeParticleCount += storage.numParticles;
 
-		physx::PxStrideIterator<physx::PxU32> indexBuffer(&indicesList[0]);
+		physx::PxStrideIterator<physx::PxU32> indexBuffer(&createIndices[0]);
 		physx::PxU32 numAllocated = indexPool->allocateIndices(addedParticles, indexBuffer);
 
 		physx::PxParticleCreationData particleCreationData;
 		particleCreationData.numParticles = addedParticles;
 		particleCreationData.indexBuffer = indexBuffer;
-		particleCreationData.positionBuffer = physx::PxStrideIterator<physx::PxVec3>(&positions[0]);
-		particleCreationData.velocityBuffer = physx::PxStrideIterator<physx::PxVec3>(&velocities[0]);
+		particleCreationData.positionBuffer = physx::PxStrideIterator<physx::PxVec3>(&createPositions[0]);
+		particleCreationData.velocityBuffer = physx::PxStrideIterator<physx::PxVec3>(&createVelocities[0]);
 
 		bool result = fluid->createParticles(particleCreationData);
 		return(result);
@@ -294,6 +350,7 @@ struct NativeParticleSystem: public PhysicsParticleSystem {
 	void SetExternalAcceleration(const glm::vec3 &accel) {
 		physx::PxVec3 nacc = PhysicsUtils::toPxVec3(accel);
 		fluid->setExternalAcceleration(nacc);
+		externalAcceleration = accel;
 	}
 
 	void SetViscosity(const float viscosity) {
@@ -363,6 +420,12 @@ public:
 	std::vector<NativeParticleSystem *> particleSystems;
 	std::vector<NativeRigidBody *> rigidbodies;
 
+	// Removed actors are kept outside of the scene and reused, so scene resets do not recreate the fluid or any body
+	constexpr static int MotionKindCount = (int)PhysicsRigidBody::MotionKind::Dynamic + 1;
+	constexpr static int ShapeTypeCount = (int)PhysicsShape::Type::Capsule + 1;
+	std::vector<NativeParticleSystem *> particleSystemPool;
+	std::vector<NativeRigidBody *> rigidBodyPool[MotionKindCount][ShapeTypeCount];
+
 	NativePhysicsEngine::NativePhysicsEngine(const PhysicsEngineConfiguration &config):
 		PhysicsEngine(config),
 		foundation(nullptr),
@@ -391,7 +454,7 @@ public:
 				scene->removeActor(*particleSystem->fluid);
 				particleSystem->isReady = false;
 			}
-			delete particleSystem;
+			ReleaseActor(particleSystem);
 		}
 		particleSystems.clear();
 
@@ -401,8 +464,7 @@ public:
 				scene->removeActor(*rigidbody->actor);
 				rigidbody->isReady = false;
 			}
-			delete rigidbody;
-			// Do not delete, it will be deleted outside
+			ReleaseActor(rigidbody);
 		}
 		rigidbodies.clear();
 
@@ -419,10 +481,27 @@ public:
 		assert(actorCount == 0);
 	}
 
+	void ClearPools() {
+		for(size_t i = 0, count = particleSystemPool.size(); i < count; ++i) {
+			delete particleSystemPool[i];
+		}
+		particleSystemPool.clear();
+		for(int motionKind = 0; motionKind < MotionKindCount; ++motionKind) {
+			for(int shapeType = 0; shapeType < ShapeTypeCount; ++shapeType) {
+				std::vector<NativeRigidBody *> &pool = rigidBodyPool[motionKind][shapeType];
+				for(size_t i = 0, count = pool.size(); i < count; ++i) {
+					delete pool[i];
+				}
+				pool.clear();
+			}
+		}
+	}
+
 	void Shutdown() {
 		// Clear and release scene
 		if(scene != nullptr) {
 			ClearScene();
+			ClearPools();
 			scene->release();
 			scene = nullptr;
 		}
@@ -696,7 +775,34 @@ public:
 		if(nactor != nullptr) {
 			scene->addActor(*nactor);
 			actor->isReady = true;
+
+			// Reused bodies may have been sleeping when they were removed
+			physx::PxRigidDynamic *dynamicActor = nactor->is<physx::PxRigidDynamic>();
+			if(dynamicActor != nullptr) {
+				dynamicActor->wakeUp();
+			}
+		}
+	}
+
+	void ReleaseActor(PhysicsActor *actor) {
+		// NOTE(final): Actors are already removed from the scene here
+		assert(!actor->isReady);
+		if(isInitialized && actor->type == PhysicsActor::Type::RigidBody) {
+			NativeRigidBody *rigidbody = static_cast<NativeRigidBody *>(actor);
+			// Bodies with additional shapes are not reused
+			if(rigidbody->actor != nullptr && rigidbody->shapeCount == 1) {
+				rigidBodyPool[(int)rigidbody->motionKind][(int)rigidbody->shapes[0].type].push_back(rigidbody);
+				return;
+			}
+		} else if(isInitialized && actor->type == PhysicsActor::Type::ParticleSystem) {
+			NativeParticleSystem *particleSystem = static_cast<NativeParticleSystem *>(actor);
+			if(particleSystem->fluid != nullptr) {
+				particleSystem->Recycle();
+				particleSystemPool.push_back(particleSystem);
+				return;
+			}
 		}
+		delete actor;
 	}
 
 	void RemoveActor(PhysicsActor *actor) {
@@ -723,10 +829,31 @@ public:
 
 	PhysicsParticleSystem *CreateParticleSystem(const FluidSimulationProperties &desc, const uint32_t maxParticleCount) {
 		if(!isInitialized) return(nullptr);
+		for(size_t i = 0, count = particleSystemPool.size(); i < count; ++i) {
+			NativeParticleSystem *pooled = particleSystemPool[i];
+			if(pooled->maxParticleCount >= maxParticleCount) {
+				particleSystemPool.erase(particleSystemPool.begin() + i);
+				pooled->ApplyProperties(desc, useGPUAcceleration);
+				return(pooled);
+			}
+		}
 		NativeParticleSystem *result = new NativeParticleSystem(physics, useGPUAcceleration, desc, maxParticleCount);
 		return(result);
 	}
 
+	void ConfigureParticleSystem(PhysicsParticleSystem *particleSystem, const FluidSimulationProperties &desc) {
+		if(!isInitialized || particleSystem == nullptr) return;
+		NativeParticleSystem *nativeParticleSys = static_cast<NativeParticleSystem *>(particleSystem);
+		// Same as changing the GPU flag, the fluid is removed from the scene while its properties are changed
+		if(nativeParticleSys->isReady) {
+			scene->removeActor(*nativeParticleSys->fluid);
+		}
+		nativeParticleSys->ApplyProperties(desc, useGPUAcceleration);
+		if(nativeParticleSys->isReady) {
+			scene->addActor(*nativeParticleSys->fluid);
+		}
+	}
+
 	bool AddParticles(PhysicsParticleSystem *particleSystem, const PhysicsParticlesStorage &storage) {
 		if(!isInitialized || particleSystem == nullptr) return(false);
 		NativeParticleSystem *nativeParticleSys = static_cast<NativeParticleSystem *>(particleSystem);
@@ -735,6 +862,13 @@ public:
 	}
 
 	PhysicsRigidBody *CreateRigidBody(const PhysicsRigidBody::MotionKind motionKind, const glm::vec3 &pos, const glm::quat &rotation, const PhysicsShape &shape) {
+		std::vector<NativeRigidBody *> &pool = rigidBodyPool[(int)motionKind][(int)shape.type];
+		if(!pool.empty()) {
+			NativeRigidBody *pooled = pool.back();
+			pool.pop_back();
+			pooled->Reuse(pos, rotation, shape);
+			return(pooled);
+		}
 		PhysicsRigidBody *nativeRigidBody = new NativeRigidBody(physics, scene, defaultMaterial, motionKind, pos, rotation, shape);
 		return(nativeRigidBody);
 	}
@@ -820,7 +954,7 @@ void PhysicsEngine::DeleteParticleSystem(PhysicsParticleSystem *particleSystem)
 	if(particleSystem != nullptr) {
 		RemoveActor(particleSystem);
 		actors.erase(std::remove(actors.begin(), actors.end(), particleSystem), actors.end());
-		delete particleSystem;
+		ReleaseActor(particleSystem);
 	}
 }
 
@@ -837,6 +971,54 @@ void PhysicsEngine::DeleteRigidBody(PhysicsRigidBody *body) {
 	if(body != nullptr) {
 		RemoveActor(body);
 		actors.erase(std::remove(actors.begin(), actors.end(), body), actors.end());
-		delete body;
+		ReleaseActor(body);
+	}
+}
+
+void PhysicsEngine::DrawDebug() const {
+	if(!DebugDraw::IsActive()) return;
+
+	const glm::vec4 bodyColor = glm::vec4(0.0f, 1.0f, 1.0f, 1.0f);
+	const glm::vec4 fluidColor = glm::vec4(1.0f, 1.0f, 0.0f, 1.0f);
+	const glm::vec4 cellColor = glm::vec4(0.5f, 0.5f, 0.0f, 1.0f);
+	const glm::vec4 accelerationColor = glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
+	constexpr int MaxCellLines = 64;
+
+	for(size_t i = 0, count = actors.size(); i < count; ++i) {
+		const PhysicsActor *actor = actors[i];
+		const PhysicsBoundingBox &bounds = actor->bounds;
+		if(actor->type == PhysicsActor::Type::RigidBody) {
+			DebugDraw::Box(bounds.min, bounds.max, bodyColor);
+		} else if(actor->type == PhysicsActor::Type::ParticleSystem) {
+			const PhysicsParticleSystem *particleSystem = static_cast<const PhysicsParticleSystem *>(actor);
+			if(particleSystem->activeParticleCount == 0) continue;
+
+			DebugDraw::Box(bounds.min, bounds.max, fluidColor);
+
+			// Grid cells on the bottom of the fluid bounds
+			float cellSize = particleSystem->cellSize;
+			if(cellSize > 0.0f) {
+				glm::vec3 start = glm::floor(bounds.min / cellSize) * cellSize;
+				glm::vec3 end = glm::ceil(bounds.max / cellSize) * cellSize;
+				int cellsX = std::min((int)((end.x - start.x) / cellSize + 0.5f), MaxCellLines);
+				int cellsZ = std::min((int)((end.z - start.z) / cellSize + 0.5f), MaxCellLines);
+				float y = bounds.min.y;
+				for(int x = 0; x <= cellsX; ++x) {
+					float px = start.x + (float)x * cellSize;
+					DebugDraw::Line(glm::vec3(px, y, start.z), glm::vec3(px, y, start.z + (float)cellsZ * cellSize), cellColor);
+				}
+				for(int z = 0; z <= cellsZ; ++z) {
+					float pz = start.z + (float)z * cellSize;
+					DebugDraw::Line(glm::vec3(start.x, y, pz), glm::vec3(start.x + (float)cellsX * cellSize, y, pz), cellColor);
+				}
+			}
+
+			// External acceleration applied to the whole fluid
+			if(glm::dot(particleSystem->externalAcceleration, particleSystem->externalAcceleration) > 0.0f) {
+				glm::vec3 center = bounds.GetCenter();
+				DebugDraw::Line(center, center + particleSystem->externalAcceleration * 0.1f, accelerationColor);
+				DebugDraw::Sphere(center, 0.1f, accelerationColor);
+			}
+		}
 	}
-}
\ No newline at end of file
+}
@@ -187,6 +187,9 @@ protected:
 public:
 	virtual ~PhysicsRigidBody() {}
 
+	// Only dynamic bodies are moved by the velocity, static bodies just keep it
+	virtual void SetLinearVelocity(const glm::vec3 &velocity) = 0;
+
 	virtual void AddShape(const PhysicsShape &shape) {
 		assert(shapeCount < MaxShapeCount);
 		PhysicsShape *targetShape = shapes + shapeCount;
@@ -219,11 +222,15 @@ struct PhysicsParticleSystem: PhysicsActor {
 	glm::vec3 *positions;
 	glm::vec3 *velocities;
 	float *densities;
+	glm::vec3 externalAcceleration;
+	float cellSize;
 	uint32_t maxParticleCount;
 	uint32_t activeParticleCount;
 protected:
 	PhysicsParticleSystem(const uint32_t maxParticleCount):
 		PhysicsActor(PhysicsActor::Type::ParticleSystem),
+		externalAcceleration(glm::vec3(0)),
+		cellSize(0.0f),
 		maxParticleCount(maxParticleCount),
 		activeParticleCount(0) {
 		positions = new glm::vec3[maxParticleCount];
@@ -298,6 +305,11 @@ protected:
 
 	virtual PhysicsRigidBody *CreateRigidBody(const PhysicsRigidBody::MotionKind motionKind, const glm::vec3 &pos, const glm::quat &rotation, const PhysicsShape &shape) = 0;
 
+	// Called for actors which are removed from the engine, implementations may keep them for reuse
+	virtual void ReleaseActor(PhysicsActor *actor) {
+		delete actor;
+	}
+
 	virtual void Simulate(const float deltaTime) = 0;
 
 	PhysicsEngine(const PhysicsEngineConfiguration &config);
@@ -313,10 +325,15 @@ public:
 	PhysicsParticleSystem *AddParticleSystem(const FluidSimulationProperties &desc, const uint32_t maxParticleCount);
 	void DeleteParticleSystem(PhysicsParticleSystem *particleSystem);
 	virtual bool AddParticles(PhysicsParticleSystem *particleSystem, const PhysicsParticlesStorage &storage) = 0;
+	// Applies all simulation properties to the particle system, the particles are kept
+	virtual void ConfigureParticleSystem(PhysicsParticleSystem *particleSystem, const FluidSimulationProperties &desc) = 0;
 
 	PhysicsRigidBody *AddRigidBody(const PhysicsRigidBody::MotionKind motionKind, const glm::vec3 &pos, const glm::quat &rotation, const PhysicsShape &shape);
 	void DeleteRigidBody(PhysicsRigidBody *body);
 
+	// Pushes actor bounds, fluid grid cells and fluid acceleration into the global debug drawing
+	void DrawDebug() const;
+
 	virtual bool SupportsGPUAcceleration() = 0;
 	virtual bool IsGPUAcceleration() = 0;
 	virtual void SetGPUAcceleration(const bool value) = 0;
@@ -0,0 +1,300 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - RenderGraph.cpp
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#include "RenderGraph.h"
+
+#include <assert.h>
+
+CRenderGraph::CRenderGraph():
+	stats({}),
+	frameBufferId(0),
+	attachedDepthId(0),
+	width(0),
+	height(0),
+	textureCount(0),
+	passCount(0),
+	isCompiled(false) {
+	for(uint32_t i = 0; i < RenderGraphMaxColorAttachments; ++i)
+		attachedColorIds[i] = 0;
+}
+
+CRenderGraph::~CRenderGraph() {
+	for(size_t i = 0; i < physicalTextures.size(); ++i)
+		delete physicalTextures[i].texture;
+	physicalTextures.clear();
+	if(frameBufferId)
+		glDeleteFramebuffers(1, &frameBufferId);
+}
+
+void CRenderGraph::Reset() {
+	textureCount = 0;
+	passCount = 0;
+	isCompiled = false;
+}
+
+void CRenderGraph::SetSize(const int width, const int height) {
+	if(this->width == width && this->height == height)
+		return;
+	this->width = width;
+	this->height = height;
+	for(size_t i = 0; i < physicalTextures.size(); ++i)
+		physicalTextures[i].texture->resize(width, height);
+}
+
+CRenderGraph::TextureNode &CRenderGraph::GetNode(const RenderGraphTextureID id) {
+	assert(id > 0 && id <= textureCount);
+	return textures[id - 1];
+}
+
+RenderGraphTextureID CRenderGraph::CreateTexture(const char *name, const RenderGraphTextureDesc &desc) {
+	assert(!isCompiled);
+	if(textureCount == textures.size())
+		textures.push_back({});
+	TextureNode &node = textures[textureCount++];
+	node.name = name;
+	node.desc = desc;
+	node.imported = nullptr;
+	node.physicalIndex = -1;
+	node.firstPass = -1;
+	node.lastPass = -1;
+	node.isNeeded = false;
+	return(textureCount);
+}
+
+RenderGraphTextureID CRenderGraph::ImportTexture(const char *name, CTexture2D *texture) {
+	assert(texture != nullptr);
+	RenderGraphTextureID result = CreateTexture(name, RenderGraphTextureDesc());
+	GetNode(result).imported = texture;
+	return(result);
+}
+
+RenderGraphPassID CRenderGraph::AddPass(const char *name, RenderGraphPassFunc *func, void *userData, const bool hasSideEffects) {
+	assert(!isCompiled);
+	assert(func != nullptr);
+	if(passCount == passes.size())
+		passes.push_back({});
+	PassNode &pass = passes[passCount++];
+	pass.name = name;
+	pass.func = func;
+	pass.userData = userData;
+	pass.reads.clear();
+	pass.writes.clear();
+	pass.hasSideEffects = hasSideEffects;
+	pass.isCulled = false;
+	return(passCount);
+}
+
+void CRenderGraph::Read(const RenderGraphPassID pass, const RenderGraphTextureID texture) {
+	assert(pass > 0 && pass <= passCount);
+	assert(texture > 0 && texture <= textureCount);
+	passes[pass - 1].reads.push_back(texture);
+}
+
+void CRenderGraph::Write(const RenderGraphPassID pass, const RenderGraphTextureID texture) {
+	assert(pass > 0 && pass <= passCount);
+	assert(texture > 0 && texture <= textureCount);
+	// Imported textures are read-only, passes which draw into the bound framebuffer are flagged with side effects instead
+	assert(GetNode(texture).imported == nullptr);
+	PassNode &node = passes[pass - 1];
+	assert(node.writes.size() < RenderGraphMaxColorAttachments + 1);
+	node.writes.push_back(texture);
+}
+
+int32_t CRenderGraph::AcquirePhysicalTexture(const RenderGraphTextureDesc &desc, const int32_t firstPass, const int32_t lastPass) {
+	// NOTE(final): The filter is not part of the match, because it is just a sampler state which we change on demand
+	for(size_t i = 0; i < physicalTextures.size(); ++i) {
+		PhysicalTexture &physical = physicalTextures[i];
+		CTexture2D *texture = physical.texture;
+		if(physical.busyUntilPass < firstPass &&
+			texture->getInternalFormat() == desc.internalFormat &&
+			texture->getFormat() == desc.format &&
+			texture->getType() == desc.type) {
+			physical.busyUntilPass = lastPass;
+			return((int32_t)i);
+		}
+	}
+
+	PhysicalTexture physical;
+	physical.texture = new CTexture2D(GL_TEXTURE_2D, desc.internalFormat, desc.format, desc.type, width, height, desc.filter, desc.filter);
+	physical.texture->upload(nullptr);
+	physical.busyUntilPass = lastPass;
+	physicalTextures.push_back(physical);
+	++stats.physicalTextureCreateCount;
+	return((int32_t)physicalTextures.size() - 1);
+}
+
+void CRenderGraph::Compile() {
+	assert(!isCompiled);
+
+	stats.passCount = passCount;
+	stats.culledPassCount = 0;
+	stats.transientTextureCount = 0;
+
+	// Walk backwards and keep only passes with side effects or passes which writes a texture a kept pass reads
+	for(int32_t passIndex = (int32_t)passCount - 1; passIndex >= 0; --passIndex) {
+		PassNode &pass = passes[passIndex];
+		bool isNeeded = pass.hasSideEffects;
+		for(size_t i = 0; i < pass.writes.size() && !isNeeded; ++i) {
+			if(GetNode(pass.writes[i]).isNeeded)
+				isNeeded = true;
+		}
+		pass.isCulled = !isNeeded;
+		if(pass.isCulled) {
+			++stats.culledPassCount;
+			continue;
+		}
+		for(size_t i = 0; i < pass.reads.size(); ++i)
+			GetNode(pass.reads[i]).isNeeded = true;
+	}
+
+	// Lifetimes of transient textures in the range of the kept passes
+	for(uint32_t passIndex = 0; passIndex < passCount; ++passIndex) {
+		const PassNode &pass = passes[passIndex];
+		if(pass.isCulled)
+			continue;
+		const std::vector<RenderGraphTextureID> *lists[] = { &pass.writes, &pass.reads };
+		for(int listIndex = 0; listIndex < 2; ++listIndex) {
+			const std::vector<RenderGraphTextureID> &list = *lists[listIndex];
+			for(size_t i = 0; i < list.size(); ++i) {
+				TextureNode &node = GetNode(list[i]);
+				if(node.firstPass == -1)
+					node.firstPass = (int32_t)passIndex;
+				node.lastPass = (int32_t)passIndex;
+			}
+		}
+	}
+
+	// Assign physical textures in order of first use, so a texture can take over a texture which was last used by an earlier pass
+	for(size_t i = 0; i < physicalTextures.size(); ++i)
+		physicalTextures[i].busyUntilPass = -1;
+	for(uint32_t passIndex = 0; passIndex < passCount; ++passIndex) {
+		if(passes[passIndex].isCulled)
+			continue;
+		for(uint32_t textureIndex = 0; textureIndex < textureCount; ++textureIndex) {
+			TextureNode &node = textures[textureIndex];
+			if(node.imported != nullptr || node.firstPass != (int32_t)passIndex)
+				continue;
+			node.physicalIndex = AcquirePhysicalTexture(node.desc, node.firstPass, node.lastPass);
+			++stats.transientTextureCount;
+		}
+	}
+	stats.physicalTextureCount = (uint32_t)physicalTextures.size();
+
+	isCompiled = true;
+}
+
+CTexture2D *CRenderGraph::GetTexture(const RenderGraphTextureID id) {
+	assert(isCompiled);
+	TextureNode &node = GetNode(id);
+	if(node.imported != nullptr)
+		return(node.imported);
+	if(node.physicalIndex == -1)
+		return(nullptr);
+	return(physicalTextures[node.physicalIndex].texture);
+}
+
+bool CRenderGraph::IsPassCulled(const RenderGraphPassID pass) const {
+	assert(isCompiled);
+	assert(pass > 0 && pass <= passCount);
+	return(passes[pass - 1].isCulled);
+}
+
+void CRenderGraph::ApplyFilter(CTexture2D *texture, const GLuint filter) {
+	if(texture->getTexMagFilter() == filter && texture->getTexMinFilter() == filter)
+		return;
+	texture->setTexMagFilter(filter);
+	texture->setTexMinFilter(filter);
+	texture->bind();
+	glTexParameteri(texture->getTarget(), GL_TEXTURE_MAG_FILTER, filter);
+	glTexParameteri(texture->getTarget(), GL_TEXTURE_MIN_FILTER, filter);
+	texture->unbind();
+}
+
+void CRenderGraph::BindPassTargets(const PassNode &pass) {
+	if(!frameBufferId)
+		glGenFramebuffers(1, &frameBufferId);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, frameBufferId);
+
+	GLuint colorIds[RenderGraphMaxColorAttachments] = {};
+	GLuint depthId = 0;
+	GLenum drawBuffers[RenderGraphMaxColorAttachments];
+	int drawBufferCount = 0;
+	for(size_t i = 0; i < pass.writes.size(); ++i) {
+		const TextureNode &node = GetNode(pass.writes[i]);
+		CTexture2D *texture = physicalTextures[node.physicalIndex].texture;
+		if(node.desc.isDepth) {
+			depthId = texture->getID();
+		} else {
+			assert(drawBufferCount < (int)RenderGraphMaxColorAttachments);
+			colorIds[drawBufferCount] = texture->getID();
+			drawBuffers[drawBufferCount] = GL_COLOR_ATTACHMENT0 + drawBufferCount;
+			++drawBufferCount;
+		}
+	}
+
+	// NOTE(final): Only changed attachments are touched, also detaches textures which are sampled by this pass
+	for(uint32_t i = 0; i < RenderGraphMaxColorAttachments; ++i) {
+		if(attachedColorIds[i] != colorIds[i]) {
+			glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, GL_TEXTURE_2D, colorIds[i], 0);
+			attachedColorIds[i] = colorIds[i];
+		}
+	}
+	if(attachedDepthId != depthId) {
+		glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, depthId, 0);
+		attachedDepthId = depthId;
+	}
+
+	if(drawBufferCount > 0)
+		glDrawBuffers(drawBufferCount, drawBuffers);
+	else
+		glDrawBuffer(GL_NONE);
+
+	assert(glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
+}
+
+void CRenderGraph::Execute(CRenderer *renderer) {
+	assert(isCompiled);
+
+	// Save the framebuffer for the passes with side effects
+	GLint savedFrameBuffer = 0;
+	GLint savedDrawBuffer = 0;
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &savedFrameBuffer);
+	glGetIntegerv(GL_DRAW_BUFFER, &savedDrawBuffer);
+	bool isOffscreen = false;
+
+	for(uint32_t passIndex = 0; passIndex < passCount; ++passIndex) {
+		const PassNode &pass = passes[passIndex];
+		if(pass.isCulled)
+			continue;
+
+		for(size_t i = 0; i < pass.reads.size(); ++i) {
+			const TextureNode &node = GetNode(pass.reads[i]);
+			if(node.imported == nullptr)
+				ApplyFilter(physicalTextures[node.physicalIndex].texture, node.desc.filter);
+		}
+
+		if(pass.writes.size() > 0) {
+			BindPassTargets(pass);
+			renderer->SetViewport(0, 0, width, height);
+			renderer->SetScissor(0, 0, width, height);
+			isOffscreen = true;
+		} else if(isOffscreen) {
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, savedFrameBuffer);
+			glDrawBuffer(savedDrawBuffer);
+			isOffscreen = false;
+		}
+
+		pass.func(*this, pass.userData);
+	}
+
+	if(isOffscreen) {
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, savedFrameBuffer);
+		glDrawBuffer(savedDrawBuffer);
+	}
+}
@@ -0,0 +1,137 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - RenderGraph.h
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include <final_dynamic_opengl.h>
+
+#include "Texture2D.h"
+#include "Renderer.h"
+
+constexpr uint32_t RenderGraphMaxColorAttachments = 4;
+
+// Zero is always a invalid id
+typedef uint32_t RenderGraphTextureID;
+typedef uint32_t RenderGraphPassID;
+
+struct RenderGraphTextureDesc {
+	GLint internalFormat;
+	GLenum format;
+	GLenum type;
+	GLuint filter;
+	bool isDepth;
+
+	RenderGraphTextureDesc():
+		internalFormat(GL_RGBA8),
+		format(GL_RGBA),
+		type(GL_UNSIGNED_BYTE),
+		filter(GL_LINEAR),
+		isDepth(false) {
+	}
+
+	RenderGraphTextureDesc(const GLint internalFormat, const GLenum format, const GLenum type, const GLuint filter, const bool isDepth = false):
+		internalFormat(internalFormat),
+		format(format),
+		type(type),
+		filter(filter),
+		isDepth(isDepth) {
+	}
+};
+
+struct RenderGraphStats {
+	uint32_t passCount;
+	uint32_t culledPassCount;
+	uint32_t transientTextureCount;
+	uint32_t physicalTextureCount;
+	uint32_t physicalTextureCreateCount;
+};
+
+class CRenderGraph;
+
+typedef void (RenderGraphPassFunc)(CRenderGraph &graph, void *userData);
+
+// A render graph which is rebuilt every frame:
+// Passes declares which textures they read and write, passes which does not contribute to a pass with side effects are culled.
+// Transient textures are created by the graph and share the same GL texture, when their lifetimes does not overlap.
+class CRenderGraph {
+private:
+	struct TextureNode {
+		const char *name;
+		RenderGraphTextureDesc desc;
+		CTexture2D *imported;
+		int32_t physicalIndex;
+		int32_t firstPass;
+		int32_t lastPass;
+		bool isNeeded;
+	};
+
+	struct PassNode {
+		const char *name;
+		RenderGraphPassFunc *func;
+		void *userData;
+		std::vector<RenderGraphTextureID> reads;
+		std::vector<RenderGraphTextureID> writes;
+		bool hasSideEffects;
+		bool isCulled;
+	};
+
+	struct PhysicalTexture {
+		CTexture2D *texture;
+		int32_t busyUntilPass;
+	};
+
+	// NOTE(final): Nodes are reused across frames, so the read/write lists keep their capacity
+	std::vector<TextureNode> textures;
+	std::vector<PassNode> passes;
+	std::vector<PhysicalTexture> physicalTextures;
+	RenderGraphStats stats;
+	GLuint frameBufferId;
+	GLuint attachedColorIds[RenderGraphMaxColorAttachments];
+	GLuint attachedDepthId;
+	int width;
+	int height;
+	uint32_t textureCount;
+	uint32_t passCount;
+	bool isCompiled;
+
+	TextureNode &GetNode(const RenderGraphTextureID id);
+	int32_t AcquirePhysicalTexture(const RenderGraphTextureDesc &desc, const int32_t firstPass, const int32_t lastPass);
+	void ApplyFilter(CTexture2D *texture, const GLuint filter);
+	void BindPassTargets(const PassNode &pass);
+public:
+	CRenderGraph();
+	~CRenderGraph();
+
+	// Removes all passes and textures from the last frame, but keeps the physical textures alive
+	void Reset();
+	// Size of all transient textures, resizes the physical textures when changed
+	void SetSize(const int width, const int height);
+
+	RenderGraphTextureID CreateTexture(const char *name, const RenderGraphTextureDesc &desc);
+	RenderGraphTextureID ImportTexture(const char *name, CTexture2D *texture);
+
+	// Passes are executed in the order they were added, passes with side effects are never culled and render into the framebuffer which was bound before Execute()
+	RenderGraphPassID AddPass(const char *name, RenderGraphPassFunc *func, void *userData, const bool hasSideEffects = false);
+	void Read(const RenderGraphPassID pass, const RenderGraphTextureID texture);
+	void Write(const RenderGraphPassID pass, const RenderGraphTextureID texture);
+
+	void Compile();
+	void Execute(CRenderer *renderer);
+
+	// Only valid after Compile(), returns nullptr for textures of culled passes
+	CTexture2D *GetTexture(const RenderGraphTextureID id);
+
+	bool IsPassCulled(const RenderGraphPassID pass) const;
+	inline const RenderGraphStats &GetStats() const { return stats; }
+	inline int GetWidth() const { return width; }
+	inline int GetHeight() const { return height; }
+};
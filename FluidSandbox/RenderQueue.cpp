@@ -0,0 +1,102 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - RenderQueue.cpp
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#include "RenderQueue.h"
+
+#include <algorithm>
+
+constexpr uint32_t RenderKeyPassBits = 4;
+constexpr uint32_t RenderKeyShaderBits = 12;
+constexpr uint32_t RenderKeyBlendingBits = 1;
+constexpr uint32_t RenderKeyVBOBits = 16;
+constexpr uint32_t RenderKeyDepthBits = 31;
+static_assert((RenderKeyPassBits + RenderKeyShaderBits + RenderKeyBlendingBits + RenderKeyVBOBits + RenderKeyDepthBits) == 64, "Render key must be exactly 64 bits");
+
+constexpr uint32_t RenderKeyDepthShift = 0;
+constexpr uint32_t RenderKeyVBOShift = RenderKeyDepthShift + RenderKeyDepthBits;
+constexpr uint32_t RenderKeyBlendingShift = RenderKeyVBOShift + RenderKeyVBOBits;
+constexpr uint32_t RenderKeyShaderShift = RenderKeyBlendingShift + RenderKeyBlendingBits;
+constexpr uint32_t RenderKeyPassShift = RenderKeyShaderShift + RenderKeyShaderBits;
+
+#define RENDERKEY_MASK(bits) ((1ULL << (bits)) - 1ULL)
+
+CRenderQueue::CRenderQueue():
+	viewProj(1.0f) {
+}
+
+CRenderQueue::~CRenderQueue() {
+}
+
+uint64_t CRenderQueue::MakeKey(const RenderPass pass, const CGLSL *shader, const bool blending, const CVBO *vbo, const float depth) {
+	uint64_t shaderId = shader != nullptr ? shader->getProgram() : 0;
+	uint64_t vboId = vbo != nullptr ? vbo->vboId : 0;
+
+	// NOTE(final): Transparent packets are sorted back to front, everything else front to back
+	float d = std::min(std::max(depth, 0.0f), 1.0f);
+	if(pass == RenderPass::Transparent) {
+		d = 1.0f - d;
+	}
+	uint64_t depthBits = (uint64_t)(d * (float)RENDERKEY_MASK(RenderKeyDepthBits)) & RENDERKEY_MASK(RenderKeyDepthBits);
+
+	uint64_t result =
+		(((uint64_t)pass & RENDERKEY_MASK(RenderKeyPassBits)) << RenderKeyPassShift) |
+		((shaderId & RENDERKEY_MASK(RenderKeyShaderBits)) << RenderKeyShaderShift) |
+		(((uint64_t)(blending ? 1 : 0)) << RenderKeyBlendingShift) |
+		((vboId & RENDERKEY_MASK(RenderKeyVBOBits)) << RenderKeyVBOShift) |
+		(depthBits << RenderKeyDepthShift);
+	return(result);
+}
+
+void CRenderQueue::Begin(const glm::mat4 &viewProj) {
+	this->viewProj = viewProj;
+	packets.clear();
+	entries.clear();
+}
+
+void CRenderQueue::Push(const RenderPass pass, const RenderPacket &packet, const CVBO *vbo, const float depth) {
+	assert(packet.draw != nullptr);
+	SortEntry entry;
+	entry.key = MakeKey(pass, packet.shader, packet.state.blending, vbo, depth);
+	entry.packetIndex = (uint32_t)packets.size();
+	packets.push_back(packet);
+	entries.push_back(entry);
+}
+
+void CRenderQueue::Submit(CRenderer *renderer) {
+	if(entries.size() == 0) {
+		return;
+	}
+
+	// NOTE(final): Stable sort, so packets with identical keys keep their recording order
+	std::stable_sort(entries.begin(), entries.end(), [](const SortEntry &a, const SortEntry &b) {
+		return a.key < b.key;
+	});
+
+	RenderState lastState = renderer->GetRenderState();
+	for(size_t entryIndex = 0; entryIndex < entries.size(); ++entryIndex) {
+		const RenderPacket &packet = packets[entries[entryIndex].packetIndex];
+		renderer->ApplyRenderState(packet.state);
+		renderer->BindShader(packet.shader);
+		packet.draw(renderer, packet, viewProj);
+	}
+	renderer->UnbindShader();
+	renderer->ApplyRenderState(lastState);
+
+	packets.clear();
+	entries.clear();
+}
+
+float CRenderQueue::ComputeDepth(const glm::vec3 &worldPos) const {
+	glm::vec4 clip = viewProj * glm::vec4(worldPos, 1.0f);
+	if(clip.w <= 0.0f) {
+		return(0.0f);
+	}
+	float result = (clip.z / clip.w) * 0.5f + 0.5f;
+	return(result);
+}
@@ -0,0 +1,69 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - RenderQueue.h
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+#include "Renderer.h"
+#include "GLSL.h"
+#include "VBO.h"
+
+enum class RenderPass: uint8_t {
+	Opaque = 0,
+	Transparent,
+	Overlay,
+};
+
+struct RenderPacket;
+
+// Callback which does the actual drawing for a packet, the shader and render state is already applied when called
+typedef void (RenderPacketDrawFunc)(CRenderer *renderer, const RenderPacket &packet, const glm::mat4 &viewProj);
+
+struct RenderPacket {
+	RenderState state;
+	CGLSL *shader;
+	RenderPacketDrawFunc *draw;
+	void *userData;
+	uint32_t param0;
+	uint32_t param1;
+};
+
+// Records draw packets and submits them sorted by a 64-bit key, to reduce state changes and shader binds
+//
+// Key layout (MSB to LSB):
+//	4 bits pass | 12 bits shader | 1 bit blending | 16 bits vbo | 31 bits depth
+class CRenderQueue {
+private:
+	struct SortEntry {
+		uint64_t key;
+		uint32_t packetIndex;
+	};
+
+	std::vector<RenderPacket> packets;
+	std::vector<SortEntry> entries;
+	glm::mat4 viewProj;
+public:
+	CRenderQueue();
+	~CRenderQueue();
+
+	static uint64_t MakeKey(const RenderPass pass, const CGLSL *shader, const bool blending, const CVBO *vbo, const float depth);
+
+	void Begin(const glm::mat4 &viewProj);
+	void Push(const RenderPass pass, const RenderPacket &packet, const CVBO *vbo, const float depth);
+	void Submit(CRenderer *renderer);
+
+	// Returns the normalized [0, 1] depth of the given world position
+	float ComputeDepth(const glm::vec3 &worldPos) const;
+
+	inline size_t GetPacketCount() const { return packets.size(); }
+};
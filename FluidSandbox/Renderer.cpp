@@ -54,6 +54,12 @@ CRenderer::CRenderer(void) {
 
 	wireframeEnabled = false;
 	glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+
+	// NOTE(final): We run in a legacy context, so instancing is only available when the driver exposes the GL 3.3 entry points
+	instancingSupported = (glDrawElementsInstanced != nullptr) && (glVertexAttribDivisor != nullptr);
+
+	activeShader = nullptr;
+	stats = {};
 }
 
 CRenderer::~CRenderer(void) {
@@ -83,6 +89,7 @@ void CRenderer::SetScissor(const int left, const int top, const int width, const
 void CRenderer::SetDepthTest(const bool enabled) {
 	assert(depthTestEnabled != enabled);
 	depthTestEnabled = enabled;
+	++stats.stateChanges;
 	if(depthTestEnabled)
 		glEnable(GL_DEPTH_TEST);
 	else
@@ -92,6 +99,7 @@ void CRenderer::SetDepthTest(const bool enabled) {
 void CRenderer::SetDepthMask(const bool enabled) {
 	assert(depthMaskEnabled != enabled);
 	depthMaskEnabled = enabled;
+	++stats.stateChanges;
 	if(depthMaskEnabled)
 		glDepthMask(GL_TRUE);
 	else
@@ -101,6 +109,7 @@ void CRenderer::SetDepthMask(const bool enabled) {
 void CRenderer::SetCullFace(const bool enabled) {
 	assert(cullFaceEnabled != enabled);
 	cullFaceEnabled = enabled;
+	++stats.stateChanges;
 	if(cullFaceEnabled)
 		glEnable(GL_CULL_FACE);
 	else
@@ -110,6 +119,7 @@ void CRenderer::SetCullFace(const bool enabled) {
 void CRenderer::SetBlending(const bool enabled) {
 	assert(blendingEnabled != enabled);
 	blendingEnabled = enabled;
+	++stats.stateChanges;
 	if(blendingEnabled)
 		glEnable(GL_BLEND);
 	else
@@ -120,12 +130,14 @@ void CRenderer::SetBlendFunc(const GLenum sfactor, const GLenum dfactor) {
 	assert(blendFunc[0] != sfactor || blendFunc[1] != dfactor);
 	blendFunc[0] = sfactor;
 	blendFunc[1] = dfactor;
+	++stats.stateChanges;
 	glBlendFunc(blendFunc[0], blendFunc[1]);
 }
 
 void CRenderer::SetWireframe(const bool enabled) {
 	assert(wireframeEnabled != enabled);
 	wireframeEnabled = enabled;
+	++stats.stateChanges;
 	if(wireframeEnabled)
 		glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 	else
@@ -159,8 +171,61 @@ void CRenderer::DrawPrimitive(GeometryVBO *vbo, const bool asLines) {
 	vbo->Unbind();
 }
 
+void CRenderer::DrawPrimitiveInstanced(GeometryVBO *vbo, const GLuint instanceCount) {
+	// NOTE(final): Expect that a shader is already bound and the per-instance attributes are already set up
+	assert(instancingSupported);
+
+	// Vertex (vec3, vec3, vec2)
+	vbo->Bind();
+
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_NORMAL_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glVertexPointer(3, GL_FLOAT, sizeof(Primitives::Vertex), (void *)(offsetof(Primitives::Vertex, pos)));
+	glNormalPointer(GL_FLOAT, sizeof(Primitives::Vertex), (void *)(offsetof(Primitives::Vertex, normal)));
+	glTexCoordPointer(2, GL_FLOAT, sizeof(Primitives::Vertex), (void *)(offsetof(Primitives::Vertex, texcoord)));
+	vbo->DrawElementsInstanced(GL_TRIANGLES, vbo->triangleIndexCount, 0, instanceCount);
+	++stats.drawCalls;
+	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+	glDisableClientState(GL_NORMAL_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+
+	vbo->Unbind();
+}
+
+void CRenderer::DrawPrimitiveRanges(GeometryVBO *vbo, const GLsizei *counts, const GLvoid *const *offsets, const GLsizei rangeCount) {
+	// NOTE(final): Expect that a shader is already bound
+
+	// Vertex (vec3, vec3, vec2)
+	vbo->Bind();
+
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_NORMAL_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glVertexPointer(3, GL_FLOAT, sizeof(Primitives::Vertex), (void *)(offsetof(Primitives::Vertex, pos)));
+	glNormalPointer(GL_FLOAT, sizeof(Primitives::Vertex), (void *)(offsetof(Primitives::Vertex, normal)));
+	glTexCoordPointer(2, GL_FLOAT, sizeof(Primitives::Vertex), (void *)(offsetof(Primitives::Vertex, texcoord)));
+	DrawVBORanges(vbo, GL_TRIANGLES, counts, offsets, rangeCount);
+	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+	glDisableClientState(GL_NORMAL_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+
+	vbo->Unbind();
+}
+
 void CRenderer::DrawVBO(CVBO *vbo, const GLenum mode, const GLuint count, const GLsizeiptr offset) {
 	vbo->DrawElements(mode, count, offset);
+	++stats.drawCalls;
+}
+
+void CRenderer::DrawVBORanges(CVBO *vbo, const GLenum mode, const GLsizei *counts, const GLvoid *const *offsets, const GLsizei rangeCount) {
+	vbo->MultiDrawElements(mode, counts, offsets, rangeCount);
+	++stats.drawCalls;
+}
+
+void CRenderer::DrawVBOArrays(CVBO *vbo, const GLenum mode, const GLint first, const GLsizei count) {
+	vbo->DrawArrays(mode, first, count);
+	++stats.drawCalls;
 }
 
 glm::vec2 CRenderer::GetStringSize(const FontAtlas *atlas, const char *text, const size_t textLen, const float charHeight, int &glyphCount) {
@@ -314,3 +379,34 @@ void CRenderer::DisableTexture(const int index, CTexture *texture) {
 	textureStates[index].active = false;
 	textureStates[index].texture = nullptr;
 }
+
+RenderState CRenderer::GetRenderState() const {
+	RenderState result = RenderState(blendingEnabled, depthTestEnabled, wireframeEnabled);
+	return(result);
+}
+
+void CRenderer::ApplyRenderState(const RenderState &state) {
+	// NOTE(final): Only touch the states which are actually different, the setters asserts on redundant changes
+	if(blendingEnabled != state.blending)
+		SetBlending(state.blending);
+	if(depthTestEnabled != state.depthTest)
+		SetDepthTest(state.depthTest);
+	if(wireframeEnabled != state.wireframe)
+		SetWireframe(state.wireframe);
+}
+
+void CRenderer::BindShader(CGLSL *shader) {
+	assert(shader != nullptr);
+	if(activeShader != shader) {
+		shader->enable();
+		activeShader = shader;
+		++stats.shaderBinds;
+	}
+}
+
+void CRenderer::UnbindShader() {
+	if(activeShader != nullptr) {
+		activeShader->disable();
+		activeShader = nullptr;
+	}
+}
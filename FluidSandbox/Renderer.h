@@ -21,6 +21,7 @@
 #include "Texture.h"
 #include "TextureFont.h"
 #include "GeometryVBO.h"
+#include "GLSL.h"
 
 struct FontVertex {
 	glm::vec4 color;
@@ -84,6 +85,32 @@ inline ClearFlags &operator ^= (ClearFlags &a, ClearFlags b) {
 	return a = a ^ b;
 }
 
+// Render states which are filtered by the renderer, to skip redundant changes
+struct RenderState {
+	bool blending;
+	bool depthTest;
+	bool wireframe;
+
+	RenderState():
+		blending(false),
+		depthTest(true),
+		wireframe(false) {
+	}
+
+	RenderState(const bool blending, const bool depthTest, const bool wireframe):
+		blending(blending),
+		depthTest(depthTest),
+		wireframe(wireframe) {
+	}
+};
+
+// Per frame counters
+struct RenderStats {
+	uint32_t drawCalls;
+	uint32_t stateChanges;
+	uint32_t shaderBinds;
+};
+
 const short MAX_TEXTURES = 16;
 struct TextureState {
 	bool active;
@@ -97,8 +124,11 @@ private:
 	bool cullFaceEnabled;
 	bool blendingEnabled;
 	bool wireframeEnabled;
+	bool instancingSupported;
 	GLenum blendFunc[2];
 	TextureState textureStates[MAX_TEXTURES];
+	CGLSL *activeShader;
+	RenderStats stats;
 public:
 	CRenderer(void);
 	~CRenderer(void);
@@ -117,14 +147,35 @@ public:
 	void EnableTexture(const int index, CTexture *texture);
 	void DisableTexture(const int index, CTexture *texture);
 
+	RenderState GetRenderState() const;
+	void ApplyRenderState(const RenderState &state);
+	void BindShader(CGLSL *shader);
+	void UnbindShader();
+
 	void DrawPrimitive(GeometryVBO *vbo, const bool asLines);
+	void DrawPrimitiveInstanced(GeometryVBO *vbo, const GLuint instanceCount);
+	void DrawPrimitiveRanges(GeometryVBO *vbo, const GLsizei *counts, const GLvoid *const *offsets, const GLsizei rangeCount);
 	void DrawVBO(CVBO *vbo, const GLenum mode, const GLuint count, const GLsizeiptr offset);
+	void DrawVBORanges(CVBO *vbo, const GLenum mode, const GLsizei *counts, const GLvoid *const *offsets, const GLsizei rangeCount);
+	void DrawVBOArrays(CVBO *vbo, const GLenum mode, const GLint first, const GLsizei count);
 	glm::vec2 GetStringSize(const FontAtlas *atlas, const char *text, const size_t textLen, const float charHeight, int &glyphCount);
 	void DrawString(const FontAtlas *atlas, const float posX, const float posY, const float charHeight, const char *text, const size_t textLen, const glm::vec4 &color, VBOWritter &writer);
 	void DrawString(const FontAtlas *atlas, const float posX, const float posY, const float charHeight, const char *text, const glm::vec4 &color, VBOWritter &writer);
 
 	void Flip();
 
+	inline const RenderStats &GetStats() const {
+		return(stats);
+	}
+
+	inline void ResetStats() {
+		stats = {};
+	}
+
+	inline bool IsInstancingSupported() const {
+		return(instancingSupported);
+	}
+
 	inline const char *CheckError() {
 		GLenum err = glGetError();
 		const char *result = glErrorToString(err);
@@ -1,8 +1,9 @@
 #include "Renderer2.h"
 
-#include <map>
-#include <queue>
 #include <stdexcept>
+#include <deque>
+#include <algorithm>
+#include <cstring>
 #include <assert.h>
 
 #include <final_dynamic_opengl.h>
@@ -16,13 +17,15 @@ namespace fsr {
 		GLenum nativeTarget;
 		GLenum nativeUsage;
 		GLenum nativeAccess;
+		void *persistentData;
 
 		OpenGLBuffer(const BufferID id, const BufferType type, const BufferAccess access, const BufferUsage usage, const size_t size):
 			Buffer(id, type, access, usage, size),
 			nativeId(0),
 			nativeTarget(0),
 			nativeUsage(0),
-			nativeAccess(0) {
+			nativeAccess(0),
+			persistentData(nullptr) {
 		}
 
 		void Write(const size_t offset, const size_t size, const uint8_t *data) override {
@@ -113,10 +116,40 @@ namespace fsr {
 			return(true);
 		}
 
+		// Immutable storage which stays mapped for its entire lifetime, CPU writes are visible to the following GPU commands without any flush (GL 4.4)
+		bool InitPersistent() {
+			assert(type == BufferType::Uniform);
+			nativeTarget = GL_UNIFORM_BUFFER;
+			nativeAccess = GL_WRITE_ONLY;
+			nativeUsage = GL_DYNAMIC_DRAW;
+
+			glGenBuffers(1, &nativeId);
+			if(nativeId == 0) {
+				return(false);
+			}
+
+			GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			glBindBuffer(nativeTarget, nativeId);
+			glBufferStorage(nativeTarget, size, nullptr, flags);
+			persistentData = glMapBufferRange(nativeTarget, 0, size, flags);
+			glBindBuffer(nativeTarget, 0);
+			if(persistentData == nullptr) {
+				Release();
+				return(false);
+			}
+			return(true);
+		}
 
 		void Release() override {
+			if(persistentData != nullptr) {
+				glBindBuffer(nativeTarget, nativeId);
+				glUnmapBuffer(nativeTarget);
+				glBindBuffer(nativeTarget, 0);
+				persistentData = nullptr;
+			}
 			if(nativeId > 0) {
 				glDeleteBuffers(1, &nativeId);
+				nativeId = 0;
 			}
 		}
 
@@ -130,22 +163,29 @@ namespace fsr {
 		GLenum nativeType;
 		GLint nativeInternalFormat;
 		uint32_t bytesPerPixel;
+		uint32_t faceCount;
 	public:
-		OpenGLTexture(const TextureID id, const TextureType type, const TextureFormat format, const uint32_t width, const uint32_t height, const uint8_t *data):
+		OpenGLTexture(const TextureID id, const TextureType type, const TextureFormat format, const uint32_t width, const uint32_t height):
 			Texture(id, type, format, width, height),
 			nativeId(0),
 			nativeTarget(0),
 			nativeFormat(0),
 			nativeType(0),
 			nativeInternalFormat(0),
-			bytesPerPixel(0) {
+			bytesPerPixel(0),
+			faceCount(0) {
 
 			switch(type) {
 				case TextureType::T2D:
 					nativeTarget = GL_TEXTURE_2D;
+					faceCount = 1;
 					break;
 				case TextureType::Cube:
 					nativeTarget = GL_TEXTURE_CUBE_MAP;
+					faceCount = 6;
+					break;
+				default:
+					assert(!"Unsupported texture type!");
 					break;
 			}
 
@@ -153,18 +193,21 @@ namespace fsr {
 				case TextureFormat::AlphaU8:
 					nativeInternalFormat = GL_ALPHA8;
 					nativeFormat = GL_ALPHA;
-					bytesPerPixel = 8;
+					nativeType = GL_UNSIGNED_BYTE;
+					bytesPerPixel = sizeof(uint8_t);
 					break;
 
 				case TextureFormat::RGBAU8:
 					nativeInternalFormat = GL_RGBA8;
 					nativeFormat = GL_RGBA;
+					nativeType = GL_UNSIGNED_BYTE;
 					bytesPerPixel = sizeof(uint8_t) * 4;
 					break;
 
 				case TextureFormat::RGBAF32:
 					nativeInternalFormat = GL_RGB32F;
 					nativeFormat = GL_RGBA;
+					nativeType = GL_FLOAT;
 					bytesPerPixel = sizeof(float) * 4;
 					break;
 
@@ -173,31 +216,11 @@ namespace fsr {
 					break;
 			}
 
+			// NOTE(final): Only the storage is allocated here, the pixels are uploaded by the renderer, either directly or through the staging ring
 			glGenTextures(1, &nativeId);
 			glBindTexture(nativeTarget, nativeId);
-			switch(type) {
-				case TextureType::T2D:
-				{
-					glTexImage2D(nativeTarget, 0, nativeInternalFormat, width, height, 0, nativeFormat, nativeType, static_cast<const void *>(data));
-				} break;
-
-				case TextureType::Cube:
-				{
-					size_t faceSize = (size_t)width * (size_t)height * (size_t)bytesPerPixel;
-					for(uint32_t faceIndex = 0; faceIndex < 6; ++faceIndex) {
-						const uint8_t *facePixels;
-						if(data != nullptr)
-							facePixels = data + (faceSize * faceIndex);
-						else
-							facePixels = nullptr;
-						GLuint texTarget = GL_TEXTURE_CUBE_MAP_POSITIVE_X + faceIndex;
-						glTexImage2D(texTarget, 0, nativeInternalFormat, width, height, 0, nativeFormat, nativeType, static_cast<const void *>(facePixels));
-					}
-				} break;
-
-				default:
-					assert(!"Unsupported texture type!");
-					break;
+			for(uint32_t faceIndex = 0; faceIndex < faceCount; ++faceIndex) {
+				glTexImage2D(GetFaceTarget(faceIndex), 0, nativeInternalFormat, width, height, 0, nativeFormat, nativeType, nullptr);
 			}
 			glBindTexture(nativeTarget, 0);
 		}
@@ -208,37 +231,35 @@ namespace fsr {
 			}
 		}
 
+		inline GLenum GetFaceTarget(const uint32_t faceIndex) const {
+			GLenum result = type == TextureType::Cube ? (GL_TEXTURE_CUBE_MAP_POSITIVE_X + faceIndex) : nativeTarget;
+			return(result);
+		}
+
+		inline size_t GetFaceSize() const {
+			return((size_t)width * (size_t)height * (size_t)bytesPerPixel);
+		}
+
+		inline uint32_t GetFaceCount() const {
+			return(faceCount);
+		}
+
+		// Uploads one face, the pixels are a offset into the bound unpack buffer when one is bound
+		void WriteFace(const uint32_t faceIndex, const void *pixels) {
+			assert(faceIndex < faceCount);
+			glBindTexture(nativeTarget, nativeId);
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+			glTexSubImage2D(GetFaceTarget(faceIndex), 0, 0, 0, width, height, nativeFormat, nativeType, pixels);
+			glBindTexture(nativeTarget, 0);
+		}
+
 		bool Write(const size_t size, const uint8_t *data) override {
-			size_t requiredSize = (size_t)(width * height * bytesPerPixel);
-			if(size != requiredSize || data == nullptr) {
+			if(size != GetFaceSize() * faceCount || data == nullptr) {
 				return(false);
 			}
-			glBindTexture(nativeTarget, nativeId);
-			switch(type) {
-				case TextureType::T2D:
-				{
-					glTexImage2D(nativeTarget, 0, nativeInternalFormat, width, height, 0, nativeFormat, nativeType, static_cast<const void *>(data));
-				} break;
-
-				case TextureType::Cube:
-				{
-					size_t faceSize = (size_t)width * (size_t)height * (size_t)bytesPerPixel;
-					for(uint32_t faceIndex = 0; faceIndex < 6; ++faceIndex) {
-						const uint8_t *facePixels;
-						if(data != nullptr)
-							facePixels = data + (faceSize * faceIndex);
-						else
-							facePixels = nullptr;
-						GLuint texTarget = GL_TEXTURE_CUBE_MAP_POSITIVE_X + faceIndex;
-						glTexImage2D(texTarget, 0, nativeInternalFormat, width, height, 0, nativeFormat, nativeType, static_cast<const void *>(facePixels));
-					}
-				} break;
-
-				default:
-					assert(!"Unsupported texture type!");
-					break;
+			for(uint32_t faceIndex = 0; faceIndex < faceCount; ++faceIndex) {
+				WriteFace(faceIndex, data + GetFaceSize() * faceIndex);
 			}
-			glBindTexture(nativeTarget, 0);
 			return(true);
 		}
 	};
@@ -252,6 +273,10 @@ namespace fsr {
 			nativeId(0) {
 		}
 
+		inline GLuint GetNativeId() const {
+			return(nativeId);
+		}
+
 		bool Init(const std::initializer_list<FrameBufferAttachment> &attachments) override {
 			if(attachments.size() == 0) return(false); // No attachment
 			glGenFramebuffers(1, &nativeId);
@@ -274,6 +299,7 @@ namespace fsr {
 		SetScissor,
 		BindVertexBuffers,
 		BindIndexBuffers,
+		BindUniformBuffer,
 		BeginRenderPass,
 		EndRenderPass,
 		Draw,
@@ -306,6 +332,14 @@ namespace fsr {
 		// The data are a array of BufferIDs
 	};
 
+	// NOTE(final): Has no padding, because its also used as cached state
+	struct BindUniformBufferCommand {
+		BufferID bufferId;
+		uint32_t binding;
+		size_t offset;
+		size_t size;
+	};
+
 	struct BeginRenderPassCommand {
 		constexpr static uint32_t MaxClearValueCount = 8;
 		RenderArea renderArea;
@@ -315,6 +349,11 @@ namespace fsr {
 		uint32_t clearValueCount;
 	};
 
+	struct EndRenderPassCommand {
+		// NOTE(final): Commands without data are never executed, so we need at least one field
+		uint32_t reserved;
+	};
+
 	struct DrawCommand {
 		size_t vertexCount;
 		size_t firstVertex;
@@ -325,6 +364,7 @@ namespace fsr {
 	struct CommandBufferChunk {
 		constexpr static size_t Alignment = 16;
 		constexpr static size_t MinChunkSize = 4096;
+		constexpr static size_t MaxGrowChunkSize = 4 * 1024 * 1024;
 		uint8_t *data;
 		size_t capacity;
 		size_t offset;
@@ -341,14 +381,20 @@ namespace fsr {
 			used = 0;
 		}
 
+		// Every command starts at an aligned offset, so the header and the command data can be read directly
+		inline static size_t GetCommandStride(const size_t commandSize) {
+			size_t result = sizeof(CommandHeader) + ((commandSize + Alignment - 1) & ~(Alignment - 1));
+			return(result);
+		}
+
 		bool DoesFit(const size_t size) {
-			size_t requiredSize = sizeof(CommandHeader) + size;
+			size_t requiredSize = GetCommandStride(size);
 			bool result = (used + requiredSize) <= capacity;
 			return(result);
 		}
 
 		CommandHeader *PushHeader(const CommandType type, const size_t commandSize) {
-			size_t requiredSize = sizeof(CommandHeader) + commandSize;
+			size_t requiredSize = GetCommandStride(commandSize);
 			assert(requiredSize > 0 && (offset + requiredSize) <= capacity);
 			size_t start = offset;
 			uint8_t *target = data + start;
@@ -373,11 +419,95 @@ namespace fsr {
 			PushData(header, 0, commandSize, commandData);
 		}
 
+		void Reset() {
+			offset = 0;
+			used = 0;
+		}
+
 		~CommandBufferChunk() {
 			delete[] data;
 		}
 	};
 
+	// Linear memory arena for the recorded commands of one frame.
+	// Chunks are not freed on reset, they are recycled in the next frame - so steady-state recording does zero heap allocations.
+	class CommandArena {
+	private:
+		std::vector<CommandBufferChunk *> chunks;
+		size_t activeChunkIndex;
+		size_t allocationCount;
+
+		CommandBufferChunk *AllocateChunk(const size_t commandSize) {
+			size_t lastCapacity = chunks.empty() ? 0 : chunks.back()->capacity;
+			size_t capacity = std::max(std::min(lastCapacity * 2, CommandBufferChunk::MaxGrowChunkSize), CommandBufferChunk::GetCommandStride(commandSize));
+			CommandBufferChunk *result = new CommandBufferChunk(capacity);
+			++allocationCount;
+			return(result);
+		}
+	public:
+		CommandArena():
+			activeChunkIndex(0),
+			allocationCount(0) {
+		}
+
+		~CommandArena() {
+			for(CommandBufferChunk *chunk : chunks) {
+				delete chunk;
+			}
+		}
+
+		void Reset() {
+			for(CommandBufferChunk *chunk : chunks) {
+				chunk->Reset();
+			}
+			activeChunkIndex = 0;
+		}
+
+		CommandBufferChunk *Reserve(const size_t commandSize) {
+			// Use the active chunk or the next recycled chunk
+			while(activeChunkIndex < chunks.size()) {
+				CommandBufferChunk *chunk = chunks[activeChunkIndex];
+				if(chunk->DoesFit(commandSize)) {
+					return(chunk);
+				}
+				if(chunk->used == 0) {
+					// Recycled chunk is too small for this command, replace it with a bigger one
+					delete chunk;
+					chunk = chunks[activeChunkIndex] = AllocateChunk(commandSize);
+					return(chunk);
+				}
+				++activeChunkIndex;
+			}
+
+			// All chunks are full, grow
+			CommandBufferChunk *result = AllocateChunk(commandSize);
+			chunks.push_back(result);
+			activeChunkIndex = chunks.size() - 1;
+			return(result);
+		}
+
+		inline size_t GetUsedChunkCount() const {
+			size_t result = chunks.empty() ? 0 : std::min(activeChunkIndex + 1, chunks.size());
+			return(result);
+		}
+
+		inline const CommandBufferChunk *GetChunk(const size_t index) const {
+			assert(index < chunks.size());
+			return(chunks[index]);
+		}
+
+		CommandBufferMemoryStats GetStats() const {
+			CommandBufferMemoryStats result = {};
+			result.chunkCount = chunks.size();
+			result.allocationCount = allocationCount;
+			for(const CommandBufferChunk *chunk : chunks) {
+				result.reservedBytes += chunk->capacity;
+				result.usedBytes += chunk->used;
+			}
+			return(result);
+		}
+	};
+
 	class DefaultCommandBuffer: public CommandBuffer {
 	private:
 		enum class CommandBufferRecordingState: int32_t {
@@ -388,18 +518,11 @@ namespace fsr {
 
 		Renderer *renderer;
 		CommandBufferRecordingState state;
-		std::queue<CommandBufferChunk *> chunks;
+		CommandArena arena;
 
 		void Clear() {
-			// In case the command buffer was never submitted, just wipe it
-			while(!chunks.empty()) {
-				CommandBufferChunk *chunk = chunks.front();
-
-				// TODO(final): Memory arena (No delete required)
-				delete chunk;
-
-				chunks.pop();
-			}
+			// In case the command buffer was never submitted, just rewind it
+			arena.Reset();
 		}
 	protected:
 		void Push(const CommandType type, const size_t size, const uint8_t *data, const size_t additionalDataSize = 0, const uint8_t *additionalData = nullptr) {
@@ -410,20 +533,7 @@ namespace fsr {
 				requiredSize += additionalDataSize;
 			}
 
-			if(chunks.empty()) {
-				// TODO(final): Memory arena (Push)
-				CommandBufferChunk *newChunk = new CommandBufferChunk(requiredSize);
-				chunks.push(newChunk);
-			}
-
-			CommandBufferChunk *chunk = chunks.back();
-			assert(chunk != nullptr);
-			if(!chunk->DoesFit(requiredSize)) {
-				// TODO(final): Memory arena (Push)
-				CommandBufferChunk *newChunk = chunk = new CommandBufferChunk(requiredSize);
-				chunks.push(newChunk);
-			}
-
+			CommandBufferChunk *chunk = arena.Reserve(requiredSize);
 			assert(chunk != nullptr);
 
 			if(additionalDataSize > 0 && additionalData != fpl_null) {
@@ -435,16 +545,27 @@ namespace fsr {
 			}
 		}
 	public:
-		CommandBufferChunk *Pop() {
-			if(state != CommandBufferRecordingState::WaitingForSubmit) return(nullptr);
-			if(chunks.empty()) return(nullptr);
-			CommandBufferChunk *chunk = chunks.front();
-			chunks.pop();
-			if(chunks.empty()) {
-				// We have cleared the chunks queue, we can now accept new stuff
-				state = CommandBufferRecordingState::Ready;
-			}
-			return(chunk);
+		inline Renderer *GetRenderer() const {
+			return(renderer);
+		}
+
+		inline bool IsWaitingForSubmit() const {
+			return(state == CommandBufferRecordingState::WaitingForSubmit);
+		}
+
+		inline size_t GetChunkCount() const {
+			return(arena.GetUsedChunkCount());
+		}
+
+		inline const CommandBufferChunk *GetChunk(const size_t index) const {
+			return(arena.GetChunk(index));
+		}
+
+		void FinishSubmit() {
+			assert(state == CommandBufferRecordingState::WaitingForSubmit);
+			// Chunks are recycled for the next recording, we can now accept new stuff
+			arena.Reset();
+			state = CommandBufferRecordingState::Ready;
 		}
 
 		DefaultCommandBuffer(Renderer *renderer):
@@ -464,6 +585,15 @@ namespace fsr {
 			state = CommandBufferRecordingState::WaitingForSubmit;
 		}
 
+		void Reset() override {
+			arena.Reset();
+			state = CommandBufferRecordingState::Ready;
+		}
+
+		CommandBufferMemoryStats GetMemoryStats() const override {
+			return(arena.GetStats());
+		}
+
 		void SetViewport(const float x, const float y, const float width, const float height, const float minDepth, const float maxDepth) override {
 			if(state != CommandBufferRecordingState::Recording) return;
 			SetViewportCommand cmd = {};
@@ -475,7 +605,7 @@ namespace fsr {
 			if(state != CommandBufferRecordingState::Recording) return;
 			SetScissorCommand cmd = {};
 			cmd.scissorRect = ScissorRect(x, y, width, height);
-			Push(CommandType::SetViewport, sizeof(cmd), (const uint8_t *)&cmd);
+			Push(CommandType::SetScissor, sizeof(cmd), (const uint8_t *)&cmd);
 		}
 
 		void BindPipeline(const PipelineID &pipelineId) override {
@@ -505,12 +635,46 @@ namespace fsr {
 			Push(CommandType::BindIndexBuffers, sizeof(cmd), (const uint8_t *)&cmd, dataSize, data);
 		}
 
-		void BeginRenderPass(const RenderPassID &renderPassId, const FrameBufferID &frameBufferId, const RenderArea *renderArea, const std::initializer_list<const ClearValue> &clearValues) {
+		void BindUniformBuffer(const uint32_t binding, const BufferID &bufferId, const size_t offset, const size_t size) override {
+			if(state != CommandBufferRecordingState::Recording) return;
+			assert(binding < MaxUniformBufferBindings);
+			BindUniformBufferCommand cmd = {};
+			cmd.bufferId = bufferId;
+			cmd.binding = binding;
+			cmd.offset = offset;
+			cmd.size = size;
+			Push(CommandType::BindUniformBuffer, sizeof(cmd), (const uint8_t *)&cmd);
+		}
+
+		bool PushUniforms(const uint32_t binding, const void *data, const size_t size) override {
+			if(state != CommandBufferRecordingState::Recording || data == nullptr || size == 0) return(false);
+			UniformAllocation allocation = renderer->AllocateUniforms(size);
+			if(allocation.data == nullptr) return(false);
+			std::memcpy(allocation.data, data, size);
+			BindUniformBuffer(binding, allocation.bufferId, allocation.offset, allocation.size);
+			return(true);
+		}
+
+		void BeginRenderPass(const RenderPassID &renderPassId, const FrameBufferID &frameBufferId, const RenderArea *renderArea, const std::initializer_list<const ClearValue> &clearValues) override {
 			if(state != CommandBufferRecordingState::Recording) return;
+			BeginRenderPassCommand cmd = {};
+			cmd.renderPassId = renderPassId;
+			cmd.renderTargetId = frameBufferId;
+			if(renderArea != nullptr) {
+				cmd.renderArea = *renderArea;
+			}
+			assert(clearValues.size() <= BeginRenderPassCommand::MaxClearValueCount);
+			for(const ClearValue &clearValue : clearValues) {
+				if(cmd.clearValueCount == BeginRenderPassCommand::MaxClearValueCount) break;
+				cmd.clearValues[cmd.clearValueCount++] = clearValue;
+			}
+			Push(CommandType::BeginRenderPass, sizeof(cmd), (const uint8_t *)&cmd);
 		}
 
-		void EndRenderPass() {
+		void EndRenderPass() override {
 			if(state != CommandBufferRecordingState::Recording) return;
+			EndRenderPassCommand cmd = {};
+			Push(CommandType::EndRenderPass, sizeof(cmd), (const uint8_t *)&cmd);
 		}
 
 		void Draw(const size_t vertexCount, const size_t firstVertex, const size_t instanceCount, const size_t firstInstance) override {
@@ -524,18 +688,381 @@ namespace fsr {
 		}
 	};
 
+	// Dense slot array addressed by generational handles.
+	// The lower bits of a handle are the slot index, the upper bits the generation of the slot.
+	// A lookup is a single indexed load, handles of released slots are rejected by comparing the generation.
+	template<typename TID, typename T>
+	class HandleTable {
+	public:
+		constexpr static uint32_t IndexBits = 20;
+		constexpr static uint32_t IndexMask = (1U << IndexBits) - 1U;
+		constexpr static uint32_t GenerationMask = (1U << (32 - IndexBits)) - 1U;
+	private:
+		struct Slot {
+			T *item;
+			uint32_t generation;
+			bool isUsed;
+		};
+
+		std::vector<Slot> slots;
+		std::vector<uint32_t> freeIndices;
+		size_t count;
+
+		inline static uint32_t GetIndex(const TID id) {
+			return(id.id & IndexMask);
+		}
+		inline static uint32_t GetGeneration(const TID id) {
+			return(id.id >> IndexBits);
+		}
+
+		inline const Slot *FindSlot(const TID id) const {
+			uint32_t index = GetIndex(id);
+			if(id.id == 0 || index >= slots.size()) return(nullptr);
+			const Slot *slot = &slots[index];
+			if(!slot->isUsed || slot->generation != GetGeneration(id)) return(nullptr);
+			return(slot);
+		}
+	public:
+		HandleTable():
+			count(0) {
+		}
+
+		// Reserves a slot and returns its handle, the item is set later by Set()
+		TID Allocate() {
+			uint32_t index;
+			if(!freeIndices.empty()) {
+				index = freeIndices.back();
+				freeIndices.pop_back();
+			} else {
+				index = (uint32_t)slots.size();
+				assert(index <= IndexMask);
+				Slot newSlot = {};
+				// NOTE(final): Generation starts at one, so a valid handle is never zero
+				newSlot.generation = 1;
+				slots.push_back(newSlot);
+			}
+			Slot &slot = slots[index];
+			slot.item = nullptr;
+			slot.isUsed = true;
+			++count;
+			TID result = TID { (slot.generation << IndexBits) | index };
+			return(result);
+		}
+
+		void Set(const TID id, T *item) {
+			Slot *slot = const_cast<Slot *>(FindSlot(id));
+			assert(slot != nullptr);
+			if(slot != nullptr) {
+				slot->item = item;
+			}
+		}
+
+		// Returns null for invalid or stale handles
+		inline T *Get(const TID id) const {
+			const Slot *slot = FindSlot(id);
+			T *result = slot != nullptr ? slot->item : nullptr;
+			return(result);
+		}
+
+		// Releases the slot and returns its item, the handle and all copies of it are stale afterwards
+		T *Remove(const TID id) {
+			Slot *slot = const_cast<Slot *>(FindSlot(id));
+			if(slot == nullptr) return(nullptr);
+			T *result = slot->item;
+			slot->item = nullptr;
+			slot->isUsed = false;
+			slot->generation = (slot->generation + 1) & GenerationMask;
+			if(slot->generation == 0) {
+				slot->generation = 1;
+			}
+			freeIndices.push_back(GetIndex(id));
+			--count;
+			return(result);
+		}
+
+		template<typename TFunc>
+		void ForEach(TFunc func) {
+			for(Slot &slot : slots) {
+				if(slot.isUsed && slot.item != nullptr) {
+					func(slot.item);
+				}
+			}
+		}
+
+		void Clear() {
+			slots.clear();
+			freeIndices.clear();
+			count = 0;
+		}
+
+		inline size_t GetCount() const {
+			return(count);
+		}
+	};
+
+	// Streaming memory for per-draw constants.
+	// The ring buffer is split into one region per frame in flight, allocations are bump allocated from the region of the current frame.
+	// The backend must ensure that the GPU has finished reading a region, before the ring wraps around to it.
+	class UniformRing {
+	private:
+		uint8_t *memory;
+		size_t frameSize;
+		size_t alignment;
+		volatile size_t head;
+		size_t flushedHead;
+		uint32_t frameIndex;
+		BufferID bufferId;
+	public:
+		UniformRing():
+			memory(nullptr),
+			frameSize(0),
+			alignment(1),
+			head(0),
+			flushedHead(0),
+			frameIndex(0),
+			bufferId(BufferID {}) {
+		}
+
+		void Init(const BufferID bufferId, uint8_t *memory, const size_t frameSize, const size_t alignment) {
+			assert(memory != nullptr && frameSize > 0);
+			assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+			this->bufferId = bufferId;
+			this->memory = memory;
+			this->frameSize = frameSize;
+			this->alignment = alignment;
+			head = 0;
+			flushedHead = 0;
+			frameIndex = 0;
+		}
+
+		UniformAllocation Allocate(const size_t size) {
+			UniformAllocation result = {};
+			if(memory == nullptr || size == 0) return(result);
+			// NOTE(final): The head always stays aligned, so a single atomic add is enough to allocate from multiple threads
+			size_t alignedSize = (size + alignment - 1) & ~(alignment - 1);
+			size_t offset = fplAtomicFetchAndAddSize(&head, alignedSize);
+			if(offset + alignedSize > frameSize) {
+				return(result);
+			}
+			result.bufferId = bufferId;
+			result.offset = GetFrameOffset() + offset;
+			result.size = size;
+			result.data = memory + result.offset;
+			return(result);
+		}
+
+		// Returns the range which was allocated since the last call, for backends which must upload the memory explicitly
+		bool TakeUnflushedRange(size_t *outOffset, size_t *outSize) {
+			size_t usedBytes = GetUsedBytes();
+			if(usedBytes <= flushedHead) return(false);
+			*outOffset = GetFrameOffset() + flushedHead;
+			*outSize = usedBytes - flushedHead;
+			flushedHead = usedBytes;
+			return(true);
+		}
+
+		void NextFrame() {
+			frameIndex = (frameIndex + 1) % MaxFramesInFlight;
+			head = 0;
+			flushedHead = 0;
+		}
+
+		inline size_t GetUsedBytes() const {
+			return(std::min((size_t)head, frameSize));
+		}
+		inline size_t GetFrameOffset() const {
+			return(frameIndex * frameSize);
+		}
+		inline uint32_t GetFrameIndex() const {
+			return(frameIndex);
+		}
+		inline size_t GetAlignment() const {
+			return(alignment);
+		}
+		inline BufferID GetBufferId() const {
+			return(bufferId);
+		}
+		inline const uint8_t *GetMemory() const {
+			return(memory);
+		}
+	};
+
+	struct RecordCommandBuffersJob {
+		CommandBuffer *const *commandBuffers;
+		RecordCommandBufferFunc *recordFunc;
+		void *userData;
+		size_t count;
+		volatile uint32_t nextIndex;
+	};
+
+	static void RunRecordCommandBuffersJob(RecordCommandBuffersJob *job) {
+		for(;;) {
+			uint32_t index = fplAtomicFetchAndAddU32(&job->nextIndex, 1);
+			if(index >= job->count) break;
+			CommandBuffer *commandBuffer = job->commandBuffers[index];
+			assert(commandBuffer != nullptr);
+			if(commandBuffer->Begin()) {
+				job->recordFunc(*commandBuffer, index, job->userData);
+				commandBuffer->End();
+			}
+		}
+	}
+
+	// Worker threads for recording command buffers, started once and woken up for each job
+	class CommandRecordPool {
+	public:
+		// Including the calling thread
+		constexpr static size_t MaxThreadCount = 64;
+	private:
+		struct Worker {
+			CommandRecordPool *pool;
+			fplThreadHandle *thread;
+			size_t index;
+		};
+
+		Worker workers[MaxThreadCount - 1];
+		size_t workerCount;
+		fplMutexHandle mutex;
+		fplConditionVariable workCondition;
+		fplConditionVariable doneCondition;
+		RecordCommandBuffersJob *job;
+		// Incremented for every job, so each worker takes a job only once
+		uint64_t jobGeneration;
+		// Workers with a smaller index take part in the current job
+		size_t jobWorkerCount;
+		size_t busyWorkerCount;
+		bool isInitialized;
+		bool isShutdown;
+
+		static void WorkerThreadProc(const fplThreadHandle *thread, void *data) {
+			Worker *worker = (Worker *)data;
+			CommandRecordPool *pool = worker->pool;
+			uint64_t seenGeneration = 0;
+			fplMutexLock(&pool->mutex);
+			for(;;) {
+				while(!pool->isShutdown && pool->jobGeneration == seenGeneration)
+					fplConditionWait(&pool->workCondition, &pool->mutex, FPL_TIMEOUT_INFINITE);
+				if(pool->isShutdown)
+					break;
+				seenGeneration = pool->jobGeneration;
+				if(worker->index >= pool->jobWorkerCount)
+					continue;
+				RecordCommandBuffersJob *job = pool->job;
+				fplMutexUnlock(&pool->mutex);
+				RunRecordCommandBuffersJob(job);
+				fplMutexLock(&pool->mutex);
+				assert(pool->busyWorkerCount > 0);
+				if(--pool->busyWorkerCount == 0)
+					fplConditionBroadcast(&pool->doneCondition);
+			}
+			fplMutexUnlock(&pool->mutex);
+		}
+	public:
+		CommandRecordPool():
+			workers(),
+			workerCount(0),
+			mutex({}),
+			workCondition({}),
+			doneCondition({}),
+			job(nullptr),
+			jobGeneration(0),
+			jobWorkerCount(0),
+			busyWorkerCount(0),
+			isInitialized(false),
+			isShutdown(false) {
+		}
+
+		~CommandRecordPool() {
+			Release();
+		}
+
+		void Init(const size_t threadCount) {
+			assert(!isInitialized);
+			if(!fplMutexInit(&mutex)) return;
+			fplConditionInit(&workCondition);
+			fplConditionInit(&doneCondition);
+			isInitialized = true;
+			isShutdown = false;
+			size_t count = std::min(std::max(threadCount, (size_t)1), MaxThreadCount) - 1;
+			for(size_t workerIndex = 0; workerIndex < count; ++workerIndex) {
+				Worker &worker = workers[workerCount];
+				worker.pool = this;
+				worker.index = workerCount;
+				worker.thread = fplThreadCreate(WorkerThreadProc, &worker);
+				if(worker.thread == nullptr) break;
+				++workerCount;
+			}
+		}
+
+		void Release() {
+			if(!isInitialized) return;
+			fplMutexLock(&mutex);
+			isShutdown = true;
+			fplConditionBroadcast(&workCondition);
+			fplMutexUnlock(&mutex);
+			for(size_t workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+				fplThreadWaitForOne(workers[workerIndex].thread, FPL_TIMEOUT_INFINITE);
+				workers[workerIndex].thread = nullptr;
+			}
+			workerCount = 0;
+			fplConditionDestroy(&doneCondition);
+			fplConditionDestroy(&workCondition);
+			fplMutexDestroy(&mutex);
+			isInitialized = false;
+		}
+
+		void Run(RecordCommandBuffersJob *job, const size_t maxThreadCount) {
+			size_t helperCount = std::min(std::min(std::max(maxThreadCount, (size_t)1), job->count) - 1, workerCount);
+			if(helperCount > 0) {
+				fplMutexLock(&mutex);
+				this->job = job;
+				jobWorkerCount = helperCount;
+				busyWorkerCount = helperCount;
+				++jobGeneration;
+				fplConditionBroadcast(&workCondition);
+				fplMutexUnlock(&mutex);
+			}
+
+			// NOTE(final): The calling thread takes jobs as well, so everything is still recorded when no worker thread could be started
+			RunRecordCommandBuffersJob(job);
+
+			if(helperCount > 0) {
+				// The job lives on the stack of the caller, so every worker must be done with it before returning
+				fplMutexLock(&mutex);
+				while(busyWorkerCount > 0)
+					fplConditionWait(&doneCondition, &mutex, FPL_TIMEOUT_INFINITE);
+				this->job = nullptr;
+				fplMutexUnlock(&mutex);
+			}
+		}
+	};
+
 	class BaseRenderer: public Renderer {
 	private:
-		volatile uint32_t _idCounter;
-		std::map<BufferID, Buffer *> _buffersMap;
-		std::map<TextureID, Texture *> _texturesMap;
-		std::map<FrameBufferID, FrameBuffer *> _renderTargetMap;
-		std::map<PipelineID, Pipeline *> _pipelineMap;
+		HandleTable<BufferID, Buffer> _buffers;
+		HandleTable<TextureID, Texture> _textures;
+		HandleTable<FrameBufferID, FrameBuffer> _renderTargets;
+		HandleTable<PipelineID, Pipeline> _pipelines;
 		std::vector<CommandBuffer *> _commandBuffers;
+		UniformRing _uniformRing;
+		CommandRecordPool _recordPool;
+		CommandQueueStats _frameStats;
 	protected:
-		BaseRenderer(): 
-			_idCounter(0) {
+		BaseRenderer():
+			_frameStats(CommandQueueStats {}) {
+		}
 
+		// Takes the statistics of the queue as frame statistics, starts counting the next frame and moves the uniform ring to the next region
+		void EndFrame(CommandQueue *queue) {
+			_frameStats = queue->GetStats();
+			_frameStats.uniformBytes = _uniformRing.GetUsedBytes();
+			queue->ResetStats();
+			_uniformRing.NextFrame();
+		}
+
+		// The memory must be a write-only view of the full buffer, which is MaxFramesInFlight times the frame size
+		void InitUniformRing(const BufferID bufferId, uint8_t *memory, const size_t frameSize, const size_t alignment) {
+			_uniformRing.Init(bufferId, memory, frameSize, alignment);
 		}
 
 		~BaseRenderer() {
@@ -543,91 +1070,68 @@ namespace fsr {
 		}
 
 		virtual bool Init() override {
-			_idCounter = 0;
+			_recordPool.Init(fplCPUGetCoreCount());
 			return(true);
 		}
 
 		virtual void Release() override {
+			_recordPool.Release();
 			for(auto commandBuffer : _commandBuffers) {
 				delete commandBuffer;
 			}
-			for(auto pipelinePair : _pipelineMap) {
-				Pipeline *pipeline = pipelinePair.second;
-				delete pipeline;
-			}
-			for(auto renderTargetPair : _renderTargetMap) {
-				FrameBuffer *renderTarget = renderTargetPair.second;
-				delete renderTarget;
-			}
-			for(auto texturePair : _texturesMap) {
-				Texture *texture = texturePair.second;
-				delete texture;
-			}
-			for(auto bufferPair : _buffersMap) {
-				Buffer *buffer = bufferPair.second;
-				delete buffer;
-			}
+			_commandBuffers.clear();
+			_pipelines.ForEach([](Pipeline *pipeline) { delete pipeline; });
+			_pipelines.Clear();
+			_renderTargets.ForEach([](FrameBuffer *renderTarget) { delete renderTarget; });
+			_renderTargets.Clear();
+			_textures.ForEach([](Texture *texture) { delete texture; });
+			_textures.Clear();
+			_buffers.ForEach([](Buffer *buffer) { delete buffer; });
+			_buffers.Clear();
 		}
 
-		inline uint32_t NextID() {
-			uint32_t result = fplAtomicIncrementU32(&_idCounter);
-			return(result);
+		inline BufferID AllocateBufferID() {
+			return(_buffers.Allocate());
 		}
-
 		void AddBuffer(Buffer *buffer) {
 			assert(buffer != nullptr);
-			_buffersMap.insert(std::pair<BufferID, Buffer *>(buffer->id, buffer));
+			_buffers.Set(buffer->id, buffer);
 		}
 		Buffer *RemoveBuffer(const BufferID bufferId) {
-			std::map<BufferID, Buffer *>::iterator found = _buffersMap.find(bufferId);
-			if(found != _buffersMap.end()) {
-				Buffer *buffer = found->second;
-				_buffersMap.erase(bufferId);
-				return(buffer);
-			}
-			return(nullptr);
+			return(_buffers.Remove(bufferId));
 		}
 
+		inline TextureID AllocateTextureID() {
+			return(_textures.Allocate());
+		}
 		void AddTexture(Texture *texture) {
 			assert(texture != nullptr);
-			_texturesMap.insert(std::pair<TextureID, Texture *>(texture->id, texture));
+			_textures.Set(texture->id, texture);
 		}
 		Texture *RemoveTexture(const TextureID textureId) {
-			std::map<TextureID, Texture *>::iterator found = _texturesMap.find(textureId);
-			if(found != _texturesMap.end()) {
-				Texture *texture = found->second;
-				_texturesMap.erase(textureId);
-				return(texture);
-			}
-			return(nullptr);
+			return(_textures.Remove(textureId));
 		}
 
+		inline FrameBufferID AllocateRenderTargetID() {
+			return(_renderTargets.Allocate());
+		}
 		void AddRenderTarget(FrameBuffer *renderTarget) {
 			assert(renderTarget != nullptr);
-			_renderTargetMap.insert(std::pair<FrameBufferID, FrameBuffer *>(renderTarget->id, renderTarget));
+			_renderTargets.Set(renderTarget->id, renderTarget);
 		}
 		FrameBuffer *RemoveRenderTarget(const FrameBufferID renderTargetId) {
-			std::map<FrameBufferID, FrameBuffer *>::iterator found = _renderTargetMap.find(renderTargetId);
-			if(found != _renderTargetMap.end()) {
-				FrameBuffer *renderTarget = found->second;
-				_renderTargetMap.erase(renderTargetId);
-				return(renderTarget);
-			}
-			return(nullptr);
+			return(_renderTargets.Remove(renderTargetId));
 		}
 
+		inline PipelineID AllocatePipelineID() {
+			return(_pipelines.Allocate());
+		}
 		void AddPipeline(Pipeline *pipeline) {
 			assert(pipeline != nullptr);
-			_pipelineMap.insert(std::pair<PipelineID, Pipeline *>(pipeline->id, pipeline));
+			_pipelines.Set(pipeline->id, pipeline);
 		}
 		Pipeline *RemovePipeline(const PipelineID pipelineId) {
-			std::map<PipelineID, Pipeline *>::iterator found = _pipelineMap.find(pipelineId);
-			if(found != _pipelineMap.end()) {
-				Pipeline *pipeline = found->second;
-				_pipelineMap.erase(pipelineId);
-				return(pipeline);
-			}
-			return(nullptr);
+			return(_pipelines.Remove(pipelineId));
 		}
 
 		void AddCommandBuffer(CommandBuffer *commandBuffer) {
@@ -639,83 +1143,722 @@ namespace fsr {
 			_commandBuffers.erase(std::remove(_commandBuffers.begin(), _commandBuffers.end(), commandBuffer));
 		}
 	public:
-		Buffer *GetBuffer(const BufferID bufferId) {
-			Buffer *result = _buffersMap[bufferId];
-			return(result);
+		CommandQueueStats GetFrameStats() const override {
+			return(_frameStats);
 		}
 
-		Pipeline *GetPipeline(const PipelineID pipelineId) {
-			Pipeline *result = _pipelineMap[pipelineId];
-			return(result);
+		UniformAllocation AllocateUniforms(const size_t size) override {
+			return(_uniformRing.Allocate(size));
+		}
+
+		void RecordCommandBuffers(CommandBuffer *const *commandBuffers, const size_t count, RecordCommandBufferFunc *recordFunc, void *userData, const size_t maxThreadCount) override {
+			if(commandBuffers == nullptr || count == 0 || recordFunc == nullptr) return;
+			RecordCommandBuffersJob job = {};
+			job.commandBuffers = commandBuffers;
+			job.recordFunc = recordFunc;
+			job.userData = userData;
+			job.count = count;
+			job.nextIndex = 0;
+			_recordPool.Run(&job, maxThreadCount);
+		}
+
+		inline UniformRing &GetUniformRing() {
+			return(_uniformRing);
 		}
 
-		Texture *GetTexture(const TextureID textureID) {
-			Texture *result = _texturesMap[textureID];
+		// NOTE(final): All getters return null for unknown or stale handles
+		inline Buffer *GetBuffer(const BufferID bufferId) const {
+			Buffer *result = _buffers.Get(bufferId);
 			return(result);
 		}
 
-		FrameBuffer *GetRenderTarget(const FrameBufferID renderTargetId) {
-			FrameBuffer *result = _renderTargetMap[renderTargetId];
+		inline Pipeline *GetPipeline(const PipelineID pipelineId) const {
+			Pipeline *result = _pipelines.Get(pipelineId);
 			return(result);
 		}
-	};
 
-	class OpenGLRenderer;
+		inline Texture *GetTexture(const TextureID textureID) const {
+			Texture *result = _textures.Get(textureID);
+			return(result);
+		}
 
-	class OpenGLCommandBuffer: public DefaultCommandBuffer {
-	public:
-		OpenGLCommandBuffer(OpenGLRenderer *renderer):
-			DefaultCommandBuffer((Renderer *)renderer) {
+		inline FrameBuffer *GetRenderTarget(const FrameBufferID renderTargetId) const {
+			FrameBuffer *result = _renderTargets.Get(renderTargetId);
+			return(result);
 		}
 	};
 
-	class OpenGLCommandQueue: public CommandQueue {
+	// Shadow copy of the states which are applied to the graphics API.
+	// Backend independent: A backend applies a state only when the Change* function returns true, so only the differences reach the API.
+	class SubmitStateCache {
 	private:
-		OpenGLRenderer *renderer;
+		enum StateBits: uint32_t {
+			StateBit_Viewport = 1 << 0,
+			StateBit_Scissor = 1 << 1,
+			StateBit_Depth = 1 << 2,
+			StateBit_Blend = 1 << 3,
+			StateBit_Cull = 1 << 4,
+			StateBit_Polygon = 1 << 5,
+			StateBit_Clear = 1 << 6,
+			StateBit_VertexBuffer = 1 << 7,
+			StateBit_IndexBuffer = 1 << 8,
+			// One bit for each uniform buffer binding
+			StateBit_FirstUniformBuffer = 1 << 9,
+		};
 
-		struct PipelineSubmitState {
+		Viewport viewport;
+		ScissorRect scissor;
+		DepthSettings depth;
+		BlendSettings blend;
+		CullMode cullMode;
+		PolygonMode polygonMode;
+		ClearValue clearValue;
+		BufferID vertexBuffer;
+		BufferID indexBuffer;
+		BindUniformBufferCommand uniformBuffers[MaxUniformBufferBindings];
+		uint32_t validMask;
+
+		// NOTE(final): All cached states are plain structs without padding, so a memory compare is sufficient
+		template<typename T>
+		bool Change(T &current, const T &value, const uint32_t bit) {
+			if((validMask & bit) && std::memcmp(&current, &value, sizeof(T)) == 0) {
+				++stats.skippedCallCount;
+				return(false);
+			}
+			current = value;
+			validMask |= bit;
+			return(true);
+		}
+	public:
+		CommandQueueStats stats;
+
+		SubmitStateCache():
+			viewport(Viewport {}),
+			scissor(ScissorRect {}),
+			depth(DepthSettings {}),
+			blend(BlendSettings {}),
+			cullMode(CullMode::None),
+			polygonMode(PolygonMode::Fill),
+			clearValue(ClearValue {}),
+			vertexBuffer(BufferID {}),
+			indexBuffer(BufferID {}),
+			uniformBuffers(),
+			validMask(0),
+			stats(CommandQueueStats {}) {
+		}
+
+		// Forgets all cached states, so the next change of any state reaches the API
+		inline void Invalidate() {
+			validMask = 0;
+		}
+
+		inline bool ChangeViewport(const Viewport &value) { return(Change(viewport, value, StateBit_Viewport)); }
+		inline bool ChangeScissor(const ScissorRect &value) { return(Change(scissor, value, StateBit_Scissor)); }
+		inline bool ChangeDepth(const DepthSettings &value) { return(Change(depth, value, StateBit_Depth)); }
+		inline bool ChangeBlend(const BlendSettings &value) { return(Change(blend, value, StateBit_Blend)); }
+		inline bool ChangeCullMode(const CullMode value) { return(Change(cullMode, value, StateBit_Cull)); }
+		inline bool ChangePolygonMode(const PolygonMode value) { return(Change(polygonMode, value, StateBit_Polygon)); }
+		inline bool ChangeClearValue(const ClearValue &value) { return(Change(clearValue, value, StateBit_Clear)); }
+		inline bool ChangeVertexBuffer(const BufferID value) { return(Change(vertexBuffer, value, StateBit_VertexBuffer)); }
+		inline bool ChangeIndexBuffer(const BufferID value) { return(Change(indexBuffer, value, StateBit_IndexBuffer)); }
+		inline bool ChangeUniformBuffer(const BindUniformBufferCommand &value) {
+			assert(value.binding < MaxUniformBufferBindings);
+			return(Change(uniformBuffers[value.binding], value, StateBit_FirstUniformBuffer << value.binding));
+		}
+	};
+
+	// Walks the recorded commands of the submitted command buffers and hands each command to the backend
+	class DefaultCommandQueue: public CommandQueue {
+	protected:
+		struct PipelineSubmitState {
 			Pipeline *activePipeline;
+			b32 isInsideRenderPass;
+			b32 hasVertexBuffer;
 		};
 
-		void ChangePipeline(PipelineSubmitState *submitState, const PipelineID pipelineId) {
-			BaseRenderer *baseRenderer = reinterpret_cast<BaseRenderer *>(renderer);
+		BaseRenderer *baseRenderer;
+		SubmitStateCache stateCache;
+
+		virtual void ExecuteCommand(PipelineSubmitState *submitState, const CommandType type, const uint8_t *data, const size_t size) = 0;
+
+		// Called after the last command of a command buffer was executed
+		virtual void EndCommandBuffer(PipelineSubmitState *submitState) {
+		}
+
+		// Called for command buffers which cannot be executed
+		virtual void RejectCommandBuffer(const char *reason) {
+			assert(!"Command buffer rejected!");
+		}
+
+		// Called once before the command buffers of a submit are executed
+		virtual void BeginSubmit() {
+		}
+
+		bool SubmitCommandBuffer(PipelineSubmitState *submitState, CommandBuffer &commandBuffer) {
+			DefaultCommandBuffer *defaultCommandBuffer = static_cast<DefaultCommandBuffer *>(&commandBuffer);
+			if(defaultCommandBuffer->GetRenderer() != baseRenderer) {
+				RejectCommandBuffer("Command buffer was created by another renderer");
+				return(false);
+			}
+			if(!defaultCommandBuffer->IsWaitingForSubmit()) {
+				RejectCommandBuffer("Command buffer was not ended or already submitted");
+				return(false);
+			}
+			++stateCache.stats.submitCount;
+			for(size_t chunkIndex = 0, chunkCount = defaultCommandBuffer->GetChunkCount(); chunkIndex < chunkCount; ++chunkIndex) {
+				const CommandBufferChunk *chunk = defaultCommandBuffer->GetChunk(chunkIndex);
+				size_t offset = 0;
+				size_t remaining = chunk->used;
+				const uint8_t *start = chunk->data;
+				while(remaining >= sizeof(CommandHeader)) {
+					const CommandHeader *header = (const CommandHeader *)(start + offset);
+
+					CommandType cmdType = header->type;
+					size_t dataSize = header->size;
+
+					size_t stride = CommandBufferChunk::GetCommandStride(dataSize);
+					if(stride > remaining) {
+						RejectCommandBuffer("Command exceeds the chunk, stream is corrupt");
+						break;
+					}
+
+					if(dataSize > 0) {
+						const uint8_t *dataStart = (const uint8_t *)header + sizeof(CommandHeader);
+						++stateCache.stats.commandCount;
+						ExecuteCommand(submitState, cmdType, dataStart, dataSize);
+					}
+					remaining -= stride;
+					offset += stride;
+				}
+			}
+			EndCommandBuffer(submitState);
+			defaultCommandBuffer->FinishSubmit();
+			return(true);
+		}
+
+		DefaultCommandQueue(BaseRenderer *baseRenderer):
+			CommandQueue(),
+			baseRenderer(baseRenderer) {
+		}
+	public:
+		bool Submit(CommandBuffer &commandBuffer) override {
+			BeginSubmit();
+			PipelineSubmitState submitState = {};
+			bool result = SubmitCommandBuffer(&submitState, commandBuffer);
+			return(result);
+		}
+
+		bool Submit(CommandBuffer *const *commandBuffers, const size_t count) override {
+			// NOTE(final): The pipeline state is carried over from one command buffer to the next, just like they were recorded into one buffer
+			BeginSubmit();
+			PipelineSubmitState submitState = {};
+			bool result = true;
+			for(size_t index = 0; index < count; ++index) {
+				assert(commandBuffers[index] != nullptr);
+				if(!SubmitCommandBuffer(&submitState, *commandBuffers[index])) {
+					result = false;
+				}
+			}
+			return(result);
+		}
+
+		CommandQueueStats GetStats() const override {
+			return(stateCache.stats);
+		}
+
+		void ResetStats() override {
+			stateCache.stats = {};
+		}
+
+		void InvalidateState() override {
+			stateCache.Invalidate();
+		}
+	};
+
+	// Ring of persistently mapped staging memory for asynchronous uploads.
+	// The data is copied into the ring immediately, the copies into the destination buffers and textures are collected and issued as one batch on flush.
+	// Each batch is fenced, so its memory is reused only after the GPU has passed the fence.
+	class OpenGLStagingRing {
+	private:
+		enum class StagingCopyType: int32_t {
+			Buffer = 0,
+			TextureFace,
+		};
+
+		struct StagingCopy {
+			StagingCopyType type;
+			uint32_t faceIndex;
+			BufferID bufferId;
+			TextureID textureId;
+			size_t stagingOffset;
+			size_t dstOffset;
+			size_t size;
+		};
+
+		struct StagingBatch {
+			GLsync fence;
+			// Ring position after the last allocation of the batch
+			size_t end;
+		};
+
+		constexpr static size_t RingSize = 32 * 1024 * 1024;
+		constexpr static size_t Alignment = 64;
+
+		BaseRenderer *renderer;
+		uint8_t *memory;
+		GLuint nativeId;
+		// Positions are monotonic, the offset in the ring is the position modulo the ring size
+		size_t head;
+		size_t tail;
+		std::vector<StagingCopy> pendingCopies;
+		std::deque<StagingBatch> batches;
+		size_t uploadBytes;
+		size_t waitCount;
+
+		void RetireBatches(const bool waitForOldest) {
+			while(!batches.empty()) {
+				StagingBatch &batch = batches.front();
+				GLuint64 timeout = waitForOldest ? 1000000000ull : 0; // 1 second in nanoseconds
+				GLenum waitResult = glClientWaitSync(batch.fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+				if(waitResult == GL_TIMEOUT_EXPIRED) {
+					if(!waitForOldest) break;
+					continue;
+				}
+				// NOTE(final): A failed wait is treated as signaled, otherwise the ring would stay blocked forever
+				assert(waitResult != GL_WAIT_FAILED);
+				glDeleteSync(batch.fence);
+				tail = batch.end;
+				batches.pop_front();
+				if(waitForOldest) break;
+			}
+		}
+
+		bool Allocate(const size_t size, size_t *outOffset) {
+			size_t alignedSize = (size + Alignment - 1) & ~(Alignment - 1);
+			if(memory == nullptr || alignedSize > RingSize) {
+				return(false);
+			}
+
+			// Allocations never wrap around, the remaining space at the end of the ring is skipped instead
+			size_t position = head % RingSize;
+			size_t skipSize = (position + alignedSize > RingSize) ? (RingSize - position) : 0;
+			size_t requiredSize = skipSize + alignedSize;
+
+			RetireBatches(false);
+			while((head + requiredSize) - tail > RingSize) {
+				if(head == tail) {
+					// NOTE(final): The ring is drained, so a wrapping allocation restarts at the next ring boundary instead of waiting for space which never gets free
+					head = tail = ((head + RingSize - 1) / RingSize) * RingSize;
+					skipSize = 0;
+					requiredSize = alignedSize;
+					if(requiredSize > RingSize) {
+						return(false);
+					}
+					continue;
+				}
+				if(batches.empty()) {
+					// The ring is full of copies which were not issued yet
+					Flush();
+					if(batches.empty()) {
+						return(false);
+					}
+				}
+				RetireBatches(true);
+				++waitCount;
+			}
+
+			*outOffset = (head + skipSize) % RingSize;
+			head += requiredSize;
+			return(true);
+		}
+	public:
+		OpenGLStagingRing(BaseRenderer *renderer):
+			renderer(renderer),
+			memory(nullptr),
+			nativeId(0),
+			head(0),
+			tail(0),
+			uploadBytes(0),
+			waitCount(0) {
+		}
+
+		// Requires GL 4.4, without it every upload falls back to a direct upload
+		bool Init() {
+			if(glBufferStorage == nullptr || glFenceSync == nullptr || glCopyBufferSubData == nullptr) {
+				return(false);
+			}
+			glGenBuffers(1, &nativeId);
+			if(nativeId == 0) {
+				return(false);
+			}
+			GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			glBindBuffer(GL_COPY_READ_BUFFER, nativeId);
+			glBufferStorage(GL_COPY_READ_BUFFER, RingSize, nullptr, flags);
+			memory = (uint8_t *)glMapBufferRange(GL_COPY_READ_BUFFER, 0, RingSize, flags);
+			glBindBuffer(GL_COPY_READ_BUFFER, 0);
+			if(memory == nullptr) {
+				Release();
+				return(false);
+			}
+			return(true);
+		}
+
+		void Release() {
+			pendingCopies.clear();
+			for(const StagingBatch &batch : batches) {
+				glDeleteSync(batch.fence);
+			}
+			batches.clear();
+			if(memory != nullptr) {
+				glBindBuffer(GL_COPY_READ_BUFFER, nativeId);
+				glUnmapBuffer(GL_COPY_READ_BUFFER);
+				glBindBuffer(GL_COPY_READ_BUFFER, 0);
+				memory = nullptr;
+			}
+			if(nativeId > 0) {
+				glDeleteBuffers(1, &nativeId);
+				nativeId = 0;
+			}
+		}
+
+		bool StageBuffer(const BufferID bufferId, const size_t dstOffset, const size_t size, const uint8_t *data) {
+			size_t stagingOffset;
+			if(!Allocate(size, &stagingOffset)) {
+				return(false);
+			}
+			std::memcpy(memory + stagingOffset, data, size);
+			StagingCopy copy = {};
+			copy.type = StagingCopyType::Buffer;
+			copy.bufferId = bufferId;
+			copy.stagingOffset = stagingOffset;
+			copy.dstOffset = dstOffset;
+			copy.size = size;
+			pendingCopies.push_back(copy);
+			return(true);
+		}
+
+		bool StageTextureFace(const TextureID textureId, const uint32_t faceIndex, const size_t size, const uint8_t *data) {
+			size_t stagingOffset;
+			if(!Allocate(size, &stagingOffset)) {
+				return(false);
+			}
+			std::memcpy(memory + stagingOffset, data, size);
+			StagingCopy copy = {};
+			copy.type = StagingCopyType::TextureFace;
+			copy.textureId = textureId;
+			copy.faceIndex = faceIndex;
+			copy.stagingOffset = stagingOffset;
+			copy.size = size;
+			pendingCopies.push_back(copy);
+			return(true);
+		}
+
+		// Issues all pending copies as one fenced batch, resources which were destroyed in between are skipped
+		void Flush() {
+			if(pendingCopies.empty()) {
+				return;
+			}
+			glBindBuffer(GL_COPY_READ_BUFFER, nativeId);
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, nativeId);
+			for(const StagingCopy &copy : pendingCopies) {
+				if(copy.type == StagingCopyType::Buffer) {
+					const OpenGLBuffer *buffer = static_cast<const OpenGLBuffer *>(renderer->GetBuffer(copy.bufferId));
+					if(buffer == nullptr) continue;
+					glBindBuffer(GL_COPY_WRITE_BUFFER, buffer->nativeId);
+					glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, (GLintptr)copy.stagingOffset, (GLintptr)copy.dstOffset, (GLsizeiptr)copy.size);
+				} else {
+					OpenGLTexture *texture = static_cast<OpenGLTexture *>(renderer->GetTexture(copy.textureId));
+					if(texture == nullptr) continue;
+					// NOTE(final): With a bound unpack buffer, the pixel pointer is a offset into that buffer
+					texture->WriteFace(copy.faceIndex, (const void *)(uintptr_t)copy.stagingOffset);
+				}
+				uploadBytes += copy.size;
+			}
+			glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+			glBindBuffer(GL_COPY_READ_BUFFER, 0);
+			pendingCopies.clear();
+
+			StagingBatch batch = {};
+			batch.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			batch.end = head;
+			batches.push_back(batch);
+		}
+
+		// Adds the upload statistics since the last call
+		void CollectStats(CommandQueueStats &stats) {
+			stats.uploadBytes += uploadBytes;
+			stats.uploadWaitCount += waitCount;
+			uploadBytes = 0;
+			waitCount = 0;
+		}
+
+		inline bool IsAvailable() const {
+			return(memory != nullptr);
+		}
+	};
+
+	class OpenGLRenderer;
 
+	class OpenGLCommandBuffer: public DefaultCommandBuffer {
+	public:
+		OpenGLCommandBuffer(OpenGLRenderer *renderer):
+			DefaultCommandBuffer((Renderer *)renderer) {
+		}
+	};
+
+	class OpenGLCommandQueue: public DefaultCommandQueue {
+	private:
+		OpenGLStagingRing *stagingRing;
+
+		static GLenum GetDepthFunc(const DepthFunc func) {
+			switch(func) {
+				case DepthFunc::Never: return GL_NEVER;
+				case DepthFunc::Equal: return GL_EQUAL;
+				case DepthFunc::NotEqual: return GL_NOTEQUAL;
+				case DepthFunc::Less: return GL_LESS;
+				case DepthFunc::LessOrEqual: return GL_LEQUAL;
+				case DepthFunc::Greater: return GL_GREATER;
+				case DepthFunc::GreaterOrEqual: return GL_GEQUAL;
+				default: return GL_ALWAYS;
+			}
+		}
+
+		static GLenum GetBlendFunc(const BlendOp op) {
+			switch(op) {
+				case BlendOp::Zero: return GL_ZERO;
+				case BlendOp::One: return GL_ONE;
+				case BlendOp::SrcColor: return GL_SRC_COLOR;
+				case BlendOp::InvSrcColor: return GL_ONE_MINUS_SRC_COLOR;
+				case BlendOp::SrcAlpha: return GL_SRC_ALPHA;
+				case BlendOp::InvSrcAlpha: return GL_ONE_MINUS_SRC_ALPHA;
+				case BlendOp::DstColor: return GL_DST_COLOR;
+				case BlendOp::InvDstColor: return GL_ONE_MINUS_DST_COLOR;
+				case BlendOp::DstAlpha: return GL_DST_ALPHA;
+				case BlendOp::InvDstAlpha: return GL_ONE_MINUS_DST_ALPHA;
+				default: return GL_ONE;
+			}
+		}
+
+		static GLenum GetPrimitiveMode(const PrimitiveMode mode) {
+			switch(mode) {
+				case PrimitiveMode::PointList: return GL_POINTS;
+				case PrimitiveMode::LineList: return GL_LINES;
+				case PrimitiveMode::LineStrip: return GL_LINE_STRIP;
+				case PrimitiveMode::LineLoop: return GL_LINE_LOOP;
+				case PrimitiveMode::TriangleStrip: return GL_TRIANGLE_STRIP;
+				case PrimitiveMode::TriangleFan: return GL_TRIANGLE_FAN;
+				default: return GL_TRIANGLES;
+			}
+		}
+
+		void ApplyViewport(const Viewport &viewport) {
+			if(stateCache.ChangeViewport(viewport)) {
+				glDepthRange(viewport.minDepth, viewport.maxDepth);
+				glViewport((int)viewport.x, (int)viewport.y, (int)viewport.width, (int)viewport.height);
+				stateCache.stats.apiCallCount += 2;
+			}
+		}
+
+		void ApplyScissor(const ScissorRect &scissor) {
+			if(stateCache.ChangeScissor(scissor)) {
+				glScissor(scissor.x, scissor.y, scissor.width, scissor.height);
+				stateCache.stats.apiCallCount += 1;
+			}
+		}
+
+		void ApplyVertexBuffer(const BufferID bufferId) {
+			if(stateCache.ChangeVertexBuffer(bufferId)) {
+				const OpenGLBuffer *buffer = static_cast<const OpenGLBuffer *>(baseRenderer->GetBuffer(bufferId));
+				glBindBuffer(GL_ARRAY_BUFFER, buffer != nullptr ? buffer->nativeId : 0);
+				stateCache.stats.apiCallCount += 1;
+			}
+		}
+
+		void ApplyIndexBuffer(const BufferID bufferId) {
+			if(stateCache.ChangeIndexBuffer(bufferId)) {
+				const OpenGLBuffer *buffer = static_cast<const OpenGLBuffer *>(baseRenderer->GetBuffer(bufferId));
+				glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer != nullptr ? buffer->nativeId : 0);
+				stateCache.stats.apiCallCount += 1;
+			}
+		}
+
+		void ApplyUniformBuffer(const BindUniformBufferCommand &binding) {
+			if(stateCache.ChangeUniformBuffer(binding)) {
+				const OpenGLBuffer *buffer = static_cast<const OpenGLBuffer *>(baseRenderer->GetBuffer(binding.bufferId));
+				if(buffer != nullptr) {
+					glBindBufferRange(GL_UNIFORM_BUFFER, binding.binding, buffer->nativeId, (GLintptr)binding.offset, (GLsizeiptr)binding.size);
+				} else {
+					glBindBufferBase(GL_UNIFORM_BUFFER, binding.binding, 0);
+				}
+				stateCache.stats.apiCallCount += 1;
+			}
+		}
+
+		void ChangePipeline(PipelineSubmitState *submitState, const PipelineID pipelineId) {
 			Pipeline *pipeline = baseRenderer->GetPipeline(pipelineId);
 			assert(pipeline != nullptr);
+			if(pipeline == nullptr) return;
+			if(submitState->activePipeline == pipeline) {
+				// Same pipeline is still bound, but dynamic viewport/scissor may have changed it in between
+				ApplyViewport(pipeline->viewport);
+				ApplyScissor(pipeline->scissor);
+				return;
+			}
 			submitState->activePipeline = pipeline;
 
-			Viewport viewport = pipeline->viewport;
-			ScissorRect scissor = pipeline->scissor;
+			const PipelineSettings &settings = pipeline->settings;
+
+			if(stateCache.ChangeClearValue(settings.clear.value)) {
+				const ClearValue &clearValue = settings.clear.value;
+				glm::vec4 clearColor = clearValue.color.v4;
+				glClearColor(clearColor.r, clearColor.g, clearColor.b, clearColor.a);
+				glClearDepth(clearValue.depthStencil.depth);
+				glClearStencil(clearValue.depthStencil.stencil);
+				stateCache.stats.apiCallCount += 3;
+			}
 
-			ClearValue clearValue = pipeline->settings.clear.value;
-			glm::vec4 clearColor = clearValue.color.v4;
-			float clearDepth = clearValue.depthStencil.depth;
-			int clearStencil = clearValue.depthStencil.stencil;
+			ApplyViewport(pipeline->viewport);
+			ApplyScissor(pipeline->scissor);
 
-			glClearColor(clearColor.r, clearColor.g, clearColor.b, clearColor.a);
-			glClearDepth(clearDepth);
-			glClearStencil(clearStencil);
+			if(stateCache.ChangeDepth(settings.depth)) {
+				if(settings.depth.test == DepthTest::On) {
+					glEnable(GL_DEPTH_TEST);
+				} else {
+					glDisable(GL_DEPTH_TEST);
+				}
+				glDepthFunc(GetDepthFunc(settings.depth.func));
+				glDepthMask(settings.depth.writeEnabled ? GL_TRUE : GL_FALSE);
+				stateCache.stats.apiCallCount += 3;
+			}
 
-			glDepthRange(viewport.minDepth, viewport.maxDepth);
+			if(stateCache.ChangeBlend(settings.blend)) {
+				if(settings.blend.isEnabled) {
+					glEnable(GL_BLEND);
+					glBlendFunc(GetBlendFunc(settings.blend.sourceColor), GetBlendFunc(settings.blend.destColor));
+					stateCache.stats.apiCallCount += 2;
+				} else {
+					glDisable(GL_BLEND);
+					stateCache.stats.apiCallCount += 1;
+				}
+			}
 
-			glViewport((int)viewport.x, (int)viewport.y, (int)viewport.width, (int)viewport.height);
-			glScissor(scissor.x, scissor.y, scissor.width, scissor.height);
+			if(stateCache.ChangeCullMode(settings.cullMode)) {
+				// NOTE(final): The cull mode is the winding of the faces which gets removed
+				if(settings.cullMode == CullMode::None) {
+					glDisable(GL_CULL_FACE);
+					stateCache.stats.apiCallCount += 1;
+				} else {
+					glEnable(GL_CULL_FACE);
+					glCullFace(GL_BACK);
+					glFrontFace(settings.cullMode == CullMode::ClockWise ? GL_CCW : GL_CW);
+					stateCache.stats.apiCallCount += 3;
+				}
+			}
+
+			if(stateCache.ChangePolygonMode(settings.polygonMode)) {
+				GLenum polygonMode = settings.polygonMode == PolygonMode::Line ? GL_LINE : (settings.polygonMode == PolygonMode::Point ? GL_POINT : GL_FILL);
+				glPolygonMode(GL_FRONT_AND_BACK, polygonMode);
+				stateCache.stats.apiCallCount += 1;
+			}
 		}
 
-		void ExecuteCommand(PipelineSubmitState *submitState, const CommandType type, const uint8_t *data, const size_t size) {
+	protected:
+		void ExecuteCommand(PipelineSubmitState *submitState, const CommandType type, const uint8_t *data, const size_t size) override {
 			switch(type) {
 				case CommandType::SetViewport:
 				{
 					const SetViewportCommand *cmd = (const SetViewportCommand *)data;
-					Viewport viewport = cmd->viewportRect;
-					glViewport((int)viewport.x, (int)viewport.y, (int)viewport.width, (int)viewport.height);
+					ApplyViewport(cmd->viewportRect);
 				} break;
 
 				case CommandType::SetScissor:
 				{
 					const SetScissorCommand *cmd = (const SetScissorCommand *)data;
-					ScissorRect scissor = cmd->scissorRect;
-					glScissor(scissor.x, scissor.y, scissor.width, scissor.height);
+					ApplyScissor(cmd->scissorRect);
+				} break;
+
+				case CommandType::BindVertexBuffers:
+				case CommandType::BindIndexBuffers:
+				{
+					const BindBuffersCommand *cmd = (const BindBuffersCommand *)data;
+					// NOTE(final): Only a single vertex stream is supported, more buffers are rejected by the validation of the null renderer
+					assert(cmd->bufferCount == 1);
+					const BufferID *bufferIds = (const BufferID *)(data + sizeof(BindBuffersCommand));
+					if(type == CommandType::BindVertexBuffers) {
+						ApplyVertexBuffer(bufferIds[0]);
+						submitState->hasVertexBuffer = true;
+					} else {
+						ApplyIndexBuffer(bufferIds[0]);
+					}
+				} break;
+
+				case CommandType::BindUniformBuffer:
+				{
+					const BindUniformBufferCommand *cmd = (const BindUniformBufferCommand *)data;
+					ApplyUniformBuffer(*cmd);
+				} break;
+
+				case CommandType::Draw:
+				{
+					const DrawCommand *cmd = (const DrawCommand *)data;
+					GLenum mode = GetPrimitiveMode(submitState->activePipeline != nullptr ? submitState->activePipeline->primitive : PrimitiveMode::TriangleList);
+					// NOTE(final): A first instance requires GL 4.2 and instancing requires GL 3.1, so draws which need them are rejected instead of drawing a single instance.
+					// The null renderer validates against the same rules, see NullCommandQueue.
+					bool isInstanced = cmd->instanceCount > 1;
+					assert(cmd->firstInstance == 0);
+					assert(!isInstanced || glDrawArraysInstanced != nullptr);
+					if(cmd->firstInstance != 0 || (isInstanced && glDrawArraysInstanced == nullptr)) {
+						break;
+					}
+					if(isInstanced) {
+						glDrawArraysInstanced(mode, (GLint)cmd->firstVertex, (GLsizei)cmd->vertexCount, (GLsizei)cmd->instanceCount);
+					} else {
+						glDrawArrays(mode, (GLint)cmd->firstVertex, (GLsizei)cmd->vertexCount);
+					}
+					stateCache.stats.apiCallCount += 1;
+					++stateCache.stats.drawCount;
+				} break;
+
+				case CommandType::BeginRenderPass:
+				{
+					const BeginRenderPassCommand *cmd = (const BeginRenderPassCommand *)data;
+					const OpenGLRenderTarget *renderTarget = static_cast<const OpenGLRenderTarget *>(baseRenderer->GetRenderTarget(cmd->renderTargetId));
+					glBindFramebuffer(GL_FRAMEBUFFER, renderTarget != nullptr ? renderTarget->GetNativeId() : 0);
+					stateCache.stats.apiCallCount += 1;
+					if(cmd->clearValueCount > 0) {
+						// NOTE(final): The first clear value is used for color, depth and stencil
+						const ClearValue &clearValue = cmd->clearValues[0];
+						if(stateCache.ChangeClearValue(clearValue)) {
+							glm::vec4 clearColor = clearValue.color.v4;
+							glClearColor(clearColor.r, clearColor.g, clearColor.b, clearColor.a);
+							glClearDepth(clearValue.depthStencil.depth);
+							glClearStencil(clearValue.depthStencil.stencil);
+							stateCache.stats.apiCallCount += 3;
+						}
+						// NOTE(final): Without a render area the whole target is cleared, otherwise the clear is restricted by the scissor test
+						const RenderArea &area = cmd->renderArea;
+						bool hasRenderArea = area.width > 0 && area.height > 0;
+						if(hasRenderArea) {
+							ApplyScissor(ScissorRect((int32_t)area.x, (int32_t)area.y, (int32_t)area.width, (int32_t)area.height));
+							glEnable(GL_SCISSOR_TEST);
+							stateCache.stats.apiCallCount += 1;
+						}
+						glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+						stateCache.stats.apiCallCount += 1;
+						if(hasRenderArea) {
+							glDisable(GL_SCISSOR_TEST);
+							stateCache.stats.apiCallCount += 1;
+						}
+					}
+					submitState->isInsideRenderPass = true;
+				} break;
+
+				case CommandType::EndRenderPass:
+				{
+					glBindFramebuffer(GL_FRAMEBUFFER, 0);
+					stateCache.stats.apiCallCount += 1;
+					submitState->isInsideRenderPass = false;
 				} break;
 
 				case CommandType::BindPipeline:
@@ -730,47 +1873,79 @@ namespace fsr {
 					break;
 			}
 		}
-	public:
-		OpenGLCommandQueue(OpenGLRenderer *renderer):
-			CommandQueue(),
-			renderer(renderer) {
-		}
-
-		bool Submit(CommandBuffer &commandBuffer) override {
-			PipelineSubmitState submitState = {};
-			OpenGLCommandBuffer *nativeCommandBuffer = static_cast<OpenGLCommandBuffer *>(&commandBuffer);
-			CommandBufferChunk *chunk;
-			while((chunk = nativeCommandBuffer->Pop()) != nullptr) {
-				size_t offset = 0;
-				size_t remaining = chunk->used;
-				const uint8_t *start = chunk->data;
-				while(remaining >= sizeof(CommandHeader)) {
-					const CommandHeader *header = (const CommandHeader *)(start + offset);
-
-					// TODO(final): Validate header!
-					CommandType cmdType = header->type;
-					size_t dataSize = header->size;
 
-					remaining -= sizeof(CommandHeader);
-					offset += sizeof(CommandHeader);
+		void BeginSubmit() override {
+			// Uploads must reach the GPU before the commands which reads them
+			FlushUploads();
 
-					if(dataSize > 0) {
-						const uint8_t *dataStart = (const uint8_t *)header + sizeof(CommandHeader);
-						ExecuteCommand(&submitState, cmdType, dataStart, dataSize);
-						remaining -= dataSize;
-						offset += dataSize;
-					}
-				}
-				int x = 0;
+			// Without persistent mapping the uniform ring lives in system memory, so everything written since the last submit is uploaded now
+			UniformRing &uniformRing = baseRenderer->GetUniformRing();
+			OpenGLBuffer *ringBuffer = static_cast<OpenGLBuffer *>(baseRenderer->GetBuffer(uniformRing.GetBufferId()));
+			if(ringBuffer == nullptr || ringBuffer->persistentData != nullptr) return;
+			size_t offset, size;
+			if(uniformRing.TakeUnflushedRange(&offset, &size)) {
+				ringBuffer->Write(offset, size, uniformRing.GetMemory() + offset);
+				stateCache.stats.apiCallCount += 3;
 			}
-			return(true);
+		}
+	public:
+		OpenGLCommandQueue(BaseRenderer *renderer, OpenGLStagingRing *stagingRing):
+			DefaultCommandQueue(renderer),
+			stagingRing(stagingRing) {
 		}
 
+		void FlushUploads() {
+			stagingRing->Flush();
+			stagingRing->CollectStats(stateCache.stats);
+		}
 	};
 
 	class OpenGLRenderer: public BaseRenderer {
 	private:
 		OpenGLCommandQueue *_commandQueue;
+		OpenGLStagingRing _stagingRing;
+		std::vector<uint8_t> _uniformShadowMemory;
+		GLsync _frameFences[MaxFramesInFlight];
+		BufferID _uniformRingBufferId;
+
+		void CreateUniformRing() {
+			// NOTE(final): Uniform buffers requires GL 3.1, without it the ring stays empty and PushUniforms() always fails
+			if(glBindBufferRange == nullptr) {
+				return;
+			}
+
+			GLint alignment = 0;
+			glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+			size_t ringSize = UniformRingFrameSize * MaxFramesInFlight;
+
+			BufferID id = AllocateBufferID();
+			OpenGLBuffer *ringBuffer = new OpenGLBuffer(id, BufferType::Uniform, BufferAccess::WriteOnly, BufferUsage::Dynamic, ringSize);
+			uint8_t *memory = nullptr;
+			if(glBufferStorage != nullptr && glFenceSync != nullptr && ringBuffer->InitPersistent()) {
+				memory = (uint8_t *)ringBuffer->persistentData;
+			} else if(ringBuffer->Init(nullptr)) {
+				// Fallback for GL < 4.4: Written into system memory and uploaded on submit
+				_uniformShadowMemory.resize(ringSize);
+				memory = &_uniformShadowMemory[0];
+			} else {
+				delete ringBuffer;
+				RemoveBuffer(id);
+				return;
+			}
+			AddBuffer(ringBuffer);
+			_uniformRingBufferId = id;
+			InitUniformRing(id, memory, UniformRingFrameSize, (size_t)std::max(alignment, 16));
+		}
+
+		void WaitForFrameFence(const uint32_t frameIndex) {
+			GLsync fence = _frameFences[frameIndex];
+			if(fence == nullptr) return;
+			constexpr GLuint64 FenceTimeout = 1000000000ull; // 1 second in nanoseconds
+			GLenum waitResult = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FenceTimeout);
+			assert(waitResult != GL_WAIT_FAILED);
+			glDeleteSync(fence);
+			_frameFences[frameIndex] = nullptr;
+		}
 
 		void SetDefault() {
 			glEnable(GL_DEPTH_TEST);
@@ -802,27 +1977,68 @@ namespace fsr {
 
 			glMatrixMode(GL_MODELVIEW);
 		}
+	protected:
+		bool Init() override {
+			if(!BaseRenderer::Init()) return(false);
+			CreateUniformRing();
+			if(!_stagingRing.Init()) {
+				fplConsoleFormatOut("Staging ring not supported, uploads are synchronous\n");
+			}
+			return(true);
+		}
 	public:
-		OpenGLRenderer(): BaseRenderer() {
-			_commandQueue = new	OpenGLCommandQueue(this);
+		OpenGLRenderer():
+			BaseRenderer(),
+			_stagingRing(this),
+			_frameFences(),
+			_uniformRingBufferId(BufferID {}) {
+			_commandQueue = new	OpenGLCommandQueue(this, &_stagingRing);
 			SetDefault();
 		}
 
 		~OpenGLRenderer() {
+			for(uint32_t frameIndex = 0; frameIndex < MaxFramesInFlight; ++frameIndex) {
+				if(_frameFences[frameIndex] != nullptr) {
+					glDeleteSync(_frameFences[frameIndex]);
+				}
+			}
+			if(_uniformRingBufferId.id != 0) {
+				DestroyBuffer(_uniformRingBufferId);
+			}
+			_stagingRing.Release();
 			delete _commandQueue;
 		}
 
 		BufferID CreateBuffer(const BufferType type, const BufferAccess access, const BufferUsage usage, const size_t size, const uint8_t *data) override {
-			BufferID id = BufferID { NextID() };
+			BufferID id = AllocateBufferID();
 			OpenGLBuffer *newBuffer = new OpenGLBuffer(id, type, access, usage, size);
-			if(!newBuffer->Init(data)) {
+			// Initial data goes through the staging ring as well
+			bool isStaged = data != nullptr && _stagingRing.IsAvailable();
+			if(!newBuffer->Init(isStaged ? nullptr : data)) {
 				delete newBuffer;
+				RemoveBuffer(id);
 				return(BufferID { 0 });
 			}
 			AddBuffer(newBuffer);
+			if(isStaged) {
+				WriteBuffer(id, 0, size, data);
+			}
 			return(id);
 		}
 
+		bool WriteBuffer(const BufferID bufferId, const size_t offset, const size_t size, const uint8_t *data) override {
+			Buffer *buffer = GetBuffer(bufferId);
+			if(buffer == nullptr || data == nullptr || size == 0 || offset + size > buffer->size) {
+				return(false);
+			}
+			if(!_stagingRing.StageBuffer(bufferId, offset, size, data)) {
+				// Pending copies into this buffer must not overwrite the newer data
+				_stagingRing.Flush();
+				buffer->Write(offset, size, data);
+			}
+			return(true);
+		}
+
 		void DestroyBuffer(const BufferID bufferId) override {
 			Buffer *buffer = RemoveBuffer(bufferId);
 			if(buffer != nullptr) {
@@ -832,16 +2048,22 @@ namespace fsr {
 		}
 
 		TextureID CreateTexture2D(const TextureFormat format, const uint32_t width, const uint32_t height, const uint8_t *data2D) override {
-			TextureID id = TextureID { NextID() };
-			OpenGLTexture *newTexture = new OpenGLTexture(id, TextureType::T2D, format, width, height, data2D);
+			TextureID id = AllocateTextureID();
+			OpenGLTexture *newTexture = new OpenGLTexture(id, TextureType::T2D, format, width, height);
 			AddTexture(newTexture);
+			if(data2D != nullptr) {
+				WriteTexture(id, newTexture->GetFaceSize(), data2D);
+			}
 			return(id);
 		}
 
 		TextureID CreateTextureCube(const TextureFormat format, const uint32_t faceWidth, const uint32_t faceHeight, const uint8_t *data2Dx6) override {
-			TextureID id = TextureID { NextID() };
-			OpenGLTexture *newTexture = new OpenGLTexture(id, TextureType::Cube, format, faceWidth, faceHeight, data2Dx6);
+			TextureID id = AllocateTextureID();
+			OpenGLTexture *newTexture = new OpenGLTexture(id, TextureType::Cube, format, faceWidth, faceHeight);
 			AddTexture(newTexture);
+			if(data2Dx6 != nullptr) {
+				WriteTexture(id, newTexture->GetFaceSize() * newTexture->GetFaceCount(), data2Dx6);
+			}
 			return(id);
 		}
 
@@ -852,6 +2074,30 @@ namespace fsr {
 			}
 		}
 
+		bool WriteTexture(const TextureID textureId, const size_t size, const uint8_t *data) override {
+			OpenGLTexture *texture = static_cast<OpenGLTexture *>(GetTexture(textureId));
+			if(texture == nullptr || data == nullptr) {
+				return(false);
+			}
+			size_t faceSize = texture->GetFaceSize();
+			if(size != faceSize * texture->GetFaceCount()) {
+				return(false);
+			}
+			// NOTE(final): Each face is staged on its own, so a cubemap does not need one contiguous block of the ring
+			for(uint32_t faceIndex = 0; faceIndex < texture->GetFaceCount(); ++faceIndex) {
+				const uint8_t *facePixels = data + faceSize * faceIndex;
+				if(!_stagingRing.StageTextureFace(textureId, faceIndex, faceSize, facePixels)) {
+					_stagingRing.Flush();
+					texture->WriteFace(faceIndex, facePixels);
+				}
+			}
+			return(true);
+		}
+
+		void FlushUploads() override {
+			_commandQueue->FlushUploads();
+		}
+
 		CommandQueue *GetCommandQueue() override {
 			return _commandQueue;
 		}
@@ -871,10 +2117,11 @@ namespace fsr {
 		}
 
 		FrameBufferID CreateFrameBuffer(const std::initializer_list<FrameBufferAttachment> &attachments, const uint32_t sampleCount) override {
-			FrameBufferID id = FrameBufferID { NextID() };
+			FrameBufferID id = AllocateRenderTargetID();
 			OpenGLRenderTarget *renderTarget = new OpenGLRenderTarget(id, sampleCount);
 			if(!renderTarget->Init(attachments)) {
 				delete renderTarget;
+				RemoveRenderTarget(id);
 				return(FrameBufferID { 0 });
 			}
 			AddRenderTarget(renderTarget);
@@ -891,7 +2138,7 @@ namespace fsr {
 		}
 
 		PipelineID CreatePipeline(const PipelineDescriptor &pipelineDesc) override {
-			PipelineID id = PipelineID { NextID() };
+			PipelineID id = AllocatePipelineID();
 			Pipeline *pipeline = new Pipeline(id);
 			pipeline->layoutId = pipelineDesc.layoutId;
 			pipeline->settings = pipelineDesc.settings;
@@ -912,13 +2159,488 @@ namespace fsr {
 		}
 
 		void Present() override {
+			// NOTE(final): The persistent uniform ring is written while the GPU may still read older regions, so each region is fenced before it gets reused
+			UniformRing &uniformRing = GetUniformRing();
+			_commandQueue->FlushUploads();
+			bool isFenced = glFenceSync != nullptr && _uniformShadowMemory.empty() && _uniformRingBufferId.id != 0;
+			if(isFenced) {
+				_frameFences[uniformRing.GetFrameIndex()] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			}
+			EndFrame(_commandQueue);
+			if(isFenced) {
+				WaitForFrameFence(uniformRing.GetFrameIndex());
+			}
 			fplVideoFlip();
 		}
 	};
 
+	//
+	// Null backend
+	// Accepts every resource and command without a graphics context, validates the command streams and counts the calls a real backend would issue.
+	//
+	struct NullBuffer: public Buffer {
+		std::vector<uint8_t> storage;
+		b32 isMapped;
+
+		NullBuffer(const BufferID id, const BufferType type, const BufferAccess access, const BufferUsage usage, const size_t size):
+			Buffer(id, type, access, usage, size),
+			isMapped(false) {
+		}
+
+		bool Init(const uint8_t *data) override {
+			if(type == BufferType::None || access == BufferAccess::None || usage == BufferUsage::None) {
+				return(false);
+			}
+			storage.resize(size);
+			if(data != nullptr && size > 0) {
+				std::memcpy(&storage[0], data, size);
+			}
+			return(true);
+		}
+
+		void Release() override {
+			storage.clear();
+		}
+
+		void Write(const size_t offset, const size_t size, const uint8_t *data) override {
+			assert(data != nullptr && (offset + size) <= storage.size());
+			if(data != nullptr && (offset + size) <= storage.size()) {
+				std::memcpy(&storage[offset], data, size);
+			}
+		}
+
+		void *Map() override {
+			assert(!isMapped);
+			isMapped = true;
+			void *result = storage.empty() ? nullptr : &storage[0];
+			return(result);
+		}
+
+		void Unmap() override {
+			assert(isMapped);
+			isMapped = false;
+		}
+	};
+
+	struct NullTexture: public Texture {
+		NullTexture(const TextureID id, const TextureType type, const TextureFormat format, const uint32_t width, const uint32_t height):
+			Texture(id, type, format, width, height) {
+		}
+
+		bool Write(const size_t size, const uint8_t *data) override {
+			size_t bytesPerPixel = format == TextureFormat::AlphaU8 ? sizeof(uint8_t) : (format == TextureFormat::RGBAU8 ? sizeof(uint8_t) * 4 : sizeof(float) * 4);
+			size_t faceCount = type == TextureType::Cube ? 6 : 1;
+			bool result = data != nullptr && size == (size_t)width * (size_t)height * bytesPerPixel * faceCount;
+			return(result);
+		}
+	};
+
+	struct NullRenderTarget: public FrameBuffer {
+		NullRenderTarget(const FrameBufferID &id, const uint32_t sampleCount):
+			FrameBuffer(id, sampleCount) {
+		}
+
+		bool Init(const std::initializer_list<FrameBufferAttachment> &attachments) override {
+			if(attachments.size() == 0) return(false); // No attachment
+			this->attachments.assign(attachments.begin(), attachments.end());
+			return(true);
+		}
+
+		void Release() override {
+			attachments.clear();
+		}
+	};
+
+	class NullCommandBuffer: public DefaultCommandBuffer {
+	public:
+		NullCommandBuffer(Renderer *renderer):
+			DefaultCommandBuffer(renderer) {
+		}
+	};
+
+	class NullCommandQueue: public DefaultCommandQueue {
+	private:
+		constexpr static size_t MaxReportedErrorCount = 32;
+		size_t reportedErrorCount;
+
+		// NOTE(final): Counts one call for each changed state, like a real backend would issue
+		inline void CountChange(const bool isChanged) {
+			if(isChanged) {
+				++stateCache.stats.apiCallCount;
+			}
+		}
+
+		bool ValidateSize(const char *message, const size_t size, const size_t expectedSize) {
+			if(size != expectedSize) {
+				ReportError(message);
+				return(false);
+			}
+			return(true);
+		}
+	protected:
+		void ExecuteCommand(PipelineSubmitState *submitState, const CommandType type, const uint8_t *data, const size_t size) override {
+			switch(type) {
+				case CommandType::SetViewport:
+				{
+					if(!ValidateSize("SetViewport: Invalid command size", size, sizeof(SetViewportCommand))) break;
+					const SetViewportCommand *cmd = (const SetViewportCommand *)data;
+					CountChange(stateCache.ChangeViewport(cmd->viewportRect));
+				} break;
+
+				case CommandType::SetScissor:
+				{
+					if(!ValidateSize("SetScissor: Invalid command size", size, sizeof(SetScissorCommand))) break;
+					const SetScissorCommand *cmd = (const SetScissorCommand *)data;
+					CountChange(stateCache.ChangeScissor(cmd->scissorRect));
+				} break;
+
+				case CommandType::BindPipeline:
+				{
+					if(!ValidateSize("BindPipeline: Invalid command size", size, sizeof(BindPipelineCommand))) break;
+					const BindPipelineCommand *cmd = (const BindPipelineCommand *)data;
+					Pipeline *pipeline = baseRenderer->GetPipeline(cmd->pipelineId);
+					if(pipeline == nullptr) {
+						ReportError("BindPipeline: Pipeline handle is invalid or was destroyed");
+						break;
+					}
+					submitState->activePipeline = pipeline;
+					const PipelineSettings &settings = pipeline->settings;
+					CountChange(stateCache.ChangeClearValue(settings.clear.value));
+					CountChange(stateCache.ChangeViewport(pipeline->viewport));
+					CountChange(stateCache.ChangeScissor(pipeline->scissor));
+					CountChange(stateCache.ChangeDepth(settings.depth));
+					CountChange(stateCache.ChangeBlend(settings.blend));
+					CountChange(stateCache.ChangeCullMode(settings.cullMode));
+					CountChange(stateCache.ChangePolygonMode(settings.polygonMode));
+				} break;
+
+				case CommandType::BindVertexBuffers:
+				case CommandType::BindIndexBuffers:
+				{
+					if(size < sizeof(BindBuffersCommand)) {
+						ReportError("BindBuffers: Invalid command size");
+						break;
+					}
+					const BindBuffersCommand *cmd = (const BindBuffersCommand *)data;
+					if(cmd->bufferCount == 0 || size != sizeof(BindBuffersCommand) + cmd->bufferCount * sizeof(BufferID)) {
+						ReportError("BindBuffers: Buffer count does not match the command size");
+						break;
+					}
+					if(cmd->bufferCount > 1) {
+						ReportError("BindBuffers: Only a single buffer per binding is supported");
+						break;
+					}
+					BufferType expectedType = type == CommandType::BindVertexBuffers ? BufferType::Vertex : BufferType::Index;
+					const BufferID *bufferIds = (const BufferID *)(data + sizeof(BindBuffersCommand));
+					bool isValid = true;
+					for(size_t bufferIndex = 0; bufferIndex < cmd->bufferCount; ++bufferIndex) {
+						const Buffer *buffer = baseRenderer->GetBuffer(bufferIds[bufferIndex]);
+						if(buffer == nullptr) {
+							ReportError("BindBuffers: Buffer handle is invalid or was destroyed");
+							isValid = false;
+						} else if(buffer->type != expectedType) {
+							ReportError("BindBuffers: Buffer type does not match the binding");
+							isValid = false;
+						}
+					}
+					if(!isValid) break;
+					if(type == CommandType::BindVertexBuffers) {
+						CountChange(stateCache.ChangeVertexBuffer(bufferIds[0]));
+						submitState->hasVertexBuffer = true;
+					} else {
+						CountChange(stateCache.ChangeIndexBuffer(bufferIds[0]));
+					}
+				} break;
+
+				case CommandType::BindUniformBuffer:
+				{
+					if(!ValidateSize("BindUniformBuffer: Invalid command size", size, sizeof(BindUniformBufferCommand))) break;
+					const BindUniformBufferCommand *cmd = (const BindUniformBufferCommand *)data;
+					const Buffer *buffer = baseRenderer->GetBuffer(cmd->bufferId);
+					if(cmd->binding >= MaxUniformBufferBindings) {
+						ReportError("BindUniformBuffer: Binding index is out of range");
+					} else if(buffer == nullptr) {
+						ReportError("BindUniformBuffer: Buffer handle is invalid or was destroyed");
+					} else if(buffer->type != BufferType::Uniform) {
+						ReportError("BindUniformBuffer: Buffer is not a uniform buffer");
+					} else if(cmd->size == 0 || cmd->offset + cmd->size > buffer->size) {
+						ReportError("BindUniformBuffer: Range exceeds the buffer");
+					} else if((cmd->offset % baseRenderer->GetUniformRing().GetAlignment()) != 0) {
+						ReportError("BindUniformBuffer: Offset is not aligned");
+					} else {
+						CountChange(stateCache.ChangeUniformBuffer(*cmd));
+					}
+				} break;
+
+				case CommandType::BeginRenderPass:
+				{
+					if(!ValidateSize("BeginRenderPass: Invalid command size", size, sizeof(BeginRenderPassCommand))) break;
+					const BeginRenderPassCommand *cmd = (const BeginRenderPassCommand *)data;
+					if(submitState->isInsideRenderPass) {
+						ReportError("BeginRenderPass: Previous render pass was not ended");
+						break;
+					}
+					if(cmd->renderTargetId.id != 0 && baseRenderer->GetRenderTarget(cmd->renderTargetId) == nullptr) {
+						ReportError("BeginRenderPass: Framebuffer handle is invalid or was destroyed");
+						break;
+					}
+					if(cmd->clearValueCount > BeginRenderPassCommand::MaxClearValueCount) {
+						ReportError("BeginRenderPass: Too many clear values");
+						break;
+					}
+					// Framebuffer bind and optional clear
+					stateCache.stats.apiCallCount += 1;
+					if(cmd->clearValueCount > 0) {
+						CountChange(stateCache.ChangeClearValue(cmd->clearValues[0]));
+						stateCache.stats.apiCallCount += 1;
+					}
+					submitState->isInsideRenderPass = true;
+				} break;
+
+				case CommandType::EndRenderPass:
+				{
+					if(!ValidateSize("EndRenderPass: Invalid command size", size, sizeof(EndRenderPassCommand))) break;
+					if(!submitState->isInsideRenderPass) {
+						ReportError("EndRenderPass: No render pass active");
+						break;
+					}
+					stateCache.stats.apiCallCount += 1;
+					submitState->isInsideRenderPass = false;
+				} break;
+
+				case CommandType::Draw:
+				{
+					if(!ValidateSize("Draw: Invalid command size", size, sizeof(DrawCommand))) break;
+					const DrawCommand *cmd = (const DrawCommand *)data;
+					if(submitState->activePipeline == nullptr) {
+						ReportError("Draw: No pipeline bound");
+					} else if(!submitState->hasVertexBuffer) {
+						ReportError("Draw: No vertex buffer bound");
+					} else if(cmd->vertexCount == 0 || cmd->instanceCount == 0) {
+						ReportError("Draw: Vertex or instance count is zero");
+					} else if(cmd->firstInstance != 0) {
+						ReportError("Draw: First instance is not supported");
+					} else if(cmd->instanceCount > 1) {
+						// NOTE(final): Validated against the GL 2.1 context of the application, where the OpenGL backend has no instanced draws
+						ReportError("Draw: Instanced draws are not supported");
+					} else {
+						stateCache.stats.apiCallCount += 1;
+						++stateCache.stats.drawCount;
+					}
+				} break;
+
+				default:
+					ReportError("Unknown command type");
+					break;
+			}
+		}
+
+		void EndCommandBuffer(PipelineSubmitState *submitState) override {
+			if(submitState->isInsideRenderPass) {
+				ReportError("Render pass was not ended in the same command buffer");
+				submitState->isInsideRenderPass = false;
+			}
+		}
+
+		void RejectCommandBuffer(const char *reason) override {
+			ReportError(reason);
+		}
+	public:
+		NullCommandQueue(BaseRenderer *renderer):
+			DefaultCommandQueue(renderer),
+			reportedErrorCount(0) {
+		}
+
+		void ReportError(const char *message) {
+			++stateCache.stats.validationErrorCount;
+			if(reportedErrorCount < MaxReportedErrorCount) {
+				fplConsoleFormatError("Null renderer validation error: %s\n", message);
+				if(++reportedErrorCount == MaxReportedErrorCount) {
+					fplConsoleFormatError("Null renderer validation error: Too many errors, further errors are only counted\n");
+				}
+			}
+		}
+	};
+
+	class NullRenderer: public BaseRenderer {
+	private:
+		// NOTE(final): There is no hardware limit, so we use the alignment of a std140 vec4
+		constexpr static size_t UniformAlignment = 16;
+		NullCommandQueue *_commandQueue;
+	protected:
+		bool Init() override {
+			if(!BaseRenderer::Init()) return(false);
+			BufferID ringBufferId = CreateBuffer(BufferType::Uniform, BufferAccess::WriteOnly, BufferUsage::Dynamic, UniformRingFrameSize * MaxFramesInFlight, nullptr);
+			NullBuffer *ringBuffer = static_cast<NullBuffer *>(GetBuffer(ringBufferId));
+			if(ringBuffer == nullptr) return(false);
+			InitUniformRing(ringBufferId, &ringBuffer->storage[0], UniformRingFrameSize, UniformAlignment);
+			return(true);
+		}
+	public:
+		NullRenderer(): BaseRenderer() {
+			_commandQueue = new NullCommandQueue(this);
+		}
+
+		~NullRenderer() {
+			delete _commandQueue;
+		}
+
+		BufferID CreateBuffer(const BufferType type, const BufferAccess access, const BufferUsage usage, const size_t size, const uint8_t *data) override {
+			BufferID id = AllocateBufferID();
+			NullBuffer *newBuffer = new NullBuffer(id, type, access, usage, size);
+			if(!newBuffer->Init(data)) {
+				_commandQueue->ReportError("CreateBuffer: Invalid buffer type, access or usage");
+				delete newBuffer;
+				RemoveBuffer(id);
+				return(BufferID { 0 });
+			}
+			AddBuffer(newBuffer);
+			return(id);
+		}
+
+		void DestroyBuffer(const BufferID bufferId) override {
+			Buffer *buffer = RemoveBuffer(bufferId);
+			if(buffer == nullptr) {
+				_commandQueue->ReportError("DestroyBuffer: Buffer handle is invalid or was already destroyed");
+				return;
+			}
+			buffer->Release();
+			delete buffer;
+		}
+
+		bool WriteBuffer(const BufferID bufferId, const size_t offset, const size_t size, const uint8_t *data) override {
+			Buffer *buffer = GetBuffer(bufferId);
+			if(buffer == nullptr) {
+				_commandQueue->ReportError("WriteBuffer: Buffer handle is invalid or was destroyed");
+				return(false);
+			}
+			if(data == nullptr || size == 0 || offset + size > buffer->size) {
+				_commandQueue->ReportError("WriteBuffer: Range exceeds the buffer");
+				return(false);
+			}
+			buffer->Write(offset, size, data);
+			return(true);
+		}
+
+		TextureID CreateTexture2D(const TextureFormat format, const uint32_t width, const uint32_t height, const uint8_t *data2D) override {
+			if(format == TextureFormat::None || width == 0 || height == 0) {
+				_commandQueue->ReportError("CreateTexture2D: Invalid format or size");
+				return(TextureID { 0 });
+			}
+			TextureID id = AllocateTextureID();
+			AddTexture(new NullTexture(id, TextureType::T2D, format, width, height));
+			return(id);
+		}
+
+		TextureID CreateTextureCube(const TextureFormat format, const uint32_t faceWidth, const uint32_t faceHeight, const uint8_t *data2Dx6) override {
+			if(format == TextureFormat::None || faceWidth == 0 || faceHeight == 0) {
+				_commandQueue->ReportError("CreateTextureCube: Invalid format or size");
+				return(TextureID { 0 });
+			}
+			TextureID id = AllocateTextureID();
+			AddTexture(new NullTexture(id, TextureType::Cube, format, faceWidth, faceHeight));
+			return(id);
+		}
+
+		void DestroyTexture(const TextureID textureId) override {
+			Texture *texture = RemoveTexture(textureId);
+			if(texture == nullptr) {
+				_commandQueue->ReportError("DestroyTexture: Texture handle is invalid or was already destroyed");
+				return;
+			}
+			delete texture;
+		}
+
+		bool WriteTexture(const TextureID textureId, const size_t size, const uint8_t *data) override {
+			Texture *texture = GetTexture(textureId);
+			if(texture == nullptr) {
+				_commandQueue->ReportError("WriteTexture: Texture handle is invalid or was destroyed");
+				return(false);
+			}
+			if(!texture->Write(size, data)) {
+				_commandQueue->ReportError("WriteTexture: Size does not match the texture");
+				return(false);
+			}
+			return(true);
+		}
+
+		void FlushUploads() override {
+		}
+
+		CommandQueue *GetCommandQueue() override {
+			return _commandQueue;
+		}
+
+		CommandBuffer *CreateCommandBuffer() override {
+			NullCommandBuffer *commandBuffer = new NullCommandBuffer(this);
+			AddCommandBuffer(commandBuffer);
+			return(commandBuffer);
+		}
+
+		void DestroyCommandBuffer(CommandBuffer *commandBuffer) override {
+			if(commandBuffer == nullptr) return;
+			RemoveCommandBuffer(commandBuffer);
+			delete commandBuffer;
+		}
+
+		FrameBufferID CreateFrameBuffer(const std::initializer_list<FrameBufferAttachment> &attachments, const uint32_t sampleCount) override {
+			FrameBufferID id = AllocateRenderTargetID();
+			NullRenderTarget *renderTarget = new NullRenderTarget(id, sampleCount);
+			if(!renderTarget->Init(attachments)) {
+				_commandQueue->ReportError("CreateFrameBuffer: No attachments");
+				delete renderTarget;
+				RemoveRenderTarget(id);
+				return(FrameBufferID { 0 });
+			}
+			AddRenderTarget(renderTarget);
+			return(id);
+		}
+
+		void DestroyFrameBuffer(const FrameBufferID renderTargetId) override {
+			FrameBuffer *renderTarget = RemoveRenderTarget(renderTargetId);
+			if(renderTarget == nullptr) {
+				_commandQueue->ReportError("DestroyFrameBuffer: Framebuffer handle is invalid or was already destroyed");
+				return;
+			}
+			renderTarget->Release();
+			delete renderTarget;
+		}
+
+		PipelineID CreatePipeline(const PipelineDescriptor &pipelineDesc) override {
+			PipelineID id = AllocatePipelineID();
+			Pipeline *pipeline = new Pipeline(id);
+			pipeline->layoutId = pipelineDesc.layoutId;
+			pipeline->settings = pipelineDesc.settings;
+			pipeline->primitive = pipelineDesc.primitive;
+			pipeline->frameBufferId = pipelineDesc.frameBuffertId;
+			pipeline->scissor = pipelineDesc.scissor;
+			pipeline->viewport = pipelineDesc.viewport;
+			pipeline->shaderProgramId = pipelineDesc.shaderProgramId;
+			AddPipeline(pipeline);
+			return(id);
+		}
+
+		void DestroyPipeline(const PipelineID pipelineId) override {
+			Pipeline *pipeline = RemovePipeline(pipelineId);
+			if(pipeline == nullptr) {
+				_commandQueue->ReportError("DestroyPipeline: Pipeline handle is invalid or was already destroyed");
+				return;
+			}
+			delete pipeline;
+		}
+
+		void Present() override {
+			EndFrame(_commandQueue);
+		}
+	};
+
 	Renderer *Renderer::Create(const RendererType type) {
 		Renderer *result = nullptr;
 		switch(type) {
+			case RendererType::Null:
+				result = new NullRenderer();
+				break;
+
 			case RendererType::OpenGL:
 				result = new OpenGLRenderer();
 				break;
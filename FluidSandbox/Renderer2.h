@@ -43,6 +43,19 @@ namespace fsr {
 		}
 	};
 
+	// Slice of the uniform ring of the current frame, the memory stays valid until the frame is presented
+	struct UniformAllocation {
+		BufferID bufferId;
+		size_t offset;
+		size_t size;
+		// Write-only pointer to the slice, null when the ring is full or not supported
+		void *data;
+	};
+
+	static constexpr uint32_t MaxUniformBufferBindings = 8;
+	static constexpr uint32_t MaxFramesInFlight = 3;
+	static constexpr size_t UniformRingFrameSize = 4 * 1024 * 1024;
+
 	class Buffer {
 	public:
 		size_t size;
@@ -59,6 +72,7 @@ namespace fsr {
 			size(size) {
 		}
 	public:
+		virtual ~Buffer() {}
 		virtual bool Init(const uint8_t *data) = 0;
 		virtual void Release() = 0;
 
@@ -110,13 +124,14 @@ namespace fsr {
 		const TextureID id;
 	protected:
 		Texture(const TextureID &id, const TextureType type, const TextureFormat format, const uint32_t width, const uint32_t height):
-			width(0),
-			height(0),
+			width(width),
+			height(height),
 			id(id),
 			format(format),
 			type(type) {
 		}
 	public:
+		virtual ~Texture() {}
 		virtual bool Write(const size_t size, const uint8_t *data) = 0;
 	};
 
@@ -156,6 +171,7 @@ namespace fsr {
 			sampleCount(sampleCount) {
 		}
 	public:
+		virtual ~FrameBuffer() {}
 		virtual bool Init(const std::initializer_list<FrameBufferAttachment> &attachments) = 0;
 		virtual void Release() = 0;
 	};
@@ -542,39 +558,95 @@ namespace fsr {
 		OpenGL
 	};
 
+	struct CommandBufferMemoryStats {
+		size_t chunkCount;
+		size_t reservedBytes;
+		size_t usedBytes;
+		// Total number of chunk allocations over the lifetime of the command buffer
+		size_t allocationCount;
+	};
+
 	class CommandBuffer {
 	public:
+		virtual ~CommandBuffer() {}
 		virtual bool Begin() = 0;
 		virtual void End() = 0;
+		// Discards all recorded commands without submitting them
+		virtual void Reset() = 0;
+		virtual CommandBufferMemoryStats GetMemoryStats() const = 0;
 		virtual void BindPipeline(const PipelineID &pipelineId) = 0;
 		virtual void SetViewport(const float x, const float y, const float width, const float height, const float minDepth = 0.0f, const float maxDepth = 1.0f) = 0;
 		virtual void SetScissor(const int x, const int y, const int width, const int height) = 0;
 		virtual void BindVertexBuffers(const std::initializer_list<const BufferID> &ids) = 0;
 		virtual void BindIndexBuffers(const std::initializer_list<const BufferID> &ids) = 0;
+		// Binds a range of a uniform buffer to the binding point, the offset must be aligned to the uniform offset alignment of the renderer
+		virtual void BindUniformBuffer(const uint32_t binding, const BufferID &bufferId, const size_t offset, const size_t size) = 0;
+		// Copies the data into the uniform ring of the current frame and binds it, returns false when the ring is full
+		virtual bool PushUniforms(const uint32_t binding, const void *data, const size_t size) = 0;
 		virtual void BeginRenderPass(const RenderPassID &renderPassId, const FrameBufferID &frameBufferId, const RenderArea *renderArea, const std::initializer_list<const ClearValue> &clearValues) = 0;
 		virtual void EndRenderPass() = 0;
 		virtual void Draw(const size_t vertexCount, const size_t firstVertex = 0, const size_t instanceCount = 1, const size_t firstInstance = 0) = 0;
 	};
 
+	struct CommandQueueStats {
+		// Number of submitted command buffers
+		size_t submitCount;
+		// Number of executed commands
+		size_t commandCount;
+		// Number of executed draw commands
+		size_t drawCount;
+		// Number of calls issued to the graphics API (The null backend counts the calls a real backend would issue for changed states)
+		size_t apiCallCount;
+		// Number of calls skipped, because the state was already applied
+		size_t skippedCallCount;
+		// Number of invalid commands or resource operations, only detected by the null backend
+		size_t validationErrorCount;
+		// Number of bytes allocated from the uniform ring, including the alignment padding
+		size_t uniformBytes;
+		// Number of bytes uploaded through the staging ring
+		size_t uploadBytes;
+		// Number of times the staging ring was full and had to wait for the GPU
+		size_t uploadWaitCount;
+	};
+
 	class CommandQueue {
 	public:
+		virtual ~CommandQueue() {}
+		virtual CommandQueueStats GetStats() const = 0;
+		virtual void ResetStats() = 0;
+		// Forces the next submit to apply all states again, required when the graphics state was changed outside of the queue
+		virtual void InvalidateState() = 0;
+
 		virtual bool Submit(CommandBuffer &commandBuffer) = 0;
+		// Submits the command buffers in array order, regardless in which order or on which thread they were recorded
+		virtual bool Submit(CommandBuffer *const *commandBuffers, const size_t count) = 0;
 	};
 
+	// NOTE(final): A command buffer must only be recorded by one thread at a time, but different command buffers can be recorded concurrently.
+	// Creating, destroying and submitting command buffers must be done on the thread which owns the renderer.
+	typedef void (RecordCommandBufferFunc)(CommandBuffer &commandBuffer, const size_t index, void *userData);
+
 	class Renderer {
 	protected:
 		virtual bool Init() = 0;
 		virtual void Release() = 0;
 	public:
+		virtual ~Renderer() {}
+
 		static Renderer *Create(const RendererType type);
 
 		virtual CommandQueue *GetCommandQueue() = 0;
 
 		virtual CommandBuffer *CreateCommandBuffer() = 0;
 		virtual void DestroyCommandBuffer(CommandBuffer *commandBuffer) = 0;
+		// Begins, records and ends each command buffer on up to maxThreadCount threads (including the calling thread) and waits until all are recorded.
+		// The worker threads are started once with the renderer and only woken up for each call.
+		virtual void RecordCommandBuffers(CommandBuffer *const *commandBuffers, const size_t count, RecordCommandBufferFunc *recordFunc, void *userData, const size_t maxThreadCount) = 0;
 
 		virtual BufferID CreateBuffer(const BufferType type, const BufferAccess access, const BufferUsage usage, const size_t size, const uint8_t *data) = 0;
 		virtual void DestroyBuffer(const BufferID bufferId) = 0;
+		// Copies the data immediately, but the upload into the buffer may be deferred until the next submit
+		virtual bool WriteBuffer(const BufferID bufferId, const size_t offset, const size_t size, const uint8_t *data) = 0;
 
 		virtual FrameBufferID CreateFrameBuffer(const std::initializer_list<FrameBufferAttachment> &attachments, const uint32_t sampleCount) = 0;
 		virtual void DestroyFrameBuffer(const FrameBufferID renderTargetId) = 0;
@@ -585,8 +657,19 @@ namespace fsr {
 		virtual TextureID CreateTexture2D(const TextureFormat format, const uint32_t width, const uint32_t height, const uint8_t *data2D) = 0;
 		virtual TextureID CreateTextureCube(const TextureFormat format, const uint32_t faceWidth, const uint32_t faceHeight, const uint8_t *data2Dx6) = 0;
 		virtual void DestroyTexture(const TextureID textureId) = 0;
+		// Replaces all pixels (all six faces for cubemaps), the upload may be deferred until the next submit
+		virtual bool WriteTexture(const TextureID textureId, const size_t size, const uint8_t *data) = 0;
+
+		// Issues all deferred uploads now, submits and presents do that automatically
+		virtual void FlushUploads() = 0;
+
+		// Allocates a aligned slice from the uniform ring of the current frame, can be called from any recording thread
+		virtual UniformAllocation AllocateUniforms(const size_t size) = 0;
 
 		virtual void Present() = 0;
+
+		// Statistics of the last presented frame
+		virtual CommandQueueStats GetFrameStats() const = 0;
 	};
 
 };
\ No newline at end of file
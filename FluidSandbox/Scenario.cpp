@@ -10,12 +10,16 @@
 #include "Scenario.h"
 
 #include <iostream>
+#include <assert.h>
+#include <string.h>
 
 #include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
 
 #include <final_xml.h>
 
 #include "OSLowLevel.h"
+#include "AssetPack.h"
 #include "XMLUtils.h"
 #include "Utils.h"
 #include "AllActors.hpp"
@@ -28,10 +32,19 @@ Scenario::Scenario() {
 	this->sim = FluidSimulationProperties();
 	this->render = FluidRenderProperties();
 	this->gravity = glm::vec3(0.0f, -9.8f, 0.0f);
+	this->mapping = {};
 }
 
 
 Scenario::~Scenario(void) {
+	if(mapping.data != nullptr) {
+		// Templates are owned by the mapping
+		fluids.clear();
+		bodies.clear();
+		COSLowLevel::unmapFile(&mapping);
+		return;
+	}
+
 	for(size_t i = 0; i < fluids.size(); i++) {
 		const FluidActor *fluid = fluids[i];
 		delete fluid;
@@ -45,185 +58,419 @@ Scenario::~Scenario(void) {
 	bodies.clear();
 }
 
-Scenario *Scenario::load(const char *filePath, CScene *scene) {
-	if(COSLowLevel::fileExists(filePath)) {
-		std::cout << "  Load scenario from file '" << filePath << "'" << std::endl;
+static Actor *ParseActor(XMLUtils &xmlUtils, const fxmlTag *actorNode, CScene *scene) {
+	std::string type = xmlUtils.getAttribute(actorNode, "type", "");
+	ActorMovementType atype = Utils::toActorMovementType(type.c_str());
 
-		// Load file content
-		std::string xml = COSLowLevel::getTextFileContent(filePath);
+	std::string primitive = xmlUtils.getAttribute(actorNode, "primitive", "");
 
-		// Parse XML
-		fxmlContext ctx = FXML_ZERO_INIT;
-		fxmlTag root = FXML_ZERO_INIT;
-		size_t xmlLen = xml.length();
-		if(!fxmlInitFromMemory(xml.c_str(), xmlLen, &ctx)) {
-			std::cerr << "Failed initialize XML context with xml length of " << xml << std::endl;
-			return nullptr;
-		}
-		if(!fxmlParse(&ctx, &root)) {
-			std::cerr << "Failed to parse XML file '" << filePath << "'!" << std::endl;
-			return(nullptr);
-		}
+	glm::vec3 pos = xmlUtils.getAttributeVec3(actorNode, "pos", glm::vec3(0.0f));
 
-		const fxmlTag *rootNode = fxmlFindTagByName(&root, "Scenario");
-		if(!rootNode) {
-			fxmlFree(&ctx);
-			return(nullptr);
-		}
+	glm::vec3 extents = xmlUtils.getAttributeVec3(actorNode, "extents", glm::vec3(0));
+	if(glm::length(extents) == 0) {
+		glm::vec3 size = xmlUtils.getAttributeVec3(actorNode, "size", glm::vec3(0));
+		extents = size * 0.5f;
+	}
 
-		VariableManager varMng = VariableManager();
+	glm::vec4 color = xmlUtils.getAttributeVec4(actorNode, "color", glm::vec4(1, 1, 1, 1));
+	glm::vec3 velocity = xmlUtils.getAttributeVec3(actorNode, "vel", glm::vec3(0.0f));
+
+	// TODO(final): Change scenario format to degrees instead and convert it to radians here!
+	glm::vec3 eulerRotation = xmlUtils.getAttributeVec3(actorNode, "rot", glm::vec3(0.0f));
+
+	bool defaultBlending = (atype == ActorMovementType::Static);
+
+	int actorTime = xmlUtils.getAttributeS32(actorNode, "time", 0);
+	float density = xmlUtils.getAttributeFloat(actorNode, "density", scene->defaultActorDensity);
+	float radius = xmlUtils.getAttributeFloat(actorNode, "radius", 0.5f);
+	float halfHeight = xmlUtils.getAttributeFloat(actorNode, "halfHeight", 0.5f);
+	bool visible = xmlUtils.getAttributeBool(actorNode, "visible", true);
+	bool blending = xmlUtils.getAttributeBool(actorNode, "blending", defaultBlending);
+	bool particleDrain = xmlUtils.getAttributeBool(actorNode, "particleDrain", false);
+
+	Actor *newBody = nullptr;
+	if(strcmp(primitive.c_str(), "cube") == 0) {
+		newBody = new CubeActor(atype, extents);
+	} else if(strcmp(primitive.c_str(), "sphere") == 0) {
+		newBody = new SphereActor(atype, radius);
+	} else if(strcmp(primitive.c_str(), "capsule") == 0) {
+		newBody = new CapsuleActor(atype, radius, halfHeight);
+	} else {
+		std::cerr << "    Actor primitive type '" << primitive << "' is not valid!" << std::endl;
+	}
 
-		const fxmlTag *varsNode = fxmlFindTagByName(rootNode, "Variables");
-		if(varsNode) {
-			varMng.Parse(varsNode);
-		}
+	if(newBody != nullptr) {
+		newBody->transform.position = pos;
+		newBody->transform.rotation = glm::quat(eulerRotation);
+		newBody->time = actorTime;
+		newBody->color = color;
+		newBody->density = density;
+		newBody->velocity = velocity;
+		newBody->visible = visible;
+		newBody->blending = blending;
+		newBody->particleDrain = particleDrain;
+		newBody->isTemplate = true;
+	}
+	return(newBody);
+}
 
-		XMLUtils xmlUtils = XMLUtils(&varMng);
+static FluidActor *ParseFluid(XMLUtils &xmlUtils, const fxmlTag *fluidNode) {
+	std::string fluidTypeStr = xmlUtils.getAttribute(fluidNode, "type", "blob");
+	FluidType fluidType = Utils::toFluidType(fluidTypeStr.c_str());
+	glm::vec3 pos = xmlUtils.getAttributeVec3(fluidNode, "pos", glm::vec3(0.0f));
+	glm::vec3 size = xmlUtils.getAttributeVec3(fluidNode, "size", glm::vec3(0.0f));
+	glm::vec3 velocity = xmlUtils.getAttributeVec3(fluidNode, "vel", glm::vec3(0.0f));
+	int fluidTime = xmlUtils.getAttributeS32(fluidNode, "time", 0);
+	float radius = xmlUtils.getAttributeFloat(fluidNode, "radius", 0.0);
+	bool isEmitter = xmlUtils.getAttributeBool(fluidNode, "isEmitter", false);
+	float emitterRate = xmlUtils.getAttributeFloat(fluidNode, "emitterRate", 0.0);
+	float emitterTime = emitterRate > 0.0f ? 1000.0f / emitterRate : 0.0f;
+	uint32_t emitterDuration = xmlUtils.getAttributeU32(fluidNode, "emitterDuration", 0);
+	uint32_t emitterCoolDown = xmlUtils.getAttributeU32(fluidNode, "emitterCoolDown", 0);
+	FluidActor *fluidCon = new FluidActor(size, radius, fluidType);
+	fluidCon->transform.position = pos;
+	fluidCon->velocity = velocity;
+	fluidCon->time = fluidTime;
+	fluidCon->radius = radius;
+	fluidCon->isEmitter = isEmitter;
+	fluidCon->emitterRate = emitterRate;
+	fluidCon->emitterTime = emitterTime;
+	fluidCon->emitterDuration = emitterDuration;
+	fluidCon->emitterCoolDown = emitterCoolDown;
+	fluidCon->isTemplate = true;
+	return(fluidCon);
+}
 
-		Scenario *newScenario = new Scenario();
+//
+// Generators
+//
+// A generator repeats all its children (actors, fluids or other generators) in its own instance frames:
+//   <Repeat count="10" offset="0.5, 0, 0" pos="0, 0, 0">: Instance i is moved by i * offset
+//   <Grid count="8, 1, 8" spacing="1, 1, 1" pos="0, 0, 0">: Instances on a grid which is centered on pos
+//   <Ring count="12" radius="4" pos="0, 0, 0">: Instances on a circle in the XZ plane around pos, each rotated around the Y axis to face outwards
+// Positions, rotations and velocities of the children are relative to the instance frame, so generators can be nested.
+//
+// Every actor gets a stable id from the path of its element and the instance indices of its generators.
+// An element is identified by its optional id attribute or otherwise by its position within its parent element.
+//
+constexpr uint64_t ScenarioActorIdSeed = 0xCBF29CE484222325ULL;
+
+enum class GeneratorType {
+	None = 0,
+	Repeat,
+	Grid,
+	Ring
+};
+
+static GeneratorType GetGeneratorType(const fxmlTag *node) {
+	if(strcmp(node->name, "Repeat") == 0)
+		return GeneratorType::Repeat;
+	else if(strcmp(node->name, "Grid") == 0)
+		return GeneratorType::Grid;
+	else if(strcmp(node->name, "Ring") == 0)
+		return GeneratorType::Ring;
+	return GeneratorType::None;
+}
 
-		// Name
-		const fxmlTag *nameNode = fxmlFindTagByName(rootNode, "Name");
-		if(nameNode) {
-			strcpy_s(newScenario->displayName, sizeof(newScenario->displayName), nameNode->value);
-		}
+static uint32_t ToCount(const float value) {
+	return value > 0.0f ? (uint32_t)(value + 0.5f) : 0;
+}
 
-		// Gravity
-		newScenario->gravity = xmlUtils.getNodeVec3(rootNode, "Gravity", glm::vec3(0.0f, -9.8f, 0.0f));
-
-		// Fluid properties
-		const fxmlTag *fpNode = fxmlFindTagByName(rootNode, "FluidProperties");
-		if(fpNode) {
-			float particleRadius = xmlUtils.getNodeFloat(fpNode, "ParticleRadius", scene->sim.particleRadius);
-			float particleDistanceFactor = xmlUtils.getNodeFloat(fpNode, "ParticleDistanceFactor", scene->sim.particleDistanceFactor);
-
-			newScenario->sim = FluidSimulationProperties::Compute(particleRadius, particleDistanceFactor);
-			newScenario->render = scene->render;
-
-			newScenario->sim.viscosity = xmlUtils.getNodeFloat(fpNode, "Viscosity", scene->sim.viscosity);
-			newScenario->sim.stiffness = xmlUtils.getNodeFloat(fpNode, "Stiffness", scene->sim.stiffness);
-			newScenario->sim.restitution = xmlUtils.getNodeFloat(fpNode, "Restitution", scene->sim.restitution);
-			newScenario->sim.damping = xmlUtils.getNodeFloat(fpNode, "Damping", scene->sim.damping);
-			newScenario->sim.dynamicFriction = xmlUtils.getNodeFloat(fpNode, "DynamicFriction", scene->sim.dynamicFriction);
-			newScenario->sim.maxMotionDistance = xmlUtils.getNodeFloat(fpNode, "MaxMotionDistance", scene->sim.maxMotionDistance);
-			newScenario->sim.restOffset = xmlUtils.getNodeFloat(fpNode, "RestOffset", scene->sim.restOffset);
-			newScenario->sim.contactOffset = xmlUtils.getNodeFloat(fpNode, "ContactOffset", scene->sim.contactOffset);
-			newScenario->sim.particleMass = xmlUtils.getNodeFloat(fpNode, "ParticleMass", scene->sim.particleMass);
-
-			newScenario->render.particleRenderFactor = xmlUtils.getNodeFloat(fpNode, "ParticleRenderFactor", scene->render.particleRenderFactor);
-			newScenario->render.minDensity = xmlUtils.getNodeFloat(fpNode, "ParticleMinDensity", scene->render.minDensity);
-		} else {
-			newScenario->sim = scene->sim;
-			newScenario->render = scene->render;
-		}
+static glm::uvec3 GetGridCount(XMLUtils &xmlUtils, const fxmlTag *node) {
+	glm::vec3 count = xmlUtils.getAttributeVec3(node, "count", glm::vec3(1.0f));
+	return glm::uvec3(ToCount(count.x), ToCount(count.y), ToCount(count.z));
+}
 
-		// Actor properties
-		const fxmlTag *apNode = fxmlFindTagByName(rootNode, "ActorProperties");
-		if(apNode) {
-			newScenario->actorCreatePosition = xmlUtils.getNodeVec3(apNode, "CreatePosition", glm::vec3(0.0f));
+static size_t GetGeneratorCount(XMLUtils &xmlUtils, const fxmlTag *node, const GeneratorType type) {
+	switch(type) {
+		case GeneratorType::Repeat:
+		case GeneratorType::Ring:
+			return xmlUtils.getAttributeU32(node, "count", 1);
+		case GeneratorType::Grid:
+		{
+			glm::uvec3 count = GetGridCount(xmlUtils, node);
+			return (size_t)count.x * (size_t)count.y * (size_t)count.z;
 		}
+		default:
+			return(0);
+	}
+}
 
-		// Actors
-		const fxmlTag *actorsNode = fxmlFindTagByName(rootNode, "Actors");
-		if(actorsNode) {
-			std::vector<const fxmlTag *> actors = xmlUtils.getChilds(actorsNode, "Actor");
-			for(auto p = actors.begin(); p != actors.end(); ++p) {
-				const fxmlTag *actorNode = *p;
+static void GetGeneratorInstances(XMLUtils &xmlUtils, const fxmlTag *node, const GeneratorType type, std::vector<ActorTransform> &outInstances) {
+	glm::vec3 pos = xmlUtils.getAttributeVec3(node, "pos", glm::vec3(0.0f));
+	glm::quat identity = glm::quat(glm::vec3(0.0f));
+	outInstances.reserve(GetGeneratorCount(xmlUtils, node, type));
+	switch(type) {
+		case GeneratorType::Repeat:
+		{
+			uint32_t count = xmlUtils.getAttributeU32(node, "count", 1);
+			glm::vec3 offset = xmlUtils.getAttributeVec3(node, "offset", glm::vec3(0.0f));
+			for(uint32_t i = 0; i < count; ++i)
+				outInstances.push_back(ActorTransform(pos + offset * (float)i, identity));
+		} break;
+
+		case GeneratorType::Grid:
+		{
+			glm::uvec3 count = GetGridCount(xmlUtils, node);
+			glm::vec3 spacing = xmlUtils.getAttributeVec3(node, "spacing", glm::vec3(1.0f));
+			glm::vec3 start = pos - spacing * (glm::vec3(count) - glm::vec3(1.0f)) * 0.5f;
+			for(uint32_t y = 0; y < count.y; ++y) {
+				for(uint32_t z = 0; z < count.z; ++z) {
+					for(uint32_t x = 0; x < count.x; ++x)
+						outInstances.push_back(ActorTransform(start + spacing * glm::vec3(x, y, z), identity));
+				}
+			}
+		} break;
+
+		case GeneratorType::Ring:
+		{
+			uint32_t count = xmlUtils.getAttributeU32(node, "count", 1);
+			float radius = xmlUtils.getAttributeFloat(node, "radius", 1.0f);
+			for(uint32_t i = 0; i < count; ++i) {
+				float angle = glm::two_pi<float>() * (float)i / (float)count;
+				glm::quat rotation = glm::angleAxis(angle, glm::vec3(0.0f, 1.0f, 0.0f));
+				outInstances.push_back(ActorTransform(pos + rotation * glm::vec3(radius, 0.0f, 0.0f), rotation));
+			}
+		} break;
 
-				std::string type = xmlUtils.getAttribute(actorNode, "type", "");
-				ActorMovementType atype = Utils::toActorMovementType(type.c_str());
+		default:
+			break;
+	}
+}
 
-				std::string primitive = xmlUtils.getAttribute(actorNode, "primitive", "");
+// Upper bound of actors the children of the node are expanded to, used to preallocate the actor lists
+static size_t CountActors(XMLUtils &xmlUtils, const fxmlTag *parentNode, const char *actorName) {
+	size_t result = 0;
+	for(const fxmlTag *child = parentNode->firstChild; child != nullptr; child = child->nextSibling) {
+		if(child->type != fxmlTagType_Element)
+			continue;
+		if(strcmp(child->name, actorName) == 0) {
+			++result;
+		} else {
+			GeneratorType type = GetGeneratorType(child);
+			if(type != GeneratorType::None)
+				result += GetGeneratorCount(xmlUtils, child, type) * CountActors(xmlUtils, child, actorName);
+		}
+	}
+	return(result);
+}
 
-				glm::vec3 pos = xmlUtils.getAttributeVec3(actorNode, "pos", glm::vec3(0.0f));
+static uint64_t CombineActorId(const uint64_t parentId, const uint64_t key) {
+	// FNV-1a of the key bytes, continued from the parent id
+	uint64_t result = parentId;
+	for(int i = 0; i < 8; ++i) {
+		result ^= (key >> (i * 8)) & 0xFF;
+		result *= 0x100000001B3ULL;
+	}
+	return(result);
+}
 
-				glm::vec3 extents = xmlUtils.getAttributeVec3(actorNode, "extents", glm::vec3(0));
-				if(glm::length(extents) == 0) {
-					glm::vec3 size = xmlUtils.getAttributeVec3(actorNode, "size", glm::vec3(0));
-					extents = size * 0.5f;
-				}
+static uint64_t GetElementId(XMLUtils &xmlUtils, const fxmlTag *node, const uint64_t parentId, const uint64_t elementIndex) {
+	std::string name = xmlUtils.getAttribute(node, "id", "");
+	if(name.empty())
+		return CombineActorId(parentId, elementIndex);
+	uint64_t result = parentId;
+	for(size_t i = 0; i < name.size(); ++i) {
+		result ^= (uint8_t)name[i];
+		result *= 0x100000001B3ULL;
+	}
+	return(result);
+}
 
-				glm::vec4 color = xmlUtils.getAttributeVec4(actorNode, "color", glm::vec4(1, 1, 1, 1));
-				glm::vec3 velocity = xmlUtils.getAttributeVec3(actorNode, "vel", glm::vec3(0.0f));
-
-				// TODO(final): Change scenario format to degrees instead and convert it to radians here!
-				glm::vec3 eulerRotation = xmlUtils.getAttributeVec3(actorNode, "rot", glm::vec3(0.0f));
-
-				bool defaultBlending = (atype == ActorMovementType::Static);
-
-				int actorTime = xmlUtils.getAttributeS32(actorNode, "time", 0);
-				float density = xmlUtils.getAttributeFloat(actorNode, "density", scene->defaultActorDensity);
-				float radius = xmlUtils.getAttributeFloat(actorNode, "radius", 0.5f);
-				float halfHeight = xmlUtils.getAttributeFloat(actorNode, "halfHeight", 0.5f);
-				bool visible = xmlUtils.getAttributeBool(actorNode, "visible", true);
-				bool blending = xmlUtils.getAttributeBool(actorNode, "blending", defaultBlending);
-				bool particleDrain = xmlUtils.getAttributeBool(actorNode, "particleDrain", false);
-
-				Actor *newBody = nullptr;
-				if(strcmp(primitive.c_str(), "cube") == 0) {
-					newBody = new CubeActor(atype, extents);
-				} else if(strcmp(primitive.c_str(), "sphere") == 0) {
-					newBody = new SphereActor(atype, radius);
-				} else if(strcmp(primitive.c_str(), "capsule") == 0) {
-					newBody = new CapsuleActor(atype, radius, halfHeight);
-				} else {
-					std::cerr << "    Actor primitive type '" << primitive << "' is not valid!" << std::endl;
-				}
+static void TransformActor(Actor *actor, const ActorTransform &frame) {
+	actor->transform.position = frame.position + frame.rotation * actor->transform.position;
+	actor->transform.rotation = frame.rotation * actor->transform.rotation;
+	actor->velocity = frame.rotation * actor->velocity;
+}
 
-				if(newBody != nullptr) {
-					newBody->transform.position = pos;
-					newBody->transform.rotation = glm::quat(eulerRotation);
-					newBody->time = actorTime;
-					newBody->color = color;
-					newBody->density = density;
-					newBody->velocity = velocity;
-					newBody->visible = visible;
-					newBody->blending = blending;
-					newBody->particleDrain = particleDrain;
-					newBody->isTemplate = true;
-					newScenario->bodies.push_back(newBody);
-				}
+static Actor *CloneActor(const Actor *source) {
+	switch(source->type) {
+		case ActorType::Cube:
+			return new CubeActor(*(const CubeActor *)source);
+		case ActorType::Sphere:
+			return new SphereActor(*(const SphereActor *)source);
+		case ActorType::Capsule:
+			return new CapsuleActor(*(const CapsuleActor *)source);
+		default:
+			assert(!"Unsupported actor type");
+			return(nullptr);
+	}
+}
+
+static FluidActor *CloneActor(const FluidActor *source) {
+	return new FluidActor(*source);
+}
 
+// The children of a generator are expanded once into the list, then cloned for every other instance and finally moved into the first instance frame.
+// The lists of the scenario hold const templates, but all actors from first on were just created here and are still modified in place.
+template<typename TActor>
+static void ExpandGenerator(XMLUtils &xmlUtils, const fxmlTag *node, const GeneratorType type, const size_t first, std::vector<const TActor *> &actors) {
+	size_t last = actors.size();
+	std::vector<ActorTransform> instances;
+	GetGeneratorInstances(xmlUtils, node, type, instances);
+	if(instances.empty()) {
+		for(size_t i = first; i < last; ++i)
+			delete actors[i];
+		actors.resize(first);
+		return;
+	}
+	for(size_t instanceIndex = 1; instanceIndex < instances.size(); ++instanceIndex) {
+		for(size_t i = first; i < last; ++i) {
+			TActor *clone = CloneActor(actors[i]);
+			TransformActor(clone, instances[instanceIndex]);
+			clone->id = CombineActorId(actors[i]->id, instanceIndex);
+			actors.push_back(clone);
+		}
+	}
+	for(size_t i = first; i < last; ++i) {
+		TActor *actor = const_cast<TActor *>(actors[i]);
+		TransformActor(actor, instances[0]);
+		actor->id = CombineActorId(actor->id, 0);
+	}
+}
+
+static void ExpandActors(XMLUtils &xmlUtils, const fxmlTag *parentNode, const uint64_t parentId, CScene *scene, std::vector<const Actor *> &bodies) {
+	uint64_t elementIndex = 0;
+	for(const fxmlTag *child = parentNode->firstChild; child != nullptr; child = child->nextSibling) {
+		if(child->type != fxmlTagType_Element)
+			continue;
+		uint64_t id = GetElementId(xmlUtils, child, parentId, elementIndex++);
+		if(strcmp(child->name, "Actor") == 0) {
+			Actor *newBody = ParseActor(xmlUtils, child, scene);
+			if(newBody != nullptr) {
+				newBody->id = id;
+				bodies.push_back(newBody);
+			}
+		} else {
+			GeneratorType type = GetGeneratorType(child);
+			if(type != GeneratorType::None) {
+				size_t first = bodies.size();
+				ExpandActors(xmlUtils, child, id, scene, bodies);
+				ExpandGenerator(xmlUtils, child, type, first, bodies);
 			}
 		}
+	}
+}
 
-		// Fluids
-		const fxmlTag *fluidsNode = fxmlFindTagByName(rootNode, "Fluids");
-		if(fluidsNode) {
-			std::vector<const fxmlTag *> fluids = xmlUtils.getChilds(fluidsNode, "Fluid");
-			for(auto p = fluids.begin(); p != fluids.end(); ++p) {
-				const fxmlTag *fluidNode = *p;
-				std::string fluidTypeStr = xmlUtils.getAttribute(fluidNode, "type", "blob");
-				FluidType fluidType = Utils::toFluidType(fluidTypeStr.c_str());
-				glm::vec3 pos = xmlUtils.getAttributeVec3(fluidNode, "pos", glm::vec3(0.0f));
-				glm::vec3 size = xmlUtils.getAttributeVec3(fluidNode, "size", glm::vec3(0.0f));
-				glm::vec3 velocity = xmlUtils.getAttributeVec3(fluidNode, "vel", glm::vec3(0.0f));
-				int fluidTime = xmlUtils.getAttributeS32(fluidNode, "time", 0);
-				float radius = xmlUtils.getAttributeFloat(fluidNode, "radius", 0.0);
-				bool isEmitter = xmlUtils.getAttributeBool(fluidNode, "isEmitter", false);
-				float emitterRate = xmlUtils.getAttributeFloat(fluidNode, "emitterRate", 0.0);
-				float emitterTime = emitterRate > 0.0f ? 1000.0f / emitterRate : 0.0f;
-				uint32_t emitterDuration = xmlUtils.getAttributeU32(fluidNode, "emitterDuration", 0);
-				uint32_t emitterCoolDown = xmlUtils.getAttributeU32(fluidNode, "emitterCoolDown", 0);
-				FluidActor *fluidCon = new FluidActor(size, radius, fluidType);
-				fluidCon->transform.position = pos;
-				fluidCon->velocity = velocity;
-				fluidCon->time = fluidTime;
-				fluidCon->radius = radius;
-				fluidCon->isEmitter = isEmitter;
-				fluidCon->emitterRate = emitterRate;
-				fluidCon->emitterTime = emitterTime;
-				fluidCon->emitterDuration = emitterDuration;
-				fluidCon->emitterCoolDown = emitterCoolDown;
-				fluidCon->isTemplate = true;
-				newScenario->fluids.push_back(fluidCon);
+static void ExpandFluids(XMLUtils &xmlUtils, const fxmlTag *parentNode, const uint64_t parentId, std::vector<const FluidActor *> &fluids) {
+	uint64_t elementIndex = 0;
+	for(const fxmlTag *child = parentNode->firstChild; child != nullptr; child = child->nextSibling) {
+		if(child->type != fxmlTagType_Element)
+			continue;
+		uint64_t id = GetElementId(xmlUtils, child, parentId, elementIndex++);
+		if(strcmp(child->name, "Fluid") == 0) {
+			FluidActor *newFluid = ParseFluid(xmlUtils, child);
+			newFluid->id = id;
+			fluids.push_back(newFluid);
+		} else {
+			GeneratorType type = GetGeneratorType(child);
+			if(type != GeneratorType::None) {
+				size_t first = fluids.size();
+				ExpandFluids(xmlUtils, child, id, fluids);
+				ExpandGenerator(xmlUtils, child, type, first, fluids);
 			}
 		}
+	}
+}
 
+Scenario *Scenario::load(const char *filePath, CScene *scene) {
+	AssetData xml;
+	if(Assets::Load(filePath, &xml)) {
+		std::cout << "  Load scenario from file '" << filePath << "'" << std::endl;
+		Scenario *result = loadFromMemory(filePath, xml.data, xml.size, scene);
+		xml.Release();
+		return(result);
+	} else {
+		return nullptr;
+	}
+}
+
+Scenario *Scenario::loadFromMemory(const char *filePath, const char *xmlData, const size_t xmlSize, CScene *scene) {
+	// Parse XML
+	fxmlContext ctx = FXML_ZERO_INIT;
+	fxmlTag root = FXML_ZERO_INIT;
+	size_t xmlLen = xmlSize;
+	if(!fxmlInitFromMemory(xmlData, xmlLen, &ctx)) {
+		std::cerr << "Failed initialize XML context with xml length of " << xmlLen << std::endl;
+		return nullptr;
+	}
+	if(!fxmlParse(&ctx, &root)) {
+		std::cerr << "Failed to parse XML file '" << filePath << "'!" << std::endl;
+		return(nullptr);
+	}
+
+	const fxmlTag *rootNode = fxmlFindTagByName(&root, "Scenario");
+	if(!rootNode) {
 		fxmlFree(&ctx);
+		return(nullptr);
+	}
+
+	VariableManager varMng = VariableManager();
+
+	const fxmlTag *varsNode = fxmlFindTagByName(rootNode, "Variables");
+	if(varsNode) {
+		varMng.Parse(varsNode);
+	}
+
+	XMLUtils xmlUtils = XMLUtils(&varMng);
+
+	Scenario *newScenario = new Scenario();
 
-		return newScenario;
+	// Name
+	const fxmlTag *nameNode = fxmlFindTagByName(rootNode, "Name");
+	if(nameNode) {
+		strcpy_s(newScenario->displayName, sizeof(newScenario->displayName), nameNode->value);
+	}
+
+	// Gravity
+	newScenario->gravity = xmlUtils.getNodeVec3(rootNode, "Gravity", glm::vec3(0.0f, -9.8f, 0.0f));
+
+	// Fluid properties
+	const fxmlTag *fpNode = fxmlFindTagByName(rootNode, "FluidProperties");
+	if(fpNode) {
+		float particleRadius = xmlUtils.getNodeFloat(fpNode, "ParticleRadius", scene->sim.particleRadius);
+		float particleDistanceFactor = xmlUtils.getNodeFloat(fpNode, "ParticleDistanceFactor", scene->sim.particleDistanceFactor);
+
+		newScenario->sim = FluidSimulationProperties::Compute(particleRadius, particleDistanceFactor);
+		newScenario->render = scene->render;
+
+		newScenario->sim.viscosity = xmlUtils.getNodeFloat(fpNode, "Viscosity", scene->sim.viscosity);
+		newScenario->sim.stiffness = xmlUtils.getNodeFloat(fpNode, "Stiffness", scene->sim.stiffness);
+		newScenario->sim.restitution = xmlUtils.getNodeFloat(fpNode, "Restitution", scene->sim.restitution);
+		newScenario->sim.damping = xmlUtils.getNodeFloat(fpNode, "Damping", scene->sim.damping);
+		newScenario->sim.dynamicFriction = xmlUtils.getNodeFloat(fpNode, "DynamicFriction", scene->sim.dynamicFriction);
+		newScenario->sim.maxMotionDistance = xmlUtils.getNodeFloat(fpNode, "MaxMotionDistance", scene->sim.maxMotionDistance);
+		newScenario->sim.restOffset = xmlUtils.getNodeFloat(fpNode, "RestOffset", scene->sim.restOffset);
+		newScenario->sim.contactOffset = xmlUtils.getNodeFloat(fpNode, "ContactOffset", scene->sim.contactOffset);
+		newScenario->sim.particleMass = xmlUtils.getNodeFloat(fpNode, "ParticleMass", scene->sim.particleMass);
+
+		newScenario->render.particleRenderFactor = xmlUtils.getNodeFloat(fpNode, "ParticleRenderFactor", scene->render.particleRenderFactor);
+		newScenario->render.minDensity = xmlUtils.getNodeFloat(fpNode, "ParticleMinDensity", scene->render.minDensity);
 	} else {
-		return nullptr;
+		newScenario->sim = scene->sim;
+		newScenario->render = scene->render;
+	}
+
+	// Actor properties
+	const fxmlTag *apNode = fxmlFindTagByName(rootNode, "ActorProperties");
+	if(apNode) {
+		newScenario->actorCreatePosition = xmlUtils.getNodeVec3(apNode, "CreatePosition", glm::vec3(0.0f));
 	}
+
+	// Actors and fluids, generators are expanded directly into the preallocated lists
+	const fxmlTag *actorsNode = fxmlFindTagByName(rootNode, "Actors");
+	if(actorsNode) {
+		newScenario->bodies.reserve(CountActors(xmlUtils, actorsNode, "Actor"));
+		ExpandActors(xmlUtils, actorsNode, ScenarioActorIdSeed, scene, newScenario->bodies);
+	}
+	const fxmlTag *fluidsNode = fxmlFindTagByName(rootNode, "Fluids");
+	if(fluidsNode) {
+		newScenario->fluids.reserve(CountActors(xmlUtils, fluidsNode, "Fluid"));
+		ExpandFluids(xmlUtils, fluidsNode, ScenarioActorIdSeed, newScenario->fluids);
+	}
+	std::cout << "  Expanded scenario '" << newScenario->displayName << "' to " << newScenario->bodies.size() << " bodies and " << newScenario->fluids.size() << " fluids" << std::endl;
+
+	fxmlFree(&ctx);
+
+	return newScenario;
 }
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include <glm/glm.hpp> 
 
 #include "Actor.hpp"
+#include "OSLowLevel.h"
 #include "Scene.h"
 
 #include "AllActors.hpp"
@@ -34,9 +35,14 @@ struct Scenario
 	FluidSimulationProperties sim;
 	FluidRenderProperties render;
 
+	// Set when the templates are pointing into a mapped compiled scenario, see CScenarioCache
+	COSLowLevel::MappedFile mapping;
+
 	Scenario();
 	~Scenario(void);
 
 	static Scenario* load(const char* filePath, CScene* scene);
+	// Parses the scenario from the already loaded xml data, the file path is only used for logging
+	static Scenario* loadFromMemory(const char* filePath, const char* xmlData, const size_t xmlSize, CScene* scene);
 };
 
@@ -0,0 +1,251 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - ScenarioCache.cpp
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#include "ScenarioCache.h"
+
+#include <assert.h>
+#include <string.h>
+#include <stdio.h>
+#include <vector>
+
+#include <final_platform_layer.h>
+
+#include "AllActors.hpp"
+
+constexpr uint32_t ScenarioCacheFileMagic = 0x43534346; // FCSC
+constexpr uint32_t ScenarioCacheFileVersion = 3;
+constexpr uint64_t ScenarioCacheRecordAlignment = 16;
+
+enum ScenarioCacheLayout {
+	ScenarioCacheLayout_Cube = 0,
+	ScenarioCacheLayout_Sphere,
+	ScenarioCacheLayout_Capsule,
+	ScenarioCacheLayout_Fluid,
+	ScenarioCacheLayout_Sim,
+	ScenarioCacheLayout_Render,
+	ScenarioCacheLayout_Count,
+};
+
+struct ScenarioCacheFileHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t sourceSize;
+	uint64_t sourceModifyTime;
+	uint64_t sourceHash;
+	uint64_t defaultsHash;
+	// NOTE(final): The templates are stored as they are in memory, so a file written by a build with a different struct layout is rejected
+	uint32_t layoutSizes[ScenarioCacheLayout_Count];
+	uint32_t bodyCount;
+	uint32_t fluidCount;
+	uint64_t bodyTableOffset;
+	uint64_t fluidsOffset;
+	char displayName[128];
+	float actorCreatePosition[3];
+	float gravity[3];
+	FluidSimulationProperties sim;
+	FluidRenderProperties render;
+};
+
+// Followed by the body table (one file offset per body), the body templates and the array of fluid templates, all aligned to 16 bytes
+
+static void GetLayoutSizes(uint32_t *outSizes) {
+	outSizes[ScenarioCacheLayout_Cube] = (uint32_t)sizeof(CubeActor);
+	outSizes[ScenarioCacheLayout_Sphere] = (uint32_t)sizeof(SphereActor);
+	outSizes[ScenarioCacheLayout_Capsule] = (uint32_t)sizeof(CapsuleActor);
+	outSizes[ScenarioCacheLayout_Fluid] = (uint32_t)sizeof(FluidActor);
+	outSizes[ScenarioCacheLayout_Sim] = (uint32_t)sizeof(FluidSimulationProperties);
+	outSizes[ScenarioCacheLayout_Render] = (uint32_t)sizeof(FluidRenderProperties);
+}
+
+static size_t GetBodySize(const ActorType type) {
+	switch(type) {
+		case ActorType::Cube:
+			return sizeof(CubeActor);
+		case ActorType::Sphere:
+			return sizeof(SphereActor);
+		case ActorType::Capsule:
+			return sizeof(CapsuleActor);
+		default:
+			return(0);
+	}
+}
+
+static uint64_t AlignRecord(const uint64_t offset) {
+	return (offset + ScenarioCacheRecordAlignment - 1) & ~(ScenarioCacheRecordAlignment - 1);
+}
+
+static uint64_t HashBytes(uint64_t hash, const void *data, const size_t size) {
+	// FNV-1a 64-bit
+	const uint8_t *bytes = (const uint8_t *)data;
+	for(size_t i = 0; i < size; ++i) {
+		hash ^= bytes[i];
+		hash *= 0x100000001B3ULL;
+	}
+	return(hash);
+}
+
+uint64_t CScenarioCache::HashSceneDefaults(const CScene &scene) {
+	// NOTE(final): The properties are plain floats without padding, so they can be hashed as they are in memory
+	uint64_t result = 0xCBF29CE484222325ULL;
+	result = HashBytes(result, &scene.defaultActorDensity, sizeof(scene.defaultActorDensity));
+	result = HashBytes(result, &scene.sim, sizeof(scene.sim));
+	result = HashBytes(result, &scene.render, sizeof(scene.render));
+	return(result);
+}
+
+CScenarioCache::CScenarioCache(const std::string &directory):
+	directory(directory) {
+	if(!fplDirectoryExists(this->directory.c_str())) {
+		if(!fplDirectoriesCreate(this->directory.c_str())) {
+			printf("Warning: Failed creating scenario cache directory '%s'!\n", this->directory.c_str());
+		}
+	}
+}
+
+std::string CScenarioCache::GetFilePath(const std::string &sourceFile) const {
+	uint64_t hash = HashBytes(0xCBF29CE484222325ULL, sourceFile.c_str(), sourceFile.size());
+	char filename[32];
+	snprintf(filename, sizeof(filename), "%016llx.fsc", (unsigned long long)hash);
+	return COSLowLevel::pathCombine(directory, filename);
+}
+
+Scenario *CScenarioCache::Load(const std::string &sourceFile, const uint64_t sourceSize, const uint64_t sourceModifyTime, const uint64_t defaultsHash, uint64_t *outSourceHash) const {
+	std::string filePath = GetFilePath(sourceFile);
+	COSLowLevel::MappedFile mapping;
+	if(!COSLowLevel::mapFile(filePath.c_str(), &mapping))
+		return(nullptr);
+
+	// NOTE(final): Everything is validated against the file size, so a truncated or foreign file is just a cache miss
+	uint32_t layoutSizes[ScenarioCacheLayout_Count];
+	GetLayoutSizes(layoutSizes);
+	const ScenarioCacheFileHeader *header = (const ScenarioCacheFileHeader *)mapping.data;
+	bool isValid = mapping.size >= sizeof(ScenarioCacheFileHeader) &&
+		header->magic == ScenarioCacheFileMagic &&
+		header->version == ScenarioCacheFileVersion &&
+		header->sourceSize == sourceSize &&
+		header->sourceModifyTime == sourceModifyTime &&
+		header->defaultsHash == defaultsHash &&
+		memcmp(header->layoutSizes, layoutSizes, sizeof(layoutSizes)) == 0 &&
+		header->bodyTableOffset % sizeof(uint64_t) == 0 &&
+		header->bodyTableOffset + (uint64_t)header->bodyCount * sizeof(uint64_t) <= mapping.size &&
+		header->fluidsOffset % ScenarioCacheRecordAlignment == 0 &&
+		header->fluidsOffset + (uint64_t)header->fluidCount * sizeof(FluidActor) <= mapping.size &&
+		memchr(header->displayName, 0, sizeof(header->displayName)) != nullptr;
+
+	// Pointer fix-ups for the bodies, every body is validated before the scenario is created
+	std::vector<const Actor *> bodies;
+	if(isValid) {
+		const uint64_t *bodyTable = (const uint64_t *)(mapping.data + header->bodyTableOffset);
+		bodies.resize(header->bodyCount);
+		for(uint32_t bodyIndex = 0; bodyIndex < header->bodyCount && isValid; ++bodyIndex) {
+			uint64_t offset = bodyTable[bodyIndex];
+			isValid = offset % ScenarioCacheRecordAlignment == 0 && offset + sizeof(Actor) <= mapping.size;
+			if(isValid) {
+				const Actor *body = (const Actor *)(mapping.data + offset);
+				size_t bodySize = GetBodySize(body->type);
+				isValid = bodySize > 0 && offset + bodySize <= mapping.size;
+				bodies[bodyIndex] = body;
+			}
+		}
+	}
+	if(!isValid) {
+		COSLowLevel::unmapFile(&mapping);
+		return(nullptr);
+	}
+
+	Scenario *result = new Scenario();
+	strcpy_s(result->displayName, sizeof(result->displayName), header->displayName);
+	result->actorCreatePosition = glm::vec3(header->actorCreatePosition[0], header->actorCreatePosition[1], header->actorCreatePosition[2]);
+	result->gravity = glm::vec3(header->gravity[0], header->gravity[1], header->gravity[2]);
+	result->sim = header->sim;
+	result->render = header->render;
+	result->bodies.swap(bodies);
+	const FluidActor *fluids = (const FluidActor *)(mapping.data + header->fluidsOffset);
+	result->fluids.resize(header->fluidCount);
+	for(uint32_t fluidIndex = 0; fluidIndex < header->fluidCount; ++fluidIndex)
+		result->fluids[fluidIndex] = fluids + fluidIndex;
+	result->mapping = mapping;
+
+	*outSourceHash = header->sourceHash;
+	return(result);
+}
+
+void CScenarioCache::Save(const std::string &sourceFile, const uint64_t sourceSize, const uint64_t sourceModifyTime, const uint64_t defaultsHash, const uint64_t sourceHash, const Scenario &scenario) const {
+	ScenarioCacheFileHeader header = {};
+	header.magic = ScenarioCacheFileMagic;
+	header.version = ScenarioCacheFileVersion;
+	header.sourceSize = sourceSize;
+	header.sourceModifyTime = sourceModifyTime;
+	header.sourceHash = sourceHash;
+	header.defaultsHash = defaultsHash;
+	GetLayoutSizes(header.layoutSizes);
+	header.bodyCount = (uint32_t)scenario.bodies.size();
+	header.fluidCount = (uint32_t)scenario.fluids.size();
+	strcpy_s(header.displayName, sizeof(header.displayName), scenario.displayName);
+	header.actorCreatePosition[0] = scenario.actorCreatePosition.x;
+	header.actorCreatePosition[1] = scenario.actorCreatePosition.y;
+	header.actorCreatePosition[2] = scenario.actorCreatePosition.z;
+	header.gravity[0] = scenario.gravity.x;
+	header.gravity[1] = scenario.gravity.y;
+	header.gravity[2] = scenario.gravity.z;
+	header.sim = scenario.sim;
+	header.render = scenario.render;
+
+	// Layout: Header, body table, bodies and fluids
+	header.bodyTableOffset = AlignRecord(sizeof(header));
+	std::vector<uint64_t> bodyTable(scenario.bodies.size());
+	uint64_t offset = header.bodyTableOffset + sizeof(uint64_t) * bodyTable.size();
+	for(size_t bodyIndex = 0; bodyIndex < scenario.bodies.size(); ++bodyIndex) {
+		size_t bodySize = GetBodySize(scenario.bodies[bodyIndex]->type);
+		if(bodySize == 0)
+			return;
+		offset = AlignRecord(offset);
+		bodyTable[bodyIndex] = offset;
+		offset += bodySize;
+	}
+	header.fluidsOffset = AlignRecord(offset);
+	uint64_t fileSize = header.fluidsOffset + sizeof(FluidActor) * scenario.fluids.size();
+
+	// The templates are copied into a single buffer without the physics pointers, which are meaningless on disk
+	std::vector<uint8_t> data((size_t)fileSize, 0);
+	memcpy(&data[0], &header, sizeof(header));
+	if(!bodyTable.empty())
+		memcpy(&data[(size_t)header.bodyTableOffset], &bodyTable[0], sizeof(uint64_t) * bodyTable.size());
+	for(size_t bodyIndex = 0; bodyIndex < scenario.bodies.size(); ++bodyIndex) {
+		const Actor *body = scenario.bodies[bodyIndex];
+		Actor *target = (Actor *)&data[(size_t)bodyTable[bodyIndex]];
+		memcpy(target, body, GetBodySize(body->type));
+		target->physicsData = nullptr;
+	}
+	for(size_t fluidIndex = 0; fluidIndex < scenario.fluids.size(); ++fluidIndex) {
+		FluidActor *target = (FluidActor *)&data[(size_t)(header.fluidsOffset + sizeof(FluidActor) * fluidIndex)];
+		memcpy(target, scenario.fluids[fluidIndex], sizeof(FluidActor));
+		target->physicsData = nullptr;
+	}
+
+	// NOTE(final): Written into a temporary file first, so a cache file which is still mapped by an older scenario is never overwritten in place.
+	// When the old file cannot be replaced while its mapped, the outdated file is just rejected and compiled again on the next load.
+	std::string filePath = GetFilePath(sourceFile);
+	std::string tempFilePath = filePath + ".tmp";
+	fplFileHandle file;
+	if(!fplFileCreateBinary(tempFilePath.c_str(), &file)) {
+		printf("Warning: Failed creating scenario cache file '%s'!\n", tempFilePath.c_str());
+		return;
+	}
+	size_t written = fplFileWriteBlock(&file, &data[0], data.size());
+	fplFileClose(&file);
+	if(written != data.size()) {
+		fplFileDelete(tempFilePath.c_str());
+		return;
+	}
+	fplFileDelete(filePath.c_str());
+	if(!fplFileMove(tempFilePath.c_str(), filePath.c_str())) {
+		fplFileDelete(tempFilePath.c_str());
+	}
+}
@@ -0,0 +1,36 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - ScenarioCache.h
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+#include "Scenario.h"
+#include "Scene.h"
+
+// On-disk cache of compiled scenarios: The resolved properties and flat arrays of the actor and fluid templates.
+// A compiled scenario is mapped as a whole and used in place, without any xml parsing, variable resolving or string conversion.
+// Cache files are stored per source file and are rebuilt when the size or the modification time of the source changes,
+// or when the scene defaults which were baked into the compiled scenario have changed.
+class CScenarioCache {
+private:
+	std::string directory;
+
+	std::string GetFilePath(const std::string &sourceFile) const;
+public:
+	CScenarioCache(const std::string &directory);
+
+	// Hash of all scene defaults a scenario falls back to while its parsed
+	static uint64_t HashSceneDefaults(const CScene &scene);
+
+	// Maps the cache file and points the templates directly into the mapping, fails when there is no cache file or when it is outdated
+	Scenario *Load(const std::string &sourceFile, const uint64_t sourceSize, const uint64_t sourceModifyTime, const uint64_t defaultsHash, uint64_t *outSourceHash) const;
+	void Save(const std::string &sourceFile, const uint64_t sourceSize, const uint64_t sourceModifyTime, const uint64_t defaultsHash, const uint64_t sourceHash, const Scenario &scenario) const;
+};
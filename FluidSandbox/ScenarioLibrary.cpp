@@ -0,0 +1,204 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - ScenarioLibrary.cpp
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#include "ScenarioLibrary.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "AssetPack.h"
+
+static uint64_t HashScenarioData(const char *data, const size_t size) {
+	// FNV-1a
+	uint64_t result = 0xCBF29CE484222325ULL;
+	for(size_t i = 0; i < size; ++i) {
+		result ^= (uint8_t)data[i];
+		result *= 0x100000001B3ULL;
+	}
+	return(result);
+}
+
+static std::string FindDisplayName(const char *xml) {
+	// NOTE(final): Only the name tag is needed for the index, so its just searched in the text instead of parsing the whole file
+	const char *start = strstr(xml, "<Name>");
+	if(start != nullptr) {
+		start += 6;
+		const char *end = strstr(start, "</Name>");
+		if(end != nullptr)
+			return std::string(start, end - start);
+	}
+	return("");
+}
+
+CScenarioLibrary::CScenarioLibrary(const CScene &scene, const CScenarioCache *cache):
+	sceneDefaults(scene),
+	sceneDefaultsHash(CScenarioCache::HashSceneDefaults(scene)),
+	cache(cache),
+	mutex({}),
+	condition({}),
+	prefetchThread(nullptr),
+	isShutdown(false) {
+	fplMutexInit(&mutex);
+	fplConditionInit(&condition);
+	prefetchThread = fplThreadCreate(PrefetchThreadProc, this);
+}
+
+CScenarioLibrary::~CScenarioLibrary() {
+	if(prefetchThread != nullptr) {
+		fplMutexLock(&mutex);
+		isShutdown = true;
+		fplConditionBroadcast(&condition);
+		fplMutexUnlock(&mutex);
+		fplThreadWaitForOne(prefetchThread, FPL_TIMEOUT_INFINITE);
+		prefetchThread = nullptr;
+	}
+	for(size_t i = 0; i < entries.size(); ++i) {
+		if(entries[i].scenario != nullptr)
+			delete entries[i].scenario;
+	}
+	entries.clear();
+	fplConditionDestroy(&condition);
+	fplMutexDestroy(&mutex);
+}
+
+void CScenarioLibrary::AddFile(const std::string &filePath) {
+	Entry entry = {};
+	entry.filePath = filePath;
+	AssetData xml;
+	if(Assets::Load(filePath.c_str(), &xml)) {
+		entry.hash = HashScenarioData(xml.data, xml.size);
+		entry.size = xml.size;
+		entry.modifyTime = xml.modifyTime;
+		entry.displayName = FindDisplayName(xml.data);
+		xml.Release();
+	}
+	if(entry.displayName.empty()) {
+		size_t nameStart = filePath.find_last_of("/\\");
+		entry.displayName = nameStart != std::string::npos ? filePath.substr(nameStart + 1) : filePath;
+	}
+	printf("  Indexed scenario '%s' from file '%s'\n", entry.displayName.c_str(), filePath.c_str());
+	fplMutexLock(&mutex);
+	entries.push_back(entry);
+	fplMutexUnlock(&mutex);
+}
+
+const char *CScenarioLibrary::GetDisplayName(const size_t index) const {
+	assert(index < entries.size());
+	return entries[index].displayName.c_str();
+}
+
+Scenario *CScenarioLibrary::LoadLocked(const size_t index) {
+	Entry &entry = entries[index];
+	while(entry.isLoading)
+		fplConditionWait(&condition, &mutex, FPL_TIMEOUT_INFINITE);
+
+	if(entry.scenario != nullptr) {
+		uint64_t size = 0, modifyTime = 0;
+		if(!Assets::GetInfo(entry.filePath.c_str(), &size, &modifyTime) || (size == entry.size && modifyTime == entry.modifyTime))
+			return(entry.scenario);
+	}
+
+	// NOTE(final): The file is read and parsed without holding the lock, the loading flag keeps every other thread away from this entry
+	entry.isLoading = true;
+	std::string filePath = entry.filePath;
+	Scenario *oldScenario = entry.scenario;
+	uint64_t oldHash = entry.hash;
+	fplMutexUnlock(&mutex);
+
+	Scenario *newScenario = nullptr;
+	AssetData xml = {};
+	uint64_t size = 0, modifyTime = 0, hash = 0;
+	bool isLoaded = false;
+
+	// Compiled scenario, the source file is not even read
+	if(oldScenario == nullptr && cache != nullptr && Assets::GetInfo(filePath.c_str(), &size, &modifyTime)) {
+		newScenario = cache->Load(filePath, size, modifyTime, sceneDefaultsHash, &hash);
+		if(newScenario != nullptr) {
+			printf("Load compiled scenario for file '%s'\n", filePath.c_str());
+			isLoaded = true;
+		}
+	}
+
+	if(!isLoaded) {
+		isLoaded = Assets::Load(filePath.c_str(), &xml);
+		if(isLoaded) {
+			size = xml.size;
+			modifyTime = xml.modifyTime;
+			hash = HashScenarioData(xml.data, xml.size);
+		}
+		if(isLoaded && (oldScenario == nullptr || hash != oldHash)) {
+			printf("Parse scenario from file '%s'\n", filePath.c_str());
+			newScenario = Scenario::loadFromMemory(filePath.c_str(), xml.data, xml.size, &sceneDefaults);
+			if(newScenario != nullptr && cache != nullptr)
+				cache->Save(filePath, size, modifyTime, sceneDefaultsHash, hash, *newScenario);
+		} else if(isLoaded && cache != nullptr) {
+			// Only touched, the cached scenario is still valid but the compiled one must match the new modify time
+			cache->Save(filePath, size, modifyTime, sceneDefaultsHash, hash, *oldScenario);
+		}
+	}
+
+	fplMutexLock(&mutex);
+	if(isLoaded) {
+		entry.hash = hash;
+		entry.size = size;
+		entry.modifyTime = modifyTime;
+	}
+	if(newScenario != nullptr) {
+		if(oldScenario != nullptr)
+			delete oldScenario;
+		entry.scenario = newScenario;
+	}
+	entry.isLoading = false;
+	fplConditionBroadcast(&condition);
+	xml.Release();
+	return(entry.scenario);
+}
+
+Scenario *CScenarioLibrary::Get(const size_t index) {
+	assert(index < entries.size());
+	fplMutexLock(&mutex);
+	Scenario *result = LoadLocked(index);
+	fplMutexUnlock(&mutex);
+	return(result);
+}
+
+void CScenarioLibrary::PrefetchAround(const size_t index) {
+	size_t count = entries.size();
+	if(count < 2)
+		return;
+	size_t next = (index + 1) % count;
+	size_t prev = (index + count - 1) % count;
+	fplMutexLock(&mutex);
+	prefetchQueue.clear();
+	prefetchQueue.push_back(next);
+	if(prev != next)
+		prefetchQueue.push_back(prev);
+	fplConditionBroadcast(&condition);
+	fplMutexUnlock(&mutex);
+}
+
+void CScenarioLibrary::PrefetchThreadProc(const fplThreadHandle *thread, void *data) {
+	CScenarioLibrary *library = (CScenarioLibrary *)data;
+	fplMutexLock(&library->mutex);
+	for(;;) {
+		while(library->prefetchQueue.empty() && !library->isShutdown)
+			fplConditionWait(&library->condition, &library->mutex, FPL_TIMEOUT_INFINITE);
+		if(library->isShutdown)
+			break;
+		size_t index = library->prefetchQueue.front();
+		library->prefetchQueue.erase(library->prefetchQueue.begin());
+
+		// Already cached scenarios are validated when they are requested, so only missing ones are parsed here
+		const Entry &entry = library->entries[index];
+		if(entry.scenario == nullptr && !entry.isLoading)
+			library->LoadLocked(index);
+	}
+	fplMutexUnlock(&library->mutex);
+}
@@ -0,0 +1,65 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - ScenarioLibrary.h
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <final_platform_layer.h>
+
+#include "Scenario.h"
+#include "Scene.h"
+#include "ScenarioCache.h"
+
+// Lightweight index of all scenario files, the scenarios itself are parsed on demand and cached.
+// A cached scenario is reused as long as the file modify time or at least the content hash is unchanged.
+// The scenarios next to the active one are parsed on a background thread, so switching scenarios does not stall.
+// With a scenario cache, parsed scenarios are compiled into the cache and unchanged files are mapped from it instead of being parsed.
+class CScenarioLibrary {
+private:
+	struct Entry {
+		std::string filePath;
+		std::string displayName;
+		uint64_t hash;
+		uint64_t size;
+		uint64_t modifyTime;
+		Scenario *scenario;
+		bool isLoading;
+	};
+
+	std::vector<Entry> entries;
+	std::vector<size_t> prefetchQueue;
+	CScene sceneDefaults;
+	uint64_t sceneDefaultsHash;
+	const CScenarioCache *cache;
+	fplMutexHandle mutex;
+	fplConditionVariable condition;
+	fplThreadHandle *prefetchThread;
+	bool isShutdown;
+
+	Scenario *LoadLocked(const size_t index);
+	static void PrefetchThreadProc(const fplThreadHandle *thread, void *data);
+public:
+	// The scene defaults are copied, so the scene can be changed while scenarios are parsed in the background
+	CScenarioLibrary(const CScene &scene, const CScenarioCache *cache = nullptr);
+	~CScenarioLibrary();
+
+	// Adds the file to the index without parsing it, all files must be added before any scenario is requested
+	void AddFile(const std::string &filePath);
+	inline size_t GetCount() const { return entries.size(); }
+	const char *GetDisplayName(const size_t index) const;
+
+	// Returns the parsed scenario, waits for a running background parse or parses it immediately when it is not cached or the file has changed.
+	// The returned scenario stays valid until the same index is requested again after its file has changed.
+	Scenario *Get(const size_t index);
+	// Parses the next and the previous scenario in the background
+	void PrefetchAround(const size_t index);
+};
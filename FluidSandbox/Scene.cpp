@@ -14,6 +14,7 @@
 #include <final_xml.h>
 
 #include "OSLowLevel.h"
+#include "AssetPack.h"
 
 CScene::CScene(const float defaultActorDensity) {
 	sim = FluidSimulationProperties::Compute(FluidSimulationProperties::DefaultParticleRadius, FluidSimulationProperties::DefaultParticleRestDistanceFactor);
@@ -45,28 +46,29 @@ void CScene::resetFluidColors() {
 }
 
 bool CScene::load(const char *filePath) {
-	if(!COSLowLevel::fileExists(filePath)) {
+	std::cout << "Load scene from file '" << filePath << "'" << std::endl;
+	AssetData xml;
+	if(!Assets::Load(filePath, &xml)) {
 		std::cout << "The scene file '" << filePath << "' was not found!" << std::endl;
 		return(false);
 	}
+	std::cout << "Successfully loaded scene from file '" << filePath << "' with length of " << xml.size << std::endl;
 
 	fluidColors.clear();
 	fluidColorDefaultIndex = 0;
 
-	std::cout << "Load scene from file '" << filePath << "'" << std::endl;
-	std::string xml = COSLowLevel::getTextFileContent(filePath);
-	std::cout << "Successfully loaded scene from file '" << filePath << "' with length of " << xml.length() << std::endl;
-
 	// Parse XML
 	fxmlContext ctx = FXML_ZERO_INIT;
 	fxmlTag root = FXML_ZERO_INIT;
-	size_t xmlLen = xml.length();
-	if(!fxmlInitFromMemory(xml.c_str(), xmlLen, &ctx)) {
-		std::cerr << "Failed initialize XML context with xml length of " << xml << std::endl;
+	size_t xmlLen = xml.size;
+	if(!fxmlInitFromMemory(xml.data, xmlLen, &ctx)) {
+		std::cerr << "Failed initialize XML context with xml length of " << xmlLen << std::endl;
+		xml.Release();
 		return(false);
 	}
 	if(!fxmlParse(&ctx, &root)) {
 		std::cerr << "Failed to parse XML file '" << filePath << "'!" << std::endl;
+		xml.Release();
 		return(false);
 	}
 
@@ -74,6 +76,7 @@ bool CScene::load(const char *filePath) {
 	if(!rootNode) {
 		std::cerr << "The scene node in the xml file '" << filePath << "' was not found!" << std::endl;
 		fxmlFree(&ctx);
+		xml.Release();
 		return(false);
 	}
 
@@ -138,5 +141,8 @@ bool CScene::load(const char *filePath) {
 		backgroundColor = xmlUtils.getNodeVec3(propertiesNode, "BackgroundColor", glm::vec3(0.0f));
 	}
 
+	fxmlFree(&ctx);
+	xml.Release();
+
 	return(true);
 }
\ No newline at end of file
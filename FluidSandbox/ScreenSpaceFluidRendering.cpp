@@ -9,12 +9,12 @@
 
 #include "ScreenSpaceFluidRendering.h"
 
-CScreenSpaceFluidRendering::CScreenSpaceFluidRendering(const int width, const int height, CRenderer *renderer, CTextureCubemap *skyboxCubemap, CTexture2D *sceneTexture, CSphericalPointSprites *pointSprites, GeometryVBO *fullscreenQuad):
+CScreenSpaceFluidRendering::CScreenSpaceFluidRendering(const int width, const int height, CRenderer *renderer, CShaderCache *shaderCache, CTextureCubemap *skyboxCubemap, CTexture2D *sceneTexture, CSphericalPointSprites *pointSprites, GeometryVBO *fullscreenQuad):
 	renderer(renderer),
 	pointSprites(pointSprites),
 	fullscreenQuad(fullscreenQuad),
-	fullFrameBuffer(nullptr),
-	depthFrameBuffer(nullptr),
+	renderGraph(nullptr),
+	graphFrame({}),
 	pointSpritesShader(nullptr),
 	pointsShader(nullptr),
 	depthShader(nullptr),
@@ -34,70 +34,71 @@ CScreenSpaceFluidRendering::CScreenSpaceFluidRendering(const int width, const in
 
 	// Check if max color attachments is at least 4
 	if(CFBO::getMaxColorAttachments() >= 4) {
-		// Create frame buffer object for depth
-		depthFrameBuffer = new CSSFRDepthFBO(curFBOWidth, curFBOHeight);
-		depthFrameBuffer->depthTexture = depthFrameBuffer->addRenderTarget(GL_DEPTH_COMPONENT32, GL_DEPTH_COMPONENT, GL_FLOAT, GL_DEPTH_ATTACHMENT, GL_NEAREST); // Depth
-		depthFrameBuffer->colorTexture = depthFrameBuffer->addTextureTarget(GL_RGB32F, GL_RGBA, GL_FLOAT, GL_COLOR_ATTACHMENT0, GL_LINEAR); // Color
-		depthFrameBuffer->update();
-
-		// Create frame buffer object
-		fullFrameBuffer = new CSSFRFullFBO(curFBOWidth, curFBOHeight);
-		fullFrameBuffer->thicknessTexture = fullFrameBuffer->addTextureTarget(GL_RGB32F, GL_RGBA, GL_FLOAT, GL_COLOR_ATTACHMENT0, GL_NEAREST); // Thickness
-		fullFrameBuffer->depthSmoothATexture = fullFrameBuffer->addTextureTarget(GL_RGB32F, GL_RGBA, GL_FLOAT, GL_COLOR_ATTACHMENT1, GL_NEAREST); // Depth smooth A
-		fullFrameBuffer->depthSmoothBTexture = fullFrameBuffer->addTextureTarget(GL_RGB32F, GL_RGBA, GL_FLOAT, GL_COLOR_ATTACHMENT2, GL_NEAREST); // Depth smooth B
-		fullFrameBuffer->waterTexture = fullFrameBuffer->addTextureTarget(GL_RGB32F, GL_RGBA, GL_FLOAT, GL_COLOR_ATTACHMENT3, GL_LINEAR); // Water
-		fullFrameBuffer->update();
+		// NOTE(final): The render targets are transient textures of the render graph, created on first use
+		renderGraph = new CRenderGraph();
+		renderGraph->SetSize(curFBOWidth, curFBOHeight);
 
 		// Create shaders
 		{
 			std::string pointSpritesShaderPath = std::string("shaders\\" + std::string(CPointSpritesShader::ShaderName));
 			pointSpritesShader = new CPointSpritesShader();
-			Utils::attachShaderFromFile(pointSpritesShader, GL_VERTEX_SHADER, (pointSpritesShaderPath + ".vertex").c_str(), "    ");
-			Utils::attachShaderFromFile(pointSpritesShader, GL_FRAGMENT_SHADER, (pointSpritesShaderPath + ".fragment").c_str(), "    ");
+			Utils::addShaderSourceFromFile(pointSpritesShader, GL_VERTEX_SHADER, (pointSpritesShaderPath + ".vertex").c_str(), "    ");
+			Utils::addShaderSourceFromFile(pointSpritesShader, GL_FRAGMENT_SHADER, (pointSpritesShaderPath + ".fragment").c_str(), "    ");
+			shaderCache->Add(pointSpritesShader);
 		}
 		{
 			std::string pointsShaderPath = std::string("shaders\\" + std::string(CPointsShader::ShaderName));
 			pointsShader = new CPointsShader();
-			Utils::attachShaderFromFile(pointsShader, GL_VERTEX_SHADER, (pointsShaderPath + ".vertex").c_str(), "    ");
-			Utils::attachShaderFromFile(pointsShader, GL_FRAGMENT_SHADER, (pointsShaderPath + ".fragment").c_str(), "    ");
+			Utils::addShaderSourceFromFile(pointsShader, GL_VERTEX_SHADER, (pointsShaderPath + ".vertex").c_str(), "    ");
+			Utils::addShaderSourceFromFile(pointsShader, GL_FRAGMENT_SHADER, (pointsShaderPath + ".fragment").c_str(), "    ");
+			shaderCache->Add(pointsShader);
 		}
 		{
 			std::string depthShaderPath = std::string("shaders\\" + std::string(CDepthShader::ShaderName));
 			depthShader = new CDepthShader();
-			Utils::attachShaderFromFile(depthShader, GL_VERTEX_SHADER, (depthShaderPath + ".vertex").c_str(), "    ");
-			Utils::attachShaderFromFile(depthShader, GL_FRAGMENT_SHADER, (depthShaderPath + ".fragment").c_str(), "    ");
+			Utils::addShaderSourceFromFile(depthShader, GL_VERTEX_SHADER, (depthShaderPath + ".vertex").c_str(), "    ");
+			Utils::addShaderSourceFromFile(depthShader, GL_FRAGMENT_SHADER, (depthShaderPath + ".fragment").c_str(), "    ");
+			shaderCache->Add(depthShader);
 		}
 		{
 			std::string thicknessShaderPath = std::string("shaders\\" + std::string(CThicknessShader::ShaderName));
 			thicknessShader = new CThicknessShader();
-			Utils::attachShaderFromFile(thicknessShader, GL_VERTEX_SHADER, (thicknessShaderPath + ".vertex").c_str(), "    ");
-			Utils::attachShaderFromFile(thicknessShader, GL_FRAGMENT_SHADER, (thicknessShaderPath + ".fragment").c_str(), "    ");
+			Utils::addShaderSourceFromFile(thicknessShader, GL_VERTEX_SHADER, (thicknessShaderPath + ".vertex").c_str(), "    ");
+			Utils::addShaderSourceFromFile(thicknessShader, GL_FRAGMENT_SHADER, (thicknessShaderPath + ".fragment").c_str(), "    ");
+			shaderCache->Add(thicknessShader);
 		}
 		{
 			std::string depthBlurShaderPath = std::string("shaders\\" + std::string(CDepthBlurShader::ShaderName));
 			depthBlurShader = new CDepthBlurShader();
-			Utils::attachShaderFromFile(depthBlurShader, GL_VERTEX_SHADER, (depthBlurShaderPath + ".vertex").c_str(), "    ");
-			Utils::attachShaderFromFile(depthBlurShader, GL_FRAGMENT_SHADER, (depthBlurShaderPath + ".fragment").c_str(), "    ");
+			Utils::addShaderSourceFromFile(depthBlurShader, GL_VERTEX_SHADER, (depthBlurShaderPath + ".vertex").c_str(), "    ");
+			Utils::addShaderSourceFromFile(depthBlurShader, GL_FRAGMENT_SHADER, (depthBlurShaderPath + ".fragment").c_str(), "    ");
+			shaderCache->Add(depthBlurShader);
 		}
 		{
 			std::string clearWaterShaderPath = std::string("shaders\\" + std::string(CWaterShader::ClearName));
 			clearWaterShader = new CWaterShader();
-			Utils::attachShaderFromFile(clearWaterShader, GL_VERTEX_SHADER, (clearWaterShaderPath + ".vertex").c_str(), "    ");
-			Utils::attachShaderFromFile(clearWaterShader, GL_FRAGMENT_SHADER, (clearWaterShaderPath + ".fragment").c_str(), "    ");
+			Utils::addShaderSourceFromFile(clearWaterShader, GL_VERTEX_SHADER, (clearWaterShaderPath + ".vertex").c_str(), "    ");
+			Utils::addShaderSourceFromFile(clearWaterShader, GL_FRAGMENT_SHADER, (clearWaterShaderPath + ".fragment").c_str(), "    ");
+			shaderCache->Add(clearWaterShader);
 		}
 		{
 			std::string colorWaterShaderPath = std::string("shaders\\" + std::string(CWaterShader::ColorName));
 			colorWaterShader = new CWaterShader();
-			Utils::attachShaderFromFile(colorWaterShader, GL_VERTEX_SHADER, (colorWaterShaderPath + ".vertex").c_str(), "    ");
-			Utils::attachShaderFromFile(colorWaterShader, GL_FRAGMENT_SHADER, (colorWaterShaderPath + ".fragment").c_str(), "    ");
+			Utils::addShaderSourceFromFile(colorWaterShader, GL_VERTEX_SHADER, (colorWaterShaderPath + ".vertex").c_str(), "    ");
+			Utils::addShaderSourceFromFile(colorWaterShader, GL_FRAGMENT_SHADER, (colorWaterShaderPath + ".fragment").c_str(), "    ");
+			shaderCache->Add(colorWaterShader);
 		}
 		{
 			std::string debugWaterShaderPath = std::string("shaders\\" + std::string(CWaterShader::DebugName));
 			debugWaterShader = new CWaterShader();
-			Utils::attachShaderFromFile(debugWaterShader, GL_VERTEX_SHADER, (debugWaterShaderPath + ".vertex").c_str(), "    ");
-			Utils::attachShaderFromFile(debugWaterShader, GL_FRAGMENT_SHADER, (debugWaterShaderPath + ".fragment").c_str(), "    ");
+			Utils::addShaderSourceFromFile(debugWaterShader, GL_VERTEX_SHADER, (debugWaterShaderPath + ".vertex").c_str(), "    ");
+			Utils::addShaderSourceFromFile(debugWaterShader, GL_FRAGMENT_SHADER, (debugWaterShaderPath + ".fragment").c_str(), "    ");
+			shaderCache->Add(debugWaterShader);
 		}
 
+		// NOTE(final): All eight programs are compiled and linked at once, so the driver can build them in parallel
+		shaderCache->Build("    ");
+
 		printf("    Screen space fluid rendering is supported.\n");
 	} else
 		printf("    Warning: Screen space fluid rendering is not supported on this hardware!\n");
@@ -112,11 +113,9 @@ CScreenSpaceFluidRendering::~CScreenSpaceFluidRendering(void) {
 			delete shaders[i];
 	}
 
-	// Release framebuffer
-	if(depthFrameBuffer)
-		delete depthFrameBuffer;
-	if(fullFrameBuffer)
-		delete fullFrameBuffer;
+	// Release render graph and its textures
+	if(renderGraph)
+		delete renderGraph;
 
 	// Release pointers
 	sceneTexture = nullptr;
@@ -126,7 +125,7 @@ CScreenSpaceFluidRendering::~CScreenSpaceFluidRendering(void) {
 }
 
 void CScreenSpaceFluidRendering::DepthPass(const uint32_t numPointSprites, const glm::mat4 &proj, const glm::mat4 &view, const float zfar, const float znear, const int wH, const float particleRadius) {
-	depthShader->enable();
+	renderer->BindShader(depthShader);
 	depthShader->uniform1f(depthShader->ulocPointScale, CSphericalPointSprites::GetPointScale(wH, 50.0f));
 	depthShader->uniform1f(depthShader->ulocPointRadius, particleRadius);
 	depthShader->uniform1f(depthShader->ulocNear, znear);
@@ -134,7 +133,7 @@ void CScreenSpaceFluidRendering::DepthPass(const uint32_t numPointSprites, const
 	depthShader->uniformMatrix4(depthShader->ulocViewMat, &view[0][0]);
 	depthShader->uniformMatrix4(depthShader->ulocProjMat, &proj[0][0]);
 	pointSprites->Draw(numPointSprites);
-	depthShader->disable();
+	renderer->UnbindShader();
 }
 
 void CScreenSpaceFluidRendering::ThicknessPass(const uint32_t numPointSprites, const glm::mat4 &proj, const glm::mat4 &view, const float zfar, const float znear, const int wH, const float particleRadius) {
@@ -144,7 +143,7 @@ void CScreenSpaceFluidRendering::ThicknessPass(const uint32_t numPointSprites, c
 	renderer->SetBlending(true);
 	renderer->SetDepthMask(false);
 
-	thicknessShader->enable();
+	renderer->BindShader(thicknessShader);
 	thicknessShader->uniform1f(thicknessShader->ulocPointScale, CSphericalPointSprites::GetPointScale(wH, 50.0f));
 	thicknessShader->uniform1f(thicknessShader->ulocPointRadius, particleRadius * 2.0f);
 	thicknessShader->uniform1f(thicknessShader->ulocNear, znear);
@@ -154,7 +153,7 @@ void CScreenSpaceFluidRendering::ThicknessPass(const uint32_t numPointSprites, c
 
 	pointSprites->Draw(numPointSprites);
 
-	thicknessShader->disable();
+	renderer->UnbindShader();
 
 	renderer->SetDepthMask(true);
 	renderer->SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -163,16 +162,16 @@ void CScreenSpaceFluidRendering::ThicknessPass(const uint32_t numPointSprites, c
 
 void CScreenSpaceFluidRendering::RenderPoints(const uint32_t numPointSprites, const glm::mat4 &mvp, const glm::vec4 &color) {
 	CPointsShader *shader = pointsShader;
-	shader->enable();
+	renderer->BindShader(shader);
 	shader->uniformMatrix4(shader->ulocMVP, &mvp[0][0]);
 	shader->uniform4f(shader->ulocColor, &color[0]);
 	pointSprites->Draw(numPointSprites);
-	shader->disable();
+	renderer->UnbindShader();
 }
 
 void CScreenSpaceFluidRendering::RenderPointSprites(const uint32_t numPointSprites, const glm::mat4 &proj, const glm::mat4 &view, const float zfar, const float znear, const int wH, const float particleRadius, const glm::vec4 &color) {
 	CPointSpritesShader *shader = pointSpritesShader;
-	shader->enable();
+	renderer->BindShader(shader);
 	shader->uniform1f(shader->ulocPointScale, CSphericalPointSprites::GetPointScale(wH, 50.0f));
 	shader->uniform1f(shader->ulocPointRadius, particleRadius);
 	shader->uniform1f(shader->ulocNear, znear);
@@ -181,7 +180,7 @@ void CScreenSpaceFluidRendering::RenderPointSprites(const uint32_t numPointSprit
 	shader->uniformMatrix4(shader->ulocViewMat, &view[0][0]);
 	shader->uniformMatrix4(shader->ulocProjMat, &proj[0][0]);
 	pointSprites->Draw(numPointSprites);
-	shader->disable();
+	renderer->UnbindShader();
 }
 
 void CScreenSpaceFluidRendering::RenderFullscreenQuad() {
@@ -199,14 +198,14 @@ void CScreenSpaceFluidRendering::BlurDepthPass(const glm::mat4 &mvp, CTexture2D
 	renderer->EnableTexture(0, depthTexture);
 
 	// Process depth smooth shader on a fullscreen quad if active
-	depthBlurShader->enable();
+	renderer->BindShader(depthBlurShader);
 	depthBlurShader->uniform1i(depthBlurShader->ulocDepthTex, 0);
 	depthBlurShader->uniform2f(depthBlurShader->ulocScale, dirX, dirY);
 	depthBlurShader->uniform1f(depthBlurShader->ulocRadius, 10.0f);
 	depthBlurShader->uniform1f(depthBlurShader->ulocMinDepth, MIN_DEPTH);
 	depthBlurShader->uniformMatrix4(depthBlurShader->ulocMVPMat, &mvp[0][0]);
 	RenderFullscreenQuad();
-	depthBlurShader->disable();
+	renderer->UnbindShader();
 
 	// Unbind textures
 	renderer->DisableTexture(0, depthTexture);
@@ -216,10 +215,11 @@ void CScreenSpaceFluidRendering::BlurDepthPass(const glm::mat4 &mvp, CTexture2D
 }
 
 void CScreenSpaceFluidRendering::WaterPass(const CCamera &cam, const glm::mat4 &mvp, CTexture2D *depthTexture, CTexture2D *thicknessTexture, const FluidColor &color, const FluidDebugType showType) {
-	// Bind 3 textures (Depth, Thickness, Scene)
+	// Bind 4 textures (Depth, Thickness, Scene, Skybox), thickness is culled when the debug type does not need it
 	renderer->SetBlending(true);
 	renderer->EnableTexture(0, depthTexture); // Depth Texture0
-	renderer->EnableTexture(1, thicknessTexture); // Thickness Texture1
+	if(thicknessTexture != nullptr)
+		renderer->EnableTexture(1, thicknessTexture); // Thickness Texture1
 	renderer->EnableTexture(2, sceneTexture); // Scene Texture2
 	renderer->EnableTexture(3, skyboxCubemap); // Skybox Texture3 (Cubemap)
 
@@ -229,7 +229,7 @@ void CScreenSpaceFluidRendering::WaterPass(const CCamera &cam, const glm::mat4 &
 		shader = !color.isClear ? colorWaterShader : clearWaterShader;
 	else
 		shader = debugWaterShader;
-	shader->enable();
+	renderer->BindShader(shader);
 	shader->uniform1i(shader->ulocDepthTex, 0);
 	shader->uniform1i(shader->ulocThicknessTex, 1);
 	shader->uniform1i(shader->ulocSceneTex, 2);
@@ -247,21 +247,78 @@ void CScreenSpaceFluidRendering::WaterPass(const CCamera &cam, const glm::mat4 &
 
 	shader->uniformMatrix4(shader->ulocMVPMat, &mvp[0][0]);
 	RenderFullscreenQuad();
-	shader->disable();
+	renderer->UnbindShader();
 
 	// Unbind 4 textures
 	renderer->DisableTexture(3, skyboxCubemap);
 	renderer->DisableTexture(2, sceneTexture);
-	renderer->DisableTexture(1, thicknessTexture);
+	if(thicknessTexture != nullptr)
+		renderer->DisableTexture(1, thicknessTexture);
 	renderer->DisableTexture(0, depthTexture);
 	renderer->SetBlending(false);
 }
 
+bool CScreenSpaceFluidRendering::IsThicknessRequired(const FluidDebugType showType) {
+	switch(showType) {
+		case FluidDebugType::Final:
+		case FluidDebugType::Refraction:
+		case FluidDebugType::Reflection:
+		case FluidDebugType::FresnelReflection:
+		case FluidDebugType::Thickness:
+		case FluidDebugType::Absorbtion:
+			return(true);
+		default:
+			return(false);
+	}
+}
+
+void CScreenSpaceFluidRendering::ExecuteDepthPass(CRenderGraph &graph, void *userData) {
+	CScreenSpaceFluidRendering *ssfr = (CScreenSpaceFluidRendering *)userData;
+	const SSFRGraphFrame &frame = ssfr->graphFrame;
+	ssfr->renderer->ClearColor(-10000.0f, 0.0f, 0.0f, 0.0f);
+	ssfr->renderer->Clear(ClearFlags::Color | ClearFlags::Depth);
+	ssfr->DepthPass(frame.numPointSprites, frame.cam->projection, frame.cam->modelview, frame.farDepth, frame.nearDepth, graph.GetHeight(), frame.particleRadius);
+}
+
+void CScreenSpaceFluidRendering::ExecuteThicknessPass(CRenderGraph &graph, void *userData) {
+	CScreenSpaceFluidRendering *ssfr = (CScreenSpaceFluidRendering *)userData;
+	const SSFRGraphFrame &frame = ssfr->graphFrame;
+	ssfr->ThicknessPass(frame.numPointSprites, frame.cam->projection, frame.cam->modelview, frame.farDepth, frame.nearDepth, graph.GetHeight(), frame.particleRadius);
+}
+
+void CScreenSpaceFluidRendering::ExecuteBlurAPass(CRenderGraph &graph, void *userData) {
+	CScreenSpaceFluidRendering *ssfr = (CScreenSpaceFluidRendering *)userData;
+	const SSFRGraphFrame &frame = ssfr->graphFrame;
+	ssfr->renderer->ClearColor(0, 0, 0, 0);
+	ssfr->BlurDepthPass(frame.orthoMVP, graph.GetTexture(frame.linearDepthTexture), frame.options->blurScale, 0.0f);
+}
+
+void CScreenSpaceFluidRendering::ExecuteBlurBPass(CRenderGraph &graph, void *userData) {
+	CScreenSpaceFluidRendering *ssfr = (CScreenSpaceFluidRendering *)userData;
+	const SSFRGraphFrame &frame = ssfr->graphFrame;
+	ssfr->renderer->ClearColor(0, 0, 0, 0);
+	ssfr->BlurDepthPass(frame.orthoMVP, graph.GetTexture(frame.smoothATexture), 0.0f, frame.options->blurScale);
+}
+
+void CScreenSpaceFluidRendering::ExecuteWaterPass(CRenderGraph &graph, void *userData) {
+	CScreenSpaceFluidRendering *ssfr = (CScreenSpaceFluidRendering *)userData;
+	const SSFRGraphFrame &frame = ssfr->graphFrame;
+
+	// Set view and scissor
+	ssfr->renderer->SetViewport(0, 0, ssfr->curWindowWidth, ssfr->curWindowHeight);
+	ssfr->renderer->SetScissor(0, 0, ssfr->curWindowWidth, ssfr->curWindowHeight);
+
+	CTexture2D *thicknessTexture = nullptr;
+	if(IsThicknessRequired(frame.options->debugType))
+		thicknessTexture = graph.GetTexture(frame.thicknessTexture);
+
+	ssfr->WaterPass(*frame.cam, frame.orthoMVP, graph.GetTexture(frame.finalDepthTexture), thicknessTexture, frame.options->fluidColor, frame.options->debugType);
+}
+
 void CScreenSpaceFluidRendering::RenderSSF(const CCamera &cam, const uint32_t numPointSprites, const SSFDrawingOptions &dstate, const int wW, const int wH, const float particleRadius) {
-	assert(fullFrameBuffer);
-	assert(depthFrameBuffer);
+	assert(renderGraph);
 
-	// Resize FBO if needed
+	// Resize transient textures if needed
 	if((wW != curWindowWidth) ||
 		(wH != curWindowHeight) ||
 		(curFBOFactor != newFBOFactor)) {
@@ -270,82 +327,62 @@ void CScreenSpaceFluidRendering::RenderSSF(const CCamera &cam, const uint32_t nu
 		curFBOFactor = newFBOFactor;
 		curFBOWidth = CalcFBOSize(wW, curFBOFactor);
 		curFBOHeight = CalcFBOSize(wH, curFBOFactor);
-		fullFrameBuffer->resize(curFBOWidth, curFBOHeight);
-		depthFrameBuffer->resize(curFBOWidth, curFBOHeight);
 	}
-
-	// Retrieve texture pointers
-	CTexture2D *depthTexture = depthFrameBuffer->depthTexture;
-	CTexture2D *colorTexture = depthFrameBuffer->colorTexture;
-
-	CTexture2D *thicknessTexture = fullFrameBuffer->thicknessTexture;
-	CTexture2D *depthSmoothATexture = fullFrameBuffer->depthSmoothATexture;
-	CTexture2D *depthSmoothBTexture = fullFrameBuffer->depthSmoothBTexture;
-	CTexture2D *waterTexture = fullFrameBuffer->waterTexture;
-
-	// Save latest draw buffer
-	GLint latestDrawBuffer = fullFrameBuffer->getDrawBuffer();
-
-	// Get required matrices
-	glm::mat4 mvp = cam.mvp;
-	glm::mat4 mview = cam.modelview;
-	glm::mat4 mproj = cam.projection;
-
-	// Calculate ortho matrix
-	glm::mat4 orthoMVP = glm::ortho(-1.0f, 1.0f, -1.0f, 1.0f); // Unit-Cube OpenGL
+	renderGraph->SetSize(curFBOWidth, curFBOHeight);
 
 	// Get depth range
 	float nf[2];
 	glGetFloatv(GL_DEPTH_RANGE, nf);
-	float near_depth = nf[0];
-	float far_depth = nf[1];
 
-	// Set view and scissor
-	renderer->SetViewport(0, 0, curFBOWidth, curFBOHeight);
-	renderer->SetScissor(0, 0, curFBOWidth, curFBOHeight);
+	SSFRGraphFrame &frame = graphFrame;
+	frame.cam = &cam;
+	frame.options = &dstate;
+	frame.orthoMVP = glm::ortho(-1.0f, 1.0f, -1.0f, 1.0f); // Unit-Cube OpenGL
+	frame.nearDepth = nf[0];
+	frame.farDepth = nf[1];
+	frame.particleRadius = particleRadius;
+	frame.numPointSprites = numPointSprites;
+
+	// Build the graph, the passes which does not contribute to the water pass are culled on compile
+	renderGraph->Reset();
+
+	RenderGraphTextureID depthBufferTexture = renderGraph->CreateTexture("Depth buffer", RenderGraphTextureDesc(GL_DEPTH_COMPONENT32, GL_DEPTH_COMPONENT, GL_FLOAT, GL_NEAREST, true));
+	frame.linearDepthTexture = renderGraph->CreateTexture("Linear depth", RenderGraphTextureDesc(GL_RGB32F, GL_RGBA, GL_FLOAT, GL_LINEAR));
+	frame.thicknessTexture = renderGraph->CreateTexture("Thickness", RenderGraphTextureDesc(GL_RGB32F, GL_RGBA, GL_FLOAT, GL_NEAREST));
+	frame.smoothATexture = renderGraph->CreateTexture("Depth smooth A", RenderGraphTextureDesc(GL_RGB32F, GL_RGBA, GL_FLOAT, GL_NEAREST));
+	frame.smoothBTexture = renderGraph->CreateTexture("Depth smooth B", RenderGraphTextureDesc(GL_RGB32F, GL_RGBA, GL_FLOAT, GL_NEAREST));
+	frame.sceneTexture = renderGraph->ImportTexture("Scene", sceneTexture);
 
 	// Pass 1: Render point sprites to depth and color
-	depthFrameBuffer->enable();
-	depthFrameBuffer->setDrawBuffer(GL_COLOR_ATTACHMENT0);
-	renderer->ClearColor(-10000.0f, 0.0f, 0.0f, 0.0f);
-	renderer->Clear(ClearFlags::Color | ClearFlags::Depth);
-	DepthPass(numPointSprites, mproj, mview, far_depth, near_depth, curFBOHeight, particleRadius);
-	depthFrameBuffer->disable();
-
-	// Enable FBO
-	fullFrameBuffer->enable();
+	RenderGraphPassID depthPass = renderGraph->AddPass("Depth", ExecuteDepthPass, this);
+	renderGraph->Write(depthPass, frame.linearDepthTexture);
+	renderGraph->Write(depthPass, depthBufferTexture);
 
 	// Pass 2: Render point sprites to thickness
-	// -------------------------------------
-	fullFrameBuffer->setDrawBuffer(GL_COLOR_ATTACHMENT0); // Draw to color attachment 0: Thickness
-	ThicknessPass(numPointSprites, mproj, mview, far_depth, near_depth, curFBOHeight, particleRadius);
-
-	if(dstate.blurEnabled) {
-		// Pass 3: Blur depth A
-		// -------------------------------------
-		fullFrameBuffer->setDrawBuffer(GL_COLOR_ATTACHMENT1); // Draw to color attachment 1: Smooth depth A
-		BlurDepthPass(orthoMVP, colorTexture, dstate.blurScale, 0.0f);
-
-		// Pass 4: Blur depth B
-		// -------------------------------------
-		fullFrameBuffer->setDrawBuffer(GL_COLOR_ATTACHMENT2); // Draw to color attachment 2: Smooth depth B
-		BlurDepthPass(orthoMVP, depthSmoothATexture, 0.0f, dstate.blurScale);
-	} else {
-		depthSmoothBTexture = colorTexture;
-	}
-
-	// Disable FBO
-	fullFrameBuffer->disable();
-
-	// Restore latest draw buffer
-	fullFrameBuffer->setDrawBuffer(latestDrawBuffer);
-
-	// Set view and scissor
-	renderer->SetViewport(0, 0, curWindowWidth, curWindowHeight);
-	renderer->SetScissor(0, 0, curWindowWidth, curWindowHeight);
-
-	// Pass 5: Water rendering
-	WaterPass(cam, orthoMVP, depthSmoothBTexture, thicknessTexture, dstate.fluidColor, dstate.debugType);
+	RenderGraphPassID thicknessPass = renderGraph->AddPass("Thickness", ExecuteThicknessPass, this);
+	renderGraph->Write(thicknessPass, frame.thicknessTexture);
+
+	// Pass 3: Blur depth A
+	RenderGraphPassID blurAPass = renderGraph->AddPass("Blur depth A", ExecuteBlurAPass, this);
+	renderGraph->Read(blurAPass, frame.linearDepthTexture);
+	renderGraph->Write(blurAPass, frame.smoothATexture);
+
+	// Pass 4: Blur depth B
+	RenderGraphPassID blurBPass = renderGraph->AddPass("Blur depth B", ExecuteBlurBPass, this);
+	renderGraph->Read(blurBPass, frame.smoothATexture);
+	renderGraph->Write(blurBPass, frame.smoothBTexture);
+
+	// Pass 5: Water rendering into the current framebuffer
+	bool useBlur = dstate.blurEnabled && dstate.debugType != FluidDebugType::Depth;
+	frame.finalDepthTexture = useBlur ? frame.smoothBTexture : frame.linearDepthTexture;
+	RenderGraphPassID waterPass = renderGraph->AddPass("Water", ExecuteWaterPass, this, true);
+	renderGraph->Read(waterPass, frame.finalDepthTexture);
+	renderGraph->Read(waterPass, frame.sceneTexture);
+	if(IsThicknessRequired(dstate.debugType))
+		renderGraph->Read(waterPass, frame.thicknessTexture);
+
+	renderGraph->Compile();
+	renderGraph->Execute(renderer);
 }
 
 void CScreenSpaceFluidRendering::Render(const CCamera &cam, const uint32_t numPointSprites, const SSFDrawingOptions &dstate, const int wW, const int wH, const float particleRadius) {
@@ -17,9 +17,11 @@
 #include <glm/gtc/matrix_transform.hpp>
 
 #include "GLSL.h"
+#include "ShaderCache.h"
 #include "Texture.h"
 #include "TextureCubemap.h"
 #include "FBO.h"
+#include "RenderGraph.h"
 #include "SphericalPointSprites.h"
 #include "Renderer.h"
 #include "Camera.hpp"
@@ -27,7 +29,6 @@
 #include "GeometryVBO.h"
 
 #include "AllShaders.hpp"
-#include "AllFBOs.hpp"
 
 struct FluidColor {
 	glm::vec4 color;
@@ -102,6 +103,23 @@ struct SSFDrawingOptions {
 	}
 };
 
+// Per frame state, which the render graph passes needs
+struct SSFRGraphFrame {
+	const CCamera *cam;
+	const SSFDrawingOptions *options;
+	glm::mat4 orthoMVP;
+	float nearDepth;
+	float farDepth;
+	float particleRadius;
+	uint32_t numPointSprites;
+	RenderGraphTextureID sceneTexture;
+	RenderGraphTextureID linearDepthTexture;
+	RenderGraphTextureID thicknessTexture;
+	RenderGraphTextureID smoothATexture;
+	RenderGraphTextureID smoothBTexture;
+	RenderGraphTextureID finalDepthTexture;
+};
+
 constexpr float MAX_DEPTH = 0.9999f;
 constexpr float MIN_DEPTH = -9999.0f;
 
@@ -111,8 +129,8 @@ private:
 	CSphericalPointSprites *pointSprites;
 	GeometryVBO *fullscreenQuad;
 
-	CSSFRFullFBO *fullFrameBuffer;
-	CSSFRDepthFBO *depthFrameBuffer;
+	CRenderGraph *renderGraph;
+	SSFRGraphFrame graphFrame;
 
 	CPointSpritesShader *pointSpritesShader;
 	CPointsShader *pointsShader;
@@ -143,8 +161,14 @@ private:
 	void BlurDepthPass(const glm::mat4 &mvp, CTexture2D *depthTexture, const float dirX, const float dirY);
 	void WaterPass(const CCamera &cam, const glm::mat4 &mvp, CTexture2D *depthTexture, CTexture2D *thicknessTexture, const FluidColor &color, const FluidDebugType showType);
 	int CalcFBOSize(int size, float factor) { return (int)(size * factor); }
+	static bool IsThicknessRequired(const FluidDebugType showType);
+	static void ExecuteDepthPass(CRenderGraph &graph, void *userData);
+	static void ExecuteThicknessPass(CRenderGraph &graph, void *userData);
+	static void ExecuteBlurAPass(CRenderGraph &graph, void *userData);
+	static void ExecuteBlurBPass(CRenderGraph &graph, void *userData);
+	static void ExecuteWaterPass(CRenderGraph &graph, void *userData);
 public:
-	CScreenSpaceFluidRendering(const int width, const int height, CRenderer *renderer, CTextureCubemap *skyboxCubemap, CTexture2D *sceneTexture, CSphericalPointSprites *pointSprites, GeometryVBO *fullscreenQuad);
+	CScreenSpaceFluidRendering(const int width, const int height, CRenderer *renderer, CShaderCache *shaderCache, CTextureCubemap *skyboxCubemap, CTexture2D *sceneTexture, CSphericalPointSprites *pointSprites, GeometryVBO *fullscreenQuad);
 	~CScreenSpaceFluidRendering(void);
 	void Render(const CCamera &cam, const uint32_t numPointSprites, const SSFDrawingOptions &dstate, const int wW, const int wH, const float particleRadius);
 	void SetFBOFactor(float factor) {
@@ -0,0 +1,205 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - ShaderCache.cpp
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#include "ShaderCache.h"
+
+#include <assert.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <final_platform_layer.h>
+
+#include "OSLowLevel.h"
+
+constexpr uint32_t ShaderCacheFileMagic = 0x53435346; // FSCS
+constexpr uint32_t ShaderCacheFileVersion = 1;
+
+struct ShaderCacheFileHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t key;
+	uint32_t binaryFormat;
+	uint32_t binaryLength;
+};
+
+// FNV-1a 64-bit
+static uint64_t HashBytes(uint64_t hash, const void *data, const size_t size) {
+	const uint8_t *bytes = (const uint8_t *)data;
+	for(size_t i = 0; i < size; ++i) {
+		hash ^= bytes[i];
+		hash *= 0x100000001B3ULL;
+	}
+	return(hash);
+}
+
+static uint64_t HashString(uint64_t hash, const char *str) {
+	if(str != nullptr)
+		hash = HashBytes(hash, str, strlen(str) + 1);
+	return(hash);
+}
+
+CShaderCache::CShaderCache(const std::string &directory):
+	directory(directory),
+	driverHash(0xCBF29CE484222325ULL),
+	stats({}),
+	isBinarySupported(false),
+	hasCompletionStatus(false) {
+	driverHash = HashString(driverHash, (const char *)glGetString(GL_VENDOR));
+	driverHash = HashString(driverHash, (const char *)glGetString(GL_RENDERER));
+	driverHash = HashString(driverHash, (const char *)glGetString(GL_VERSION));
+
+	if(glGetProgramBinary != nullptr && glProgramBinary != nullptr && glProgramParameteri != nullptr) {
+		GLint formatCount = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+		isBinarySupported = formatCount > 0;
+	}
+
+	// NOTE(final): We only use the completion status query, glMaxShaderCompilerThreadsKHR() is not loaded and the driver picks the thread count
+	const char *extensions = (const char *)glGetString(GL_EXTENSIONS);
+	if(extensions != nullptr) {
+		hasCompletionStatus = strstr(extensions, "GL_KHR_parallel_shader_compile") != nullptr || strstr(extensions, "GL_ARB_parallel_shader_compile") != nullptr;
+	}
+
+	if(isBinarySupported && !fplDirectoryExists(this->directory.c_str())) {
+		if(!fplDirectoriesCreate(this->directory.c_str())) {
+			printf("Warning: Failed creating shader cache directory '%s'!\n", this->directory.c_str());
+		}
+	}
+}
+
+std::string CShaderCache::GetFilePath(const uint64_t key) const {
+	char filename[32];
+	snprintf(filename, sizeof(filename), "%016llx.bin", (unsigned long long)key);
+	return COSLowLevel::pathCombine(directory, filename);
+}
+
+uint64_t CShaderCache::ComputeKey(const std::vector<GLSLShaderSource> &sources) const {
+	uint64_t result = driverHash;
+	for(size_t i = 0; i < sources.size(); ++i) {
+		const GLSLShaderSource &source = sources[i];
+		result = HashBytes(result, &source.type, sizeof(source.type));
+		result = HashString(result, source.source.c_str());
+	}
+	return(result);
+}
+
+bool CShaderCache::LoadProgram(const GLuint program, const uint64_t key) {
+	if(!isBinarySupported)
+		return(false);
+
+	std::string filePath = GetFilePath(key);
+	fplFileHandle file;
+	if(!fplFileOpenBinary(filePath.c_str(), &file))
+		return(false);
+
+	bool result = false;
+	ShaderCacheFileHeader header = {};
+	size_t fileSize = fplFileGetSizeFromHandle(&file);
+	if(fileSize >= sizeof(header) && fplFileReadBlock(&file, sizeof(header), &header, sizeof(header)) == sizeof(header)) {
+		if(header.magic == ShaderCacheFileMagic &&
+			header.version == ShaderCacheFileVersion &&
+			header.key == key &&
+			header.binaryLength > 0 &&
+			header.binaryLength == fileSize - sizeof(header)) {
+			std::vector<uint8_t> binary(header.binaryLength);
+			if(fplFileReadBlock(&file, header.binaryLength, &binary[0], binary.size()) == header.binaryLength) {
+				// NOTE(final): The driver may reject a binary at any time, in that case the program is built from source again
+				glProgramBinary(program, header.binaryFormat, &binary[0], (GLsizei)header.binaryLength);
+				GLint r = GL_FALSE;
+				glGetProgramiv(program, GL_LINK_STATUS, &r);
+				result = r == GL_TRUE;
+			}
+		}
+	}
+	fplFileClose(&file);
+	return(result);
+}
+
+void CShaderCache::SaveProgram(const GLuint program, const uint64_t key) {
+	if(!isBinarySupported)
+		return;
+
+	GLint binaryLength = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+	if(binaryLength <= 0)
+		return;
+
+	std::vector<uint8_t> binary(binaryLength);
+	GLenum binaryFormat = 0;
+	GLsizei writtenLength = 0;
+	glGetProgramBinary(program, binaryLength, &writtenLength, &binaryFormat, &binary[0]);
+	if(writtenLength <= 0)
+		return;
+
+	ShaderCacheFileHeader header = {};
+	header.magic = ShaderCacheFileMagic;
+	header.version = ShaderCacheFileVersion;
+	header.key = key;
+	header.binaryFormat = binaryFormat;
+	header.binaryLength = (uint32_t)writtenLength;
+
+	std::string filePath = GetFilePath(key);
+	fplFileHandle file;
+	if(fplFileCreateBinary(filePath.c_str(), &file)) {
+		fplFileWriteBlock(&file, &header, sizeof(header));
+		fplFileWriteBlock(&file, &binary[0], header.binaryLength);
+		fplFileClose(&file);
+	} else {
+		printf("Warning: Failed writing shader cache file '%s'!\n", filePath.c_str());
+	}
+}
+
+void CShaderCache::Add(CGLSL *shader) {
+	assert(shader != nullptr);
+	batch.push_back(shader);
+}
+
+bool CShaderCache::Build(const char *indent) {
+	double startTime = COSLowLevel::getTimeMilliSeconds();
+
+	// Kick off all programs first, cache hits are already linked after this
+	std::vector<bool> isCacheHit(batch.size());
+	for(size_t i = 0; i < batch.size(); ++i) {
+		isCacheHit[i] = batch[i]->beginLink(this);
+	}
+
+	// Finish programs in order of completion, without the completion status this blocks on each program in order
+	bool result = true;
+	uint32_t hitCount = 0;
+	size_t remainingCount = batch.size();
+	std::vector<bool> isFinished(batch.size());
+	while(remainingCount > 0) {
+		bool anyFinished = false;
+		for(size_t i = 0; i < batch.size(); ++i) {
+			if(isFinished[i] || !batch[i]->isLinkCompleted(hasCompletionStatus))
+				continue;
+			if(!batch[i]->endLink(this)) {
+				++stats.failedCount;
+				result = false;
+			}
+			if(isCacheHit[i])
+				++hitCount;
+			isFinished[i] = true;
+			anyFinished = true;
+			--remainingCount;
+		}
+		if(!anyFinished)
+			fplThreadYield();
+	}
+
+	stats.programCount += (uint32_t)batch.size();
+	stats.hitCount += hitCount;
+	stats.missCount += (uint32_t)batch.size() - hitCount;
+	double buildTime = COSLowLevel::getTimeMilliSeconds() - startTime;
+	stats.buildTime += buildTime;
+	printf("%sBuild %zu shader programs in %.2f ms (Cached: %u, Binary cache: %s, Parallel compile: %s)\n", indent, batch.size(), buildTime, hitCount, (isBinarySupported ? "yes" : "no"), (hasCompletionStatus ? "yes" : "no"));
+
+	batch.clear();
+	return(result);
+}
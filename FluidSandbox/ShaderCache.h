@@ -0,0 +1,55 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - ShaderCache.h
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <final_dynamic_opengl.h>
+
+#include "GLSL.h"
+
+struct ShaderCacheStats {
+	double buildTime;
+	uint32_t programCount;
+	uint32_t hitCount;
+	uint32_t missCount;
+	uint32_t failedCount;
+};
+
+// On-disk cache of linked program binaries (GL_ARB_get_program_binary).
+// A binary is stored per program in the cache directory, the key is a hash of all shader sources and the driver string, so a driver update invalidates all binaries.
+// Programs which are added to a batch are compiled and linked first and queried later, so a driver with GL_KHR_parallel_shader_compile can build them in parallel.
+class CShaderCache {
+private:
+	std::vector<CGLSL *> batch;
+	std::string directory;
+	uint64_t driverHash;
+	ShaderCacheStats stats;
+	bool isBinarySupported;
+	bool hasCompletionStatus;
+
+	std::string GetFilePath(const uint64_t key) const;
+public:
+	CShaderCache(const std::string &directory);
+
+	uint64_t ComputeKey(const std::vector<GLSLShaderSource> &sources) const;
+	bool LoadProgram(const GLuint program, const uint64_t key);
+	void SaveProgram(const GLuint program, const uint64_t key);
+
+	void Add(CGLSL *shader);
+	// Builds all added programs, either from the cache or from source. Returns false when at least one program failed to link.
+	bool Build(const char *indent);
+
+	inline bool IsBinarySupported() const { return isBinarySupported; }
+	inline bool HasCompletionStatus() const { return hasCompletionStatus; }
+	inline const ShaderCacheStats &GetStats() const { return stats; }
+};
@@ -0,0 +1,183 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - StartupGraph.cpp
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#include "StartupGraph.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+constexpr uint32_t StartupMaxThreadCount = 64;
+constexpr uint32_t StartupTimelineWidth = 40;
+
+CStartupGraph::CStartupGraph():
+	mutex({}),
+	condition({}),
+	runStartTime({}),
+	runDuration(0),
+	finishedCount(0),
+	workerTaskLeftCount(0),
+	threadCount(0) {
+	fplMutexInit(&mutex);
+	fplConditionInit(&condition);
+}
+
+CStartupGraph::~CStartupGraph() {
+	fplConditionDestroy(&condition);
+	fplMutexDestroy(&mutex);
+}
+
+StartupTaskID CStartupGraph::AddTask(const char *name, StartupTaskFunc *func, void *userData, const StartupTaskThread thread) {
+	assert(func != nullptr);
+	TaskNode task = {};
+	task.name = name;
+	task.func = func;
+	task.userData = userData;
+	task.thread = thread;
+	tasks.push_back(task);
+	return((StartupTaskID)tasks.size());
+}
+
+void CStartupGraph::DependsOn(const StartupTaskID task, const StartupTaskID dependency) {
+	assert(task > 0 && task <= tasks.size());
+	assert(dependency > 0 && dependency < task);
+	tasks[dependency - 1].dependents.push_back(task);
+	++tasks[task - 1].pendingCount;
+}
+
+int32_t CStartupGraph::TakeReadyTask(const bool isMainThread) {
+	// NOTE(final): The main thread only takes worker tasks when there is no worker thread, so the opengl tasks starts as soon as they are ready
+	bool canRunWorkerTasks = !isMainThread || threadCount == 1;
+	for(size_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex) {
+		const TaskNode &task = tasks[taskIndex];
+		if(task.isStarted || task.pendingCount > 0)
+			continue;
+		if((task.thread == StartupTaskThread::Main && isMainThread) || (task.thread == StartupTaskThread::Worker && canRunWorkerTasks))
+			return((int32_t)taskIndex);
+	}
+	return(-1);
+}
+
+void CStartupGraph::RunTasks(const uint32_t threadIndex) {
+	bool isMainThread = threadIndex == 0;
+	fplMutexLock(&mutex);
+	for(;;) {
+		if(finishedCount == tasks.size())
+			break;
+		if(!isMainThread && workerTaskLeftCount == 0)
+			break;
+
+		int32_t taskIndex = TakeReadyTask(isMainThread);
+		if(taskIndex == -1) {
+			fplConditionWait(&condition, &mutex, FPL_TIMEOUT_INFINITE);
+			continue;
+		}
+
+		TaskNode &task = tasks[taskIndex];
+		task.isStarted = true;
+		task.threadIndex = threadIndex;
+		if(task.thread == StartupTaskThread::Worker)
+			--workerTaskLeftCount;
+		task.startTime = fplTimestampElapsed(runStartTime, fplTimestampQuery());
+		fplMutexUnlock(&mutex);
+
+		task.func(task.userData);
+
+		fplSeconds endTime = fplTimestampElapsed(runStartTime, fplTimestampQuery());
+		fplMutexLock(&mutex);
+		task.endTime = endTime;
+		task.isFinished = true;
+		++finishedCount;
+		for(size_t i = 0; i < task.dependents.size(); ++i) {
+			TaskNode &dependent = tasks[task.dependents[i] - 1];
+			assert(dependent.pendingCount > 0);
+			--dependent.pendingCount;
+		}
+		fplConditionBroadcast(&condition);
+	}
+	fplMutexUnlock(&mutex);
+}
+
+void CStartupGraph::WorkerThreadProc(const fplThreadHandle *thread, void *data) {
+	WorkerContext *context = (WorkerContext *)data;
+	context->graph->RunTasks(context->threadIndex);
+}
+
+void CStartupGraph::Run(const uint32_t workerCount) {
+	finishedCount = 0;
+	workerTaskLeftCount = 0;
+	for(size_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex) {
+		if(tasks[taskIndex].thread == StartupTaskThread::Worker)
+			++workerTaskLeftCount;
+	}
+
+	runStartTime = fplTimestampQuery();
+
+	uint32_t maxWorkerCount = workerCount < workerTaskLeftCount ? workerCount : workerTaskLeftCount;
+	if(maxWorkerCount > StartupMaxThreadCount - 1)
+		maxWorkerCount = StartupMaxThreadCount - 1;
+
+	WorkerContext contexts[StartupMaxThreadCount];
+	fplThreadHandle *workerThreads[StartupMaxThreadCount];
+	uint32_t startedCount = 0;
+
+	// NOTE(final): The thread count must be known before any worker takes a task, so the workers are started with the mutex locked
+	fplMutexLock(&mutex);
+	for(uint32_t workerIndex = 0; workerIndex < maxWorkerCount; ++workerIndex) {
+		contexts[startedCount].graph = this;
+		contexts[startedCount].threadIndex = startedCount + 1;
+		fplThreadHandle *thread = fplThreadCreate(WorkerThreadProc, &contexts[startedCount]);
+		if(thread == nullptr) break;
+		workerThreads[startedCount++] = thread;
+	}
+	threadCount = startedCount + 1;
+	fplMutexUnlock(&mutex);
+
+	RunTasks(0);
+
+	if(startedCount > 0) {
+		fplThreadWaitForAll(workerThreads, startedCount, sizeof(fplThreadHandle *), FPL_TIMEOUT_INFINITE);
+	}
+
+	runDuration = fplTimestampElapsed(runStartTime, fplTimestampQuery());
+}
+
+void CStartupGraph::PrintTimeline(const char *indent) const {
+	fplSeconds workTime = 0;
+	for(size_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex)
+		workTime += tasks[taskIndex].endTime - tasks[taskIndex].startTime;
+
+	printf("%sStartup timeline: %.1f ms on %u threads, %.1f ms of work in %zu tasks\n", indent, runDuration * 1000.0, threadCount, workTime * 1000.0, tasks.size());
+	for(size_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex) {
+		const TaskNode &task = tasks[taskIndex];
+
+		char threadName[32];
+		if(task.threadIndex == 0)
+			snprintf(threadName, sizeof(threadName), "Main");
+		else
+			snprintf(threadName, sizeof(threadName), "Worker %u", task.threadIndex);
+
+		// Bar with the time range of the task over the total startup time
+		char bar[StartupTimelineWidth + 1];
+		memset(bar, ' ', StartupTimelineWidth);
+		bar[StartupTimelineWidth] = 0;
+		if(runDuration > 0) {
+			uint32_t first = (uint32_t)(task.startTime / runDuration * StartupTimelineWidth);
+			uint32_t last = (uint32_t)(task.endTime / runDuration * StartupTimelineWidth);
+			if(first > StartupTimelineWidth - 1)
+				first = StartupTimelineWidth - 1;
+			if(last > StartupTimelineWidth - 1)
+				last = StartupTimelineWidth - 1;
+			for(uint32_t i = first; i <= last; ++i)
+				bar[i] = '#';
+		}
+
+		printf("%s  %-32s %-10s %8.1f ms %8.1f ms |%s|\n", indent, task.name, threadName, task.startTime * 1000.0, (task.endTime - task.startTime) * 1000.0, bar);
+	}
+}
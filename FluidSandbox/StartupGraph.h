@@ -0,0 +1,76 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - StartupGraph.h
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include <final_platform_layer.h>
+
+// Zero is always a invalid id
+typedef uint32_t StartupTaskID;
+
+typedef void (StartupTaskFunc)(void *userData);
+
+enum class StartupTaskThread {
+	// Any worker thread, for CPU only work like decoding, parsing or packing
+	Worker = 0,
+	// Only the thread which calls Run(), required for everything which touches the opengl context
+	Main,
+};
+
+// Dependency graph for the application startup:
+// A task starts as soon as all tasks it depends on are finished, worker tasks run in parallel to the main thread tasks.
+// The start and end time of every task is recorded and printed as a timeline.
+class CStartupGraph {
+private:
+	struct TaskNode {
+		const char *name;
+		StartupTaskFunc *func;
+		void *userData;
+		std::vector<StartupTaskID> dependents;
+		StartupTaskThread thread;
+		uint32_t pendingCount;
+		uint32_t threadIndex;
+		fplSeconds startTime;
+		fplSeconds endTime;
+		bool isStarted;
+		bool isFinished;
+	};
+
+	struct WorkerContext {
+		CStartupGraph *graph;
+		uint32_t threadIndex;
+	};
+
+	std::vector<TaskNode> tasks;
+	fplMutexHandle mutex;
+	fplConditionVariable condition;
+	fplTimestamp runStartTime;
+	fplSeconds runDuration;
+	uint32_t finishedCount;
+	uint32_t workerTaskLeftCount;
+	uint32_t threadCount;
+
+	int32_t TakeReadyTask(const bool isMainThread);
+	void RunTasks(const uint32_t threadIndex);
+	static void WorkerThreadProc(const fplThreadHandle *thread, void *data);
+public:
+	CStartupGraph();
+	~CStartupGraph();
+
+	StartupTaskID AddTask(const char *name, StartupTaskFunc *func, void *userData, const StartupTaskThread thread = StartupTaskThread::Worker);
+	// A task can only depend on tasks which were added before, so the graph never contains a cycle
+	void DependsOn(const StartupTaskID task, const StartupTaskID dependency);
+
+	// Runs all tasks and returns when every task is finished, the calling thread must own the opengl context
+	void Run(const uint32_t workerCount);
+	void PrintTimeline(const char *indent) const;
+};
@@ -0,0 +1,202 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - StaticGeometry.cpp
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#include "StaticGeometry.h"
+
+#include <cfloat>
+#include <algorithm>
+
+CStaticGeometry::CStaticGeometry():
+	totalVertexCount(0),
+	totalIndexCount(0) {
+}
+
+CStaticGeometry::~CStaticGeometry() {
+	Clear();
+}
+
+void CStaticGeometry::Clear() {
+	for(size_t batchIndex = 0; batchIndex < batches.size(); ++batchIndex) {
+		StaticGeometryBatch &batch = batches[batchIndex];
+		delete batch.vbo;
+		batch.vbo = nullptr;
+	}
+	batches.clear();
+	buildBatches.clear();
+	totalVertexCount = 0;
+	totalIndexCount = 0;
+}
+
+void CStaticGeometry::Begin() {
+	Clear();
+}
+
+CStaticGeometry::BuildCluster &CStaticGeometry::GetBuildCluster(const glm::vec4 &color, const glm::ivec3 &cell) {
+	// NOTE(final): Scenarios uses only a handful of colors and clusters, so a linear search is fine here
+	BuildBatch *batch = nullptr;
+	for(size_t batchIndex = 0; batchIndex < buildBatches.size(); ++batchIndex) {
+		if(buildBatches[batchIndex].color == color) {
+			batch = &buildBatches[batchIndex];
+			break;
+		}
+	}
+	if(batch == nullptr) {
+		buildBatches.push_back(BuildBatch());
+		batch = &buildBatches.back();
+		batch->color = color;
+	}
+
+	for(size_t clusterIndex = 0; clusterIndex < batch->clusters.size(); ++clusterIndex) {
+		if(batch->clusters[clusterIndex].cell == cell) {
+			return batch->clusters[clusterIndex];
+		}
+	}
+	batch->clusters.push_back(BuildCluster());
+	BuildCluster &result = batch->clusters.back();
+	result.min = glm::vec3(FLT_MAX);
+	result.max = glm::vec3(-FLT_MAX);
+	result.cell = cell;
+	result.actorCount = 0;
+	return(result);
+}
+
+void CStaticGeometry::AddPrimitive(const Primitives::Primitive &prim, const glm::mat4 &model, const glm::vec4 &color, const bool isNewActor) {
+	glm::vec3 center = glm::vec3(model[3]);
+	glm::ivec3 cell = glm::ivec3(glm::floor(center / ClusterCellSize));
+
+	BuildCluster &cluster = GetBuildCluster(color, cell);
+
+	if(isNewActor) {
+		++cluster.actorCount;
+	}
+
+	// NOTE(final): Normals are kept in object space, to match the lighting of the non-batched rigid bodies
+	GLuint baseVertex = (GLuint)cluster.verts.size();
+	for(size_t vertexIndex = 0; vertexIndex < prim.verts.size(); ++vertexIndex) {
+		const Primitives::Vertex &source = prim.verts[vertexIndex];
+		glm::vec3 worldPos = glm::vec3(model * glm::vec4(source.pos, 1.0f));
+		cluster.verts.push_back(Primitives::Vertex(worldPos, source.normal, source.texcoord));
+		cluster.min = glm::min(cluster.min, worldPos);
+		cluster.max = glm::max(cluster.max, worldPos);
+	}
+	for(size_t index = 0; index < prim.indices.size(); ++index) {
+		cluster.indices.push_back(baseVertex + prim.indices[index]);
+	}
+}
+
+void CStaticGeometry::End() {
+	for(size_t batchIndex = 0; batchIndex < buildBatches.size(); ++batchIndex) {
+		const BuildBatch &buildBatch = buildBatches[batchIndex];
+
+		// Count totals
+		size_t vertexCount = 0;
+		size_t indexCount = 0;
+		for(size_t clusterIndex = 0; clusterIndex < buildBatch.clusters.size(); ++clusterIndex) {
+			vertexCount += buildBatch.clusters[clusterIndex].verts.size();
+			indexCount += buildBatch.clusters[clusterIndex].indices.size();
+		}
+		if(indexCount == 0) {
+			continue;
+		}
+
+		// Concat all clusters into one vertex and index stream, so each cluster is a contiguous index range
+		StaticGeometryBatch batch = {};
+		batch.color = buildBatch.color;
+		std::vector<Primitives::Vertex> verts;
+		std::vector<GLuint> indices;
+		verts.reserve(vertexCount);
+		indices.reserve(indexCount);
+		for(size_t clusterIndex = 0; clusterIndex < buildBatch.clusters.size(); ++clusterIndex) {
+			const BuildCluster &buildCluster = buildBatch.clusters[clusterIndex];
+			GLuint baseVertex = (GLuint)verts.size();
+
+			StaticGeometryCluster cluster = {};
+			cluster.min = buildCluster.min;
+			cluster.max = buildCluster.max;
+			cluster.firstIndex = (GLuint)indices.size();
+			cluster.indexCount = (GLuint)buildCluster.indices.size();
+			cluster.actorCount = buildCluster.actorCount;
+			batch.clusters.push_back(cluster);
+
+			verts.insert(verts.end(), buildCluster.verts.begin(), buildCluster.verts.end());
+			for(size_t index = 0; index < buildCluster.indices.size(); ++index) {
+				indices.push_back(baseVertex + buildCluster.indices[index]);
+			}
+		}
+
+		batch.vbo = new GeometryVBO();
+		batch.vbo->BufferVertices(verts[0].data(), sizeof(Primitives::Vertex) * verts.size(), GL_STATIC_DRAW);
+		batch.vbo->BufferIndices(&indices[0], (GLuint)indices.size(), GL_STATIC_DRAW);
+		batch.vbo->triangleIndexCount = (GLuint)indices.size();
+
+		totalVertexCount += verts.size();
+		totalIndexCount += indices.size();
+		batches.push_back(batch);
+		batches.back().drawCounts.reserve(batch.clusters.size());
+		batches.back().drawOffsets.reserve(batch.clusters.size());
+	}
+
+	// Build data is not needed anymore
+	buildBatches.clear();
+}
+
+void CStaticGeometry::DrawBatch(CRenderer *renderer, const RenderPacket &packet, const glm::mat4 &viewProj) {
+	const StaticGeometryBatch &batch = *(const StaticGeometryBatch *)packet.userData;
+	CLightingShader *shader = static_cast<CLightingShader *>(packet.shader);
+	shader->uniformMatrix4(shader->ulocMVP, &viewProj[0][0]);
+	shader->uniform4f(shader->ulocColor, &batch.color[0]);
+	renderer->DrawPrimitiveRanges(batch.vbo, &batch.drawCounts[0], &batch.drawOffsets[0], (GLsizei)batch.drawCounts.size());
+}
+
+uint32_t CStaticGeometry::Enqueue(CRenderQueue &queue, CLightingShader *shader, const RenderState &state, Frustum &frustum) {
+	uint32_t result = 0;
+	for(size_t batchIndex = 0; batchIndex < batches.size(); ++batchIndex) {
+		StaticGeometryBatch &batch = batches[batchIndex];
+
+		// Collect visible clusters, adjacent clusters are merged into one range
+		batch.drawCounts.clear();
+		batch.drawOffsets.clear();
+		float nearestDepth = 1.0f;
+		GLuint rangeStart = 0;
+		GLuint rangeEnd = 0;
+		for(size_t clusterIndex = 0; clusterIndex < batch.clusters.size(); ++clusterIndex) {
+			const StaticGeometryCluster &cluster = batch.clusters[clusterIndex];
+			if(!frustum.containsBounds(cluster.min, cluster.max)) {
+				continue;
+			}
+			result += cluster.actorCount;
+			nearestDepth = std::min(nearestDepth, queue.ComputeDepth((cluster.min + cluster.max) * 0.5f));
+			if(rangeEnd > rangeStart && rangeEnd == cluster.firstIndex) {
+				rangeEnd += cluster.indexCount;
+			} else {
+				if(rangeEnd > rangeStart) {
+					batch.drawCounts.push_back((GLsizei)(rangeEnd - rangeStart));
+					batch.drawOffsets.push_back((const GLvoid *)(sizeof(GLuint) * rangeStart));
+				}
+				rangeStart = cluster.firstIndex;
+				rangeEnd = cluster.firstIndex + cluster.indexCount;
+			}
+		}
+		if(rangeEnd > rangeStart) {
+			batch.drawCounts.push_back((GLsizei)(rangeEnd - rangeStart));
+			batch.drawOffsets.push_back((const GLvoid *)(sizeof(GLuint) * rangeStart));
+		}
+		if(batch.drawCounts.size() == 0) {
+			continue;
+		}
+
+		RenderPacket packet = {};
+		packet.state = state;
+		packet.shader = shader;
+		packet.draw = DrawBatch;
+		packet.userData = &batch;
+		queue.Push(RenderPass::Opaque, packet, batch.vbo, nearestDepth);
+	}
+	return(result);
+}
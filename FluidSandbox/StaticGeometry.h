@@ -0,0 +1,84 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - StaticGeometry.h
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include <final_dynamic_opengl.h>
+
+#include <glm/glm.hpp>
+
+#include "GeometryVBO.h"
+#include "Primitives.h"
+#include "Frustum.h"
+#include "Renderer.h"
+#include "RenderQueue.h"
+#include "AllShaders.hpp"
+
+struct StaticGeometryCluster {
+	glm::vec3 min;
+	glm::vec3 max;
+	GLuint firstIndex;
+	GLuint indexCount;
+	uint32_t actorCount;
+};
+
+struct StaticGeometryBatch {
+	glm::vec4 color;
+	GeometryVBO *vbo;
+	std::vector<StaticGeometryCluster> clusters;
+	// Visible index ranges, filled when enqueued
+	std::vector<GLsizei> drawCounts;
+	std::vector<const GLvoid *> drawOffsets;
+};
+
+// Merges static geometry into one vertex/index buffer per material (color), split into spatial clusters for frustum culling
+class CStaticGeometry {
+private:
+	struct BuildCluster {
+		std::vector<Primitives::Vertex> verts;
+		std::vector<GLuint> indices;
+		glm::vec3 min;
+		glm::vec3 max;
+		glm::ivec3 cell;
+		uint32_t actorCount;
+	};
+
+	struct BuildBatch {
+		glm::vec4 color;
+		std::vector<BuildCluster> clusters;
+	};
+
+	std::vector<StaticGeometryBatch> batches;
+	std::vector<BuildBatch> buildBatches;
+	size_t totalVertexCount;
+	size_t totalIndexCount;
+
+	BuildCluster &GetBuildCluster(const glm::vec4 &color, const glm::ivec3 &cell);
+	static void DrawBatch(CRenderer *renderer, const RenderPacket &packet, const glm::mat4 &viewProj);
+public:
+	// Size of a cluster cell in world units
+	static constexpr float ClusterCellSize = 16.0f;
+
+	CStaticGeometry();
+	~CStaticGeometry();
+
+	void Clear();
+	void Begin();
+	void AddPrimitive(const Primitives::Primitive &prim, const glm::mat4 &model, const glm::vec4 &color, const bool isNewActor);
+	void End();
+
+	uint32_t Enqueue(CRenderQueue &queue, CLightingShader *shader, const RenderState &state, Frustum &frustum);
+
+	inline size_t GetBatchCount() const { return batches.size(); }
+	inline size_t GetVertexCount() const { return totalVertexCount; }
+	inline size_t GetIndexCount() const { return totalIndexCount; }
+};
@@ -0,0 +1,176 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - TextCache.cpp
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#include "TextCache.h"
+
+#include <string.h>
+
+CTextCache::CTextCache(const uint32_t maxLineCount, const uint32_t maxCharsPerLine):
+	vbo(nullptr),
+	maxLineCount(maxLineCount),
+	maxQuadsPerLine(maxCharsPerLine * 2), // Text and shadow
+	lineCount(0),
+	rebuildCount(0) {
+	assert(maxLineCount > 0 && maxCharsPerLine > 0);
+
+	uint32_t maxQuadCount = maxLineCount * maxQuadsPerLine;
+
+	lines.resize(maxLineCount);
+	Invalidate();
+
+	verts.resize(maxQuadCount * 4);
+	scratchIndices.resize(maxQuadsPerLine * 6);
+	drawCounts.reserve(maxLineCount);
+	drawOffsets.reserve(maxLineCount);
+
+	// NOTE(final): Quad indices never change, so they are written once for all slots
+	std::vector<GLuint> indices;
+	indices.resize(maxQuadCount * 6);
+	for(uint32_t quadIndex = 0; quadIndex < maxQuadCount; ++quadIndex) {
+		GLuint *quad = &indices[quadIndex * 6];
+		GLuint vertexIndex = quadIndex * 4;
+		quad[0] = vertexIndex + 0;
+		quad[1] = vertexIndex + 1;
+		quad[2] = vertexIndex + 2;
+		quad[3] = vertexIndex + 2;
+		quad[4] = vertexIndex + 3;
+		quad[5] = vertexIndex + 0;
+	}
+
+	vbo = new CVBO();
+	vbo->ReserveVertices(maxQuadCount * 4, FontVertexStride, GL_DYNAMIC_DRAW);
+	vbo->BufferIndices(&indices[0], (GLuint)indices.size(), GL_STATIC_DRAW);
+}
+
+CTextCache::~CTextCache() {
+	delete vbo;
+}
+
+void CTextCache::Invalidate() {
+	for(size_t lineIndex = 0; lineIndex < lines.size(); ++lineIndex) {
+		TextCacheLine &line = lines[lineIndex];
+		line.text.clear();
+		line.atlas = nullptr;
+		line.quadCount = 0;
+		line.isDirty = false;
+	}
+}
+
+void CTextCache::Begin() {
+	lineCount = 0;
+	rebuildCount = 0;
+}
+
+void CTextCache::AddLine(CRenderer *renderer, const FontAtlas *atlas, const float x, const float y, const float charHeight, const char *text, const glm::vec4 &color, const glm::vec4 &shadowColor) {
+	assert(lineCount < maxLineCount);
+	if(lineCount >= maxLineCount) {
+		return;
+	}
+
+	TextCacheLine &line = lines[lineCount];
+
+	// Text which does not fit into a slot is cut off
+	size_t maxCharCount = maxQuadsPerLine / 2;
+	size_t textLen = strlen(text);
+	if(textLen > maxCharCount) {
+		textLen = maxCharCount;
+	}
+
+	bool isChanged =
+		line.atlas != atlas ||
+		line.x != x ||
+		line.y != y ||
+		line.charHeight != charHeight ||
+		line.color != color ||
+		line.shadowColor != shadowColor ||
+		line.text.size() != textLen ||
+		line.text.compare(0, textLen, text, textLen) != 0;
+
+	if(isChanged) {
+		line.text.assign(text, textLen);
+		line.atlas = atlas;
+		line.x = x;
+		line.y = y;
+		line.charHeight = charHeight;
+		line.color = color;
+		line.shadowColor = shadowColor;
+
+		// Tessellate into the slot of this line, indices are static and written into a scratch buffer only
+		VBOWritter writer = {};
+		writer.verts = (GLfloat *)&verts[lineCount * maxQuadsPerLine * 4];
+		writer.indices = &scratchIndices[0];
+		writer.maxVertexCount = maxQuadsPerLine * 4;
+		writer.maxIndexCount = maxQuadsPerLine * 6;
+		renderer->DrawString(atlas, x, y, charHeight, line.text.c_str(), shadowColor, writer);
+		renderer->DrawString(atlas, x + 1, y + 1, charHeight, line.text.c_str(), color, writer);
+		line.quadCount = writer.vertexOffset / 4;
+		line.isDirty = true;
+		++rebuildCount;
+	}
+
+	++lineCount;
+}
+
+void CTextCache::UploadDirtyLines() {
+	// Adjacent dirty lines are uploaded as one range
+	uint32_t lineIndex = 0;
+	while(lineIndex < lineCount) {
+		if(!lines[lineIndex].isDirty) {
+			++lineIndex;
+			continue;
+		}
+		uint32_t firstLine = lineIndex;
+		while(lineIndex < lineCount && lines[lineIndex].isDirty) {
+			lines[lineIndex].isDirty = false;
+			++lineIndex;
+		}
+		uint32_t lastLine = lineIndex - 1;
+
+		size_t firstVertex = firstLine * maxQuadsPerLine * 4;
+		size_t endVertex = lastLine * maxQuadsPerLine * 4 + lines[lastLine].quadCount * 4;
+		if(endVertex > firstVertex) {
+			vbo->SubbufferVertices(&verts[firstVertex].color[0], firstVertex * FontVertexStride, (endVertex - firstVertex) * FontVertexStride);
+		}
+	}
+}
+
+void CTextCache::End() {
+	UploadDirtyLines();
+}
+
+void CTextCache::Draw(CRenderer *renderer) {
+	drawCounts.clear();
+	drawOffsets.clear();
+	for(uint32_t lineIndex = 0; lineIndex < lineCount; ++lineIndex) {
+		const TextCacheLine &line = lines[lineIndex];
+		if(line.quadCount > 0) {
+			drawCounts.push_back((GLsizei)(line.quadCount * 6));
+			drawOffsets.push_back((const GLvoid *)(sizeof(GLuint) * lineIndex * maxQuadsPerLine * 6));
+		}
+	}
+	if(drawCounts.size() == 0) {
+		return;
+	}
+
+	// Vertex (vec4, vec2, vec2)
+	vbo->Bind();
+
+	glEnableClientState(GL_COLOR_ARRAY);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glColorPointer(4, GL_FLOAT, FontVertexStride, (void *)(offsetof(FontVertex, color)));
+	glVertexPointer(2, GL_FLOAT, FontVertexStride, (void *)(offsetof(FontVertex, pos)));
+	glTexCoordPointer(2, GL_FLOAT, FontVertexStride, (void *)(offsetof(FontVertex, uv)));
+	renderer->DrawVBORanges(vbo, GL_TRIANGLES, &drawCounts[0], &drawOffsets[0], (GLsizei)drawCounts.size());
+	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+	glDisableClientState(GL_COLOR_ARRAY);
+
+	vbo->Unbind();
+}
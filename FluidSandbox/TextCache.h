@@ -0,0 +1,66 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - TextCache.h
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+#include "Renderer.h"
+#include "VBO.h"
+#include "FontAtlas.h"
+
+struct TextCacheLine {
+	std::string text;
+	const FontAtlas *atlas;
+	glm::vec4 color;
+	glm::vec4 shadowColor;
+	float x;
+	float y;
+	float charHeight;
+	uint32_t quadCount;
+	bool isDirty;
+};
+
+// Caches the glyph quads of text lines in fixed slots of one vertex buffer.
+// A line is only tessellated and uploaded again, when its text, font or position has changed.
+class CTextCache {
+private:
+	std::vector<TextCacheLine> lines;
+	std::vector<FontVertex> verts;
+	std::vector<GLuint> scratchIndices;
+	std::vector<GLsizei> drawCounts;
+	std::vector<const GLvoid *> drawOffsets;
+	CVBO *vbo;
+	uint32_t maxLineCount;
+	uint32_t maxQuadsPerLine;
+	uint32_t lineCount;
+	uint32_t rebuildCount;
+
+	void UploadDirtyLines();
+public:
+	CTextCache(const uint32_t maxLineCount, const uint32_t maxCharsPerLine);
+	~CTextCache();
+
+	void Begin();
+	void AddLine(CRenderer *renderer, const FontAtlas *atlas, const float x, const float y, const float charHeight, const char *text, const glm::vec4 &color, const glm::vec4 &shadowColor);
+	void End();
+
+	// Expects that the font shader and texture is already bound
+	void Draw(CRenderer *renderer);
+
+	void Invalidate();
+
+	// Number of lines which was rebuilt since the last Begin()
+	inline uint32_t GetRebuildCount() const { return rebuildCount; }
+	inline uint32_t GetLineCount() const { return lineCount; }
+};
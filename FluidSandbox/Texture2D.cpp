@@ -34,6 +34,35 @@ void CTexture2D::upload(const uint8_t* pixels)
 	unbind();
 }
 
+void CTexture2D::uploadLevels(const int faceCount, const int levelCount, const TextureLevelData *levels, const bool isCompressed)
+{
+	assert(faceCount == 1 || (faceCount == 6 && getTarget() == GL_TEXTURE_CUBE_MAP));
+	assert(levelCount > 0);
+	create();
+	bind();
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexParameteri(getTarget(), GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(getTarget(), GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	if (faceCount == 6)
+		glTexParameteri(getTarget(), GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+	glTexParameteri(getTarget(), GL_TEXTURE_MAG_FILTER, texMagFilter);
+	glTexParameteri(getTarget(), GL_TEXTURE_MIN_FILTER, texMinFilter);
+	glTexParameteri(getTarget(), GL_TEXTURE_MAX_LEVEL, levelCount - 1);
+	for (int faceIndex = 0; faceIndex < faceCount; ++faceIndex)
+	{
+		GLenum faceTarget = faceCount == 6 ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + faceIndex : getTarget();
+		for (int levelIndex = 0; levelIndex < levelCount; ++levelIndex)
+		{
+			const TextureLevelData &level = levels[faceIndex * levelCount + levelIndex];
+			if (isCompressed)
+				glCompressedTexImage2D(faceTarget, levelIndex, getInternalFormat(), level.width, level.height, 0, level.size, (const GLvoid*)level.data);
+			else
+				glTexImage2D(faceTarget, levelIndex, getInternalFormat(), level.width, level.height, 0, getFormat(), getType(), (const GLvoid*)level.data);
+		}
+	}
+	unbind();
+}
+
 void CTexture2D::resize(int width, int height)
 {
 	release();
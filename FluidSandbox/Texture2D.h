@@ -15,6 +15,14 @@
 
 #include "Texture.h"
 
+// One face or mip level of a texture, the size is only required for compressed data
+struct TextureLevelData {
+	const uint8_t *data;
+	GLsizei size;
+	GLint width;
+	GLint height;
+};
+
 class CTexture2D: public CTexture
 {
 private:
@@ -26,6 +34,8 @@ public:
 	CTexture2D(const GLuint target, const GLint internalFormat, const GLenum format, const GLenum type, const int width, const int height, const GLuint magFilter = GL_LINEAR, const GLuint minFilter = GL_LINEAR);
 	~CTexture2D(void);
 	virtual void upload(const uint8_t *pixels);
+	// Uploads a full mip chain for each face, the levels are stored face by face
+	void uploadLevels(const int faceCount, const int levelCount, const TextureLevelData *levels, const bool isCompressed);
 	void resize(int width, int height);
 	GLuint getTexMagFilter() { return texMagFilter; }
 	GLuint getTexMinFilter() { return texMinFilter; }
@@ -0,0 +1,306 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - TextureCache.cpp
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#include "TextureCache.h"
+#include "AssetPack.h"
+
+#include <assert.h>
+#include <string.h>
+#include <stdio.h>
+#include <algorithm>
+
+#include <final_platform_layer.h>
+
+// GL_EXT_texture_compression_s3tc
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#	define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#	define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+constexpr uint32_t TextureCacheFileMagic = 0x43544346; // FCTC
+constexpr uint32_t TextureCacheFileVersion = 1;
+
+struct TextureCacheFileHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t sourceSize;
+	uint64_t sourceModifyTime;
+	uint32_t kind;
+	uint32_t internalFormat;
+	uint32_t format;
+	uint32_t isCompressed;
+	uint32_t width;
+	uint32_t height;
+	uint32_t faceCount;
+	uint32_t levelCount;
+};
+
+// Followed by the pixel data of all levels, offsets are relative to the start of the file
+struct TextureCacheFileLevel {
+	uint64_t offset;
+	uint32_t size;
+	uint32_t width;
+	uint32_t height;
+	uint32_t reserved;
+};
+
+void TextureImage::Release() {
+	levels.clear();
+	pixels.clear();
+	COSLowLevel::unmapFile(&mapping);
+}
+
+void BuildTextureImageMips(TextureImage &image) {
+	assert(!image.isCompressed);
+	assert(image.width > 0 && image.height > 0 && image.faceCount > 0);
+
+	int levelCount = 1;
+	for(int size = std::max(image.width, image.height); size > 1; size >>= 1)
+		++levelCount;
+
+	size_t baseSize = (size_t)image.width * image.height * 4;
+	size_t faceSize = 0;
+	for(int levelIndex = 0; levelIndex < levelCount; ++levelIndex)
+		faceSize += (size_t)std::max(image.width >> levelIndex, 1) * std::max(image.height >> levelIndex, 1) * 4;
+	assert(image.pixels.size() >= baseSize * image.faceCount);
+
+	std::vector<uint8_t> pixels(faceSize * image.faceCount);
+	image.levels.resize(image.faceCount * levelCount);
+	for(int faceIndex = 0; faceIndex < image.faceCount; ++faceIndex) {
+		uint8_t *dst = &pixels[faceSize * faceIndex];
+		memcpy(dst, &image.pixels[baseSize * faceIndex], baseSize);
+
+		const uint8_t *src = dst;
+		int srcWidth = image.width;
+		int srcHeight = image.height;
+		dst += baseSize;
+		for(int levelIndex = 1; levelIndex < levelCount; ++levelIndex) {
+			int dstWidth = std::max(srcWidth >> 1, 1);
+			int dstHeight = std::max(srcHeight >> 1, 1);
+			for(int y = 0; y < dstHeight; ++y) {
+				const uint8_t *row0 = src + (size_t)std::min(y * 2, srcHeight - 1) * srcWidth * 4;
+				const uint8_t *row1 = src + (size_t)std::min(y * 2 + 1, srcHeight - 1) * srcWidth * 4;
+				uint8_t *dstRow = dst + (size_t)y * dstWidth * 4;
+				for(int x = 0; x < dstWidth; ++x) {
+					int x0 = std::min(x * 2, srcWidth - 1) * 4;
+					int x1 = std::min(x * 2 + 1, srcWidth - 1) * 4;
+					for(int c = 0; c < 4; ++c) {
+						dstRow[x * 4 + c] = (uint8_t)((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) >> 2);
+					}
+				}
+			}
+			src = dst;
+			dst += (size_t)dstWidth * dstHeight * 4;
+			srcWidth = dstWidth;
+			srcHeight = dstHeight;
+		}
+	}
+	image.pixels.swap(pixels);
+	image.levelCount = levelCount;
+
+	const uint8_t *data = &image.pixels[0];
+	for(int faceIndex = 0; faceIndex < image.faceCount; ++faceIndex) {
+		for(int levelIndex = 0; levelIndex < levelCount; ++levelIndex) {
+			TextureLevelData &level = image.levels[faceIndex * levelCount + levelIndex];
+			level.width = std::max(image.width >> levelIndex, 1);
+			level.height = std::max(image.height >> levelIndex, 1);
+			level.size = level.width * level.height * 4;
+			level.data = data;
+			data += level.size;
+		}
+	}
+}
+
+CTextureCache::CTextureCache(const std::string &directory, const bool useCompression):
+	directory(directory),
+	isCompressionSupported(false),
+	useCompression(useCompression) {
+	const char *extensions = (const char *)glGetString(GL_EXTENSIONS);
+	if(extensions != nullptr && strstr(extensions, "GL_EXT_texture_compression_s3tc") != nullptr) {
+		isCompressionSupported = glCompressedTexImage2D != nullptr && glGetCompressedTexImage != nullptr;
+	}
+	if(!fplDirectoryExists(this->directory.c_str())) {
+		if(!fplDirectoriesCreate(this->directory.c_str())) {
+			printf("Warning: Failed creating texture cache directory '%s'!\n", this->directory.c_str());
+		}
+	}
+}
+
+std::string CTextureCache::GetFilePath(const std::string &sourceFile) const {
+	// FNV-1a 64-bit of the source path
+	uint64_t hash = 0xCBF29CE484222325ULL;
+	for(size_t i = 0; i < sourceFile.size(); ++i) {
+		hash ^= (uint8_t)sourceFile[i];
+		hash *= 0x100000001B3ULL;
+	}
+	char filename[32];
+	snprintf(filename, sizeof(filename), "%016llx.ftc", (unsigned long long)hash);
+	return COSLowLevel::pathCombine(directory, filename);
+}
+
+bool CTextureCache::Load(const std::string &sourceFile, const TextureImageKind kind, TextureImage *outImage) const {
+	uint64_t sourceSize = 0;
+	uint64_t sourceModifyTime = 0;
+	if(!Assets::GetInfo(sourceFile.c_str(), &sourceSize, &sourceModifyTime))
+		return(false);
+
+	std::string filePath = GetFilePath(sourceFile);
+	COSLowLevel::MappedFile mapping;
+	if(!COSLowLevel::mapFile(filePath.c_str(), &mapping))
+		return(false);
+
+	// NOTE(final): Everything is validated against the file size, so a truncated or foreign file is just a cache miss
+	const TextureCacheFileHeader *header = (const TextureCacheFileHeader *)mapping.data;
+	bool isValid = mapping.size >= sizeof(TextureCacheFileHeader) &&
+		header->magic == TextureCacheFileMagic &&
+		header->version == TextureCacheFileVersion &&
+		header->sourceSize == sourceSize &&
+		header->sourceModifyTime == sourceModifyTime &&
+		header->kind == (uint32_t)kind &&
+		(header->isCompressed != 0) == IsCompressionEnabled() &&
+		header->faceCount == (kind == TextureImageKind::Cubemap ? 6u : 1u) &&
+		header->levelCount > 0 && header->levelCount <= 32 &&
+		mapping.size >= sizeof(TextureCacheFileHeader) + sizeof(TextureCacheFileLevel) * header->faceCount * header->levelCount;
+	if(!isValid) {
+		COSLowLevel::unmapFile(&mapping);
+		return(false);
+	}
+
+	TextureImage &image = *outImage;
+	image.kind = kind;
+	image.internalFormat = (GLint)header->internalFormat;
+	image.format = (GLenum)header->format;
+	image.width = (int)header->width;
+	image.height = (int)header->height;
+	image.faceCount = (int)header->faceCount;
+	image.levelCount = (int)header->levelCount;
+	image.isCompressed = header->isCompressed != 0;
+	image.levels.resize(image.faceCount * image.levelCount);
+	const TextureCacheFileLevel *fileLevels = (const TextureCacheFileLevel *)(mapping.data + sizeof(TextureCacheFileHeader));
+	for(size_t i = 0; i < image.levels.size(); ++i) {
+		const TextureCacheFileLevel &fileLevel = fileLevels[i];
+		if(fileLevel.offset > mapping.size || fileLevel.size > mapping.size - fileLevel.offset) {
+			image.levels.clear();
+			COSLowLevel::unmapFile(&mapping);
+			return(false);
+		}
+		TextureLevelData &level = image.levels[i];
+		level.data = mapping.data + fileLevel.offset;
+		level.size = (GLsizei)fileLevel.size;
+		level.width = (GLint)fileLevel.width;
+		level.height = (GLint)fileLevel.height;
+	}
+	image.mapping = mapping;
+	return(true);
+}
+
+void CTextureCache::Save(const std::string &sourceFile, const TextureImage &image) const {
+	assert(image.levels.size() == (size_t)(image.faceCount * image.levelCount));
+
+	TextureCacheFileHeader header = {};
+	header.magic = TextureCacheFileMagic;
+	header.version = TextureCacheFileVersion;
+	if(!Assets::GetInfo(sourceFile.c_str(), &header.sourceSize, &header.sourceModifyTime))
+		return;
+	header.kind = (uint32_t)image.kind;
+	header.internalFormat = (uint32_t)image.internalFormat;
+	header.format = (uint32_t)image.format;
+	header.isCompressed = image.isCompressed ? 1 : 0;
+	header.width = (uint32_t)image.width;
+	header.height = (uint32_t)image.height;
+	header.faceCount = (uint32_t)image.faceCount;
+	header.levelCount = (uint32_t)image.levelCount;
+
+	std::vector<TextureCacheFileLevel> fileLevels(image.levels.size());
+	uint64_t offset = sizeof(TextureCacheFileHeader) + sizeof(TextureCacheFileLevel) * fileLevels.size();
+	for(size_t i = 0; i < image.levels.size(); ++i) {
+		const TextureLevelData &level = image.levels[i];
+		TextureCacheFileLevel &fileLevel = fileLevels[i];
+		fileLevel.offset = offset;
+		fileLevel.size = (uint32_t)level.size;
+		fileLevel.width = (uint32_t)level.width;
+		fileLevel.height = (uint32_t)level.height;
+		offset += level.size;
+	}
+
+	std::string filePath = GetFilePath(sourceFile);
+	fplFileHandle file;
+	if(!fplFileCreateBinary(filePath.c_str(), &file)) {
+		printf("Warning: Failed writing texture cache file '%s'!\n", filePath.c_str());
+		return;
+	}
+	fplFileWriteBlock(&file, &header, sizeof(header));
+	fplFileWriteBlock(&file, &fileLevels[0], sizeof(TextureCacheFileLevel) * fileLevels.size());
+	for(size_t i = 0; i < image.levels.size(); ++i)
+		fplFileWriteBlock(&file, image.levels[i].data, image.levels[i].size);
+	fplFileClose(&file);
+}
+
+GLint CTextureCache::GetCompressedFormat(const TextureImage &image) const {
+	if(!IsCompressionEnabled() || image.isCompressed)
+		return(0);
+	// NOTE(final): Cubemaps are only used for the skybox and reflections, so alpha is dropped there
+	if(image.kind == TextureImageKind::Cubemap)
+		return(GL_COMPRESSED_RGB_S3TC_DXT1_EXT);
+	return(GL_COMPRESSED_RGBA_S3TC_DXT5_EXT);
+}
+
+bool CTextureCache::ReadCompressed(CTexture2D *texture, const TextureImage &source, TextureImage *outImage) const {
+	TextureImage &image = *outImage;
+	image.kind = source.kind;
+	image.internalFormat = texture->getInternalFormat();
+	image.format = source.format;
+	image.width = source.width;
+	image.height = source.height;
+	image.faceCount = source.faceCount;
+	image.levelCount = source.levelCount;
+	image.isCompressed = true;
+	image.levels.resize(source.levels.size());
+
+	texture->bind();
+	bool result = true;
+	size_t totalSize = 0;
+	std::vector<size_t> offsets(source.levels.size());
+	for(int faceIndex = 0; faceIndex < image.faceCount && result; ++faceIndex) {
+		GLenum faceTarget = image.faceCount == 6 ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + faceIndex : texture->getTarget();
+		for(int levelIndex = 0; levelIndex < image.levelCount; ++levelIndex) {
+			size_t index = faceIndex * image.levelCount + levelIndex;
+			GLint isCompressed = GL_FALSE;
+			GLint compressedSize = 0;
+			glGetTexLevelParameteriv(faceTarget, levelIndex, GL_TEXTURE_COMPRESSED, &isCompressed);
+			glGetTexLevelParameteriv(faceTarget, levelIndex, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &compressedSize);
+			if(isCompressed != GL_TRUE || compressedSize <= 0) {
+				result = false;
+				break;
+			}
+			image.levels[index] = source.levels[index];
+			image.levels[index].size = compressedSize;
+			offsets[index] = totalSize;
+			totalSize += compressedSize;
+		}
+	}
+	if(result) {
+		image.pixels.resize(totalSize);
+		for(int faceIndex = 0; faceIndex < image.faceCount; ++faceIndex) {
+			GLenum faceTarget = image.faceCount == 6 ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + faceIndex : texture->getTarget();
+			for(int levelIndex = 0; levelIndex < image.levelCount; ++levelIndex) {
+				size_t index = faceIndex * image.levelCount + levelIndex;
+				image.levels[index].data = &image.pixels[offsets[index]];
+				glGetCompressedTexImage(faceTarget, levelIndex, &image.pixels[offsets[index]]);
+			}
+		}
+	}
+	texture->unbind();
+
+	if(!result)
+		image.Release();
+	return(result);
+}
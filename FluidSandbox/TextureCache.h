@@ -0,0 +1,80 @@
+/*
+======================================================================================================================
+	Fluid Sandbox - TextureCache.h
+
+	Copyright (C) Torsten Spaete 2011-2021. All rights reserved.
+	MPL v2 licensed. See LICENSE.txt for more details.
+======================================================================================================================
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <final_dynamic_opengl.h>
+
+#include "Texture2D.h"
+#include "OSLowLevel.h"
+
+enum class TextureImageKind : uint32_t {
+	Texture2D = 0,
+	Cubemap,
+};
+
+// Texture data which is ready for upload: All faces with a full mip chain, either in decoded pixels or in a mapped cache file
+struct TextureImage {
+	std::vector<TextureLevelData> levels;
+	std::vector<uint8_t> pixels;
+	COSLowLevel::MappedFile mapping;
+	TextureImageKind kind;
+	GLint internalFormat;
+	GLenum format;
+	int width;
+	int height;
+	int faceCount;
+	int levelCount;
+	bool isCompressed;
+
+	TextureImage():
+		mapping({}),
+		kind(TextureImageKind::Texture2D),
+		internalFormat(GL_RGBA8),
+		format(GL_RGBA),
+		width(0),
+		height(0),
+		faceCount(0),
+		levelCount(0),
+		isCompressed(false) {
+	}
+
+	void Release();
+};
+
+// Builds the full mip chain for RGBA8 faces by a 2x2 box filter, the pixels must contain the base level of all faces
+void BuildTextureImageMips(TextureImage &image);
+
+// On-disk cache of preprocessed textures: Pre-split cubemap faces and precomputed mip chains, optionally block compressed by the driver.
+// Cache files are stored per source file and are rebuilt when the size or the modification time of the source changes.
+class CTextureCache {
+private:
+	std::string directory;
+	bool isCompressionSupported;
+	bool useCompression;
+
+	std::string GetFilePath(const std::string &sourceFile) const;
+public:
+	CTextureCache(const std::string &directory, const bool useCompression);
+
+	// Maps the cache file and points the levels directly into the mapping, fails when there is no cache file or when it is outdated
+	bool Load(const std::string &sourceFile, const TextureImageKind kind, TextureImage *outImage) const;
+	void Save(const std::string &sourceFile, const TextureImage &image) const;
+
+	// Returns the internal format for the texture, when a decoded image should be compressed by the driver
+	GLint GetCompressedFormat(const TextureImage &image) const;
+	// Reads back the compressed levels from the texture which was uploaded with the compressed format
+	bool ReadCompressed(CTexture2D *texture, const TextureImage &source, TextureImage *outImage) const;
+
+	inline bool IsCompressionEnabled() const { return useCompression && isCompressionSupported; }
+};
@@ -9,8 +9,8 @@
 
 #include "TextureCubemap.h"
 
-CTextureCubemap::CTextureCubemap(const int width, const int height)
-	:CTexture2D(GL_TEXTURE_CUBE_MAP, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, width, height)
+CTextureCubemap::CTextureCubemap(const int width, const int height, const GLint internalFormat)
+	:CTexture2D(GL_TEXTURE_CUBE_MAP, internalFormat, GL_RGBA, GL_UNSIGNED_BYTE, width, height)
 {
 }
 
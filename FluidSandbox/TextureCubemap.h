@@ -15,7 +15,7 @@ class CTextureCubemap: public CTexture2D
 {
 protected:
 public:
-	CTextureCubemap(const int width, const int height);
+	CTextureCubemap(const int width, const int height, const GLint internalFormat = GL_RGBA8);
 	~CTextureCubemap(void);
 	virtual void Upload(const uint8_t *pixels);
 };
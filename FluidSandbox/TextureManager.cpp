@@ -12,6 +12,8 @@
 #include "TextureManager.h"
 
 #include <string>
+#include <string.h>
+#include <algorithm>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb/stb_image.h>
@@ -21,10 +23,16 @@
 
 #include <final_platform_layer.h>
 
-CTextureManager::CTextureManager(void) {
+#include "OSLowLevel.h"
+#include "AssetPack.h"
+
+CTextureManager::CTextureManager(CTextureCache *cache):
+	cache(cache),
+	nextLoadIndex(0) {
 }
 
 CTextureManager::~CTextureManager(void) {
+	finishLoading();
 	for(std::map<std::string, CTexture *>::const_iterator iter = nameToTextureMap.begin();
 		iter != nameToTextureMap.end(); ++iter) {
 		CTexture *tex = (*iter).second;
@@ -169,34 +177,27 @@ public:
 	static bool LoadFromFile(const char *filename, const int requiredComponents, STBBitmap *output) {
 		// NOTE(final): Context should be released automatically when functions goes out-of-scope, regardless if failed or not
 		LoadContext ctx = LoadContext();
+		ctx.ignoreFileAndData = true;
 		std::cout << "Load image file '" << filename << "'" << std::endl;
-		if(!fplFileOpenBinary(filename, &ctx.file)) {
+		AssetData asset;
+		if(!Assets::Load(filename, &asset)) {
 			std::cerr << "Failed to load the image file '" << filename << "'!" << std::endl;
 			ctx.Release();
 			return(false);
 		}
-		ctx.dataSize = fplFileGetSizeFromHandle(&ctx.file);
-		ctx.data = new uint8_t[ctx.dataSize];
-		size_t read = fplFileReadBlock(&ctx.file, ctx.dataSize, ctx.data, ctx.dataSize);
-		if(read != ctx.dataSize) {
-			std::cerr << "Failed to load image file '" << filename << "'! Only " << read << " was read from " << ctx.dataSize << " bytes." << std::endl;
-			ctx.Release();
-			return(false);
-		}
 		std::cout << "Successfully loaded image file '" << filename << "'" << std::endl;
-		fplFileClose(&ctx.file); // File is not needed anymore
 
-		std::cout << "  Decode image file '" << filename << "' with size of " << ctx.dataSize << std::endl;
+		// NOTE(final): Pack entries are decoded directly from the mapped pack, without copying the file data first
+		std::cout << "  Decode image file '" << filename << "' with size of " << asset.size << std::endl;
 		int width = 0, height = 0, components = 0;
-		assert(ctx.dataSize <= INT32_MAX);
-		ctx.pixels = stbi_load_from_memory((stbi_uc const *)ctx.data, (int)ctx.dataSize, &width, &height, &components, requiredComponents);
+		assert(asset.size <= INT32_MAX);
+		ctx.pixels = stbi_load_from_memory((stbi_uc const *)asset.data, (int)asset.size, &width, &height, &components, requiredComponents);
+		asset.Release(); // File data is not needed anymore
 		if(ctx.pixels == nullptr) {
 			std::cerr << "  Failed to decode image file '" << filename << "'! Maybe the format is unsupported?" << std::endl;
 			ctx.Release();
 			return(false);
 		}
-		delete[] ctx.data; // File data is not needed anymore
-		ctx.data = nullptr;
 
 		int bitsPerPixel = components * 8;
 		std::cout << "  Successfully decoded image file '" << filename << "':" << std::endl;
@@ -220,7 +221,7 @@ public:
 	}
 };
 
-CTextureCubemap *CTextureManager::loadCubemap(const char *filename) {
+static bool DecodeCubemap(const char *filename, TextureImage *outImage) {
 	const int CUBEMAPOFFSETS[6][2] = {
 		{2, 1},
 		{0, 1},
@@ -231,63 +232,48 @@ CTextureCubemap *CTextureManager::loadCubemap(const char *filename) {
 	};
 
 	std::cout << "Load cubemap from file '" << filename << "'..." << std::endl;
-	STBBitmap image = {};
-	if(!STBBitmap::LoadFromFile(filename, 4, &image)) {
+	STBBitmap bitmap = {};
+	if(!STBBitmap::LoadFromFile(filename, 4, &bitmap)) {
 		std::cerr << "  Failed to load the cubemap from file '" << filename << "'. See previous logs for more details!" << std::endl;
-		return(nullptr);
+		return(false);
 	}
 	std::cout << "Successfully loaded cubemap from file '" << filename << "' successfully" << std::endl;
 
-	CTextureCubemap *result = nullptr;
+	int stride = bitmap.width * 4;
 
-	int stride = image.width * 4;
-
-		// Now we have to get the cubemap dimensions
-	int cubemapWidth = image.width / 4;
-	int cubemapHeight = image.height / 3;
+	// Now we have to get the cubemap dimensions
+	int cubemapWidth = bitmap.width / 4;
+	int cubemapHeight = bitmap.height / 3;
 	int cubemapStride = cubemapWidth * 4;
 
 	std::cout << "    Creating cubemap faces with dimension " << cubemapWidth << "*" << cubemapHeight << std::endl;
 
-	// Allocate 6 textures for the 6 faces and load it (32-bit)
+	TextureImage &image = *outImage;
+	image.kind = TextureImageKind::Cubemap;
+	image.width = cubemapWidth;
+	image.height = cubemapHeight;
+	image.faceCount = 6;
+
+	// Copy the 6 faces (32-bit) out of the cross, one row at a time
 	size_t faceSize = 4 * cubemapWidth * cubemapHeight;
-	const uint8_t *pixels = image.pixels;
+	const uint8_t *pixels = bitmap.pixels;
 	assert(pixels != nullptr);
-	uint8_t *texturesData = new uint8_t[faceSize * 6];
+	image.pixels.resize(faceSize * 6);
 	for(int i = 0; i < 6; i++) {
-		uint8_t *faceData = &texturesData[faceSize * i];
+		uint8_t *faceData = &image.pixels[faceSize * i];
 		int xOffset = CUBEMAPOFFSETS[i][0];
 		int yOffset = CUBEMAPOFFSETS[i][1];
+		for(int yDst = 0; yDst < cubemapHeight; yDst++) {
+			int y = yOffset * cubemapHeight + yDst;
+			const uint8_t *srcRow = &pixels[(bitmap.height - 1 - y) * stride + xOffset * cubemapStride];
+			memcpy(&faceData[yDst * cubemapStride], srcRow, cubemapStride);
+		}
 
 #ifdef CUBEMAP_DEBUG
 		STBBitmap tempBitmap = STBBitmap::Alloc(cubemapWidth, cubemapHeight, 4);
-		uint8_t *tempPixels = tempBitmap.pixels;
-		assert(tempPixels != nullptr);
-#endif
-
-		int yDst = 0;
-		for(int y = (yOffset * cubemapHeight); y < ((yOffset * cubemapHeight) + cubemapHeight); y++) {
-			int xDst = 0;
-			int yLineSrc = (image.height - 1 - y) * stride;
-			int yLineDst = yDst * cubemapStride;
-			for(int x = (xOffset * cubemapWidth); x < ((xOffset * cubemapWidth) + cubemapWidth); x++) {
-				// RGBA
-				faceData[(yLineDst + xDst * 4) + 0] = pixels[(yLineSrc + x * 4) + 0];
-				faceData[(yLineDst + xDst * 4) + 1] = pixels[(yLineSrc + x * 4) + 1];
-				faceData[(yLineDst + xDst * 4) + 2] = pixels[(yLineSrc + x * 4) + 2];
-				faceData[(yLineDst + xDst * 4) + 3] = pixels[(yLineSrc + x * 4) + 3];
-#ifdef CUBEMAP_DEBUG
-				tempPixels[(yLineDst + xDst * 4) + 0] = pixels[(yLineSrc + x * 4) + 0];
-				tempPixels[(yLineDst + xDst * 4) + 1] = pixels[(yLineSrc + x * 4) + 1];
-				tempPixels[(yLineDst + xDst * 4) + 2] = pixels[(yLineSrc + x * 4) + 2];
-				tempPixels[(yLineDst + xDst * 4) + 3] = pixels[(yLineSrc + x * 4) + 3];
-#endif
-				xDst++;
-			}
-			yDst++;
-		}
+		assert(tempBitmap.pixels != nullptr);
+		memcpy(tempBitmap.pixels, faceData, faceSize);
 
-#ifdef CUBEMAP_DEBUG
 		size_t homePathLen = fplGetHomePath(nullptr, 0) + 1;
 		std::string homePath;
 		homePath.reserve(homePathLen);
@@ -313,56 +299,176 @@ CTextureCubemap *CTextureManager::loadCubemap(const char *filename) {
 		tempBitmap.Release();
 #endif
 	}
-	image.Release();
+	bitmap.Release();
 
-	result = new CTextureCubemap(cubemapWidth, cubemapHeight);
-	result->Upload(texturesData);
-	std::cout << "Uploaded cubemap texture -> " << result->getID() << std::endl;
-
-	delete[] texturesData;
-
-	return result;
+	return(true);
 }
 
-CTexture2D *CTextureManager::load2D(const char *filename) {
+static bool Decode2D(const char *filename, TextureImage *outImage) {
 	std::cout << "Load 2D texture from file '" << filename << "'..." << std::endl;
-	STBBitmap image = {};
-	if(!STBBitmap::LoadFromFile(filename, 4, &image)) {
+	STBBitmap bitmap = {};
+	if(!STBBitmap::LoadFromFile(filename, 4, &bitmap)) {
 		std::cerr << "Failed to load the 2D texture from file '" << filename << "'. See previous logs for more details!" << std::endl;
-		return(nullptr);
+		return(false);
 	}
 	std::cout << "Successfully loaded 2D texture from file '" << filename << "' successfully" << std::endl;
 
-	uint8_t *textureData = new uint8_t[4 * image.width * image.height];
-	uint8_t *pixels = image.pixels;
-	for(int i = 0; i < image.width * image.height; i++) {
+	TextureImage &image = *outImage;
+	image.kind = TextureImageKind::Texture2D;
+	image.width = bitmap.width;
+	image.height = bitmap.height;
+	image.faceCount = 1;
+	image.pixels.resize(4 * bitmap.width * bitmap.height);
+	uint8_t *textureData = &image.pixels[0];
+	const uint8_t *pixels = bitmap.pixels;
+	for(int i = 0; i < bitmap.width * bitmap.height; i++) {
 		textureData[i * 4 + 0] = pixels[i * 4 + 2];
 		textureData[i * 4 + 1] = pixels[i * 4 + 1];
 		textureData[i * 4 + 2] = pixels[i * 4 + 0];
 		textureData[i * 4 + 3] = pixels[i * 4 + 3];
 	}
-	image.Release();
+	bitmap.Release();
+
+	return(true);
+}
+
+void CTextureManager::loadRequest(TextureLoadRequest *request) {
+	if(cache != nullptr && cache->Load(request->filename, request->kind, &request->image)) {
+		request->isCached = true;
+		request->isLoaded = true;
+		return;
+	}
+
+	bool decoded;
+	if(request->kind == TextureImageKind::Cubemap)
+		decoded = DecodeCubemap(request->filename.c_str(), &request->image);
+	else
+		decoded = Decode2D(request->filename.c_str(), &request->image);
+	if(decoded) {
+		BuildTextureImageMips(request->image);
+		request->isLoaded = true;
+	} else {
+		request->image.Release();
+	}
+}
+
+void CTextureManager::runLoadRequests() {
+	for(;;) {
+		uint32_t index = fplAtomicFetchAndAddU32(&nextLoadIndex, 1);
+		if(index >= loadRequests.size()) break;
+		loadRequest(loadRequests[index]);
+	}
+}
+
+void CTextureManager::loadThreadProc(const fplThreadHandle *thread, void *data) {
+	CTextureManager *manager = (CTextureManager *)data;
+	manager->runLoadRequests();
+}
+
+void CTextureManager::queue(const std::string &name, const std::string &filename, const TextureImageKind kind) {
+	assert(loadThreads.size() == 0);
+	TextureLoadRequest *request = new TextureLoadRequest();
+	request->name = name;
+	request->filename = filename;
+	request->kind = kind;
+	request->isCached = false;
+	request->isLoaded = false;
+	loadRequests.push_back(request);
+}
+
+void CTextureManager::queue2D(const std::string &name, const std::string &filename) {
+	queue(name, filename, TextureImageKind::Texture2D);
+}
+
+void CTextureManager::queueCubemap(const std::string &name, const std::string &filename) {
+	queue(name, filename, TextureImageKind::Cubemap);
+}
+
+void CTextureManager::beginLoading() {
+	assert(loadThreads.size() == 0);
+	if(loadRequests.size() == 0)
+		return;
+	nextLoadIndex = 0;
+	size_t threadCount = std::min((size_t)std::max(COSLowLevel::getNumCPUCores(), 2u) - 1, loadRequests.size());
+	for(size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex) {
+		fplThreadHandle *thread = fplThreadCreate(loadThreadProc, this);
+		if(thread == nullptr) break;
+		loadThreads.push_back(thread);
+	}
+}
 
-	CTexture2D *result = nullptr;
-	result = new CTexture2D(GL_TEXTURE_2D, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, image.width, image.height, GL_LINEAR, GL_LINEAR);
-	result->upload(textureData);
-	std::cout << "Uploaded 2D texture -> " << result->getID() << std::endl;
+CTexture2D *CTextureManager::uploadRequest(TextureLoadRequest *request) {
+	TextureImage &image = request->image;
+
+	// NOTE(final): A decoded image is uploaded with the compressed format, the driver compresses it and we read back the result for the cache
+	GLint compressedFormat = (cache != nullptr && !request->isCached) ? cache->GetCompressedFormat(image) : 0;
+	GLint internalFormat = compressedFormat != 0 ? compressedFormat : image.internalFormat;
+
+	CTexture2D *result;
+	if(image.kind == TextureImageKind::Cubemap)
+		result = new CTextureCubemap(image.width, image.height, internalFormat);
+	else
+		result = new CTexture2D(GL_TEXTURE_2D, internalFormat, image.format, GL_UNSIGNED_BYTE, image.width, image.height, GL_LINEAR, GL_LINEAR);
+	if(image.levelCount > 1)
+		result->setTexMinFilter(GL_LINEAR_MIPMAP_LINEAR);
+	result->uploadLevels(image.faceCount, image.levelCount, &image.levels[0], image.isCompressed);
+	std::cout << "Uploaded texture '" << request->name << "' with " << image.levelCount << " levels" << (request->isCached ? " from cache" : "") << " -> " << result->getID() << std::endl;
+
+	if(cache != nullptr && !request->isCached) {
+		if(compressedFormat != 0) {
+			TextureImage compressed;
+			if(cache->ReadCompressed(result, image, &compressed))
+				cache->Save(request->filename, compressed);
+			compressed.Release();
+		} else {
+			cache->Save(request->filename, image);
+		}
+	}
 
-	delete[] textureData;
+	return(result);
+}
+
+void CTextureManager::finishLoading() {
+	if(loadRequests.size() == 0)
+		return;
+
+	// The calling thread takes requests as well, so everything is still loaded when no worker thread could be started
+	runLoadRequests();
+	if(loadThreads.size() > 0) {
+		fplThreadWaitForAll(&loadThreads[0], loadThreads.size(), sizeof(fplThreadHandle *), FPL_TIMEOUT_INFINITE);
+		loadThreads.clear();
+	}
 
-	return result;
+	for(size_t i = 0; i < loadRequests.size(); ++i) {
+		TextureLoadRequest *request = loadRequests[i];
+		if(request->isLoaded) {
+			CTexture2D *texture = uploadRequest(request);
+			nameToTextureMap.insert(std::make_pair(request->name, texture));
+		}
+		request->image.Release();
+		delete request;
+	}
+	loadRequests.clear();
+	nextLoadIndex = 0;
+}
+
+void CTextureManager::loadQueued() {
+	assert(loadThreads.size() == 0);
+	runLoadRequests();
 }
 
 CTexture2D *CTextureManager::add2D(const std::string &name, const std::string &filename) {
-	CTexture2D *newTexture = load2D(filename.c_str());
-	nameToTextureMap.insert(std::make_pair(name, newTexture));
-	return newTexture;
+	queue2D(name, filename);
+	beginLoading();
+	finishLoading();
+	return (CTexture2D *)get(name);
 }
 
 CTextureCubemap *CTextureManager::addCubemap(const std::string &name, const std::string &filename) {
-	CTextureCubemap *newTexture = loadCubemap(filename.c_str());
-	nameToTextureMap.insert(std::make_pair(name, newTexture));
-	return newTexture;
+	queueCubemap(name, filename);
+	beginLoading();
+	finishLoading();
+	return (CTextureCubemap *)get(name);
 }
 
 CTextureFont *CTextureManager::addFont(const std::string &name, const FontAtlas &fontAtlas) {
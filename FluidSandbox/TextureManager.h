@@ -11,24 +11,55 @@
 
 #include <map>
 #include <string>
+#include <vector>
 #include <iostream>
 
+#include <final_platform_layer.h>
+
 #include "Texture2D.h"
 #include "TextureCubemap.h"
 #include "TextureFont.h"
+#include "TextureCache.h"
 #include "FontAtlas.h"
 
 //#define CUBEMAP_DEBUG
 
+struct TextureLoadRequest {
+	std::string name;
+	std::string filename;
+	TextureImage image;
+	TextureImageKind kind;
+	bool isCached;
+	bool isLoaded;
+};
+
 class CTextureManager
 {
 private:
 	std::map<std::string, CTexture*> nameToTextureMap;
-	CTexture2D* load2D(const char* filename);
-	CTextureCubemap* loadCubemap(const char* filename);
+	std::vector<TextureLoadRequest *> loadRequests;
+	std::vector<fplThreadHandle *> loadThreads;
+	CTextureCache *cache;
+	volatile uint32_t nextLoadIndex;
+
+	static void loadThreadProc(const fplThreadHandle *thread, void *data);
+	void runLoadRequests();
+	void loadRequest(TextureLoadRequest *request);
+	CTexture2D* uploadRequest(TextureLoadRequest *request);
+	void queue(const std::string &name, const std::string &filename, const TextureImageKind kind);
 public:
-	CTextureManager(void);
+	// The cache is optional, without it all textures are decoded from their source files
+	CTextureManager(CTextureCache *cache = nullptr);
 	~CTextureManager(void);
+
+	// Queued textures are loaded or decoded on worker threads between beginLoading() and finishLoading(), the upload happens in finishLoading() on the calling thread.
+	void queue2D(const std::string &name, const std::string &filename);
+	void queueCubemap(const std::string &name, const std::string &filename);
+	void beginLoading();
+	void finishLoading();
+	// Loads or decodes the queued textures on the calling thread instead of beginLoading(), for callers which already runs this on a worker thread
+	void loadQueued();
+
 	CTexture2D* add2D(const std::string &name, const std::string &filename);
 	CTextureCubemap* addCubemap(const std::string &name, const std::string &filename);
 	CTextureFont *addFont(const std::string &name, const FontAtlas &fontAtlas);
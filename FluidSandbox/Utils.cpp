@@ -8,8 +8,11 @@
 */
 
 #include "Utils.h"
+#include "AssetPack.h"
 
 #include <sstream>
+#include <stdlib.h>
+#include <string.h>
 
 namespace Utils {
 	const char *getShaderTypeToString(const GLuint what) {
@@ -66,11 +69,17 @@ namespace Utils {
 		} else str.erase(str.begin(), str.end());
 	}
 
-	void attachShaderFromFile(CGLSL *shader, const GLuint what, const std::string &filename, const char *indent) {
+	void addShaderSourceFromFile(CGLSL *shader, const GLuint what, const std::string &filename, const char *indent) {
 		const char *whatName = getShaderTypeToString(what);
 		printf("%sLoad %s shader from file '%s'\n", indent, whatName, filename.c_str());
-		std::string temp = COSLowLevel::getTextFileContent(filename);
-		shader->attachShader(what, temp.c_str());
+		AssetData source;
+		if(!Assets::Load(filename.c_str(), &source)) {
+			printf("%sFailed loading %s shader from file '%s'!\n", indent, whatName, filename.c_str());
+			shader->addShaderSource(what, "");
+			return;
+		}
+		shader->addShaderSource(what, source.data);
+		source.Release();
 	}
 
 	std::vector<char> toCharVector(const std::string &source) {
@@ -110,27 +119,30 @@ namespace Utils {
 	}
 
 	float toFloat(const std::string &str) {
-		std::stringstream sstr;
-		float f;
-		sstr << str;
-		sstr >> f;
-		return f;
+		return toFloat(str.c_str());
 	}
 
 	int32_t toS32(const std::string &str) {
-		std::stringstream sstr;
-		int32_t i;
-		sstr << str;
-		sstr >> i;
-		return i;
+		return toS32(str.c_str());
 	}
 
 	uint32_t toU32(const std::string &str) {
-		std::stringstream sstr;
-		uint32_t i;
-		sstr << str;
-		sstr >> i;
-		return i;
+		return toU32(str.c_str());
+	}
+
+	float toFloat(const char *str) {
+		float result = strtof(str, nullptr);
+		return(result);
+	}
+
+	int32_t toS32(const char *str) {
+		int32_t result = (int32_t)strtol(str, nullptr, 10);
+		return(result);
+	}
+
+	uint32_t toU32(const char *str) {
+		uint32_t result = (uint32_t)strtoul(str, nullptr, 10);
+		return(result);
 	}
 
 	const std::string toString(const BoolValue &value) {
@@ -161,39 +173,53 @@ namespace Utils {
 	}
 
 	bool toBool(const std::string &str) {
-		if(str.size() == 0)
-			return false;
-		else
-			return (str.compare("true") == 0) || (str.compare("1") == 0);
+		return toBool(str.c_str());
+	}
+
+	bool toBool(const char *str) {
+		return (strcmp(str, "true") == 0) || (strcmp(str, "1") == 0);
+	}
+
+	// Parses up to maxCount comma separated floats, empty entries are skipped the same way split() does
+	static size_t parseFloatList(const char *str, float *outValues, const size_t maxCount) {
+		size_t count = 0;
+		const char *s = str;
+		for(;;) {
+			const char *e = s;
+			while(*e != 0 && *e != ',') ++e;
+			if(e > s) {
+				if(count < maxCount)
+					outValues[count] = strtof(s, nullptr);
+				++count;
+			}
+			if(*e == 0)
+				break;
+			s = e + 1;
+		}
+		return(count);
 	}
 
 	glm::vec3 toVec3(const std::string &str, const glm::vec3 &def) {
-		std::vector<std::string> splitted = split(str, ",");
-		if(splitted.size() == 3) {
-			std::string x = splitted[0];
-			std::string y = splitted[1];
-			std::string z = splitted[2];
-			trim(x);
-			trim(y);
-			trim(z);
-			return glm::vec3(toFloat(x), toFloat(y), toFloat(z));
+		return toVec3(str.c_str(), def);
+	}
+
+	glm::vec3 toVec3(const char *str, const glm::vec3 &def) {
+		float values[3];
+		if(parseFloatList(str, values, 3) == 3) {
+			return glm::vec3(values[0], values[1], values[2]);
 		} else {
 			return def;
 		}
 	}
 
 	glm::vec4 toVec4(const std::string &str, const glm::vec4 &def) {
-		std::vector<std::string> splitted = split(str.c_str(), ",");
-		if(splitted.size() == 4) {
-			std::string x = splitted[0];
-			std::string y = splitted[1];
-			std::string z = splitted[2];
-			std::string w = splitted[3];
-			trim(x);
-			trim(y);
-			trim(z);
-			trim(w);
-			return glm::vec4(toFloat(x), toFloat(y), toFloat(z), toFloat(w));
+		return toVec4(str.c_str(), def);
+	}
+
+	glm::vec4 toVec4(const char *str, const glm::vec4 &def) {
+		float values[4];
+		if(parseFloatList(str, values, 4) == 4) {
+			return glm::vec4(values[0], values[1], values[2], values[3]);
 		} else {
 			return def;
 		}
@@ -26,7 +26,7 @@ namespace Utils {
 	std::vector<std::string> split(const std::string &source, const char *delimiter);
 	void replaceString(std::string &value, const std::string &search, const std::string &replace);
 
-	void attachShaderFromFile(CGLSL *shader, const GLuint what, const std::string &filename, const char *indent);
+	void addShaderSourceFromFile(CGLSL *shader, const GLuint what, const std::string &filename, const char *indent);
 	
 	std::vector<char> toCharVector(const std::string &source);
 	bool toBool(const std::string &str);
@@ -35,6 +35,13 @@ namespace Utils {
 	uint32_t toU32(const std::string &str);
 	glm::vec3 toVec3(const std::string &str, const glm::vec3 &def = glm::vec3(0));
 	glm::vec4 toVec4(const std::string &str, const glm::vec4 &def = glm::vec4(0));
+	// Same as above, but parses directly from the characters without any allocation
+	bool toBool(const char *str);
+	float toFloat(const char *str);
+	int32_t toS32(const char *str);
+	uint32_t toU32(const char *str);
+	glm::vec3 toVec3(const char *str, const glm::vec3 &def = glm::vec3(0));
+	glm::vec4 toVec4(const char *str, const glm::vec4 &def = glm::vec4(0));
 	FluidType toFluidType(const char *str);
 	ActorMovementType toActorMovementType(const char *str);
 
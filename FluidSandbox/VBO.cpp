@@ -85,6 +85,12 @@ void CVBO::SubbufferIndices(const GLuint *indices, const GLuint start, const GLu
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
 
+void CVBO::SubbufferVertices(const GLfloat *vertices, const size_t offset, const size_t size) {
+	glBindBuffer(GL_ARRAY_BUFFER, vboId);
+	glBufferSubData(GL_ARRAY_BUFFER, (GLintptr)offset, (GLsizeiptr)size, vertices);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
 void CVBO::Bind() {
 	glBindBuffer(GL_ARRAY_BUFFER, vboId);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, iboId);
@@ -96,6 +102,21 @@ void CVBO::DrawElements(const GLenum mode, const GLuint count, const GLsizeiptr
 	glDrawElements(mode, count, GL_UNSIGNED_INT, (void *)(offset));
 }
 
+void CVBO::DrawElementsInstanced(const GLenum mode, const GLuint count, const GLsizeiptr offset, const GLuint instanceCount) {
+	glDrawElementsInstanced(mode, count, GL_UNSIGNED_INT, (void *)(offset), instanceCount);
+}
+
+void CVBO::DrawArrays(const GLenum mode, const GLint first, const GLsizei count) {
+	glDrawArrays(mode, first, count);
+}
+
+void CVBO::MultiDrawElements(const GLenum mode, const GLsizei *counts, const GLvoid *const *offsets, const GLsizei drawCount) {
+	if (drawCount == 1)
+		glDrawElements(mode, counts[0], GL_UNSIGNED_INT, offsets[0]);
+	else
+		glMultiDrawElements(mode, counts, GL_UNSIGNED_INT, offsets, drawCount);
+}
+
 void CVBO::Unbind() {
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -37,9 +37,13 @@ struct CVBO
 	void ReserveIndices(const GLuint count, const GLenum usage);
 	void ReserveVertices(const GLuint vertexCount, const size_t vertexStride, const GLenum usage);
 	void SubbufferIndices(const GLuint* indices, const GLuint start, const GLuint count);
+	void SubbufferVertices(const GLfloat* vertices, const size_t offset, const size_t size);
 	void Bind();
 	void Unbind();
 	void DrawElements(const GLenum mode, const GLuint count, const GLsizeiptr offset);
+	void DrawElementsInstanced(const GLenum mode, const GLuint count, const GLsizeiptr offset, const GLuint instanceCount);
+	void DrawArrays(const GLenum mode, const GLint first, const GLsizei count);
+	void MultiDrawElements(const GLenum mode, const GLsizei *counts, const GLvoid *const *offsets, const GLsizei drawCount);
 	VBOWritter BeginWrite();
 	void EndWrite(VBOWritter &writer);
 };
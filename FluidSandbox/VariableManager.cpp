@@ -2,6 +2,7 @@
 
 #include <iostream>
 #include <queue>
+#include <string.h>
 
 #include <glm/glm.hpp>
 
@@ -269,6 +270,9 @@ struct Variable {
 		kind(kind),
 		type(type) {
 	}
+
+	virtual ~Variable() {
+	}
 };
 
 struct MathVariable: public Variable {
@@ -578,6 +582,12 @@ void VariableManager::Parse(const fxmlTag *varsNode) {
 		vars.insert(std::pair<std::string, VariableValue>(name, value));
 	}
 
+	// Format the text of every variable once, instead of every time a variable is referenced
+	texts.clear();
+	for(auto p = vars.begin(); p != vars.end(); ++p) {
+		texts.insert(std::pair<std::string, std::string>(p->first, p->second.toString()));
+	}
+
 	// Remove raw variables tree
 	for(auto p = rawVars.begin(); p != rawVars.end(); ++p) {
 		Variable *var = p->second;
@@ -587,19 +597,46 @@ void VariableManager::Parse(const fxmlTag *varsNode) {
 	rawVars.clear();
 }
 
-std::string VariableManager::Resolve(const std::string &source) const {
-	if(source.length() > 0) {
-		std::string result = source;
-		for(auto p = vars.begin(); p != vars.end(); ++p) {
-			std::string search = p->first;
-			search = "{%" + search + "}";
-			VariableValue value = p->second;
-			std::string textValue = value.toString();
-			Utils::replaceString(result, search, textValue);
-		}
-		return(result);
+bool VariableManager::HasReferences(const char *source) {
+	bool result = strstr(source, "{%") != nullptr;
+	return(result);
+}
+
+void VariableManager::Resolve(const char *source, std::string &outResult) const {
+	outResult.clear();
+	const char *p = source;
+	const char *start;
+	while((start = strstr(p, "{%")) != nullptr) {
+		const char *end = strchr(start + 2, '}');
+		if(end == nullptr)
+			break;
+		outResult.append(p, start - p);
+		auto found = texts.find(std::string(start + 2, end - (start + 2)));
+		if(found != texts.end())
+			outResult += found->second;
+		else
+			outResult.append(start, end + 1 - start);
+		p = end + 1;
 	}
-	return(source);
+	outResult.append(p);
+}
+
+std::string VariableManager::Resolve(const std::string &source) const {
+	std::string result;
+	if(!HasReferences(source.c_str()))
+		return(source);
+	Resolve(source.c_str(), result);
+	return(result);
+}
+
+const VariableValue *VariableManager::FindReference(const char *source) const {
+	size_t len = strlen(source);
+	if(len < 4 || source[0] != '{' || source[1] != '%' || source[len - 1] != '}')
+		return(nullptr);
+	auto found = vars.find(std::string(source + 2, len - 3));
+	if(found == vars.end())
+		return(nullptr);
+	return(&found->second);
 }
 
 VariableValue::VariableValue(const ValueType type):
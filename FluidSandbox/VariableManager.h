@@ -38,11 +38,19 @@ struct VariableValue {
 
 struct VariableManager {
 private:
-	
+	// Text of every variable, formatted once after parsing
+	std::map<std::string, std::string> texts;
 public:
 	std::map<std::string, VariableValue> vars;
 	VariableManager();
 	void Parse(const fxmlTag *varsNode);
+
+	// Returns true when the source contains at least one variable reference like "{%name}"
+	static bool HasReferences(const char *source);
+	// Replaces all variable references in a single pass over the source, unknown references are kept as-is
+	void Resolve(const char *source, std::string &outResult) const;
 	std::string Resolve(const std::string &source) const;
+	// Returns the variable when the whole source is a single reference, so typed values can be used without formatting and parsing them as text
+	const VariableValue *FindReference(const char *source) const;
 };
 
@@ -18,12 +18,59 @@ XMLUtils::XMLUtils(const VariableManager *varMng) :
 	varMng(varMng) {
 }
 
-std::string XMLUtils::Resolve(const std::string &source) {
-	std::string result;
-	if(source.length() > 0 && varMng != nullptr) {
-		return varMng->Resolve(source);
-	}
-	return(source);
+const char *XMLUtils::Resolve(const char *source) {
+	if(varMng == nullptr || !VariableManager::HasReferences(source))
+		return(source);
+	varMng->Resolve(source, resolveBuffer);
+	return(resolveBuffer.c_str());
+}
+
+const VariableValue *XMLUtils::FindReference(const char *source, const ValueType type) const {
+	if(varMng == nullptr)
+		return(nullptr);
+	const VariableValue *result = varMng->FindReference(source);
+	if(result == nullptr || result->type != type)
+		return(nullptr);
+	return(result);
+}
+
+bool XMLUtils::toBool(const char *source) {
+	const VariableValue *value = FindReference(source, ValueType::Bool);
+	if(value != nullptr)
+		return(value->boolValue.value);
+	return Utils::toBool(Resolve(source));
+}
+
+int32_t XMLUtils::toS32(const char *source) {
+	const VariableValue *value = FindReference(source, ValueType::S32);
+	if(value != nullptr)
+		return(value->s32Value.value);
+	return Utils::toS32(Resolve(source));
+}
+
+uint32_t XMLUtils::toU32(const char *source) {
+	return Utils::toU32(Resolve(source));
+}
+
+float XMLUtils::toFloat(const char *source) {
+	const VariableValue *value = FindReference(source, ValueType::Float);
+	if(value != nullptr)
+		return(value->floatValue.value);
+	return Utils::toFloat(Resolve(source));
+}
+
+glm::vec3 XMLUtils::toVec3(const char *source) {
+	const VariableValue *value = FindReference(source, ValueType::Vec3);
+	if(value != nullptr)
+		return(value->vec3Value.value);
+	return Utils::toVec3(Resolve(source));
+}
+
+glm::vec4 XMLUtils::toVec4(const char *source) {
+	const VariableValue *value = FindReference(source, ValueType::Vec4);
+	if(value != nullptr)
+		return(value->vec4Value.value);
+	return Utils::toVec4(Resolve(source));
 }
 
 std::vector<const fxmlTag *> XMLUtils::getChilds(const fxmlTag *parent, const char *search) {
@@ -42,69 +89,47 @@ std::string XMLUtils::getNodeValue(const fxmlTag *parent, const char *search, co
 	std::string r = def;
 	const fxmlTag *foundNode = fxmlFindTagByName(parent, search);
 	if(foundNode != nullptr) {
-		std::string v = foundNode->value;
-		std::string r = Resolve(v);
-		return(r);
+		return Resolve(foundNode->value);
 	}
 	return(def);
 }
 
 bool XMLUtils::getNodeBool(const fxmlTag *parent, const char *search, const bool def) {
-	bool r = def;
 	const fxmlTag *foundNode = fxmlFindTagByName(parent, search);
 	if(foundNode != nullptr) {
-		std::string v = foundNode->value;
-		std::string r = Resolve(v);
-		bool result = Utils::toBool(r);
-		return(result);
+		return toBool(foundNode->value);
 	}
 	return(def);
 }
 
 int32_t XMLUtils::getNodeS32(const fxmlTag *parent, const char *search, const int32_t def) {
-	int32_t r = def;
 	const fxmlTag *foundNode = fxmlFindTagByName(parent, search);
 	if(foundNode != nullptr) {
-		std::string v = foundNode->value;
-		std::string r = Resolve(v);
-		int32_t result = Utils::toS32(r);
-		return(result);
+		return toS32(foundNode->value);
 	}
 	return(def);
 }
 
 uint32_t XMLUtils::getNodeU32(const fxmlTag *parent, const char *search, const uint32_t def) {
-	uint32_t r = def;
 	const fxmlTag *foundNode = fxmlFindTagByName(parent, search);
 	if(foundNode != nullptr) {
-		std::string v = foundNode->value;
-		std::string r = Resolve(v);
-		uint32_t result = Utils::toU32(r);
-		return(result);
+		return toU32(foundNode->value);
 	}
 	return(def);
 }
 
 float XMLUtils::getNodeFloat(const fxmlTag *parent, const char *search, const float def) {
-	float r = def;
 	const fxmlTag *foundNode = fxmlFindTagByName(parent, search);
 	if(foundNode != nullptr) {
-		std::string v = foundNode->value;
-		std::string r = Resolve(v);
-		float result = Utils::toFloat(r);
-		return(result);
+		return toFloat(foundNode->value);
 	}
 	return(def);
 }
 
 glm::vec3 XMLUtils::getNodeVec3(const fxmlTag *parent, const char *search, const glm::vec3 &def) {
-	glm::vec3 r = def;
 	const fxmlTag *foundNode = fxmlFindTagByName(parent, search);
 	if(foundNode != nullptr) {
-		std::string v = foundNode->value;
-		std::string r = Resolve(v);
-		glm::vec3 result = Utils::toVec3(r);
-		return(result);
+		return toVec3(foundNode->value);
 	}
 	return(def);
 }
@@ -112,10 +137,7 @@ glm::vec3 XMLUtils::getNodeVec3(const fxmlTag *parent, const char *search, const
 glm::vec4 XMLUtils::getNodeVec4(const fxmlTag *parent, const char *search, const glm::vec4 &def) {
 	const fxmlTag *foundNode = fxmlFindTagByName(parent, search);
 	if(foundNode != nullptr) {
-		std::string v = foundNode->value;
-		std::string r = Resolve(v);
-		glm::vec4 result = Utils::toVec4(r);
-		return(result);
+		return toVec4(foundNode->value);
 	}
 	return(def);
 }
@@ -123,9 +145,7 @@ glm::vec4 XMLUtils::getNodeVec4(const fxmlTag *parent, const char *search, const
 std::string XMLUtils::getAttribute(const fxmlTag *parent, const char *attr, const char *def) {
 	const fxmlTag *foundAttr = fxmlFindAttributeByName(parent, attr);
 	if(foundAttr != nullptr) {
-		std::string v = foundAttr->value;
-		std::string r = Resolve(v);
-		return(r);
+		return Resolve(foundAttr->value);
 	}
 	return def;
 }
@@ -133,10 +153,7 @@ std::string XMLUtils::getAttribute(const fxmlTag *parent, const char *attr, cons
 bool XMLUtils::getAttributeBool(const fxmlTag *parent, const char *attr, const bool def) {
 	const fxmlTag *foundAttr = fxmlFindAttributeByName(parent, attr);
 	if(foundAttr != nullptr) {
-		std::string v = foundAttr->value;
-		std::string r = Resolve(v);
-		bool result = Utils::toBool(r);
-		return(result);
+		return toBool(foundAttr->value);
 	}
 	return def;
 }
@@ -144,10 +161,7 @@ bool XMLUtils::getAttributeBool(const fxmlTag *parent, const char *attr, const b
 float XMLUtils::getAttributeFloat(const fxmlTag *parent, const char *attr, const float def) {
 	const fxmlTag *foundAttr = fxmlFindAttributeByName(parent, attr);
 	if(foundAttr != nullptr) {
-		std::string v = foundAttr->value;
-		std::string r = Resolve(v);
-		float result = Utils::toFloat(r);
-		return(result);
+		return toFloat(foundAttr->value);
 	}
 	return def;
 }
@@ -155,10 +169,7 @@ float XMLUtils::getAttributeFloat(const fxmlTag *parent, const char *attr, const
 int32_t XMLUtils::getAttributeS32(const fxmlTag *parent, const char *attr, const int32_t def) {
 	const fxmlTag *foundAttr = fxmlFindAttributeByName(parent, attr);
 	if(foundAttr != nullptr) {
-		std::string v = foundAttr->value;
-		std::string r = Resolve(v);
-		int32_t result = Utils::toS32(r);
-		return(result);
+		return toS32(foundAttr->value);
 	}
 	return def;
 }
@@ -166,10 +177,7 @@ int32_t XMLUtils::getAttributeS32(const fxmlTag *parent, const char *attr, const
 uint32_t XMLUtils::getAttributeU32(const fxmlTag *parent, const char *attr, const uint32_t def) {
 	const fxmlTag *foundAttr = fxmlFindAttributeByName(parent, attr);
 	if(foundAttr != nullptr) {
-		std::string v = foundAttr->value;
-		std::string r = Resolve(v);
-		uint32_t result = Utils::toU32(r);
-		return(result);
+		return toU32(foundAttr->value);
 	}
 	return def;
 }
@@ -177,10 +185,7 @@ uint32_t XMLUtils::getAttributeU32(const fxmlTag *parent, const char *attr, cons
 glm::vec3 XMLUtils::getAttributeVec3(const fxmlTag *parent, const char *attr, const glm::vec3 &def) {
 	const fxmlTag *foundAttr = fxmlFindAttributeByName(parent, attr);
 	if(foundAttr != nullptr) {
-		std::string v = foundAttr->value;
-		std::string r = Resolve(v);
-		glm::vec3 result = Utils::toVec3(r);
-		return(result);
+		return toVec3(foundAttr->value);
 	}
 	return def;
 }
@@ -188,10 +193,7 @@ glm::vec3 XMLUtils::getAttributeVec3(const fxmlTag *parent, const char *attr, co
 glm::vec4 XMLUtils::getAttributeVec4(const fxmlTag *parent, const char *attr, const glm::vec4 &def) {
 	const fxmlTag *foundAttr = fxmlFindAttributeByName(parent, attr);
 	if(foundAttr != nullptr) {
-		std::string v = foundAttr->value;
-		std::string r = Resolve(v);
-		glm::vec4 result = Utils::toVec4(r);
-		return(result);
+		return toVec4(foundAttr->value);
 	}
 	return def;
 }
\ No newline at end of file
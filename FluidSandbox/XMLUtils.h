@@ -22,7 +22,17 @@
 struct XMLUtils {
 private:
 	const VariableManager *varMng;
-	std::string Resolve(const std::string &source);
+	std::string resolveBuffer;
+	// Returns the source when it has no variable references, otherwise the resolved text in the resolve buffer
+	const char *Resolve(const char *source);
+	const VariableValue *FindReference(const char *source, const ValueType type) const;
+
+	bool toBool(const char *source);
+	int32_t toS32(const char *source);
+	uint32_t toU32(const char *source);
+	float toFloat(const char *source);
+	glm::vec3 toVec3(const char *source);
+	glm::vec4 toVec4(const char *source);
 public:
 	XMLUtils();
 	XMLUtils(const VariableManager *varMng);